@@ -0,0 +1,62 @@
+#include <stdio.h>
+#include "esch.h"
+#include "esch_bench.h"
+#include "esch_debug.h"
+#include "esch_config.h"
+
+/*
+ * Read config in a loop, like object constructors do. Compare lookup
+ * by key string with lookup by key ID. Config has extra keys, so a
+ * linear search by name would have to walk past them.
+ */
+esch_error bench_configLookup(esch_config* config)
+{
+    esch_error ret = ESCH_OK;
+    esch_config* new_config = NULL;
+    esch_alloc* alloc = NULL;
+    esch_log* log = NULL;
+    esch_object* obj = NULL;
+    esch_config_key_id id = ESCH_CONFIG_KEY_ID_PREDEFINED;
+    const size_t count = 10000000;
+    char name[32];
+    clock_t start = 0;
+    size_t sum = 0;
+    size_t i = 0;
+
+    alloc = ESCH_CAST_FROM_OBJECT(ESCH_CONFIG_GET_ALLOC(config), esch_alloc);
+    log = ESCH_CAST_FROM_OBJECT(ESCH_CONFIG_GET_LOG(config), esch_log);
+    ret = esch_config_new(log, alloc, &new_config);
+    ESCH_BENCH_CHECK(ret == ESCH_OK, "Can't create config", ret);
+    for (i = 0; i < 40; ++i) {
+        sprintf(name, "bench:key:%d", (int)i);
+        ret = esch_config_add_key(new_config, name,
+                                  ESCH_CONFIG_VALUE_TYPE_INTEGER, &id);
+        ESCH_BENCH_CHECK(ret == ESCH_OK, "Can't add key", ret);
+    }
+
+    start = clock();
+    for (i = 0; i < count; ++i) {
+        ret = esch_config_get_obj(new_config, ESCH_CONFIG_KEY_GC_NAIVE_ROOT,
+                                  &obj);
+        sum += (size_t)obj;
+    }
+    esch_bench_report("config:get_by_key", count, start, clock());
+    ESCH_BENCH_CHECK(ret == ESCH_OK, "Can't get by key", ret);
+
+    start = clock();
+    for (i = 0; i < count; ++i) {
+        ret = esch_config_get_obj_by_id(new_config,
+                                        ESCH_CONFIG_KEY_ID_GC_NAIVE_ROOT,
+                                        &obj);
+        sum += (size_t)obj;
+    }
+    esch_bench_report("config:get_by_id", count, start, clock());
+    ESCH_BENCH_CHECK(ret == ESCH_OK, "Can't get by ID", ret);
+
+    esch_log_info(g_benchLog, "checksum: %d", (int)(sum & 0xff));
+Exit:
+    if (new_config != NULL) {
+        esch_object_delete(ESCH_CAST_TO_OBJECT(new_config));
+    }
+    return ret;
+}
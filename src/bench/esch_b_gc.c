@@ -0,0 +1,90 @@
+#include <stdio.h>
+#include "esch.h"
+#include "esch_bench.h"
+#include "esch_debug.h"
+#include "esch_config.h"
+#include "esch_vector.h"
+#include "esch_gc.h"
+
+#define BENCH_GC_TRACE_FILE "esch_bench_trace.bin"
+
+/*
+ * Attach and recycle many small objects. Every object attached and
+ * every element visited by mark goes through a log call, so this is
+ * where logging overhead shows up.
+ */
+static esch_error
+bench_gcRun(esch_config* config, const char* attach_name,
+            const char* recycle_name)
+{
+    esch_error ret = ESCH_OK;
+    esch_vector* root = NULL;
+    esch_string* str = NULL;
+    esch_gc* gc = NULL;
+    const size_t count = 200000;
+    const int rounds = 20;
+    clock_t start = 0;
+    size_t i = 0;
+    int r = 0;
+
+    esch_config_set_int(config, ESCH_CONFIG_KEY_VECTOR_ENLARGE, 1);
+    esch_config_set_int(config, ESCH_CONFIG_KEY_GC_NAIVE_SLOTS,
+                        (int)(count + 64));
+    esch_config_set_int(config, ESCH_CONFIG_KEY_GC_NAIVE_ENLARGE, 1);
+    ret = esch_vector_new(config, &root);
+    ESCH_BENCH_CHECK(ret == ESCH_OK, "Can't create root", ret);
+    esch_config_set_obj(config, ESCH_CONFIG_KEY_GC_NAIVE_ROOT,
+                        ESCH_CAST_TO_OBJECT(root));
+    ret = esch_gc_new_naive_mark_sweep(config, &gc);
+    ESCH_BENCH_CHECK(ret == ESCH_OK, "Can't create gc", ret);
+    esch_config_set_obj(config, ESCH_CONFIG_KEY_GC, ESCH_CAST_TO_OBJECT(gc));
+
+    /* Half of objects are garbage. Root keeps the others, with an
+     * integer after each of them. */
+    start = clock();
+    for (i = 0; i < count; ++i) {
+        ret = esch_string_new_from_utf8(config, "obj", 0, -1, &str);
+        ESCH_BENCH_CHECK(ret == ESCH_OK, "Can't create string", ret);
+        if (i % 2 == 0) {
+            ret = esch_vector_append_object(root, ESCH_CAST_TO_OBJECT(str));
+            ESCH_BENCH_CHECK(ret == ESCH_OK, "Can't append object", ret);
+            ret = esch_vector_append_integer(root, (int)i);
+            ESCH_BENCH_CHECK(ret == ESCH_OK, "Can't append integer", ret);
+        }
+    }
+    esch_bench_report(attach_name, count, start, clock());
+
+    start = clock();
+    for (r = 0; r < rounds; ++r) {
+        ret = esch_gc_recycle(gc);
+        ESCH_BENCH_CHECK(ret == ESCH_OK, "Can't recycle", ret);
+    }
+    esch_bench_report(recycle_name, count * rounds, start, clock());
+Exit:
+    if (gc != NULL) {
+        esch_object_delete(ESCH_CAST_TO_OBJECT(gc));
+    }
+    esch_config_set_obj(config, ESCH_CONFIG_KEY_GC, NULL);
+    esch_config_set_obj(config, ESCH_CONFIG_KEY_GC_NAIVE_ROOT, NULL);
+    esch_config_set_int(config, ESCH_CONFIG_KEY_GC_NAIVE_SLOTS, -1);
+    esch_config_set_int(config, ESCH_CONFIG_KEY_GC_NAIVE_ENLARGE, 0);
+    return ret;
+}
+
+esch_error bench_gcRecycle(esch_config* config)
+{
+    return bench_gcRun(config, "gc:attach", "gc:recycle");
+}
+
+/* Same as above, with binary trace on. */
+esch_error bench_gcTrace(esch_config* config)
+{
+    esch_error ret = ESCH_OK;
+    ret = esch_trace_start(BENCH_GC_TRACE_FILE);
+    ESCH_BENCH_CHECK(ret == ESCH_OK, "Can't start trace", ret);
+    ret = bench_gcRun(config, "gc:attach:traced", "gc:recycle:traced");
+    (void)esch_trace_stop();
+    (void)remove(BENCH_GC_TRACE_FILE);
+Exit:
+    return ret;
+}
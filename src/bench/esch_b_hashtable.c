@@ -0,0 +1,109 @@
+#include <stdio.h>
+#include "esch.h"
+#include "esch_bench.h"
+#include "esch_debug.h"
+
+/*
+ * Keys are scrambled even fixnums, so hits and misses are spread over
+ * the table instead of walking it in order. Odd multiplier keeps keys
+ * distinct within 30 bits.
+ */
+static int
+bench_hashtableKey(size_t i)
+{
+    return (int)(((uint32_t)i * 2654435761U) & 0x3FFFFFFF) * 2;
+}
+
+/*
+ * Time inserts in batches of this size. Worst batch shows the longest
+ * pause, e.g. when table grows.
+ */
+#define BENCH_HASHTABLE_BATCH 1024
+
+static esch_error
+bench_hashtableRun(esch_config* config, size_t count)
+{
+    esch_error ret = ESCH_OK;
+    esch_hashtable* table = NULL;
+    esch_value key;
+    esch_value value;
+    clock_t start = 0;
+    clock_t batch = 0;
+    clock_t worst = 0;
+    clock_t now = 0;
+    char name[64];
+    size_t i = 0;
+
+    ret = esch_hashtable_new(config, ESCH_HASHTABLE_EQ, &table);
+    ESCH_BENCH_CHECK(ret == ESCH_OK, "Can't create table", ret);
+    key.type = ESCH_VALUE_TYPE_INTEGER;
+    value.type = ESCH_VALUE_TYPE_INTEGER;
+
+    start = clock();
+    batch = start;
+    for (i = 0; i < count; ++i) {
+        key.val.i = bench_hashtableKey(i);
+        value.val.i = (int)i;
+        ret = esch_hashtable_set(table, &key, &value);
+        ESCH_BENCH_CHECK(ret == ESCH_OK, "Can't set key", ret);
+        if ((i + 1) % BENCH_HASHTABLE_BATCH == 0) {
+            now = clock();
+            if (now - batch > worst) {
+                worst = now - batch;
+            }
+            batch = now;
+        }
+    }
+    now = clock();
+    sprintf(name, "hashtable:insert:%lu", (unsigned long)count);
+    esch_bench_report(name, count, start, now);
+    sprintf(name, "hashtable:insert_worst_batch:%lu", (unsigned long)count);
+    esch_bench_report(name, BENCH_HASHTABLE_BATCH, 0, worst);
+
+    start = clock();
+    for (i = 0; i < count; ++i) {
+        key.val.i = bench_hashtableKey(i);
+        ret = esch_hashtable_ref(table, &key, &value);
+        ESCH_BENCH_CHECK(ret == ESCH_OK && value.val.i == (int)i,
+                         "Can't find key", ESCH_ERROR_INVALID_STATE);
+    }
+    sprintf(name, "hashtable:lookup_hit:%lu", (unsigned long)count);
+    esch_bench_report(name, count, start, clock());
+
+    /* Odd keys are never added. */
+    start = clock();
+    for (i = 0; i < count; ++i) {
+        key.val.i = bench_hashtableKey(i) | 1;
+        ret = esch_hashtable_ref(table, &key, &value);
+        ESCH_BENCH_CHECK(ret == ESCH_ERROR_NOT_FOUND,
+                         "Unexpected key", ESCH_ERROR_INVALID_STATE);
+    }
+    sprintf(name, "hashtable:lookup_miss:%lu", (unsigned long)count);
+    esch_bench_report(name, count, start, clock());
+    ret = ESCH_OK;
+
+    start = clock();
+    for (i = 0; i < count; i += 2) {
+        key.val.i = bench_hashtableKey(i);
+        ret = esch_hashtable_delete(table, &key);
+        ESCH_BENCH_CHECK(ret == ESCH_OK, "Can't delete key", ret);
+    }
+    sprintf(name, "hashtable:delete:%lu", (unsigned long)count);
+    esch_bench_report(name, count / 2, start, clock());
+Exit:
+    if (table != NULL) {
+        esch_object_delete(ESCH_CAST_TO_OBJECT(table));
+    }
+    return ret;
+}
+
+esch_error bench_hashtable(esch_config* config)
+{
+    esch_error ret = ESCH_OK;
+    ret = bench_hashtableRun(config, 1000000);
+    ESCH_BENCH_CHECK(ret == ESCH_OK, "Failed with 1M keys", ret);
+    ret = bench_hashtableRun(config, 4000000);
+    ESCH_BENCH_CHECK(ret == ESCH_OK, "Failed with 4M keys", ret);
+Exit:
+    return ret;
+}
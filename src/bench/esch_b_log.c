@@ -0,0 +1,55 @@
+#include <stdio.h>
+#include "esch.h"
+#include "esch_bench.h"
+#include "esch_debug.h"
+#include "esch_config.h"
+
+/*
+ * Cost of one log call seen by caller. Async log formats message into
+ * ring buffer and returns. Messages go to an invalid fd, so write()
+ * costs nothing and we measure buffer only.
+ */
+esch_error bench_logAsync(esch_config* config)
+{
+    esch_error ret = ESCH_OK;
+    esch_log* log = NULL;
+    const size_t count = 1000000;
+    size_t written = 0;
+    size_t dropped = 0;
+    clock_t start = 0;
+    size_t i = 0;
+
+    esch_config_set_int(config, ESCH_CONFIG_KEY_LOG_ASYNC_FD, -1);
+    esch_config_set_int(config, ESCH_CONFIG_KEY_LOG_ASYNC_SLOTS, 65536);
+    ret = esch_log_new_async(config, &log);
+    ESCH_BENCH_CHECK(ret == ESCH_OK, "Can't create async log", ret);
+
+    start = clock();
+    for (i = 0; i < count; ++i) {
+        (void)esch_log_info(log, "bench:log: message %d of %s",
+                            (int)i, "bench_logAsync");
+    }
+    esch_bench_report("log:async:info", count, start, clock());
+    ret = esch_log_flush(log);
+    ESCH_BENCH_CHECK(ret == ESCH_OK, "Can't flush", ret);
+    ret = esch_log_get_counters(log, &written, &dropped);
+    esch_log_info(g_benchLog, "written = %d, dropped = %d",
+                  (int)written, (int)dropped);
+
+    /* Level check only. */
+    ret = esch_log_set_level(log, ESCH_LOG_LEVEL_WARN);
+    start = clock();
+    for (i = 0; i < count; ++i) {
+        (void)esch_log_info(log, "bench:log: message %d of %s",
+                            (int)i, "bench_logAsync");
+    }
+    esch_bench_report("log:async:info_disabled", count, start, clock());
+Exit:
+    if (log != NULL) {
+        esch_object_delete(ESCH_CAST_TO_OBJECT(log));
+    }
+    esch_config_set_int(config, ESCH_CONFIG_KEY_LOG_ASYNC_FD, 1);
+    esch_config_set_int(config, ESCH_CONFIG_KEY_LOG_ASYNC_SLOTS,
+                        ESCH_LOG_ASYNC_DEFAULT_SLOTS);
+    return ret;
+}
@@ -0,0 +1,529 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "esch.h"
+#include "esch_bench.h"
+#include "esch_debug.h"
+#include "esch_alloc.h"
+#include "esch_config.h"
+#include "esch_number.h"
+
+/* Integer with about given number of limbs: all digits are 9. */
+static esch_error
+bench_integerNines(esch_config* config, size_t limbs, esch_integer** val)
+{
+    esch_error ret = ESCH_OK;
+    esch_alloc* alloc = NULL;
+    char* digits = NULL;
+    /* A limb holds 9.63 decimal digits. */
+    size_t len = limbs * 963 / 100;
+
+    alloc = ESCH_CAST_FROM_OBJECT(ESCH_CONFIG_GET_ALLOC(config), esch_alloc);
+    ret = esch_alloc_realloc(alloc, NULL, len + 1, (void**)&digits);
+    ESCH_BENCH_CHECK(ret == ESCH_OK, "Can't create digits", ret);
+    memset(digits, '9', len);
+    digits[len] = '\0';
+    ret = esch_integer_new_from_base10(config, digits, NULL, val);
+    ESCH_BENCH_CHECK(ret == ESCH_OK, "Can't parse digits", ret);
+Exit:
+    esch_alloc_free(alloc, digits);
+    return ret;
+}
+
+/* Product of [low, high], by binary splitting. */
+static esch_error
+bench_integerProduct(esch_config* config, int low, int high,
+                     esch_integer** val)
+{
+    esch_error ret = ESCH_OK;
+    esch_integer* left = NULL;
+    esch_integer* right = NULL;
+    int mid = 0;
+
+    if (high - low < 8) {
+        ret = esch_integer_new_from_int(config, low, &left);
+        ESCH_BENCH_CHECK(ret == ESCH_OK, "Can't create integer", ret);
+        for (mid = low + 1; mid <= high; ++mid) {
+            ret = esch_integer_new_from_int(config, mid, &right);
+            ESCH_BENCH_CHECK(ret == ESCH_OK, "Can't create integer", ret);
+            ret = esch_integer_mul(config, left, right, val);
+            ESCH_BENCH_CHECK(ret == ESCH_OK, "Can't multiply", ret);
+            esch_object_delete(ESCH_CAST_TO_OBJECT(left));
+            esch_object_delete(ESCH_CAST_TO_OBJECT(right));
+            left = (*val);
+            right = NULL;
+        }
+        (*val) = left;
+        left = NULL;
+        goto Exit;
+    }
+    mid = low + (high - low) / 2;
+    ret = bench_integerProduct(config, low, mid, &left);
+    ESCH_BENCH_CHECK(ret == ESCH_OK, "Can't get left product", ret);
+    ret = bench_integerProduct(config, mid + 1, high, &right);
+    ESCH_BENCH_CHECK(ret == ESCH_OK, "Can't get right product", ret);
+    ret = esch_integer_mul(config, left, right, val);
+    ESCH_BENCH_CHECK(ret == ESCH_OK, "Can't multiply", ret);
+Exit:
+    if (left != NULL) {
+        esch_object_delete(ESCH_CAST_TO_OBJECT(left));
+    }
+    if (right != NULL) {
+        esch_object_delete(ESCH_CAST_TO_OBJECT(right));
+    }
+    return ret;
+}
+
+/*
+ * Square integers of different sizes. Schoolbook multiplication is
+ * used below ESCH_BIGNUM_KARATSUBA_THRESHOLD limbs, so this is where
+ * the threshold is tuned.
+ */
+esch_error bench_integerMul(esch_config* config)
+{
+    esch_error ret = ESCH_OK;
+    esch_integer* val = NULL;
+    esch_integer* product = NULL;
+    static const size_t sizes[] = { 16, 32, 48, 64, 128, 512, 2048 };
+    char name[64];
+    size_t rounds = 0;
+    size_t i = 0;
+    size_t r = 0;
+    clock_t start = 0;
+
+    for (i = 0; i < sizeof(sizes) / sizeof(sizes[0]); ++i) {
+        ret = bench_integerNines(config, sizes[i], &val);
+        ESCH_BENCH_CHECK(ret == ESCH_OK, "Can't create integer", ret);
+        rounds = 20000000 / (sizes[i] * sizes[i]) + 1;
+        start = clock();
+        for (r = 0; r < rounds; ++r) {
+            ret = esch_integer_mul(config, val, val, &product);
+            ESCH_BENCH_CHECK(ret == ESCH_OK, "Can't multiply", ret);
+            esch_object_delete(ESCH_CAST_TO_OBJECT(product));
+        }
+        sprintf(name, "integer:mul:%d", (int)sizes[i]);
+        esch_bench_report(name, rounds, start, clock());
+        esch_object_delete(ESCH_CAST_TO_OBJECT(val));
+        val = NULL;
+    }
+Exit:
+    if (val != NULL) {
+        esch_object_delete(ESCH_CAST_TO_OBJECT(val));
+    }
+    return ret;
+}
+
+esch_error bench_integerFactorial(esch_config* config)
+{
+    esch_error ret = ESCH_OK;
+    esch_alloc* alloc = NULL;
+    esch_integer* val = NULL;
+    char* digits = NULL;
+    const int n = 20000;
+    size_t len = 0;
+    clock_t start = 0;
+
+    alloc = ESCH_CAST_FROM_OBJECT(ESCH_CONFIG_GET_ALLOC(config), esch_alloc);
+    start = clock();
+    ret = bench_integerProduct(config, 1, n, &val);
+    ESCH_BENCH_CHECK(ret == ESCH_OK, "Can't get factorial", ret);
+    esch_bench_report("integer:factorial:20000", 1, start, clock());
+
+    ret = esch_integer_to_base10(val, NULL, 0, &len);
+    ESCH_BENCH_CHECK(ret == ESCH_ERROR_OUT_OF_BOUND, "Can't get length",
+                     ESCH_ERROR_INVALID_STATE);
+    ret = esch_alloc_realloc(alloc, NULL, len + 1, (void**)&digits);
+    ESCH_BENCH_CHECK(ret == ESCH_OK, "Can't create digits", ret);
+    start = clock();
+    ret = esch_integer_to_base10(val, digits, len + 1, &len);
+    ESCH_BENCH_CHECK(ret == ESCH_OK, "Can't convert", ret);
+    esch_bench_report("integer:to_base10:factorial", 1, start, clock());
+    esch_log_info(g_benchLog, "20000! has %d digits", (int)len);
+Exit:
+    if (val != NULL) {
+        esch_object_delete(ESCH_CAST_TO_OBJECT(val));
+    }
+    esch_alloc_free(alloc, digits);
+    return ret;
+}
+
+esch_error bench_integerFibonacci(esch_config* config)
+{
+    esch_error ret = ESCH_OK;
+    esch_integer* a = NULL;
+    esch_integer* b = NULL;
+    esch_integer* c = NULL;
+    const int n = 100000;
+    size_t len = 0;
+    clock_t start = 0;
+    int i = 0;
+
+    ret = esch_integer_new_from_int(config, 0, &a);
+    ESCH_BENCH_CHECK(ret == ESCH_OK, "Can't create integer", ret);
+    ret = esch_integer_new_from_int(config, 1, &b);
+    ESCH_BENCH_CHECK(ret == ESCH_OK, "Can't create integer", ret);
+    start = clock();
+    for (i = 0; i < n; ++i) {
+        ret = esch_integer_add(config, a, b, &c);
+        ESCH_BENCH_CHECK(ret == ESCH_OK, "Can't add", ret);
+        esch_object_delete(ESCH_CAST_TO_OBJECT(a));
+        a = b;
+        b = c;
+        c = NULL;
+    }
+    esch_bench_report("integer:fibonacci:100000", n, start, clock());
+    (void)esch_integer_to_base10(a, NULL, 0, &len);
+    esch_log_info(g_benchLog, "fib(100000) has %d digits", (int)len);
+Exit:
+    if (a != NULL) {
+        esch_object_delete(ESCH_CAST_TO_OBJECT(a));
+    }
+    if (b != NULL) {
+        esch_object_delete(ESCH_CAST_TO_OBJECT(b));
+    }
+    return ret;
+}
+
+/*
+ * Counting loop on values. Fixnums never touch allocator, compare
+ * with same loop on integer objects.
+ */
+esch_error bench_integerCounter(esch_config* config)
+{
+    esch_error ret = ESCH_OK;
+    esch_value counter;
+    esch_value step;
+    esch_integer* a = NULL;
+    esch_integer* b = NULL;
+    esch_integer* c = NULL;
+    const int n = 10000000;
+    clock_t start = 0;
+    int i = 0;
+
+    counter.type = ESCH_VALUE_TYPE_INTEGER;
+    counter.val.i = 0;
+    step.type = ESCH_VALUE_TYPE_INTEGER;
+    step.val.i = 1;
+    start = clock();
+    for (i = 0; i < n; ++i) {
+        ret = esch_value_add(config, &counter, &step, &counter);
+        ESCH_BENCH_CHECK(ret == ESCH_OK, "Can't add", ret);
+    }
+    esch_bench_report("integer:counter:value", n, start, clock());
+    ESCH_BENCH_CHECK(counter.val.i == n, "Bad counter",
+                     ESCH_ERROR_INVALID_STATE);
+
+    ret = esch_integer_new_from_int(config, 0, &a);
+    ESCH_BENCH_CHECK(ret == ESCH_OK, "Can't create integer", ret);
+    ret = esch_integer_new_from_int(config, 1, &b);
+    ESCH_BENCH_CHECK(ret == ESCH_OK, "Can't create integer", ret);
+    start = clock();
+    for (i = 0; i < n; ++i) {
+        ret = esch_integer_add(config, a, b, &c);
+        ESCH_BENCH_CHECK(ret == ESCH_OK, "Can't add", ret);
+        esch_object_delete(ESCH_CAST_TO_OBJECT(a));
+        a = c;
+        c = NULL;
+    }
+    esch_bench_report("integer:counter:object", n, start, clock());
+Exit:
+    if (a != NULL) {
+        esch_object_delete(ESCH_CAST_TO_OBJECT(a));
+    }
+    if (b != NULL) {
+        esch_object_delete(ESCH_CAST_TO_OBJECT(b));
+    }
+    return ret;
+}
+
+/*
+ * Parse and print decimal strings of different lengths. Divide and
+ * conquer thresholds in esch_number.h are tuned here.
+ */
+esch_error bench_integerBase10(esch_config* config)
+{
+    esch_error ret = ESCH_OK;
+    esch_alloc* alloc = NULL;
+    esch_integer* val = NULL;
+    char* digits = NULL;
+    char* output = NULL;
+    static const size_t sizes[] = { 20, 100, 1000, 10000, 100000, 1000000 };
+    char name[64];
+    size_t rounds = 0;
+    size_t len = 0;
+    size_t i = 0;
+    size_t j = 0;
+    size_t r = 0;
+    clock_t start = 0;
+
+    alloc = ESCH_CAST_FROM_OBJECT(ESCH_CONFIG_GET_ALLOC(config), esch_alloc);
+    for (i = 0; i < sizeof(sizes) / sizeof(sizes[0]); ++i) {
+        ret = esch_alloc_realloc(alloc, NULL, sizes[i] + 2,
+                                 (void**)&digits);
+        ESCH_BENCH_CHECK(ret == ESCH_OK, "Can't create digits", ret);
+        ret = esch_alloc_realloc(alloc, NULL, sizes[i] + 2,
+                                 (void**)&output);
+        ESCH_BENCH_CHECK(ret == ESCH_OK, "Can't create output", ret);
+        /* Not all nines, so no digit pattern is special. */
+        for (j = 0; j < sizes[i]; ++j) {
+            digits[j] = (char)('1' + (j * 7 + j / 3) % 9);
+        }
+        digits[sizes[i]] = '\0';
+        rounds = 20000000 / (sizes[i] * 20) + 1;
+
+        start = clock();
+        for (r = 0; r < rounds; ++r) {
+            if (val != NULL) {
+                esch_object_delete(ESCH_CAST_TO_OBJECT(val));
+                val = NULL;
+            }
+            ret = esch_integer_new_from_base10(config, digits, NULL, &val);
+            ESCH_BENCH_CHECK(ret == ESCH_OK, "Can't parse", ret);
+        }
+        sprintf(name, "integer:parse:%d", (int)sizes[i]);
+        esch_bench_report(name, rounds, start, clock());
+
+        start = clock();
+        for (r = 0; r < rounds; ++r) {
+            ret = esch_integer_to_base10(val, output, sizes[i] + 2, &len);
+            ESCH_BENCH_CHECK(ret == ESCH_OK, "Can't print", ret);
+        }
+        sprintf(name, "integer:print:%d", (int)sizes[i]);
+        esch_bench_report(name, rounds, start, clock());
+        ESCH_BENCH_CHECK(strcmp(digits, output) == 0, "Bad round trip",
+                         ESCH_ERROR_INVALID_STATE);
+
+        esch_object_delete(ESCH_CAST_TO_OBJECT(val));
+        val = NULL;
+        esch_alloc_free(alloc, digits);
+        digits = NULL;
+        esch_alloc_free(alloc, output);
+        output = NULL;
+    }
+Exit:
+    if (val != NULL) {
+        esch_object_delete(ESCH_CAST_TO_OBJECT(val));
+    }
+    esch_alloc_free(alloc, digits);
+    esch_alloc_free(alloc, output);
+    return ret;
+}
+
+#define BENCH_FLOAT_COUNT 10000
+#define BENCH_FLOAT_TEXT 32
+
+/*
+ * Print and parse doubles with random bits, compared with printf()
+ * "%.17g" and strtod() from C library. "%.17g" always round trips,
+ * but is not shortest.
+ */
+esch_error bench_floatBase10(esch_config* config)
+{
+    esch_error ret = ESCH_OK;
+    esch_alloc* alloc = NULL;
+    double* values = NULL;
+    char* texts = NULL;
+    double value = 0.0;
+    uint64_t bits = 0;
+    uint64_t seed = 1;
+    size_t rounds = 100;
+    size_t len = 0;
+    size_t i = 0;
+    size_t r = 0;
+    clock_t start = 0;
+
+    alloc = ESCH_CAST_FROM_OBJECT(ESCH_CONFIG_GET_ALLOC(config), esch_alloc);
+    ret = esch_alloc_realloc(alloc, NULL,
+                             sizeof(double) * BENCH_FLOAT_COUNT,
+                             (void**)&values);
+    ESCH_BENCH_CHECK(ret == ESCH_OK, "Can't create values", ret);
+    ret = esch_alloc_realloc(alloc, NULL,
+                             BENCH_FLOAT_TEXT * BENCH_FLOAT_COUNT,
+                             (void**)&texts);
+    ESCH_BENCH_CHECK(ret == ESCH_OK, "Can't create texts", ret);
+    for (i = 0; i < BENCH_FLOAT_COUNT; ++i) {
+        /* Random finite doubles, from a 64-bit LCG. */
+        do {
+            seed = seed * ESCH_NUMBER_U64(0x5851F42D, 0x4C957F2D) +
+                   ESCH_NUMBER_U64(0x14057B7E, 0xF767814F);
+            bits = seed;
+            memcpy(&value, &bits, sizeof(value));
+        } while (value != value || value - value != 0.0);
+        values[i] = value;
+    }
+
+    start = clock();
+    for (r = 0; r < rounds; ++r) {
+        for (i = 0; i < BENCH_FLOAT_COUNT; ++i) {
+            sprintf(texts + i * BENCH_FLOAT_TEXT, "%.17g", values[i]);
+        }
+    }
+    esch_bench_report("float:print:libc", rounds * BENCH_FLOAT_COUNT,
+                      start, clock());
+    start = clock();
+    for (r = 0; r < rounds; ++r) {
+        for (i = 0; i < BENCH_FLOAT_COUNT; ++i) {
+            value = strtod(texts + i * BENCH_FLOAT_TEXT, NULL);
+            ESCH_BENCH_CHECK(value == values[i], "Bad round trip",
+                             ESCH_ERROR_INVALID_STATE);
+        }
+    }
+    esch_bench_report("float:parse:libc", rounds * BENCH_FLOAT_COUNT,
+                      start, clock());
+
+    start = clock();
+    for (r = 0; r < rounds; ++r) {
+        for (i = 0; i < BENCH_FLOAT_COUNT; ++i) {
+            ret = esch_float_to_base10(values[i],
+                                       texts + i * BENCH_FLOAT_TEXT,
+                                       BENCH_FLOAT_TEXT, &len);
+            ESCH_BENCH_CHECK(ret == ESCH_OK, "Can't print", ret);
+        }
+    }
+    esch_bench_report("float:print", rounds * BENCH_FLOAT_COUNT,
+                      start, clock());
+    start = clock();
+    for (r = 0; r < rounds; ++r) {
+        for (i = 0; i < BENCH_FLOAT_COUNT; ++i) {
+            ret = esch_float_from_base10(texts + i * BENCH_FLOAT_TEXT,
+                                         NULL, &value);
+            ESCH_BENCH_CHECK(ret == ESCH_OK, "Can't parse", ret);
+            ESCH_BENCH_CHECK(value == values[i], "Bad round trip",
+                             ESCH_ERROR_INVALID_STATE);
+        }
+    }
+    esch_bench_report("float:parse", rounds * BENCH_FLOAT_COUNT,
+                      start, clock());
+Exit:
+    esch_alloc_free(alloc, values);
+    esch_alloc_free(alloc, texts);
+    return ret;
+}
+
+/* Sum 1/k into a fraction, which grows to many limbs. */
+static esch_error
+bench_fractionHarmonic(esch_config* config, int n, esch_fraction** val)
+{
+    esch_error ret = ESCH_OK;
+    esch_fraction* sum = NULL;
+    esch_fraction* term = NULL;
+    esch_fraction* next = NULL;
+    int k = 0;
+
+    ret = esch_fraction_new_from_int(config, 0, 1, &sum);
+    ESCH_BENCH_CHECK(ret == ESCH_OK, "Can't create 0", ret);
+    for (k = 1; k <= n; ++k) {
+        ret = esch_fraction_new_from_int(config, 1, k, &term);
+        ESCH_BENCH_CHECK(ret == ESCH_OK, "Can't create 1/k", ret);
+        ret = esch_fraction_add(config, sum, term, &next);
+        ESCH_BENCH_CHECK(ret == ESCH_OK, "Can't add", ret);
+        esch_object_delete(ESCH_CAST_TO_OBJECT(term));
+        esch_object_delete(ESCH_CAST_TO_OBJECT(sum));
+        term = NULL;
+        sum = next;
+    }
+    (*val) = sum;
+    sum = NULL;
+Exit:
+    if (sum != NULL) {
+        esch_object_delete(ESCH_CAST_TO_OBJECT(sum));
+    }
+    if (term != NULL) {
+        esch_object_delete(ESCH_CAST_TO_OBJECT(term));
+    }
+    return ret;
+}
+
+esch_error bench_fraction(esch_config* config)
+{
+    esch_error ret = ESCH_OK;
+    esch_alloc* alloc = NULL;
+    esch_fraction* a = NULL;
+    esch_fraction* b = NULL;
+    esch_fraction* c = NULL;
+    esch_limb* limbs = NULL;
+    static const size_t sizes[] = { 4, 16, 64, 256 };
+    static const int terms[] = { 100, 500, 2000 };
+    char name[64];
+    uint64_t seed = 1;
+    size_t rounds = 0;
+    size_t n = 0;
+    size_t i = 0;
+    size_t r = 0;
+    clock_t start = 0;
+
+    /* Small fractions: int64_t arithmetic and 64-bit binary gcd. */
+    rounds = 1000000;
+    start = clock();
+    for (r = 0; r < rounds; ++r) {
+        ret = esch_fraction_new_from_int(config, (int)r + 1, (int)r + 2,
+                                         &a);
+        ESCH_BENCH_CHECK(ret == ESCH_OK, "Can't create fraction", ret);
+        ret = esch_fraction_new_from_int(config, 3, (int)r + 5, &b);
+        ESCH_BENCH_CHECK(ret == ESCH_OK, "Can't create fraction", ret);
+        ret = esch_fraction_add(config, a, b, &c);
+        ESCH_BENCH_CHECK(ret == ESCH_OK, "Can't add", ret);
+        esch_object_delete(ESCH_CAST_TO_OBJECT(c));
+        ret = esch_fraction_div(config, a, b, &c);
+        ESCH_BENCH_CHECK(ret == ESCH_OK, "Can't divide", ret);
+        esch_object_delete(ESCH_CAST_TO_OBJECT(c));
+        esch_object_delete(ESCH_CAST_TO_OBJECT(a));
+        esch_object_delete(ESCH_CAST_TO_OBJECT(b));
+        a = NULL;
+        b = NULL;
+        c = NULL;
+    }
+    esch_bench_report("fraction:small", rounds * 2, start, clock());
+
+    /* Harmonic sums: big fractions reduced by Lehmer's gcd. */
+    for (i = 0; i < sizeof(terms) / sizeof(terms[0]); ++i) {
+        start = clock();
+        ret = bench_fractionHarmonic(config, terms[i], &c);
+        ESCH_BENCH_CHECK(ret == ESCH_OK, "Can't sum", ret);
+        sprintf(name, "fraction:harmonic:%d", terms[i]);
+        esch_bench_report(name, (size_t)terms[i], start, clock());
+        esch_object_delete(ESCH_CAST_TO_OBJECT(c));
+        c = NULL;
+    }
+
+    /* Limb gcd of random numbers, same length. */
+    alloc = ESCH_CAST_FROM_OBJECT(ESCH_CONFIG_GET_ALLOC(config), esch_alloc);
+    for (i = 0; i < sizeof(sizes) / sizeof(sizes[0]); ++i) {
+        n = sizes[i];
+        ret = esch_alloc_realloc(alloc, NULL, sizeof(esch_limb) *
+                                 (3 * n + ESCH_BIGNUM_GCD_SCRATCH(n)),
+                                 (void**)&limbs);
+        ESCH_BENCH_CHECK(ret == ESCH_OK, "Can't create limbs", ret);
+        for (r = 0; r < 2 * n; ++r) {
+            seed = seed * ESCH_NUMBER_U64(0x5851F42D, 0x4C957F2D) +
+                   ESCH_NUMBER_U64(0x14057B7E, 0xF767814F);
+            limbs[r] = (esch_limb)(seed >> ESCH_LIMB_BITS) | 1;
+        }
+        rounds = 2000000 / (n * n) + 1;
+        start = clock();
+        for (r = 0; r < rounds; ++r) {
+            if (esch_bignum_compare_i(limbs, n, limbs + n, n) >= 0) {
+                (void)esch_bignum_gcd_i(limbs + 2 * n, limbs, n,
+                                        limbs + n, n, limbs + 3 * n);
+            } else {
+                (void)esch_bignum_gcd_i(limbs + 2 * n, limbs + n, n,
+                                        limbs, n, limbs + 3 * n);
+            }
+        }
+        sprintf(name, "fraction:gcd:%d", (int)n);
+        esch_bench_report(name, rounds, start, clock());
+        esch_alloc_free(alloc, limbs);
+        limbs = NULL;
+    }
+Exit:
+    if (a != NULL) {
+        esch_object_delete(ESCH_CAST_TO_OBJECT(a));
+    }
+    if (b != NULL) {
+        esch_object_delete(ESCH_CAST_TO_OBJECT(b));
+    }
+    if (limbs != NULL) {
+        esch_alloc_free(alloc, limbs);
+    }
+    return ret;
+}
@@ -0,0 +1,361 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include "esch.h"
+#include "esch_bench.h"
+#include "esch_debug.h"
+#include "esch_config.h"
+#include "esch_pair.h"
+#include "esch_vector.h"
+
+/*
+ * Build a long list with cons, walk it with iterator, then delete it.
+ * Without GC, so only pair creation and memory layout are measured.
+ */
+static esch_error
+bench_pairRun(esch_config* config, const char* name)
+{
+    esch_error ret = ESCH_OK;
+    esch_pair* list = NULL;
+    esch_pair* next = NULL;
+    esch_value head;
+    esch_value tail;
+    esch_iterator iter;
+    const size_t count = 1000000;
+    const int rounds = 5;
+    char title[64];
+    clock_t cons_time = 0;
+    clock_t walk_time = 0;
+    clock_t free_time = 0;
+    clock_t start = 0;
+    long sum = 0;
+    size_t i = 0;
+    int r = 0;
+
+    for (r = 0; r < rounds; ++r) {
+        start = clock();
+        ret = esch_pair_new_empty(config, &list);
+        ESCH_BENCH_CHECK(ret == ESCH_OK, "Can't create empty", ret);
+        head.type = ESCH_VALUE_TYPE_INTEGER;
+        tail.type = ESCH_VALUE_TYPE_OBJECT;
+        for (i = 0; i < count; ++i) {
+            head.val.i = (int)i;
+            tail.val.o = ESCH_CAST_TO_OBJECT(list);
+            ret = esch_pair_new(config, &head, &tail, &list);
+            ESCH_BENCH_CHECK(ret == ESCH_OK, "Can't cons", ret);
+        }
+        cons_time += clock() - start;
+
+        start = clock();
+        ret = esch_object_get_iterator(ESCH_CAST_TO_OBJECT(list), &iter);
+        ESCH_BENCH_CHECK(ret == ESCH_OK, "Can't get iterator", ret);
+        while (ESCH_TRUE) {
+            (void)iter.get_value(&iter, &head);
+            if (head.type == ESCH_VALUE_TYPE_END) {
+                break;
+            }
+            sum += head.val.i;
+            (void)iter.get_next(&iter);
+        }
+        walk_time += clock() - start;
+
+        start = clock();
+        while (list != NULL) {
+            (void)esch_pair_get_tail(list, &tail);
+            next = (tail.type == ESCH_VALUE_TYPE_OBJECT?
+                    ESCH_CAST_FROM_OBJECT(tail.val.o, esch_pair): NULL);
+            esch_object_delete(ESCH_CAST_TO_OBJECT(list));
+            list = next;
+        }
+        free_time += clock() - start;
+    }
+    ESCH_BENCH_CHECK(sum == (long)rounds * (long)(count * (count - 1) / 2),
+                     "Bad sum", ESCH_ERROR_INVALID_STATE);
+    sprintf(title, "pair:cons:%s", name);
+    esch_bench_report(title, count * rounds, 0, cons_time);
+    sprintf(title, "pair:walk:%s", name);
+    esch_bench_report(title, count * rounds, 0, walk_time);
+    sprintf(title, "pair:free:%s", name);
+    esch_bench_report(title, count * rounds, 0, free_time);
+Exit:
+    return ret;
+}
+
+esch_error bench_pairCons(esch_config* config)
+{
+    esch_error ret = ESCH_OK;
+    esch_alloc* pool = NULL;
+
+    ret = bench_pairRun(config, "malloc");
+    ESCH_BENCH_CHECK(ret == ESCH_OK, "Can't run with malloc", ret);
+    ret = esch_alloc_new_pair_pool(config, &pool);
+    ESCH_BENCH_CHECK(ret == ESCH_OK, "Can't create pool", ret);
+    esch_config_set_obj(config, ESCH_CONFIG_KEY_PAIR_ALLOC,
+                        ESCH_CAST_TO_OBJECT(pool));
+    ret = bench_pairRun(config, "pool");
+    ESCH_BENCH_CHECK(ret == ESCH_OK, "Can't run with pool", ret);
+Exit:
+    esch_config_set_obj(config, ESCH_CONFIG_KEY_PAIR_ALLOC, NULL);
+    if (pool != NULL) {
+        esch_object_delete(ESCH_CAST_TO_OBJECT(pool));
+    }
+    return ret;
+}
+
+/*
+ * Walk a list built by cons, and a list built at once, whose pairs are
+ * adjacent in pool, with iterator.
+ */
+static esch_error
+bench_pairWalk(esch_pair* list, const char* name, size_t count,
+               clock_t build_time)
+{
+    esch_error ret = ESCH_OK;
+    esch_value value;
+    esch_iterator iter;
+    const int rounds = 20;
+    char title[64];
+    clock_t start = 0;
+    long sum = 0;
+    int r = 0;
+
+    start = clock();
+    for (r = 0; r < rounds; ++r) {
+        ret = esch_object_get_iterator(ESCH_CAST_TO_OBJECT(list), &iter);
+        ESCH_BENCH_CHECK(ret == ESCH_OK, "Can't get iterator", ret);
+        while (ESCH_TRUE) {
+            (void)iter.get_value(&iter, &value);
+            if (value.type == ESCH_VALUE_TYPE_END) {
+                break;
+            }
+            sum += value.val.i;
+            (void)iter.get_next(&iter);
+        }
+    }
+    ESCH_BENCH_CHECK(sum == (long)rounds * (long)(count * (count - 1) / 2),
+                     "Bad sum", ESCH_ERROR_INVALID_STATE);
+    sprintf(title, "pair:build:%s", name);
+    esch_bench_report(title, count, 0, build_time);
+    sprintf(title, "pair:walk:%s", name);
+    esch_bench_report(title, count * rounds, start, clock());
+Exit:
+    return ret;
+}
+
+/* First length walks whole list, next ones read the hint. */
+static esch_error
+bench_pairLength(esch_pair* list, size_t count)
+{
+    esch_error ret = ESCH_OK;
+    const size_t rounds = 1000000;
+    size_t length = 0;
+    clock_t start = 0;
+    size_t i = 0;
+
+    start = clock();
+    ret = esch_pair_list_length(list, &length);
+    ESCH_BENCH_CHECK(ret == ESCH_OK && length == count,
+                     "Bad length", ESCH_ERROR_INVALID_STATE);
+    esch_bench_report("pair:length:walk", count, start, clock());
+    start = clock();
+    for (i = 0; i < rounds; ++i) {
+        ret = esch_pair_list_length(list, &length);
+        ESCH_BENCH_CHECK(ret == ESCH_OK && length == count,
+                         "Bad length", ESCH_ERROR_INVALID_STATE);
+    }
+    esch_bench_report("pair:length:hint", rounds, start, clock());
+Exit:
+    return ret;
+}
+
+static void
+bench_pairDelete(esch_pair* list)
+{
+    esch_pair* next = NULL;
+    while (list != NULL) {
+        next = (ESCH_PAIR_NEXT_IS_PAIR(list)?
+                ESCH_CAST_FROM_OBJECT(list->data[1].o, esch_pair): NULL);
+        esch_object_delete(ESCH_CAST_TO_OBJECT(list));
+        list = next;
+    }
+}
+
+esch_error bench_pairList(esch_config* config)
+{
+    esch_error ret = ESCH_OK;
+    esch_alloc* pool = NULL;
+    esch_pair* list = NULL;
+    esch_value* values = NULL;
+    esch_value tail;
+    const size_t count = 1000000;
+    clock_t start = 0;
+    size_t i = 0;
+
+    values = (esch_value*)malloc(sizeof(esch_value) * count);
+    ESCH_BENCH_CHECK(values != NULL, "Can't allocate values",
+                     ESCH_ERROR_OUT_OF_MEMORY);
+    for (i = 0; i < count; ++i) {
+        values[i].type = ESCH_VALUE_TYPE_INTEGER;
+        values[i].val.i = (int)i;
+    }
+    ret = esch_alloc_new_pair_pool(config, &pool);
+    ESCH_BENCH_CHECK(ret == ESCH_OK, "Can't create pool", ret);
+    esch_config_set_obj(config, ESCH_CONFIG_KEY_PAIR_ALLOC,
+                        ESCH_CAST_TO_OBJECT(pool));
+
+    start = clock();
+    ret = esch_pair_new_empty(config, &list);
+    ESCH_BENCH_CHECK(ret == ESCH_OK, "Can't create empty", ret);
+    tail.type = ESCH_VALUE_TYPE_OBJECT;
+    for (i = count; i > 0; --i) {
+        tail.val.o = ESCH_CAST_TO_OBJECT(list);
+        ret = esch_pair_new(config, &values[i - 1], &tail, &list);
+        ESCH_BENCH_CHECK(ret == ESCH_OK, "Can't cons", ret);
+    }
+    ret = bench_pairWalk(list, "cons", count, clock() - start);
+    ESCH_BENCH_CHECK(ret == ESCH_OK, "Can't walk consed list", ret);
+    ret = bench_pairLength(list, count);
+    ESCH_BENCH_CHECK(ret == ESCH_OK, "Can't get length", ret);
+    bench_pairDelete(list);
+    list = NULL;
+
+    start = clock();
+    ret = esch_pair_list_from_values(config, values, count, &list);
+    ESCH_BENCH_CHECK(ret == ESCH_OK, "Can't create list", ret);
+    ret = bench_pairWalk(list, "adjacent", count, clock() - start);
+    ESCH_BENCH_CHECK(ret == ESCH_OK, "Can't walk adjacent list", ret);
+Exit:
+    bench_pairDelete(list);
+    esch_config_set_obj(config, ESCH_CONFIG_KEY_PAIR_ALLOC, NULL);
+    if (pool != NULL) {
+        esch_object_delete(ESCH_CAST_TO_OBJECT(pool));
+    }
+    free(values);
+    return ret;
+}
+
+/*
+ * Build a list of count values element by element, as esch_pair_new()
+ * plus esch_pair_set_tail() on last pair, and at once. Then convert it
+ * from and to a vector.
+ */
+static esch_error
+bench_pairBulkRun(esch_config* config, const char* name,
+                  esch_value* values, esch_vector* vec, size_t count)
+{
+    esch_error ret = ESCH_OK;
+    esch_pair* list = NULL;
+    esch_pair* last = NULL;
+    esch_pair* pair = NULL;
+    esch_pair* empty = NULL;
+    esch_vector* back = NULL;
+    esch_value link;
+    const int rounds = 5;
+    char title[64];
+    clock_t loop_time = 0;
+    clock_t bulk_time = 0;
+    clock_t from_vec_time = 0;
+    clock_t to_vec_time = 0;
+    clock_t start = 0;
+    size_t i = 0;
+    int r = 0;
+
+    link.type = ESCH_VALUE_TYPE_OBJECT;
+    for (r = 0; r < rounds; ++r) {
+        start = clock();
+        ret = esch_pair_new_empty(config, &empty);
+        ESCH_BENCH_CHECK(ret == ESCH_OK, "Can't create empty", ret);
+        list = empty;
+        last = NULL;
+        for (i = 0; i < count; ++i) {
+            link.val.o = ESCH_CAST_TO_OBJECT(empty);
+            ret = esch_pair_new(config, &values[i], &link, &pair);
+            ESCH_BENCH_CHECK(ret == ESCH_OK, "Can't create pair", ret);
+            if (last == NULL) {
+                list = pair;
+            } else {
+                link.val.o = ESCH_CAST_TO_OBJECT(pair);
+                ret = esch_pair_set_tail(last, &link);
+                ESCH_BENCH_CHECK(ret == ESCH_OK, "Can't set tail", ret);
+            }
+            last = pair;
+        }
+        loop_time += clock() - start;
+        bench_pairDelete(list);
+        list = NULL;
+
+        start = clock();
+        ret = esch_pair_list_from_values(config, values, count, &list);
+        ESCH_BENCH_CHECK(ret == ESCH_OK, "Can't create list", ret);
+        bulk_time += clock() - start;
+        bench_pairDelete(list);
+        list = NULL;
+
+        start = clock();
+        ret = esch_vector_to_list(config, vec, &list);
+        ESCH_BENCH_CHECK(ret == ESCH_OK, "Can't convert vector", ret);
+        from_vec_time += clock() - start;
+
+        start = clock();
+        ret = esch_list_to_vector(config, list, &back);
+        ESCH_BENCH_CHECK(ret == ESCH_OK && back->length == count,
+                         "Can't convert list", ret);
+        to_vec_time += clock() - start;
+        esch_object_delete(ESCH_CAST_TO_OBJECT(back));
+        back = NULL;
+        bench_pairDelete(list);
+        list = NULL;
+    }
+    sprintf(title, "pair:build:loop:%s", name);
+    esch_bench_report(title, count * rounds, 0, loop_time);
+    sprintf(title, "pair:build:bulk:%s", name);
+    esch_bench_report(title, count * rounds, 0, bulk_time);
+    sprintf(title, "pair:vector->list:%s", name);
+    esch_bench_report(title, count * rounds, 0, from_vec_time);
+    sprintf(title, "pair:list->vector:%s", name);
+    esch_bench_report(title, count * rounds, 0, to_vec_time);
+Exit:
+    bench_pairDelete(list);
+    return ret;
+}
+
+esch_error bench_pairBulk(esch_config* config)
+{
+    esch_error ret = ESCH_OK;
+    esch_alloc* pool = NULL;
+    esch_vector* vec = NULL;
+    esch_value* values = NULL;
+    const size_t count = 1000000;
+    size_t i = 0;
+
+    values = (esch_value*)malloc(sizeof(esch_value) * count);
+    ESCH_BENCH_CHECK(values != NULL, "Can't allocate values",
+                     ESCH_ERROR_OUT_OF_MEMORY);
+    ret = esch_vector_new(config, &vec);
+    ESCH_BENCH_CHECK(ret == ESCH_OK, "Can't create vector", ret);
+    vec->enlarge = ESCH_TRUE;
+    for (i = 0; i < count; ++i) {
+        values[i].type = ESCH_VALUE_TYPE_INTEGER;
+        values[i].val.i = (int)i;
+        ret = esch_vector_append_value(vec, &values[i]);
+        ESCH_BENCH_CHECK(ret == ESCH_OK, "Can't append", ret);
+    }
+
+    ret = bench_pairBulkRun(config, "malloc", values, vec, count);
+    ESCH_BENCH_CHECK(ret == ESCH_OK, "Can't run with malloc", ret);
+    ret = esch_alloc_new_pair_pool(config, &pool);
+    ESCH_BENCH_CHECK(ret == ESCH_OK, "Can't create pool", ret);
+    esch_config_set_obj(config, ESCH_CONFIG_KEY_PAIR_ALLOC,
+                        ESCH_CAST_TO_OBJECT(pool));
+    ret = bench_pairBulkRun(config, "pool", values, vec, count);
+    ESCH_BENCH_CHECK(ret == ESCH_OK, "Can't run with pool", ret);
+Exit:
+    esch_config_set_obj(config, ESCH_CONFIG_KEY_PAIR_ALLOC, NULL);
+    if (pool != NULL) {
+        esch_object_delete(ESCH_CAST_TO_OBJECT(pool));
+    }
+    if (vec != NULL) {
+        esch_object_delete(ESCH_CAST_TO_OBJECT(vec));
+    }
+    free(values);
+    return ret;
+}
@@ -0,0 +1,462 @@
+#include <stdio.h>
+#include <string.h>
+#include "esch.h"
+#include "esch_bench.h"
+#include "esch_debug.h"
+#include "esch_alloc.h"
+#include "esch_config.h"
+#include "esch_string.h"
+
+/* Scheme source code, with a comment in Chinese every few lines. */
+static const char* ascii_heavy[] = {
+    "(define (fact n) (if (= n 0) 1 (* n (fact (- n 1)))))\n",
+    "(define (fib n) (if (< n 2) n (+ (fib (- n 1)) (fib (- n 2)))))\n",
+    "(let loop ((i 0)) (when (< i 10) (display i) (loop (+ i 1))))\n",
+    "; \xe9\x80\x92\xe5\xbd\x92\xe5\x87\xbd\xe6\x95\xb0\n",
+    NULL
+};
+/* Chinese text, with some punctuation and numbers. */
+static const char* cjk_heavy[] = {
+    "\xe4\xbd\xa0\xe5\xa5\xbd\xef\xbc\x8c\xe4\xb8\x96\xe7\x95\x8c\xe3\x80\x82",
+    "\xe8\xbf\x99\xe6\x98\xaf\xe7\xac\xac 42 \xe8\xa1\x8c\xe6\x96\x87\xe5\xad"
+    "\x97\xe3\x80\x82",
+    "\xe6\xb1\x89\xe5\xad\x97\xe5\x92\x8c\xe5\x81\x87\xe5\x90\x8d\xe3\x81\x8b"
+    "\xe3\x81\xaa\xe3\x80\x82\n",
+    NULL
+};
+
+/* Identifiers, most of them ASCII. */
+static const char* identifiers[] = {
+    "define", "lambda", "let*", "vector-ref", "string->symbol",
+    "call-with-current-continuation", "x", "loop", "list-tail",
+    "hash-table-update!/default", "\xe5\x8f\x98\xe9\x87\x8f", "car",
+    NULL
+};
+
+/*
+ * Fill buffer with given lines repeatedly, never splitting a line.
+ * Return number of bytes written, excluding '\0'.
+ */
+static size_t
+bench_stringFill(char* buf, size_t size, const char** lines)
+{
+    size_t used = 0;
+    size_t len = 0;
+    int i = 0;
+    for (;;) {
+        for (i = 0; lines[i] != NULL; ++i) {
+            len = strlen(lines[i]);
+            if (used + len + 1 > size) {
+                buf[used] = '\0';
+                return used;
+            }
+            memcpy(buf + used, lines[i], len);
+            used += len;
+        }
+    }
+}
+
+esch_error bench_stringDecodeUtf8(esch_config* config)
+{
+    esch_error ret = ESCH_OK;
+    esch_alloc* alloc = NULL;
+    esch_string* str = NULL;
+    char* buf = NULL;
+    const size_t size = 256 * 1024;
+    const int rounds = 200;
+    const char** inputs[2] = { ascii_heavy, cjk_heavy };
+    const char* input_names[2] = { "ascii_heavy", "cjk_heavy" };
+    char name[64];
+    clock_t start = 0;
+    size_t len = 0;
+    int input = 0;
+    int i = 0;
+
+    alloc = ESCH_CAST_FROM_OBJECT(ESCH_CONFIG_GET_ALLOC(config), esch_alloc);
+    ret = esch_alloc_realloc(alloc, NULL, size, (void**)&buf);
+    ESCH_BENCH_CHECK(ret == ESCH_OK, "Can't create buffer", ret);
+
+    for (input = 0; input < 2; ++input) {
+        len = bench_stringFill(buf, size, inputs[input]);
+        start = clock();
+        for (i = 0; i < rounds; ++i) {
+            ret = esch_string_new_from_utf8(config, buf, 0, -1, &str);
+            ESCH_BENCH_CHECK(ret == ESCH_OK, "Can't create string", ret);
+            /* Unicode buffer is lazy. Ask for it to measure decoding. */
+            ret = (esch_string_get_unicode_ref(str) != NULL?
+                   ESCH_OK: ESCH_ERROR_OUT_OF_MEMORY);
+            ESCH_BENCH_CHECK(ret == ESCH_OK, "Can't decode string", ret);
+            ret = esch_object_delete(ESCH_CAST_TO_OBJECT(str));
+            str = NULL;
+        }
+        sprintf(name, "string:decode_utf8:%s", input_names[input]);
+        esch_bench_report_bytes(name, (size_t)rounds, len * rounds,
+                                start, clock());
+    }
+Exit:
+    esch_alloc_free(alloc, buf);
+    return ret;
+}
+
+/*
+ * Bytes held by a string: object, UTF-8 buffer (or inline bytes) and
+ * Unicode buffer if it's created. Allocator overhead is not included.
+ */
+static size_t
+bench_stringBytes(esch_string* str, esch_bool with_unicode)
+{
+    size_t bytes = sizeof(esch_object) + sizeof(esch_string);
+    if (ESCH_STRING_IS_INLINE(str)) {
+        bytes += ESCH_STRING_INLINE_SIZE;
+    } else {
+        bytes += str->utf8_len + 1;
+    }
+    if (with_unicode || str->unicode != NULL) {
+        bytes += sizeof(esch_unicode) * (str->unicode_len + 1);
+    }
+    return bytes;
+}
+
+esch_error bench_stringMemory(esch_config* config)
+{
+    esch_error ret = ESCH_OK;
+    esch_alloc* alloc = NULL;
+    esch_string** strs = NULL;
+    const size_t count = 100000;
+    const char** corpus[3] = { identifiers, ascii_heavy, cjk_heavy };
+    const char* corpus_names[3] = { "identifiers", "ascii_text", "cjk_text" };
+    size_t corpus_size = 0;
+    size_t created = 0;
+    size_t lazy_bytes = 0;
+    size_t eager_bytes = 0;
+    size_t allocs = 0;
+    char name[64];
+    clock_t start = 0;
+    size_t i = 0;
+    int c = 0;
+
+    alloc = ESCH_CAST_FROM_OBJECT(ESCH_CONFIG_GET_ALLOC(config), esch_alloc);
+    ret = esch_alloc_realloc(alloc, NULL, sizeof(esch_string*) * count,
+                             (void**)&strs);
+    ESCH_BENCH_CHECK(ret == ESCH_OK, "Can't create array", ret);
+
+    for (c = 0; c < 3; ++c) {
+        for (corpus_size = 0; corpus[c][corpus_size] != NULL; ++corpus_size)
+            ;
+        lazy_bytes = 0;
+        eager_bytes = 0;
+        allocs = 0;
+        start = clock();
+        for (created = 0; created < count; ++created) {
+            ret = esch_string_new_from_utf8(config,
+                                    corpus[c][created % corpus_size],
+                                    0, -1, &(strs[created]));
+            ESCH_BENCH_CHECK(ret == ESCH_OK, "Can't create string", ret);
+        }
+        sprintf(name, "string:new:%s", corpus_names[c]);
+        esch_bench_report(name, count, start, clock());
+        for (i = 0; i < created; ++i) {
+            lazy_bytes += bench_stringBytes(strs[i], ESCH_FALSE);
+            eager_bytes += bench_stringBytes(strs[i], ESCH_TRUE);
+            allocs += (ESCH_STRING_IS_INLINE(strs[i])? 1: 2);
+        }
+        printf("string:memory:%-34s %10lu bytes (lazy) %10lu bytes (eager)\n",
+               corpus_names[c], (unsigned long)lazy_bytes,
+               (unsigned long)eager_bytes);
+        printf("string:allocs:%-34s %10lu allocations\n",
+               corpus_names[c], (unsigned long)allocs);
+        for (i = 0; i < created; ++i) {
+            (void)esch_object_delete(ESCH_CAST_TO_OBJECT(strs[i]));
+        }
+        created = 0;
+    }
+Exit:
+    for (i = 0; i < created; ++i) {
+        (void)esch_object_delete(ESCH_CAST_TO_OBJECT(strs[i]));
+    }
+    esch_alloc_free(alloc, strs);
+    return ret;
+}
+
+/*
+ * Build a long string from short tokens: copy all bytes for each new
+ * token, or concatenate as rope string and flatten it at last.
+ */
+esch_error bench_stringConcat(esch_config* config)
+{
+    esch_error ret = ESCH_OK;
+    esch_alloc* alloc = NULL;
+    esch_string** pieces = NULL;
+    esch_string* acc = NULL;
+    esch_string* next = NULL;
+    esch_unicode ch = 0;
+    char* buf = NULL;
+    const size_t count = 10000;
+    const size_t lookups = 1000000;
+    size_t corpus_size = 0;
+    size_t created = 0;
+    size_t used = 0;
+    size_t len = 0;
+    clock_t start = 0;
+    size_t i = 0;
+
+    alloc = ESCH_CAST_FROM_OBJECT(ESCH_CONFIG_GET_ALLOC(config), esch_alloc);
+    ret = esch_alloc_realloc(alloc, NULL, sizeof(esch_string*) * count,
+                             (void**)&pieces);
+    ESCH_BENCH_CHECK(ret == ESCH_OK, "Can't create array", ret);
+    ret = esch_alloc_realloc(alloc, NULL, count * 64, (void**)&buf);
+    ESCH_BENCH_CHECK(ret == ESCH_OK, "Can't create buffer", ret);
+    for (corpus_size = 0; identifiers[corpus_size] != NULL; ++corpus_size)
+        ;
+    for (created = 0; created < count; ++created) {
+        ret = esch_string_new_from_utf8(config,
+                                identifiers[created % corpus_size], 0, -1,
+                                &(pieces[created]));
+        ESCH_BENCH_CHECK(ret == ESCH_OK, "Can't create piece", ret);
+    }
+
+    /* Allocate and copy everything: O(n^2) */
+    start = clock();
+    for (i = 0; i < count; ++i) {
+        len = esch_string_get_utf8_length(pieces[i]);
+        memcpy(buf + used, esch_string_get_utf8_ref(pieces[i]), len);
+        used += len;
+        ret = esch_string_new_from_utf8(config, buf, 0, (int)used, &next);
+        ESCH_BENCH_CHECK(ret == ESCH_OK, "Can't create string", ret);
+        if (acc != NULL) {
+            (void)esch_object_delete(ESCH_CAST_TO_OBJECT(acc));
+        }
+        acc = next;
+        next = NULL;
+    }
+    esch_bench_report("string:concat:copy", count, start, clock());
+    (void)esch_object_delete(ESCH_CAST_TO_OBJECT(acc));
+    acc = NULL;
+
+    /* Rope string: O(log n) each, plus one copy to flatten. */
+    start = clock();
+    ret = esch_string_new_from_utf8(config, "", 0, -1, &acc);
+    ESCH_BENCH_CHECK(ret == ESCH_OK, "Can't create string", ret);
+    for (i = 0; i < count; ++i) {
+        ret = esch_string_concat(config, acc, pieces[i], &next);
+        ESCH_BENCH_CHECK(ret == ESCH_OK, "Can't concat string", ret);
+        (void)esch_object_delete(ESCH_CAST_TO_OBJECT(acc));
+        acc = next;
+        next = NULL;
+    }
+    esch_bench_report("string:concat:rope", count, start, clock());
+
+    len = esch_string_get_unicode_length(acc);
+    start = clock();
+    for (i = 0; i < lookups; ++i) {
+        ret = esch_string_get_unicode_at(acc, (i * 7919) % len, &ch);
+        ESCH_BENCH_CHECK(ret == ESCH_OK, "Can't get character", ret);
+    }
+    esch_bench_report("string:rope_index", lookups, start, clock());
+
+    start = clock();
+    ret = (esch_string_get_utf8_ref(acc) != NULL?
+           ESCH_OK: ESCH_ERROR_OUT_OF_MEMORY);
+    ESCH_BENCH_CHECK(ret == ESCH_OK, "Can't flatten string", ret);
+    esch_bench_report("string:rope_flatten", 1, start, clock());
+    ret = (strncmp(esch_string_get_utf8_ref(acc), buf, used) == 0?
+           ESCH_OK: ESCH_ERROR_INVALID_STATE);
+    ESCH_BENCH_CHECK(ret == ESCH_OK, "Bad rope string", ret);
+Exit:
+    if (acc != NULL) {
+        (void)esch_object_delete(ESCH_CAST_TO_OBJECT(acc));
+    }
+    for (i = 0; i < created; ++i) {
+        (void)esch_object_delete(ESCH_CAST_TO_OBJECT(pieces[i]));
+    }
+    esch_alloc_free(alloc, pieces);
+    esch_alloc_free(alloc, buf);
+    return ret;
+}
+
+esch_error bench_stringSubstring(esch_config* config)
+{
+    esch_error ret = ESCH_OK;
+    esch_alloc* alloc = NULL;
+    esch_string* text = NULL;
+    esch_string* sub = NULL;
+    char* buf = NULL;
+    char name[64];
+    const size_t chars = 100000;
+    const size_t width = 1000;
+    const size_t count = 10000;
+    size_t begin = 0;
+    size_t offset = 0;
+    size_t stop = 0;
+    size_t k = 0;
+    clock_t start = 0;
+    size_t i = 0;
+    int cjk = 0;
+
+    alloc = ESCH_CAST_FROM_OBJECT(ESCH_CONFIG_GET_ALLOC(config), esch_alloc);
+    ret = esch_alloc_realloc(alloc, NULL, chars * 3 + 1, (void**)&buf);
+    ESCH_BENCH_CHECK(ret == ESCH_OK, "Can't create buffer", ret);
+    for (cjk = 0; cjk < 2; ++cjk) {
+        for (i = 0; i < chars; ++i) {
+            if (cjk) {
+                /* U+4E00 + (i % 256): 3 bytes each */
+                buf[i * 3] = (char)0xE4;
+                buf[i * 3 + 1] = (char)(0xB8 + (i % 256) / 64);
+                buf[i * 3 + 2] = (char)(0x80 + (i % 64));
+            } else {
+                buf[i] = (char)('a' + i % 26);
+            }
+        }
+        buf[cjk? chars * 3: chars] = '\0';
+        ret = esch_string_new_from_utf8(config, buf, 0, -1, &text);
+        ESCH_BENCH_CHECK(ret == ESCH_OK, "Can't create text", ret);
+
+        /* Find offsets by scanning, then copy bytes. */
+        start = clock();
+        for (i = 0; i < count; ++i) {
+            begin = (i * 7919) % (chars - width);
+            for (offset = 0, k = 0; k < begin; ++offset) {
+                k += ((buf[offset + 1] & 0xC0) != 0x80);
+            }
+            for (stop = offset, k = 0; k < width; ++stop) {
+                k += ((buf[stop + 1] & 0xC0) != 0x80);
+            }
+            ret = esch_string_new_from_utf8(config, buf, (int)offset,
+                                            (int)stop, &sub);
+            ESCH_BENCH_CHECK(ret == ESCH_OK, "Can't copy substring", ret);
+            (void)esch_object_delete(ESCH_CAST_TO_OBJECT(sub));
+            sub = NULL;
+        }
+        sprintf(name, "string:substring:copy:%s", cjk? "cjk": "ascii");
+        esch_bench_report(name, count, start, clock());
+
+        start = clock();
+        for (i = 0; i < count; ++i) {
+            begin = (i * 7919) % (chars - width);
+            ret = esch_string_substring(config, text, begin, begin + width,
+                                        &sub);
+            ESCH_BENCH_CHECK(ret == ESCH_OK, "Can't create view", ret);
+            (void)esch_object_delete(ESCH_CAST_TO_OBJECT(sub));
+            sub = NULL;
+        }
+        sprintf(name, "string:substring:view:%s", cjk? "cjk": "ascii");
+        esch_bench_report(name, count, start, clock());
+        (void)esch_object_delete(ESCH_CAST_TO_OBJECT(text));
+        text = NULL;
+    }
+Exit:
+    if (sub != NULL) {
+        (void)esch_object_delete(ESCH_CAST_TO_OBJECT(sub));
+    }
+    if (text != NULL) {
+        (void)esch_object_delete(ESCH_CAST_TO_OBJECT(text));
+    }
+    esch_alloc_free(alloc, buf);
+    return ret;
+}
+
+/* Long ASCII identifiers, as in Scheme libraries. */
+static const char* ascii_identifiers[] = {
+    "call-with-current-continuation", "hash-table-update!/default",
+    "string->symbol", "with-exception-handler", "exact-integer-sqrt",
+    "char-ci=?", "list-tail", "dynamic-wind", "vector-ref",
+    "call-with-output-string", "make-parameter", "x",
+    NULL
+};
+/*
+ * Identifiers in Japanese kana and CJK compatibility ideographs. Data
+ * in tools/unicode lists only first and last of unified ideographs, so
+ * they are not identifier characters yet.
+ */
+static const char* cjk_identifiers[] = {
+    "\xe3\x81\xb8\xe3\x82\x93\xe3\x81\x99\xe3\x81\x86", /* へんすう */
+    "\xe3\x82\xab\xe3\x82\xbf\xe3\x82\xab\xe3\x83\x8a", /* カタカナ */
+    "\xef\xa7\x9c-\xef\xa4\x9d", /* U+F9DC - U+F91D */
+    "\xef\xa8\x90\xef\xa5\xab", /* U+FA10 U+F96B */
+    "\xe3\x81\xb2\xe3\x82\x89\xe3\x81\x8c\xe3\x81\xaa-\xe3\x83\xaa"
+    "\xe3\x82\xb9\xe3\x83\x88", /* ひらがな-リスト */
+    NULL
+};
+/* Identifiers in Latin, Greek, Cyrillic and kana, mixed with ASCII. */
+static const char* mixed_identifiers[] = {
+    "gr\xc3\xb6\xc3\x9f" "e", /* größe */
+    "\xce\xbb-expr", /* λ-expr */
+    "\xd0\xbf\xd0\xb5\xd1\x80\xd0\xb5\xd0\xbc\xd0\xb5\xd0\xbd\xd0\xbd"
+    "\xd0\xb0\xd1\x8f", /* переменная */
+    "vector-\xe3\x82\xab\xe3\x82\xba", /* vector-カズ */
+    "x\xc2\xb2+y\xc2\xb2", /* x²+y² */
+    "caf\xc3\xa9-\xce\xb1\xce\xb2\xce\xb3", /* café-αβγ */
+    NULL
+};
+
+esch_error bench_stringIdentifier(esch_config* config)
+{
+    esch_error ret = ESCH_OK;
+    esch_string* strs[16];
+    const char** corpus[3] = {
+        ascii_identifiers, cjk_identifiers, mixed_identifiers
+    };
+    const char* corpus_names[3] = { "ascii", "cjk", "mixed" };
+    const esch_unicode* unicode = NULL;
+    char name[64];
+    const size_t rounds = 2000000;
+    size_t created = 0;
+    size_t chars = 0;
+    size_t valid = 0;
+    size_t expected = 0;
+    clock_t start = 0;
+    size_t i = 0;
+    size_t r = 0;
+    int c = 0;
+
+    for (c = 0; c < 3; ++c) {
+        chars = 0;
+        for (created = 0; corpus[c][created] != NULL; ++created) {
+            ret = esch_string_new_from_utf8(config, corpus[c][created],
+                                            0, -1, &(strs[created]));
+            ESCH_BENCH_CHECK(ret == ESCH_OK, "Can't create string", ret);
+            chars += esch_string_get_unicode_length(strs[created]);
+            unicode = esch_string_get_unicode_ref(strs[created]);
+            ret = (unicode != NULL? ESCH_OK: ESCH_ERROR_OUT_OF_MEMORY);
+            ESCH_BENCH_CHECK(ret == ESCH_OK, "Can't decode string", ret);
+        }
+        expected = 0;
+        for (i = 0; i < created; ++i) {
+            expected += esch_unicode_string_is_valid_identifier(
+                            strs[i]->unicode);
+        }
+        valid = 0;
+        start = clock();
+        for (r = 0; r < rounds; ++r) {
+            for (i = 0; i < created; ++i) {
+                valid += esch_unicode_string_is_valid_identifier(
+                            strs[i]->unicode);
+            }
+        }
+        sprintf(name, "string:is_identifier:%s", corpus_names[c]);
+        esch_bench_report(name, rounds * chars, start, clock());
+        ret = (valid == rounds * expected? ESCH_OK: ESCH_ERROR_INVALID_STATE);
+        ESCH_BENCH_CHECK(ret == ESCH_OK, "Bad identifier check", ret);
+
+        valid = 0;
+        start = clock();
+        for (r = 0; r < rounds; ++r) {
+            for (i = 0; i < created; ++i) {
+                valid += esch_string_is_valid_identifier(strs[i]);
+            }
+        }
+        sprintf(name, "string:is_identifier_str:%s", corpus_names[c]);
+        esch_bench_report(name, rounds * chars, start, clock());
+        ret = (valid == rounds * expected? ESCH_OK: ESCH_ERROR_INVALID_STATE);
+        ESCH_BENCH_CHECK(ret == ESCH_OK, "Bad identifier check", ret);
+        for (i = 0; i < created; ++i) {
+            (void)esch_object_delete(ESCH_CAST_TO_OBJECT(strs[i]));
+        }
+        created = 0;
+    }
+Exit:
+    for (i = 0; i < created; ++i) {
+        (void)esch_object_delete(ESCH_CAST_TO_OBJECT(strs[i]));
+    }
+    return ret;
+}
@@ -0,0 +1,103 @@
+#include <stdio.h>
+#include <string.h>
+#include "esch.h"
+#include "esch_bench.h"
+#include "esch_debug.h"
+#include "esch_alloc.h"
+#include "esch_config.h"
+
+static const char* prefixes[] = {
+    "make-", "vector-", "string-", "list-", "hash-table-", "char-",
+    "call-with-", "%internal-", "\xe5\x8f\x98\xe9\x87\x8f-", "x",
+};
+
+/*
+ * Build a corpus of identifiers into one buffer, separated by '\0'.
+ * Names repeat like in source code: most occurrences come from a small
+ * set of popular names.
+ */
+static esch_error
+bench_symbolCorpus(esch_alloc* alloc, size_t count, size_t distinct,
+                   char** corpus, size_t** offsets)
+{
+    esch_error ret = ESCH_OK;
+    char* buf = NULL;
+    size_t* offs = NULL;
+    size_t used = 0;
+    size_t id = 0;
+    size_t i = 0;
+    unsigned int seed = 12345;
+
+    ret = esch_alloc_realloc(alloc, NULL, count * 32, (void**)&buf);
+    ESCH_BENCH_CHECK(ret == ESCH_OK, "Can't create corpus", ret);
+    ret = esch_alloc_realloc(alloc, NULL, sizeof(size_t) * count,
+                             (void**)&offs);
+    ESCH_BENCH_CHECK(ret == ESCH_OK, "Can't create offsets", ret);
+    for (i = 0; i < count; ++i) {
+        seed = seed * 1103515245 + 12345;
+        /* Half of references go to 1/64 of names. */
+        id = (seed >> 8) % distinct;
+        if (i % 2 == 0) {
+            id = id / 64;
+        }
+        offs[i] = used;
+        used += sprintf(buf + used, "%s%lu",
+                        prefixes[id % (sizeof(prefixes) / sizeof(char*))],
+                        (unsigned long)id) + 1;
+    }
+    (*corpus) = buf;
+    (*offsets) = offs;
+    buf = NULL;
+    offs = NULL;
+Exit:
+    esch_alloc_free(alloc, buf);
+    esch_alloc_free(alloc, offs);
+    return ret;
+}
+
+esch_error bench_symbolIntern(esch_config* config)
+{
+    esch_error ret = ESCH_OK;
+    esch_alloc* alloc = NULL;
+    esch_symbol_table* table = NULL;
+    esch_symbol* sym = NULL;
+    char* corpus = NULL;
+    size_t* offsets = NULL;
+    const size_t count = 1000000;
+    const size_t distinct = 200000;
+    size_t symbols = 0;
+    clock_t start = 0;
+    size_t i = 0;
+
+    alloc = ESCH_CAST_FROM_OBJECT(ESCH_CONFIG_GET_ALLOC(config), esch_alloc);
+    ret = bench_symbolCorpus(alloc, count, distinct, &corpus, &offsets);
+    ESCH_BENCH_CHECK(ret == ESCH_OK, "Can't build corpus", ret);
+
+    ret = esch_symbol_table_new(config, &table);
+    ESCH_BENCH_CHECK(ret == ESCH_OK, "Can't create table", ret);
+    start = clock();
+    for (i = 0; i < count; ++i) {
+        ret = esch_symbol_table_intern(table, corpus + offsets[i],
+                                       0, -1, &sym);
+        ESCH_BENCH_CHECK(ret == ESCH_OK, "Can't intern", ret);
+    }
+    esch_bench_report("symbol:intern", count, start, clock());
+    ret = esch_symbol_table_get_count(table, &symbols);
+    esch_log_info(g_benchLog, "%d distinct symbols", (int)symbols);
+
+    /* All names exist now, so it's the latency of a hit. */
+    start = clock();
+    for (i = 0; i < count; ++i) {
+        ret = esch_symbol_table_lookup(table, corpus + offsets[i],
+                                       0, -1, &sym);
+        ESCH_BENCH_CHECK(ret == ESCH_OK, "Can't find symbol", ret);
+    }
+    esch_bench_report("symbol:lookup_hit", count, start, clock());
+Exit:
+    if (table != NULL) {
+        esch_object_delete(ESCH_CAST_TO_OBJECT(table));
+    }
+    esch_alloc_free(alloc, corpus);
+    esch_alloc_free(alloc, offsets);
+    return ret;
+}
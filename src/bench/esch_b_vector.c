@@ -0,0 +1,157 @@
+#include <stdio.h>
+#include "esch.h"
+#include "esch_bench.h"
+#include "esch_debug.h"
+#include "esch_vector.h"
+#include "esch_gc.h"
+
+static const char* layout_names[2] = { "mixed", "split" };
+
+/*
+ * Fill a vector with mixed values: one object in every 8 elements, and
+ * integers/floats for the rest. It's common for a scope or a list.
+ */
+static esch_error
+bench_vectorFill(esch_config* config, esch_vector* vec, size_t count,
+                 esch_bool new_objects)
+{
+    esch_error ret = ESCH_OK;
+    esch_string* str = NULL;
+    size_t i = 0;
+    for (i = 0; i < count && ret == ESCH_OK; ++i) {
+        if (i % 8 == 0) {
+            if (new_objects) {
+                ret = esch_string_new_from_utf8(config, "obj", 0, -1, &str);
+                ESCH_BENCH_CHECK(ret == ESCH_OK, "Can't create string", ret);
+                ret = esch_vector_append_object(vec,
+                                                ESCH_CAST_TO_OBJECT(str));
+            } else {
+                ret = esch_vector_append_object(vec,
+                                                ESCH_CAST_TO_OBJECT(vec));
+            }
+        } else if (i % 2 == 1) {
+            ret = esch_vector_append_integer(vec, (int)i);
+        } else {
+            ret = esch_vector_append_float(vec, (double)i);
+        }
+    }
+    ESCH_BENCH_CHECK(ret == ESCH_OK, "Can't append value", ret);
+Exit:
+    return ret;
+}
+
+esch_error bench_vectorGcMark(esch_config* config)
+{
+    esch_error ret = ESCH_OK;
+    esch_vector* root = NULL;
+    esch_gc* gc = NULL;
+    const size_t count = 400000;
+    const int rounds = 20;
+    char name[64];
+    clock_t start = 0;
+    int layout = 0;
+    int i = 0;
+
+    esch_config_set_int(config, ESCH_CONFIG_KEY_VECTOR_ENLARGE, 1);
+    esch_config_set_int(config, ESCH_CONFIG_KEY_GC_NAIVE_SLOTS,
+                        (int)(count / 8 + 64));
+    esch_config_set_int(config, ESCH_CONFIG_KEY_GC_NAIVE_ENLARGE, 1);
+    for (layout = 0; layout < 2; ++layout) {
+        esch_config_set_int(config, ESCH_CONFIG_KEY_VECTOR_LAYOUT, layout);
+        ret = esch_vector_new(config, &root);
+        ESCH_BENCH_CHECK(ret == ESCH_OK, "Can't create root", ret);
+        esch_config_set_obj(config, ESCH_CONFIG_KEY_GC_NAIVE_ROOT,
+                            ESCH_CAST_TO_OBJECT(root));
+        ret = esch_gc_new_naive_mark_sweep(config, &gc);
+        ESCH_BENCH_CHECK(ret == ESCH_OK, "Can't create gc", ret);
+        esch_config_set_obj(config, ESCH_CONFIG_KEY_GC,
+                            ESCH_CAST_TO_OBJECT(gc));
+
+        ret = bench_vectorFill(config, root, count, ESCH_TRUE);
+        ESCH_BENCH_CHECK(ret == ESCH_OK, "Can't fill root", ret);
+
+        start = clock();
+        for (i = 0; i < rounds; ++i) {
+            ret = esch_gc_recycle(gc);
+            ESCH_BENCH_CHECK(ret == ESCH_OK, "Can't recycle", ret);
+        }
+        sprintf(name, "vector:gc_mark:%s", layout_names[layout]);
+        esch_bench_report(name, count * rounds, start, clock());
+
+        esch_config_set_obj(config, ESCH_CONFIG_KEY_GC, NULL);
+        esch_config_set_obj(config, ESCH_CONFIG_KEY_GC_NAIVE_ROOT, NULL);
+        ret = esch_object_delete(ESCH_CAST_TO_OBJECT(gc));
+        gc = NULL;
+        root = NULL;
+    }
+Exit:
+    if (gc != NULL) {
+        esch_object_delete(ESCH_CAST_TO_OBJECT(gc));
+    }
+    esch_config_set_obj(config, ESCH_CONFIG_KEY_GC, NULL);
+    esch_config_set_obj(config, ESCH_CONFIG_KEY_GC_NAIVE_ROOT, NULL);
+    esch_config_set_int(config, ESCH_CONFIG_KEY_VECTOR_LAYOUT,
+                        ESCH_VECTOR_LAYOUT_MIXED);
+    esch_config_set_int(config, ESCH_CONFIG_KEY_GC_NAIVE_SLOTS, -1);
+    esch_config_set_int(config, ESCH_CONFIG_KEY_GC_NAIVE_ENLARGE, 0);
+    return ret;
+}
+
+esch_error bench_vectorNumericScan(esch_config* config)
+{
+    esch_error ret = ESCH_OK;
+    esch_vector* vec = NULL;
+    const size_t count = 1000000;
+    const int rounds = 20;
+    char name[64];
+    clock_t start = 0;
+    double sum = 0.0;
+    size_t i = 0;
+    int layout = 0;
+    int r = 0;
+
+    esch_config_set_int(config, ESCH_CONFIG_KEY_VECTOR_ENLARGE, 1);
+    for (layout = 0; layout < 2; ++layout) {
+        esch_config_set_int(config, ESCH_CONFIG_KEY_VECTOR_LAYOUT, layout);
+        ret = esch_vector_new(config, &vec);
+        ESCH_BENCH_CHECK(ret == ESCH_OK, "Can't create vector", ret);
+        ret = bench_vectorFill(config, vec, count, ESCH_FALSE);
+        ESCH_BENCH_CHECK(ret == ESCH_OK, "Can't fill vector", ret);
+
+        /* Sum all numbers, like (apply + numbers) would do. */
+        sum = 0.0;
+        start = clock();
+        for (r = 0; r < rounds; ++r) {
+            if (vec->layout == ESCH_VECTOR_LAYOUT_MIXED) {
+                for (i = 0; i < vec->length; ++i) {
+                    if (vec->begin[i].type == ESCH_VALUE_TYPE_INTEGER) {
+                        sum += vec->begin[i].val.i;
+                    } else if (vec->begin[i].type == ESCH_VALUE_TYPE_FLOAT) {
+                        sum += vec->begin[i].val.f;
+                    }
+                }
+            } else {
+                for (i = 0; i < vec->length; ++i) {
+                    if (vec->tags[i] == ESCH_VALUE_TYPE_INTEGER) {
+                        sum += vec->data[i].i;
+                    } else if (vec->tags[i] == ESCH_VALUE_TYPE_FLOAT) {
+                        sum += vec->data[i].f;
+                    }
+                }
+            }
+        }
+        sprintf(name, "vector:numeric_scan:%s", layout_names[layout]);
+        esch_bench_report(name, count * rounds, start, clock());
+        esch_log_info(g_benchLog, "sum = %f", sum);
+
+        ret = esch_object_delete(ESCH_CAST_TO_OBJECT(vec));
+        vec = NULL;
+    }
+Exit:
+    if (vec != NULL) {
+        esch_object_delete(ESCH_CAST_TO_OBJECT(vec));
+    }
+    esch_config_set_int(config, ESCH_CONFIG_KEY_VECTOR_LAYOUT,
+                        ESCH_VECTOR_LAYOUT_MIXED);
+    return ret;
+}
@@ -0,0 +1,117 @@
+#include "esch.h"
+#include "esch_bench.h"
+#include <stdio.h>
+#include <string.h>
+
+esch_log* g_benchLog = NULL;
+
+struct esch_bench_case
+{
+    const char* name;
+    esch_error (*run)(esch_config* config);
+};
+
+static struct esch_bench_case bench_cases[] = {
+    { "bench_vectorGcMark", bench_vectorGcMark },
+    { "bench_vectorNumericScan", bench_vectorNumericScan },
+    { "bench_stringDecodeUtf8", bench_stringDecodeUtf8 },
+    { "bench_stringMemory", bench_stringMemory },
+    { "bench_stringConcat", bench_stringConcat },
+    { "bench_stringSubstring", bench_stringSubstring },
+    { "bench_stringIdentifier", bench_stringIdentifier },
+    { "bench_symbolIntern", bench_symbolIntern },
+    { "bench_configLookup", bench_configLookup },
+    { "bench_gcRecycle", bench_gcRecycle },
+    { "bench_gcTrace", bench_gcTrace },
+    { "bench_logAsync", bench_logAsync },
+    { "bench_integerMul", bench_integerMul },
+    { "bench_integerFactorial", bench_integerFactorial },
+    { "bench_integerFibonacci", bench_integerFibonacci },
+    { "bench_integerCounter", bench_integerCounter },
+    { "bench_integerBase10", bench_integerBase10 },
+    { "bench_floatBase10", bench_floatBase10 },
+    { "bench_fraction", bench_fraction },
+    { "bench_pairCons", bench_pairCons },
+    { "bench_pairList", bench_pairList },
+    { "bench_pairBulk", bench_pairBulk },
+    { "bench_hashtable", bench_hashtable },
+    { NULL, NULL },
+};
+
+void
+esch_bench_report(const char* name, size_t ops, clock_t start, clock_t end)
+{
+    double ms = (double)(end - start) * 1000.0 / CLOCKS_PER_SEC;
+    double ns = (ops > 0? ms * 1000000.0 / (double)ops: 0.0);
+    printf("%-48s %10.3f ms %10.3f ns/op\n", name, ms, ns);
+}
+
+void
+esch_bench_report_bytes(const char* name, size_t ops, size_t bytes,
+                        clock_t start, clock_t end)
+{
+    double ms = (double)(end - start) * 1000.0 / CLOCKS_PER_SEC;
+    double ns = (ops > 0? ms * 1000000.0 / (double)ops: 0.0);
+    double mbs = (ms > 0.0? (double)bytes / 1048576.0 / (ms / 1000.0): 0.0);
+    printf("%-48s %10.3f ms %10.3f ns/op %10.1f MB/s\n",
+           name, ms, ns, mbs);
+}
+
+/*
+ * Usage: esch_bench [name]
+ * Run all benchmarks, or only benchmarks whose name contains [name].
+ */
+int main(int argc, char* argv[])
+{
+    esch_error ret = ESCH_OK;
+    esch_alloc* alloc = NULL;
+    esch_config* config = NULL;
+    esch_log* benchLog = NULL;
+    esch_log* quietLog = NULL;
+    esch_object* alloc_obj = NULL;
+    esch_object* log_obj = NULL;
+    esch_object* config_obj = NULL;
+    struct esch_bench_case* each = NULL;
+
+    ret = esch_log_new_printf(NULL, &benchLog);
+    if (ret != ESCH_OK)
+    {
+        printf("Failed to create initial log.\n");
+        ret = ESCH_ERROR_INVALID_STATE;
+        goto Exit;
+    }
+    g_benchLog = benchLog;
+
+    ret = esch_alloc_new_c_default(NULL, &alloc);
+    ESCH_BENCH_CHECK(ret == ESCH_OK, "main:Can't create alloc", ret);
+    ret = esch_config_new(benchLog, alloc, &config);
+    ESCH_BENCH_CHECK(ret == ESCH_OK, "main:Can't create config", ret);
+    /* Objects log a lot at info level. Keep them quiet, or we measure
+     * printf() only. */
+    ret = esch_log_new_do_nothing(NULL, &quietLog);
+    ESCH_BENCH_CHECK(ret == ESCH_OK, "main:Can't create quiet log", ret);
+
+    ret = esch_object_cast_to_object(alloc, &alloc_obj);
+    ret = esch_object_cast_to_object(quietLog, &log_obj);
+    ret = esch_object_cast_to_object(config, &config_obj);
+
+    ret = esch_config_set_obj(config, ESCH_CONFIG_KEY_ALLOC, alloc_obj);
+    ret = esch_config_set_obj(config, ESCH_CONFIG_KEY_LOG, log_obj);
+
+    for (each = &(bench_cases[0]); each->name != NULL; ++each)
+    {
+        if (argc > 1 && strstr(each->name, argv[1]) == NULL)
+        {
+            continue;
+        }
+        esch_log_info(benchLog, "Start: %s()", each->name);
+        ret = each->run(config);
+        ESCH_BENCH_CHECK(ret == ESCH_OK, "Benchmark failed", ret);
+    }
+    esch_log_info(benchLog, "All done.");
+Exit:
+    (void)esch_object_delete(config_obj);
+    (void)esch_object_delete(alloc_obj);
+    (void)esch_object_delete(log_obj);
+    return ret;
+}
@@ -0,0 +1,58 @@
+#ifndef _ESCH_BENCH_H_
+#define _ESCH_BENCH_H_
+
+#ifdef __cplusplus
+extern "C" {
+#endif /* __cplusplus */
+
+#include <time.h>
+#include <esch.h>
+#include "esch_debug.h"
+
+extern esch_log* g_benchLog;
+
+#define ESCH_BENCH_CHECK(cond, msg, errorcode) \
+    ESCH_CHECK(cond, g_benchLog, msg, errorcode)
+
+/*
+ * Print one line of result. Time is measured by clock(), so it's CPU
+ * time of current process.
+ */
+extern void esch_bench_report(const char* name, size_t ops,
+                              clock_t start, clock_t end);
+/*
+ * Same as esch_bench_report(), but print throughput as MB/s as well.
+ */
+extern void esch_bench_report_bytes(const char* name, size_t ops,
+                                    size_t bytes,
+                                    clock_t start, clock_t end);
+
+/* benchmarks */
+extern esch_error bench_vectorGcMark(esch_config* config);
+extern esch_error bench_vectorNumericScan(esch_config* config);
+extern esch_error bench_stringDecodeUtf8(esch_config* config);
+extern esch_error bench_stringMemory(esch_config* config);
+extern esch_error bench_stringConcat(esch_config* config);
+extern esch_error bench_stringSubstring(esch_config* config);
+extern esch_error bench_stringIdentifier(esch_config* config);
+extern esch_error bench_symbolIntern(esch_config* config);
+extern esch_error bench_configLookup(esch_config* config);
+extern esch_error bench_gcRecycle(esch_config* config);
+extern esch_error bench_gcTrace(esch_config* config);
+extern esch_error bench_logAsync(esch_config* config);
+extern esch_error bench_integerMul(esch_config* config);
+extern esch_error bench_integerFactorial(esch_config* config);
+extern esch_error bench_integerFibonacci(esch_config* config);
+extern esch_error bench_integerCounter(esch_config* config);
+extern esch_error bench_integerBase10(esch_config* config);
+extern esch_error bench_floatBase10(esch_config* config);
+extern esch_error bench_fraction(esch_config* config);
+extern esch_error bench_pairCons(esch_config* config);
+extern esch_error bench_pairList(esch_config* config);
+extern esch_error bench_pairBulk(esch_config* config);
+extern esch_error bench_hashtable(esch_config* config);
+
+#ifdef __cplusplus
+}
+#endif /* __cplusplus */
+#endif /* _ESCH_BENCH_H_ */
@@ -67,8 +67,16 @@ extern "C" {
  * - key = "common:gc", value = esch_gc
  * - key = "vector:value_type", value = enum_type
  * - key = "vector:length", value = int
+ * - key = "vector:enlarge", value = int
+ * - key = "vector:sort_threads", value = int
+ * - key = "vector:layout", value = esch_vector_layout
  * - key = "gc:naive:slots", value = int
  * - key = "gc:naive:root", value = int
+ * - key = "gc:naive:enlarge", value = int
+ * - key = "log:async:slots", value = int
+ * - key = "log:async:fd", value = int
+ * - key = "pair:alloc", value = esch_alloc
+ * More keys can be added with esch_config_add_key().
  */
 extern const char* ESCH_CONFIG_KEY_ALLOC;
 extern const char* ESCH_CONFIG_KEY_LOG;
@@ -76,9 +84,14 @@ extern const char* ESCH_CONFIG_KEY_GC;
 extern const char* ESCH_CONFIG_KEY_VECTOR_ELEMENT_TYPE;
 extern const char* ESCH_CONFIG_KEY_VECTOR_LENGTH;
 extern const char* ESCH_CONFIG_KEY_VECTOR_ENLARGE;
+extern const char* ESCH_CONFIG_KEY_VECTOR_SORT_THREADS;
+extern const char* ESCH_CONFIG_KEY_VECTOR_LAYOUT;
 extern const char* ESCH_CONFIG_KEY_GC_NAIVE_SLOTS;
 extern const char* ESCH_CONFIG_KEY_GC_NAIVE_ROOT;
 extern const char* ESCH_CONFIG_KEY_GC_NAIVE_ENLARGE;
+extern const char* ESCH_CONFIG_KEY_LOG_ASYNC_SLOTS;
+extern const char* ESCH_CONFIG_KEY_LOG_ASYNC_FD;
+extern const char* ESCH_CONFIG_KEY_PAIR_ALLOC;
 
 typedef enum esch_error {
     ESCH_OK = 0,
@@ -107,6 +120,29 @@ typedef enum esch_config_value_type {
     ESCH_CONFIG_VALUE_TYPE_OBJECT,
 } esch_config_value_type;
 
+/*
+ * Key IDs resolve a key once, so later reads and writes skip string
+ * compare. Predefined keys have same IDs in all configs. Keys added
+ * by esch_config_add_key() get IDs after ESCH_CONFIG_KEY_ID_PREDEFINED,
+ * which are valid only for the config that added them.
+ */
+typedef enum esch_config_key_id {
+    ESCH_CONFIG_KEY_ID_ALLOC = 0,
+    ESCH_CONFIG_KEY_ID_LOG,
+    ESCH_CONFIG_KEY_ID_GC,
+    ESCH_CONFIG_KEY_ID_VECTOR_LENGTH,
+    ESCH_CONFIG_KEY_ID_VECTOR_ENLARGE,
+    ESCH_CONFIG_KEY_ID_GC_NAIVE_SLOTS,
+    ESCH_CONFIG_KEY_ID_GC_NAIVE_ROOT,
+    ESCH_CONFIG_KEY_ID_GC_NAIVE_ENLARGE,
+    ESCH_CONFIG_KEY_ID_VECTOR_SORT_THREADS,
+    ESCH_CONFIG_KEY_ID_VECTOR_LAYOUT,
+    ESCH_CONFIG_KEY_ID_LOG_ASYNC_SLOTS,
+    ESCH_CONFIG_KEY_ID_LOG_ASYNC_FD,
+    ESCH_CONFIG_KEY_ID_PAIR_ALLOC,
+    ESCH_CONFIG_KEY_ID_PREDEFINED /* Number of predefined keys */
+} esch_config_key_id;
+
 /**
  * The data structure to allow contianer type define an iterator. It's
  * used to access element of container type.
@@ -123,11 +159,40 @@ typedef enum esch_value_type
     ESCH_VALUE_TYPE_END,
 } esch_value_type;
 
+/**
+ * Memory layout of vector elements. It's decided when vector is
+ * created, and does not change visible behavior of vector.
+ */
+typedef enum esch_vector_layout
+{
+    /** An array of esch_value. Default. */
+    ESCH_VECTOR_LAYOUT_MIXED = 0,
+    /** An array of 1-byte type tags, plus an array of 8-byte payloads.
+     * Scanning by type (e.g. GC looking for objects) touches much less
+     * memory. */
+    ESCH_VECTOR_LAYOUT_SPLIT,
+} esch_vector_layout;
+
+/**
+ * How a hashtable compares keys, same as R6RS make-eq-hashtable,
+ * make-eqv-hashtable and make-hashtable with equal-hash.
+ */
+typedef enum esch_hashtable_kind
+{
+    /** Same value type and same bits. Objects by identity. */
+    ESCH_HASHTABLE_EQ = 0,
+    /** As eq, and numbers of same exactness and value are equal. */
+    ESCH_HASHTABLE_EQV,
+    /** As eqv, and strings, pairs and vectors are compared by content. */
+    ESCH_HASHTABLE_EQUAL,
+} esch_hashtable_kind;
+
 /* Basic types */
 typedef struct esch_type            esch_type;
 typedef struct esch_object          esch_object;
 typedef struct esch_iterator        esch_iterator;
 typedef struct esch_value           esch_value;
+typedef union esch_value_data       esch_value_data;
 typedef struct esch_config          esch_config;
 typedef struct esch_alloc           esch_alloc;
 typedef struct esch_log             esch_log;
@@ -136,8 +201,13 @@ typedef struct esch_parser          esch_parser;
 typedef struct esch_parser_callback esch_parser_callback;
 typedef struct esch_ast             esch_ast;
 typedef struct esch_string          esch_string;
+typedef struct esch_symbol          esch_symbol;
+typedef struct esch_symbol_table    esch_symbol_table;
 typedef struct esch_vector          esch_vector;
 typedef struct esch_pair            esch_pair;
+typedef struct esch_integer         esch_integer;
+typedef struct esch_fraction        esch_fraction;
+typedef struct esch_hashtable       esch_hashtable;
 typedef char                        esch_utf8;
 typedef int32_t                     esch_unicode;
 typedef unsigned char               esch_bool;
@@ -157,6 +227,7 @@ typedef esch_error (*esch_iterator_get_next_f)(esch_iterator*);
 typedef esch_error (*esch_alloc_realloc_f)(esch_alloc*, void*, size_t,
                                            void**);
 typedef esch_error (*esch_alloc_free_f)(esch_alloc*, void*);
+typedef int (*esch_value_compare_f)(esch_value*, esch_value*);
 
 
 /* ----------------------------------------------------------------- */
@@ -239,17 +310,18 @@ esch_error esch_type_is_valid_type(esch_type* type, esch_bool* valid);
  * Data structure to represent general value. Support different types
  * of values.
  */
+union esch_value_data
+{
+    esch_byte    b; /**< byte value */
+    esch_unicode u; /**< unicode value */
+    int          i; /**< integer value */
+    double       f; /**< float value (implemented as double) */
+    esch_object* o; /**< object value */
+};
 struct esch_value
 {
     enum esch_value_type type;
-    union
-    {
-        esch_byte    b; /**< byte value */
-        esch_unicode u; /**< unicode value */
-        int          i; /**< integer value */
-        double       f; /**< float value (implemented as double) */
-        esch_object* o; /**< object value */
-    } val;
+    esch_value_data val;
 };
 
 struct esch_iterator
@@ -258,6 +330,12 @@ struct esch_iterator
     void* iterator; /**< Set to NULL when end of iterator is reached.*/
     esch_iterator_get_value_f get_value;
     esch_iterator_get_next_f get_next;
+    /**
+     * Optional. Move iterator to the first object element at or after
+     * current position, skipping primitive values. NULL means caller
+     * should call get_next() on each element.
+     */
+    esch_iterator_get_next_f seek_object;
 };
 
 /**
@@ -346,6 +424,46 @@ esch_error esch_config_get_obj(esch_config* config,
                                const char* key, esch_object** obj);
 esch_error esch_config_set_obj(esch_config* config,
                                const char* key, esch_object* obj);
+/**
+ * Add a new key to config. Its value is 0 or NULL before set.
+ * @param config Given config object.
+ * @param key Key string, at most 32 bytes.
+ * @param type Type of value.
+ * @param id Returned key ID. If key exists with same type, return ID
+ *           of existing key.
+ * @return Error code. ESCH_ERROR_BAD_VALUE_TYPE if key exists with
+ *         another type.
+ */
+esch_error esch_config_add_key(esch_config* config, const char* key,
+                               esch_config_value_type type,
+                               esch_config_key_id* id);
+/**
+ * Resolve a key to its ID, so later access does not compare strings.
+ * @param config Given config object.
+ * @param key Key string.
+ * @param id Returned key ID.
+ * @return Error code. ESCH_ERROR_NOT_FOUND if not found.
+ */
+esch_error esch_config_find_key(esch_config* config, const char* key,
+                                esch_config_key_id* id);
+/*
+ * Same as functions above, with key ID. Return ESCH_ERROR_NOT_FOUND if
+ * ID is not in config, or ESCH_ERROR_BAD_VALUE_TYPE on other type.
+ */
+esch_error esch_config_get_int_by_id(esch_config* config,
+                                     esch_config_key_id id, int* value);
+esch_error esch_config_set_int_by_id(esch_config* config,
+                                     esch_config_key_id id, int value);
+esch_error esch_config_get_str_by_id(esch_config* config,
+                                     esch_config_key_id id, char** value);
+esch_error esch_config_set_str_by_id(esch_config* config,
+                                     esch_config_key_id id, char* value);
+esch_error esch_config_get_obj_by_id(esch_config* config,
+                                     esch_config_key_id id,
+                                     esch_object** obj);
+esch_error esch_config_set_obj_by_id(esch_config* config,
+                                     esch_config_key_id id,
+                                     esch_object* obj);
 
 /* --- Memory allocator --- */
 /* Default C alloc does not depend on esch_config. */
@@ -358,7 +476,8 @@ esch_error esch_config_set_obj(esch_config* config,
 esch_error esch_alloc_new_c_default(esch_config* config,
                                     esch_alloc** alloc);
 /**
- * Allocate a new buffer or resize an existing buffer.
+ * Allocate a new buffer or resize an existing buffer. A new buffer is
+ * filled with zero.
  * @param alloc The esch_alloc object to allocate buffer.
  * @param in    Input memory buffer. Can be NULL.
  * @param size  Size of wanted buffer.
@@ -368,16 +487,97 @@ esch_error esch_alloc_new_c_default(esch_config* config,
 esch_error esch_alloc_realloc(esch_alloc* alloc, void* in,
                               size_t size, void** out);
 esch_error esch_alloc_free(esch_alloc* alloc, void* ptr);
+/**
+ * Create a pool alloc, which serves buffers up to cell_size bytes from
+ * big chunks. Cells have no per-buffer overhead, and freed cells are
+ * reused. Chunks come from alloc in config, and are returned only when
+ * pool is deleted, with esch_object_delete().
+ * @param config Config object to set alloc and log.
+ * @param cell_size Largest buffer size served by pool.
+ * @param alloc Returned allocator object.
+ * @return Error code. Allocating more than cell_size bytes from pool
+ *         returns ESCH_ERROR_INVALID_PARAMETER.
+ */
+esch_error esch_alloc_new_pool(esch_config* config, size_t cell_size,
+                               esch_alloc** alloc);
+/**
+ * Create a pool alloc with cells sized for pair objects. Set it as
+ * "pair:alloc" in config, and pairs created with the config come from
+ * the pool. Delete the pool after all its pairs are gone.
+ * @param config Config object to set alloc and log.
+ * @param alloc Returned allocator object.
+ * @return Error code.
+ */
+esch_error esch_alloc_new_pair_pool(esch_config* config,
+                                    esch_alloc** alloc);
 
 /* TODO A buddy memory allocator */
 esch_error esch_alloc_new_buddy(esch_config* config, esch_alloc** alloc);
 
 /* --- Logger objects -- */
+/*
+ * A log writes messages at or above its level. Do-nothing log has
+ * ESCH_LOG_LEVEL_NONE, printf log has ESCH_LOG_LEVEL_INFO.
+ */
+typedef enum esch_log_level {
+    ESCH_LOG_LEVEL_NONE = 0,
+    ESCH_LOG_LEVEL_ERROR,
+    ESCH_LOG_LEVEL_WARN,
+    ESCH_LOG_LEVEL_INFO,
+} esch_log_level;
+
 /* Do nothing log and printf log do not depend on esch_config. */
 extern esch_log* esch_global_log;
 esch_error esch_log_new_do_nothing(esch_config* config, esch_log** log);
 esch_error esch_log_new_printf(esch_config* config, esch_log** log);
 esch_error esch_log_delete(esch_log* log);
+/**
+ * Change level of log. Messages below level return before formatting.
+ * Do-nothing log and printf log are single shared objects (printf log
+ * is also global log of debug builds), so their levels can't change.
+ * @param log The log object.
+ * @param level New level.
+ * @return Error code. ESCH_ERROR_NOT_SUPPORTED for do-nothing log and
+ *         printf log.
+ */
+esch_error esch_log_set_level(esch_log* log, esch_log_level level);
+/**
+ * Get level of log.
+ * @param log The log object.
+ * @param level Returned level.
+ * @return Error code.
+ */
+esch_error esch_log_get_level(esch_log* log, esch_log_level* level);
+/**
+ * Create a log that never blocks caller. Messages are formatted into a
+ * lock-free ring buffer, and a background thread writes them to a file
+ * descriptor. When buffer is full, new messages are dropped and
+ * counted. Messages that can't be written to file descriptor are
+ * counted as dropped too. Delete it with esch_object_delete(), which writes all
+ * pending messages first.
+ * @param config Config object to set alloc and log. It also reads
+ *               "log:async:slots" (number of messages in buffer,
+ *               default 1024) and "log:async:fd" (default 1, stdout).
+ * @param log Returned created log object.
+ * @return Error code. ESCH_ERROR_NOT_SUPPORTED if thread can't start.
+ */
+esch_error esch_log_new_async(esch_config* config, esch_log** log);
+/**
+ * Wait until all messages logged before the call are written. Do
+ * nothing for synchronous logs.
+ * @param log The log object.
+ * @return Error code.
+ */
+esch_error esch_log_flush(esch_log* log);
+/**
+ * Get counters of a log. Synchronous logs never drop messages.
+ * @param log The log object.
+ * @param written Returned number of messages written. Optional.
+ * @param dropped Returned number of messages dropped. Optional.
+ * @return Error code.
+ */
+esch_error esch_log_get_counters(esch_log* log, size_t* written,
+                                 size_t* dropped);
 /**
  * Public function to log error.
  * @param log The log object.
@@ -400,6 +600,23 @@ esch_error esch_log_warn(esch_log* log, const char* fmt, ...);
  */
 esch_error esch_log_info(esch_log* log, const char* fmt, ...);
 
+/* --- Event trace -- */
+/**
+ * Start binary trace of object and GC events: object creation and
+ * deletion, GC attach, and phases of recycle. Trace is global, shared
+ * by all threads. Use tools/trace/decode.py to read trace file.
+ * @param path Trace file to create.
+ * @return Error code. ESCH_ERROR_INVALID_STATE if trace is running, or
+ *         ESCH_ERROR_NOT_FOUND if file can't be created.
+ */
+esch_error esch_trace_start(const char* path);
+/**
+ * Stop trace and close trace file. It waits for other threads that are
+ * appending events. Events from them after that are not recorded.
+ * @return Error code. ESCH_ERROR_INVALID_STATE if trace is not running.
+ */
+esch_error esch_trace_stop(void);
+
 /* --- Garbage collector -- */
 /**
  * Create a new mark-and-sweep GC object.
@@ -438,17 +655,32 @@ esch_error esch_string_new_from_utf8(esch_config* config, const char* utf8,
  */
 esch_error esch_string_duplicate(esch_string* input, esch_string** output);
 /**
- * Get a reference to UTF-8 string of given string.
+ * Get a reference to UTF-8 string of given string. A rope string is
+ * flattened into one buffer on first call.
  * @param str Give esch_string object
- * @return The internal UTF-8 c-string, ending with '\0'.
+ * @return The internal UTF-8 c-string, ending with '\0'. NULL if
+ *         buffer can't be allocated.
  */
 char* esch_string_get_utf8_ref(esch_string* str);
 /**
- * Get a reference to UTF-8 string of given string.
+ * Get a reference to Unicode string of given string. The Unicode
+ * buffer is created on first call, so it costs memory only when it's
+ * really used.
  * @param str Give esch_string object
- * @return The internal Unicode c-string, ending with '\0'.
+ * @return The internal Unicode c-string, ending with '\0'. NULL if
+ *         buffer can't be allocated.
  */
 esch_unicode* esch_string_get_unicode_ref(esch_string* str);
+/**
+ * Get one Unicode character at given index. It does not create Unicode
+ * buffer for pure ASCII strings.
+ * @param str Give esch_string object
+ * @param index Index in Unicode representation.
+ * @param ch Returned character.
+ * @return Return code. ESCH_ERROR_OUT_OF_BOUND if index is too large.
+ */
+esch_error esch_string_get_unicode_at(esch_string* str, size_t index,
+                                      esch_unicode* ch);
 /**
  * Get length of given string in UTF-8 representation.
  * @param str Give esch_string object
@@ -461,8 +693,46 @@ size_t esch_string_get_utf8_length(esch_string* str);
  * @return Length of string, in Unicode representation, '\0' not included.
  */
 size_t esch_string_get_unicode_length(esch_string* str);
+/**
+ * Concatenate two strings. The result is a rope string, which refers
+ * to input strings as leaves of a balanced tree instead of copying
+ * them, so it takes O(log n) time. Without GC, input strings must be
+ * kept until all rope strings using them are deleted.
+ * @param config Config object to set alloc, log and GC.
+ * @param left Left part of new string.
+ * @param right Right part of new string.
+ * @param str Returned string object.
+ * @return Return code.
+ */
+esch_error esch_string_concat(esch_config* config, esch_string* left,
+                              esch_string* right, esch_string** str);
+/**
+ * Create a new string from characters of given string, without copying
+ * if possible. Substring of a flat string is a view sharing buffers of
+ * given string, unless it's short enough to be copied cheaply.
+ * Substring of a rope string shares leaves with it, like
+ * esch_string_concat(). Without GC, given string must be kept until
+ * the substring is deleted.
+ * @param config Config object to set alloc, log and GC.
+ * @param str Given esch_string object.
+ * @param begin Index of first character, in Unicode representation.
+ * @param end Index after last character, in Unicode representation.
+ * @param output Returned string object.
+ * @return Return code. ESCH_ERROR_OUT_OF_BOUND if range is invalid.
+ */
+esch_error esch_string_substring(esch_config* config, esch_string* str,
+                                 size_t begin, size_t end,
+                                 esch_string** output);
 
 int esch_unicode_string_is_valid_identifier(const esch_unicode* unicode);
+/**
+ * Check if given string is a valid identifier. Same rules as
+ * esch_unicode_string_is_valid_identifier(), but ASCII strings are
+ * checked on UTF-8 bytes directly, 16 bytes at a time when possible.
+ * @param str Given esch_string object.
+ * @return 1 if it's a valid identifier, or 0 if not.
+ */
+int esch_string_is_valid_identifier(esch_string* str);
 
 #define esch_unicode_is_ascii(ch) \
     (((esch_unicode)(ch)) >= 0 && ((esch_unicode)(ch)) < 127 )
@@ -475,6 +745,46 @@ int esch_unicode_string_is_valid_identifier(const esch_unicode* unicode);
      (ch) == '/' || (ch) == ':' || (ch) == '<' || (ch) == '=' || \
      (ch) == '>' || (ch) == '?' || (ch) == '@' || (ch) == '^' || \
      (ch) == '_' || (ch) == '~')
+/*
+ * Unicode general categories. Generated by tools/unicode/gencode.py,
+ * which uses the same order.
+ */
+enum esch_unicode_category
+{
+    ESCH_UNICODE_CATEGORY_NONE = 0, /* Not in any category below */
+    ESCH_UNICODE_CATEGORY_LU,
+    ESCH_UNICODE_CATEGORY_LL,
+    ESCH_UNICODE_CATEGORY_LT,
+    ESCH_UNICODE_CATEGORY_LM,
+    ESCH_UNICODE_CATEGORY_LO,
+    ESCH_UNICODE_CATEGORY_MN,
+    ESCH_UNICODE_CATEGORY_MC,
+    ESCH_UNICODE_CATEGORY_ND,
+    ESCH_UNICODE_CATEGORY_NL,
+    ESCH_UNICODE_CATEGORY_NO,
+    ESCH_UNICODE_CATEGORY_PD,
+    ESCH_UNICODE_CATEGORY_PC,
+    ESCH_UNICODE_CATEGORY_PO,
+    ESCH_UNICODE_CATEGORY_SC,
+    ESCH_UNICODE_CATEGORY_SM,
+    ESCH_UNICODE_CATEGORY_SK,
+    ESCH_UNICODE_CATEGORY_SO,
+    ESCH_UNICODE_CATEGORY_CO
+};
+/**
+ * Get general category of a code point in O(1), by two-stage table.
+ * @param ch Code point.
+ * @return One of enum esch_unicode_category.
+ */
+int esch_unicode_get_category(esch_unicode ch);
+/**
+ * Check if a code point can start an identifier, or appear after first
+ * character, by one lookup in identifier bitsets.
+ * @param ch Code point.
+ * @return 1 if allowed, or 0 if not.
+ */
+int esch_unicode_is_identifier_initial(esch_unicode ch);
+int esch_unicode_is_identifier_subsequent(esch_unicode ch);
 int esch_unicode_is_range_lu(esch_unicode ch);
 int esch_unicode_is_range_ll(esch_unicode ch);
 int esch_unicode_is_range_lt(esch_unicode ch);
@@ -494,6 +804,76 @@ int esch_unicode_is_range_sk(esch_unicode ch);
 int esch_unicode_is_range_so(esch_unicode ch);
 int esch_unicode_is_range_co(esch_unicode ch);
 
+/* --- Symbol --- */
+/*
+ * Symbols are created by a symbol table, which keeps one symbol for
+ * each name. So two symbols with same name are always the same
+ * object, and comparing symbols is comparing pointers.
+ *
+ * When GC is enabled, the table does not keep symbols alive: symbols
+ * not reachable from GC root are recycled and removed from table.
+ * Without GC, symbols are deleted with the table, or explicitly with
+ * esch_object_delete().
+ */
+
+/**
+ * Create a new symbol table.
+ * @param config Config object to set alloc, log and GC. Symbols created
+ *               by table use the same alloc, log and GC.
+ * @param table Returned symbol table.
+ * @return Return code. ESCH_OK if success.
+ */
+esch_error esch_symbol_table_new(esch_config* config,
+                                 esch_symbol_table** table);
+/**
+ * Get symbol of given name. The symbol is created if it does not
+ * exist yet.
+ * @param table Given symbol table.
+ * @param utf8 Name of symbol, in UTF-8.
+ * @param begin Begin of name in utf8.
+ * @param end End of name in utf8. Set begin = 0, end = -1 to use
+ *            whole c-string.
+ * @param symbol Returned symbol.
+ * @return Return code. ESCH_ERROR_INVALID_PARAMETER if name is not
+ *         valid UTF-8.
+ */
+esch_error esch_symbol_table_intern(esch_symbol_table* table,
+                                    const char* utf8, int begin, int end,
+                                    esch_symbol** symbol);
+/**
+ * Find symbol of given name, without creating it.
+ * @param table Given symbol table.
+ * @param utf8 Name of symbol, in UTF-8.
+ * @param begin Begin of name in utf8.
+ * @param end End of name in utf8. Set begin = 0, end = -1 to use
+ *            whole c-string.
+ * @param symbol Returned symbol. Unchanged if not found.
+ * @return Return code. ESCH_ERROR_NOT_FOUND if symbol does not exist.
+ */
+esch_error esch_symbol_table_lookup(esch_symbol_table* table,
+                                    const char* utf8, int begin, int end,
+                                    esch_symbol** symbol);
+/**
+ * Get number of symbols in table.
+ * @param table Given symbol table.
+ * @param count Returned number of symbols.
+ * @return Return code. ESCH_OK if success.
+ */
+esch_error esch_symbol_table_get_count(esch_symbol_table* table,
+                                       size_t* count);
+/**
+ * Get name of given symbol.
+ * @param symbol Given symbol.
+ * @return The internal UTF-8 c-string, ending with '\0'.
+ */
+char* esch_symbol_get_utf8_ref(esch_symbol* symbol);
+/**
+ * Get length of name of given symbol.
+ * @param symbol Given symbol.
+ * @return Length of name in UTF-8, '\0' not included.
+ */
+size_t esch_symbol_get_utf8_length(esch_symbol* symbol);
+
 /* --- Vector --- */
 /* XXX
  * This is a vector to represent Scheme pair, list and array. It's used
@@ -670,6 +1050,36 @@ esch_error esch_vector_set_integer(esch_vector* vec, int index, int i);
  */
 esch_error esch_vector_set_float(esch_vector* vec, int index, double f);
 
+/**
+ * Sort elements of vector in place. The sort is stable.
+ *
+ * When compare is NULL, a built-in order is used: values are ordered
+ * by type first, then by value (objects are ordered by address).
+ * Vectors that hold only bytes, unicode, integers or floats are sorted
+ * with radix sort. Otherwise a merge sort is used, which runs on
+ * multiple threads for large vectors when "vector:sort_threads" is
+ * set larger than 1 when the vector is created.
+ *
+ * @param vec Given vector object.
+ * @param compare Compare function, or NULL to use built-in order. It
+ *                must be thread-safe if multiple threads are enabled.
+ * @return Return code. ESCH_OK if success.
+ */
+esch_error esch_vector_sort(esch_vector* vec, esch_value_compare_f compare);
+/**
+ * Search a value in a sorted vector with binary search.
+ * @param vec Given vector object, sorted with the same compare function.
+ * @param key Value to search.
+ * @param compare Compare function, or NULL to use built-in order.
+ * @param index Returned index of first element equal to key. When
+ *              key is not found, it's the position where key can be
+ *              inserted while keeping vector sorted.
+ * @return Return code. ESCH_OK if found, ESCH_ERROR_NOT_FOUND if not.
+ */
+esch_error esch_vector_binary_search(esch_vector* vec, esch_value* key,
+                                     esch_value_compare_f compare,
+                                     int* index);
+
 /* --- Pair --- */
 /**
  * Create a new pair.
@@ -691,6 +1101,40 @@ esch_error esch_pair_new(esch_config* config,
  * @return ESCH_OK if correct.
  */
 esch_error esch_pair_new_empty(esch_config* config, esch_pair** pair);
+/**
+ * Create a list of given values, ending with empty list. When pairs
+ * come from a pool (see esch_alloc_new_pair_pool()), cells are taken
+ * next to each other, so walking the list is a linear scan.
+ * @param config Given config object.
+ * @param values Values of list. Can be NULL if length is 0.
+ * @param length Number of values.
+ * @param list Out parameter of first pair of list.
+ * @return ESCH_OK if correct.
+ */
+esch_error esch_pair_list_from_values(esch_config* config,
+                                      const esch_value* values,
+                                      size_t length, esch_pair** list);
+/**
+ * Create a list of values in a vector. Same as
+ * esch_pair_list_from_values(), all pairs are created in one pass.
+ * @param config Given config object.
+ * @param vec Given vector.
+ * @param list Out parameter of first pair of list.
+ * @return ESCH_OK if correct.
+ */
+esch_error esch_vector_to_list(esch_config* config, esch_vector* vec,
+                               esch_pair** list);
+/**
+ * Create a vector of values in a list. Buffer of vector is allocated
+ * once, with the length of list.
+ * @param config Given config object.
+ * @param list Given list.
+ * @param vec Out parameter of created vector.
+ * @return ESCH_OK if correct. ESCH_ERROR_BAD_VALUE_TYPE if it's not a
+ *         list, or it's circular.
+ */
+esch_error esch_list_to_vector(esch_config* config, esch_pair* list,
+                               esch_vector** vec);
 
 /**
  * Get head of pair.
@@ -722,14 +1166,312 @@ esch_error esch_pair_set_head(esch_pair* pair, esch_value* value);
 esch_error esch_pair_set_tail(esch_pair* pair, esch_value* value);
 
 /**
- * Check if given pair is a list.
+ * Check if given pair is a list. A circular list is not a list. Length
+ * is remembered on the pairs, so checking same list again is fast until
+ * a tail is set.
  * @param pair Given pair object.
  * @param is_list Bool value to indicate if it's a list.
  * @return ESCH_OK if correct.
  */
 esch_error esch_pair_is_list(esch_pair* pair, esch_bool* is_list);
+/**
+ * Get number of values in a list. Same as esch_pair_is_list(), length
+ * is remembered on the pairs.
+ * @param pair Given pair object.
+ * @param length Returned length.
+ * @return ESCH_OK if correct. ESCH_ERROR_BAD_VALUE_TYPE if it's not a
+ *         list, or it's circular.
+ */
+esch_error esch_pair_list_length(esch_pair* pair, size_t* length);
+
+/* --- Hashtable --- */
+/*
+ * A hashtable maps keys to values, both can be any value except
+ * ESCH_VALUE_TYPE_END. It's a container for GC: keys and values are
+ * kept alive by table. Table grows incrementally, so no single
+ * operation rehashes the whole table.
+ *
+ * Keys of an equal table should not be changed after they are added,
+ * or they may not be found any more.
+ */
+/**
+ * Create a new hashtable.
+ * @param config Config object to set alloc, log and gc.
+ * @param kind How keys are compared.
+ * @param table Returned hashtable.
+ * @return Return code. ESCH_OK if success.
+ */
+esch_error esch_hashtable_new(esch_config* config, esch_hashtable_kind kind,
+                              esch_hashtable** table);
+/**
+ * Add a key, or replace value of an existing key.
+ * @param table Given hashtable.
+ * @param key Given key.
+ * @param value Value of key.
+ * @return Return code. ESCH_OK if success.
+ */
+esch_error esch_hashtable_set(esch_hashtable* table, esch_value* key,
+                              esch_value* value);
+/**
+ * Get value of given key.
+ * @param table Given hashtable.
+ * @param key Given key.
+ * @param value Returned value. Unchanged if not found.
+ * @return Return code. ESCH_ERROR_NOT_FOUND if key does not exist.
+ */
+esch_error esch_hashtable_ref(esch_hashtable* table, esch_value* key,
+                              esch_value* value);
+/**
+ * Remove given key.
+ * @param table Given hashtable.
+ * @param key Given key.
+ * @return Return code. ESCH_ERROR_NOT_FOUND if key does not exist.
+ */
+esch_error esch_hashtable_delete(esch_hashtable* table, esch_value* key);
+/**
+ * Get number of keys in table.
+ * @param table Given hashtable.
+ * @param count Returned number of keys.
+ * @return Return code. ESCH_OK if success.
+ */
+esch_error esch_hashtable_get_count(esch_hashtable* table, size_t* count);
 
 /* --- Number -- */
+/*
+ * Integers have unlimited precision. Values that fit in int are kept
+ * small, and larger values switch to limbs transparently. Integers are
+ * immutable: every operation creates a new integer object.
+ */
+/**
+ * Create an integer from int.
+ * @param config Config object to set alloc, log and gc.
+ * @param value Given value.
+ * @param val Returned integer object.
+ * @return Return code. ESCH_OK if success.
+ */
+esch_error esch_integer_new_from_int(esch_config* config, int value,
+                                     esch_integer** val);
+/**
+ * Create an integer from a string of decimal digits, with optional
+ * leading '+' or '-'.
+ * @param config Config object to set alloc, log and gc.
+ * @param begin Start of string.
+ * @param end End of string. NULL means string ends with '\0'.
+ * @param val Returned integer object.
+ * @return Return code. ESCH_ERROR_INVALID_PARAMETER if string is not
+ *         a valid integer.
+ */
+esch_error esch_integer_new_from_base10(esch_config* config,
+                                        const char* begin,
+                                        const char* end,
+                                        esch_integer** val);
+/**
+ * Write decimal form of integer to buffer, ending with '\0'.
+ * @param val Given integer object.
+ * @param buffer Output buffer.
+ * @param size Size of buffer, including '\0'.
+ * @param length Returned number of characters, '\0' not included.
+ *               Set even when buffer is too small.
+ * @return Return code. ESCH_ERROR_OUT_OF_BOUND if buffer is too small.
+ */
+esch_error esch_integer_to_base10(esch_integer* val, char* buffer,
+                                  size_t size, size_t* length);
+/**
+ * Get value of integer as int.
+ * @param val Given integer object.
+ * @param value Returned value.
+ * @return Return code. ESCH_ERROR_OUT_OF_BOUND if it does not fit.
+ */
+esch_error esch_integer_to_int(esch_integer* val, int* value);
+/**
+ * Compare two integers.
+ * @param val1 First integer.
+ * @param val2 Second integer.
+ * @param result Returned result: negative, 0, or positive, when val1
+ *               is less than, equal to, or greater than val2.
+ * @return Return code. ESCH_OK if success.
+ */
+esch_error esch_integer_compare(esch_integer* val1, esch_integer* val2,
+                                int* result);
+/**
+ * Add, subtract or multiply two integers.
+ * @param config Config object to create result.
+ * @param val1 First operand.
+ * @param val2 Second operand.
+ * @param val Returned result.
+ * @return Return code. ESCH_OK if success.
+ */
+esch_error esch_integer_add(esch_config* config, esch_integer* val1,
+                            esch_integer* val2, esch_integer** val);
+esch_error esch_integer_sub(esch_config* config, esch_integer* val1,
+                            esch_integer* val2, esch_integer** val);
+esch_error esch_integer_mul(esch_config* config, esch_integer* val1,
+                            esch_integer* val2, esch_integer** val);
+/**
+ * Truncated division: quotient is rounded toward zero, and remainder
+ * has same sign as dividend.
+ * @param config Config object to create results.
+ * @param val1 Dividend.
+ * @param val2 Divisor.
+ * @param quotient Returned quotient. Can be NULL.
+ * @param remainder Returned remainder. Can be NULL.
+ * @return Return code. ESCH_ERROR_INVALID_PARAMETER if divisor is 0.
+ */
+esch_error esch_integer_divide(esch_config* config, esch_integer* val1,
+                               esch_integer* val2, esch_integer** quotient,
+                               esch_integer** remainder);
+
+/*
+ * Fractions are exact rationals, always normalized: denominator is
+ * positive, and has no common factor with numerator. Integral results
+ * have denominator 1. Fractions are immutable.
+ */
+/**
+ * Create a fraction from numerator and denominator.
+ * @param config Config object to set alloc, log and gc.
+ * @param numerator Numerator.
+ * @param denominator Denominator, can be negative.
+ * @param val Returned fraction object.
+ * @return Return code. ESCH_ERROR_INVALID_PARAMETER if denominator is
+ *         0.
+ */
+esch_error esch_fraction_new(esch_config* config, esch_integer* numerator,
+                             esch_integer* denominator,
+                             esch_fraction** val);
+esch_error esch_fraction_new_from_int(esch_config* config, int numerator,
+                                      int denominator, esch_fraction** val);
+/**
+ * Get numerator or denominator of normalized fraction.
+ * @param config Config object to create result.
+ * @param val Given fraction.
+ * @param part Returned integer object.
+ * @return Return code. ESCH_OK if success.
+ */
+esch_error esch_fraction_get_numerator(esch_config* config,
+                                       esch_fraction* val,
+                                       esch_integer** part);
+esch_error esch_fraction_get_denominator(esch_config* config,
+                                         esch_fraction* val,
+                                         esch_integer** part);
+/**
+ * Add, subtract, multiply or divide two fractions.
+ * @param config Config object to create result.
+ * @param val1 First operand.
+ * @param val2 Second operand.
+ * @param val Returned result.
+ * @return Return code. ESCH_ERROR_INVALID_PARAMETER if dividing by 0.
+ */
+esch_error esch_fraction_add(esch_config* config, esch_fraction* val1,
+                             esch_fraction* val2, esch_fraction** val);
+esch_error esch_fraction_sub(esch_config* config, esch_fraction* val1,
+                             esch_fraction* val2, esch_fraction** val);
+esch_error esch_fraction_mul(esch_config* config, esch_fraction* val1,
+                             esch_fraction* val2, esch_fraction** val);
+esch_error esch_fraction_div(esch_config* config, esch_fraction* val1,
+                             esch_fraction* val2, esch_fraction** val);
+/**
+ * Compare two fractions.
+ * @param val1 First fraction.
+ * @param val2 Second fraction.
+ * @param result Returned result: negative, 0, or positive, when val1
+ *               is less than, equal to, or greater than val2.
+ * @return Return code. ESCH_OK if success.
+ */
+esch_error esch_fraction_compare(esch_fraction* val1, esch_fraction* val2,
+                                 int* result);
+/**
+ * Write fraction to buffer as "n/d", or "n" if denominator is 1,
+ * ending with '\0'.
+ * @param val Given fraction.
+ * @param buffer Output buffer.
+ * @param size Size of buffer, including '\0'.
+ * @param length Returned number of characters, '\0' not included.
+ *               Set even when buffer is too small.
+ * @return Return code. ESCH_ERROR_OUT_OF_BOUND if buffer is too small.
+ */
+esch_error esch_fraction_to_base10(esch_fraction* val, char* buffer,
+                                   size_t size, size_t* length);
+
+/**
+ * Add, subtract or multiply two integer values. An operand is either
+ * ESCH_VALUE_TYPE_INTEGER (fixnum), or an esch_integer object. Fixnums
+ * are computed without memory allocation, and an esch_integer object
+ * is created only when result does not fit in int. Result that fits
+ * in int is always a fixnum.
+ * @param config Config object to create result. Not used when result
+ *               is a fixnum.
+ * @param val1 First operand.
+ * @param val2 Second operand.
+ * @param result Returned result. Can be one of operands.
+ * @return Return code. ESCH_ERROR_BAD_VALUE_TYPE if an operand is not
+ *         an integer.
+ */
+esch_error esch_value_add(esch_config* config, esch_value* val1,
+                          esch_value* val2, esch_value* result);
+esch_error esch_value_sub(esch_config* config, esch_value* val1,
+                          esch_value* val2, esch_value* result);
+esch_error esch_value_mul(esch_config* config, esch_value* val1,
+                          esch_value* val2, esch_value* result);
+
+/*
+ * Floats are IEEE double. Reading is correctly rounded for any number
+ * of digits, and printing gives shortest digits that read back as the
+ * same double.
+ */
+/**
+ * Read a double from decimal string: optional '+' or '-', digits with
+ * optional '.', and optional exponent after 'e' or 'E'. Also accept
+ * "+inf.0", "-inf.0", "+nan.0" and "-nan.0".
+ * @param begin Start of string.
+ * @param end End of string. NULL means string ends with '\0'.
+ * @param value Returned double, rounded to nearest, ties to even.
+ * @return Return code. ESCH_ERROR_INVALID_PARAMETER if string is not
+ *         a valid decimal.
+ */
+esch_error esch_float_from_base10(const char* begin, const char* end,
+                                  double* value);
+/**
+ * Write shortest decimal form of double to buffer, ending with '\0'.
+ * Values from 1e-6 to below 1e21 use fixed notation, and integral
+ * values end with ".0". Other values use exponent, such as "1e21".
+ * Text is at most 25 characters, '\0' not included.
+ * @param value Given double.
+ * @param buffer Output buffer.
+ * @param size Size of buffer, including '\0'.
+ * @param length Returned number of characters, '\0' not included.
+ *               Set even when buffer is too small.
+ * @return Return code. ESCH_ERROR_OUT_OF_BOUND if buffer is too small.
+ */
+esch_error esch_float_to_base10(double value, char* buffer, size_t size,
+                                size_t* length);
+
+/**
+ * Read a number literal as value. Digits without '.' or exponent give
+ * a fixnum, or an esch_integer object if it does not fit in int. Other
+ * numbers give ESCH_VALUE_TYPE_FLOAT.
+ * @param config Config object to create integer object. Not used for
+ *               fixnums and floats.
+ * @param begin Start of string.
+ * @param end End of string. NULL means string ends with '\0'.
+ * @param value Returned value.
+ * @return Return code. ESCH_ERROR_INVALID_PARAMETER if string is not
+ *         a valid number.
+ */
+esch_error esch_value_from_base10(esch_config* config, const char* begin,
+                                  const char* end, esch_value* value);
+/**
+ * Write decimal form of a number value to buffer, ending with '\0'.
+ * Same as esch_integer_to_base10() or esch_float_to_base10().
+ * @param value A fixnum, float, or esch_integer object.
+ * @param buffer Output buffer.
+ * @param size Size of buffer, including '\0'.
+ * @param length Returned number of characters, '\0' not included.
+ *               Set even when buffer is too small.
+ * @return Return code. ESCH_ERROR_BAD_VALUE_TYPE if value is not a
+ *         number, ESCH_ERROR_OUT_OF_BOUND if buffer is too small.
+ */
+esch_error esch_value_to_base10(esch_value* value, char* buffer,
+                                size_t size, size_t* length);
 
 /* --- Parser --- */
 esch_error esch_parser_new(esch_config* config, esch_parser** parser);
@@ -186,13 +186,17 @@ esch_alloc_realloc_c_default(esch_alloc* alloc,
     }
 
     size_with_cookie = size + sizeof(esch_alloc*);
-    new_buffer = (void*)realloc(old_buffer, size_with_cookie);
+    if (in == NULL) {
+        /* Large buffers come as zero pages from system, which are
+         * touched on first use instead of being cleared here. */
+        new_buffer = (void*)calloc(1, size_with_cookie);
+    } else {
+        new_buffer = (void*)realloc(old_buffer, size_with_cookie);
+    }
     ESCH_CHECK(new_buffer != NULL, log,
             "esch_alloc_malloc(): Fail to allocate",
             ESCH_ERROR_OUT_OF_MEMORY);
-    if (in == NULL) {
-        memset(new_buffer, 0, size_with_cookie);
-    } else {
+    if (in != NULL) {
         alloc_c->deallocate_count += 1;
     }
     alloc_c->allocate_count += 1;
@@ -23,6 +23,30 @@ struct esch_alloc_c_default
 };
 typedef struct esch_alloc_c_default esch_alloc_c_default;
 
+/*
+ * Pool of fixed-size cells, carved from big chunks of parent alloc.
+ * A cell has no header, and freed cells are kept in a list for next
+ * allocation. Chunks are returned to parent only when pool is deleted.
+ */
+struct esch_alloc_pool
+{
+    esch_alloc base;
+    esch_alloc* parent;   /**< Alloc of chunks. */
+    size_t cell_size;     /**< Rounded up to ESCH_ALLOC_POOL_ALIGN. */
+    size_t chunk_cells;   /**< Cells in each chunk. */
+    void* chunks;         /**< Chunk list, linked by first word. */
+    void* free_cells;     /**< Free cell list, linked by first word. */
+    esch_byte* fresh;     /**< Never used cells of newest chunk. */
+    esch_byte* fresh_end;
+    size_t inuse;         /**< Cells allocated and not freed. */
+};
+typedef struct esch_alloc_pool esch_alloc_pool;
+
+extern struct esch_builtin_type esch_alloc_pool_type;
+
+#define ESCH_ALLOC_POOL_ALIGN 8
+#define ESCH_ALLOC_POOL_CHUNK_SIZE 65536
+
 #define ESCH_IS_VALID_ALLOC(alloc) \
     ((alloc) != NULL && \
      ESCH_IS_VALID_OBJECT(ESCH_CAST_TO_OBJECT(alloc)) && \
@@ -36,12 +60,27 @@ typedef struct esch_alloc_c_default esch_alloc_c_default;
      ESCH_OBJECT_GET_ALLOC(ESCH_CAST_TO_OBJECT(alloc)) \
                == ((esch_alloc*)(alloc)))
 
+#define ESCH_IS_VALID_POOL_ALLOC(alloc) \
+    (ESCH_IS_VALID_ALLOC(((esch_alloc*)(alloc)))           && \
+     (ESCH_OBJECT_GET_TYPE(ESCH_CAST_TO_OBJECT(alloc)) \
+               == &(esch_alloc_pool_type.type))             && \
+     ((esch_alloc_pool*)(alloc))->parent != NULL)
+
 esch_error
 esch_alloc_realloc_i(esch_alloc* alloc, void* in, size_t size, void** out);
 
 esch_error
 esch_alloc_free_i(esch_alloc* alloc, void* ptr);
 
+/*
+ * Take up to count zeroed cells, next to each other, from never used
+ * part of pool. (*got) can be less than count at end of a chunk, and
+ * is 1 when a free cell is reused instead of growing the pool.
+ */
+esch_error
+esch_alloc_pool_new_run_i(esch_alloc* alloc, size_t count,
+                          void** cells, size_t* got);
+
 #ifdef __cplusplus
 }
 #endif /* __cplusplus */
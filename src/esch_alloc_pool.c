@@ -0,0 +1,275 @@
+/* vim:ft=c expandtab tw=72 sw=4
+ */
+/* See Copyright notice in esch.h */
+#include <string.h>
+#include "esch_alloc.h"
+#include "esch_debug.h"
+#include "esch_config.h"
+#include "esch_object.h"
+#include "esch_type.h"
+#include "esch_pair.h"
+
+/*
+ * A chunk starts with a link to previous chunk, followed by cells. New
+ * cells are taken from free list first, then from the never used part
+ * of newest chunk, so a new chunk is allocated only when pool is full.
+ * Objects of same type, such as pairs, end up next to each other.
+ */
+#define ESCH_ALLOC_POOL_ROUND(size) \
+    (((size) + ESCH_ALLOC_POOL_ALIGN - 1) / ESCH_ALLOC_POOL_ALIGN * \
+     ESCH_ALLOC_POOL_ALIGN)
+
+static esch_error
+esch_alloc_pool_new_as_object(esch_config* config, esch_object** obj);
+static esch_error
+esch_alloc_pool_destructor(esch_object* obj);
+static esch_error
+esch_alloc_pool_realloc(esch_alloc* alloc, void* in, size_t size,
+                        void** out);
+static esch_error
+esch_alloc_pool_free(esch_alloc* alloc, void* ptr);
+
+struct esch_builtin_type esch_alloc_pool_type =
+{
+    {
+        &(esch_meta_type.type),
+        NULL, /* No alloc */
+        &(esch_log_do_nothing.log),
+        NULL,
+        NULL,
+    },
+    {
+        ESCH_VERSION,
+        sizeof(esch_alloc_pool),
+        esch_alloc_pool_new_as_object,
+        esch_alloc_pool_destructor,
+        esch_type_default_non_copiable,
+        esch_type_default_no_string_form,
+        esch_type_default_no_doc,
+        esch_type_default_no_iterator
+    }
+};
+
+esch_error
+esch_alloc_new_pool(esch_config* config, size_t cell_size,
+                    esch_alloc** alloc)
+{
+    esch_error ret = ESCH_OK;
+    esch_alloc* parent = NULL;
+    esch_log* log = NULL;
+    esch_object* new_obj = NULL;
+    esch_alloc_pool* new_alloc = NULL;
+
+    ESCH_CHECK_PARAM_PUBLIC(config != NULL);
+    ESCH_CHECK_PARAM_PUBLIC(alloc != NULL);
+    ESCH_CHECK_PARAM_PUBLIC(cell_size > 0);
+    ESCH_CHECK_PARAM_PUBLIC(ESCH_CONFIG_GET_ALLOC(config) != NULL);
+    ESCH_CHECK_PARAM_PUBLIC(ESCH_CONFIG_GET_LOG(config) != NULL);
+    parent = ESCH_CAST_FROM_OBJECT(ESCH_CONFIG_GET_ALLOC(config),
+                                   esch_alloc);
+    log = ESCH_CAST_FROM_OBJECT(ESCH_CONFIG_GET_LOG(config), esch_log);
+
+    /*
+     * Like other allocs, pool is never managed by GC, so it's not
+     * created by esch_object_new_i().
+     */
+    ret = esch_alloc_realloc(parent, NULL,
+                             sizeof(esch_object) + sizeof(esch_alloc_pool),
+                             (void**)&new_obj);
+    ESCH_CHECK(ret == ESCH_OK, log, "Can't create pool alloc", ret);
+    new_alloc = ESCH_CAST_FROM_OBJECT(new_obj, esch_alloc_pool);
+    new_alloc->base.realloc = esch_alloc_pool_realloc;
+    new_alloc->base.free = esch_alloc_pool_free;
+    new_alloc->parent = parent;
+    new_alloc->cell_size = ESCH_ALLOC_POOL_ROUND(cell_size);
+    new_alloc->chunk_cells = (ESCH_ALLOC_POOL_CHUNK_SIZE -
+                              ESCH_ALLOC_POOL_ALIGN) /
+                             new_alloc->cell_size;
+    if (new_alloc->chunk_cells == 0)
+    {
+        new_alloc->chunk_cells = 1;
+    }
+    new_alloc->chunks = NULL;
+    new_alloc->free_cells = NULL;
+    new_alloc->fresh = NULL;
+    new_alloc->fresh_end = NULL;
+    new_alloc->inuse = 0;
+
+    ESCH_OBJECT_GET_TYPE(new_obj) = &(esch_alloc_pool_type.type);
+    ESCH_OBJECT_GET_ALLOC(new_obj) = parent;
+    ESCH_OBJECT_GET_LOG(new_obj) = log;
+    ESCH_OBJECT_GET_GC(new_obj) = NULL; /* Alloc can't be managed! */
+    ESCH_OBJECT_GET_GC_ID(new_obj) = NULL;
+    ESCH_ASSERT(ESCH_IS_VALID_POOL_ALLOC(new_alloc));
+
+    (*alloc) = &(new_alloc->base);
+Exit:
+    return ret;
+}
+
+esch_error
+esch_alloc_new_pair_pool(esch_config* config, esch_alloc** alloc)
+{
+    return esch_alloc_new_pool(config,
+                               sizeof(esch_object) + sizeof(esch_pair),
+                               alloc);
+}
+
+static esch_error
+esch_alloc_pool_new_as_object(esch_config* config, esch_object** obj)
+{
+    /* Cell size is required. */
+    return ESCH_ERROR_NOT_SUPPORTED;
+}
+
+static esch_error
+esch_alloc_pool_grow_i(esch_alloc_pool* pool)
+{
+    esch_error ret = ESCH_OK;
+    esch_byte* chunk = NULL;
+
+    ret = esch_alloc_realloc(pool->parent, NULL,
+                             ESCH_ALLOC_POOL_ALIGN +
+                             pool->chunk_cells * pool->cell_size,
+                             (void**)&chunk);
+    if (ret != ESCH_OK)
+    {
+        return ret;
+    }
+    (*(void**)chunk) = pool->chunks;
+    pool->chunks = chunk;
+    pool->fresh = chunk + ESCH_ALLOC_POOL_ALIGN;
+    pool->fresh_end = pool->fresh + pool->chunk_cells * pool->cell_size;
+    return ESCH_OK;
+}
+
+static esch_error
+esch_alloc_pool_realloc(esch_alloc* alloc, void* in, size_t size,
+                        void** out)
+{
+    esch_error ret = ESCH_OK;
+    esch_alloc_pool* pool = (esch_alloc_pool*)alloc;
+    esch_log* log = NULL;
+    void* cell = NULL;
+
+    ESCH_CHECK_PARAM_INTERNAL(ESCH_IS_VALID_POOL_ALLOC(pool));
+    ESCH_CHECK_PARAM_INTERNAL(out != NULL);
+    log = ESCH_OBJECT_GET_LOG(ESCH_CAST_TO_OBJECT(alloc));
+    ESCH_CHECK_2(size <= pool->cell_size, log,
+                 "pool: Want %d bytes, cell has %d",
+                 (int)size, (int)pool->cell_size,
+                 ESCH_ERROR_INVALID_PARAMETER);
+    if (in != NULL)
+    {
+        /* Any size up to cell fits in place. */
+        (*out) = in;
+        goto Exit;
+    }
+    if (pool->free_cells != NULL)
+    {
+        cell = pool->free_cells;
+        pool->free_cells = (*(void**)cell);
+    }
+    else
+    {
+        if (pool->fresh == pool->fresh_end)
+        {
+            ret = esch_alloc_pool_grow_i(pool);
+            ESCH_CHECK(ret == ESCH_OK, log, "pool: Can't grow", ret);
+        }
+        cell = pool->fresh;
+        pool->fresh += pool->cell_size;
+    }
+    /* Same as esch_alloc_c_default, new buffer is zeroed. */
+    memset(cell, 0, pool->cell_size);
+    pool->inuse += 1;
+    (*out) = cell;
+Exit:
+    return ret;
+}
+
+esch_error
+esch_alloc_pool_new_run_i(esch_alloc* alloc, size_t count,
+                          void** cells, size_t* got)
+{
+    esch_error ret = ESCH_OK;
+    esch_alloc_pool* pool = (esch_alloc_pool*)alloc;
+    esch_log* log = NULL;
+    size_t fresh_cells = 0;
+
+    ESCH_CHECK_PARAM_INTERNAL(ESCH_IS_VALID_POOL_ALLOC(pool));
+    ESCH_CHECK_PARAM_INTERNAL(count > 0);
+    ESCH_CHECK_PARAM_INTERNAL(cells != NULL);
+    ESCH_CHECK_PARAM_INTERNAL(got != NULL);
+    log = ESCH_OBJECT_GET_LOG(ESCH_CAST_TO_OBJECT(alloc));
+    if (pool->fresh == pool->fresh_end && pool->free_cells != NULL)
+    {
+        /* Don't grow while free cells are left, or pool keeps growing
+         * when lists are built and dropped again and again. */
+        ret = esch_alloc_pool_realloc(alloc, NULL, pool->cell_size,
+                                      cells);
+        (*got) = (ret == ESCH_OK? 1: 0);
+        goto Exit;
+    }
+    if (pool->fresh == pool->fresh_end)
+    {
+        ret = esch_alloc_pool_grow_i(pool);
+        ESCH_CHECK(ret == ESCH_OK, log, "pool: Can't grow", ret);
+    }
+    fresh_cells = (size_t)(pool->fresh_end - pool->fresh) /
+                  pool->cell_size;
+    if (count > fresh_cells)
+    {
+        count = fresh_cells;
+    }
+    memset(pool->fresh, 0, count * pool->cell_size);
+    (*cells) = pool->fresh;
+    (*got) = count;
+    pool->fresh += count * pool->cell_size;
+    pool->inuse += count;
+Exit:
+    return ret;
+}
+
+static esch_error
+esch_alloc_pool_free(esch_alloc* alloc, void* ptr)
+{
+    esch_alloc_pool* pool = (esch_alloc_pool*)alloc;
+
+    ESCH_CHECK_PARAM_INTERNAL(ESCH_IS_VALID_POOL_ALLOC(pool));
+    if (ptr != NULL)
+    {
+        ESCH_ASSERT(pool->inuse > 0);
+        (*(void**)ptr) = pool->free_cells;
+        pool->free_cells = ptr;
+        pool->inuse -= 1;
+    }
+    return ESCH_OK;
+}
+
+static esch_error
+esch_alloc_pool_destructor(esch_object* obj)
+{
+    esch_error ret = ESCH_OK;
+    esch_alloc_pool* pool = NULL;
+    esch_log* log = NULL;
+    void* chunk = NULL;
+
+    pool = ESCH_CAST_FROM_OBJECT(obj, esch_alloc_pool);
+    ESCH_CHECK_PARAM_PUBLIC(ESCH_IS_VALID_POOL_ALLOC(pool));
+    log = ESCH_OBJECT_GET_LOG(obj);
+    while (pool->chunks != NULL)
+    {
+        chunk = pool->chunks;
+        pool->chunks = (*(void**)chunk);
+        (void)esch_alloc_free(pool->parent, chunk);
+    }
+    pool->free_cells = NULL;
+    pool->fresh = NULL;
+    pool->fresh_end = NULL;
+    ESCH_CHECK_1(pool->inuse == 0, log,
+                 "Memory leak detected. Cells in use = %d",
+                 (int)pool->inuse, ESCH_ERROR_INVALID_STATE);
+Exit:
+    return ret;
+}
@@ -0,0 +1,641 @@
+/* vim:ft=c expandtab tw=72 sw=4
+ */
+/* See Copyright notice in esch.h */
+#include <string.h>
+#include <assert.h>
+#include "esch_number.h"
+
+/*
+ * Limb operations of big integers. They work on raw limb arrays and
+ * never allocate memory: callers pass scratch buffers, so objects in
+ * esch_number.c decide where memory comes from.
+ */
+
+#if ESCH_BIGNUM_KARATSUBA_THRESHOLD < 4
+#    error "ESCH_BIGNUM_KARATSUBA_THRESHOLD must be at least 4"
+#endif
+
+static int
+esch_bignum_clz(esch_limb x)
+{
+#if defined(__GNUC__)
+    return __builtin_clz(x);
+#else
+    int n = 0;
+    assert(x != 0);
+    while ((x & 0x80000000) == 0)
+    {
+        x <<= 1;
+        ++n;
+    }
+    return n;
+#endif
+}
+
+size_t
+esch_bignum_normalize_i(const esch_limb* a, size_t an)
+{
+    while (an > 0 && a[an - 1] == 0)
+    {
+        --an;
+    }
+    return an;
+}
+
+int
+esch_bignum_compare_i(const esch_limb* a, size_t an,
+                      const esch_limb* b, size_t bn)
+{
+    if (an != bn)
+    {
+        return (an < bn? -1: 1);
+    }
+    while (an > 0)
+    {
+        --an;
+        if (a[an] != b[an])
+        {
+            return (a[an] < b[an]? -1: 1);
+        }
+    }
+    return 0;
+}
+
+esch_limb
+esch_bignum_add_i(esch_limb* r, const esch_limb* a, size_t an,
+                  const esch_limb* b, size_t bn)
+{
+    esch_dlimb sum = 0;
+    size_t i = 0;
+    assert(an >= bn);
+    for (i = 0; i < bn; ++i)
+    {
+        sum += (esch_dlimb)a[i] + b[i];
+        r[i] = (esch_limb)sum;
+        sum >>= ESCH_LIMB_BITS;
+    }
+    for (; i < an; ++i)
+    {
+        sum += a[i];
+        r[i] = (esch_limb)sum;
+        sum >>= ESCH_LIMB_BITS;
+    }
+    return (esch_limb)sum;
+}
+
+esch_limb
+esch_bignum_sub_i(esch_limb* r, const esch_limb* a, size_t an,
+                  const esch_limb* b, size_t bn)
+{
+    esch_limb borrow = 0;
+    esch_limb x = 0;
+    esch_limb y = 0;
+    size_t i = 0;
+    assert(an >= bn);
+    for (i = 0; i < bn; ++i)
+    {
+        /* r may be a: read both limbs before writing. */
+        x = a[i];
+        y = b[i];
+        r[i] = x - y - borrow;
+        borrow = (x < y) | (x - y < borrow);
+    }
+    for (; i < an; ++i)
+    {
+        x = a[i];
+        r[i] = x - borrow;
+        borrow = (x < borrow);
+    }
+    return borrow;
+}
+
+esch_limb
+esch_bignum_mul_1_i(esch_limb* r, const esch_limb* a,
+                    size_t n, esch_limb m, esch_limb carry)
+{
+    esch_dlimb product = carry;
+    size_t i = 0;
+    for (i = 0; i < n; ++i)
+    {
+        product += (esch_dlimb)a[i] * m;
+        r[i] = (esch_limb)product;
+        product >>= ESCH_LIMB_BITS;
+    }
+    return (esch_limb)product;
+}
+
+/* r = r + a * m. Return carry out. */
+static esch_limb
+esch_bignum_addmul_1(esch_limb* r, const esch_limb* a,
+                     size_t n, esch_limb m)
+{
+    esch_dlimb product = 0;
+    size_t i = 0;
+    for (i = 0; i < n; ++i)
+    {
+        product += (esch_dlimb)a[i] * m + r[i];
+        r[i] = (esch_limb)product;
+        product >>= ESCH_LIMB_BITS;
+    }
+    return (esch_limb)product;
+}
+
+esch_limb
+esch_bignum_divmod_1_i(esch_limb* q, const esch_limb* a,
+                       size_t n, esch_limb d)
+{
+    esch_dlimb rem = 0;
+    assert(d != 0);
+    while (n > 0)
+    {
+        --n;
+        rem = (rem << ESCH_LIMB_BITS) | a[n];
+        q[n] = (esch_limb)(rem / d);
+        rem = rem % d;
+    }
+    return (esch_limb)rem;
+}
+
+/* Schoolbook multiplication. Zero limbs on top are allowed. */
+static void
+esch_bignum_mul_basecase(esch_limb* r, const esch_limb* a, size_t an,
+                         const esch_limb* b, size_t bn)
+{
+    size_t j = 0;
+    r[an] = esch_bignum_mul_1_i(r, a, an, b[0], 0);
+    for (j = 1; j < bn; ++j)
+    {
+        r[an + j] = esch_bignum_addmul_1(r + j, a, an, b[j]);
+    }
+}
+
+static size_t
+esch_bignum_karatsuba_scratch(size_t n)
+{
+    size_t total = 0;
+    size_t hi = 0;
+    while (n >= ESCH_BIGNUM_KARATSUBA_THRESHOLD)
+    {
+        hi = n - n / 2;
+        total += 4 * (hi + 1);
+        n = hi + 1;
+    }
+    return total;
+}
+
+/*
+ * r = a * b, both have n limbs, and r has 2n limbs. Split into low
+ * and high halves, then a * b = z2 * B^2 + z1 * B + z0, where
+ * z1 = (a0 + a1) * (b0 + b1) - z0 - z2. Three multiplications of half
+ * size instead of four.
+ */
+static void
+esch_bignum_karatsuba(esch_limb* r, const esch_limb* a,
+                      const esch_limb* b, size_t n, esch_limb* scratch)
+{
+    size_t lo = 0;
+    size_t hi = 0;
+    size_t z1_len = 0;
+    esch_limb* sa = NULL;
+    esch_limb* sb = NULL;
+    esch_limb* z1 = NULL;
+    esch_limb carry = 0;
+
+    if (n < ESCH_BIGNUM_KARATSUBA_THRESHOLD)
+    {
+        esch_bignum_mul_basecase(r, a, n, b, n);
+        return;
+    }
+    lo = n / 2;
+    hi = n - lo;
+    /* z0 and z2 go to their final place in r. */
+    esch_bignum_karatsuba(r, a, b, lo, scratch);
+    esch_bignum_karatsuba(r + 2 * lo, a + lo, b + lo, hi, scratch);
+
+    sa = scratch;
+    sb = sa + hi + 1;
+    z1 = sb + hi + 1;
+    sa[hi] = esch_bignum_add_i(sa, a + lo, hi, a, lo);
+    sb[hi] = esch_bignum_add_i(sb, b + lo, hi, b, lo);
+    esch_bignum_karatsuba(z1, sa, sb, hi + 1, z1 + 2 * (hi + 1));
+    z1_len = 2 * (hi + 1);
+    (void)esch_bignum_sub_i(z1, z1, z1_len, r, 2 * lo);
+    (void)esch_bignum_sub_i(z1, z1, z1_len, r + 2 * lo, 2 * hi);
+    /* z1 < 2 * B^n, so it always fits in r. */
+    z1_len = esch_bignum_normalize_i(z1, z1_len);
+    carry = esch_bignum_add_i(r + lo, r + lo, lo + 2 * hi, z1, z1_len);
+    assert(carry == 0);
+    (void)carry;
+}
+
+size_t
+esch_bignum_mul_scratch_i(size_t an, size_t bn)
+{
+    size_t rest = 0;
+    size_t inner = 0;
+    assert(an >= bn);
+    if (bn < ESCH_BIGNUM_KARATSUBA_THRESHOLD)
+    {
+        return 0;
+    }
+    if (an == bn)
+    {
+        return esch_bignum_karatsuba_scratch(bn);
+    }
+    rest = an % bn;
+    inner = esch_bignum_karatsuba_scratch(bn);
+    if (rest > 0 && esch_bignum_mul_scratch_i(bn, rest) > inner)
+    {
+        inner = esch_bignum_mul_scratch_i(bn, rest);
+    }
+    return 2 * bn + inner;
+}
+
+void
+esch_bignum_mul_i(esch_limb* r, const esch_limb* a, size_t an,
+                  const esch_limb* b, size_t bn, esch_limb* scratch)
+{
+    esch_limb* tmp = NULL;
+    size_t offset = 0;
+    size_t rest = 0;
+    esch_limb carry = 0;
+
+    assert(an >= bn && bn > 0);
+    if (bn < ESCH_BIGNUM_KARATSUBA_THRESHOLD)
+    {
+        esch_bignum_mul_basecase(r, a, an, b, bn);
+        return;
+    }
+    if (an == bn)
+    {
+        esch_bignum_karatsuba(r, a, b, an, scratch);
+        return;
+    }
+    /* Unbalanced: multiply b with each bn-limb chunk of a. */
+    tmp = scratch;
+    memset(r, 0, sizeof(esch_limb) * (an + bn));
+    for (offset = 0; offset + bn <= an; offset += bn)
+    {
+        esch_bignum_karatsuba(tmp, a + offset, b, bn, scratch + 2 * bn);
+        carry = esch_bignum_add_i(r + offset, r + offset,
+                                  an + bn - offset, tmp, 2 * bn);
+        assert(carry == 0);
+    }
+    rest = an - offset;
+    if (rest > 0)
+    {
+        esch_bignum_mul_i(tmp, b, bn, a + offset, rest, scratch + 2 * bn);
+        carry = esch_bignum_add_i(r + offset, r + offset,
+                                  an + bn - offset, tmp, bn + rest);
+        assert(carry == 0);
+    }
+    (void)carry;
+}
+
+/*
+ * Knuth's Algorithm D (TAOCP vol. 2, 4.3.1). Divisor is shifted so
+ * its top bit is set, then each quotient limb is estimated from top
+ * two limbs of remainder, and corrected at most twice.
+ */
+void
+esch_bignum_divmod_i(esch_limb* q, esch_limb* r,
+                     const esch_limb* a, size_t an,
+                     const esch_limb* b, size_t bn,
+                     esch_limb* scratch)
+{
+    esch_limb* un = scratch;
+    esch_limb* vn = scratch + an + 1;
+    esch_dlimb base = (esch_dlimb)1 << ESCH_LIMB_BITS;
+    esch_dlimb num = 0;
+    esch_dlimb qhat = 0;
+    esch_dlimb rhat = 0;
+    esch_dlimb product = 0;
+    esch_limb carry = 0;
+    esch_limb borrow = 0;
+    esch_limb x = 0;
+    esch_limb low = 0;
+    int shift = 0;
+    size_t i = 0;
+    size_t j = 0;
+
+    assert(an >= bn && bn >= 2 && b[bn - 1] != 0);
+    shift = esch_bignum_clz(b[bn - 1]);
+    if (shift > 0)
+    {
+        for (i = bn - 1; i > 0; --i)
+        {
+            vn[i] = (b[i] << shift) | (b[i - 1] >> (ESCH_LIMB_BITS - shift));
+        }
+        vn[0] = b[0] << shift;
+        un[an] = a[an - 1] >> (ESCH_LIMB_BITS - shift);
+        for (i = an - 1; i > 0; --i)
+        {
+            un[i] = (a[i] << shift) | (a[i - 1] >> (ESCH_LIMB_BITS - shift));
+        }
+        un[0] = a[0] << shift;
+    }
+    else
+    {
+        memcpy(vn, b, sizeof(esch_limb) * bn);
+        memcpy(un, a, sizeof(esch_limb) * an);
+        un[an] = 0;
+    }
+
+    j = an - bn + 1;
+    while (j > 0)
+    {
+        --j;
+        num = ((esch_dlimb)un[j + bn] << ESCH_LIMB_BITS) | un[j + bn - 1];
+        qhat = num / vn[bn - 1];
+        rhat = num % vn[bn - 1];
+        while (qhat >= base ||
+               qhat * vn[bn - 2] > ((rhat << ESCH_LIMB_BITS) |
+                                    un[j + bn - 2]))
+        {
+            --qhat;
+            rhat += vn[bn - 1];
+            if (rhat >= base)
+            {
+                break;
+            }
+        }
+        /* Multiply and subtract. */
+        carry = 0;
+        borrow = 0;
+        for (i = 0; i < bn; ++i)
+        {
+            product = qhat * vn[i] + carry;
+            carry = (esch_limb)(product >> ESCH_LIMB_BITS);
+            low = (esch_limb)product;
+            x = un[i + j];
+            un[i + j] = x - low - borrow;
+            borrow = (x < low || x - low < borrow)? 1: 0;
+        }
+        x = un[j + bn];
+        un[j + bn] = x - carry - borrow;
+        if ((esch_dlimb)x < (esch_dlimb)carry + borrow)
+        {
+            /* Estimate was one too large: add back. */
+            --qhat;
+            product = 0;
+            for (i = 0; i < bn; ++i)
+            {
+                product += (esch_dlimb)un[i + j] + vn[i];
+                un[i + j] = (esch_limb)product;
+                product >>= ESCH_LIMB_BITS;
+            }
+            un[j + bn] += (esch_limb)product;
+        }
+        if (q != NULL)
+        {
+            q[j] = (esch_limb)qhat;
+        }
+    }
+    if (r != NULL)
+    {
+        if (shift > 0)
+        {
+            for (i = 0; i < bn - 1; ++i)
+            {
+                r[i] = (un[i] >> shift) |
+                       (un[i + 1] << (ESCH_LIMB_BITS - shift));
+            }
+            r[bn - 1] = un[bn - 1] >> shift;
+        }
+        else
+        {
+            memcpy(r, un, sizeof(esch_limb) * bn);
+        }
+    }
+}
+
+static int
+esch_bignum_ctz_64(uint64_t x)
+{
+#if defined(__GNUC__)
+    return __builtin_ctzll(x);
+#else
+    int n = 0;
+    assert(x != 0);
+    while ((x & 1) == 0)
+    {
+        x >>= 1;
+        ++n;
+    }
+    return n;
+#endif
+}
+
+uint64_t
+esch_bignum_gcd_64_i(uint64_t a, uint64_t b)
+{
+    int shift = 0;
+    uint64_t tmp = 0;
+
+    if (a == 0 || b == 0)
+    {
+        return a | b;
+    }
+    /* Binary gcd: common factors of 2 first, then only odd numbers. */
+    shift = esch_bignum_ctz_64(a | b);
+    a >>= esch_bignum_ctz_64(a);
+    do
+    {
+        b >>= esch_bignum_ctz_64(b);
+        if (a > b)
+        {
+            tmp = a;
+            a = b;
+            b = tmp;
+        }
+        b -= a;
+    } while (b != 0);
+    return a << shift;
+}
+
+/* 31 bits of a at bit position pos. Limbs above an are zero. */
+static int64_t
+esch_bignum_bits_31(const esch_limb* a, size_t an, size_t pos)
+{
+    size_t i = pos / ESCH_LIMB_BITS;
+    esch_dlimb window = 0;
+
+    if (i < an)
+    {
+        window = a[i];
+    }
+    if (i + 1 < an)
+    {
+        window |= (esch_dlimb)a[i + 1] << ESCH_LIMB_BITS;
+    }
+    return (int64_t)((window >> (pos % ESCH_LIMB_BITS)) & 0x7FFFFFFF);
+}
+
+/*
+ * r = x * a + y * b, where a and b are below 2^31 in magnitude, have
+ * opposite signs, and result is known to be non-negative. r has xn
+ * limbs, xn >= yn. Return length of r.
+ */
+static size_t
+esch_bignum_combine(esch_limb* r, const esch_limb* x, size_t xn,
+                    const esch_limb* y, size_t yn, int64_t a, int64_t b)
+{
+    int64_t carry = 0;
+    int64_t t = 0;
+    size_t i = 0;
+
+    for (i = 0; i < xn; ++i)
+    {
+        t = a * (int64_t)x[i] + carry;
+        if (i < yn)
+        {
+            t += b * (int64_t)y[i];
+        }
+        r[i] = (esch_limb)t;
+        /* Exact division: no rounding issue for negative t. */
+        carry = (t - (int64_t)(esch_limb)t) /
+                ((int64_t)1 << ESCH_LIMB_BITS);
+    }
+    assert(carry == 0);
+    return esch_bignum_normalize_i(r, xn);
+}
+
+size_t
+esch_bignum_gcd_i(esch_limb* r, const esch_limb* a, size_t an,
+                  const esch_limb* b, size_t bn, esch_limb* scratch)
+{
+    esch_limb* u = scratch;
+    esch_limb* v = scratch + (an + 1);
+    esch_limb* t = scratch + 2 * (an + 1);
+    esch_limb* w = scratch + 3 * (an + 1);
+    esch_limb* div_scratch = scratch + 4 * (an + 1);
+    esch_limb* tmp = NULL;
+    size_t un = an;
+    size_t vn = bn;
+    size_t tn = 0;
+    size_t pos = 0;
+    int64_t uh = 0;
+    int64_t vh = 0;
+    int64_t q = 0;
+    int64_t ca = 0;
+    int64_t cb = 0;
+    int64_t cc = 0;
+    int64_t cd = 0;
+    int64_t next = 0;
+    uint64_t u64 = 0;
+    uint64_t v64 = 0;
+
+    if (esch_bignum_compare_i(a, an, b, bn) < 0)
+    {
+        /* Same length: swap, so u >= v. */
+        memcpy(u, b, sizeof(esch_limb) * bn);
+        memcpy(v, a, sizeof(esch_limb) * an);
+    }
+    else
+    {
+        memcpy(u, a, sizeof(esch_limb) * an);
+        memcpy(v, b, sizeof(esch_limb) * bn);
+    }
+    while (vn > 2)
+    {
+        /*
+         * Lehmer: run Euclid on leading 31 bits of u and v only, and
+         * keep the cofactors while quotients are sure to be right. Then
+         * apply all steps to u and v at once, in linear time.
+         */
+        pos = (un - 1) * ESCH_LIMB_BITS +
+              (ESCH_LIMB_BITS - esch_bignum_clz(u[un - 1])) - 31;
+        uh = esch_bignum_bits_31(u, un, pos);
+        vh = esch_bignum_bits_31(v, vn, pos);
+        ca = 1;
+        cb = 0;
+        cc = 0;
+        cd = 1;
+        while (vh + cc != 0 && vh + cd != 0)
+        {
+            q = (uh + ca) / (vh + cc);
+            if (q != (uh + cb) / (vh + cd))
+            {
+                break;
+            }
+            next = ca - q * cc;
+            ca = cc;
+            cc = next;
+            next = cb - q * cd;
+            cb = cd;
+            cd = next;
+            next = uh - q * vh;
+            uh = vh;
+            vh = next;
+        }
+        if (cb == 0)
+        {
+            /* No step is sure, or v is much smaller: divide. */
+            if (vn == 1)
+            {
+                t[0] = esch_bignum_divmod_1_i(w, u, un, v[0]);
+            }
+            else
+            {
+                esch_bignum_divmod_i(NULL, t, u, un, v, vn, div_scratch);
+            }
+            tn = esch_bignum_normalize_i(t, vn);
+            tmp = u;
+            u = v;
+            un = vn;
+            v = t;
+            vn = tn;
+            t = tmp;
+        }
+        else
+        {
+            tn = esch_bignum_combine(t, u, un, v, vn, ca, cb);
+            vn = esch_bignum_combine(w, u, un, v, vn, cc, cd);
+            tmp = u;
+            u = t;
+            un = tn;
+            t = tmp;
+            tmp = v;
+            v = w;
+            w = tmp;
+        }
+    }
+    if (vn == 0)
+    {
+        memcpy(r, u, sizeof(esch_limb) * un);
+        return un;
+    }
+    if (un > 2)
+    {
+        if (vn == 1)
+        {
+            t[0] = esch_bignum_divmod_1_i(w, u, un, v[0]);
+        }
+        else
+        {
+            esch_bignum_divmod_i(NULL, t, u, un, v, vn, div_scratch);
+        }
+        un = esch_bignum_normalize_i(t, vn);
+        tmp = u;
+        u = t;
+        t = tmp;
+    }
+    u64 = (un > 0? u[0]: 0);
+    if (un > 1)
+    {
+        u64 |= (uint64_t)u[1] << ESCH_LIMB_BITS;
+    }
+    v64 = v[0];
+    if (vn > 1)
+    {
+        v64 |= (uint64_t)v[1] << ESCH_LIMB_BITS;
+    }
+    u64 = esch_bignum_gcd_64_i(u64, v64);
+    r[0] = (esch_limb)u64;
+    if ((u64 >> ESCH_LIMB_BITS) == 0)
+    {
+        return 1;
+    }
+    r[1] = (esch_limb)(u64 >> ESCH_LIMB_BITS);
+    return 2;
+}
@@ -11,12 +11,55 @@ const char* ESCH_CONFIG_KEY_LOG = "common:log";
 const char* ESCH_CONFIG_KEY_GC = "common:gc";
 const char* ESCH_CONFIG_KEY_VECTOR_LENGTH = "vector:length";
 const char* ESCH_CONFIG_KEY_VECTOR_ENLARGE = "vector:enlarge";
+const char* ESCH_CONFIG_KEY_VECTOR_SORT_THREADS = "vector:sort_threads";
+const char* ESCH_CONFIG_KEY_VECTOR_LAYOUT = "vector:layout";
 const char* ESCH_CONFIG_KEY_GC_NAIVE_SLOTS = "gc:naive:slots";
 const char* ESCH_CONFIG_KEY_GC_NAIVE_ROOT = "gc:naive:root";
 const char* ESCH_CONFIG_KEY_GC_NAIVE_ENLARGE = "gc:naive:enlarge";
+const char* ESCH_CONFIG_KEY_LOG_ASYNC_SLOTS = "log:async:slots";
+const char* ESCH_CONFIG_KEY_LOG_ASYNC_FD = "log:async:fd";
+const char* ESCH_CONFIG_KEY_PAIR_ALLOC = "pair:alloc";
 
 static esch_error esch_config_destructor(esch_object* obj);
 static esch_error esch_config_new_as_object(esch_config*, esch_object** obj);
+static uint32_t esch_config_hash_i(const char* key);
+static size_t esch_config_find_i(esch_config* config, const char* key,
+                                 uint32_t hash);
+static esch_error esch_config_grow_i(esch_config* config);
+static esch_error esch_config_add_key_i(esch_config* config,
+                                        const char* key,
+                                        esch_config_value_type type,
+                                        esch_config_key_id* id);
+static esch_error esch_config_get_entry_i(esch_config* config,
+                                          esch_config_key_id id,
+                                          esch_config_value_type type,
+                                          struct esch_config_entry** entry);
+static esch_error esch_config_get_key_entry_i(esch_config* config,
+                                          const char* key,
+                                          esch_config_value_type type,
+                                          struct esch_config_entry** entry);
+
+/* Predefined keys, in order of esch_config_key_id. */
+static const struct
+{
+    const char** key;
+    esch_config_value_type type;
+} esch_config_predefined[ESCH_CONFIG_KEY_ID_PREDEFINED] =
+{
+    { &ESCH_CONFIG_KEY_ALLOC, ESCH_CONFIG_VALUE_TYPE_OBJECT },
+    { &ESCH_CONFIG_KEY_LOG, ESCH_CONFIG_VALUE_TYPE_OBJECT },
+    { &ESCH_CONFIG_KEY_GC, ESCH_CONFIG_VALUE_TYPE_OBJECT },
+    { &ESCH_CONFIG_KEY_VECTOR_LENGTH, ESCH_CONFIG_VALUE_TYPE_INTEGER },
+    { &ESCH_CONFIG_KEY_VECTOR_ENLARGE, ESCH_CONFIG_VALUE_TYPE_INTEGER },
+    { &ESCH_CONFIG_KEY_GC_NAIVE_SLOTS, ESCH_CONFIG_VALUE_TYPE_INTEGER },
+    { &ESCH_CONFIG_KEY_GC_NAIVE_ROOT, ESCH_CONFIG_VALUE_TYPE_OBJECT },
+    { &ESCH_CONFIG_KEY_GC_NAIVE_ENLARGE, ESCH_CONFIG_VALUE_TYPE_INTEGER },
+    { &ESCH_CONFIG_KEY_VECTOR_SORT_THREADS, ESCH_CONFIG_VALUE_TYPE_INTEGER },
+    { &ESCH_CONFIG_KEY_VECTOR_LAYOUT, ESCH_CONFIG_VALUE_TYPE_INTEGER },
+    { &ESCH_CONFIG_KEY_LOG_ASYNC_SLOTS, ESCH_CONFIG_VALUE_TYPE_INTEGER },
+    { &ESCH_CONFIG_KEY_LOG_ASYNC_FD, ESCH_CONFIG_VALUE_TYPE_INTEGER },
+    { &ESCH_CONFIG_KEY_PAIR_ALLOC, ESCH_CONFIG_VALUE_TYPE_OBJECT },
+};
 
 struct esch_builtin_type esch_config_type =
 {
@@ -50,7 +93,9 @@ esch_config_new(esch_log* log, esch_alloc* alloc, esch_config** config)
     esch_error ret = ESCH_OK;
     esch_object* new_obj = NULL;
     esch_config* new_config = NULL;
+    esch_config_key_id id = ESCH_CONFIG_KEY_ID_ALLOC;
     size_t size = 0;
+    size_t i = 0;
     ESCH_CHECK_PARAM_PUBLIC(log != NULL);
     ESCH_CHECK_PARAM_PUBLIC(alloc != NULL);
     ESCH_CHECK_PARAM_PUBLIC(config != NULL);
@@ -66,50 +111,45 @@ esch_config_new(esch_log* log, esch_alloc* alloc, esch_config** config)
     ESCH_OBJECT_GET_LOG(new_obj)     = log;
     ESCH_OBJECT_GET_GC(new_obj)      = NULL;
     ESCH_OBJECT_GET_GC_ID(new_obj)   = NULL; /* Can't get managed. */
+    new_config->entries = NULL;
+    new_config->count = 0;
+    new_config->capacity = 0;
+    new_config->index = NULL;
+    new_config->slots = 0;
+    ret = esch_config_grow_i(new_config);
+    ESCH_CHECK(ret == ESCH_OK, log, "Can't create config entries", ret);
 
     /* Fill preset keys */
-    strncpy(new_config->config[0].key,
-            ESCH_CONFIG_KEY_ALLOC, ESCH_CONFIG_KEY_LENGTH);
-    new_config->config[0].type = ESCH_CONFIG_VALUE_TYPE_OBJECT;
-
-    strncpy(new_config->config[1].key,
-            ESCH_CONFIG_KEY_LOG, ESCH_CONFIG_KEY_LENGTH);
-    new_config->config[1].type = ESCH_CONFIG_VALUE_TYPE_OBJECT;
-
-    strncpy(new_config->config[2].key,
-            ESCH_CONFIG_KEY_GC, ESCH_CONFIG_KEY_LENGTH);
-    new_config->config[2].type = ESCH_CONFIG_VALUE_TYPE_OBJECT;
-
-    strncpy(new_config->config[3].key,
-            ESCH_CONFIG_KEY_VECTOR_LENGTH, ESCH_CONFIG_KEY_LENGTH);
-    new_config->config[3].type = ESCH_CONFIG_VALUE_TYPE_INTEGER;
-    new_config->config[3].data.int_value = 1;
-
-    strncpy(new_config->config[4].key,
-            ESCH_CONFIG_KEY_VECTOR_ENLARGE, ESCH_CONFIG_KEY_LENGTH);
-    new_config->config[4].type = ESCH_CONFIG_VALUE_TYPE_INTEGER;
-    new_config->config[4].data.int_value = ESCH_FALSE;
-
-    strncpy(new_config->config[5].key,
-            ESCH_CONFIG_KEY_GC_NAIVE_SLOTS, ESCH_CONFIG_KEY_LENGTH);
-    new_config->config[5].type = ESCH_CONFIG_VALUE_TYPE_INTEGER;
-    new_config->config[5].data.int_value = ESCH_GC_NAIVE_DEFAULT_SLOTS;
-
-    strncpy(new_config->config[6].key,
-            ESCH_CONFIG_KEY_GC_NAIVE_ROOT, ESCH_CONFIG_KEY_LENGTH);
-    new_config->config[6].type = ESCH_CONFIG_VALUE_TYPE_OBJECT;
-    new_config->config[6].data.obj_value = NULL;
-
-    strncpy(new_config->config[7].key,
-            ESCH_CONFIG_KEY_GC_NAIVE_ENLARGE, ESCH_CONFIG_KEY_LENGTH);
-    new_config->config[7].type = ESCH_CONFIG_VALUE_TYPE_INTEGER;
-    new_config->config[7].data.int_value = ESCH_FALSE;
+    for (i = 0; i < ESCH_CONFIG_KEY_ID_PREDEFINED; ++i)
+    {
+        ret = esch_config_add_key_i(new_config,
+                                    *(esch_config_predefined[i].key),
+                                    esch_config_predefined[i].type, &id);
+        ESCH_CHECK(ret == ESCH_OK, log, "Can't add preset key", ret);
+        ESCH_ASSERT((size_t)id == i);
+    }
+    new_config->entries[ESCH_CONFIG_KEY_ID_VECTOR_LENGTH].data.int_value = 1;
+    new_config->entries[ESCH_CONFIG_KEY_ID_VECTOR_ENLARGE].data.int_value =
+        ESCH_FALSE;
+    new_config->entries[ESCH_CONFIG_KEY_ID_GC_NAIVE_SLOTS].data.int_value =
+        ESCH_GC_NAIVE_DEFAULT_SLOTS;
+    new_config->entries[ESCH_CONFIG_KEY_ID_GC_NAIVE_ENLARGE].data.int_value =
+        ESCH_FALSE;
+    new_config->entries[ESCH_CONFIG_KEY_ID_VECTOR_SORT_THREADS]
+        .data.int_value = 1;
+    new_config->entries[ESCH_CONFIG_KEY_ID_VECTOR_LAYOUT].data.int_value =
+        ESCH_VECTOR_LAYOUT_MIXED;
+    new_config->entries[ESCH_CONFIG_KEY_ID_LOG_ASYNC_SLOTS].data.int_value =
+        ESCH_LOG_ASYNC_DEFAULT_SLOTS;
+    new_config->entries[ESCH_CONFIG_KEY_ID_LOG_ASYNC_FD].data.int_value = 1;
 
     (*config) = new_config;
     new_config = NULL;
 Exit:
     if (new_config != NULL)
     {
+        esch_alloc_free(alloc, new_config->entries);
+        esch_alloc_free(alloc, new_config->index);
         (void)esch_alloc_free(alloc, (void*)new_obj);
     }
     return ret;
@@ -126,21 +166,16 @@ esch_error
 esch_config_get_int(esch_config* config, const char* key, int* value)
 {
     esch_error ret = ESCH_OK;
-    size_t i = 0;
+    struct esch_config_entry* entry = NULL;
     ESCH_CHECK_PARAM_PUBLIC(config != NULL);
     ESCH_CHECK_PARAM_PUBLIC(key != NULL);
     ESCH_CHECK_PARAM_PUBLIC(value != NULL);
 
-    ret = ESCH_ERROR_NOT_FOUND;
-    for (i = 0; i < ESCH_CONFIG_ITEMS; ++i)
+    ret = esch_config_get_key_entry_i(config, key,
+                                      ESCH_CONFIG_VALUE_TYPE_INTEGER, &entry);
+    if (ret == ESCH_OK)
     {
-        if (strcmp(config->config[i].key, key) == 0
-                && config->config[i].type == ESCH_CONFIG_VALUE_TYPE_INTEGER)
-        {
-            (*value) = config->config[i].data.int_value;
-            ret = ESCH_OK;
-            break;
-        }
+        (*value) = entry->data.int_value;
     }
 Exit:
     return ret;
@@ -157,19 +192,14 @@ esch_error
 esch_config_set_int(esch_config* config, const char* key, int value)
 {
     esch_error ret = ESCH_OK;
-    size_t i = 0;
+    struct esch_config_entry* entry = NULL;
     ESCH_CHECK_PARAM_PUBLIC(config != NULL);
     ESCH_CHECK_PARAM_PUBLIC(key != NULL);
-    ret = ESCH_ERROR_NOT_FOUND;
-    for (i = 0; i < ESCH_CONFIG_ITEMS; ++i)
+    ret = esch_config_get_key_entry_i(config, key,
+                                      ESCH_CONFIG_VALUE_TYPE_INTEGER, &entry);
+    if (ret == ESCH_OK)
     {
-        if (strcmp(config->config[i].key, key) == 0
-                && config->config[i].type == ESCH_CONFIG_VALUE_TYPE_INTEGER)
-        {
-            config->config[i].data.int_value = value;
-            ret = ESCH_OK;
-            break;
-        }
+        entry->data.int_value = value;
     }
 Exit:
     return ret;
@@ -185,28 +215,23 @@ esch_error
 esch_config_get_str(esch_config* config, const char* key, char** value)
 {
     esch_error ret = ESCH_OK;
-    size_t i = 0;
+    struct esch_config_entry* entry = NULL;
     ESCH_CHECK_PARAM_PUBLIC(config != NULL);
     ESCH_CHECK_PARAM_PUBLIC(key != NULL);
     ESCH_CHECK_PARAM_PUBLIC(value != NULL);
 
-    ret = ESCH_ERROR_NOT_FOUND;
-    for (i = 0; i < ESCH_CONFIG_ITEMS; ++i)
+    ret = esch_config_get_key_entry_i(config, key,
+                                      ESCH_CONFIG_VALUE_TYPE_STRING, &entry);
+    if (ret == ESCH_OK)
     {
-        if (strcmp(config->config[i].key, key) == 0
-                && config->config[i].type == ESCH_CONFIG_VALUE_TYPE_STRING)
-        {
-            (*value) = config->config[i].data.str_value;
-            ret = ESCH_OK;
-            break;
-        }
+        (*value) = entry->data.str_value;
     }
 Exit:
     return ret;
 }
 
 /**
- * Set a new string to given key.
+ * Set a new string to given key. Config keeps a copy of string.
  * @param config Given config object.
  * @param key String key.
  * @param obj New string. Can be NULL.
@@ -216,21 +241,14 @@ esch_error
 esch_config_set_str(esch_config* config, const char* key, char* value)
 {
     esch_error ret = ESCH_OK;
-    size_t i = 0;
+    esch_config_key_id id = ESCH_CONFIG_KEY_ID_ALLOC;
     ESCH_CHECK_PARAM_PUBLIC(config != NULL);
     ESCH_CHECK_PARAM_PUBLIC(key != NULL);
-    ret = ESCH_ERROR_NOT_FOUND;
-    for (i = 0; i < ESCH_CONFIG_ITEMS; ++i)
+    ret = esch_config_find_key(config, key, &id);
+    if (ret == ESCH_OK)
     {
-        if (strcmp(config->config[i].key, key) == 0
-                && config->config[i].type == ESCH_CONFIG_VALUE_TYPE_STRING)
-        {
-            strncmp(config->config[i].data.str_value,
-                    value,
-                    ESCH_CONFIG_VALUE_STRING_LENGTH);
-            ret = ESCH_OK;
-            break;
-        }
+        ret = esch_config_set_str_by_id(config, id, value);
+        ret = (ret == ESCH_ERROR_BAD_VALUE_TYPE? ESCH_ERROR_NOT_FOUND: ret);
     }
 Exit:
     return ret;
@@ -247,21 +265,16 @@ esch_error
 esch_config_get_obj(esch_config* config, const char* key, esch_object** obj)
 {
     esch_error ret = ESCH_OK;
-    size_t i = 0;
+    struct esch_config_entry* entry = NULL;
     ESCH_CHECK_PARAM_PUBLIC(config != NULL);
     ESCH_CHECK_PARAM_PUBLIC(key != NULL);
     ESCH_CHECK_PARAM_PUBLIC(obj != NULL);
 
-    ret = ESCH_ERROR_NOT_FOUND;
-    for (i = 0; i < ESCH_CONFIG_ITEMS; ++i)
+    ret = esch_config_get_key_entry_i(config, key,
+                                      ESCH_CONFIG_VALUE_TYPE_OBJECT, &entry);
+    if (ret == ESCH_OK)
     {
-        if (strcmp(config->config[i].key, key) == 0
-                && config->config[i].type == ESCH_CONFIG_VALUE_TYPE_OBJECT)
-        {
-            (*obj) = config->config[i].data.obj_value;
-            ret = ESCH_OK;
-            break;
-        }
+        (*obj) = entry->data.obj_value;
     }
 Exit:
     return ret;
@@ -278,19 +291,185 @@ esch_error
 esch_config_set_obj(esch_config* config, const char* key, esch_object* obj)
 {
     esch_error ret = ESCH_OK;
-    size_t i = 0;
+    struct esch_config_entry* entry = NULL;
     ESCH_CHECK_PARAM_PUBLIC(config != NULL);
     ESCH_CHECK_PARAM_PUBLIC(key != NULL);
-    ret = ESCH_ERROR_NOT_FOUND;
-    for (i = 0; i < ESCH_CONFIG_ITEMS; ++i)
+    ret = esch_config_get_key_entry_i(config, key,
+                                      ESCH_CONFIG_VALUE_TYPE_OBJECT, &entry);
+    if (ret == ESCH_OK)
     {
-        if (strcmp(config->config[i].key, key) == 0
-                && config->config[i].type == ESCH_CONFIG_VALUE_TYPE_OBJECT)
-        {
-            config->config[i].data.obj_value = obj;
-            ret = ESCH_OK;
-            break;
-        }
+        entry->data.obj_value = obj;
+    }
+Exit:
+    return ret;
+}
+
+esch_error
+esch_config_add_key(esch_config* config, const char* key,
+                    esch_config_value_type type, esch_config_key_id* id)
+{
+    esch_error ret = ESCH_OK;
+    esch_config_key_id found = ESCH_CONFIG_KEY_ID_ALLOC;
+    ESCH_CHECK_PARAM_PUBLIC(config != NULL);
+    ESCH_CHECK_PARAM_PUBLIC(ESCH_IS_VALID_CONFIG(config));
+    ESCH_CHECK_PARAM_PUBLIC(key != NULL);
+    ESCH_CHECK_PARAM_PUBLIC(strlen(key) <= ESCH_CONFIG_KEY_LENGTH);
+    ESCH_CHECK_PARAM_PUBLIC(type == ESCH_CONFIG_VALUE_TYPE_INTEGER ||
+                            type == ESCH_CONFIG_VALUE_TYPE_STRING ||
+                            type == ESCH_CONFIG_VALUE_TYPE_OBJECT);
+    ESCH_CHECK_PARAM_PUBLIC(id != NULL);
+
+    ret = esch_config_find_key(config, key, &found);
+    if (ret == ESCH_OK)
+    {
+        ret = (config->entries[found].type == type?
+               ESCH_OK: ESCH_ERROR_BAD_VALUE_TYPE);
+        (*id) = found;
+        goto Exit;
+    }
+    ret = esch_config_add_key_i(config, key, type, id);
+Exit:
+    return ret;
+}
+
+esch_error
+esch_config_find_key(esch_config* config, const char* key,
+                     esch_config_key_id* id)
+{
+    esch_error ret = ESCH_OK;
+    size_t slot = 0;
+    ESCH_CHECK_PARAM_PUBLIC(config != NULL);
+    ESCH_CHECK_PARAM_PUBLIC(key != NULL);
+    ESCH_CHECK_PARAM_PUBLIC(id != NULL);
+
+    slot = esch_config_find_i(config, key, esch_config_hash_i(key));
+    if (config->index[slot] == 0)
+    {
+        ret = ESCH_ERROR_NOT_FOUND;
+    }
+    else
+    {
+        (*id) = (esch_config_key_id)(config->index[slot] - 1);
+    }
+Exit:
+    return ret;
+}
+
+esch_error
+esch_config_get_int_by_id(esch_config* config, esch_config_key_id id,
+                          int* value)
+{
+    esch_error ret = ESCH_OK;
+    struct esch_config_entry* entry = NULL;
+    ESCH_CHECK_PARAM_PUBLIC(config != NULL);
+    ESCH_CHECK_PARAM_PUBLIC(value != NULL);
+    ret = esch_config_get_entry_i(config, id,
+                                  ESCH_CONFIG_VALUE_TYPE_INTEGER, &entry);
+    if (ret == ESCH_OK)
+    {
+        (*value) = entry->data.int_value;
+    }
+Exit:
+    return ret;
+}
+
+esch_error
+esch_config_set_int_by_id(esch_config* config, esch_config_key_id id,
+                          int value)
+{
+    esch_error ret = ESCH_OK;
+    struct esch_config_entry* entry = NULL;
+    ESCH_CHECK_PARAM_PUBLIC(config != NULL);
+    ret = esch_config_get_entry_i(config, id,
+                                  ESCH_CONFIG_VALUE_TYPE_INTEGER, &entry);
+    if (ret == ESCH_OK)
+    {
+        entry->data.int_value = value;
+    }
+Exit:
+    return ret;
+}
+
+esch_error
+esch_config_get_str_by_id(esch_config* config, esch_config_key_id id,
+                          char** value)
+{
+    esch_error ret = ESCH_OK;
+    struct esch_config_entry* entry = NULL;
+    ESCH_CHECK_PARAM_PUBLIC(config != NULL);
+    ESCH_CHECK_PARAM_PUBLIC(value != NULL);
+    ret = esch_config_get_entry_i(config, id,
+                                  ESCH_CONFIG_VALUE_TYPE_STRING, &entry);
+    if (ret == ESCH_OK)
+    {
+        (*value) = entry->data.str_value;
+    }
+Exit:
+    return ret;
+}
+
+esch_error
+esch_config_set_str_by_id(esch_config* config, esch_config_key_id id,
+                          char* value)
+{
+    esch_error ret = ESCH_OK;
+    struct esch_config_entry* entry = NULL;
+    esch_alloc* alloc = NULL;
+    char* copy = NULL;
+    size_t len = 0;
+    ESCH_CHECK_PARAM_PUBLIC(config != NULL);
+    ret = esch_config_get_entry_i(config, id,
+                                  ESCH_CONFIG_VALUE_TYPE_STRING, &entry);
+    if (ret != ESCH_OK)
+    {
+        goto Exit;
+    }
+    alloc = ESCH_OBJECT_GET_ALLOC(ESCH_CAST_TO_OBJECT(config));
+    if (value != NULL)
+    {
+        len = strlen(value);
+        ret = esch_alloc_realloc(alloc, NULL, len + 1, (void**)&copy);
+        ESCH_CHECK(ret == ESCH_OK,
+                   ESCH_OBJECT_GET_LOG(ESCH_CAST_TO_OBJECT(config)),
+                   "config:Can't copy string", ret);
+        memcpy(copy, value, len + 1);
+    }
+    esch_alloc_free(alloc, entry->data.str_value);
+    entry->data.str_value = copy;
+Exit:
+    return ret;
+}
+
+esch_error
+esch_config_get_obj_by_id(esch_config* config, esch_config_key_id id,
+                          esch_object** obj)
+{
+    esch_error ret = ESCH_OK;
+    struct esch_config_entry* entry = NULL;
+    ESCH_CHECK_PARAM_PUBLIC(config != NULL);
+    ESCH_CHECK_PARAM_PUBLIC(obj != NULL);
+    ret = esch_config_get_entry_i(config, id,
+                                  ESCH_CONFIG_VALUE_TYPE_OBJECT, &entry);
+    if (ret == ESCH_OK)
+    {
+        (*obj) = entry->data.obj_value;
+    }
+Exit:
+    return ret;
+}
+
+esch_error
+esch_config_set_obj_by_id(esch_config* config, esch_config_key_id id,
+                          esch_object* obj)
+{
+    esch_error ret = ESCH_OK;
+    struct esch_config_entry* entry = NULL;
+    ESCH_CHECK_PARAM_PUBLIC(config != NULL);
+    ret = esch_config_get_entry_i(config, id,
+                                  ESCH_CONFIG_VALUE_TYPE_OBJECT, &entry);
+    if (ret == ESCH_OK)
+    {
+        entry->data.obj_value = obj;
     }
 Exit:
     return ret;
@@ -326,8 +505,172 @@ Exit:
 static esch_error
 esch_config_destructor(esch_object* obj)
 {
-    (void)obj;
-    /* Just do nothing */
+    esch_config* config = NULL;
+    esch_alloc* alloc = NULL;
+    size_t i = 0;
+    config = ESCH_CAST_FROM_OBJECT(obj, esch_config);
+    alloc = ESCH_OBJECT_GET_ALLOC(obj);
+    for (i = 0; i < config->count; ++i)
+    {
+        if (config->entries[i].type == ESCH_CONFIG_VALUE_TYPE_STRING)
+        {
+            esch_alloc_free(alloc, config->entries[i].data.str_value);
+        }
+    }
+    esch_alloc_free(alloc, config->entries);
+    esch_alloc_free(alloc, config->index);
+    config->entries = NULL;
+    config->index = NULL;
     return ESCH_OK;
 }
 
+/*
+ * -----------------------------------------------------------------
+ * Internal functions.
+ * -----------------------------------------------------------------
+ */
+
+/* FNV-1a, same as symbol table. */
+static uint32_t
+esch_config_hash_i(const char* key)
+{
+    uint32_t hash = 2166136261U;
+    for (; *key != '\0'; ++key)
+    {
+        hash ^= (unsigned char)(*key);
+        hash *= 16777619U;
+    }
+    return hash;
+}
+
+/*
+ * Return slot of given key, or first empty slot in its probe
+ * sequence. Keys are never removed, so there are no tombstones.
+ */
+static size_t
+esch_config_find_i(esch_config* config, const char* key, uint32_t hash)
+{
+    size_t mask = config->slots - 1;
+    size_t slot = hash & mask;
+    struct esch_config_entry* entry = NULL;
+    while (config->index[slot] != 0)
+    {
+        entry = &(config->entries[config->index[slot] - 1]);
+        if (entry->hash == hash && strcmp(entry->key, key) == 0)
+        {
+            break;
+        }
+        slot = (slot + 1) & mask;
+    }
+    return slot;
+}
+
+/*
+ * Double entries and index. Index is rebuilt, and stays at most half
+ * full.
+ */
+static esch_error
+esch_config_grow_i(esch_config* config)
+{
+    esch_error ret = ESCH_OK;
+    esch_alloc* alloc = NULL;
+    struct esch_config_entry* entries = NULL;
+    size_t* index = NULL;
+    size_t capacity = 0;
+    size_t slot = 0;
+    size_t i = 0;
+
+    alloc = ESCH_OBJECT_GET_ALLOC(ESCH_CAST_TO_OBJECT(config));
+    capacity = (config->capacity == 0?
+                ESCH_CONFIG_INITIAL_ITEMS: config->capacity * 2);
+    ret = esch_alloc_realloc(alloc, config->entries,
+                             sizeof(struct esch_config_entry) * capacity,
+                             (void**)&entries);
+    if (ret != ESCH_OK)
+    {
+        return ret;
+    }
+    config->entries = entries;
+    ret = esch_alloc_realloc(alloc, NULL, sizeof(size_t) * capacity * 2,
+                             (void**)&index);
+    if (ret != ESCH_OK)
+    {
+        return ret;
+    }
+    memset(index, 0, sizeof(size_t) * capacity * 2);
+    esch_alloc_free(alloc, config->index);
+    config->index = index;
+    config->slots = capacity * 2;
+    config->capacity = capacity;
+    for (i = 0; i < config->count; ++i)
+    {
+        slot = esch_config_find_i(config, entries[i].key, entries[i].hash);
+        index[slot] = i + 1;
+    }
+    return ret;
+}
+
+/* Append a new key. Caller makes sure key does not exist. */
+static esch_error
+esch_config_add_key_i(esch_config* config, const char* key,
+                      esch_config_value_type type, esch_config_key_id* id)
+{
+    esch_error ret = ESCH_OK;
+    struct esch_config_entry* entry = NULL;
+    uint32_t hash = 0;
+    size_t slot = 0;
+
+    if (config->count == config->capacity)
+    {
+        ret = esch_config_grow_i(config);
+        if (ret != ESCH_OK)
+        {
+            return ret;
+        }
+    }
+    hash = esch_config_hash_i(key);
+    slot = esch_config_find_i(config, key, hash);
+    ESCH_ASSERT(config->index[slot] == 0);
+    entry = &(config->entries[config->count]);
+    memset(entry, 0, sizeof(struct esch_config_entry));
+    entry->type = type;
+    entry->hash = hash;
+    strncpy(entry->key, key, ESCH_CONFIG_KEY_LENGTH);
+    config->index[slot] = config->count + 1;
+    (*id) = (esch_config_key_id)config->count;
+    ++config->count;
+    return ret;
+}
+
+static esch_error
+esch_config_get_entry_i(esch_config* config, esch_config_key_id id,
+                        esch_config_value_type type,
+                        struct esch_config_entry** entry)
+{
+    if ((size_t)id >= config->count)
+    {
+        return ESCH_ERROR_NOT_FOUND;
+    }
+    if (config->entries[id].type != type)
+    {
+        return ESCH_ERROR_BAD_VALUE_TYPE;
+    }
+    (*entry) = &(config->entries[id]);
+    return ESCH_OK;
+}
+
+/* Key of another type is not found, same as before key IDs. */
+static esch_error
+esch_config_get_key_entry_i(esch_config* config, const char* key,
+                            esch_config_value_type type,
+                            struct esch_config_entry** entry)
+{
+    size_t slot = esch_config_find_i(config, key, esch_config_hash_i(key));
+    if (config->index[slot] == 0 ||
+        config->entries[config->index[slot] - 1].type != type)
+    {
+        return ESCH_ERROR_NOT_FOUND;
+    }
+    (*entry) = &(config->entries[config->index[slot] - 1]);
+    return ESCH_OK;
+}
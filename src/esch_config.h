@@ -13,25 +13,34 @@ extern "C" {
 #endif /* __cplusplus */
 
 #define ESCH_CONFIG_KEY_LENGTH 32
-#define ESCH_CONFIG_VALUE_STRING_LENGTH 255
-#define ESCH_CONFIG_ITEMS 8
-struct esch_config
+#define ESCH_CONFIG_INITIAL_ITEMS 16
+
+struct esch_config_entry
 {
-    /*
-     * TODO We may consider changing to hashtable when configurable
-     * items keep growing.
-     */
-    struct
+    esch_config_value_type type;
+    uint32_t hash;
+    char key[ESCH_CONFIG_KEY_LENGTH + 1];
+    union
     {
-        esch_config_value_type type;
-        char key[ESCH_CONFIG_KEY_LENGTH + 1];
-        union
-        {
-            int int_value;
-            char str_value[ESCH_CONFIG_VALUE_STRING_LENGTH + 1];
-            esch_object* obj_value;
-        } data;
-    } config[ESCH_CONFIG_ITEMS];
+        int int_value;
+        char* str_value; /* Owned copy. May be NULL. */
+        esch_object* obj_value;
+    } data;
+};
+
+/*
+ * Entries are indexed by key ID, so code holding an ID reads a value
+ * with one array access. Predefined keys have fixed IDs (see
+ * esch_config_key_id). String keys are resolved by an open-addressing
+ * hash index, which keeps (ID + 1) in each slot, or 0 if empty.
+ */
+struct esch_config
+{
+    struct esch_config_entry* entries;
+    size_t count;
+    size_t capacity;
+    size_t* index;
+    size_t slots; /* Always power of 2 */
 };
 
 extern struct esch_builtin_type esch_config_type;
@@ -40,24 +49,43 @@ extern struct esch_builtin_type esch_config_type;
     ((cfg) != NULL && \
      ESCH_IS_VALID_OBJECT(ESCH_CAST_TO_OBJECT(cfg)) && \
      (ESCH_OBJECT_GET_TYPE(ESCH_CAST_TO_OBJECT(cfg)) == \
-          &(esch_config_type.type)))
+          &(esch_config_type.type)) && \
+     (cfg)->entries != NULL && \
+     (cfg)->index != NULL)
+
+/* Read a value by key ID. Caller must make sure ID and type match. */
+#define ESCH_CONFIG_GET_OBJ_BY_ID(cfg, id) \
+    ((esch_object*)((cfg)->entries[(id)].data.obj_value))
+#define ESCH_CONFIG_GET_INT_BY_ID(cfg, id) \
+    ((int)((cfg)->entries[(id)].data.int_value))
 
 #define ESCH_CONFIG_GET_ALLOC(cfg) \
-    ((esch_object*)(cfg->config[0].data.obj_value))
+    ESCH_CONFIG_GET_OBJ_BY_ID(cfg, ESCH_CONFIG_KEY_ID_ALLOC)
 #define ESCH_CONFIG_GET_LOG(cfg) \
-    ((esch_object*)(cfg->config[1].data.obj_value))
+    ESCH_CONFIG_GET_OBJ_BY_ID(cfg, ESCH_CONFIG_KEY_ID_LOG)
 #define ESCH_CONFIG_GET_GC(cfg) \
-    ((esch_object*)(cfg->config[2].data.obj_value))
+    ESCH_CONFIG_GET_OBJ_BY_ID(cfg, ESCH_CONFIG_KEY_ID_GC)
 #define ESCH_CONFIG_GET_VECOTR_LENGTH(cfg) \
-    ((int)(cfg->config[3].data.int_value))
+    ESCH_CONFIG_GET_INT_BY_ID(cfg, ESCH_CONFIG_KEY_ID_VECTOR_LENGTH)
 #define ESCH_CONFIG_GET_VECTOR_ENLARGE(cfg) \
-    ((int)(cfg->config[4].data.int_value))
+    ESCH_CONFIG_GET_INT_BY_ID(cfg, ESCH_CONFIG_KEY_ID_VECTOR_ENLARGE)
 #define ESCH_CONFIG_GET_GC_NAIVE_SLOTS(cfg) \
-    ((int)(cfg->config[5].data.int_value))
+    ESCH_CONFIG_GET_INT_BY_ID(cfg, ESCH_CONFIG_KEY_ID_GC_NAIVE_SLOTS)
 #define ESCH_CONFIG_GET_GC_NAIVE_ROOT(cfg) \
-    ((esch_object*)(cfg->config[6].data.obj_value))
+    ESCH_CONFIG_GET_OBJ_BY_ID(cfg, ESCH_CONFIG_KEY_ID_GC_NAIVE_ROOT)
 #define ESCH_CONFIG_GET_GC_NAIVE_ENLARGE(cfg) \
-    ((int)(cfg->config[7].data.int_value))
+    ESCH_CONFIG_GET_INT_BY_ID(cfg, ESCH_CONFIG_KEY_ID_GC_NAIVE_ENLARGE)
+#define ESCH_CONFIG_GET_VECTOR_SORT_THREADS(cfg) \
+    ESCH_CONFIG_GET_INT_BY_ID(cfg, ESCH_CONFIG_KEY_ID_VECTOR_SORT_THREADS)
+#define ESCH_CONFIG_GET_VECTOR_LAYOUT(cfg) \
+    ((esch_vector_layout)ESCH_CONFIG_GET_INT_BY_ID(cfg, \
+                                        ESCH_CONFIG_KEY_ID_VECTOR_LAYOUT))
+#define ESCH_CONFIG_GET_LOG_ASYNC_SLOTS(cfg) \
+    ESCH_CONFIG_GET_INT_BY_ID(cfg, ESCH_CONFIG_KEY_ID_LOG_ASYNC_SLOTS)
+#define ESCH_CONFIG_GET_LOG_ASYNC_FD(cfg) \
+    ESCH_CONFIG_GET_INT_BY_ID(cfg, ESCH_CONFIG_KEY_ID_LOG_ASYNC_FD)
+#define ESCH_CONFIG_GET_PAIR_ALLOC(cfg) \
+    ESCH_CONFIG_GET_OBJ_BY_ID(cfg, ESCH_CONFIG_KEY_ID_PAIR_ALLOC)
 
 #ifdef __cplusplus
 }
@@ -0,0 +1,956 @@
+/* vim:ft=c expandtab tw=72 sw=4
+ */
+/* See Copyright notice in esch.h */
+#include <string.h>
+#include <assert.h>
+#include "esch_number.h"
+#include "esch_debug.h"
+
+/*
+ * Decimal to double goes through three steps, each one slower and
+ * rarer than the one before:
+ * 1. Clinger's fast path: value has at most 53 bits and power of 10
+ *    is exact in double, so one IEEE multiplication or division
+ *    rounds correctly.
+ * 2. Eisel-Lemire: multiply first 19 digits by a 128-bit power of 5.
+ *    Result is correct unless it falls too close to a halfway point,
+ *    which can be detected.
+ * 3. Big integer comparison: compare exact value with the halfway
+ *    point next to a candidate, and move candidate until it is right.
+ *
+ * Double to decimal uses Schubfach: it computes the interval of
+ * decimals that round back to the double with 128-bit powers of 10,
+ * then takes the shortest one in it (nearest one on ties).
+ */
+#define ESCH_FLOAT_MANTISSA_BITS 52
+#define ESCH_FLOAT_MANTISSA_MASK ESCH_NUMBER_U64(0x000FFFFF, 0xFFFFFFFF)
+#define ESCH_FLOAT_HIDDEN_BIT ESCH_NUMBER_U64(0x00100000, 0x00000000)
+#define ESCH_FLOAT_SIGN_BIT ESCH_NUMBER_U64(0x80000000, 0x00000000)
+#define ESCH_FLOAT_INF_BITS ESCH_NUMBER_U64(0x7FF00000, 0x00000000)
+#define ESCH_FLOAT_NAN_BITS ESCH_NUMBER_U64(0x7FF80000, 0x00000000)
+#define ESCH_FLOAT_MAX_BIASED_EXPONENT 0x7FF
+/* Exponent of the lowest bit of double: value = c * 2^(e - bias). */
+#define ESCH_FLOAT_EXPONENT_BIAS (1023 + ESCH_FLOAT_MANTISSA_BITS)
+
+/* A uint64_t holds any 19 digits. */
+#define ESCH_FLOAT_FAST_DIGITS 19
+/* Explicit exponent is clamped: result is 0 or inf far before it. */
+#define ESCH_FLOAT_EXPONENT_LIMIT 100000000L
+/*
+ * Big integer comparison keeps this many significant digits, and one
+ * more non-zero digit if any digit after them is not zero. A halfway
+ * point between two doubles has at most 767 significant digits, so
+ * result is same as with all digits.
+ */
+#define ESCH_FLOAT_BIG_DIGITS 800
+/* Enough for 10^801 times 5^1123, the largest product compared. */
+#define ESCH_FLOAT_BIG_LIMBS 128
+
+/* Largest text is "-0.00000" followed by 17 digits. */
+#define ESCH_FLOAT_BASE10_SIZE 32
+
+#if defined(__SIZEOF_INT128__)
+__extension__ typedef unsigned __int128 esch_float_u128;
+#endif
+
+/*
+ * Clinger's fast path relies on double arithmetic being done in
+ * double precision. x87 keeps extra precision, and rounding twice
+ * may give a wrong last bit.
+ */
+#if (defined(__FLT_EVAL_METHOD__) && __FLT_EVAL_METHOD__ == 0) || \
+    defined(_M_X64) || defined(_M_ARM64)
+#    define ESCH_FLOAT_HAS_FAST_PATH
+#endif
+
+/* Decimal in text form: digits are integer part, then fraction. */
+struct esch_float_decimal
+{
+    esch_bool negative;
+    const char* integer;
+    size_t integer_length;
+    const char* fraction;
+    size_t fraction_length;
+    long exponent; /* Explicit exponent after 'e', clamped. */
+};
+
+/* Big integer for comparison, on stack. */
+struct esch_float_big
+{
+    size_t length;
+    esch_limb limbs[ESCH_FLOAT_BIG_LIMBS];
+};
+
+static const double esch_float_exact_pow10[] =
+{
+    1e0, 1e1, 1e2, 1e3, 1e4, 1e5, 1e6, 1e7, 1e8, 1e9, 1e10, 1e11,
+    1e12, 1e13, 1e14, 1e15, 1e16, 1e17, 1e18, 1e19, 1e20, 1e21, 1e22,
+};
+#define ESCH_FLOAT_EXACT_POW10_MAX 22
+
+static const esch_limb esch_float_small_pow10[] =
+{
+    1, 10, 100, 1000, 10000, 100000, 1000000, 10000000, 100000000,
+    1000000000,
+};
+
+static const esch_limb esch_float_small_pow5[] =
+{
+    1, 5, 25, 125, 625, 3125, 15625, 78125, 390625, 1953125, 9765625,
+    48828125, 244140625, 1220703125,
+};
+#define ESCH_FLOAT_SMALL_POW5_MAX 13
+
+/*
+ * ---------------------------------------------------------------
+ * 64-bit helpers
+ * ---------------------------------------------------------------
+ */
+/* Floor of x / 2^n, for negative x too. */
+static long
+esch_float_floor_shift(long x, int n)
+{
+    return (x >= 0? x >> n: -((-x - 1) >> n) - 1);
+}
+
+static int
+esch_float_leading_zeros(uint64_t x)
+{
+#if defined(__GNUC__)
+    return __builtin_clzll(x);
+#else
+    int count = 0;
+    while ((x & ESCH_FLOAT_SIGN_BIT) == 0)
+    {
+        x <<= 1;
+        ++count;
+    }
+    return count;
+#endif
+}
+
+/* hi:lo = a * b */
+static void
+esch_float_mul_64(uint64_t a, uint64_t b, uint64_t* hi, uint64_t* lo)
+{
+#if defined(__SIZEOF_INT128__)
+    esch_float_u128 r = (esch_float_u128)a * b;
+    (*hi) = (uint64_t)(r >> 64);
+    (*lo) = (uint64_t)r;
+#else
+    uint64_t a0 = (uint32_t)a;
+    uint64_t a1 = a >> 32;
+    uint64_t b0 = (uint32_t)b;
+    uint64_t b1 = b >> 32;
+    uint64_t p00 = a0 * b0;
+    uint64_t p01 = a0 * b1;
+    uint64_t p10 = a1 * b0;
+    uint64_t mid = (p00 >> 32) + (uint32_t)p01 + (uint32_t)p10;
+    (*hi) = a1 * b1 + (p01 >> 32) + (p10 >> 32) + (mid >> 32);
+    (*lo) = (mid << 32) | (uint32_t)p00;
+#endif
+}
+
+/*
+ * ---------------------------------------------------------------
+ * Decimal to double
+ * ---------------------------------------------------------------
+ */
+static const char*
+esch_float_skip_digits(const char* begin, const char* end)
+{
+    while (begin != end && (unsigned)((*begin) - '0') < 10)
+    {
+        ++begin;
+    }
+    return begin;
+}
+
+/* Grammar: [+-] digits [. digits] [(e|E) [+-] digits] */
+static esch_bool
+esch_float_scan(const char* begin, const char* end,
+                struct esch_float_decimal* dec)
+{
+    esch_bool negative_exponent = ESCH_FALSE;
+    long exponent = 0;
+
+    dec->negative = ESCH_FALSE;
+    if (begin != end && ((*begin) == '-' || (*begin) == '+'))
+    {
+        dec->negative = ((*begin) == '-');
+        ++begin;
+    }
+    dec->integer = begin;
+    begin = esch_float_skip_digits(begin, end);
+    dec->integer_length = (size_t)(begin - dec->integer);
+    dec->fraction = begin;
+    dec->fraction_length = 0;
+    if (begin != end && (*begin) == '.')
+    {
+        ++begin;
+        dec->fraction = begin;
+        begin = esch_float_skip_digits(begin, end);
+        dec->fraction_length = (size_t)(begin - dec->fraction);
+    }
+    if (dec->integer_length == 0 && dec->fraction_length == 0)
+    {
+        return ESCH_FALSE;
+    }
+    if (begin != end && ((*begin) == 'e' || (*begin) == 'E'))
+    {
+        ++begin;
+        if (begin != end && ((*begin) == '-' || (*begin) == '+'))
+        {
+            negative_exponent = ((*begin) == '-');
+            ++begin;
+        }
+        if (begin == end || (unsigned)((*begin) - '0') >= 10)
+        {
+            return ESCH_FALSE;
+        }
+        for (; begin != end && (unsigned)((*begin) - '0') < 10; ++begin)
+        {
+            if (exponent < ESCH_FLOAT_EXPONENT_LIMIT)
+            {
+                exponent = exponent * 10 + ((*begin) - '0');
+            }
+        }
+    }
+    dec->exponent = (negative_exponent? -exponent: exponent);
+    return (begin == end);
+}
+
+/* Total number of digits, integer and fraction parts together. */
+#define ESCH_FLOAT_DECIMAL_LENGTH(dec) \
+    ((dec)->integer_length + (dec)->fraction_length)
+
+/* Digits [index, index + count) as up to two runs of characters. */
+static void
+esch_float_split(const struct esch_float_decimal* dec,
+                 size_t index, size_t count,
+                 const char** runs, size_t* lengths)
+{
+    if (index < dec->integer_length)
+    {
+        runs[0] = dec->integer + index;
+        lengths[0] = dec->integer_length - index;
+        if (lengths[0] > count)
+        {
+            lengths[0] = count;
+        }
+        runs[1] = dec->fraction;
+        lengths[1] = count - lengths[0];
+    }
+    else
+    {
+        runs[0] = dec->fraction + (index - dec->integer_length);
+        lengths[0] = count;
+        runs[1] = NULL;
+        lengths[1] = 0;
+    }
+}
+
+/* Index of first non-zero digit, or total length if there is none. */
+static size_t
+esch_float_first_nonzero(const struct esch_float_decimal* dec,
+                         size_t index)
+{
+    const char* runs[2];
+    size_t lengths[2];
+    size_t total = ESCH_FLOAT_DECIMAL_LENGTH(dec);
+    size_t i = 0;
+    int run = 0;
+
+    esch_float_split(dec, index, total - index, runs, lengths);
+    for (run = 0; run < 2; ++run)
+    {
+        for (i = 0; i < lengths[run]; ++i, ++index)
+        {
+            if (runs[run][i] != '0')
+            {
+                return index;
+            }
+        }
+    }
+    return total;
+}
+
+static uint64_t
+esch_float_parse_run(uint64_t w, const char* digits, size_t length)
+{
+    for (; length >= 8; length -= 8, digits += 8)
+    {
+        w = w * 100000000 +
+            esch_number_parse_8_i(esch_number_load_8_i(digits));
+    }
+    for (; length > 0; --length, ++digits)
+    {
+        w = w * 10 + (uint64_t)((*digits) - '0');
+    }
+    return w;
+}
+
+/*
+ * Eisel-Lemire: bits of w * 10^q rounded to nearest, w != 0 and q is
+ * in range of esch_float_pow5_128. 10^q = 5^q * 2^q, so only 5^q
+ * needs a table, truncated to 128 bits. Return ESCH_FALSE if the
+ * truncated product can't tell how to round, and bits is then only
+ * close to result.
+ */
+static esch_bool
+esch_float_eisel_lemire(long q, uint64_t w, uint64_t* bits)
+{
+    const uint64_t* pow5 = NULL;
+    uint64_t hi = 0;
+    uint64_t lo = 0;
+    uint64_t hi2 = 0;
+    uint64_t lo2 = 0;
+    uint64_t mantissa = 0;
+    long power2 = 0;
+    int zeros = 0;
+    int upper = 0;
+    int shift = 0;
+    esch_bool exact = ESCH_TRUE;
+
+    zeros = esch_float_leading_zeros(w);
+    w <<= zeros;
+    pow5 = esch_float_pow5_128 + 2 * (q - ESCH_FLOAT_POW5_MIN);
+    esch_float_mul_64(w, pow5[0], &hi, &lo);
+    /* 55 bits are needed. Low 9 bits may still take a carry. */
+    if ((hi & 0x1FF) == 0x1FF)
+    {
+        esch_float_mul_64(w, pow5[1], &hi2, &lo2);
+        lo += hi2;
+        if (hi2 > lo)
+        {
+            ++hi;
+        }
+    }
+    if (lo == ESCH_NUMBER_U64(0xFFFFFFFF, 0xFFFFFFFF) &&
+        (q < -27 || q > 55))
+    {
+        /* Truncated part of 5^q could carry all the way. */
+        exact = ESCH_FALSE;
+    }
+    upper = (int)(hi >> 63);
+    shift = upper + 64 - ESCH_FLOAT_MANTISSA_BITS - 3;
+    mantissa = hi >> shift;
+    /* floor(log2(10^q)) + 63, as biased exponent. */
+    power2 = esch_float_floor_shift(217706L * q, 16) + 63 + upper -
+             zeros + 1023;
+    if (power2 <= 0)
+    {
+        /* Subnormal, or 0. */
+        if (1 - power2 >= 64)
+        {
+            (*bits) = 0;
+            return exact;
+        }
+        mantissa >>= 1 - power2;
+        mantissa += (mantissa & 1);
+        mantissa >>= 1;
+        /* Rounding up may give smallest normal number. */
+        (*bits) = mantissa;
+        return exact;
+    }
+    /*
+     * Exactly halfway: only possible for small q, where 5^q is exact.
+     * Round to even instead of up.
+     */
+    if (lo <= 1 && q >= -4 && q <= 23 && (mantissa & 3) == 1 &&
+        (mantissa << shift) == hi)
+    {
+        mantissa &= ~(uint64_t)1;
+    }
+    mantissa += (mantissa & 1);
+    mantissa >>= 1;
+    if (mantissa >= (ESCH_FLOAT_HIDDEN_BIT << 1))
+    {
+        mantissa = ESCH_FLOAT_HIDDEN_BIT;
+        ++power2;
+    }
+    if (power2 >= ESCH_FLOAT_MAX_BIASED_EXPONENT)
+    {
+        (*bits) = ESCH_FLOAT_INF_BITS;
+        return exact;
+    }
+    (*bits) = (mantissa & ESCH_FLOAT_MANTISSA_MASK) |
+              ((uint64_t)power2 << ESCH_FLOAT_MANTISSA_BITS);
+    return exact;
+}
+
+static void
+esch_float_big_push(struct esch_float_big* big, esch_limb carry)
+{
+    if (carry != 0)
+    {
+        assert(big->length < ESCH_FLOAT_BIG_LIMBS);
+        big->limbs[big->length] = carry;
+        ++big->length;
+    }
+}
+
+/* big = big * m + carry */
+static void
+esch_float_big_mul_1(struct esch_float_big* big, esch_limb m,
+                     esch_limb carry)
+{
+    carry = esch_bignum_mul_1_i(big->limbs, big->limbs, big->length,
+                                m, carry);
+    esch_float_big_push(big, carry);
+}
+
+static void
+esch_float_big_mul_pow5(struct esch_float_big* big, long exponent)
+{
+    for (; exponent >= ESCH_FLOAT_SMALL_POW5_MAX;
+           exponent -= ESCH_FLOAT_SMALL_POW5_MAX)
+    {
+        esch_float_big_mul_1(
+            big, esch_float_small_pow5[ESCH_FLOAT_SMALL_POW5_MAX], 0);
+    }
+    if (exponent > 0)
+    {
+        esch_float_big_mul_1(big, esch_float_small_pow5[exponent], 0);
+    }
+}
+
+static void
+esch_float_big_shift(struct esch_float_big* big, long bits)
+{
+    size_t limbs = (size_t)bits / ESCH_LIMB_BITS;
+
+    bits %= ESCH_LIMB_BITS;
+    if (bits != 0)
+    {
+        esch_float_big_mul_1(big, (esch_limb)1 << bits, 0);
+    }
+    if (limbs > 0 && big->length > 0)
+    {
+        assert(big->length + limbs <= ESCH_FLOAT_BIG_LIMBS);
+        memmove(big->limbs + limbs, big->limbs,
+                sizeof(esch_limb) * big->length);
+        memset(big->limbs, 0, sizeof(esch_limb) * limbs);
+        big->length += limbs;
+    }
+}
+
+static void
+esch_float_big_add_digits(struct esch_float_big* big,
+                          const char* digits, size_t length)
+{
+    esch_limb chunk = 0;
+    size_t step = 0;
+    size_t i = 0;
+
+    for (; length > 0; length -= step)
+    {
+        step = (length < 9? length: 9);
+        for (chunk = 0, i = 0; i < step; ++i, ++digits)
+        {
+            chunk = chunk * 10 + (esch_limb)((*digits) - '0');
+        }
+        esch_float_big_mul_1(big, esch_float_small_pow10[step], chunk);
+    }
+}
+
+/*
+ * Compare digits * 10^exponent with halfway point between double of
+ * given bits and next double above. scaled is digits multiplied by
+ * 5^exponent if exponent is positive.
+ */
+static int
+esch_float_compare_halfway(const struct esch_float_big* scaled,
+                           long exponent, uint64_t bits)
+{
+    struct esch_float_big lhs;
+    struct esch_float_big rhs;
+    uint64_t biased = bits >> ESCH_FLOAT_MANTISSA_BITS;
+    uint64_t half = 0;
+    long power2 = 0;
+
+    /* Halfway point is (2 * c + 1) * 2^(power2 - 1). */
+    half = bits & ESCH_FLOAT_MANTISSA_MASK;
+    if (biased != 0)
+    {
+        half |= ESCH_FLOAT_HIDDEN_BIT;
+        power2 = (long)biased - ESCH_FLOAT_EXPONENT_BIAS;
+    }
+    else
+    {
+        power2 = 1 - ESCH_FLOAT_EXPONENT_BIAS;
+    }
+    half = 2 * half + 1;
+
+    lhs.length = scaled->length;
+    memcpy(lhs.limbs, scaled->limbs, sizeof(esch_limb) * lhs.length);
+    rhs.limbs[0] = (esch_limb)half;
+    rhs.limbs[1] = (esch_limb)(half >> ESCH_LIMB_BITS);
+    rhs.length = esch_bignum_normalize_i(rhs.limbs, 2);
+    if (exponent < 0)
+    {
+        esch_float_big_mul_pow5(&rhs, -exponent);
+    }
+    /* Powers of 2 are left: 2^exponent and 2^(power2 - 1). */
+    if (exponent >= power2 - 1)
+    {
+        esch_float_big_shift(&lhs, exponent - (power2 - 1));
+    }
+    else
+    {
+        esch_float_big_shift(&rhs, (power2 - 1) - exponent);
+    }
+    return esch_bignum_compare_i(lhs.limbs, lhs.length,
+                                 rhs.limbs, rhs.length);
+}
+
+/*
+ * Slow path with big integers: move bits up or down until decimal is
+ * within half a unit of it. Start from a close guess, so it takes one
+ * or two comparisons.
+ */
+static uint64_t
+esch_float_big_compare(const struct esch_float_decimal* dec,
+                       uint64_t bits)
+{
+    struct esch_float_big scaled;
+    const char* runs[2];
+    size_t lengths[2];
+    size_t index = 0;
+    size_t count = 0;
+    long exponent = 0;
+    int cmp = 0;
+
+    index = esch_float_first_nonzero(dec, 0);
+    count = ESCH_FLOAT_DECIMAL_LENGTH(dec) - index;
+    if (count > ESCH_FLOAT_BIG_DIGITS)
+    {
+        count = ESCH_FLOAT_BIG_DIGITS;
+    }
+    scaled.length = 0;
+    esch_float_split(dec, index, count, runs, lengths);
+    esch_float_big_add_digits(&scaled, runs[0], lengths[0]);
+    esch_float_big_add_digits(&scaled, runs[1], lengths[1]);
+    index += count;
+    exponent = dec->exponent + (long)dec->integer_length - (long)index;
+    if (esch_float_first_nonzero(dec, index) !=
+        ESCH_FLOAT_DECIMAL_LENGTH(dec))
+    {
+        /* Sticky digit: digits dropped are not all zero. */
+        esch_float_big_mul_1(&scaled, 10, 1);
+        --exponent;
+    }
+    if (exponent > 0)
+    {
+        esch_float_big_mul_pow5(&scaled, exponent);
+    }
+
+    for (;;)
+    {
+        /* Ties go to even bits. */
+        if (bits < ESCH_FLOAT_INF_BITS)
+        {
+            cmp = esch_float_compare_halfway(&scaled, exponent, bits);
+            if (cmp > 0 || (cmp == 0 && (bits & 1) != 0))
+            {
+                ++bits;
+                continue;
+            }
+        }
+        if (bits > 0)
+        {
+            cmp = esch_float_compare_halfway(&scaled, exponent,
+                                             bits - 1);
+            if (cmp < 0 || (cmp == 0 && (bits & 1) != 0))
+            {
+                --bits;
+                continue;
+            }
+        }
+        return bits;
+    }
+}
+
+/* Bits of positive decimal, without sign. */
+static uint64_t
+esch_float_decimal_to_bits(const struct esch_float_decimal* dec)
+{
+    const char* runs[2];
+    size_t lengths[2];
+    size_t index = 0;
+    size_t count = 0;
+    uint64_t w = 0;
+    uint64_t bits = 0;
+    uint64_t bits_up = 0;
+    long q = 0;
+    esch_bool truncated = ESCH_FALSE;
+    esch_bool exact = ESCH_FALSE;
+    double value = 0.0;
+
+    index = esch_float_first_nonzero(dec, 0);
+    count = ESCH_FLOAT_DECIMAL_LENGTH(dec) - index;
+    if (count == 0)
+    {
+        return 0;
+    }
+    if (count > ESCH_FLOAT_FAST_DIGITS)
+    {
+        count = ESCH_FLOAT_FAST_DIGITS;
+    }
+    esch_float_split(dec, index, count, runs, lengths);
+    w = esch_float_parse_run(0, runs[0], lengths[0]);
+    w = esch_float_parse_run(w, runs[1], lengths[1]);
+    index += count;
+    truncated = (esch_float_first_nonzero(dec, index) !=
+                 ESCH_FLOAT_DECIMAL_LENGTH(dec));
+    /* Value is w * 10^q, or a little more when truncated. */
+    q = dec->exponent + (long)dec->integer_length - (long)index;
+
+#ifdef ESCH_FLOAT_HAS_FAST_PATH
+    if (!truncated && q >= -ESCH_FLOAT_EXACT_POW10_MAX &&
+        q <= ESCH_FLOAT_EXACT_POW10_MAX &&
+        w <= (ESCH_FLOAT_HIDDEN_BIT << 1))
+    {
+        value = (double)w;
+        if (q < 0)
+        {
+            value = value / esch_float_exact_pow10[-q];
+        }
+        else
+        {
+            value = value * esch_float_exact_pow10[q];
+        }
+        memcpy(&bits, &value, sizeof(bits));
+        return bits;
+    }
+#else
+    (void)value;
+#endif
+    /* 10^19 * 10^-343 is below half of smallest subnormal. */
+    if (q < ESCH_FLOAT_POW5_MIN)
+    {
+        return 0;
+    }
+    if (q > ESCH_FLOAT_POW5_MAX)
+    {
+        return ESCH_FLOAT_INF_BITS;
+    }
+    exact = esch_float_eisel_lemire(q, w, &bits);
+    if (exact && truncated)
+    {
+        /* Value is between w and w + 1: fine if both agree. */
+        exact = esch_float_eisel_lemire(q, w + 1, &bits_up);
+        exact = exact && (bits == bits_up);
+    }
+    if (!exact)
+    {
+        bits = esch_float_big_compare(dec, bits);
+    }
+    return bits;
+}
+
+/*
+ * ---------------------------------------------------------------
+ * Double to decimal
+ * ---------------------------------------------------------------
+ */
+/*
+ * Top 64 bits of g * x, where g is 128 bits, and lowest bit is set if
+ * any bit below is not zero (round to odd).
+ */
+static uint64_t
+esch_float_round_to_odd(const uint64_t* g, uint64_t x)
+{
+    uint64_t x_hi = 0;
+    uint64_t x_lo = 0;
+    uint64_t y_hi = 0;
+    uint64_t y_lo = 0;
+    uint64_t mid = 0;
+
+    esch_float_mul_64(g[1], x, &x_hi, &x_lo);
+    esch_float_mul_64(g[0], x, &y_hi, &y_lo);
+    mid = y_lo + x_hi;
+    y_hi += (mid < y_lo? 1: 0);
+    return y_hi | (mid > 1? 1: 0);
+}
+
+/*
+ * Shortest decimal digits * 10^exponent that reads back as positive
+ * finite double of given bits.
+ */
+static void
+esch_float_bits_to_decimal(uint64_t bits, uint64_t* digits,
+                           int* exponent)
+{
+    uint64_t fraction = bits & ESCH_FLOAT_MANTISSA_MASK;
+    long biased = (long)(bits >> ESCH_FLOAT_MANTISSA_BITS);
+    const uint64_t* pow10 = NULL;
+    uint64_t c = 0;
+    uint64_t lower = 0;
+    uint64_t upper = 0;
+    uint64_t vb = 0;
+    uint64_t s = 0;
+    uint64_t sp = 0;
+    long q = 0;
+    long k = 0;
+    long h = 0;
+    esch_bool closer = ESCH_FALSE;
+    esch_bool even = ESCH_FALSE;
+    esch_bool u_inside = ESCH_FALSE;
+    esch_bool w_inside = ESCH_FALSE;
+
+    if (biased != 0)
+    {
+        c = ESCH_FLOAT_HIDDEN_BIT | fraction;
+        q = biased - ESCH_FLOAT_EXPONENT_BIAS;
+        if (q <= 0 && q > -ESCH_FLOAT_MANTISSA_BITS - 1 &&
+            (c & (((uint64_t)1 << -q) - 1)) == 0)
+        {
+            /* Integer: digits are exact. */
+            (*digits) = c >> -q;
+            (*exponent) = 0;
+            return;
+        }
+    }
+    else
+    {
+        c = fraction;
+        q = 1 - ESCH_FLOAT_EXPONENT_BIAS;
+    }
+    even = ((c & 1) == 0);
+    /* Lower neighbor is closer at a power of 2. */
+    closer = (fraction == 0 && biased > 1);
+
+    /* k = floor(log10(2^q)), or floor(log10(3/4 * 2^q)) if closer. */
+    k = esch_float_floor_shift(q * 1262611L - (closer? 524031L: 0), 22);
+    /* h = q + floor(log2(10^-k)) + 1, so products fit in 64 bits. */
+    h = q + esch_float_floor_shift(-k * 1741647L, 19) + 1;
+    pow10 = esch_float_pow10_128 + 2 * (-k - ESCH_FLOAT_POW10_MIN);
+    /* Interval of decimals rounding to c, scaled by 4 * 10^-k. */
+    lower = esch_float_round_to_odd(pow10, (4 * c - 2 + closer) << h);
+    vb = esch_float_round_to_odd(pow10, (4 * c) << h);
+    upper = esch_float_round_to_odd(pow10, (4 * c + 2) << h);
+    if (!even)
+    {
+        ++lower;
+        --upper;
+    }
+
+    s = vb / 4;
+    if (s >= 10)
+    {
+        /* Try one digit less first. */
+        sp = s / 10;
+        u_inside = (lower <= 40 * sp);
+        w_inside = (40 * sp + 40 <= upper);
+        if (u_inside != w_inside)
+        {
+            (*digits) = sp + w_inside;
+            (*exponent) = (int)k + 1;
+            return;
+        }
+    }
+    u_inside = (lower <= 4 * s);
+    w_inside = (4 * s + 4 <= upper);
+    if (u_inside != w_inside)
+    {
+        (*digits) = s + w_inside;
+        (*exponent) = (int)k;
+        return;
+    }
+    /* Both inside: take nearest one, even one on ties. */
+    (*digits) = s + (vb > 4 * s + 2 || (vb == 4 * s + 2 && (s & 1)));
+    (*exponent) = (int)k;
+}
+
+/* Write digits at end of buffer. Return start of digits. */
+static char*
+esch_float_print_digits(uint64_t digits, char* end)
+{
+    while (digits >= 100)
+    {
+        end -= 2;
+        memcpy(end, esch_number_digit_pairs + 2 * (digits % 100), 2);
+        digits /= 100;
+    }
+    if (digits >= 10)
+    {
+        end -= 2;
+        memcpy(end, esch_number_digit_pairs + 2 * digits, 2);
+    }
+    else
+    {
+        --end;
+        (*end) = (char)('0' + digits);
+    }
+    return end;
+}
+
+/*
+ * Format digits * 10^exponent as fixed notation for 1e-6 <= x < 1e21,
+ * where integers end with ".0", and as "d.ddde-x" outside of it.
+ */
+static char*
+esch_float_format(uint64_t digits, int exponent, char* pos)
+{
+    char text[ESCH_FLOAT_FAST_DIGITS + 1];
+    char* end = text + sizeof(text);
+    char* first = NULL;
+    int length = 0;
+    int point = 0;
+
+    while (digits % 10 == 0)
+    {
+        digits /= 10;
+        ++exponent;
+    }
+    first = esch_float_print_digits(digits, end);
+    length = (int)(end - first);
+    /* Value is 0.ddd * 10^point. */
+    point = length + exponent;
+    if (point > -6 && point <= 21)
+    {
+        if (exponent >= 0)
+        {
+            memcpy(pos, first, (size_t)length);
+            pos += length;
+            memset(pos, '0', (size_t)exponent);
+            pos += exponent;
+            memcpy(pos, ".0", 2);
+            return pos + 2;
+        }
+        if (point > 0)
+        {
+            memcpy(pos, first, (size_t)point);
+            pos += point;
+            (*pos) = '.';
+            memcpy(pos + 1, first + point, (size_t)(length - point));
+            return pos + 1 + (length - point);
+        }
+        memcpy(pos, "0.", 2);
+        pos += 2;
+        memset(pos, '0', (size_t)-point);
+        pos += -point;
+        memcpy(pos, first, (size_t)length);
+        return pos + length;
+    }
+    (*pos) = (*first);
+    ++pos;
+    if (length > 1)
+    {
+        (*pos) = '.';
+        memcpy(pos + 1, first + 1, (size_t)(length - 1));
+        pos += length;
+    }
+    (*pos) = 'e';
+    ++pos;
+    if (point - 1 < 0)
+    {
+        (*pos) = '-';
+        ++pos;
+    }
+    first = esch_float_print_digits(
+                (uint64_t)(point - 1 < 0? 1 - point: point - 1), end);
+    memcpy(pos, first, (size_t)(end - first));
+    return pos + (end - first);
+}
+
+/*
+ * ---------------------------------------------------------------
+ * Public functions
+ * ---------------------------------------------------------------
+ */
+esch_error
+esch_float_from_base10(const char* begin, const char* end,
+                       double* value)
+{
+    esch_error ret = ESCH_OK;
+    struct esch_float_decimal dec;
+    uint64_t bits = 0;
+
+    ESCH_CHECK_PARAM_PUBLIC(begin != NULL);
+    ESCH_CHECK_PARAM_PUBLIC(value != NULL);
+    if (end == NULL)
+    {
+        end = begin + strlen(begin);
+    }
+    if (end - begin == 6 && (begin[0] == '+' || begin[0] == '-') &&
+        (memcmp(begin + 1, "inf.0", 5) == 0 ||
+         memcmp(begin + 1, "nan.0", 5) == 0))
+    {
+        bits = (begin[1] == 'i'? ESCH_FLOAT_INF_BITS:
+                                 ESCH_FLOAT_NAN_BITS);
+        dec.negative = (begin[0] == '-');
+    }
+    else
+    {
+        ESCH_CHECK_NO_LOG(esch_float_scan(begin, end, &dec),
+                          ESCH_ERROR_INVALID_PARAMETER);
+        bits = esch_float_decimal_to_bits(&dec);
+    }
+    if (dec.negative)
+    {
+        bits |= ESCH_FLOAT_SIGN_BIT;
+    }
+    memcpy(value, &bits, sizeof(bits));
+Exit:
+    return ret;
+}
+
+esch_error
+esch_float_to_base10(double value, char* buffer, size_t size,
+                     size_t* length)
+{
+    esch_error ret = ESCH_OK;
+    char text[ESCH_FLOAT_BASE10_SIZE];
+    char* pos = text;
+    uint64_t bits = 0;
+    uint64_t digits = 0;
+    int exponent = 0;
+    size_t len = 0;
+
+    ESCH_CHECK_PARAM_PUBLIC(buffer != NULL || size == 0);
+    ESCH_CHECK_PARAM_PUBLIC(length != NULL);
+    memcpy(&bits, &value, sizeof(bits));
+    if ((bits & ~ESCH_FLOAT_SIGN_BIT) > ESCH_FLOAT_INF_BITS)
+    {
+        memcpy(pos, "+nan.0", 6);
+        pos += 6;
+    }
+    else
+    {
+        if ((bits & ESCH_FLOAT_SIGN_BIT) != 0)
+        {
+            (*pos) = '-';
+            ++pos;
+            bits &= ~ESCH_FLOAT_SIGN_BIT;
+        }
+        if (bits == ESCH_FLOAT_INF_BITS)
+        {
+            if (pos == text)
+            {
+                (*pos) = '+';
+                ++pos;
+            }
+            memcpy(pos, "inf.0", 5);
+            pos += 5;
+        }
+        else if (bits == 0)
+        {
+            memcpy(pos, "0.0", 3);
+            pos += 3;
+        }
+        else
+        {
+            esch_float_bits_to_decimal(bits, &digits, &exponent);
+            pos = esch_float_format(digits, exponent, pos);
+        }
+    }
+    len = (size_t)(pos - text);
+    (*length) = len;
+    ESCH_CHECK_NO_LOG(len < size, ESCH_ERROR_OUT_OF_BOUND);
+    memcpy(buffer, text, len);
+    buffer[len] = '\0';
+Exit:
+    return ret;
+}
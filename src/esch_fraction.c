@@ -0,0 +1,659 @@
+/* vim:ft=c expandtab tw=72 sw=4
+ */
+/* See Copyright notice in esch.h */
+#include <string.h>
+#include <limits.h>
+#include "esch_number.h"
+#include "esch_type.h"
+#include "esch_config.h"
+#include "esch_alloc.h"
+#include "esch_log.h"
+#include "esch_debug.h"
+
+/*
+ * Fractions with both parts in int are computed in int64_t, which
+ * never overflows for one operation, and reduced by binary gcd on
+ * uint64_t. No limb is allocated on this path. Bigger fractions go
+ * through esch_integer_view and are reduced by Lehmer's gcd, see
+ * esch_bignum.c.
+ */
+
+struct esch_fraction_view
+{
+    struct esch_integer_view num;
+    struct esch_integer_view den;
+};
+
+enum esch_fraction_op
+{
+    ESCH_FRACTION_OP_ADD,
+    ESCH_FRACTION_OP_SUB,
+    ESCH_FRACTION_OP_MUL,
+    ESCH_FRACTION_OP_DIV
+};
+
+static esch_error
+esch_fraction_default_new(esch_config* config, esch_object** obj);
+static esch_error
+esch_fraction_destructor(esch_object* obj);
+
+struct esch_builtin_type esch_fraction_type =
+{
+    {
+        &(esch_meta_type.type),
+        NULL, /* No alloc */
+        &(esch_log_do_nothing.log),
+        NULL, /* Non-GC object */
+        NULL,
+    },
+    {
+        ESCH_VERSION,
+        sizeof(esch_fraction),
+        esch_fraction_default_new,
+        esch_fraction_destructor,
+        esch_type_default_non_copiable,
+        esch_type_default_no_string_form,
+        esch_type_default_no_doc,
+        esch_type_default_no_iterator
+    }
+};
+
+static esch_error
+esch_fraction_default_new(esch_config* config, esch_object** obj)
+{
+    esch_error ret = ESCH_OK;
+    esch_fraction* val = NULL;
+    ret = esch_fraction_new_from_int(config, 0, 1, &val);
+    if (ret == ESCH_OK)
+    {
+        (*obj) = ESCH_CAST_TO_OBJECT(val);
+    }
+    return ret;
+}
+
+static esch_error
+esch_fraction_destructor(esch_object* obj)
+{
+    esch_fraction* val = ESCH_CAST_FROM_OBJECT(obj, esch_fraction);
+    esch_error ret = ESCH_OK;
+    if (val->limbs != NULL)
+    {
+        ret = esch_alloc_free(ESCH_OBJECT_GET_ALLOC(obj), val->limbs);
+        val->limbs = NULL;
+    }
+    return ret;
+}
+
+static void
+esch_fraction_get_view_i(esch_fraction* val,
+                         struct esch_fraction_view* view)
+{
+    if (val->limbs != NULL)
+    {
+        view->num.negative = val->negative;
+        view->num.length = val->num_length;
+        view->num.limbs = val->limbs;
+        view->den.negative = ESCH_FALSE;
+        view->den.length = val->den_length;
+        view->den.limbs = val->limbs + val->num_length;
+    }
+    else
+    {
+        esch_integer_get_small_view_i(val->num, &(view->num));
+        esch_integer_get_small_view_i(val->den, &(view->den));
+    }
+}
+
+static uint64_t
+esch_fraction_wide_i(const esch_limb* a, size_t n)
+{
+    uint64_t value = (n > 0? a[0]: 0);
+    if (n > 1)
+    {
+        value |= (uint64_t)a[1] << ESCH_LIMB_BITS;
+    }
+    return value;
+}
+
+/*
+ * Create fraction from parts without common factor. Limbs are copied,
+ * and fraction becomes small when both parts fit in int.
+ */
+static esch_error
+esch_fraction_new_i(esch_config* config, esch_bool negative,
+                    const esch_limb* num, size_t nn,
+                    const esch_limb* den, size_t dn,
+                    esch_fraction** val)
+{
+    esch_error ret = ESCH_OK;
+    esch_alloc* alloc = NULL;
+    esch_log* log = NULL;
+    esch_object* obj = NULL;
+    esch_fraction* new_val = NULL;
+    esch_limb* limbs = NULL;
+    int small_num = 0;
+    int small_den = 0;
+
+    alloc = ESCH_CAST_FROM_OBJECT(ESCH_CONFIG_GET_ALLOC(config), esch_alloc);
+    log = ESCH_CAST_FROM_OBJECT(ESCH_CONFIG_GET_LOG(config), esch_log);
+    nn = esch_bignum_normalize_i(num, nn);
+    dn = esch_bignum_normalize_i(den, dn);
+    if (nn == 0)
+    {
+        negative = ESCH_FALSE;
+    }
+    if (!esch_integer_fits_int_i(negative, num, nn, &small_num) ||
+        !esch_integer_fits_int_i(ESCH_FALSE, den, dn, &small_den))
+    {
+        ret = esch_alloc_realloc(alloc, NULL,
+                                 sizeof(esch_limb) * (nn + dn),
+                                 (void**)&limbs);
+        ESCH_CHECK(ret == ESCH_OK, log, "Can't create limbs", ret);
+        memcpy(limbs, num, sizeof(esch_limb) * nn);
+        memcpy(limbs + nn, den, sizeof(esch_limb) * dn);
+        small_num = 0;
+        small_den = 0;
+    }
+    ret = esch_object_new_i(config, &(esch_fraction_type.type), &obj);
+    ESCH_CHECK(ret == ESCH_OK, log, "Can't create fraction", ret);
+    new_val = ESCH_CAST_FROM_OBJECT(obj, esch_fraction);
+    new_val->num = small_num;
+    new_val->den = small_den;
+    new_val->negative = negative;
+    new_val->num_length = (limbs != NULL? nn: 0);
+    new_val->den_length = (limbs != NULL? dn: 0);
+    new_val->limbs = limbs;
+    limbs = NULL;
+    (*val) = new_val;
+Exit:
+    (void)esch_alloc_free(alloc, limbs);
+    return ret;
+}
+
+/* Reduce parts in 64 bits, no limb allocated. */
+static esch_error
+esch_fraction_new_wide_i(esch_config* config, esch_bool negative,
+                         uint64_t num, uint64_t den, esch_fraction** val)
+{
+    esch_limb a[2];
+    esch_limb b[2];
+    uint64_t g = esch_bignum_gcd_64_i(num, den);
+
+    if (g > 1)
+    {
+        num /= g;
+        den /= g;
+    }
+    a[0] = (esch_limb)num;
+    a[1] = (esch_limb)(num >> ESCH_LIMB_BITS);
+    b[0] = (esch_limb)den;
+    b[1] = (esch_limb)(den >> ESCH_LIMB_BITS);
+    return esch_fraction_new_i(config, negative, a, 2, b, 2, val);
+}
+
+/* Create fraction from any parts. Denominator must not be 0. */
+static esch_error
+esch_fraction_reduce_i(esch_config* config, esch_bool negative,
+                       const esch_limb* num, size_t nn,
+                       const esch_limb* den, size_t dn,
+                       esch_fraction** val)
+{
+    esch_error ret = ESCH_OK;
+    esch_alloc* alloc = NULL;
+    esch_log* log = NULL;
+    esch_limb* buffer = NULL;
+    esch_limb* g = NULL;
+    esch_limb* q_num = NULL;
+    esch_limb* q_den = NULL;
+    esch_limb* scratch = NULL;
+    size_t long_n = 0;
+    size_t short_n = 0;
+    size_t gn = 0;
+
+    alloc = ESCH_CAST_FROM_OBJECT(ESCH_CONFIG_GET_ALLOC(config), esch_alloc);
+    log = ESCH_CAST_FROM_OBJECT(ESCH_CONFIG_GET_LOG(config), esch_log);
+    nn = esch_bignum_normalize_i(num, nn);
+    dn = esch_bignum_normalize_i(den, dn);
+    if (nn == 0)
+    {
+        ret = esch_fraction_new_wide_i(config, ESCH_FALSE, 0, 1, val);
+        goto Exit;
+    }
+    if (nn <= 2 && dn <= 2)
+    {
+        ret = esch_fraction_new_wide_i(config, negative,
+                                       esch_fraction_wide_i(num, nn),
+                                       esch_fraction_wide_i(den, dn),
+                                       val);
+        goto Exit;
+    }
+    long_n = (nn > dn? nn: dn);
+    short_n = (nn > dn? dn: nn);
+    /* One buffer: gcd, both quotients, then scratch of both steps. */
+    ret = esch_alloc_realloc(alloc, NULL, sizeof(esch_limb) *
+                             (short_n + nn + dn +
+                              ESCH_BIGNUM_GCD_SCRATCH(long_n) +
+                              ESCH_BIGNUM_DIVMOD_SCRATCH(long_n, short_n)),
+                             (void**)&buffer);
+    ESCH_CHECK(ret == ESCH_OK, log, "Can't create limbs", ret);
+    g = buffer;
+    q_num = g + short_n;
+    q_den = q_num + nn;
+    scratch = q_den + dn;
+    if (esch_bignum_compare_i(num, nn, den, dn) >= 0)
+    {
+        gn = esch_bignum_gcd_i(g, num, nn, den, dn, scratch);
+    }
+    else
+    {
+        gn = esch_bignum_gcd_i(g, den, dn, num, nn, scratch);
+    }
+    if (gn == 1 && g[0] == 1)
+    {
+        ret = esch_fraction_new_i(config, negative, num, nn, den, dn, val);
+        goto Exit;
+    }
+    /* Division is exact, remainders are dropped. */
+    memset(q_num, 0, sizeof(esch_limb) * (nn + dn));
+    if (gn == 1)
+    {
+        (void)esch_bignum_divmod_1_i(q_num, num, nn, g[0]);
+        (void)esch_bignum_divmod_1_i(q_den, den, dn, g[0]);
+    }
+    else
+    {
+        esch_bignum_divmod_i(q_num, NULL, num, nn, g, gn, scratch);
+        esch_bignum_divmod_i(q_den, NULL, den, dn, g, gn, scratch);
+    }
+    ret = esch_fraction_new_i(config, negative, q_num, nn, q_den, dn, val);
+Exit:
+    (void)esch_alloc_free(alloc, buffer);
+    return ret;
+}
+
+/* Operation on any fractions, through integer views. */
+static esch_error
+esch_fraction_arith_i(esch_config* config, enum esch_fraction_op op,
+                      esch_fraction* val1, esch_fraction* val2,
+                      esch_fraction** val)
+{
+    esch_error ret = ESCH_OK;
+    esch_alloc* alloc = NULL;
+    esch_log* log = NULL;
+    struct esch_fraction_view a;
+    struct esch_fraction_view b;
+    struct esch_integer_view p;
+    struct esch_integer_view q;
+    esch_limb* p_limbs = NULL;
+    esch_limb* q_limbs = NULL;
+    esch_limb* n_limbs = NULL;
+    esch_limb* d_limbs = NULL;
+    size_t n_length = 0;
+    size_t d_length = 0;
+    esch_bool n_negative = ESCH_FALSE;
+    esch_bool d_negative = ESCH_FALSE;
+
+    alloc = ESCH_CAST_FROM_OBJECT(ESCH_CONFIG_GET_ALLOC(config), esch_alloc);
+    log = ESCH_CAST_FROM_OBJECT(ESCH_CONFIG_GET_LOG(config), esch_log);
+    esch_fraction_get_view_i(val1, &a);
+    esch_fraction_get_view_i(val2, &b);
+    if (op == ESCH_FRACTION_OP_ADD || op == ESCH_FRACTION_OP_SUB)
+    {
+        /* n1/d1 + n2/d2 = (n1 * d2 + n2 * d1) / (d1 * d2) */
+        ret = esch_integer_mul_i(config, &(a.num), &(b.den),
+                                 &(p.negative), &p_limbs, &(p.length));
+        ESCH_CHECK(ret == ESCH_OK, log, "Can't multiply", ret);
+        ret = esch_integer_mul_i(config, &(b.num), &(a.den),
+                                 &(q.negative), &q_limbs, &(q.length));
+        ESCH_CHECK(ret == ESCH_OK, log, "Can't multiply", ret);
+        p.limbs = p_limbs;
+        p.length = esch_bignum_normalize_i(p_limbs, p.length);
+        q.limbs = q_limbs;
+        q.length = esch_bignum_normalize_i(q_limbs, q.length);
+        if (op == ESCH_FRACTION_OP_SUB)
+        {
+            q.negative = !q.negative;
+        }
+        ret = esch_integer_add_i(config, &p, &q,
+                                 &n_negative, &n_limbs, &n_length);
+        ESCH_CHECK(ret == ESCH_OK, log, "Can't add", ret);
+        ret = esch_integer_mul_i(config, &(a.den), &(b.den),
+                                 &d_negative, &d_limbs, &d_length);
+        ESCH_CHECK(ret == ESCH_OK, log, "Can't multiply", ret);
+    }
+    else
+    {
+        /* Division multiplies by reciprocal, sign goes to numerator. */
+        ret = esch_integer_mul_i(config, &(a.num),
+                                 (op == ESCH_FRACTION_OP_MUL?
+                                  &(b.num): &(b.den)),
+                                 &n_negative, &n_limbs, &n_length);
+        ESCH_CHECK(ret == ESCH_OK, log, "Can't multiply", ret);
+        ret = esch_integer_mul_i(config, &(a.den),
+                                 (op == ESCH_FRACTION_OP_MUL?
+                                  &(b.den): &(b.num)),
+                                 &d_negative, &d_limbs, &d_length);
+        ESCH_CHECK(ret == ESCH_OK, log, "Can't multiply", ret);
+        n_negative = (n_negative != d_negative);
+    }
+    ret = esch_fraction_reduce_i(config, n_negative, n_limbs, n_length,
+                                 d_limbs, d_length, val);
+Exit:
+    (void)esch_alloc_free(alloc, p_limbs);
+    (void)esch_alloc_free(alloc, q_limbs);
+    (void)esch_alloc_free(alloc, n_limbs);
+    (void)esch_alloc_free(alloc, d_limbs);
+    return ret;
+}
+
+static esch_error
+esch_fraction_op_i(esch_config* config, enum esch_fraction_op op,
+                   esch_fraction* val1, esch_fraction* val2,
+                   esch_fraction** val)
+{
+    esch_error ret = ESCH_OK;
+    esch_log* log = NULL;
+    int64_t num = 0;
+    int64_t den = 0;
+
+    ESCH_CHECK_PARAM_PUBLIC(config != NULL);
+    ESCH_CHECK_PARAM_PUBLIC(ESCH_IS_VALID_FRACTION(val1));
+    ESCH_CHECK_PARAM_PUBLIC(ESCH_IS_VALID_FRACTION(val2));
+    ESCH_CHECK_PARAM_PUBLIC(val != NULL);
+    ESCH_CHECK_PARAM_PUBLIC(ESCH_CONFIG_GET_ALLOC(config) != NULL);
+    ESCH_CHECK_PARAM_PUBLIC(ESCH_CONFIG_GET_LOG(config) != NULL);
+    log = ESCH_CAST_FROM_OBJECT(ESCH_CONFIG_GET_LOG(config), esch_log);
+    ESCH_CHECK(op != ESCH_FRACTION_OP_DIV ||
+               (ESCH_FRACTION_IS_BIG(val2) || val2->num != 0), log,
+               "fraction:div: Divided by zero",
+               ESCH_ERROR_INVALID_PARAMETER);
+    if (ESCH_FRACTION_IS_BIG(val1) || ESCH_FRACTION_IS_BIG(val2))
+    {
+        ret = esch_fraction_arith_i(config, op, val1, val2, val);
+        goto Exit;
+    }
+    /* Parts are below 2^31, so each product and sum fits in int64_t. */
+    if (op == ESCH_FRACTION_OP_ADD)
+    {
+        num = (int64_t)val1->num * val2->den +
+              (int64_t)val2->num * val1->den;
+        den = (int64_t)val1->den * val2->den;
+    }
+    else if (op == ESCH_FRACTION_OP_SUB)
+    {
+        num = (int64_t)val1->num * val2->den -
+              (int64_t)val2->num * val1->den;
+        den = (int64_t)val1->den * val2->den;
+    }
+    else if (op == ESCH_FRACTION_OP_MUL)
+    {
+        num = (int64_t)val1->num * val2->num;
+        den = (int64_t)val1->den * val2->den;
+    }
+    else
+    {
+        num = (int64_t)val1->num * val2->den;
+        den = (int64_t)val1->den * val2->num;
+        if (den < 0)
+        {
+            num = -num;
+            den = -den;
+        }
+    }
+    /* Negate in unsigned: magnitude can be 2^62. */
+    ret = esch_fraction_new_wide_i(config, (num < 0),
+                                   (num < 0? 0 - (uint64_t)num:
+                                             (uint64_t)num),
+                                   (uint64_t)den, val);
+Exit:
+    return ret;
+}
+
+esch_error
+esch_fraction_new(esch_config* config, esch_integer* numerator,
+                  esch_integer* denominator, esch_fraction** val)
+{
+    esch_error ret = ESCH_OK;
+    esch_log* log = NULL;
+    struct esch_integer_view num;
+    struct esch_integer_view den;
+
+    ESCH_CHECK_PARAM_PUBLIC(config != NULL);
+    ESCH_CHECK_PARAM_PUBLIC(ESCH_IS_VALID_INTEGER(numerator));
+    ESCH_CHECK_PARAM_PUBLIC(ESCH_IS_VALID_INTEGER(denominator));
+    ESCH_CHECK_PARAM_PUBLIC(val != NULL);
+    ESCH_CHECK_PARAM_PUBLIC(ESCH_CONFIG_GET_ALLOC(config) != NULL);
+    ESCH_CHECK_PARAM_PUBLIC(ESCH_CONFIG_GET_LOG(config) != NULL);
+    log = ESCH_CAST_FROM_OBJECT(ESCH_CONFIG_GET_LOG(config), esch_log);
+    esch_integer_get_view_i(numerator, &num);
+    esch_integer_get_view_i(denominator, &den);
+    ESCH_CHECK(den.length > 0, log, "fraction:new: Zero denominator",
+               ESCH_ERROR_INVALID_PARAMETER);
+    ret = esch_fraction_reduce_i(config, num.negative != den.negative,
+                                 num.limbs, num.length,
+                                 den.limbs, den.length, val);
+Exit:
+    return ret;
+}
+
+esch_error
+esch_fraction_new_from_int(esch_config* config, int numerator,
+                           int denominator, esch_fraction** val)
+{
+    esch_error ret = ESCH_OK;
+    esch_log* log = NULL;
+    uint64_t num = 0;
+    uint64_t den = 0;
+
+    ESCH_CHECK_PARAM_PUBLIC(config != NULL);
+    ESCH_CHECK_PARAM_PUBLIC(val != NULL);
+    ESCH_CHECK_PARAM_PUBLIC(ESCH_CONFIG_GET_ALLOC(config) != NULL);
+    ESCH_CHECK_PARAM_PUBLIC(ESCH_CONFIG_GET_LOG(config) != NULL);
+    log = ESCH_CAST_FROM_OBJECT(ESCH_CONFIG_GET_LOG(config), esch_log);
+    ESCH_CHECK(denominator != 0, log, "fraction:new: Zero denominator",
+               ESCH_ERROR_INVALID_PARAMETER);
+    num = (numerator < 0? 0 - (uint64_t)(int64_t)numerator:
+                          (uint64_t)numerator);
+    den = (denominator < 0? 0 - (uint64_t)(int64_t)denominator:
+                            (uint64_t)denominator);
+    ret = esch_fraction_new_wide_i(config,
+                                   (numerator < 0) != (denominator < 0),
+                                   num, den, val);
+Exit:
+    return ret;
+}
+
+static esch_error
+esch_fraction_get_part_i(esch_config* config, esch_fraction* val,
+                         esch_bool numerator, esch_integer** part)
+{
+    esch_error ret = ESCH_OK;
+    esch_alloc* alloc = NULL;
+    struct esch_fraction_view view;
+    struct esch_integer_view* src = NULL;
+    esch_limb* limbs = NULL;
+
+    ESCH_CHECK_PARAM_PUBLIC(config != NULL);
+    ESCH_CHECK_PARAM_PUBLIC(ESCH_IS_VALID_FRACTION(val));
+    ESCH_CHECK_PARAM_PUBLIC(part != NULL);
+    ESCH_CHECK_PARAM_PUBLIC(ESCH_CONFIG_GET_ALLOC(config) != NULL);
+    ESCH_CHECK_PARAM_PUBLIC(ESCH_CONFIG_GET_LOG(config) != NULL);
+    if (!ESCH_FRACTION_IS_BIG(val))
+    {
+        ret = esch_integer_new_from_int(config,
+                                        (numerator? val->num: val->den),
+                                        part);
+        goto Exit;
+    }
+    alloc = ESCH_CAST_FROM_OBJECT(ESCH_CONFIG_GET_ALLOC(config), esch_alloc);
+    esch_fraction_get_view_i(val, &view);
+    src = (numerator? &(view.num): &(view.den));
+    /* Copy, since integer takes over limbs. It can become small. */
+    ret = esch_alloc_realloc(alloc, NULL,
+                             sizeof(esch_limb) * (src->length + 1),
+                             (void**)&limbs);
+    if (ret != ESCH_OK)
+    {
+        goto Exit;
+    }
+    memcpy(limbs, src->limbs, sizeof(esch_limb) * src->length);
+    ret = esch_integer_new_from_limbs_i(config, src->negative,
+                                        limbs, src->length, part);
+Exit:
+    return ret;
+}
+
+esch_error
+esch_fraction_get_numerator(esch_config* config, esch_fraction* val,
+                            esch_integer** part)
+{
+    return esch_fraction_get_part_i(config, val, ESCH_TRUE, part);
+}
+
+esch_error
+esch_fraction_get_denominator(esch_config* config, esch_fraction* val,
+                              esch_integer** part)
+{
+    return esch_fraction_get_part_i(config, val, ESCH_FALSE, part);
+}
+
+esch_error
+esch_fraction_add(esch_config* config, esch_fraction* val1,
+                  esch_fraction* val2, esch_fraction** val)
+{
+    return esch_fraction_op_i(config, ESCH_FRACTION_OP_ADD,
+                              val1, val2, val);
+}
+
+esch_error
+esch_fraction_sub(esch_config* config, esch_fraction* val1,
+                  esch_fraction* val2, esch_fraction** val)
+{
+    return esch_fraction_op_i(config, ESCH_FRACTION_OP_SUB,
+                              val1, val2, val);
+}
+
+esch_error
+esch_fraction_mul(esch_config* config, esch_fraction* val1,
+                  esch_fraction* val2, esch_fraction** val)
+{
+    return esch_fraction_op_i(config, ESCH_FRACTION_OP_MUL,
+                              val1, val2, val);
+}
+
+esch_error
+esch_fraction_div(esch_config* config, esch_fraction* val1,
+                  esch_fraction* val2, esch_fraction** val)
+{
+    return esch_fraction_op_i(config, ESCH_FRACTION_OP_DIV,
+                              val1, val2, val);
+}
+
+esch_error
+esch_fraction_compare(esch_fraction* val1, esch_fraction* val2,
+                      int* result)
+{
+    esch_error ret = ESCH_OK;
+    esch_alloc* alloc = NULL;
+    esch_log* log = NULL;
+    struct esch_fraction_view a;
+    struct esch_fraction_view b;
+    esch_limb* p = NULL;
+    esch_limb* q = NULL;
+    int64_t x = 0;
+    int64_t y = 0;
+    int sign_a = 0;
+    int sign_b = 0;
+    int cmp = 0;
+
+    ESCH_CHECK_PARAM_PUBLIC(ESCH_IS_VALID_FRACTION(val1));
+    ESCH_CHECK_PARAM_PUBLIC(ESCH_IS_VALID_FRACTION(val2));
+    ESCH_CHECK_PARAM_PUBLIC(result != NULL);
+    alloc = ESCH_OBJECT_GET_ALLOC(ESCH_CAST_TO_OBJECT(val1));
+    log = ESCH_OBJECT_GET_LOG(ESCH_CAST_TO_OBJECT(val1));
+    if (!ESCH_FRACTION_IS_BIG(val1) && !ESCH_FRACTION_IS_BIG(val2))
+    {
+        x = (int64_t)val1->num * val2->den;
+        y = (int64_t)val2->num * val1->den;
+        (*result) = (x < y? -1: (x > y? 1: 0));
+        goto Exit;
+    }
+    esch_fraction_get_view_i(val1, &a);
+    esch_fraction_get_view_i(val2, &b);
+    sign_a = (a.num.length == 0? 0: (a.num.negative? -1: 1));
+    sign_b = (b.num.length == 0? 0: (b.num.negative? -1: 1));
+    if (sign_a != sign_b || sign_a == 0)
+    {
+        (*result) = (sign_a < sign_b? -1: (sign_a > sign_b? 1: 0));
+        goto Exit;
+    }
+    /* Same sign: compare |n1| * d2 with |n2| * d1. */
+    ret = esch_alloc_realloc(alloc, NULL, sizeof(esch_limb) *
+                             (a.num.length + b.den.length),
+                             (void**)&p);
+    ESCH_CHECK(ret == ESCH_OK, log, "Can't create limbs", ret);
+    ret = esch_alloc_realloc(alloc, NULL, sizeof(esch_limb) *
+                             (b.num.length + a.den.length),
+                             (void**)&q);
+    ESCH_CHECK(ret == ESCH_OK, log, "Can't create limbs", ret);
+    ret = esch_integer_mul_limbs_i(alloc, log, p,
+                                   a.num.limbs, a.num.length,
+                                   b.den.limbs, b.den.length);
+    ESCH_CHECK(ret == ESCH_OK, log, "Can't multiply", ret);
+    ret = esch_integer_mul_limbs_i(alloc, log, q,
+                                   b.num.limbs, b.num.length,
+                                   a.den.limbs, a.den.length);
+    ESCH_CHECK(ret == ESCH_OK, log, "Can't multiply", ret);
+    cmp = esch_bignum_compare_i(
+              p, esch_bignum_normalize_i(p, a.num.length + b.den.length),
+              q, esch_bignum_normalize_i(q, b.num.length + a.den.length));
+    (*result) = (sign_a < 0? -cmp: cmp);
+Exit:
+    (void)esch_alloc_free(alloc, p);
+    (void)esch_alloc_free(alloc, q);
+    return ret;
+}
+
+esch_error
+esch_fraction_to_base10(esch_fraction* val, char* buffer, size_t size,
+                        size_t* length)
+{
+    esch_error ret = ESCH_OK;
+    esch_alloc* alloc = NULL;
+    esch_log* log = NULL;
+    struct esch_fraction_view view;
+    size_t num_length = 0;
+    size_t den_length = 0;
+    size_t room = 0;
+
+    ESCH_CHECK_PARAM_PUBLIC(ESCH_IS_VALID_FRACTION(val));
+    ESCH_CHECK_PARAM_PUBLIC(buffer != NULL || size == 0);
+    ESCH_CHECK_PARAM_PUBLIC(length != NULL);
+    alloc = ESCH_OBJECT_GET_ALLOC(ESCH_CAST_TO_OBJECT(val));
+    log = ESCH_OBJECT_GET_LOG(ESCH_CAST_TO_OBJECT(val));
+    esch_fraction_get_view_i(val, &view);
+    ret = esch_integer_view_to_base10_i(alloc, log, &(view.num),
+                                        buffer, size, &num_length);
+    ESCH_CHECK(ret == ESCH_OK || ret == ESCH_ERROR_OUT_OF_BOUND, log,
+               "Can't print numerator", ret);
+    (*length) = num_length;
+    if (view.den.length == 1 && view.den.limbs[0] == 1)
+    {
+        goto Exit;
+    }
+    /* Denominator goes after '/', with what is left in buffer. */
+    room = (size > num_length + 1? size - num_length - 1: 0);
+    ret = esch_integer_view_to_base10_i(alloc, log, &(view.den),
+                                        (room > 0?
+                                         buffer + num_length + 1: NULL),
+                                        room, &den_length);
+    ESCH_CHECK(ret == ESCH_OK || ret == ESCH_ERROR_OUT_OF_BOUND, log,
+               "Can't print denominator", ret);
+    (*length) = num_length + 1 + den_length;
+    if (ret == ESCH_OK)
+    {
+        buffer[num_length] = '/';
+    }
+Exit:
+    return ret;
+}
@@ -5,6 +5,7 @@
 #include "esch_log.h"
 #include "esch_alloc.h"
 #include "esch_debug.h"
+#include "esch_trace.h"
 #include <string.h>
 
 #define ROOT_INDEX 0
@@ -107,7 +108,7 @@ esch_gc_naive_mark_sweep_attach_i(esch_gc* gc, esch_object* obj)
     ESCH_ASSERT(ESCH_IS_VALID_LOG(log));
 
     if (obj->gc == gc) {
-        esch_log_info(log, "gc:attach: Already attached. Do nothing.");
+        ESCH_LOG_INFO(log, "gc:attach: Already attached. Do nothing.");
         goto Exit;
     }
 
@@ -124,7 +125,7 @@ esch_gc_naive_mark_sweep_attach_i(esch_gc* gc, esch_object* obj)
             /* Running out of slots. */
             int i = 0;
             new_count = gc->slot_count * 2;
-            (void)esch_log_info(log,
+            ESCH_LOG_INFO_2(log,
                     "gc:attach: No more slot. Reallocate. %d -> %d",
                     gc->slot_count, new_count);
 
@@ -169,8 +170,7 @@ esch_gc_naive_mark_sweep_attach_i(esch_gc* gc, esch_object* obj)
         }
     }
     new_offset = gc->usable_slot;
-    (void)esch_log_info(log,
-            "gc:attach:Allocate new slot: id: %d", new_offset);
+    ESCH_LOG_INFO_1(log, "gc:attach:Allocate new slot: id: %d", new_offset);
 
     gc->usable_slot = gc->slots[gc->usable_slot].next;
     allocated_slot = &(gc->slots[new_offset].obj);
@@ -178,6 +178,8 @@ esch_gc_naive_mark_sweep_attach_i(esch_gc* gc, esch_object* obj)
 
     obj->gc = gc;
     obj->gc_id = (void*)new_offset;
+    ESCH_TRACE(ESCH_TRACE_GC_ATTACH, ESCH_OBJECT_GET_TYPE(obj), 0,
+               obj->gc_id);
 Exit:
     esch_alloc_free_i(alloc, new_slots);
     esch_alloc_free_i(alloc, new_flags);
@@ -185,6 +187,20 @@ Exit:
     return ret;
 }
 
+/*
+ * Move iterator to next element. Return ESCH_FALSE if it does not move,
+ * like a pair whose tail is itself.
+ */
+static esch_bool
+esch_gc_iterator_next_i(esch_iterator* iter, esch_object* visiting)
+{
+    void* position = iter->iterator;
+    esch_error ret = iter->get_next(iter);
+    ESCH_ASSERT(ret == ESCH_OK);
+    (void)ret;
+    return (iter->container != visiting || iter->iterator != position);
+}
+
 static esch_error
 esch_gc_naive_mark_sweep_recycle_i(esch_gc* gc)
 {
@@ -192,7 +208,9 @@ esch_gc_naive_mark_sweep_recycle_i(esch_gc* gc)
     esch_log* log = NULL;
     esch_value element = { ESCH_VALUE_TYPE_END, 0 };
     esch_object* child = NULL;
-    esch_object** stack_ptr = NULL;
+    esch_object* current = NULL;
+    esch_object* visiting = NULL;
+    size_t depth = 0;
     esch_type* element_type = NULL;
     esch_iterator iter = {0};
     size_t i = 0;
@@ -219,6 +237,7 @@ esch_gc_naive_mark_sweep_recycle_i(esch_gc* gc)
      *
      * Meanwhile, recycle_stack is also used to store unused objects
      */
+    ESCH_TRACE(ESCH_TRACE_GC_MARK_BEGIN, NULL, gc->slot_count, NULL);
     /* Step 1: Mark every object as deletable. */
     memset(gc->inuse_flags, 0, gc->slot_count / 8);
     /* Step 1.5: Keep non-allocated slots out of deletable list. This
@@ -239,26 +258,51 @@ esch_gc_naive_mark_sweep_recycle_i(esch_gc* gc)
      * as in-use.
      */
     if (gc->root == NULL) {
-        esch_log_info(log, "gc:recycle: Trigger GC from dtor");
+        ESCH_LOG_INFO(log, "gc:recycle: Trigger GC from dtor");
         ESCH_ASSERT(!ESCH_GC_IS_MARKED(gc, 0));
     } else {
-        esch_log_info(log, "gc:recycle: Trigger GC on root: %x", gc->root);
+        ESCH_LOG_INFO_1(log, "gc:recycle: Trigger GC on root: %x", gc->root);
         ESCH_ASSERT(ESCH_TYPE_IS_CONTAINER(ESCH_OBJECT_GET_TYPE(gc->root)));
-        stack_ptr = &(gc->recycle_stack[0]);
-        (*stack_ptr) = gc->root; /* Root is always in use */
+        depth = 0;
+        gc->recycle_stack[depth++] = gc->root; /* Root is always in use */
+        ESCH_GC_MARK_INUSE(gc, gc->root->gc_id);
         do {
-            ret = esch_object_get_iterator_i(*stack_ptr, &iter);
+            /* Pop current node before visiting it. Children pushed
+             * below are visited in following rounds. */
+            current = gc->recycle_stack[--depth];
+            gc->recycle_stack[depth] = NULL;
+            ret = esch_object_get_iterator_i(current, &iter);
             ESCH_ASSERT(ret == ESCH_OK);
-            ESCH_GC_MARK_INUSE(gc, (*stack_ptr)->gc_id);
+            visiting = current;
             while(ESCH_TRUE) {
+                if (iter.container != visiting) {
+                    /* Iterator moves on to another object, such as next
+                     * pair of a list. It's reachable as well. If it's
+                     * marked, rest of it is (or will be) visited from
+                     * elsewhere, which also ends a circular list. */
+                    visiting = iter.container;
+                    ESCH_ASSERT(visiting->gc == gc);
+                    if (ESCH_GC_IS_MARKED(gc, visiting->gc_id)) {
+                        break;
+                    }
+                    ESCH_GC_MARK_INUSE(gc, visiting->gc_id);
+                }
+                if (iter.seek_object != NULL) {
+                    /* Container can skip primitive values by itself,
+                     * which is faster than checking them one by one. */
+                    ret = iter.seek_object(&iter);
+                    ESCH_ASSERT(ret == ESCH_OK);
+                }
                 ret = iter.get_value(&iter, &element);
                 ESCH_ASSERT(ret == ESCH_OK);
                 if (element.type == ESCH_VALUE_TYPE_END) {
-                    esch_log_info(log, "gc:recycle: end of objects.");
+                    ESCH_LOG_INFO(log, "gc:recycle: end of objects.");
                     break;
                 } else if (element.type != ESCH_VALUE_TYPE_OBJECT) {
-                    esch_log_info(log, "gc:recycle: primitive type, skip.");
-                    ret = iter.get_next(&iter);
+                    ESCH_LOG_INFO(log, "gc:recycle: primitive type, skip.");
+                    if (!esch_gc_iterator_next_i(&iter, visiting)) {
+                        break;
+                    }
                     continue;
                 }
                 /* IMPORTANT
@@ -274,21 +318,24 @@ esch_gc_naive_mark_sweep_recycle_i(esch_gc* gc)
                 element_type = ESCH_OBJECT_GET_TYPE(child);
                 ESCH_ASSERT(element_type != NULL);
                 ESCH_ASSERT(ESCH_IS_VALID_TYPE(element_type));
-                /* Never mark twice so we won't fall into endless
-                 * loop if we hit a reference circle. */
-                if (!ESCH_GC_IS_MARKED(gc, child->gc_id)) {
+                /* Never mark (or push) twice so we won't fall into
+                 * endless loop if we hit a reference circle. It also
+                 * keeps stack depth within slot count. */
+                if (ESCH_GC_IS_MARKED(gc, child->gc_id)) {
+                    ESCH_LOG_INFO(log, "gc:recycle: visited, skip.");
+                } else if (ESCH_TYPE_IS_CONTAINER(element_type)) {
+                    ESCH_LOG_INFO(log, "gc:recycle: container:stack.");
                     ESCH_GC_MARK_INUSE(gc, child->gc_id);
-                }
-                if (ESCH_TYPE_IS_CONTAINER(element_type)) {
-                    esch_log_info(log, "gc:recycle: container:stack.");
-                    (*(++stack_ptr)) = child;
+                    gc->recycle_stack[depth++] = child;
                 } else {
-                    esch_log_info(log, "gc:recycle: non-container:mark.");
+                    ESCH_LOG_INFO(log, "gc:recycle: non-container:mark.");
+                    ESCH_GC_MARK_INUSE(gc, child->gc_id);
+                }
+                if (!esch_gc_iterator_next_i(&iter, visiting)) {
+                    break;
                 }
-                ret = iter.get_next(&iter);
             }
-            (*(stack_ptr--)) = NULL; // Done for current node.
-        } while(stack_ptr != &(gc->recycle_stack[0]));
+        } while(depth > 0);
         /* TODO Optimization: Don't always trigger GC so fast. We may
          * consider cancel GC if the memory slot is enough. But it does
          * not have to be implemented in GC.
@@ -298,6 +345,7 @@ esch_gc_naive_mark_sweep_recycle_i(esch_gc* gc)
         ESCH_ASSERT(gc->slots[ROOT_INDEX].obj == gc->root);
         ESCH_GC_MARK_INUSE(gc, gc->slots[ROOT_INDEX].obj->gc_id);
     }
+    ESCH_TRACE(ESCH_TRACE_GC_SWEEP_BEGIN, NULL, gc->slot_count, NULL);
     /*
      * Step 3: Delete all objects marked as deletable.
      * NOTE: When destructor calls recycle(), it directly comes to here,
@@ -314,7 +362,7 @@ esch_gc_naive_mark_sweep_recycle_i(esch_gc* gc)
             gc->slots[i].obj->gc_id = 0;
             ret = esch_object_delete_i(gc->slots[i].obj);
             if (ret != ESCH_OK) {
-                esch_log_warn(log,
+                ESCH_LOG_WARN_1(log,
                         "gc:recycle: Can't delete object: %x (ignore)",
                         gc->slots[i].obj);
             }
@@ -323,6 +371,7 @@ esch_gc_naive_mark_sweep_recycle_i(esch_gc* gc)
             ++free_objs;
         }
     }
+    ESCH_TRACE(ESCH_TRACE_GC_RECYCLE_END, NULL, free_objs, NULL);
     if (free_objs == 0) {
         /*
          * Wow. It's not really wrong thing, but all objects
@@ -330,9 +379,9 @@ esch_gc_naive_mark_sweep_recycle_i(esch_gc* gc)
          * out of stock. What happen to caller's code to make it use so
          * much memory?
          */
-        esch_log_warn(log, "gc:recycle: 0 object freed. Check memory usage.");
+        ESCH_LOG_WARN(log, "gc:recycle: 0 object freed. Check memory usage.");
     } else {
-        esch_log_info(log, "gc:recycle: %d objects are freed.", free_objs);
+        ESCH_LOG_INFO_1(log, "gc:recycle: %d objects are freed.", free_objs);
     }
     return ret;
 }
@@ -368,7 +417,7 @@ esch_gc_new_naive_mark_sweep_i(esch_config* config, esch_object** gc)
     ESCH_ASSERT(root->gc == NULL);
 
     /* Now create object */
-    (void)esch_log_info(log, "GC:new: Prepare slots");
+    ESCH_LOG_INFO(log, "GC:new: Prepare slots");
     ret = esch_alloc_realloc_i(alloc, NULL, (initial_slots / 8),
                                (void**)&inuse_flags);
     ESCH_CHECK(ret == ESCH_OK, log, "GC:naive_new:Can't create flags", ret);
@@ -382,7 +431,7 @@ esch_gc_new_naive_mark_sweep_i(esch_config* config, esch_object** gc)
                     (void**)&recycle_stack);
     ESCH_CHECK(ret == ESCH_OK, log, "GC:naive_new:Can't create stack", ret);
 
-    (void)esch_log_info(log, "GC: Create objects");
+    ESCH_LOG_INFO(log, "GC: Create objects");
     ret = esch_object_new_i(config, &(esch_gc_type.type), &new_obj);
     ESCH_CHECK(ret == ESCH_OK, log, "GC:Can't create gc object", ret);
     new_gc = ESCH_CAST_FROM_OBJECT(new_obj, esch_gc);
@@ -465,16 +514,16 @@ esch_gc_new_naive_mark_sweep(esch_config* config, esch_gc** gc)
             ESCH_ERROR_OBJECT_UNEXPECTED_GC_ATTACHED);
 
     /* Now we can create object */
-    esch_log_info(log, "GC:new_naive: Create GC object.");
+    ESCH_LOG_INFO(log, "GC:new_naive: Create GC object.");
     ret = esch_gc_new_naive_mark_sweep_i(config, &new_gc_obj);
     ESCH_CHECK(ret == ESCH_OK, log, "GC:new_naive: Can't create GC", ret);
 
     (*gc) = ESCH_CAST_FROM_OBJECT(new_gc_obj, esch_gc);
     new_gc_obj = NULL;
-    esch_log_info(log, "GC:new_naive: GC object created.");
+    ESCH_LOG_INFO(log, "GC:new_naive: GC object created.");
 Exit:
     if (new_gc_obj != NULL) {
-        esch_log_info(log, "GC:new_naive: On error: delete GC object.");
+        ESCH_LOG_INFO(log, "GC:new_naive: On error: delete GC object.");
         esch_object_delete(new_gc_obj);
     }
     return ret;
@@ -105,6 +105,7 @@ struct esch_gc
     size_t slot_count;
 };
 
+extern struct esch_builtin_type esch_gc_type;
 extern const int ESCH_GC_NAIVE_DEFAULT_SLOTS;
 
 #define ESCH_IS_VALID_GC(gc) \
@@ -0,0 +1,1108 @@
+/* vim:ft=c expandtab tw=72 sw=4
+ */
+/* See Copyright notice in esch.h */
+#include "esch_hashtable.h"
+#include "esch_string.h"
+#include "esch_number.h"
+#include "esch_pair.h"
+#include "esch_vector.h"
+#include "esch_config.h"
+#include "esch_alloc.h"
+#include "esch_log.h"
+#include "esch_type.h"
+#include "esch_debug.h"
+#include <string.h>
+
+const size_t ESCH_HASHTABLE_INITIAL_SLOTS = 16;
+
+static esch_error
+esch_hashtable_new_as_object_i(esch_config* config, esch_object** obj);
+static esch_error
+esch_hashtable_destructor_i(esch_object* obj);
+static esch_error
+esch_hashtable_get_iterator_i(esch_object* obj, esch_iterator* iter);
+static esch_error
+esch_hashtable_new_i(esch_config* config, esch_hashtable_kind kind,
+                     esch_hashtable** table);
+static esch_error
+esch_hashtable_hash_i(esch_hashtable* table, esch_value* key,
+                      uint32_t* hash);
+static size_t
+esch_hashtable_find_i(esch_hashtable* table,
+                      struct esch_hashtable_entry* entries, size_t slots,
+                      esch_value* key, uint32_t hash);
+static void
+esch_hashtable_insert_i(struct esch_hashtable_entry* entries,
+                        size_t slots,
+                        struct esch_hashtable_entry* incoming);
+static void
+esch_hashtable_remove_i(struct esch_hashtable_entry* entries,
+                        size_t slots, size_t index);
+static void
+esch_hashtable_move_i(esch_hashtable* table, size_t step);
+static esch_error
+esch_hashtable_reserve_i(esch_hashtable* table);
+
+struct esch_builtin_type esch_hashtable_type =
+{
+    {
+        &(esch_meta_type.type),
+        NULL, /* No alloc */
+        &(esch_log_do_nothing.log),
+        NULL, /* Non-GC object */
+        NULL,
+    },
+    {
+        ESCH_VERSION,
+        sizeof(esch_hashtable),
+        esch_hashtable_new_as_object_i,
+        esch_hashtable_destructor_i,
+        esch_type_default_non_copiable,
+        esch_type_default_no_string_form,
+        esch_type_default_no_doc,
+        esch_hashtable_get_iterator_i
+    },
+};
+
+#define ESCH_HASHTABLE_CHECK_VALUE(v) \
+    ((v) != NULL && \
+     (v)->type > ESCH_VALUE_TYPE_UNKNOWN && \
+     (v)->type < ESCH_VALUE_TYPE_END)
+
+/*
+ * ---------------------------------------------------------------
+ * Public interfaces
+ * ---------------------------------------------------------------
+ */
+esch_error
+esch_hashtable_new(esch_config* config, esch_hashtable_kind kind,
+                   esch_hashtable** table)
+{
+    esch_error ret = ESCH_OK;
+
+    ESCH_CHECK_PARAM_PUBLIC(config != NULL);
+    ESCH_CHECK_PARAM_PUBLIC(table != NULL);
+    ESCH_CHECK_PARAM_PUBLIC(ESCH_IS_VALID_CONFIG(config));
+    ESCH_CHECK_PARAM_PUBLIC(ESCH_CONFIG_GET_ALLOC(config) != NULL);
+    ESCH_CHECK_PARAM_PUBLIC(ESCH_CONFIG_GET_LOG(config) != NULL);
+    ESCH_CHECK_PARAM_PUBLIC(kind == ESCH_HASHTABLE_EQ ||
+                            kind == ESCH_HASHTABLE_EQV ||
+                            kind == ESCH_HASHTABLE_EQUAL);
+
+    ret = esch_hashtable_new_i(config, kind, table);
+Exit:
+    return ret;
+}
+
+esch_error
+esch_hashtable_set(esch_hashtable* table, esch_value* key,
+                   esch_value* value)
+{
+    esch_error ret = ESCH_OK;
+    esch_log* log = NULL;
+    struct esch_hashtable_entry* entry = NULL;
+    struct esch_hashtable_entry incoming;
+    uint32_t hash = 0;
+    size_t index = 0;
+
+    ESCH_CHECK_PARAM_PUBLIC(table != NULL);
+    ESCH_CHECK_PARAM_PUBLIC(ESCH_IS_VALID_HASHTABLE(table));
+    ESCH_CHECK_PARAM_PUBLIC(ESCH_HASHTABLE_CHECK_VALUE(key));
+    ESCH_CHECK_PARAM_PUBLIC(ESCH_HASHTABLE_CHECK_VALUE(value));
+    log = ESCH_OBJECT_GET_LOG(ESCH_CAST_TO_OBJECT(table));
+
+    ret = esch_hashtable_hash_i(table, key, &hash);
+    ESCH_CHECK(ret == ESCH_OK, log, "hashtable:set: Can't hash key", ret);
+    esch_hashtable_move_i(table, ESCH_HASHTABLE_MOVE_STEP);
+
+    /* Replace value of existing key, in whichever table it is. */
+    index = esch_hashtable_find_i(table, table->entries, table->slots,
+                                  key, hash);
+    if (index < table->slots)
+    {
+        entry = &(table->entries[index]);
+    }
+    else if (table->old_entries != NULL)
+    {
+        index = esch_hashtable_find_i(table, table->old_entries,
+                                      table->old_slots, key, hash);
+        if (index < table->old_slots)
+        {
+            entry = &(table->old_entries[index]);
+        }
+    }
+    if (entry != NULL)
+    {
+        entry->value_type = (esch_byte)value->type;
+        entry->value = value->val;
+        goto Exit;
+    }
+
+    ret = esch_hashtable_reserve_i(table);
+    ESCH_CHECK(ret == ESCH_OK, log, "hashtable:set: Can't grow", ret);
+
+    /* Robin Hood: take slot of any entry closer to its home, and carry
+     * that entry on. */
+    incoming.hash = hash;
+    incoming.key_type = (esch_byte)key->type;
+    incoming.value_type = (esch_byte)value->type;
+    incoming.key = key->val;
+    incoming.value = value->val;
+    esch_hashtable_insert_i(table->entries, table->slots, &incoming);
+    table->count += 1;
+Exit:
+    return ret;
+}
+
+esch_error
+esch_hashtable_ref(esch_hashtable* table, esch_value* key,
+                   esch_value* value)
+{
+    esch_error ret = ESCH_OK;
+    esch_log* log = NULL;
+    struct esch_hashtable_entry* entry = NULL;
+    uint32_t hash = 0;
+    size_t index = 0;
+
+    ESCH_CHECK_PARAM_PUBLIC(table != NULL);
+    ESCH_CHECK_PARAM_PUBLIC(ESCH_IS_VALID_HASHTABLE(table));
+    ESCH_CHECK_PARAM_PUBLIC(ESCH_HASHTABLE_CHECK_VALUE(key));
+    ESCH_CHECK_PARAM_PUBLIC(value != NULL);
+    log = ESCH_OBJECT_GET_LOG(ESCH_CAST_TO_OBJECT(table));
+
+    ret = esch_hashtable_hash_i(table, key, &hash);
+    ESCH_CHECK(ret == ESCH_OK, log, "hashtable:ref: Can't hash key", ret);
+    esch_hashtable_move_i(table, ESCH_HASHTABLE_MOVE_STEP);
+
+    index = esch_hashtable_find_i(table, table->entries, table->slots,
+                                  key, hash);
+    if (index < table->slots)
+    {
+        entry = &(table->entries[index]);
+    }
+    else if (table->old_entries != NULL)
+    {
+        index = esch_hashtable_find_i(table, table->old_entries,
+                                      table->old_slots, key, hash);
+        if (index < table->old_slots)
+        {
+            entry = &(table->old_entries[index]);
+        }
+    }
+    if (entry == NULL)
+    {
+        ret = ESCH_ERROR_NOT_FOUND;
+        goto Exit;
+    }
+    value->type = (esch_value_type)entry->value_type;
+    value->val = entry->value;
+Exit:
+    return ret;
+}
+
+esch_error
+esch_hashtable_delete(esch_hashtable* table, esch_value* key)
+{
+    esch_error ret = ESCH_OK;
+    esch_log* log = NULL;
+    struct esch_hashtable_entry* entry = NULL;
+    uint32_t hash = 0;
+    size_t index = 0;
+
+    ESCH_CHECK_PARAM_PUBLIC(table != NULL);
+    ESCH_CHECK_PARAM_PUBLIC(ESCH_IS_VALID_HASHTABLE(table));
+    ESCH_CHECK_PARAM_PUBLIC(ESCH_HASHTABLE_CHECK_VALUE(key));
+    log = ESCH_OBJECT_GET_LOG(ESCH_CAST_TO_OBJECT(table));
+
+    ret = esch_hashtable_hash_i(table, key, &hash);
+    ESCH_CHECK(ret == ESCH_OK, log, "hashtable:delete: Can't hash key",
+               ret);
+    esch_hashtable_move_i(table, ESCH_HASHTABLE_MOVE_STEP);
+
+    index = esch_hashtable_find_i(table, table->entries, table->slots,
+                                  key, hash);
+    if (index < table->slots)
+    {
+        esch_hashtable_remove_i(table->entries, table->slots, index);
+        table->count -= 1;
+        goto Exit;
+    }
+    if (table->old_entries != NULL)
+    {
+        index = esch_hashtable_find_i(table, table->old_entries,
+                                      table->old_slots, key, hash);
+        if (index < table->old_slots)
+        {
+            /* Old table is going away, shifting is not worth it. */
+            entry = &(table->old_entries[index]);
+            memset(entry, 0, sizeof(struct esch_hashtable_entry));
+            entry->hash = ESCH_HASHTABLE_MOVED;
+            table->count -= 1;
+            goto Exit;
+        }
+    }
+    ret = ESCH_ERROR_NOT_FOUND;
+Exit:
+    return ret;
+}
+
+esch_error
+esch_hashtable_get_count(esch_hashtable* table, size_t* count)
+{
+    esch_error ret = ESCH_OK;
+    ESCH_CHECK_PARAM_PUBLIC(table != NULL);
+    ESCH_CHECK_PARAM_PUBLIC(ESCH_IS_VALID_HASHTABLE(table));
+    ESCH_CHECK_PARAM_PUBLIC(count != NULL);
+    (*count) = table->count;
+Exit:
+    return ret;
+}
+
+/*
+ * -----------------------------------------------------------------
+ * Hashing and comparing keys.
+ * -----------------------------------------------------------------
+ */
+#define ESCH_HASHTABLE_FNV_PRIME ESCH_NUMBER_U64(0x100, 0x000001B3)
+#define ESCH_HASHTABLE_GOLDEN ESCH_NUMBER_U64(0x9E3779B9, 0x7F4A7C15)
+
+/*
+ * Finalizer of MurmurHash3: every input bit changes about half of
+ * output bits, so low bits can be used as slot index, even for
+ * pointers and small integers.
+ */
+static uint32_t
+esch_hashtable_mix_i(uint64_t bits)
+{
+    bits ^= bits >> 33;
+    bits *= ESCH_NUMBER_U64(0xFF51AFD7, 0xED558CCD);
+    bits ^= bits >> 33;
+    bits *= ESCH_NUMBER_U64(0xC4CEB9FE, 0x1A85EC53);
+    bits ^= bits >> 33;
+    return ((uint32_t)bits) | ESCH_HASHTABLE_HASH_BIT;
+}
+
+static uint64_t
+esch_hashtable_add_bits_i(uint64_t bits, uint64_t more)
+{
+    return (bits ^ more) * ESCH_HASHTABLE_FNV_PRIME;
+}
+
+/* Bits of a value as compared by eq. */
+static uint64_t
+esch_hashtable_eq_bits_i(esch_value* value)
+{
+    uint64_t bits = 0;
+    switch (value->type)
+    {
+        case ESCH_VALUE_TYPE_BYTE:
+            bits = value->val.b;
+            break;
+        case ESCH_VALUE_TYPE_UNICODE:
+            bits = (uint32_t)value->val.u;
+            break;
+        case ESCH_VALUE_TYPE_INTEGER:
+            bits = (uint64_t)(int64_t)value->val.i;
+            break;
+        case ESCH_VALUE_TYPE_FLOAT:
+            memcpy(&bits, &(value->val.f), sizeof(bits));
+            break;
+        case ESCH_VALUE_TYPE_OBJECT:
+            bits = (uint64_t)(size_t)value->val.o;
+            break;
+        default:
+            bits = 0;
+            break;
+    }
+    return bits + (uint64_t)value->type * ESCH_HASHTABLE_GOLDEN;
+}
+
+static esch_bool
+esch_hashtable_eq_i(esch_value* left, esch_value* right)
+{
+    if (left->type != right->type)
+    {
+        return ESCH_FALSE;
+    }
+    switch (left->type)
+    {
+        case ESCH_VALUE_TYPE_BYTE:
+            return (left->val.b == right->val.b);
+        case ESCH_VALUE_TYPE_UNICODE:
+            return (left->val.u == right->val.u);
+        case ESCH_VALUE_TYPE_INTEGER:
+            return (left->val.i == right->val.i);
+        case ESCH_VALUE_TYPE_FLOAT:
+            /* Same bits: 0.0 and -0.0 differ, NaN equals itself. */
+            return (memcmp(&(left->val.f), &(right->val.f),
+                           sizeof(double)) == 0);
+        case ESCH_VALUE_TYPE_OBJECT:
+            return (left->val.o == right->val.o);
+        default:
+            return ESCH_TRUE;
+    }
+}
+
+static esch_bool
+esch_hashtable_is_type_i(esch_value* value, esch_type* type)
+{
+    return (value->type == ESCH_VALUE_TYPE_OBJECT &&
+            ESCH_OBJECT_GET_TYPE(value->val.o) == type);
+}
+
+/*
+ * An integer object that fits in int is same number as a fixnum, so
+ * eqv treats it as fixnum. Larger integers and fractions are always
+ * normalized, so equal numbers have same limbs.
+ */
+static void
+esch_hashtable_to_fixnum_i(esch_value* value)
+{
+    esch_integer* val = NULL;
+    if (esch_hashtable_is_type_i(value, &(esch_integer_type.type)))
+    {
+        val = ESCH_CAST_FROM_OBJECT(value->val.o, esch_integer);
+        if (!ESCH_INTEGER_IS_BIG(val))
+        {
+            value->type = ESCH_VALUE_TYPE_INTEGER;
+            value->val.i = val->ival;
+        }
+    }
+}
+
+static uint64_t
+esch_hashtable_eqv_bits_i(esch_value* value)
+{
+    esch_value number = (*value);
+    esch_integer* val = NULL;
+    esch_fraction* frac = NULL;
+    uint64_t bits = 0;
+    size_t i = 0;
+
+    esch_hashtable_to_fixnum_i(&number);
+    if (esch_hashtable_is_type_i(&number, &(esch_integer_type.type)))
+    {
+        val = ESCH_CAST_FROM_OBJECT(number.val.o, esch_integer);
+        bits = (val->negative? 1: 2);
+        for (i = 0; i < val->length; ++i)
+        {
+            bits = esch_hashtable_add_bits_i(bits, val->limbs[i]);
+        }
+    }
+    else if (esch_hashtable_is_type_i(&number,
+                                      &(esch_fraction_type.type)))
+    {
+        frac = ESCH_CAST_FROM_OBJECT(number.val.o, esch_fraction);
+        if (ESCH_FRACTION_IS_BIG(frac))
+        {
+            bits = (frac->negative? 3: 4);
+            bits = esch_hashtable_add_bits_i(bits, frac->num_length);
+            for (i = 0; i < frac->num_length + frac->den_length; ++i)
+            {
+                bits = esch_hashtable_add_bits_i(bits, frac->limbs[i]);
+            }
+        }
+        else
+        {
+            bits = esch_hashtable_add_bits_i(5, (uint32_t)frac->num);
+            bits = esch_hashtable_add_bits_i(bits, (uint32_t)frac->den);
+        }
+    }
+    else
+    {
+        bits = esch_hashtable_eq_bits_i(&number);
+    }
+    return bits;
+}
+
+static esch_bool
+esch_hashtable_eqv_i(esch_value* left, esch_value* right)
+{
+    esch_value a = (*left);
+    esch_value b = (*right);
+    esch_integer* ia = NULL;
+    esch_integer* ib = NULL;
+    esch_fraction* fa = NULL;
+    esch_fraction* fb = NULL;
+
+    esch_hashtable_to_fixnum_i(&a);
+    esch_hashtable_to_fixnum_i(&b);
+    if (esch_hashtable_eq_i(&a, &b))
+    {
+        return ESCH_TRUE;
+    }
+    if (esch_hashtable_is_type_i(&a, &(esch_integer_type.type)) &&
+        esch_hashtable_is_type_i(&b, &(esch_integer_type.type)))
+    {
+        ia = ESCH_CAST_FROM_OBJECT(a.val.o, esch_integer);
+        ib = ESCH_CAST_FROM_OBJECT(b.val.o, esch_integer);
+        return (ia->negative == ib->negative &&
+                ia->length == ib->length &&
+                memcmp(ia->limbs, ib->limbs,
+                       sizeof(esch_limb) * ia->length) == 0);
+    }
+    if (esch_hashtable_is_type_i(&a, &(esch_fraction_type.type)) &&
+        esch_hashtable_is_type_i(&b, &(esch_fraction_type.type)))
+    {
+        fa = ESCH_CAST_FROM_OBJECT(a.val.o, esch_fraction);
+        fb = ESCH_CAST_FROM_OBJECT(b.val.o, esch_fraction);
+        if (!ESCH_FRACTION_IS_BIG(fa) || !ESCH_FRACTION_IS_BIG(fb))
+        {
+            return (!ESCH_FRACTION_IS_BIG(fa) &&
+                    !ESCH_FRACTION_IS_BIG(fb) &&
+                    fa->num == fb->num && fa->den == fb->den);
+        }
+        return (fa->negative == fb->negative &&
+                fa->num_length == fb->num_length &&
+                fa->den_length == fb->den_length &&
+                memcmp(fa->limbs, fb->limbs,
+                       sizeof(esch_limb) *
+                       (fa->num_length + fa->den_length)) == 0);
+    }
+    return ESCH_FALSE;
+}
+
+static esch_string*
+esch_hashtable_get_string_i(esch_value* value)
+{
+    esch_type* type = NULL;
+    if (value->type != ESCH_VALUE_TYPE_OBJECT)
+    {
+        return NULL;
+    }
+    type = ESCH_OBJECT_GET_TYPE(value->val.o);
+    if (type == &(esch_string_type.type) ||
+        type == &(esch_string_inline_type.type) ||
+        type == &(esch_string_rope_type.type) ||
+        type == &(esch_string_view_type.type))
+    {
+        return ESCH_CAST_FROM_OBJECT(value->val.o, esch_string);
+    }
+    return NULL;
+}
+
+/*
+ * UTF-8 bytes of a string. A rope is flattened, which may fail. A view
+ * is not terminated, but its bytes are enough here.
+ */
+static const esch_utf8*
+esch_hashtable_get_utf8_i(esch_string* str)
+{
+    return (str->utf8 != NULL? str->utf8: esch_string_get_utf8_ref(str));
+}
+
+/*
+ * Hash of equal: strings by bytes, pairs and vectors by first values
+ * in depth-first order. Equal keys visit same values in same order.
+ */
+static esch_error
+esch_hashtable_equal_bits_i(esch_value* value, uint64_t* bits,
+                            size_t* budget)
+{
+    esch_error ret = ESCH_OK;
+    esch_value element;
+    esch_string* str = NULL;
+    esch_pair* pair = NULL;
+    esch_vector* vec = NULL;
+    const esch_utf8* utf8 = NULL;
+    size_t i = 0;
+
+    element = (*value);
+    while ((*budget) > 0)
+    {
+        (*budget) -= 1;
+        str = esch_hashtable_get_string_i(&element);
+        if (str != NULL)
+        {
+            utf8 = esch_hashtable_get_utf8_i(str);
+            if (utf8 == NULL)
+            {
+                ret = ESCH_ERROR_OUT_OF_MEMORY;
+                break;
+            }
+            (*bits) = esch_hashtable_add_bits_i((*bits), str->utf8_len);
+            for (i = 0; i < str->utf8_len; ++i)
+            {
+                (*bits) = esch_hashtable_add_bits_i((*bits),
+                                                    (esch_byte)utf8[i]);
+            }
+            break;
+        }
+        if (esch_hashtable_is_type_i(&element, &(esch_vector_type.type)))
+        {
+            vec = ESCH_CAST_FROM_OBJECT(element.val.o, esch_vector);
+            (*bits) = esch_hashtable_add_bits_i((*bits), vec->length);
+            for (i = 0; i < vec->length && (*budget) > 0; ++i)
+            {
+                esch_vector_read_i(vec, i, &element);
+                ret = esch_hashtable_equal_bits_i(&element, bits, budget);
+                if (ret != ESCH_OK)
+                {
+                    break;
+                }
+            }
+            break;
+        }
+        if (!esch_hashtable_is_type_i(&element, &(esch_pair_type.type)))
+        {
+            (*bits) = esch_hashtable_add_bits_i((*bits),
+                                         esch_hashtable_eqv_bits_i(&element));
+            break;
+        }
+        /* Head recursively, tail in loop, so long lists don't nest. */
+        pair = ESCH_CAST_FROM_OBJECT(element.val.o, esch_pair);
+        element.type = ESCH_PAIR_GET_TYPE(pair, 0);
+        element.val = pair->data[0];
+        ret = esch_hashtable_equal_bits_i(&element, bits, budget);
+        if (ret != ESCH_OK)
+        {
+            break;
+        }
+        element.type = ESCH_PAIR_GET_TYPE(pair, 1);
+        element.val = pair->data[1];
+    }
+    return ret;
+}
+
+static esch_bool
+esch_hashtable_equal_i(esch_value* left, esch_value* right,
+                       size_t depth, size_t* steps)
+{
+    esch_value a = (*left);
+    esch_value b = (*right);
+    esch_string* sa = NULL;
+    esch_string* sb = NULL;
+    esch_vector* va = NULL;
+    esch_vector* vb = NULL;
+    esch_pair* pa = NULL;
+    esch_pair* pb = NULL;
+    const esch_utf8* utf8_a = NULL;
+    const esch_utf8* utf8_b = NULL;
+    esch_value ea;
+    esch_value eb;
+    size_t i = 0;
+
+    for (;;)
+    {
+        if (esch_hashtable_eqv_i(&a, &b))
+        {
+            return ESCH_TRUE;
+        }
+        if (a.type != ESCH_VALUE_TYPE_OBJECT ||
+            b.type != ESCH_VALUE_TYPE_OBJECT ||
+            depth == 0 || (*steps) == 0)
+        {
+            return ESCH_FALSE;
+        }
+        (*steps) -= 1;
+        sa = esch_hashtable_get_string_i(&a);
+        sb = esch_hashtable_get_string_i(&b);
+        if (sa != NULL || sb != NULL)
+        {
+            if (sa == NULL || sb == NULL || sa->utf8_len != sb->utf8_len)
+            {
+                return ESCH_FALSE;
+            }
+            utf8_a = esch_hashtable_get_utf8_i(sa);
+            utf8_b = esch_hashtable_get_utf8_i(sb);
+            return (utf8_a != NULL && utf8_b != NULL &&
+                    memcmp(utf8_a, utf8_b, sa->utf8_len) == 0);
+        }
+        if (ESCH_OBJECT_GET_TYPE(a.val.o) != ESCH_OBJECT_GET_TYPE(b.val.o))
+        {
+            return ESCH_FALSE;
+        }
+        if (esch_hashtable_is_type_i(&a, &(esch_vector_type.type)))
+        {
+            va = ESCH_CAST_FROM_OBJECT(a.val.o, esch_vector);
+            vb = ESCH_CAST_FROM_OBJECT(b.val.o, esch_vector);
+            if (va->length != vb->length)
+            {
+                return ESCH_FALSE;
+            }
+            for (i = 0; i < va->length; ++i)
+            {
+                esch_vector_read_i(va, i, &ea);
+                esch_vector_read_i(vb, i, &eb);
+                if (!esch_hashtable_equal_i(&ea, &eb, depth - 1, steps))
+                {
+                    return ESCH_FALSE;
+                }
+            }
+            return ESCH_TRUE;
+        }
+        if (!esch_hashtable_is_type_i(&a, &(esch_pair_type.type)))
+        {
+            return ESCH_FALSE;
+        }
+        pa = ESCH_CAST_FROM_OBJECT(a.val.o, esch_pair);
+        pb = ESCH_CAST_FROM_OBJECT(b.val.o, esch_pair);
+        ea.type = ESCH_PAIR_GET_TYPE(pa, 0);
+        ea.val = pa->data[0];
+        eb.type = ESCH_PAIR_GET_TYPE(pb, 0);
+        eb.val = pb->data[0];
+        if (!esch_hashtable_equal_i(&ea, &eb, depth - 1, steps))
+        {
+            return ESCH_FALSE;
+        }
+        a.type = ESCH_PAIR_GET_TYPE(pa, 1);
+        a.val = pa->data[1];
+        b.type = ESCH_PAIR_GET_TYPE(pb, 1);
+        b.val = pb->data[1];
+    }
+}
+
+static esch_error
+esch_hashtable_hash_i(esch_hashtable* table, esch_value* key,
+                      uint32_t* hash)
+{
+    esch_error ret = ESCH_OK;
+    uint64_t bits = 0;
+    size_t budget = ESCH_HASHTABLE_EQUAL_HASH_VALUES;
+
+    switch (table->kind)
+    {
+        case ESCH_HASHTABLE_EQ:
+            bits = esch_hashtable_eq_bits_i(key);
+            break;
+        case ESCH_HASHTABLE_EQV:
+            bits = esch_hashtable_eqv_bits_i(key);
+            break;
+        default:
+            ret = esch_hashtable_equal_bits_i(key, &bits, &budget);
+            break;
+    }
+    (*hash) = esch_hashtable_mix_i(bits);
+    return ret;
+}
+
+static esch_bool
+esch_hashtable_same_key_i(esch_hashtable* table, esch_value* left,
+                          esch_value* right)
+{
+    size_t steps = ESCH_HASHTABLE_EQUAL_STEPS;
+    switch (table->kind)
+    {
+        case ESCH_HASHTABLE_EQ:
+            return esch_hashtable_eq_i(left, right);
+        case ESCH_HASHTABLE_EQV:
+            return esch_hashtable_eqv_i(left, right);
+        default:
+            return esch_hashtable_equal_i(left, right,
+                                          ESCH_HASHTABLE_EQUAL_DEPTH,
+                                          &steps);
+    }
+}
+
+/*
+ * -----------------------------------------------------------------
+ * Slots.
+ * -----------------------------------------------------------------
+ */
+/* Distance of an entry from its home slot. */
+#define ESCH_HASHTABLE_DISTANCE(index, hash, mask) \
+    (((index) - (size_t)(hash)) & (mask))
+
+/*
+ * Return index of slot holding given key, or slots if not found. Moved
+ * slots of old table are skipped, like an entry that never matches.
+ */
+static size_t
+esch_hashtable_find_i(esch_hashtable* table,
+                      struct esch_hashtable_entry* entries, size_t slots,
+                      esch_value* key, uint32_t hash)
+{
+    size_t mask = slots - 1;
+    size_t index = hash & mask;
+    size_t distance = 0;
+    struct esch_hashtable_entry* entry = NULL;
+    esch_value other;
+
+    for (;;)
+    {
+        entry = &(entries[index]);
+        if (entry->hash == ESCH_HASHTABLE_EMPTY)
+        {
+            return slots;
+        }
+        if (entry->hash != ESCH_HASHTABLE_MOVED)
+        {
+            if (ESCH_HASHTABLE_DISTANCE(index, entry->hash, mask) <
+                    distance)
+            {
+                /* Key would have taken this slot. */
+                return slots;
+            }
+            if (entry->hash == hash)
+            {
+                other.type = (esch_value_type)entry->key_type;
+                other.val = entry->key;
+                if (esch_hashtable_same_key_i(table, key, &other))
+                {
+                    return index;
+                }
+            }
+        }
+        index = (index + 1) & mask;
+        distance += 1;
+    }
+}
+
+/* Insert an entry whose key is not in table. Table must have room. */
+static void
+esch_hashtable_insert_i(struct esch_hashtable_entry* entries,
+                        size_t slots,
+                        struct esch_hashtable_entry* incoming)
+{
+    size_t mask = slots - 1;
+    size_t index = incoming->hash & mask;
+    size_t distance = 0;
+    size_t resident = 0;
+    struct esch_hashtable_entry carry = (*incoming);
+    struct esch_hashtable_entry swap;
+
+    for (;;)
+    {
+        if (entries[index].hash == ESCH_HASHTABLE_EMPTY)
+        {
+            entries[index] = carry;
+            return;
+        }
+        resident = ESCH_HASHTABLE_DISTANCE(index, entries[index].hash, mask);
+        if (resident < distance)
+        {
+            swap = entries[index];
+            entries[index] = carry;
+            carry = swap;
+            distance = resident;
+        }
+        index = (index + 1) & mask;
+        distance += 1;
+    }
+}
+
+/* Remove entry, and shift following entries back towards home. */
+static void
+esch_hashtable_remove_i(struct esch_hashtable_entry* entries,
+                        size_t slots, size_t index)
+{
+    size_t mask = slots - 1;
+    size_t next = (index + 1) & mask;
+
+    while (entries[next].hash != ESCH_HASHTABLE_EMPTY &&
+           ESCH_HASHTABLE_DISTANCE(next, entries[next].hash, mask) != 0)
+    {
+        entries[index] = entries[next];
+        index = next;
+        next = (next + 1) & mask;
+    }
+    memset(&(entries[index]), 0, sizeof(struct esch_hashtable_entry));
+}
+
+/* Move up to given number of slots from old table to new table. */
+static void
+esch_hashtable_move_i(esch_hashtable* table, size_t step)
+{
+    struct esch_hashtable_entry* entry = NULL;
+    esch_alloc* alloc = NULL;
+
+    if (table->old_entries == NULL)
+    {
+        return;
+    }
+    while (step > 0 && table->old_index < table->old_slots)
+    {
+        entry = &(table->old_entries[table->old_index]);
+        if (ESCH_HASHTABLE_IS_ENTRY(entry))
+        {
+            esch_hashtable_insert_i(table->entries, table->slots, entry);
+            entry->hash = ESCH_HASHTABLE_MOVED;
+        }
+        table->old_index += 1;
+        step -= 1;
+    }
+    if (table->old_index == table->old_slots)
+    {
+        alloc = ESCH_OBJECT_GET_ALLOC(ESCH_CAST_TO_OBJECT(table));
+        (void)esch_alloc_free(alloc, table->old_entries);
+        table->old_entries = NULL;
+        table->old_slots = 0;
+        table->old_index = 0;
+    }
+}
+
+/*
+ * Make sure one more key can be added. When new table is 7/8 full,
+ * start moving to a table twice as large. While moving, new table
+ * takes at most 7/8 of old size, plus one key for every
+ * ESCH_HASHTABLE_MOVE_STEP slots moved, so it never fills up.
+ */
+static esch_error
+esch_hashtable_reserve_i(esch_hashtable* table)
+{
+    esch_error ret = ESCH_OK;
+    esch_alloc* alloc = NULL;
+    esch_log* log = NULL;
+    struct esch_hashtable_entry* new_entries = NULL;
+    size_t new_slots = 0;
+
+    if ((table->count + 1) * 8 <= table->slots * 7)
+    {
+        return ESCH_OK;
+    }
+    if (table->old_entries != NULL)
+    {
+        /* Never happens when ESCH_HASHTABLE_MOVE_STEP > 1. */
+        esch_hashtable_move_i(table, table->old_slots);
+    }
+    alloc = ESCH_OBJECT_GET_ALLOC(ESCH_CAST_TO_OBJECT(table));
+    log = ESCH_OBJECT_GET_LOG(ESCH_CAST_TO_OBJECT(table));
+
+    new_slots = table->slots * 2;
+    ret = esch_alloc_realloc(alloc, NULL,
+                             sizeof(struct esch_hashtable_entry) * new_slots,
+                             (void**)&new_entries);
+    /* New buffer is zeroed, and its pages are not touched until they
+     * are used, so growing does not pause for the whole table. */
+    ESCH_CHECK(ret == ESCH_OK, log, "hashtable:Can't allocate slots", ret);
+
+    table->old_entries = table->entries;
+    table->old_slots = table->slots;
+    table->old_index = 0;
+    table->entries = new_entries;
+    table->slots = new_slots;
+Exit:
+    return ret;
+}
+
+/*
+ * -----------------------------------------------------------------
+ * Object.
+ * -----------------------------------------------------------------
+ */
+static esch_error
+esch_hashtable_new_i(esch_config* config, esch_hashtable_kind kind,
+                     esch_hashtable** table)
+{
+    esch_error ret = ESCH_OK;
+    esch_alloc* alloc = NULL;
+    esch_log* log = NULL;
+    struct esch_hashtable_entry* entries = NULL;
+    esch_object* new_obj = NULL;
+    esch_hashtable* new_table = NULL;
+    size_t size = 0;
+
+    alloc = ESCH_CAST_FROM_OBJECT(ESCH_CONFIG_GET_ALLOC(config),
+                                  esch_alloc);
+    log = ESCH_CAST_FROM_OBJECT(ESCH_CONFIG_GET_LOG(config), esch_log);
+
+    size = sizeof(struct esch_hashtable_entry) *
+           ESCH_HASHTABLE_INITIAL_SLOTS;
+    ret = esch_alloc_realloc(alloc, NULL, size, (void**)&entries);
+    ESCH_CHECK(ret == ESCH_OK, log, "hashtable:Can't allocate slots", ret);
+
+    ret = esch_object_new_i(config, &(esch_hashtable_type.type), &new_obj);
+    ESCH_CHECK(ret == ESCH_OK, log, "hashtable:Can't create table", ret);
+    new_table = ESCH_CAST_FROM_OBJECT(new_obj, esch_hashtable);
+    new_table->kind = kind;
+    new_table->entries = entries;
+    new_table->slots = ESCH_HASHTABLE_INITIAL_SLOTS;
+    new_table->count = 0;
+    new_table->old_entries = NULL;
+    new_table->old_slots = 0;
+    new_table->old_index = 0;
+
+    (*table) = new_table;
+    entries = NULL;
+Exit:
+    esch_alloc_free(alloc, entries);
+    return ret;
+}
+
+static esch_error
+esch_hashtable_new_as_object_i(esch_config* config, esch_object** obj)
+{
+    esch_error ret = ESCH_OK;
+    esch_hashtable* table = NULL;
+    ret = esch_hashtable_new_i(config, ESCH_HASHTABLE_EQV, &table);
+    if (ret == ESCH_OK)
+    {
+        (*obj) = ESCH_CAST_TO_OBJECT(table);
+    }
+    return ret;
+}
+
+static esch_error
+esch_hashtable_destructor_i(esch_object* obj)
+{
+    esch_error ret = ESCH_OK;
+    esch_hashtable* table = NULL;
+    esch_alloc* alloc = NULL;
+
+    ESCH_CHECK_PARAM_INTERNAL(obj != NULL);
+    table = ESCH_CAST_FROM_OBJECT(obj, esch_hashtable);
+    ESCH_CHECK_PARAM_INTERNAL(ESCH_IS_VALID_HASHTABLE(table));
+    alloc = ESCH_OBJECT_GET_ALLOC(obj);
+
+    /* Same as vector, keys and values are not owned by table. */
+    (void)esch_alloc_free(alloc, table->entries);
+    (void)esch_alloc_free(alloc, table->old_entries);
+    table->entries = NULL;
+    table->old_entries = NULL;
+    table->slots = 0;
+    table->old_slots = 0;
+    table->count = 0;
+    return ret;
+}
+
+/*
+ * -----------------------------------------------------------------
+ * Iterator. Position 2 * slot is key of a slot, and 2 * slot + 1 is
+ * its value. Slots of new table come first, then old table. Iterator
+ * always stops at a slot holding an entry.
+ * -----------------------------------------------------------------
+ */
+static struct esch_hashtable_entry*
+esch_hashtable_iterator_entry_i(esch_hashtable* table, size_t slot)
+{
+    if (slot < table->slots)
+    {
+        return &(table->entries[slot]);
+    }
+    slot -= table->slots;
+    if (slot < table->old_slots)
+    {
+        return &(table->old_entries[slot]);
+    }
+    return NULL;
+}
+
+/*
+ * Return first position at or after given one that holds a key or a
+ * value. With objects_only, skip primitive values too.
+ */
+static size_t
+esch_hashtable_iterator_seek_i(esch_hashtable* table, size_t position,
+                               esch_bool objects_only)
+{
+    struct esch_hashtable_entry* entry = NULL;
+    esch_byte type = 0;
+
+    for (;;)
+    {
+        entry = esch_hashtable_iterator_entry_i(table, position / 2);
+        if (entry == NULL)
+        {
+            return position;
+        }
+        if (ESCH_HASHTABLE_IS_ENTRY(entry))
+        {
+            type = ((position & 1) == 0? entry->key_type:
+                                         entry->value_type);
+            if (!objects_only || type == ESCH_VALUE_TYPE_OBJECT)
+            {
+                return position;
+            }
+            position += 1;
+        }
+        else
+        {
+            /* Skip key and value of empty slot at once. */
+            position = (position | 1) + 1;
+        }
+    }
+}
+
+static esch_error
+esch_hashtable_iterator_get_value_i(esch_iterator* iter, esch_value* value)
+{
+    esch_error ret = ESCH_OK;
+    esch_hashtable* table = NULL;
+    struct esch_hashtable_entry* entry = NULL;
+    size_t position = 0;
+
+    ESCH_CHECK_PARAM_PUBLIC(iter != NULL);
+    ESCH_CHECK_PARAM_PUBLIC(value != NULL);
+    ESCH_CHECK_PARAM_PUBLIC(iter->container != NULL);
+    table = ESCH_CAST_FROM_OBJECT(iter->container, esch_hashtable);
+    ESCH_CHECK_PARAM_PUBLIC(ESCH_IS_VALID_HASHTABLE(table));
+
+    position = (size_t)(iter->iterator);
+    entry = esch_hashtable_iterator_entry_i(table, position / 2);
+    if (entry == NULL)
+    {
+        value->type = ESCH_VALUE_TYPE_END;
+        value->val.o = NULL;
+    }
+    else if ((position & 1) == 0)
+    {
+        value->type = (esch_value_type)entry->key_type;
+        value->val = entry->key;
+    }
+    else
+    {
+        value->type = (esch_value_type)entry->value_type;
+        value->val = entry->value;
+    }
+Exit:
+    return ret;
+}
+
+static esch_error
+esch_hashtable_iterator_get_next_i(esch_iterator* iter)
+{
+    esch_error ret = ESCH_OK;
+    esch_hashtable* table = NULL;
+    size_t position = 0;
+
+    ESCH_CHECK_PARAM_PUBLIC(iter != NULL);
+    ESCH_CHECK_PARAM_INTERNAL(iter->container != NULL);
+    table = ESCH_CAST_FROM_OBJECT(iter->container, esch_hashtable);
+    ESCH_CHECK_PARAM_INTERNAL(ESCH_IS_VALID_HASHTABLE(table));
+
+    position = (size_t)(iter->iterator) + 1;
+    position = esch_hashtable_iterator_seek_i(table, position, ESCH_FALSE);
+    iter->iterator = (void*)position;
+Exit:
+    return ret;
+}
+
+static esch_error
+esch_hashtable_iterator_seek_object_i(esch_iterator* iter)
+{
+    esch_error ret = ESCH_OK;
+    esch_hashtable* table = NULL;
+    size_t position = 0;
+
+    ESCH_CHECK_PARAM_PUBLIC(iter != NULL);
+    ESCH_CHECK_PARAM_INTERNAL(iter->container != NULL);
+    table = ESCH_CAST_FROM_OBJECT(iter->container, esch_hashtable);
+    ESCH_CHECK_PARAM_INTERNAL(ESCH_IS_VALID_HASHTABLE(table));
+
+    position = (size_t)(iter->iterator);
+    position = esch_hashtable_iterator_seek_i(table, position, ESCH_TRUE);
+    iter->iterator = (void*)position;
+Exit:
+    return ret;
+}
+
+static esch_error
+esch_hashtable_get_iterator_i(esch_object* obj, esch_iterator* iter)
+{
+    esch_error ret = ESCH_OK;
+    esch_hashtable* table = NULL;
+
+    ESCH_CHECK_PARAM_PUBLIC(iter != NULL);
+    ESCH_CHECK_PARAM_PUBLIC(obj != NULL);
+    table = ESCH_CAST_FROM_OBJECT(obj, esch_hashtable);
+    ESCH_CHECK_PARAM_INTERNAL(ESCH_IS_VALID_HASHTABLE(table));
+
+    iter->container = obj;
+    iter->iterator = (void*)esch_hashtable_iterator_seek_i(table, 0,
+                                                           ESCH_FALSE);
+    iter->get_value = esch_hashtable_iterator_get_value_i;
+    iter->get_next = esch_hashtable_iterator_get_next_i;
+    iter->seek_object = esch_hashtable_iterator_seek_object_i;
+Exit:
+    return ret;
+}
@@ -0,0 +1,94 @@
+/* vim:ft=c expandtab tw=72 sw=4
+ */
+/* See Copyright notice in esch.h */
+#ifndef _ESCH_HASHTABLE_H_
+#define _ESCH_HASHTABLE_H_
+
+#include "esch.h"
+#include "esch_object.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif /* __cplusplus */
+
+/*
+ * Open addressing with Robin Hood linear probing: an entry is inserted
+ * in front of any entry that is closer to its home slot, so probe
+ * lengths stay short and even at high load. Lookup stops as soon as it
+ * meets an entry closer to home than the key would be. Removing an
+ * entry shifts following entries back, so there's no tombstone.
+ *
+ * Each entry keeps hash of key, so probing compares keys only when
+ * hashes match. Hash 0 is an empty slot. Hashes of keys always have
+ * top bit set.
+ *
+ * SwissTable-style control bytes are not used. They need tombstones
+ * for delete, which the old table of an incremental resize would
+ * collect, and a second probing path without SSE2 (see
+ * esch_string.c). Robin Hood keeps probes short without SIMD, in one
+ * code path for all builds.
+ */
+struct esch_hashtable_entry
+{
+    uint32_t hash;
+    esch_byte key_type;   /* As esch_value_type */
+    esch_byte value_type; /* As esch_value_type */
+    esch_value_data key;
+    esch_value_data value;
+};
+
+#define ESCH_HASHTABLE_EMPTY 0
+/* Slot of old table whose entry is moved or removed. Probing goes on. */
+#define ESCH_HASHTABLE_MOVED 1
+#define ESCH_HASHTABLE_HASH_BIT 0x80000000U
+#define ESCH_HASHTABLE_IS_ENTRY(entry) \
+    (((entry)->hash & ESCH_HASHTABLE_HASH_BIT) != 0)
+
+/*
+ * Incremental resizing: when table is 7/8 full, a table of twice the
+ * size is allocated, and old table is kept. New keys go to new table.
+ * Every set, ref and delete moves next ESCH_HASHTABLE_MOVE_STEP slots
+ * of old table to new table, so old table is drained long before new
+ * table fills up. Until then, lookup checks both tables.
+ */
+#ifndef ESCH_HASHTABLE_MOVE_STEP
+#    define ESCH_HASHTABLE_MOVE_STEP 16
+#endif
+
+/*
+ * Equal tables walk into pairs and vectors at most this deep, and
+ * compare at most this many elements. Beyond them, values are compared
+ * with eqv, so circular keys still work. Hash of a key looks at first
+ * ESCH_HASHTABLE_EQUAL_HASH_VALUES values only.
+ */
+#define ESCH_HASHTABLE_EQUAL_DEPTH 64
+#define ESCH_HASHTABLE_EQUAL_STEPS 100000
+#define ESCH_HASHTABLE_EQUAL_HASH_VALUES 16
+
+struct esch_hashtable
+{
+    esch_hashtable_kind kind;
+    struct esch_hashtable_entry* entries;
+    size_t slots; /* Always power of 2 */
+    size_t count; /* Keys in both tables */
+    /* Old table while resizing, or NULL. */
+    struct esch_hashtable_entry* old_entries;
+    size_t old_slots;
+    size_t old_index; /* Next slot to move */
+};
+
+extern struct esch_builtin_type esch_hashtable_type;
+extern const size_t ESCH_HASHTABLE_INITIAL_SLOTS;
+
+#define ESCH_IS_VALID_HASHTABLE(tbl) \
+    ((tbl) != NULL && \
+     ESCH_IS_VALID_OBJECT(ESCH_CAST_TO_OBJECT(tbl)) && \
+     (ESCH_OBJECT_GET_TYPE(ESCH_CAST_TO_OBJECT(tbl)) == \
+      &(esch_hashtable_type.type)) && \
+     (tbl)->entries != NULL)
+
+#ifdef __cplusplus
+}
+#endif /* __cplusplus */
+
+#endif /* _ESCH_HASHTABLE_H_ */
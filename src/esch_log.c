@@ -77,6 +77,7 @@ struct esch_log_builtin_static esch_log_do_nothing =
         NULL,
     },
     {
+        ESCH_LOG_LEVEL_NONE,
         esch_log_message_do_nothing,
         esch_log_message_do_nothing,
         esch_log_message_do_nothing
@@ -92,6 +93,7 @@ static struct esch_log_builtin_static esch_log_printf =
         NULL,
     },
     {
+        ESCH_LOG_LEVEL_INFO,
         esch_log_error_printf,
         esch_log_warn_printf,
         esch_log_info_printf
@@ -156,6 +158,10 @@ esch_log_error(esch_log* log, const char* fmt, ...)
     ESCH_CHECK_NO_LOG(log != NULL, ESCH_ERROR_INVALID_PARAMETER);
     ESCH_CHECK_NO_LOG(fmt != NULL, ESCH_ERROR_INVALID_PARAMETER);
     ESCH_CHECK_NO_LOG(ESCH_IS_VALID_LOG(log), ESCH_ERROR_INVALID_PARAMETER);
+    if (log->level < ESCH_LOG_LEVEL_ERROR)
+    {
+        goto Exit;
+    }
 
     va_start(ap, fmt);
     ret = log->log_error(log, fmt, ap);
@@ -173,6 +179,10 @@ esch_log_info(esch_log* log, const char* fmt, ...)
     ESCH_CHECK_NO_LOG(log != NULL, ESCH_ERROR_INVALID_PARAMETER);
     ESCH_CHECK_NO_LOG(fmt != NULL, ESCH_ERROR_INVALID_PARAMETER);
     ESCH_CHECK_NO_LOG(ESCH_IS_VALID_LOG(log), ESCH_ERROR_INVALID_PARAMETER);
+    if (log->level < ESCH_LOG_LEVEL_INFO)
+    {
+        goto Exit;
+    }
 
     va_start(ap, fmt);
     ret = log->log_info(log, fmt, ap);
@@ -190,6 +200,10 @@ esch_log_warn(esch_log* log, const char* fmt, ...)
     ESCH_CHECK_NO_LOG(log != NULL, ESCH_ERROR_INVALID_PARAMETER);
     ESCH_CHECK_NO_LOG(fmt != NULL, ESCH_ERROR_INVALID_PARAMETER);
     ESCH_CHECK_NO_LOG(ESCH_IS_VALID_LOG(log), ESCH_ERROR_INVALID_PARAMETER);
+    if (log->level < ESCH_LOG_LEVEL_WARN)
+    {
+        goto Exit;
+    }
 
     va_start(ap, fmt);
     ret = log->log_warn(log, fmt, ap);
@@ -198,6 +212,33 @@ Exit:
     return ret;
 }
 
+esch_error
+esch_log_set_level(esch_log* log, esch_log_level level)
+{
+    esch_error ret = ESCH_OK;
+    ESCH_CHECK_PARAM_PUBLIC(ESCH_IS_VALID_LOG(log));
+    ESCH_CHECK_PARAM_PUBLIC(level >= ESCH_LOG_LEVEL_NONE &&
+                            level <= ESCH_LOG_LEVEL_INFO);
+    /* Static logs are shared by all their users. */
+    ESCH_CHECK_NO_LOG(log != &(esch_log_do_nothing.log) &&
+                      log != &(esch_log_printf.log),
+                      ESCH_ERROR_NOT_SUPPORTED);
+    log->level = level;
+Exit:
+    return ret;
+}
+
+esch_error
+esch_log_get_level(esch_log* log, esch_log_level* level)
+{
+    esch_error ret = ESCH_OK;
+    ESCH_CHECK_PARAM_PUBLIC(ESCH_IS_VALID_LOG(log));
+    ESCH_CHECK_PARAM_PUBLIC(level != NULL);
+    (*level) = log->level;
+Exit:
+    return ret;
+}
+
 
 /**
  * Delete a log object.
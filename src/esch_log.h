@@ -16,6 +16,7 @@ typedef esch_error (*error_log_f)(esch_log*, const char*, va_list);
 
 struct esch_log
 {
+    esch_log_level level;
     error_log_f log_error;
     error_log_f log_warn;
     error_log_f log_info;
@@ -28,12 +29,66 @@ struct esch_log_builtin_static
 };
 extern struct esch_log_builtin_static esch_log_do_nothing;
 
+/* Asynchronous log, see esch_log_async.c. */
+extern struct esch_builtin_type esch_log_async_type;
+extern const int ESCH_LOG_ASYNC_DEFAULT_SLOTS;
+
 #define ESCH_IS_VALID_LOG(log) \
     ((log) != NULL && \
      ESCH_IS_VALID_OBJECT(ESCH_CAST_TO_OBJECT(log)) && \
      (log)->log_error != NULL && \
      (log)->log_info != NULL)
 
+/*
+ * Lowest level compiled into library. Messages below it are removed
+ * by compiler, arguments included. Release builds keep warnings and
+ * errors only. Define ESCH_LOG_LEVEL to override.
+ */
+#ifndef ESCH_LOG_LEVEL
+#    ifdef NDEBUG
+#        define ESCH_LOG_LEVEL ESCH_LOG_LEVEL_WARN
+#    else
+#        define ESCH_LOG_LEVEL ESCH_LOG_LEVEL_INFO
+#    endif /* NDEBUG */
+#endif /* ESCH_LOG_LEVEL */
+
+/*
+ * Check both levels before calling log, so a disabled message costs
+ * one compare and builds no va_list.
+ */
+#define ESCH_LOG_IS_ENABLED(log, lv) \
+    (ESCH_LOG_LEVEL >= (lv) && (log)->level >= (lv))
+
+#define ESCH_LOG_INFO(log, msg) { \
+    if (ESCH_LOG_IS_ENABLED(log, ESCH_LOG_LEVEL_INFO)) { \
+        (void)esch_log_info(log, msg); \
+    } \
+}
+
+#define ESCH_LOG_INFO_1(log, fmt, val1) { \
+    if (ESCH_LOG_IS_ENABLED(log, ESCH_LOG_LEVEL_INFO)) { \
+        (void)esch_log_info(log, fmt, val1); \
+    } \
+}
+
+#define ESCH_LOG_INFO_2(log, fmt, val1, val2) { \
+    if (ESCH_LOG_IS_ENABLED(log, ESCH_LOG_LEVEL_INFO)) { \
+        (void)esch_log_info(log, fmt, val1, val2); \
+    } \
+}
+
+#define ESCH_LOG_WARN(log, msg) { \
+    if (ESCH_LOG_IS_ENABLED(log, ESCH_LOG_LEVEL_WARN)) { \
+        (void)esch_log_warn(log, msg); \
+    } \
+}
+
+#define ESCH_LOG_WARN_1(log, fmt, val1) { \
+    if (ESCH_LOG_IS_ENABLED(log, ESCH_LOG_LEVEL_WARN)) { \
+        (void)esch_log_warn(log, fmt, val1); \
+    } \
+}
+
 #ifdef __cplusplus
 }
 #endif /* __cplusplus */
@@ -0,0 +1,435 @@
+/* vim:ft=c expandtab tw=72 sw=4
+ */
+/* See Copyright notice in esch.h */
+#ifdef _WIN32
+#    include <io.h>
+#    define esch_vsnprintf _vsnprintf
+#    define esch_write _write
+#else
+/* For vsnprintf() in strict C89 mode. */
+#    define _XOPEN_SOURCE 500
+#    include <unistd.h>
+#    define esch_vsnprintf vsnprintf
+#    define esch_write write
+#endif
+#include "esch_log.h"
+#include "esch_alloc.h"
+#include "esch_config.h"
+#include "esch_debug.h"
+#include "esch_thread.h"
+#include <stdio.h>
+#include <string.h>
+
+/*
+ * Asynchronous log. Producers claim a slot of ring buffer with CAS on
+ * enqueue counter and format message into it. Each slot has a sequence
+ * number, which tells whether slot is free for position (sequence ==
+ * position) or holds a message for it (sequence == position + 1), so
+ * producers never wait for each other or for drain thread. Drain
+ * thread is the only consumer.
+ */
+#define ESCH_LOG_ASYNC_MESSAGE_SIZE 240
+#define ESCH_LOG_ASYNC_CACHE_LINE 64
+/* Drain thread writes messages in batches of this size. */
+#define ESCH_LOG_ASYNC_BATCH 8192
+/* Drain thread sleeps this long when buffer is empty. */
+#define ESCH_LOG_ASYNC_IDLE_MS 1
+
+const int ESCH_LOG_ASYNC_DEFAULT_SLOTS = 1024;
+
+struct esch_log_async_slot
+{
+    volatile size_t sequence;
+    size_t length;
+    char message[ESCH_LOG_ASYNC_MESSAGE_SIZE];
+};
+
+typedef struct esch_log_async esch_log_async;
+struct esch_log_async
+{
+    esch_log log; /* Must be first. Log functions get esch_log*. */
+    struct esch_log_async_slot* slots;
+    size_t mask; /* Number of slots - 1. Number of slots is 2^n. */
+    int fd;
+    esch_thread drainer;
+    /* Producers and drain thread update counters below. Keep them
+     * on different cache lines. */
+    char padding1[ESCH_LOG_ASYNC_CACHE_LINE];
+    volatile size_t enqueue;
+    volatile size_t dropped;
+    char padding2[ESCH_LOG_ASYNC_CACHE_LINE];
+    volatile size_t dequeue; /* Messages before it are written. */
+    volatile size_t written;
+    volatile size_t stop;
+};
+
+static esch_error esch_log_async_destructor(esch_object* obj);
+static esch_error esch_log_new_async_as_object(esch_config* config,
+                                               esch_object** obj);
+static esch_error esch_log_async_error(esch_log* log,
+                                       const char* fmt, va_list args);
+static esch_error esch_log_async_warn(esch_log* log,
+                                      const char* fmt, va_list args);
+static esch_error esch_log_async_info(esch_log* log,
+                                      const char* fmt, va_list args);
+static esch_error esch_log_async_write_i(esch_log_async* async,
+                                         const char* prefix,
+                                         const char* fmt, va_list args);
+static void esch_log_async_drain_i(void* arg);
+static esch_error esch_log_async_output_i(esch_log_async* async,
+                                         const char* buffer,
+                                         size_t length);
+
+struct esch_builtin_type esch_log_async_type =
+{
+    {
+        &(esch_meta_type.type),
+        NULL, /* No alloc */
+        &(esch_log_do_nothing.log),
+        NULL,
+        NULL,
+    },
+    {
+        ESCH_VERSION,
+        sizeof(esch_log_async),
+        esch_log_new_async_as_object,
+        esch_log_async_destructor,
+        esch_type_default_non_copiable,
+        esch_type_default_no_string_form,
+        esch_type_default_no_doc,
+        esch_type_default_no_iterator
+    },
+};
+
+#define ESCH_IS_ASYNC_LOG(log) \
+    (ESCH_OBJECT_GET_TYPE(ESCH_CAST_TO_OBJECT(log)) == \
+     &(esch_log_async_type.type))
+
+esch_error
+esch_log_new_async(esch_config* config, esch_log** log)
+{
+    esch_error ret = ESCH_OK;
+    esch_alloc* alloc = NULL;
+    esch_log* config_log = NULL;
+    esch_object* new_obj = NULL;
+    esch_log_async* async = NULL;
+    struct esch_log_async_slot* slots = NULL;
+    size_t slot_count = 2;
+    int slots_wanted = 0;
+    size_t i = 0;
+
+    ESCH_CHECK_PARAM_PUBLIC(config != NULL);
+    ESCH_CHECK_PARAM_PUBLIC(log != NULL);
+    ESCH_CHECK_PARAM_PUBLIC(ESCH_CONFIG_GET_ALLOC(config) != NULL);
+    ESCH_CHECK_PARAM_PUBLIC(ESCH_CONFIG_GET_LOG(config) != NULL);
+    alloc = ESCH_CAST_FROM_OBJECT(ESCH_CONFIG_GET_ALLOC(config), esch_alloc);
+    config_log = ESCH_CAST_FROM_OBJECT(ESCH_CONFIG_GET_LOG(config),
+                                       esch_log);
+    slots_wanted = ESCH_CONFIG_GET_LOG_ASYNC_SLOTS(config);
+    ESCH_CHECK_1(slots_wanted > 0, config_log,
+                 "log:async:Bad slot count: %d", slots_wanted,
+                 ESCH_ERROR_INVALID_PARAMETER);
+    while (slot_count < (size_t)slots_wanted)
+    {
+        slot_count <<= 1;
+    }
+
+    ret = esch_alloc_realloc(alloc, NULL,
+                             sizeof(esch_object) + sizeof(esch_log_async),
+                             (void**)&new_obj);
+    ESCH_CHECK(ret == ESCH_OK, config_log, "Can't create async log", ret);
+    ret = esch_alloc_realloc(alloc, NULL,
+                             sizeof(struct esch_log_async_slot) * slot_count,
+                             (void**)&slots);
+    ESCH_CHECK(ret == ESCH_OK, config_log, "Can't create log buffer", ret);
+    for (i = 0; i < slot_count; ++i)
+    {
+        slots[i].sequence = i;
+        slots[i].length = 0;
+    }
+
+    ESCH_OBJECT_GET_TYPE(new_obj)    = &(esch_log_async_type.type);
+    ESCH_OBJECT_GET_ALLOC(new_obj)   = alloc;
+    ESCH_OBJECT_GET_LOG(new_obj)     = config_log;
+    ESCH_OBJECT_GET_GC(new_obj)      = NULL;
+    ESCH_OBJECT_GET_GC_ID(new_obj)   = NULL; /* Can't get managed. */
+    async = ESCH_CAST_FROM_OBJECT(new_obj, esch_log_async);
+    async->log.level = ESCH_LOG_LEVEL_INFO;
+    async->log.log_error = esch_log_async_error;
+    async->log.log_warn = esch_log_async_warn;
+    async->log.log_info = esch_log_async_info;
+    async->slots = slots;
+    async->mask = slot_count - 1;
+    async->fd = ESCH_CONFIG_GET_LOG_ASYNC_FD(config);
+    async->enqueue = 0;
+    async->dropped = 0;
+    async->dequeue = 0;
+    async->written = 0;
+    async->stop = 0;
+
+    ret = esch_thread_start_i(&(async->drainer),
+                              esch_log_async_drain_i, async);
+    ESCH_CHECK(ret == ESCH_OK, config_log, "Can't start drain thread", ret);
+    (*log) = &(async->log);
+    new_obj = NULL;
+    slots = NULL;
+Exit:
+    if (new_obj != NULL)
+    {
+        esch_alloc_free(alloc, new_obj);
+    }
+    if (slots != NULL)
+    {
+        esch_alloc_free(alloc, slots);
+    }
+    return ret;
+}
+
+esch_error
+esch_log_flush(esch_log* log)
+{
+    esch_error ret = ESCH_OK;
+    esch_log_async* async = NULL;
+    size_t target = 0;
+    ESCH_CHECK_PARAM_PUBLIC(ESCH_IS_VALID_LOG(log));
+
+    if (ESCH_IS_ASYNC_LOG(log))
+    {
+        async = (esch_log_async*)log;
+        target = esch_atomic_load_i(&(async->enqueue));
+        while (esch_atomic_load_i(&(async->dequeue)) < target)
+        {
+            esch_thread_sleep_i(ESCH_LOG_ASYNC_IDLE_MS);
+        }
+    }
+Exit:
+    return ret;
+}
+
+esch_error
+esch_log_get_counters(esch_log* log, size_t* written, size_t* dropped)
+{
+    esch_error ret = ESCH_OK;
+    esch_log_async* async = NULL;
+    ESCH_CHECK_PARAM_PUBLIC(ESCH_IS_VALID_LOG(log));
+
+    if (ESCH_IS_ASYNC_LOG(log))
+    {
+        async = (esch_log_async*)log;
+        if (written != NULL)
+        {
+            (*written) = esch_atomic_load_i(&(async->written));
+        }
+        if (dropped != NULL)
+        {
+            (*dropped) = esch_atomic_load_i(&(async->dropped));
+        }
+    }
+    else
+    {
+        if (written != NULL)
+        {
+            (*written) = 0;
+        }
+        if (dropped != NULL)
+        {
+            (*dropped) = 0;
+        }
+    }
+Exit:
+    return ret;
+}
+
+/*
+ * Stop drain thread after it writes all pending messages. Caller must
+ * make sure no thread logs at the same time.
+ */
+static esch_error
+esch_log_async_destructor(esch_object* obj)
+{
+    esch_log_async* async = ESCH_CAST_FROM_OBJECT(obj, esch_log_async);
+    esch_atomic_store_i(&(async->stop), 1);
+    (void)esch_thread_join_i(&(async->drainer));
+    esch_alloc_free(ESCH_OBJECT_GET_ALLOC(obj), async->slots);
+    async->slots = NULL;
+    return ESCH_OK;
+}
+
+static esch_error
+esch_log_new_async_as_object(esch_config* config, esch_object** obj)
+{
+    esch_error ret = ESCH_OK;
+    esch_log* log = NULL;
+    ret = esch_log_new_async(config, &log);
+    if (ret == ESCH_OK)
+    {
+        (*obj) = ESCH_CAST_TO_OBJECT(log);
+    }
+    return ret;
+}
+
+static esch_error
+esch_log_async_error(esch_log* log, const char* fmt, va_list args)
+{
+    return esch_log_async_write_i((esch_log_async*)log,
+                                  "[ERROR] ", fmt, args);
+}
+
+static esch_error
+esch_log_async_warn(esch_log* log, const char* fmt, va_list args)
+{
+    return esch_log_async_write_i((esch_log_async*)log,
+                                  "[WARN]  ", fmt, args);
+}
+
+static esch_error
+esch_log_async_info(esch_log* log, const char* fmt, va_list args)
+{
+    return esch_log_async_write_i((esch_log_async*)log,
+                                  "[INFO]  ", fmt, args);
+}
+
+/*
+ * Claim a slot, format message into it and publish it. Long messages
+ * are truncated. If buffer is full, message is dropped.
+ */
+static esch_error
+esch_log_async_write_i(esch_log_async* async, const char* prefix,
+                       const char* fmt, va_list args)
+{
+    struct esch_log_async_slot* slot = NULL;
+    size_t pos = 0;
+    size_t prefix_length = strlen(prefix);
+    ptrdiff_t diff = 0;
+    int length = 0;
+
+    pos = esch_atomic_load_i(&(async->enqueue));
+    for (;;)
+    {
+        slot = &(async->slots[pos & async->mask]);
+        diff = (ptrdiff_t)(esch_atomic_load_i(&(slot->sequence)) - pos);
+        if (diff == 0)
+        {
+            if (esch_atomic_cas_i(&(async->enqueue), pos, pos + 1))
+            {
+                break;
+            }
+            pos = esch_atomic_load_i(&(async->enqueue));
+        }
+        else if (diff < 0)
+        {
+            /* Slot still holds a message of last round: full. */
+            (void)esch_atomic_add_i(&(async->dropped), 1);
+            return ESCH_ERROR_CONTAINER_FULL;
+        }
+        else
+        {
+            /* Another producer took this position. */
+            pos = esch_atomic_load_i(&(async->enqueue));
+        }
+    }
+
+    memcpy(slot->message, prefix, prefix_length);
+    /* Keep last byte for '\n'. */
+    length = esch_vsnprintf(slot->message + prefix_length,
+                            ESCH_LOG_ASYNC_MESSAGE_SIZE - prefix_length - 1,
+                            fmt, args);
+    if (length < 0 ||
+        (size_t)length > ESCH_LOG_ASYNC_MESSAGE_SIZE - prefix_length - 2)
+    {
+        length = (int)(ESCH_LOG_ASYNC_MESSAGE_SIZE - prefix_length - 2);
+    }
+    length += (int)prefix_length;
+    slot->message[length] = '\n';
+    slot->length = (size_t)length + 1;
+    esch_atomic_store_i(&(slot->sequence), pos + 1);
+    return ESCH_OK;
+}
+
+/*
+ * Write a batch of count messages. If write fails, there's nowhere to
+ * report it, so all messages of batch are counted as dropped, even if
+ * some of them are partly written.
+ */
+static void
+esch_log_async_write_batch_i(esch_log_async* async, const char* batch,
+                             size_t length, size_t count)
+{
+    if (esch_log_async_output_i(async, batch, length) == ESCH_OK)
+    {
+        (void)esch_atomic_add_i(&(async->written), count);
+    }
+    else
+    {
+        (void)esch_atomic_add_i(&(async->dropped), count);
+    }
+}
+
+/*
+ * Drain thread: copy published messages into a batch, free their
+ * slots, and write batch when it's full or buffer is empty.
+ */
+static void
+esch_log_async_drain_i(void* arg)
+{
+    esch_log_async* async = (esch_log_async*)arg;
+    struct esch_log_async_slot* slot = NULL;
+    char batch[ESCH_LOG_ASYNC_BATCH];
+    size_t used = 0;
+    size_t count = 0;
+    size_t pos = async->dequeue;
+
+    for (;;)
+    {
+        slot = &(async->slots[pos & async->mask]);
+        if (esch_atomic_load_i(&(slot->sequence)) == pos + 1)
+        {
+            if (used + slot->length > ESCH_LOG_ASYNC_BATCH)
+            {
+                esch_log_async_write_batch_i(async, batch, used, count);
+                esch_atomic_store_i(&(async->dequeue), pos);
+                used = 0;
+                count = 0;
+            }
+            memcpy(batch + used, slot->message, slot->length);
+            used += slot->length;
+            ++count;
+            /* Free for next round. */
+            esch_atomic_store_i(&(slot->sequence), pos + async->mask + 1);
+            ++pos;
+        }
+        else if (used > 0)
+        {
+            esch_log_async_write_batch_i(async, batch, used, count);
+            esch_atomic_store_i(&(async->dequeue), pos);
+            used = 0;
+            count = 0;
+        }
+        else if (esch_atomic_load_i(&(async->stop)))
+        {
+            break;
+        }
+        else
+        {
+            esch_thread_sleep_i(ESCH_LOG_ASYNC_IDLE_MS);
+        }
+    }
+}
+
+static esch_error
+esch_log_async_output_i(esch_log_async* async,
+                        const char* buffer, size_t length)
+{
+    int done = 0;
+    while (length > 0)
+    {
+        done = (int)esch_write(async->fd, buffer, length);
+        if (done <= 0)
+        {
+            return ESCH_ERROR_INVALID_STATE;
+        }
+        buffer += done;
+        length -= (size_t)done;
+    }
+    return ESCH_OK;
+}
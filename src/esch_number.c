@@ -1,237 +1,1676 @@
-#include <stdlib.h>
+/* vim:ft=c expandtab tw=72 sw=4
+ */
+/* See Copyright notice in esch.h */
 #include <string.h>
 #include <limits.h>
 #include <assert.h>
+#include "esch_number.h"
+#include "esch_type.h"
 #include "esch_config.h"
+#include "esch_alloc.h"
+#include "esch_log.h"
 #include "esch_debug.h"
-#include "esch_number.h"
 
-static int
-esch_integer_convert_char(char ch)
+/*
+ * Integers keep small values in an int, and switch to limbs (see
+ * esch_bignum.c) only when a result does not fit. Operations read both
+ * kinds through esch_integer_view, so limb code never needs to know
+ * where a magnitude comes from.
+ */
+
+/* Largest power of 10 in a limb, used by base-10 conversion. */
+#define ESCH_INTEGER_BASE10_CHUNK ((esch_limb)1000000000)
+#define ESCH_INTEGER_BASE10_DIGITS 9
+/* Limbs enough for given number of digits, with room for a product. */
+#define ESCH_INTEGER_BASE10_LIMBS(digits) ((digits) / 9 + 2)
+
+/*
+ * Powers of 10 for divide-and-conquer conversion: powers[i] is
+ * 10^(9 * 2^i). Printing also keeps floor(B^(2 * length) / power)
+ * for Barrett division, where B is 2^ESCH_LIMB_BITS.
+ */
+#define ESCH_INTEGER_POW10_LEVELS 48
+struct esch_integer_pow10
+{
+    esch_limb* limbs;
+    size_t length;
+    esch_limb* inverse;
+    size_t inverse_length;
+};
+
+struct esch_integer_base10
+{
+    esch_alloc* alloc;
+    esch_log* log;
+    int levels; /* Number of powers computed. */
+    struct esch_integer_pow10 powers[ESCH_INTEGER_POW10_LEVELS];
+};
+
+const char esch_number_digit_pairs[] =
+    "00010203040506070809"
+    "10111213141516171819"
+    "20212223242526272829"
+    "30313233343536373839"
+    "40414243444546474849"
+    "50515253545556575859"
+    "60616263646566676869"
+    "70717273747576777879"
+    "80818283848586878889"
+    "90919293949596979899";
+
+static esch_error
+esch_integer_default_new(esch_config* config, esch_object** obj);
+static esch_error
+esch_integer_destructor(esch_object* obj);
+
+struct esch_builtin_type esch_integer_type =
 {
-    if (ch >= '0' && ch <= '9')
     {
-        return ch - '0';
+        &(esch_meta_type.type),
+        NULL, /* No alloc */
+        &(esch_log_do_nothing.log),
+        NULL, /* Non-GC object */
+        NULL,
+    },
+    {
+        ESCH_VERSION,
+        sizeof(esch_integer),
+        esch_integer_default_new,
+        esch_integer_destructor,
+        esch_type_default_non_copiable,
+        esch_type_default_no_string_form,
+        esch_type_default_no_doc,
+        esch_type_default_no_iterator
     }
-    else if (ch >= 'a' && ch <= 'f')
+};
+
+static esch_error
+esch_integer_default_new(esch_config* config, esch_object** obj)
+{
+    esch_error ret = ESCH_OK;
+    esch_integer* val = NULL;
+    ret = esch_integer_new_from_int(config, 0, &val);
+    if (ret == ESCH_OK)
     {
-        return 10 + (ch - 'a');
+        (*obj) = ESCH_CAST_TO_OBJECT(val);
     }
-    else if (ch >= 'A' && ch <= 'F')
+    return ret;
+}
+
+static esch_error
+esch_integer_destructor(esch_object* obj)
+{
+    esch_integer* val = ESCH_CAST_FROM_OBJECT(obj, esch_integer);
+    esch_error ret = ESCH_OK;
+    if (val->limbs != NULL)
     {
-        return 10 + (ch - 'A');
+        ret = esch_alloc_free(ESCH_OBJECT_GET_ALLOC(obj), val->limbs);
+        val->limbs = NULL;
     }
-    assert(0); /* It will ot happen */
-    return 0;
+    return ret;
+}
+
+void
+esch_integer_get_small_view_i(int value, struct esch_integer_view* view)
+{
+    /* Negate in unsigned, so INT_MIN is safe. */
+    view->negative = (value < 0);
+    view->small = (value < 0? 0 - (esch_limb)value: (esch_limb)value);
+    view->length = (view->small == 0? 0: 1);
+    view->limbs = &(view->small);
+}
+
+void
+esch_integer_get_view_i(esch_integer* val, struct esch_integer_view* view)
+{
+    if (val->limbs != NULL)
+    {
+        view->negative = val->negative;
+        view->length = val->length;
+        view->limbs = val->limbs;
+    }
+    else
+    {
+        esch_integer_get_small_view_i(val->ival, view);
+    }
+}
+
+static esch_error
+esch_integer_new_small_i(esch_config* config, int value,
+                         esch_integer** val)
+{
+    esch_error ret = ESCH_OK;
+    esch_object* obj = NULL;
+    esch_integer* new_val = NULL;
+
+    ret = esch_object_new_i(config, &(esch_integer_type.type), &obj);
+    if (ret == ESCH_OK)
+    {
+        new_val = ESCH_CAST_FROM_OBJECT(obj, esch_integer);
+        new_val->ival = value;
+        new_val->negative = (value < 0);
+        new_val->length = 0;
+        new_val->limbs = NULL;
+        (*val) = new_val;
+    }
+    return ret;
+}
+
+/* Check if a magnitude fits in int. Limbs must be normalized. */
+esch_bool
+esch_integer_fits_int_i(esch_bool negative, const esch_limb* limbs,
+                        size_t length, int* value)
+{
+    esch_dlimb mag = 0;
+    if (length > 2)
+    {
+        return ESCH_FALSE;
+    }
+    mag = (length > 0? limbs[0]: 0);
+    if (length == 2)
+    {
+        mag |= (esch_dlimb)limbs[1] << ESCH_LIMB_BITS;
+    }
+    if (mag <= (esch_dlimb)INT_MAX)
+    {
+        (*value) = (negative? -(int)mag: (int)mag);
+        return ESCH_TRUE;
+    }
+    if (negative && mag == (esch_dlimb)INT_MAX + 1)
+    {
+        (*value) = INT_MIN;
+        return ESCH_TRUE;
+    }
+    return ESCH_FALSE;
+}
+
+/*
+ * Create integer from a limb buffer, which is always taken over, even
+ * when an error is returned. Buffer is freed if value fits in int.
+ */
+esch_error
+esch_integer_new_from_limbs_i(esch_config* config, esch_bool negative,
+                              esch_limb* limbs, size_t length,
+                              esch_integer** val)
+{
+    esch_error ret = ESCH_OK;
+    esch_alloc* alloc = NULL;
+    esch_log* log = NULL;
+    esch_object* obj = NULL;
+    esch_integer* new_val = NULL;
+    int value = 0;
+
+    alloc = ESCH_CAST_FROM_OBJECT(ESCH_CONFIG_GET_ALLOC(config), esch_alloc);
+    log = ESCH_CAST_FROM_OBJECT(ESCH_CONFIG_GET_LOG(config), esch_log);
+    length = esch_bignum_normalize_i(limbs, length);
+    if (esch_integer_fits_int_i(negative, limbs, length, &value))
+    {
+        ret = esch_integer_new_small_i(config, value, val);
+        goto Exit;
+    }
+    ret = esch_object_new_i(config, &(esch_integer_type.type), &obj);
+    ESCH_CHECK(ret == ESCH_OK, log, "Can't create integer", ret);
+    new_val = ESCH_CAST_FROM_OBJECT(obj, esch_integer);
+    new_val->ival = 0;
+    new_val->negative = negative;
+    new_val->length = length;
+    new_val->limbs = limbs;
+    limbs = NULL;
+    (*val) = new_val;
+Exit:
+    if (limbs != NULL)
+    {
+        (void)esch_alloc_free(alloc, limbs);
+    }
+    return ret;
+}
+
+static esch_error
+esch_integer_new_from_wide_i(esch_config* config, int64_t value,
+                             esch_integer** val)
+{
+    esch_error ret = ESCH_OK;
+    esch_alloc* alloc = NULL;
+    esch_limb* limbs = NULL;
+    uint64_t mag = 0;
+
+    if (value >= INT_MIN && value <= INT_MAX)
+    {
+        return esch_integer_new_small_i(config, (int)value, val);
+    }
+    alloc = ESCH_CAST_FROM_OBJECT(ESCH_CONFIG_GET_ALLOC(config), esch_alloc);
+    ret = esch_alloc_realloc(alloc, NULL, sizeof(esch_limb) * 2,
+                             (void**)&limbs);
+    if (ret != ESCH_OK)
+    {
+        return ret;
+    }
+    mag = (value < 0? 0 - (uint64_t)value: (uint64_t)value);
+    limbs[0] = (esch_limb)mag;
+    limbs[1] = (esch_limb)(mag >> ESCH_LIMB_BITS);
+    return esch_integer_new_from_limbs_i(config, (value < 0),
+                                         limbs, 2, val);
+}
+
+static esch_error
+esch_integer_new_from_view_i(esch_config* config,
+                             struct esch_integer_view* view,
+                             esch_integer** val)
+{
+    esch_error ret = ESCH_OK;
+    esch_alloc* alloc = NULL;
+    esch_limb* limbs = NULL;
+
+    if (view->length == 0)
+    {
+        return esch_integer_new_small_i(config, 0, val);
+    }
+    alloc = ESCH_CAST_FROM_OBJECT(ESCH_CONFIG_GET_ALLOC(config), esch_alloc);
+    ret = esch_alloc_realloc(alloc, NULL, sizeof(esch_limb) * view->length,
+                             (void**)&limbs);
+    if (ret != ESCH_OK)
+    {
+        return ret;
+    }
+    memcpy(limbs, view->limbs, sizeof(esch_limb) * view->length);
+    return esch_integer_new_from_limbs_i(config, view->negative,
+                                         limbs, view->length, val);
+}
+
+/*
+ * Operations below return a raw limb buffer, so callers decide if
+ * result becomes an esch_integer object or an esch_value. Zero is
+ * returned as NULL buffer.
+ */
+esch_error
+esch_integer_add_i(esch_config* config,
+                   struct esch_integer_view* a,
+                   struct esch_integer_view* b,
+                   esch_bool* negative, esch_limb** limbs, size_t* length)
+{
+    esch_error ret = ESCH_OK;
+    esch_alloc* alloc = NULL;
+    esch_limb* new_limbs = NULL;
+    struct esch_integer_view* tmp = NULL;
+    int cmp = 0;
+
+    cmp = esch_bignum_compare_i(a->limbs, a->length, b->limbs, b->length);
+    if (cmp < 0)
+    {
+        /* Keep a the larger magnitude. */
+        tmp = a;
+        a = b;
+        b = tmp;
+    }
+    else if (cmp == 0 && a->negative != b->negative)
+    {
+        (*negative) = ESCH_FALSE;
+        (*limbs) = NULL;
+        (*length) = 0;
+        return ESCH_OK;
+    }
+    alloc = ESCH_CAST_FROM_OBJECT(ESCH_CONFIG_GET_ALLOC(config), esch_alloc);
+    ret = esch_alloc_realloc(alloc, NULL,
+                             sizeof(esch_limb) * (a->length + 1),
+                             (void**)&new_limbs);
+    if (ret != ESCH_OK)
+    {
+        return ret;
+    }
+    if (a->negative == b->negative)
+    {
+        new_limbs[a->length] = esch_bignum_add_i(new_limbs,
+                                                 a->limbs, a->length,
+                                                 b->limbs, b->length);
+    }
+    else
+    {
+        (void)esch_bignum_sub_i(new_limbs, a->limbs, a->length,
+                                b->limbs, b->length);
+        new_limbs[a->length] = 0;
+    }
+    (*negative) = a->negative;
+    (*limbs) = new_limbs;
+    (*length) = a->length + 1;
+    return ESCH_OK;
+}
+
+/* r = a * b. r has an + bn limbs. Operands can come in any order. */
+esch_error
+esch_integer_mul_limbs_i(esch_alloc* alloc, esch_log* log, esch_limb* r,
+                         const esch_limb* a, size_t an,
+                         const esch_limb* b, size_t bn)
+{
+    esch_error ret = ESCH_OK;
+    esch_limb* scratch = NULL;
+    const esch_limb* tmp = NULL;
+    size_t tmp_len = 0;
+
+    if (an < bn)
+    {
+        tmp = a;
+        a = b;
+        b = tmp;
+        tmp_len = an;
+        an = bn;
+        bn = tmp_len;
+    }
+    if (bn == 0)
+    {
+        memset(r, 0, sizeof(esch_limb) * an);
+        goto Exit;
+    }
+    tmp_len = esch_bignum_mul_scratch_i(an, bn);
+    if (tmp_len > 0)
+    {
+        ret = esch_alloc_realloc(alloc, NULL, sizeof(esch_limb) * tmp_len,
+                                 (void**)&scratch);
+        ESCH_CHECK(ret == ESCH_OK, log, "Can't create scratch", ret);
+    }
+    esch_bignum_mul_i(r, a, an, b, bn, scratch);
+Exit:
+    (void)esch_alloc_free(alloc, scratch);
+    return ret;
 }
 
-#ifdef NDEBUG
+esch_error
+esch_integer_mul_i(esch_config* config,
+                   struct esch_integer_view* a,
+                   struct esch_integer_view* b,
+                   esch_bool* negative, esch_limb** limbs, size_t* length)
+{
+    esch_error ret = ESCH_OK;
+    esch_alloc* alloc = NULL;
+    esch_log* log = NULL;
+    struct esch_integer_view* tmp = NULL;
+    esch_limb* new_limbs = NULL;
 
-#define ESCH_INTEGER_VERIFY(begin, end) (void)(0)
+    alloc = ESCH_CAST_FROM_OBJECT(ESCH_CONFIG_GET_ALLOC(config), esch_alloc);
+    log = ESCH_CAST_FROM_OBJECT(ESCH_CONFIG_GET_LOG(config), esch_log);
+    /* Views of small integers point to themselves: swap pointers,
+     * never copy views. */
+    if (a->length < b->length)
+    {
+        tmp = a;
+        a = b;
+        b = tmp;
+    }
+    (*negative) = (a->negative != b->negative);
+    (*limbs) = NULL;
+    (*length) = 0;
+    if (b->length == 0)
+    {
+        goto Exit;
+    }
+    ret = esch_alloc_realloc(alloc, NULL,
+                             sizeof(esch_limb) * (a->length + b->length),
+                             (void**)&new_limbs);
+    ESCH_CHECK(ret == ESCH_OK, log, "Can't create limbs", ret);
+    ret = esch_integer_mul_limbs_i(alloc, log, new_limbs,
+                                   a->limbs, a->length,
+                                   b->limbs, b->length);
+    ESCH_CHECK(ret == ESCH_OK, log, "Can't multiply", ret);
+    (*limbs) = new_limbs;
+    (*length) = a->length + b->length;
+    new_limbs = NULL;
+Exit:
+    (void)esch_alloc_free(alloc, new_limbs);
+    return ret;
+}
 
-#else
+/*
+ * Same as esch_integer_new_from_limbs_i(), but result is a value:
+ * a fixnum if it fits in int, or an esch_integer object.
+ */
+static esch_error
+esch_integer_to_value_i(esch_config* config, esch_bool negative,
+                        esch_limb* limbs, size_t length,
+                        esch_value* value)
+{
+    esch_error ret = ESCH_OK;
+    esch_integer* val = NULL;
+    int fixnum = 0;
+
+    length = esch_bignum_normalize_i(limbs, length);
+    if (esch_integer_fits_int_i(negative, limbs, length, &fixnum))
+    {
+        (void)esch_alloc_free(ESCH_CAST_FROM_OBJECT(
+                ESCH_CONFIG_GET_ALLOC(config), esch_alloc), limbs);
+        value->type = ESCH_VALUE_TYPE_INTEGER;
+        value->val.i = fixnum;
+        return ESCH_OK;
+    }
+    ret = esch_integer_new_from_limbs_i(config, negative,
+                                        limbs, length, &val);
+    if (ret == ESCH_OK)
+    {
+        value->type = ESCH_VALUE_TYPE_OBJECT;
+        value->val.o = ESCH_CAST_TO_OBJECT(val);
+    }
+    return ret;
+}
+
+/*
+ * ---------------------------------------------------------------
+ * Base-10 conversion
+ * ---------------------------------------------------------------
+ */
+static void
+esch_integer_base10_init_i(struct esch_integer_base10* ctx,
+                           esch_alloc* alloc, esch_log* log)
+{
+    /* Powers are set up by esch_integer_base10_grow_i(). */
+    ctx->alloc = alloc;
+    ctx->log = log;
+    ctx->levels = 0;
+}
 
 static void
-esch_integer_verify(const char* begin, const char* end)
+esch_integer_base10_fini_i(struct esch_integer_base10* ctx)
 {
-    const char* iter = begin;
-    for(; iter != end; ++iter)
+    int i = 0;
+    for (i = 0; i < ctx->levels; ++i)
     {
-        assert((*iter) >= '0' && (*iter) <= '9');
+        (void)esch_alloc_free(ctx->alloc, ctx->powers[i].limbs);
+        (void)esch_alloc_free(ctx->alloc, ctx->powers[i].inverse);
     }
 }
-#define ESCH_INTEGER_VERIFY(begin, end) esch_integer_verify(begin, end)
 
-#endif /* NDEBUG */
+/* Compute powers up to given level, each one the square of previous. */
+static esch_error
+esch_integer_base10_grow_i(struct esch_integer_base10* ctx, int level)
+{
+    esch_error ret = ESCH_OK;
+    struct esch_integer_pow10* power = NULL;
+    struct esch_integer_pow10* lower = NULL;
+
+    ESCH_CHECK_1(level < ESCH_INTEGER_POW10_LEVELS, ctx->log,
+                 "integer:base10: Too many levels: %d", level,
+                 ESCH_ERROR_OUT_OF_BOUND);
+    while (ctx->levels <= level)
+    {
+        power = &(ctx->powers[ctx->levels]);
+        lower = (ctx->levels == 0? NULL: power - 1);
+        power->length = (lower == NULL? 1: 2 * lower->length);
+        ret = esch_alloc_realloc(ctx->alloc, NULL,
+                                 sizeof(esch_limb) * power->length,
+                                 (void**)&(power->limbs));
+        ESCH_CHECK(ret == ESCH_OK, ctx->log, "Can't create power", ret);
+        power->inverse = NULL;
+        power->inverse_length = 0;
+        ++(ctx->levels);
+        if (lower == NULL)
+        {
+            power->limbs[0] = ESCH_INTEGER_BASE10_CHUNK;
+            continue;
+        }
+        ret = esch_integer_mul_limbs_i(ctx->alloc, ctx->log, power->limbs,
+                                       lower->limbs, lower->length,
+                                       lower->limbs, lower->length);
+        ESCH_CHECK(ret == ESCH_OK, ctx->log, "Can't square power", ret);
+        power->length = esch_bignum_normalize_i(power->limbs,
+                                                power->length);
+    }
+Exit:
+    return ret;
+}
 
-/**
- * Create a new integer object. Internal use only.
- * @param config Configuration object.
- * @param begin An integer number, represented in string.
- * @param end End of string. Give NULL means check until '\0'.
- * @param val Created integer value.
- * @return Return code. ESCH_OK if success.
+/*
+ * Compute floor(B^(2m) / P) for the m-limb power P of given level.
+ * Square of the lower level's inverse is an estimate from below with
+ * half the precision, and Newton steps X += X * (B^2m - P * X) / B^2m
+ * stay below the real value while doubling precision. It takes a few
+ * multiplications, instead of one quadratic long division.
+ */
+static esch_error
+esch_integer_base10_inverse_i(struct esch_integer_base10* ctx, int level)
+{
+    esch_error ret = ESCH_OK;
+    struct esch_integer_pow10* power = &(ctx->powers[level]);
+    struct esch_integer_pow10* lower = NULL;
+    esch_limb* x = NULL;
+    esch_limb* px = NULL;
+    esch_limb* e = NULL;
+    esch_limb* xe = NULL;
+    size_t m = power->length;
+    size_t n = 2 * m;
+    size_t xn = 0;
+    size_t pxn = 0;
+    size_t en = 0;
+    size_t xen = 0;
+    size_t shift = 0;
+    size_t keep = 0;
+    size_t dx = 0;
+    size_t de = 0;
+    size_t i = 0;
+    esch_dlimb wide = 0;
+    esch_limb carry = 0;
+
+    if (power->inverse != NULL)
+    {
+        goto Exit;
+    }
+    /* Inverse is below B^(m + 1). One more limb for Newton steps. */
+    ret = esch_alloc_realloc(ctx->alloc, NULL, sizeof(esch_limb) * (m + 2),
+                             (void**)&x);
+    ESCH_CHECK(ret == ESCH_OK, ctx->log, "Can't create inverse", ret);
+    if (level == 0)
+    {
+        /* Base is not a power of 2, so (B^2 - 1) / P is exact. */
+        wide = ~(esch_dlimb)0 / power->limbs[0];
+        x[0] = (esch_limb)wide;
+        x[1] = (esch_limb)(wide >> ESCH_LIMB_BITS);
+        xn = esch_bignum_normalize_i(x, 2);
+        goto Done;
+    }
+    ret = esch_integer_base10_inverse_i(ctx, level - 1);
+    ESCH_CHECK(ret == ESCH_OK, ctx->log, "Can't get lower inverse", ret);
+    lower = power - 1;
+
+    ret = esch_alloc_realloc(ctx->alloc, NULL,
+                             sizeof(esch_limb) * (m + 2 + n), (void**)&xe);
+    ESCH_CHECK(ret == ESCH_OK, ctx->log, "Can't create product", ret);
+    ret = esch_alloc_realloc(ctx->alloc, NULL,
+                             sizeof(esch_limb) * (m + 2 + m), (void**)&px);
+    ESCH_CHECK(ret == ESCH_OK, ctx->log, "Can't create product", ret);
+    ret = esch_alloc_realloc(ctx->alloc, NULL, sizeof(esch_limb) * n,
+                             (void**)&e);
+    ESCH_CHECK(ret == ESCH_OK, ctx->log, "Can't create error", ret);
+
+    /* B^(4m') / P'^2 is scaled to B^2m / P by dropping limbs. */
+    ret = esch_integer_mul_limbs_i(ctx->alloc, ctx->log, xe,
+                                   lower->inverse, lower->inverse_length,
+                                   lower->inverse, lower->inverse_length);
+    ESCH_CHECK(ret == ESCH_OK, ctx->log, "Can't square inverse", ret);
+    xen = esch_bignum_normalize_i(xe, 2 * lower->inverse_length);
+    shift = 4 * lower->length - n;
+    xn = (xen > shift? xen - shift: 0);
+    memcpy(x, xe + shift, sizeof(esch_limb) * xn);
+    assert(xn > 0 && xn <= m + 1);
+
+    for (;;)
+    {
+        ret = esch_integer_mul_limbs_i(ctx->alloc, ctx->log, px,
+                                       power->limbs, m, x, xn);
+        ESCH_CHECK(ret == ESCH_OK, ctx->log, "Can't multiply", ret);
+        pxn = esch_bignum_normalize_i(px, m + xn);
+        if (pxn > n)
+        {
+            break; /* P * X is exactly B^2m. */
+        }
+        /* Error E = B^2m - P * X, negated in two's complement. */
+        for (i = 0; i < n; ++i)
+        {
+            e[i] = ~(i < pxn? px[i]: 0);
+        }
+        for (i = 0, carry = 1; i < n && carry != 0; ++i)
+        {
+            e[i] += 1;
+            carry = (e[i] == 0);
+        }
+        en = esch_bignum_normalize_i(e, n);
+        if (xn + en <= n)
+        {
+            break; /* No more correction. */
+        }
+        /*
+         * Correction has about xn + en - n limbs, so low limbs of X
+         * and E hardly matter: keep 2 more limbs than that. Dropping
+         * limbs only makes X smaller, so it stays below.
+         */
+        keep = xn + en - n + 2;
+        dx = (xn > keep? xn - keep: 0);
+        de = (en > keep? en - keep: 0);
+        ret = esch_integer_mul_limbs_i(ctx->alloc, ctx->log, xe,
+                                       x + dx, xn - dx, e + de, en - de);
+        ESCH_CHECK(ret == ESCH_OK, ctx->log, "Can't multiply", ret);
+        xen = esch_bignum_normalize_i(xe, xn - dx + en - de);
+        shift = n - dx - de;
+        if (xen <= shift)
+        {
+            break;
+        }
+        carry = esch_bignum_add_i(x, x, xn, xe + shift, xen - shift);
+        if (carry != 0)
+        {
+            x[xn] = carry;
+            ++xn;
+        }
+        if (xen - shift <= 1)
+        {
+            /* A few units short at most, Barrett division copes. */
+            break;
+        }
+    }
+Done:
+    power->inverse = x;
+    power->inverse_length = xn;
+    x = NULL;
+Exit:
+    (void)esch_alloc_free(ctx->alloc, x);
+    (void)esch_alloc_free(ctx->alloc, px);
+    (void)esch_alloc_free(ctx->alloc, e);
+    (void)esch_alloc_free(ctx->alloc, xe);
+    return ret;
+}
+
+/*
+ * Barrett division by power of given level: x = q * P + r, x < P^2.
+ * q needs m + 2 limbs, r needs xn limbs. Estimate of q is at most a
+ * few units short, fixed up by subtracting P.
+ */
+static esch_error
+esch_integer_base10_divide_i(struct esch_integer_base10* ctx, int level,
+                             const esch_limb* x, size_t xn,
+                             esch_limb* q, size_t* qn,
+                             esch_limb* r, size_t* rn)
+{
+    esch_error ret = ESCH_OK;
+    struct esch_integer_pow10* power = &(ctx->powers[level]);
+    esch_limb* product = NULL;
+    size_t m = power->length;
+    size_t tn = 0;
+    size_t pn = 0;
+    esch_limb one = 1;
+    esch_limb carry = 0;
+
+    (*qn) = 0;
+    memcpy(r, x, sizeof(esch_limb) * xn);
+    (*rn) = xn;
+    if (esch_bignum_compare_i(x, xn, power->limbs, m) < 0)
+    {
+        goto Exit;
+    }
+    tn = xn - (m - 1);
+    ret = esch_alloc_realloc(ctx->alloc, NULL,
+                             sizeof(esch_limb) *
+                               (tn + power->inverse_length + m + 2),
+                             (void**)&product);
+    ESCH_CHECK(ret == ESCH_OK, ctx->log, "Can't create product", ret);
+    /* q = ((x / B^(m - 1)) * inverse) / B^(m + 1) */
+    ret = esch_integer_mul_limbs_i(ctx->alloc, ctx->log, product,
+                                   x + m - 1, tn,
+                                   power->inverse, power->inverse_length);
+    ESCH_CHECK(ret == ESCH_OK, ctx->log, "Can't multiply", ret);
+    pn = esch_bignum_normalize_i(product, tn + power->inverse_length);
+    if (pn > m + 1)
+    {
+        (*qn) = pn - (m + 1);
+        memcpy(q, product + m + 1, sizeof(esch_limb) * (*qn));
+    }
+    /* r = x - q * P */
+    ret = esch_integer_mul_limbs_i(ctx->alloc, ctx->log, product,
+                                   q, (*qn), power->limbs, m);
+    ESCH_CHECK(ret == ESCH_OK, ctx->log, "Can't multiply", ret);
+    pn = esch_bignum_normalize_i(product, (*qn) + m);
+    (void)esch_bignum_sub_i(r, r, xn, product, pn);
+    (*rn) = esch_bignum_normalize_i(r, xn);
+    while (esch_bignum_compare_i(r, (*rn), power->limbs, m) >= 0)
+    {
+        (void)esch_bignum_sub_i(r, r, (*rn), power->limbs, m);
+        (*rn) = esch_bignum_normalize_i(r, (*rn));
+        if ((*qn) == 0)
+        {
+            q[0] = 1;
+            (*qn) = 1;
+            continue;
+        }
+        carry = esch_bignum_add_i(q, q, (*qn), &one, 1);
+        if (carry != 0)
+        {
+            q[(*qn)] = carry;
+            ++(*qn);
+        }
+    }
+Exit:
+    (void)esch_alloc_free(ctx->alloc, product);
+    return ret;
+}
+
+/* Load 8 characters, first one in lowest byte on any endian. */
+uint64_t
+esch_number_load_8_i(const char* str)
+{
+    const unsigned char* u = (const unsigned char*)str;
+    return ((uint64_t)u[0] | ((uint64_t)u[1] << 8) |
+            ((uint64_t)u[2] << 16) | ((uint64_t)u[3] << 24) |
+            ((uint64_t)u[4] << 32) | ((uint64_t)u[5] << 40) |
+            ((uint64_t)u[6] << 48) | ((uint64_t)u[7] << 56));
+}
+
+/*
+ * All 8 bytes are '0' to '9': high nibble is 3, and it stays 3 after
+ * adding 6. A byte that carries into next one fails by itself.
+ */
+esch_bool
+esch_number_is_8_digits_i(uint64_t chars)
+{
+    return (((chars & ESCH_NUMBER_U64(0xF0F0F0F0, 0xF0F0F0F0)) |
+             (((chars + ESCH_NUMBER_U64(0x06060606, 0x06060606)) &
+               ESCH_NUMBER_U64(0xF0F0F0F0, 0xF0F0F0F0)) >> 4)) ==
+            ESCH_NUMBER_U64(0x33333333, 0x33333333));
+}
+
+/*
+ * Value of 8 digits in three multiplications: each step merges
+ * neighbor digits, then pairs, then groups of 4 (SWAR).
+ */
+esch_limb
+esch_number_parse_8_i(uint64_t chars)
+{
+    chars = ((chars & ESCH_NUMBER_U64(0x0F0F0F0F, 0x0F0F0F0F))
+             * (10 * 0x100 + 1)) >> 8;
+    chars = ((chars & ESCH_NUMBER_U64(0x00FF00FF, 0x00FF00FF))
+             * (100 * 0x10000 + 1)) >> 16;
+    chars = ((chars & ESCH_NUMBER_U64(0x0000FFFF, 0x0000FFFF))
+             * ESCH_NUMBER_U64(10000, 1)) >> 32;
+    return (esch_limb)chars;
+}
+
+static const char*
+esch_integer_find_non_digit(const char* begin, const char* end)
+{
+    while (end - begin >= 8 &&
+           esch_number_is_8_digits_i(esch_number_load_8_i(begin)))
+    {
+        begin += 8;
+    }
+    while (begin != end && (*begin) >= '0' && (*begin) <= '9')
+    {
+        ++begin;
+    }
+    return begin;
+}
+
+/*
+ * Digits are multiplied in 9 at a time: one digit, then 8 digits in
+ * one SWAR step. Return number of limbs.
+ */
+static size_t
+esch_integer_parse_basecase_i(const char* begin, size_t digits,
+                              esch_limb* r)
+{
+    size_t used = 0;
+    size_t step = digits % ESCH_INTEGER_BASE10_DIGITS;
+    esch_limb chunk = 0;
+
+    for (digits -= step; step > 0; --step, ++begin)
+    {
+        chunk = chunk * 10 + ((*begin) - '0');
+    }
+    if (chunk != 0)
+    {
+        r[0] = chunk;
+        used = 1;
+    }
+    for (; digits > 0; digits -= ESCH_INTEGER_BASE10_DIGITS,
+                       begin += ESCH_INTEGER_BASE10_DIGITS)
+    {
+        chunk = (esch_limb)((*begin) - '0') * 100000000 +
+                esch_number_parse_8_i(esch_number_load_8_i(begin + 1));
+        chunk = esch_bignum_mul_1_i(r, r, used,
+                                    ESCH_INTEGER_BASE10_CHUNK, chunk);
+        if (chunk != 0)
+        {
+            r[used] = chunk;
+            ++used;
+        }
+    }
+    return used;
+}
+
+/*
+ * Parse valid digits into r, which has ESCH_INTEGER_BASE10_LIMBS()
+ * limbs. Long strings are split as high * 10^(9 * 2^k) + low, so the
+ * cost follows multiplication instead of growing quadratically.
+ */
+static esch_error
+esch_integer_parse_i(struct esch_integer_base10* ctx,
+                     const char* begin, size_t digits,
+                     esch_limb* r, size_t* rn)
+{
+    esch_error ret = ESCH_OK;
+    struct esch_integer_pow10* power = NULL;
+    esch_limb* high = NULL;
+    esch_limb* low = NULL;
+    size_t high_len = 0;
+    size_t low_len = 0;
+    size_t low_digits = 0;
+    esch_limb carry = 0;
+    int level = 0;
+
+    if (digits <= ESCH_INTEGER_PARSE_DC_DIGITS)
+    {
+        (*rn) = esch_integer_parse_basecase_i(begin, digits, r);
+        goto Exit;
+    }
+    /* Low part is the larger half. */
+    while (((size_t)ESCH_INTEGER_BASE10_DIGITS << (level + 1)) < digits)
+    {
+        ++level;
+    }
+    low_digits = (size_t)ESCH_INTEGER_BASE10_DIGITS << level;
+    ret = esch_integer_base10_grow_i(ctx, level);
+    ESCH_CHECK(ret == ESCH_OK, ctx->log, "Can't get power", ret);
+    power = &(ctx->powers[level]);
+
+    ret = esch_alloc_realloc(ctx->alloc, NULL,
+                             sizeof(esch_limb) *
+                               ESCH_INTEGER_BASE10_LIMBS(digits - low_digits),
+                             (void**)&high);
+    ESCH_CHECK(ret == ESCH_OK, ctx->log, "Can't create limbs", ret);
+    ret = esch_alloc_realloc(ctx->alloc, NULL,
+                             sizeof(esch_limb) *
+                               ESCH_INTEGER_BASE10_LIMBS(low_digits),
+                             (void**)&low);
+    ESCH_CHECK(ret == ESCH_OK, ctx->log, "Can't create limbs", ret);
+    ret = esch_integer_parse_i(ctx, begin, digits - low_digits,
+                               high, &high_len);
+    ESCH_CHECK(ret == ESCH_OK, ctx->log, "Can't parse high part", ret);
+    ret = esch_integer_parse_i(ctx, begin + digits - low_digits,
+                               low_digits, low, &low_len);
+    ESCH_CHECK(ret == ESCH_OK, ctx->log, "Can't parse low part", ret);
+
+    if (high_len == 0)
+    {
+        memcpy(r, low, sizeof(esch_limb) * low_len);
+        (*rn) = low_len;
+        goto Exit;
+    }
+    ret = esch_integer_mul_limbs_i(ctx->alloc, ctx->log, r,
+                                   high, high_len,
+                                   power->limbs, power->length);
+    ESCH_CHECK(ret == ESCH_OK, ctx->log, "Can't multiply", ret);
+    (*rn) = high_len + power->length;
+    if (low_len > 0)
+    {
+        carry = esch_bignum_add_i(r, r, (*rn), low, low_len);
+        assert(carry == 0);
+        (void)carry;
+    }
+    (*rn) = esch_bignum_normalize_i(r, (*rn));
+Exit:
+    (void)esch_alloc_free(ctx->alloc, high);
+    (void)esch_alloc_free(ctx->alloc, low);
+    return ret;
+}
+
+/*
+ * Write x as exactly width digits, padded with '0', and destroy x.
+ * Width is a multiple of 9, and 9 digits come from each division,
+ * two at a time from the table.
+ */
+static void
+esch_integer_print_basecase_i(esch_limb* x, size_t xn,
+                              char* out, size_t width)
+{
+    char* pos = out + width;
+    esch_dlimb wide = 0;
+    esch_limb chunk = 0;
+    size_t j = 0;
+    int i = 0;
+
+    while (xn > 0)
+    {
+        /* Constant divisor: compiler turns division into multiply. */
+        for (j = xn, wide = 0; j > 0; --j)
+        {
+            wide = (wide << ESCH_LIMB_BITS) | x[j - 1];
+            x[j - 1] = (esch_limb)(wide / ESCH_INTEGER_BASE10_CHUNK);
+            wide %= ESCH_INTEGER_BASE10_CHUNK;
+        }
+        chunk = (esch_limb)wide;
+        xn = esch_bignum_normalize_i(x, xn);
+        for (i = 0; i < 4; ++i)
+        {
+            pos -= 2;
+            memcpy(pos, esch_number_digit_pairs + 2 * (chunk % 100), 2);
+            chunk /= 100;
+        }
+        --pos;
+        (*pos) = (char)('0' + chunk);
+    }
+    assert(pos >= out);
+    memset(out, '0', (size_t)(pos - out));
+}
+
+/*
+ * Write x < P^2, P the power of given level, as width digits. Each
+ * level splits x with one Barrett division into halves of width / 2.
+ */
+static esch_error
+esch_integer_print_i(struct esch_integer_base10* ctx, int level,
+                     esch_limb* x, size_t xn, char* out, size_t width)
+{
+    esch_error ret = ESCH_OK;
+    esch_limb* q = NULL;
+    esch_limb* r = NULL;
+    size_t qn = 0;
+    size_t rn = 0;
+
+    if (level < 0 || xn < ESCH_INTEGER_PRINT_DC_LIMBS)
+    {
+        esch_integer_print_basecase_i(x, xn, out, width);
+        goto Exit;
+    }
+    ret = esch_integer_base10_inverse_i(ctx, level);
+    ESCH_CHECK(ret == ESCH_OK, ctx->log, "Can't get inverse", ret);
+    ret = esch_alloc_realloc(ctx->alloc, NULL,
+                             sizeof(esch_limb) *
+                               (ctx->powers[level].length + 2),
+                             (void**)&q);
+    ESCH_CHECK(ret == ESCH_OK, ctx->log, "Can't create quotient", ret);
+    ret = esch_alloc_realloc(ctx->alloc, NULL, sizeof(esch_limb) * xn,
+                             (void**)&r);
+    ESCH_CHECK(ret == ESCH_OK, ctx->log, "Can't create remainder", ret);
+    ret = esch_integer_base10_divide_i(ctx, level, x, xn,
+                                       q, &qn, r, &rn);
+    ESCH_CHECK(ret == ESCH_OK, ctx->log, "Can't divide", ret);
+    ret = esch_integer_print_i(ctx, level - 1, q, qn, out, width / 2);
+    ESCH_CHECK(ret == ESCH_OK, ctx->log, "Can't print high part", ret);
+    ret = esch_integer_print_i(ctx, level - 1, r, rn,
+                               out + width / 2, width / 2);
+    ESCH_CHECK(ret == ESCH_OK, ctx->log, "Can't print low part", ret);
+Exit:
+    (void)esch_alloc_free(ctx->alloc, q);
+    (void)esch_alloc_free(ctx->alloc, r);
+    return ret;
+}
+
+/*
+ * ---------------------------------------------------------------
+ * Public interfaces
+ * ---------------------------------------------------------------
  */
+esch_error
+esch_integer_new_from_int(esch_config* config, int value,
+                          esch_integer** val)
+{
+    esch_error ret = ESCH_OK;
+    ESCH_CHECK_PARAM_PUBLIC(config != NULL);
+    ESCH_CHECK_PARAM_PUBLIC(val != NULL);
+    ESCH_CHECK_PARAM_PUBLIC(ESCH_CONFIG_GET_ALLOC(config) != NULL);
+    ESCH_CHECK_PARAM_PUBLIC(ESCH_CONFIG_GET_LOG(config) != NULL);
+    ret = esch_integer_new_small_i(config, value, val);
+Exit:
+    return ret;
+}
+
 esch_error
 esch_integer_new_from_base10(esch_config* config,
-                             const char* begin,
-                             const char* end,
+                             const char* begin, const char* end,
                              esch_integer** val)
 {
     esch_error ret = ESCH_OK;
     esch_alloc* alloc = NULL;
     esch_log* log = NULL;
-    int negative = ESCH_FALSE;
-    int big = ESCH_FALSE;
-    unsigned int intval = 0;
-    unsigned int nextval = 0;
+    esch_limb* limbs = NULL;
+    struct esch_integer_base10 ctx;
+    esch_bool negative = ESCH_FALSE;
     const char* iter = NULL;
-    unsigned char* digit = NULL;
-    esch_integer* newval = NULL;
-
-    ESCH_CHECK_PARAM_INTERNAL(config != NULL);
-    ESCH_CHECK_PARAM_INTERNAL(ESCH_IS_VALID_CONFIG(config));
-    ESCH_CHECK_PARAM_INTERNAL(begin != NULL);
-    ESCH_CHECK_PARAM_INTERNAL(val != NULL);
+    size_t digits = 0;
+    size_t used = 0;
+    int64_t small = 0;
 
-    alloc = ESCH_INTERNAL_CONFIG_GET_ALLOC(config);
-    log = ESCH_INTERNAL_CONFIG_GET_LOG(config);
-    ESCH_CHECK_PARAM_INTERNAL(alloc != NULL);
-    ESCH_CHECK_PARAM_INTERNAL(log != NULL);
+    ESCH_CHECK_PARAM_PUBLIC(config != NULL);
+    ESCH_CHECK_PARAM_PUBLIC(begin != NULL);
+    ESCH_CHECK_PARAM_PUBLIC(val != NULL);
+    ESCH_CHECK_PARAM_PUBLIC(ESCH_CONFIG_GET_ALLOC(config) != NULL);
+    ESCH_CHECK_PARAM_PUBLIC(ESCH_CONFIG_GET_LOG(config) != NULL);
+    alloc = ESCH_CAST_FROM_OBJECT(ESCH_CONFIG_GET_ALLOC(config), esch_alloc);
+    log = ESCH_CAST_FROM_OBJECT(ESCH_CONFIG_GET_LOG(config), esch_log);
+    esch_integer_base10_init_i(&ctx, alloc, log);
 
-    if ((*begin) == '-' || (*begin) == '+')
+    if (end == NULL)
+    {
+        end = begin + strlen(begin);
+    }
+    if (begin != end && ((*begin) == '-' || (*begin) == '+'))
     {
-        negative = (((*begin) == '-')? ESCH_TRUE: ESCH_FALSE);
+        negative = ((*begin) == '-');
         ++begin;
     }
-    if (end == NULL)
+    ESCH_CHECK(begin != end, log, "integer:base10: No digit",
+               ESCH_ERROR_INVALID_PARAMETER);
+    iter = esch_integer_find_non_digit(begin, end);
+    ESCH_CHECK_1(iter == end, log,
+                 "integer:base10: Bad digit at %d", (int)(iter - begin),
+                 ESCH_ERROR_INVALID_PARAMETER);
+    digits = (size_t)(end - begin);
+
+    if (digits <= ESCH_INTEGER_BASE10_DIGITS)
     {
-        for (end = begin; (*end) != '\0'; ++end);
-    }
-
-    /*
-     * NOTE: We don't validate the format of str in release mode. The
-     * work will be done with Esch intepreter.
-     */
-    ESCH_INTEGER_VERIFY(begin, end);
-
-    ret = esch_alloc_malloc(alloc, sizeof(esch_integer), (void**)&newval);
-    ESCH_CHECK(ret == ESCH_OK, log, "Can't malloc int object", ret);
-    ESCH_GET_VERSION(newval) = ESCH_VERSION;
-    ESCH_GET_TYPE(newval) = ESCH_TYPE_INTEGER;
-    ESCH_GET_ALLOC(newval) = alloc;
-    ESCH_GET_LOG(newval) = log;
-    newval->negative = negative;
-    newval->big = ESCH_FALSE;
-    newval->value.ival = 0;
-    /* If the integer is not big enough, keep it a regular integer. */
-    iter = begin;
-    do
+        /* Fits in one chunk: no limb buffer needed. */
+        for (iter = begin; iter != end; ++iter)
+        {
+            small = small * 10 + ((*iter) - '0');
+        }
+        ret = esch_integer_new_from_wide_i(config,
+                                           (negative? -small: small), val);
+        goto Exit;
+    }
+    ret = esch_alloc_realloc(alloc, NULL, sizeof(esch_limb) *
+                               ESCH_INTEGER_BASE10_LIMBS(digits),
+                             (void**)&limbs);
+    ESCH_CHECK(ret == ESCH_OK, log, "Can't create limbs", ret);
+    ret = esch_integer_parse_i(&ctx, begin, digits, limbs, &used);
+    ESCH_CHECK(ret == ESCH_OK, log, "Can't parse digits", ret);
+    ret = esch_integer_new_from_limbs_i(config, negative,
+                                        limbs, used, val);
+    limbs = NULL;
+Exit:
+    esch_integer_base10_fini_i(&ctx);
+    (void)esch_alloc_free(alloc, limbs);
+    return ret;
+}
+
+/* Print sign and magnitude, same as esch_integer_to_base10(). */
+esch_error
+esch_integer_view_to_base10_i(esch_alloc* alloc, esch_log* log,
+                              const struct esch_integer_view* view,
+                              char* buffer, size_t size, size_t* length)
+{
+    esch_error ret = ESCH_OK;
+    struct esch_integer_base10 ctx;
+    esch_limb* limbs = NULL;
+    char* digits = NULL;
+    char* pos = NULL;
+    size_t width = 0;
+    size_t len = 0;
+    int level = -1;
+
+    esch_integer_base10_init_i(&ctx, alloc, log);
+    if (view->length < ESCH_INTEGER_PRINT_DC_LIMBS)
     {
-        nextval = (((intval << 3) + (intval << 1))) + 
-                      esch_integer_convert_char(*iter);
-        if (nextval < intval)
-        {
-            /* Overloaded, expand buffer. */
-            big = ESCH_TRUE;
-        }
-        else
-        {
-            /* Not overload */
-            intval = nextval;
-            ++iter;
-        }
-    } while (!big && iter != end);
-    /* a big integer */
-    if (big)
-    {
-        size_t buflen = 0;
-        size_t i = 0;
-        unsigned int lowbit = 0;
-        unsigned int highbit = 0;
-        esch_log_info(log, "Big integer detected: addr: 0x%x", begin);
-        buflen = (((end - begin) & 0x1) == 0?
-                      ((end - begin) >> 1):
-                      (((end - begin) >> 1) + 1));
-        ret = esch_alloc_malloc(alloc, buflen, (void**)&digit);
-        memset(digit, 0, buflen);
-        ESCH_CHECK(ret == ESCH_OK, log, "Can't malloc bigint", ret);
-        for (i = 0, iter = end; iter != begin; --iter, ++i)
-        {
-            if ((i & 1) == 0)
-            {
-                lowbit = esch_integer_convert_char((*(iter - 1)));
-                highbit = 0;
-            }
-            else
-            {
-                highbit = esch_integer_convert_char((*(iter - 1)));
-                digit[(i >> 1)] = lowbit + (highbit << 4);
-            }
-        }
-        if (highbit == 0)
-        {
-            digit[(i >> 1)] = lowbit;
-        }
-        newval->big = ESCH_TRUE;
-        newval->value.bval.length = buflen;
-        newval->value.bval.digit = digit;
-        digit = NULL;
+        /* A limb has at most 10 digits. */
+        width = (view->length * 10 / ESCH_INTEGER_BASE10_DIGITS + 1) *
+                ESCH_INTEGER_BASE10_DIGITS;
     }
     else
     {
-        newval->value.ival = intval;
+        /* Smallest level with x < P^2 for sure. */
+        do
+        {
+            ++level;
+            ret = esch_integer_base10_grow_i(&ctx, level);
+            ESCH_CHECK(ret == ESCH_OK, log, "Can't get power", ret);
+        } while (2 * ctx.powers[level].length < view->length + 2);
+        width = (size_t)ESCH_INTEGER_BASE10_DIGITS << (level + 1);
+    }
+    ret = esch_alloc_realloc(alloc, NULL,
+                             sizeof(esch_limb) * (view->length + 1),
+                             (void**)&limbs);
+    ESCH_CHECK(ret == ESCH_OK, log, "Can't create limbs", ret);
+    memcpy(limbs, view->limbs, sizeof(esch_limb) * view->length);
+    /* One more byte in front for sign. */
+    ret = esch_alloc_realloc(alloc, NULL, width + 1, (void**)&digits);
+    ESCH_CHECK(ret == ESCH_OK, log, "Can't create digit buffer", ret);
+    ret = esch_integer_print_i(&ctx, level, limbs, view->length,
+                               digits + 1, width);
+    ESCH_CHECK(ret == ESCH_OK, log, "Can't print digits", ret);
+
+    for (pos = digits + 1; pos < digits + width && (*pos) == '0'; ++pos)
+    {
+        /* Skip leading zeros, keep the last digit. */
+    }
+    if (view->negative)
+    {
+        --pos;
+        (*pos) = '-';
     }
-    (*val) = newval;
-    newval = NULL;
+    len = (size_t)(digits + 1 + width - pos);
+    (*length) = len;
+    ESCH_CHECK_2(len < size, log,
+                 "integer:base10: Need %d bytes, got %d",
+                 (int)(len + 1), (int)size, ESCH_ERROR_OUT_OF_BOUND);
+    memcpy(buffer, pos, len);
+    buffer[len] = '\0';
+Exit:
+    esch_integer_base10_fini_i(&ctx);
+    (void)esch_alloc_free(alloc, limbs);
+    (void)esch_alloc_free(alloc, digits);
+    return ret;
+}
+
+esch_error
+esch_integer_to_base10(esch_integer* val, char* buffer, size_t size,
+                       size_t* length)
+{
+    esch_error ret = ESCH_OK;
+    struct esch_integer_view view;
+
+    ESCH_CHECK_PARAM_PUBLIC(ESCH_IS_VALID_INTEGER(val));
+    ESCH_CHECK_PARAM_PUBLIC(buffer != NULL || size == 0);
+    ESCH_CHECK_PARAM_PUBLIC(length != NULL);
+    esch_integer_get_view_i(val, &view);
+    ret = esch_integer_view_to_base10_i(
+              ESCH_OBJECT_GET_ALLOC(ESCH_CAST_TO_OBJECT(val)),
+              ESCH_OBJECT_GET_LOG(ESCH_CAST_TO_OBJECT(val)),
+              &view, buffer, size, length);
 Exit:
-    if (newval != NULL)
+    return ret;
+}
+
+esch_error
+esch_integer_to_int(esch_integer* val, int* value)
+{
+    esch_error ret = ESCH_OK;
+    ESCH_CHECK_PARAM_PUBLIC(ESCH_IS_VALID_INTEGER(val));
+    ESCH_CHECK_PARAM_PUBLIC(value != NULL);
+    if (ESCH_INTEGER_IS_BIG(val))
     {
-        (void)esch_integer_delete(newval);
+        ret = ESCH_ERROR_OUT_OF_BOUND;
     }
-    if (digit != NULL)
+    else
     {
-        assert(alloc != NULL);
-        (void)esch_alloc_free(alloc, digit);
+        (*value) = val->ival;
     }
+Exit:
     return ret;
 }
+
 esch_error
-esch_integer_new_from_int(esch_config* config,
-                          int intval, esch_integer** val)
+esch_integer_compare(esch_integer* val1, esch_integer* val2, int* result)
 {
-    return ESCH_ERROR_NOT_IMPLEMENTED;
+    esch_error ret = ESCH_OK;
+    struct esch_integer_view a;
+    struct esch_integer_view b;
+    int cmp = 0;
+
+    ESCH_CHECK_PARAM_PUBLIC(ESCH_IS_VALID_INTEGER(val1));
+    ESCH_CHECK_PARAM_PUBLIC(ESCH_IS_VALID_INTEGER(val2));
+    ESCH_CHECK_PARAM_PUBLIC(result != NULL);
+    if (!ESCH_INTEGER_IS_BIG(val1) && !ESCH_INTEGER_IS_BIG(val2))
+    {
+        (*result) = (val1->ival < val2->ival? -1:
+                     (val1->ival > val2->ival? 1: 0));
+        goto Exit;
+    }
+    esch_integer_get_view_i(val1, &a);
+    esch_integer_get_view_i(val2, &b);
+    if (a.negative != b.negative)
+    {
+        (*result) = (a.negative? -1: 1);
+        goto Exit;
+    }
+    cmp = esch_bignum_compare_i(a.limbs, a.length, b.limbs, b.length);
+    (*result) = (a.negative? -cmp: cmp);
+Exit:
+    return ret;
+}
+
+esch_error
+esch_integer_add(esch_config* config, esch_integer* val1,
+                 esch_integer* val2, esch_integer** val)
+{
+    esch_error ret = ESCH_OK;
+    struct esch_integer_view a;
+    struct esch_integer_view b;
+    esch_bool negative = ESCH_FALSE;
+    esch_limb* limbs = NULL;
+    size_t length = 0;
+
+    ESCH_CHECK_PARAM_PUBLIC(config != NULL);
+    ESCH_CHECK_PARAM_PUBLIC(ESCH_IS_VALID_INTEGER(val1));
+    ESCH_CHECK_PARAM_PUBLIC(ESCH_IS_VALID_INTEGER(val2));
+    ESCH_CHECK_PARAM_PUBLIC(val != NULL);
+    if (!ESCH_INTEGER_IS_BIG(val1) && !ESCH_INTEGER_IS_BIG(val2))
+    {
+        ret = esch_integer_new_from_wide_i(config,
+                (int64_t)val1->ival + val2->ival, val);
+        goto Exit;
+    }
+    esch_integer_get_view_i(val1, &a);
+    esch_integer_get_view_i(val2, &b);
+    ret = esch_integer_add_i(config, &a, &b, &negative, &limbs, &length);
+    if (ret == ESCH_OK)
+    {
+        ret = esch_integer_new_from_limbs_i(config, negative,
+                                            limbs, length, val);
+    }
+Exit:
+    return ret;
 }
 
-/**
- * Delete integer object. Internal only.
- * @param val Given integer object.
- * @return Return code. ESCH_OK if success.
- */
 esch_error
-esch_integer_delete(esch_integer* val)
+esch_integer_sub(esch_config* config, esch_integer* val1,
+                 esch_integer* val2, esch_integer** val)
+{
+    esch_error ret = ESCH_OK;
+    struct esch_integer_view a;
+    struct esch_integer_view b;
+    esch_bool negative = ESCH_FALSE;
+    esch_limb* limbs = NULL;
+    size_t length = 0;
+
+    ESCH_CHECK_PARAM_PUBLIC(config != NULL);
+    ESCH_CHECK_PARAM_PUBLIC(ESCH_IS_VALID_INTEGER(val1));
+    ESCH_CHECK_PARAM_PUBLIC(ESCH_IS_VALID_INTEGER(val2));
+    ESCH_CHECK_PARAM_PUBLIC(val != NULL);
+    if (!ESCH_INTEGER_IS_BIG(val1) && !ESCH_INTEGER_IS_BIG(val2))
+    {
+        ret = esch_integer_new_from_wide_i(config,
+                (int64_t)val1->ival - val2->ival, val);
+        goto Exit;
+    }
+    esch_integer_get_view_i(val1, &a);
+    esch_integer_get_view_i(val2, &b);
+    b.negative = !b.negative;
+    ret = esch_integer_add_i(config, &a, &b, &negative, &limbs, &length);
+    if (ret == ESCH_OK)
+    {
+        ret = esch_integer_new_from_limbs_i(config, negative,
+                                            limbs, length, val);
+    }
+Exit:
+    return ret;
+}
+
+esch_error
+esch_integer_mul(esch_config* config, esch_integer* val1,
+                 esch_integer* val2, esch_integer** val)
+{
+    esch_error ret = ESCH_OK;
+    struct esch_integer_view a;
+    struct esch_integer_view b;
+    esch_bool negative = ESCH_FALSE;
+    esch_limb* limbs = NULL;
+    size_t length = 0;
+
+    ESCH_CHECK_PARAM_PUBLIC(config != NULL);
+    ESCH_CHECK_PARAM_PUBLIC(ESCH_IS_VALID_INTEGER(val1));
+    ESCH_CHECK_PARAM_PUBLIC(ESCH_IS_VALID_INTEGER(val2));
+    ESCH_CHECK_PARAM_PUBLIC(val != NULL);
+    if (!ESCH_INTEGER_IS_BIG(val1) && !ESCH_INTEGER_IS_BIG(val2))
+    {
+        ret = esch_integer_new_from_wide_i(config,
+                (int64_t)val1->ival * val2->ival, val);
+        goto Exit;
+    }
+    esch_integer_get_view_i(val1, &a);
+    esch_integer_get_view_i(val2, &b);
+    ret = esch_integer_mul_i(config, &a, &b, &negative, &limbs, &length);
+    if (ret == ESCH_OK)
+    {
+        ret = esch_integer_new_from_limbs_i(config, negative,
+                                            limbs, length, val);
+    }
+Exit:
+    return ret;
+}
+
+esch_error
+esch_integer_divide(esch_config* config, esch_integer* val1,
+                    esch_integer* val2, esch_integer** quotient,
+                    esch_integer** remainder)
 {
     esch_error ret = ESCH_OK;
     esch_alloc* alloc = NULL;
     esch_log* log = NULL;
-    if (val == NULL)
+    struct esch_integer_view a;
+    struct esch_integer_view b;
+    esch_limb* q = NULL;
+    esch_limb* r = NULL;
+    esch_limb* scratch = NULL;
+    esch_integer* new_q = NULL;
+    size_t q_len = 0;
+
+    ESCH_CHECK_PARAM_PUBLIC(config != NULL);
+    ESCH_CHECK_PARAM_PUBLIC(ESCH_IS_VALID_INTEGER(val1));
+    ESCH_CHECK_PARAM_PUBLIC(ESCH_IS_VALID_INTEGER(val2));
+    ESCH_CHECK_PARAM_PUBLIC(quotient != NULL || remainder != NULL);
+    alloc = ESCH_CAST_FROM_OBJECT(ESCH_CONFIG_GET_ALLOC(config), esch_alloc);
+    log = ESCH_CAST_FROM_OBJECT(ESCH_CONFIG_GET_LOG(config), esch_log);
+    esch_integer_get_view_i(val1, &a);
+    esch_integer_get_view_i(val2, &b);
+    ESCH_CHECK(b.length > 0, log, "integer:divide: Divided by zero",
+               ESCH_ERROR_INVALID_PARAMETER);
+
+    if (esch_bignum_compare_i(a.limbs, a.length, b.limbs, b.length) < 0)
+    {
+        /* Quotient is 0, remainder is dividend. */
+        if (quotient != NULL)
+        {
+            ret = esch_integer_new_small_i(config, 0, &new_q);
+            ESCH_CHECK(ret == ESCH_OK, log, "Can't create quotient", ret);
+        }
+        if (remainder != NULL)
+        {
+            ret = esch_integer_new_from_view_i(config, &a, remainder);
+            ESCH_CHECK(ret == ESCH_OK, log, "Can't create remainder", ret);
+        }
+        goto Done;
+    }
+    q_len = a.length - b.length + 1;
+    ret = esch_alloc_realloc(alloc, NULL, sizeof(esch_limb) * q_len,
+                             (void**)&q);
+    ESCH_CHECK(ret == ESCH_OK, log, "Can't create quotient limbs", ret);
+    ret = esch_alloc_realloc(alloc, NULL, sizeof(esch_limb) * b.length,
+                             (void**)&r);
+    ESCH_CHECK(ret == ESCH_OK, log, "Can't create remainder limbs", ret);
+    if (b.length == 1)
+    {
+        r[0] = esch_bignum_divmod_1_i(q, a.limbs, a.length, b.limbs[0]);
+    }
+    else
+    {
+        ret = esch_alloc_realloc(alloc, NULL, sizeof(esch_limb) *
+                                 ESCH_BIGNUM_DIVMOD_SCRATCH(a.length,
+                                                            b.length),
+                                 (void**)&scratch);
+        ESCH_CHECK(ret == ESCH_OK, log, "Can't create scratch", ret);
+        esch_bignum_divmod_i(q, r, a.limbs, a.length,
+                             b.limbs, b.length, scratch);
+    }
+    /* Truncated division: remainder has sign of dividend. */
+    if (quotient != NULL)
+    {
+        ret = esch_integer_new_from_limbs_i(config,
+                                            a.negative != b.negative,
+                                            q, q_len, &new_q);
+        q = NULL;
+        ESCH_CHECK(ret == ESCH_OK, log, "Can't create quotient", ret);
+    }
+    if (remainder != NULL)
+    {
+        ret = esch_integer_new_from_limbs_i(config, a.negative,
+                                            r, b.length, remainder);
+        r = NULL;
+        ESCH_CHECK(ret == ESCH_OK, log, "Can't create remainder", ret);
+    }
+Done:
+    if (quotient != NULL)
+    {
+        (*quotient) = new_q;
+        new_q = NULL;
+    }
+Exit:
+    if (new_q != NULL && ESCH_OBJECT_GET_GC(ESCH_CAST_TO_OBJECT(new_q)) ==
+                         NULL)
+    {
+        (void)esch_object_delete(ESCH_CAST_TO_OBJECT(new_q));
+    }
+    (void)esch_alloc_free(alloc, q);
+    (void)esch_alloc_free(alloc, r);
+    (void)esch_alloc_free(alloc, scratch);
+    return ret;
+}
+
+/*
+ * ---------------------------------------------------------------
+ * Arithmetic on values: fixnums first, integer objects on overflow.
+ * ---------------------------------------------------------------
+ */
+typedef esch_error (*esch_integer_op_f)(esch_config*,
+                                        struct esch_integer_view*,
+                                        struct esch_integer_view*,
+                                        esch_bool*, esch_limb**, size_t*);
+
+#ifndef ESCH_HAS_OVERFLOW_BUILTINS
+int
+esch_fixnum_narrow_i(int64_t wide, int* r)
+{
+    if (wide < INT_MIN || wide > INT_MAX)
+    {
+        return 1;
+    }
+    (*r) = (int)wide;
+    return 0;
+}
+#endif
+
+static esch_error
+esch_value_get_integer_view(esch_value* value,
+                            struct esch_integer_view* view)
+{
+    if (value->type == ESCH_VALUE_TYPE_INTEGER)
+    {
+        esch_integer_get_small_view_i(value->val.i, view);
+        return ESCH_OK;
+    }
+    if (value->type == ESCH_VALUE_TYPE_OBJECT && value->val.o != NULL &&
+        ESCH_OBJECT_GET_TYPE(value->val.o) == &(esch_integer_type.type))
+    {
+        esch_integer_get_view_i(ESCH_CAST_FROM_OBJECT(value->val.o,
+                                                      esch_integer), view);
+        return ESCH_OK;
+    }
+    return ESCH_ERROR_BAD_VALUE_TYPE;
+}
+
+/* Slow path: at least one operand is big, or fixnums overflow. */
+static esch_error
+esch_value_arith_i(esch_config* config, esch_integer_op_f op,
+                   esch_bool negate, esch_value* val1, esch_value* val2,
+                   esch_value* result)
+{
+    esch_error ret = ESCH_OK;
+    struct esch_integer_view a;
+    struct esch_integer_view b;
+    esch_bool negative = ESCH_FALSE;
+    esch_limb* limbs = NULL;
+    size_t length = 0;
+
+    ret = esch_value_get_integer_view(val1, &a);
+    if (ret == ESCH_OK)
+    {
+        ret = esch_value_get_integer_view(val2, &b);
+    }
+    if (ret != ESCH_OK)
     {
         return ret;
     }
-    ESCH_CHECK_PARAM_INTERNAL(val != NULL);
-    ESCH_CHECK_PARAM_INTERNAL(ESCH_IS_VALID_INTEGER(val));
-    alloc = ESCH_GET_ALLOC(val);
-    log = ESCH_GET_LOG(val);
-    ESCH_CHECK_PARAM_INTERNAL(alloc != NULL);
-    ESCH_CHECK_PARAM_INTERNAL(log != NULL);
+    if (negate)
+    {
+        b.negative = !b.negative;
+    }
+    ret = op(config, &a, &b, &negative, &limbs, &length);
+    if (ret == ESCH_OK)
+    {
+        ret = esch_integer_to_value_i(config, negative, limbs, length,
+                                      result);
+    }
+    return ret;
+}
+
+esch_error
+esch_value_add(esch_config* config, esch_value* val1, esch_value* val2,
+               esch_value* result)
+{
+    esch_error ret = ESCH_OK;
+    int fixnum = 0;
 
-    if (val->big)
+    ESCH_CHECK_PARAM_PUBLIC(val1 != NULL);
+    ESCH_CHECK_PARAM_PUBLIC(val2 != NULL);
+    ESCH_CHECK_PARAM_PUBLIC(result != NULL);
+    if (val1->type == ESCH_VALUE_TYPE_INTEGER &&
+        val2->type == ESCH_VALUE_TYPE_INTEGER &&
+        !ESCH_FIXNUM_ADD_OVERFLOW(val1->val.i, val2->val.i, &fixnum))
     {
-        (void)esch_alloc_free(alloc, val->value.bval.digit);
+        result->type = ESCH_VALUE_TYPE_INTEGER;
+        result->val.i = fixnum;
+        goto Exit;
     }
-    esch_alloc_free(alloc, val);
+    ESCH_CHECK_PARAM_PUBLIC(config != NULL);
+    ret = esch_value_arith_i(config, esch_integer_add_i, ESCH_FALSE,
+                             val1, val2, result);
 Exit:
     return ret;
 }
 
 esch_error
-esch_integer_add(esch_integer* val1, esch_integer* val2, esch_integer** val)
+esch_value_sub(esch_config* config, esch_value* val1, esch_value* val2,
+               esch_value* result)
 {
-    return ESCH_ERROR_NOT_IMPLEMENTED;
+    esch_error ret = ESCH_OK;
+    int fixnum = 0;
+
+    ESCH_CHECK_PARAM_PUBLIC(val1 != NULL);
+    ESCH_CHECK_PARAM_PUBLIC(val2 != NULL);
+    ESCH_CHECK_PARAM_PUBLIC(result != NULL);
+    if (val1->type == ESCH_VALUE_TYPE_INTEGER &&
+        val2->type == ESCH_VALUE_TYPE_INTEGER &&
+        !ESCH_FIXNUM_SUB_OVERFLOW(val1->val.i, val2->val.i, &fixnum))
+    {
+        result->type = ESCH_VALUE_TYPE_INTEGER;
+        result->val.i = fixnum;
+        goto Exit;
+    }
+    ESCH_CHECK_PARAM_PUBLIC(config != NULL);
+    ret = esch_value_arith_i(config, esch_integer_add_i, ESCH_TRUE,
+                             val1, val2, result);
+Exit:
+    return ret;
 }
+
 esch_error
-esch_integer_sub(esch_integer* val1, esch_integer* val2, esch_integer** val)
+esch_value_mul(esch_config* config, esch_value* val1, esch_value* val2,
+               esch_value* result)
 {
-    return ESCH_ERROR_NOT_IMPLEMENTED;
+    esch_error ret = ESCH_OK;
+    int fixnum = 0;
+
+    ESCH_CHECK_PARAM_PUBLIC(val1 != NULL);
+    ESCH_CHECK_PARAM_PUBLIC(val2 != NULL);
+    ESCH_CHECK_PARAM_PUBLIC(result != NULL);
+    if (val1->type == ESCH_VALUE_TYPE_INTEGER &&
+        val2->type == ESCH_VALUE_TYPE_INTEGER &&
+        !ESCH_FIXNUM_MUL_OVERFLOW(val1->val.i, val2->val.i, &fixnum))
+    {
+        result->type = ESCH_VALUE_TYPE_INTEGER;
+        result->val.i = fixnum;
+        goto Exit;
+    }
+    ESCH_CHECK_PARAM_PUBLIC(config != NULL);
+    ret = esch_value_arith_i(config, esch_integer_mul_i, ESCH_FALSE,
+                             val1, val2, result);
+Exit:
+    return ret;
 }
+
+/*
+ * ---------------------------------------------------------------
+ * Number literals on values.
+ * ---------------------------------------------------------------
+ */
+/* int64_t holds any 18 digits. */
+#define ESCH_INTEGER_WIDE_DIGITS 18
+
 esch_error
-esch_integer_mul(esch_integer* val1, esch_integer* val2, esch_integer** val)
+esch_value_from_base10(esch_config* config, const char* begin,
+                       const char* end, esch_value* value)
 {
-    return ESCH_ERROR_NOT_IMPLEMENTED;
+    esch_error ret = ESCH_OK;
+    esch_integer* val = NULL;
+    const char* digits = NULL;
+    const char* iter = NULL;
+    int64_t wide = 0;
+    double real = 0.0;
+
+    ESCH_CHECK_PARAM_PUBLIC(begin != NULL);
+    ESCH_CHECK_PARAM_PUBLIC(value != NULL);
+    if (end == NULL)
+    {
+        end = begin + strlen(begin);
+    }
+    digits = begin;
+    if (digits != end && ((*digits) == '-' || (*digits) == '+'))
+    {
+        ++digits;
+    }
+    if (digits == end || esch_integer_find_non_digit(digits, end) != end)
+    {
+        /* Not an integer literal: '.', exponent, inf or nan. */
+        ret = esch_float_from_base10(begin, end, &real);
+        if (ret == ESCH_OK)
+        {
+            value->type = ESCH_VALUE_TYPE_FLOAT;
+            value->val.f = real;
+        }
+        goto Exit;
+    }
+    while (end - digits > 1 && (*digits) == '0')
+    {
+        ++digits;
+    }
+    if (end - digits > ESCH_INTEGER_WIDE_DIGITS)
+    {
+        ESCH_CHECK_PARAM_PUBLIC(config != NULL);
+        ret = esch_integer_new_from_base10(config, begin, end, &val);
+    }
+    else
+    {
+        for (iter = digits; iter != end; ++iter)
+        {
+            wide = wide * 10 + ((*iter) - '0');
+        }
+        wide = ((*begin) == '-'? -wide: wide);
+        if (wide >= INT_MIN && wide <= INT_MAX)
+        {
+            value->type = ESCH_VALUE_TYPE_INTEGER;
+            value->val.i = (int)wide;
+            goto Exit;
+        }
+        ESCH_CHECK_PARAM_PUBLIC(config != NULL);
+        ret = esch_integer_new_from_wide_i(config, wide, &val);
+    }
+    if (ret == ESCH_OK)
+    {
+        value->type = ESCH_VALUE_TYPE_OBJECT;
+        value->val.o = ESCH_CAST_TO_OBJECT(val);
+    }
+Exit:
+    return ret;
 }
+
 esch_error
-esch_integer_div(esch_integer* val1, esch_integer* val2, esch_fraction* val)
+esch_value_to_base10(esch_value* value, char* buffer, size_t size,
+                     size_t* length)
 {
-    return ESCH_ERROR_NOT_IMPLEMENTED;
-}
+    esch_error ret = ESCH_OK;
+    /* Sign, and at most 10 digits. */
+    char text[12];
+    char* pos = text + sizeof(text);
+    unsigned int mag = 0;
+    size_t len = 0;
+
+    ESCH_CHECK_PARAM_PUBLIC(value != NULL);
+    ESCH_CHECK_PARAM_PUBLIC(buffer != NULL || size == 0);
+    ESCH_CHECK_PARAM_PUBLIC(length != NULL);
+    if (value->type == ESCH_VALUE_TYPE_FLOAT)
+    {
+        ret = esch_float_to_base10(value->val.f, buffer, size, length);
+        goto Exit;
+    }
+    if (value->type == ESCH_VALUE_TYPE_OBJECT && value->val.o != NULL &&
+        ESCH_OBJECT_GET_TYPE(value->val.o) == &(esch_integer_type.type))
+    {
+        ret = esch_integer_to_base10(ESCH_CAST_FROM_OBJECT(value->val.o,
+                                                           esch_integer),
+                                     buffer, size, length);
+        goto Exit;
+    }
+    ESCH_CHECK_NO_LOG(value->type == ESCH_VALUE_TYPE_INTEGER,
+                      ESCH_ERROR_BAD_VALUE_TYPE);
 
+    mag = (value->val.i < 0? 0u - (unsigned int)value->val.i:
+                             (unsigned int)value->val.i);
+    do
+    {
+        --pos;
+        (*pos) = (char)('0' + mag % 10);
+        mag /= 10;
+    } while (mag != 0);
+    if (value->val.i < 0)
+    {
+        --pos;
+        (*pos) = '-';
+    }
+    len = (size_t)(text + sizeof(text) - pos);
+    (*length) = len;
+    ESCH_CHECK_NO_LOG(len < size, ESCH_ERROR_OUT_OF_BOUND);
+    memcpy(buffer, pos, len);
+    buffer[len] = '\0';
+Exit:
+    return ret;
+}
@@ -9,63 +9,250 @@
 extern "C" {
 #endif /* __cplusplus */
 
-typedef struct esch_integer esch_integer;
-typedef struct esch_fraction esch_fraction;
+/*
+ * Magnitude of big integers is an array of 32-bit limbs, least
+ * significant first. Products of two limbs fit in a double limb, so
+ * the code stays portable without 128-bit integer types.
+ */
+typedef uint32_t esch_limb;
+typedef uint64_t esch_dlimb;
+#define ESCH_LIMB_BITS 32
+#define ESCH_LIMB_MAX ((esch_limb)0xFFFFFFFF)
 
+/*
+ * An integer is small when limbs is NULL: value is kept in ival. Any
+ * result that fits in int is always stored as small integer, so two
+ * equal integers always have same representation.
+ */
 struct esch_integer
 {
-    ESCH_COMMON_HEADER;
-    union
-    {
-        unsigned int ival;
-        struct
-        {
-            size_t length;
-            unsigned char* digit;
-        } bval;
-    } value;
-    unsigned char big: 1;
-    unsigned char negative: 1;
+    int ival;           /* Value of small integer */
+    esch_bool negative; /* Sign of big integer */
+    size_t length;      /* Limbs in use. No leading zero. */
+    esch_limb* limbs;   /* Magnitude of big integer, or NULL. */
 };
 
+extern struct esch_builtin_type esch_integer_type;
+
+#define ESCH_INTEGER_IS_BIG(val) ((val)->limbs != NULL)
+
+#define ESCH_IS_VALID_INTEGER(val) \
+    ((val) != NULL && \
+     ESCH_IS_VALID_OBJECT(ESCH_CAST_TO_OBJECT(val)) && \
+     ESCH_OBJECT_GET_TYPE(ESCH_CAST_TO_OBJECT(val)) == \
+       &(esch_integer_type.type) && \
+     ((val)->limbs == NULL || \
+      ((val)->length > 0 && (val)->limbs[(val)->length - 1] != 0)))
+
+/*
+ * A fraction is always normalized: denominator is positive and has no
+ * common factor with numerator, so equal fractions have same form. It
+ * is small when limbs is NULL: both parts fit in int, and are kept in
+ * num and den.
+ */
 struct esch_fraction
 {
-    ESCH_COMMON_HEADER;
-    ESCH_BOOL precise: 1;
-    esch_integer* numerator;
-    esch_integer* denorminator;
+    int num;              /* Numerator of small fraction. */
+    int den;              /* Denominator of small fraction. */
+    esch_bool negative;   /* Sign of big fraction. */
+    size_t num_length;    /* Limbs of numerator. No leading zero. */
+    size_t den_length;    /* Limbs of denominator. No leading zero. */
+    esch_limb* limbs;     /* Numerator, then denominator, or NULL. */
 };
 
-struct esch_complex
+extern struct esch_builtin_type esch_fraction_type;
+
+#define ESCH_FRACTION_IS_BIG(val) ((val)->limbs != NULL)
+
+#define ESCH_IS_VALID_FRACTION(val) \
+    ((val) != NULL && \
+     ESCH_IS_VALID_OBJECT(ESCH_CAST_TO_OBJECT(val)) && \
+     ESCH_OBJECT_GET_TYPE(ESCH_CAST_TO_OBJECT(val)) == \
+       &(esch_fraction_type.type) && \
+     ((val)->limbs != NULL || (val)->den > 0))
+
+/*
+ * Fixnum arithmetic with overflow check: evaluate to non-zero when
+ * result does not fit in int, and (*r) is then not valid. Compiler
+ * builtins check the overflow flag directly.
+ */
+#if defined(__has_builtin)
+#    if __has_builtin(__builtin_add_overflow)
+#        define ESCH_HAS_OVERFLOW_BUILTINS
+#    endif
+#elif defined(__GNUC__) && __GNUC__ >= 5
+#    define ESCH_HAS_OVERFLOW_BUILTINS
+#endif
+
+#ifdef ESCH_HAS_OVERFLOW_BUILTINS
+#    define ESCH_FIXNUM_ADD_OVERFLOW(a, b, r) \
+        __builtin_add_overflow(a, b, r)
+#    define ESCH_FIXNUM_SUB_OVERFLOW(a, b, r) \
+        __builtin_sub_overflow(a, b, r)
+#    define ESCH_FIXNUM_MUL_OVERFLOW(a, b, r) \
+        __builtin_mul_overflow(a, b, r)
+#else
+int esch_fixnum_narrow_i(int64_t wide, int* r);
+#    define ESCH_FIXNUM_ADD_OVERFLOW(a, b, r) \
+        esch_fixnum_narrow_i((int64_t)(a) + (b), r)
+#    define ESCH_FIXNUM_SUB_OVERFLOW(a, b, r) \
+        esch_fixnum_narrow_i((int64_t)(a) - (b), r)
+#    define ESCH_FIXNUM_MUL_OVERFLOW(a, b, r) \
+        esch_fixnum_narrow_i((int64_t)(a) * (b), r)
+#endif
+
+/*
+ * Karatsuba multiplication is used when both operands have at least
+ * this number of limbs. Below it, schoolbook multiplication wins
+ * because of smaller constant. Tuned with bench_integerMul.
+ */
+#ifndef ESCH_BIGNUM_KARATSUBA_THRESHOLD
+#    define ESCH_BIGNUM_KARATSUBA_THRESHOLD 40
+#endif
+
+/*
+ * Base-10 conversion switches to divide and conquer above these
+ * sizes, so it costs a few multiplications instead of quadratic time.
+ * Tuned with bench_integerBase10.
+ */
+#ifndef ESCH_INTEGER_PARSE_DC_DIGITS
+#    define ESCH_INTEGER_PARSE_DC_DIGITS 2000
+#endif
+#ifndef ESCH_INTEGER_PRINT_DC_LIMBS
+#    define ESCH_INTEGER_PRINT_DC_LIMBS 50
+#endif
+
+#define ESCH_NUMBER_U64(hi, lo) \
+    (((uint64_t)(hi) << 32) | (uint64_t)(lo))
+
+/* ----------------------------------------------------------------- */
+/*   Integer internals shared with esch_fraction.c. Internal use.    */
+/* ----------------------------------------------------------------- */
+/* Sign and magnitude of an integer, small or big. */
+struct esch_integer_view
 {
-    ESCH_COMMON_HEADER;
-    esch_fraction* real;
-    esch_fraction* imaginary;
+    esch_bool negative;
+    size_t length;
+    const esch_limb* limbs;
+    esch_limb small; /* Storage of small integer's magnitude. */
 };
+void esch_integer_get_small_view_i(int value,
+                                   struct esch_integer_view* view);
+void esch_integer_get_view_i(esch_integer* val,
+                             struct esch_integer_view* view);
+/* Check if a magnitude fits in int. Limbs must be normalized. */
+esch_bool esch_integer_fits_int_i(esch_bool negative,
+                                  const esch_limb* limbs, size_t length,
+                                  int* value);
+/*
+ * Create integer from a limb buffer, which is always taken over, even
+ * when an error is returned.
+ */
+esch_error esch_integer_new_from_limbs_i(esch_config* config,
+                                         esch_bool negative,
+                                         esch_limb* limbs, size_t length,
+                                         esch_integer** val);
+/*
+ * Signed a + b and a * b into a new limb buffer, which can have leading
+ * zeros. Zero can come back as NULL buffer.
+ */
+esch_error esch_integer_add_i(esch_config* config,
+                              struct esch_integer_view* a,
+                              struct esch_integer_view* b,
+                              esch_bool* negative, esch_limb** limbs,
+                              size_t* length);
+esch_error esch_integer_mul_i(esch_config* config,
+                              struct esch_integer_view* a,
+                              struct esch_integer_view* b,
+                              esch_bool* negative, esch_limb** limbs,
+                              size_t* length);
+/* r = a * b. r has an + bn limbs. Operands can come in any order. */
+esch_error esch_integer_mul_limbs_i(esch_alloc* alloc, esch_log* log,
+                                    esch_limb* r,
+                                    const esch_limb* a, size_t an,
+                                    const esch_limb* b, size_t bn);
+esch_error esch_integer_view_to_base10_i(esch_alloc* alloc, esch_log* log,
+                                         const struct esch_integer_view* view,
+                                         char* buffer, size_t size,
+                                         size_t* length);
 
-/* TODO: Not complete. */
-#define ESCH_IS_VALID_INTEGER(obj) \
-    (ESCH_IS_VALID_OBJECT(obj) && \
-     ((!((esch_integer*)obj)->big) || \
-      ((esch_integer*)obj)->value.bval.digit != NULL))
-
-#define ESCH_IS_VALID_COMPLEX(obj) \
-    (ESCH_IS_VALID_OBJECT(obj))
+/* ----------------------------------------------------------------- */
+/*   Base-10 helpers shared by integers and floats. Internal use.    */
+/* ----------------------------------------------------------------- */
+/* "00" to "99", two characters each. */
+extern const char esch_number_digit_pairs[];
+/* Load 8 characters, first one in lowest byte on any endian. */
+uint64_t esch_number_load_8_i(const char* str);
+/* Check if 8 loaded characters are all '0' to '9'. */
+esch_bool esch_number_is_8_digits_i(uint64_t chars);
+/* Value of 8 loaded digits. */
+esch_limb esch_number_parse_8_i(uint64_t chars);
 
 /*
- * The only public interface should be esch_complex.
- * Integer and fraction should be kept private.
+ * 128-bit powers of 5 and 10 for float conversion, see
+ * tools/float/gentable.py and esch_float.c. Each entry is two uint64_t,
+ * high bits first.
  */
+#define ESCH_FLOAT_U128(a, b, c, d) \
+    ESCH_NUMBER_U64(a, b), ESCH_NUMBER_U64(c, d)
+#define ESCH_FLOAT_POW5_MIN (-342)
+#define ESCH_FLOAT_POW5_MAX 308
+#define ESCH_FLOAT_POW10_MIN (-292)
+#define ESCH_FLOAT_POW10_MAX 326
+extern const uint64_t esch_float_pow5_128[];
+extern const uint64_t esch_float_pow10_128[];
 
-esch_error esch_integer_delete(esch_integer* val);
-esch_error esch_integer_new_from_base10(esch_config* config,
-                                        const char* begin,
-                                        const char* end,
-                                        esch_integer** val);
+/* ----------------------------------------------------------------- */
+/*      Limb operations, see esch_bignum.c. Internal use only.       */
+/* ----------------------------------------------------------------- */
+/*
+ * All functions work on magnitudes without leading zero unless
+ * mentioned. Result buffers must not overlap inputs, unless noted.
+ */
+size_t esch_bignum_normalize_i(const esch_limb* a, size_t an);
+int esch_bignum_compare_i(const esch_limb* a, size_t an,
+                          const esch_limb* b, size_t bn);
+/* r = a + b, an >= bn. r has an limbs, may be a. Return carry. */
+esch_limb esch_bignum_add_i(esch_limb* r, const esch_limb* a, size_t an,
+                            const esch_limb* b, size_t bn);
+/* r = a - b, a >= b. r has an limbs, may be a. Return borrow. */
+esch_limb esch_bignum_sub_i(esch_limb* r, const esch_limb* a, size_t an,
+                            const esch_limb* b, size_t bn);
+/* r = a * m + carry. r has n limbs, may be a. Return carry out. */
+esch_limb esch_bignum_mul_1_i(esch_limb* r, const esch_limb* a,
+                              size_t n, esch_limb m, esch_limb carry);
+/* q = a / d. q has n limbs, may be a. Return remainder. */
+esch_limb esch_bignum_divmod_1_i(esch_limb* q, const esch_limb* a,
+                                 size_t n, esch_limb d);
+/* Number of scratch limbs esch_bignum_mul_i() needs, an >= bn. */
+size_t esch_bignum_mul_scratch_i(size_t an, size_t bn);
+/* r = a * b, an >= bn > 0. r has an + bn limbs. */
+void esch_bignum_mul_i(esch_limb* r, const esch_limb* a, size_t an,
+                       const esch_limb* b, size_t bn, esch_limb* scratch);
+/* Number of scratch limbs esch_bignum_divmod_i() needs. */
+#define ESCH_BIGNUM_DIVMOD_SCRATCH(an, bn) ((an) + 1 + (bn))
+/*
+ * q = a / b, r = a % b, an >= bn >= 2. q has an - bn + 1 limbs, r
+ * has bn limbs. Either one can be NULL.
+ */
+void esch_bignum_divmod_i(esch_limb* q, esch_limb* r,
+                          const esch_limb* a, size_t an,
+                          const esch_limb* b, size_t bn,
+                          esch_limb* scratch);
+/* Greatest common divisor of a and b, binary gcd. */
+uint64_t esch_bignum_gcd_64_i(uint64_t a, uint64_t b);
+/* Number of scratch limbs esch_bignum_gcd_i() needs, an >= bn. */
+#define ESCH_BIGNUM_GCD_SCRATCH(an) (6 * (an) + 5)
+/*
+ * r = gcd(a, b), an >= bn > 0, Lehmer's algorithm. r has bn limbs.
+ * Return length of r.
+ */
+size_t esch_bignum_gcd_i(esch_limb* r, const esch_limb* a, size_t an,
+                         const esch_limb* b, size_t bn,
+                         esch_limb* scratch);
 
 #ifdef __cplusplus
 }
 #endif /* __cplusplus */
 
 #endif /* _ESCH_NUMBER_H_ */
-
@@ -5,6 +5,7 @@
 #include "esch_object.h"
 #include "esch_gc.h"
 #include "esch_debug.h"
+#include "esch_trace.h"
 
 /*
  * -----------------------------------------------------------------
@@ -163,27 +164,37 @@ Exit:
  */
 esch_error
 esch_object_new_i(esch_config* config, esch_type* type, esch_object** obj)
+{
+    esch_object* alloc_obj = NULL;
+
+    alloc_obj = ESCH_CONFIG_GET_ALLOC(config);
+    ESCH_CHECK_PARAM_INTERNAL(alloc_obj != NULL);
+    return esch_object_new_with_alloc_i(config,
+                                        ESCH_CAST_FROM_OBJECT(alloc_obj,
+                                                              esch_alloc),
+                                        type, obj);
+}
+
+esch_error
+esch_object_new_with_alloc_i(esch_config* config, esch_alloc* alloc,
+                             esch_type* type, esch_object** obj)
 {
     esch_error ret = ESCH_OK;
     size_t obj_size = 0;
-    esch_object* alloc_obj = NULL;
     esch_object* log_obj = NULL;
     esch_object* gc_obj = NULL;
-    esch_alloc* alloc = NULL;
     esch_log* log = NULL;
     esch_gc*  gc = NULL;
     esch_object* new_object = NULL;
     void* new_gc_id = NULL;
 
+    ESCH_CHECK_PARAM_INTERNAL(alloc != NULL);
     ESCH_CHECK_PARAM_INTERNAL(type != NULL);
 
-    alloc_obj = ESCH_CONFIG_GET_ALLOC(config);
     log_obj = ESCH_CONFIG_GET_LOG(config);
     gc_obj = ESCH_CONFIG_GET_GC(config);
-    ESCH_CHECK_PARAM_INTERNAL(alloc_obj != NULL);
     ESCH_CHECK_PARAM_INTERNAL(log_obj != NULL);
 
-    alloc = ESCH_CAST_FROM_OBJECT(alloc_obj, esch_alloc);
     log = ESCH_CAST_FROM_OBJECT(log_obj, esch_log);
     gc = (gc_obj == NULL? NULL: ESCH_CAST_FROM_OBJECT(gc_obj, esch_gc));
 
@@ -210,7 +221,7 @@ esch_object_new_i(esch_config* config, esch_type* type, esch_object** obj)
                 ret);
         if (ret == ESCH_ERROR_OUT_OF_MEMORY)
         {
-            (void)esch_log_info(log, "object:new: OOM. Trigger GC.");
+            ESCH_LOG_INFO(log, "object:new: OOM. Trigger GC.");
             ret = esch_gc_recycle_i(gc);
             ESCH_CHECK_1(ret == ESCH_OK, log,
                     "object:new: Can't trigger GC. obj: 0x%x", gc, ret);
@@ -225,7 +236,7 @@ esch_object_new_i(esch_config* config, esch_type* type, esch_object** obj)
         ESCH_OBJECT_GET_TYPE(new_object)  = type;
         ESCH_OBJECT_GET_ALLOC(new_object) = alloc;
         ESCH_OBJECT_GET_LOG(new_object)   = log;
-        (void)esch_log_info(log, "object:new: Try attach GC.");
+        ESCH_LOG_INFO(log, "object:new: Try attach GC.");
         ret = esch_gc_attach_i(gc, new_object);
         ESCH_CHECK_1(ret == ESCH_OK, log,
                 "object:new: Can't attach to GC. type: 0x%x", type, ret);
@@ -246,6 +257,8 @@ esch_object_new_i(esch_config* config, esch_type* type, esch_object** obj)
      */
     /* ESCH_OBJECT_GET_GC(new_object) is already assigned. */
     /* ESCH_OBJECT_GET_GC_ID(new_object) is already assigned. */
+    ESCH_TRACE(ESCH_TRACE_OBJECT_NEW, type, obj_size,
+               ESCH_OBJECT_GET_GC_ID(new_object));
     (*obj) = new_object;
     new_object = NULL;
 Exit:
@@ -258,6 +271,38 @@ Exit:
     return ret;
 }
 
+esch_error
+esch_object_init_i(esch_config* config, esch_alloc* alloc,
+                   esch_type* type, esch_object* obj)
+{
+    esch_error ret = ESCH_OK;
+    esch_object* gc_obj = NULL;
+    esch_log* log = NULL;
+
+    ESCH_CHECK_PARAM_INTERNAL(alloc != NULL);
+    ESCH_CHECK_PARAM_INTERNAL(type != NULL);
+    ESCH_CHECK_PARAM_INTERNAL(obj != NULL);
+    ESCH_CHECK_PARAM_INTERNAL(ESCH_CONFIG_GET_LOG(config) != NULL);
+    ESCH_CHECK_PARAM_INTERNAL(type->version == ESCH_VERSION);
+
+    log = ESCH_CAST_FROM_OBJECT(ESCH_CONFIG_GET_LOG(config), esch_log);
+    gc_obj = ESCH_CONFIG_GET_GC(config);
+    ESCH_OBJECT_GET_TYPE(obj)  = type;
+    ESCH_OBJECT_GET_ALLOC(obj) = alloc;
+    ESCH_OBJECT_GET_LOG(obj)   = log;
+    if (gc_obj != NULL)
+    {
+        ret = esch_gc_attach_i(ESCH_CAST_FROM_OBJECT(gc_obj, esch_gc), obj);
+        ESCH_CHECK_1(ret == ESCH_OK, log,
+                "object:init: Can't attach to GC. type: 0x%x", type, ret);
+    }
+    ESCH_TRACE(ESCH_TRACE_OBJECT_NEW, type,
+               sizeof(esch_object) + ESCH_TYPE_GET_OBJECT_SIZE(type),
+               ESCH_OBJECT_GET_GC_ID(obj));
+Exit:
+    return ret;
+}
+
 esch_error
 esch_object_delete_i(esch_object* obj)
 {
@@ -278,6 +323,7 @@ esch_object_delete_i(esch_object* obj)
     ESCH_ASSERT(log != NULL);
     ESCH_ASSERT(!gc && !gc_id);
 
+    ESCH_TRACE(ESCH_TRACE_OBJECT_DELETE, type, 0, NULL);
     ret = type->object_destructor(obj);
     ESCH_CHECK_1(ret == ESCH_OK, log, "Dtor fails: obj: 0x%x", obj, ret);
     if (alloc != NULL)
@@ -288,7 +334,7 @@ esch_object_delete_i(esch_object* obj)
     }
     else
     {
-        esch_log_info(log, "object:delete: No alloc. Do nothing");
+        ESCH_LOG_INFO(log, "object:delete: No alloc. Do nothing");
     }
 Exit:
     return ret;
@@ -311,7 +357,8 @@ esch_object_get_iterator_i(esch_object* obj, esch_iterator* iter)
     }
     else
     {
-        (void)esch_log_info(log, "get_iterator(): container type.");
+        ESCH_LOG_INFO(log, "get_iterator(): container type.");
+        iter->seek_object = NULL; /* Optional, most types don't have. */
         ret = (ESCH_TYPE_GET_OBJECT_GET_ITERATOR(type))(obj, iter);
     }
     return ret;
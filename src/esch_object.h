@@ -56,6 +56,17 @@ struct esch_object
 
 esch_error esch_object_new_i(esch_config* config, esch_type* type,
                              esch_object** obj);
+/* Same as esch_object_new_i(), but memory comes from given alloc. */
+esch_error esch_object_new_with_alloc_i(esch_config* config,
+                                        esch_alloc* alloc, esch_type* type,
+                                        esch_object** obj);
+/*
+ * Set up an object in a zeroed buffer taken from alloc, and attach it
+ * to GC of config if any. For types creating many objects at once. On
+ * error, object is not attached, and buffer still belongs to caller.
+ */
+esch_error esch_object_init_i(esch_config* config, esch_alloc* alloc,
+                              esch_type* type, esch_object* obj);
 esch_error esch_object_delete_i(esch_object* obj);
 esch_error esch_object_get_iterator_i(esch_object* obj, esch_iterator* iter);
 
@@ -2,15 +2,62 @@
 #include "esch_debug.h"
 #include "esch_type.h"
 #include "esch_config.h"
+#include "esch_object.h"
+#include "esch_alloc.h"
+#include "esch_thread.h"
+#include "esch_vector.h"
 
-#define HEAD(pa) ((pa)->values[0])
-#define TAIL(pa) ((pa)->values[1])
 #define HEAD_ID 0
 #define TAIL_ID 1
 #define EMPTY_ID 2
 
 esch_value esch_pair_empty = { ESCH_VALUE_TYPE_END, 0 };
 
+/* Current epoch of length hints, see esch_pair.h. */
+static volatile size_t esch_pair_hint_epoch = 0;
+
+#define ESCH_PAIR_HINT_IS_VALID(pa, epoch) \
+    ((pa)->hint_length != 0 && (pa)->hint_epoch == (epoch))
+
+static size_t
+esch_pair_get_hint_epoch_i(void)
+{
+    return esch_atomic_load_i(&esch_pair_hint_epoch);
+}
+static void
+esch_pair_invalidate_hint_i(esch_pair* pair)
+{
+    size_t epoch = esch_pair_get_hint_epoch_i();
+    if (ESCH_PAIR_HINT_IS_VALID(pair, epoch))
+    {
+        (void)esch_atomic_add_i(&esch_pair_hint_epoch, 1);
+    }
+    pair->hint_length = 0;
+}
+
+static void
+esch_pair_read_i(esch_pair* pair, size_t idx, esch_value* value)
+{
+    value->type = ESCH_PAIR_GET_TYPE(pair, idx);
+    value->val = pair->data[idx];
+}
+static void
+esch_pair_write_i(esch_pair* pair, size_t idx, esch_value* value)
+{
+    pair->tags[idx] = (esch_byte)value->type;
+    pair->data[idx] = value->val;
+    if (idx == TAIL_ID && value->type == ESCH_VALUE_TYPE_OBJECT &&
+            ESCH_OBJECT_GET_TYPE(value->val.o) == &(esch_pair_type.type))
+    {
+        pair->tags[idx] |= ESCH_PAIR_TAG_NEXT_IS_PAIR;
+        if (ESCH_CAST_FROM_OBJECT(value->val.o, esch_pair) ==
+                ESCH_PAIR_ADJACENT_NEXT(pair))
+        {
+            pair->tags[idx] |= ESCH_PAIR_TAG_NEXT_IS_ADJACENT;
+        }
+    }
+}
+
 static esch_error
 esch_pair_new_default_as_object_i(esch_config* config, esch_object** obj);
 static esch_error
@@ -102,6 +149,7 @@ esch_pair_new_i(esch_config* config,
 {
     esch_error ret = ESCH_OK;
     esch_object* new_obj = NULL;
+    esch_object* alloc_obj = NULL;
     esch_pair* new_pair = NULL;
     esch_log* log = NULL;
 
@@ -120,21 +168,24 @@ esch_pair_new_i(esch_config* config,
 
     log = ESCH_CAST_FROM_OBJECT(ESCH_CONFIG_GET_LOG(config), esch_log);
 
-    ret = esch_object_new_i(config, &(esch_pair_type.type), &new_obj);
+    /* Pairs come from "pair:alloc", usually a pool, if it's set. */
+    alloc_obj = ESCH_CONFIG_GET_PAIR_ALLOC(config);
+    if (alloc_obj == NULL)
+    {
+        alloc_obj = ESCH_CONFIG_GET_ALLOC(config);
+    }
+    ret = esch_object_new_with_alloc_i(config,
+                                       ESCH_CAST_FROM_OBJECT(alloc_obj,
+                                                             esch_alloc),
+                                       &(esch_pair_type.type), &new_obj);
     ESCH_CHECK(ret == ESCH_OK, log, "pair:new:Can't create object", ret);
     new_pair = ESCH_CAST_FROM_OBJECT(new_obj, esch_pair);
 
-    HEAD(new_pair).type = head->type;
-    HEAD(new_pair).val = head->val;
-    TAIL(new_pair).type = tail->type;
-    TAIL(new_pair).val = tail->val;
-    if (tail->type == ESCH_VALUE_TYPE_OBJECT &&
-            ESCH_OBJECT_GET_TYPE(tail->val.o) == &(esch_pair_type.type))
-    {
-        new_pair->next_is_pair = 1;
-    } else {
-        new_pair->next_is_pair = 0;
-    }
+    esch_pair_write_i(new_pair, HEAD_ID, head);
+    esch_pair_write_i(new_pair, TAIL_ID, tail);
+    /* Cell may be reused from a pool, with an old hint in it. */
+    new_pair->hint_length = 0;
+    new_pair->hint_epoch = 0;
     (*pair) = new_pair;
     new_pair = NULL;
 Exit:
@@ -144,26 +195,218 @@ Exit:
     return ret;
 }
 
+/* Where values of a new list come from. */
+typedef void (*esch_pair_read_source_f)(const void*, size_t, esch_value*);
+
+static void
+esch_pair_read_array_i(const void* source, size_t index, esch_value* value)
+{
+    (*value) = ((const esch_value*)source)[index];
+}
+static void
+esch_pair_read_vector_i(const void* source, size_t index, esch_value* value)
+{
+    esch_vector_read_i((esch_vector*)source, index, value);
+}
+
+/*
+ * Build cells of list one after another, so runs from pool are linked
+ * as adjacent pairs. Last cell is the empty pair.
+ */
+static esch_error
+esch_pair_list_from_source_i(esch_config* config,
+                             const void* source,
+                             esch_pair_read_source_f read,
+                             size_t length, esch_pair** list)
+{
+    esch_error ret = ESCH_OK;
+    esch_object* alloc_obj = NULL;
+    esch_alloc* alloc = NULL;
+    esch_log* log = NULL;
+    esch_alloc_pool* pool = NULL;
+    esch_byte* run = NULL;
+    size_t run_cells = 0;
+    size_t stride = ESCH_PAIR_CELL_SIZE;
+    esch_object* cell = NULL;
+    esch_pair* first = NULL;
+    esch_pair* last = NULL;
+    esch_pair* each = NULL;
+    esch_value link;
+    esch_value value;
+    size_t epoch = 0;
+    esch_bool hint = ESCH_TRUE;
+    size_t i = 0;
+
+    log = ESCH_CAST_FROM_OBJECT(ESCH_CONFIG_GET_LOG(config), esch_log);
+    alloc_obj = ESCH_CONFIG_GET_PAIR_ALLOC(config);
+    if (alloc_obj == NULL)
+    {
+        alloc_obj = ESCH_CONFIG_GET_ALLOC(config);
+    }
+    alloc = ESCH_CAST_FROM_OBJECT(alloc_obj, esch_alloc);
+    if (ESCH_OBJECT_GET_TYPE(alloc_obj) == &(esch_alloc_pool_type.type))
+    {
+        pool = (esch_alloc_pool*)alloc;
+        stride = pool->cell_size;
+        ESCH_CHECK_1(stride >= ESCH_PAIR_CELL_SIZE, log,
+                     "pair:list:Pool cell too small: %d", (int)stride,
+                     ESCH_ERROR_INVALID_PARAMETER);
+    }
+
+    epoch = esch_pair_get_hint_epoch_i();
+    hint = (length <= ESCH_PAIR_HINT_LENGTH_MAX - 1);
+    link.type = ESCH_VALUE_TYPE_OBJECT;
+    for (i = 0; i <= length; ++i)
+    {
+        if (run_cells == 0)
+        {
+            if (pool != NULL)
+            {
+                ret = esch_alloc_pool_new_run_i(alloc, length + 1 - i,
+                                                (void**)&run, &run_cells);
+            }
+            else
+            {
+                ret = esch_alloc_realloc(alloc, NULL, ESCH_PAIR_CELL_SIZE,
+                                         (void**)&run);
+                run_cells = 1;
+            }
+            ESCH_CHECK(ret == ESCH_OK, log, "pair:list:Can't allocate", ret);
+        }
+        cell = (esch_object*)run;
+        run += stride;
+        run_cells -= 1;
+        ret = esch_object_init_i(config, alloc, &(esch_pair_type.type),
+                                 cell);
+        if (ret != ESCH_OK)
+        {
+            (void)esch_alloc_free(alloc, cell);
+        }
+        ESCH_CHECK(ret == ESCH_OK, log, "pair:list:Can't init pair", ret);
+        each = ESCH_CAST_FROM_OBJECT(cell, esch_pair);
+        if (i < length)
+        {
+            read(source, i, &value);
+            esch_pair_write_i(each, HEAD_ID, &value);
+        }
+        else
+        {
+            esch_pair_write_i(each, HEAD_ID, &esch_pair_empty);
+        }
+        esch_pair_write_i(each, TAIL_ID, &esch_pair_empty);
+        /* Known length: all pairs have hints at once. Cell may be
+         * reused from a pool, so hint is always written. */
+        each->hint_epoch = epoch;
+        each->hint_length = (hint? (uint32_t)(length - i + 1): 0);
+        if (last == NULL)
+        {
+            first = each;
+        }
+        else
+        {
+            link.val.o = cell;
+            esch_pair_write_i(last, TAIL_ID, &link);
+        }
+        last = each;
+    }
+    (*list) = first;
+    first = NULL;
+Exit:
+    /* Pairs attached to GC are garbage now. Others are deleted here. */
+    while (first != NULL && ESCH_OBJECT_GET_GC(ESCH_CAST_TO_OBJECT(first))
+                                == NULL)
+    {
+        each = (ESCH_PAIR_NEXT_IS_PAIR(first)?
+                ESCH_CAST_FROM_OBJECT(first->data[TAIL_ID].o, esch_pair):
+                NULL);
+        (void)esch_object_delete_i(ESCH_CAST_TO_OBJECT(first));
+        first = each;
+    }
+    /* Unused cells of a run go back to pool. */
+    for (i = 0; i < run_cells; ++i)
+    {
+        (void)esch_alloc_free(alloc, run);
+        run += stride;
+    }
+    return ret;
+}
+
+esch_error
+esch_pair_list_from_values(esch_config* config,
+                           const esch_value* values, size_t length,
+                           esch_pair** list)
+{
+    esch_error ret = ESCH_OK;
+    size_t i = 0;
+    ESCH_CHECK_PARAM_PUBLIC(config != NULL);
+    ESCH_CHECK_PARAM_PUBLIC(list != NULL);
+    ESCH_CHECK_PARAM_PUBLIC(values != NULL || length == 0);
+    ESCH_CHECK_PARAM_PUBLIC(ESCH_CONFIG_GET_ALLOC(config) != NULL);
+    ESCH_CHECK_PARAM_PUBLIC(ESCH_CONFIG_GET_LOG(config) != NULL);
+    for (i = 0; i < length; ++i)
+    {
+        ESCH_CHECK_PARAM_PUBLIC(values[i].type > ESCH_VALUE_TYPE_UNKNOWN &&
+                                values[i].type < ESCH_VALUE_TYPE_END);
+    }
+
+    ret = esch_pair_list_from_source_i(config, values,
+                                       esch_pair_read_array_i, length, list);
+Exit:
+    return ret;
+}
+
+esch_error
+esch_vector_to_list(esch_config* config, esch_vector* vec,
+                    esch_pair** list)
+{
+    esch_error ret = ESCH_OK;
+    ESCH_CHECK_PARAM_PUBLIC(config != NULL);
+    ESCH_CHECK_PARAM_PUBLIC(vec != NULL);
+    ESCH_CHECK_PARAM_PUBLIC(list != NULL);
+    ESCH_CHECK_PARAM_PUBLIC(ESCH_IS_VALID_VECTOR(vec));
+    ESCH_CHECK_PARAM_PUBLIC(ESCH_CONFIG_GET_ALLOC(config) != NULL);
+    ESCH_CHECK_PARAM_PUBLIC(ESCH_CONFIG_GET_LOG(config) != NULL);
+
+    /* Values of vector are valid already. Mixed layout is an array. */
+    if (vec->layout == ESCH_VECTOR_LAYOUT_MIXED)
+    {
+        ret = esch_pair_list_from_source_i(config, vec->begin,
+                                           esch_pair_read_array_i,
+                                           vec->length, list);
+    }
+    else
+    {
+        ret = esch_pair_list_from_source_i(config, vec,
+                                           esch_pair_read_vector_i,
+                                           vec->length, list);
+    }
+Exit:
+    return ret;
+}
+
 /* ===================================================================
  * Iterator functions
  * We use dispatch table to avoid if-else type check, which could
  * help reducing runtime cost.
  * =================================================================== */
 
-static esch_value*
-esch_pair_get_value_by_id(esch_iterator* iter, size_t idx)
+static void
+esch_pair_get_value_by_id(esch_iterator* iter, size_t idx,
+                          esch_value* value)
 {
     esch_pair* pair = ESCH_CAST_FROM_OBJECT(iter->container, esch_pair);
     ESCH_CHECK_PARAM_INTERNAL(idx >= HEAD_ID && idx < EMPTY_ID);
-    return &(pair->values[idx]);
+    esch_pair_read_i(pair, idx, value);
 }
-static esch_value*
-esch_pair_get_end_value(esch_iterator* iter, size_t idx)
+static void
+esch_pair_get_end_value(esch_iterator* iter, size_t idx,
+                        esch_value* value)
 {
-    return &esch_pair_empty;
+    value->type = esch_pair_empty.type;
+    value->val = esch_pair_empty.val;
 }
 
-typedef esch_value* (*esch_pair_value_f)(esch_iterator*, size_t);
+typedef void (*esch_pair_value_f)(esch_iterator*, size_t, esch_value*);
  
 static esch_pair_value_f esch_pair_value_dispatch[3] = {
     esch_pair_get_value_by_id, /* current: head */
@@ -175,15 +418,12 @@ static esch_error
 esch_pair_iterator_get_value_i(esch_iterator* iter, esch_value* value)
 {
     size_t idx = 0;
-    esch_value* retval = NULL;
     ESCH_CHECK_PARAM_INTERNAL(iter != NULL);
     ESCH_CHECK_PARAM_INTERNAL(value != NULL);
 
     idx = (size_t)(iter->iterator);
 
-    retval = esch_pair_value_dispatch[idx](iter, idx);
-    value->type = retval->type;
-    value->val = retval->val;
+    esch_pair_value_dispatch[idx](iter, idx, value);
     return ESCH_OK;
 }
 
@@ -201,7 +441,7 @@ esch_pair_assign_next_head(esch_iterator* iter, esch_pair* pair)
     ESCH_CHECK_PARAM_INTERNAL(iter != NULL);
     ESCH_CHECK_PARAM_INTERNAL(pair != NULL);
     ESCH_CHECK_PARAM_INTERNAL(ESCH_IS_VALID_PAIR(pair));
-    iter->container = TAIL(pair).val.o; /* Switch to next head pair */
+    iter->container = pair->data[TAIL_ID].o; /* Switch to next pair */
     iter->iterator = (void*)HEAD_ID;
 }
 static void
@@ -220,7 +460,7 @@ esch_pair_assign_next_or_object(esch_iterator* iter, esch_pair* pair)
 {
     ESCH_CHECK_PARAM_INTERNAL(iter != NULL);
     ESCH_CHECK_PARAM_INTERNAL(pair != NULL);
-    esch_pair_next_pair_dispatch[pair->next_is_pair](iter, pair);
+    esch_pair_next_pair_dispatch[ESCH_PAIR_NEXT_IS_PAIR(pair)](iter, pair);
 }
 
 static esch_pair_object_check_f esch_pair_assign_next[3] = {
@@ -242,6 +482,13 @@ esch_pair_iterator_get_next_i(esch_iterator* iter)
     ESCH_CHECK_PARAM_INTERNAL(ESCH_IS_VALID_PAIR(current_pair));
     idx = (size_t)(iter->iterator);
 
+    /* In a run of adjacent pairs, address of next pair is known without
+     * loading tail, so walking a run is a linear scan. */
+    if (idx == HEAD_ID && ESCH_PAIR_NEXT_IS_ADJACENT(current_pair)) {
+        iter->container =
+            ESCH_CAST_TO_OBJECT(ESCH_PAIR_ADJACENT_NEXT(current_pair));
+        goto Exit;
+    }
     /* Get next object */
     esch_pair_assign_next[idx](iter, current_pair);
     /* Equivalent if-check style code
@@ -289,8 +536,7 @@ esch_pair_get_head(esch_pair* pair, esch_value* value)
     ESCH_CHECK_PARAM_PUBLIC(pair != NULL);
     ESCH_CHECK_PARAM_PUBLIC(value != NULL);
     ESCH_CHECK_PARAM_INTERNAL(ESCH_IS_VALID_PAIR(pair));
-    value->type = HEAD(pair).type;
-    value->val = HEAD(pair).val;
+    esch_pair_read_i(pair, HEAD_ID, value);
 Exit:
     return ret;
 }
@@ -301,8 +547,7 @@ esch_pair_get_tail(esch_pair* pair, esch_value* value)
     ESCH_CHECK_PARAM_PUBLIC(pair != NULL);
     ESCH_CHECK_PARAM_PUBLIC(value != NULL);
     ESCH_CHECK_PARAM_INTERNAL(ESCH_IS_VALID_PAIR(pair));
-    value->type = TAIL(pair).type;
-    value->val = TAIL(pair).val;
+    esch_pair_read_i(pair, TAIL_ID, value);
 Exit:
     return ret;
 }
@@ -315,8 +560,13 @@ esch_pair_set_head(esch_pair* pair, esch_value* value)
     ESCH_CHECK_PARAM_PUBLIC(value->type > ESCH_VALUE_TYPE_UNICODE &&
                             value->type <= ESCH_VALUE_TYPE_END);
     ESCH_CHECK_PARAM_INTERNAL(ESCH_IS_VALID_PAIR(pair));
-    HEAD(pair).type = value->type;
-    HEAD(pair).val = value->val;
+    if ((ESCH_PAIR_GET_TYPE(pair, HEAD_ID) == ESCH_VALUE_TYPE_END) !=
+            (value->type == ESCH_VALUE_TYPE_END))
+    {
+        /* Empty list becomes a pair, or the other way round. */
+        esch_pair_invalidate_hint_i(pair);
+    }
+    esch_pair_write_i(pair, HEAD_ID, value);
 Exit:
     return ret;
 }
@@ -329,38 +579,172 @@ esch_pair_set_tail(esch_pair* pair, esch_value* value)
     ESCH_CHECK_PARAM_PUBLIC(value->type > ESCH_VALUE_TYPE_UNICODE &&
                             value->type <= ESCH_VALUE_TYPE_END);
     ESCH_CHECK_PARAM_INTERNAL(ESCH_IS_VALID_PAIR(pair));
-    TAIL(pair).type = value->type;
-    TAIL(pair).val = value->val;
-    if (TAIL(pair).type == ESCH_VALUE_TYPE_OBJECT &&
-            ESCH_OBJECT_GET_TYPE(TAIL(pair).val.o) == &(esch_pair_type.type))
-    {
-        pair->next_is_pair = 1;
-    } else {
-        pair->next_is_pair = 0;
-    }
+    esch_pair_invalidate_hint_i(pair);
+    esch_pair_write_i(pair, TAIL_ID, value);
 Exit:
     return ret;
 }
+/*
+ * Walk list from given pair to its end, or to first pair with a valid
+ * length hint. Brent's algorithm finds a cycle within a few rounds of
+ * its length, with one pointer compare per step. For proper list,
+ * return ESCH_TRUE with number of values, and put hints on pairs
+ * walked through.
+ */
+static esch_bool
+esch_pair_walk_list_i(esch_pair* pair, size_t* length)
+{
+    size_t epoch = esch_pair_get_hint_epoch_i();
+    esch_bool proper = ESCH_FALSE;
+    esch_bool hinted = ESCH_FALSE;
+    esch_pair* each = pair;
+    esch_pair* tortoise = pair;
+    size_t steps = 0;
+    size_t power = 1;
+    size_t lambda = 0;
+    size_t total = 0;
+    size_t i = 0;
+
+    while (ESCH_TRUE)
+    {
+        if (ESCH_PAIR_HINT_IS_VALID(each, epoch))
+        {
+            proper = ESCH_TRUE;
+            hinted = ESCH_TRUE;
+            total = steps + each->hint_length - 1;
+            break;
+        }
+        if (!ESCH_PAIR_NEXT_IS_PAIR(each))
+        {
+            /* A valid list always ends with empty. */
+            proper = (ESCH_PAIR_GET_TYPE(each, HEAD_ID) ==
+                          ESCH_VALUE_TYPE_END &&
+                      ESCH_PAIR_GET_TYPE(each, TAIL_ID) ==
+                          ESCH_VALUE_TYPE_END);
+            total = steps;
+            break;
+        }
+        each = (ESCH_PAIR_NEXT_IS_ADJACENT(each)?
+                ESCH_PAIR_ADJACENT_NEXT(each):
+                ESCH_CAST_FROM_OBJECT(each->data[TAIL_ID].o, esch_pair));
+        ESCH_ASSERT(ESCH_IS_VALID_PAIR(each));
+        steps += 1;
+        if (each == tortoise)
+        {
+            break; /* Circular list */
+        }
+        lambda += 1;
+        if (lambda == power)
+        {
+            tortoise = each;
+            power *= 2;
+            lambda = 0;
+        }
+    }
+    if (!proper)
+    {
+        return ESCH_FALSE;
+    }
+    if (total <= ESCH_PAIR_HINT_LENGTH_MAX - 1)
+    {
+        each = pair;
+        for (i = 0; i <= steps; ++i)
+        {
+            if (i == steps && hinted)
+            {
+                break;
+            }
+            each->hint_epoch = epoch;
+            each->hint_length = (uint32_t)(total - i + 1);
+            if (i < steps)
+            {
+                each = ESCH_CAST_FROM_OBJECT(each->data[TAIL_ID].o,
+                                             esch_pair);
+            }
+        }
+    }
+    (*length) = total;
+    return ESCH_TRUE;
+}
+
 esch_error esch_pair_is_list(esch_pair* pair, esch_bool* is_list)
 {
     esch_error ret = ESCH_OK;
-    esch_pair* each = NULL;
+    size_t length = 0;
     ESCH_CHECK_PARAM_PUBLIC(pair != NULL);
     ESCH_CHECK_PARAM_PUBLIC(is_list != NULL);
     ESCH_CHECK_PARAM_INTERNAL(ESCH_IS_VALID_PAIR(pair));
 
-    each = pair;
-    while(each->next_is_pair) {
-        each = ESCH_CAST_FROM_OBJECT(TAIL(each).val.o, esch_pair);
-        ESCH_CHECK_PARAM_INTERNAL(ESCH_IS_VALID_PAIR(each));
-    }
-    /* Check every element until we reach the first non-pair. A valid
-     * list should always use empty as last element. */
-    (*is_list) = ((HEAD(each).type == ESCH_VALUE_TYPE_END &&
-                      TAIL(each).type == ESCH_VALUE_TYPE_END)?
-                  ESCH_TRUE: ESCH_FALSE);
+    (*is_list) = esch_pair_walk_list_i(pair, &length);
 Exit:
     return ret;
+}
 
+esch_error esch_pair_list_length(esch_pair* pair, size_t* length)
+{
+    esch_error ret = ESCH_OK;
+    size_t count = 0;
+    ESCH_CHECK_PARAM_PUBLIC(pair != NULL);
+    ESCH_CHECK_PARAM_PUBLIC(length != NULL);
+    ESCH_CHECK_PARAM_INTERNAL(ESCH_IS_VALID_PAIR(pair));
+
+    if (!esch_pair_walk_list_i(pair, &count))
+    {
+        /* Not an error worth a log: caller just asks. */
+        ret = ESCH_ERROR_BAD_VALUE_TYPE;
+        goto Exit;
+    }
+    (*length) = count;
+Exit:
+    return ret;
 }
 
+esch_error
+esch_list_to_vector(esch_config* config, esch_pair* list,
+                    esch_vector** vec)
+{
+    esch_error ret = ESCH_OK;
+    esch_log* log = NULL;
+    esch_vector* new_vec = NULL;
+    esch_pair* each = NULL;
+    esch_value value;
+    size_t length = 0;
+    size_t i = 0;
+    ESCH_CHECK_PARAM_PUBLIC(config != NULL);
+    ESCH_CHECK_PARAM_PUBLIC(list != NULL);
+    ESCH_CHECK_PARAM_PUBLIC(vec != NULL);
+    ESCH_CHECK_PARAM_PUBLIC(ESCH_CONFIG_GET_ALLOC(config) != NULL);
+    ESCH_CHECK_PARAM_PUBLIC(ESCH_CONFIG_GET_LOG(config) != NULL);
+    ESCH_CHECK_PARAM_INTERNAL(ESCH_IS_VALID_PAIR(list));
+    log = ESCH_CAST_FROM_OBJECT(ESCH_CONFIG_GET_LOG(config), esch_log);
+
+    /* Length first, so vector buffer is allocated only once. */
+    ESCH_CHECK(esch_pair_walk_list_i(list, &length), log,
+               "pair:to_vector:Not a list", ESCH_ERROR_BAD_VALUE_TYPE);
+    ESCH_CHECK_1(length <= ESCH_VECTOR_MAX_LENGTH, log,
+                 "pair:to_vector:List too long: %d", (int)length,
+                 ESCH_ERROR_OUT_OF_BOUND);
+    ret = esch_vector_new(config, &new_vec);
+    ESCH_CHECK(ret == ESCH_OK, log, "pair:to_vector:Can't create", ret);
+    ret = esch_vector_reserve_i(new_vec, length);
+    ESCH_CHECK(ret == ESCH_OK, log, "pair:to_vector:Can't reserve", ret);
+    new_vec->length = length;
+    each = list;
+    for (i = 0; i < length; ++i)
+    {
+        esch_pair_read_i(each, HEAD_ID, &value);
+        esch_vector_write_i(new_vec, i, &value);
+        each = (ESCH_PAIR_NEXT_IS_ADJACENT(each)?
+                ESCH_PAIR_ADJACENT_NEXT(each):
+                ESCH_CAST_FROM_OBJECT(each->data[TAIL_ID].o, esch_pair));
+    }
+    (*vec) = new_vec;
+    new_vec = NULL;
+Exit:
+    if (new_vec != NULL &&
+            ESCH_OBJECT_GET_GC(ESCH_CAST_TO_OBJECT(new_vec)) == NULL)
+    {
+        (void)esch_object_delete_i(ESCH_CAST_TO_OBJECT(new_vec));
+    }
+    return ret;
+}
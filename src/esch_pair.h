@@ -10,12 +10,56 @@
 extern "C" {
 #endif /* __cplusplus */
 
+/*
+ * Head and tail are kept as payloads plus 1-byte type tags, same as
+ * ESCH_VECTOR_LAYOUT_SPLIT, so a pair takes 3 words instead of 5. Tag
+ * of tail also has ESCH_PAIR_TAG_NEXT_IS_PAIR set when tail is a pair.
+ */
 struct esch_pair
 {
-    esch_byte next_is_pair; /* Bit won't work with clang */
-    esch_value values[2];
+    esch_value_data data[2]; /* Head, then tail */
+    esch_byte tags[2];       /* As esch_value_type, plus flag on tail */
+    uint32_t hint_length;    /* Proper list of (hint_length - 1) values */
+    size_t hint_epoch;       /* Epoch when hint_length is set */
 };
 
+/*
+ * Length hint: esch_pair_list_length() and esch_pair_is_list() keep
+ * length on each pair they walk through, and stop at first pair with a
+ * valid hint next time. 0 means unknown. A hint is valid only when it's
+ * set in current epoch. Setting tail (or END-ness of head) of a pair
+ * with valid hint starts a new epoch, which invalidates all hints,
+ * because lists sharing the pair are not known. Epoch is a word, so it
+ * doesn't run out: with 64-bit words, one new epoch per nanosecond
+ * takes centuries to wrap. New pairs always start without hint, so a
+ * reused cell never brings an old hint back.
+ */
+#define ESCH_PAIR_HINT_LENGTH_MAX 0xFFFFFFFE
+
+/*
+ * CDR-coding: when tail is the pair right after this one in memory,
+ * ESCH_PAIR_TAG_NEXT_IS_ADJACENT is also set, and a walk can step to
+ * next cell without loading tail. Lists built at once, like
+ * esch_pair_list_from_values(), get such runs from pair pool. Tail is
+ * still stored, and setting tail updates the flag, so an adjacent
+ * pair falls back to an ordinary pair transparently.
+ */
+#define ESCH_PAIR_TAG_NEXT_IS_PAIR 0x80
+#define ESCH_PAIR_TAG_NEXT_IS_ADJACENT 0x40
+#define ESCH_PAIR_TAG_FLAGS \
+    (ESCH_PAIR_TAG_NEXT_IS_PAIR | ESCH_PAIR_TAG_NEXT_IS_ADJACENT)
+#define ESCH_PAIR_NEXT_IS_PAIR(pa) \
+    (((pa)->tags[1] & ESCH_PAIR_TAG_NEXT_IS_PAIR) != 0)
+#define ESCH_PAIR_NEXT_IS_ADJACENT(pa) \
+    (((pa)->tags[1] & ESCH_PAIR_TAG_NEXT_IS_ADJACENT) != 0)
+#define ESCH_PAIR_GET_TYPE(pa, id) \
+    ((esch_value_type)((pa)->tags[id] & ~ESCH_PAIR_TAG_FLAGS))
+
+/* Distance between two adjacent pairs, object header included. */
+#define ESCH_PAIR_CELL_SIZE (sizeof(esch_object) + sizeof(esch_pair))
+#define ESCH_PAIR_ADJACENT_NEXT(pa) \
+    ((esch_pair*)((esch_byte*)(pa) + ESCH_PAIR_CELL_SIZE))
+
 extern esch_error
 esch_pair_new_i(esch_config* config,
                 esch_value* head, esch_value* tail,
@@ -1,5412 +1,2873 @@
 /* DON'T MODIFY: The code below is automatically generated. */
 /* Data source: http://www.fileformat.info/info/unicode/category/index.htm */
-#include "esch.h"
-static int
-esch_unicode_range_co_low_bound[] = 
+#include "esch_string.h"
+
+/*
+ * Two-stage lookup table: first stage maps high bits of code point
+ * to a block, second stage maps low bits in block to category ID.
+ * Blocks with same content are shared.
+ */
+#define ESCH_UNICODE_BLOCK_SHIFT 7
+#define ESCH_UNICODE_BLOCK_MASK ((1 << ESCH_UNICODE_BLOCK_SHIFT) - 1)
+
+static const unsigned char
+esch_unicode_category_stage1[] =
 {
-    0xe000, 
-    0xf8ff, 
-    0xf0000, 
-    0xffffd, 
-    0x100000, 
-    0x10fffd, 
+    0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15,
+    16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31,
+    32, 33, 34, 34, 35, 36, 37, 38, 39, 34, 34, 34, 40, 41, 42, 43,
+    44, 45, 46, 47, 48, 49, 50, 51, 52, 53, 54, 55, 56, 57, 58, 59,
+    60, 61, 62, 63, 64, 64, 65, 66, 67, 68, 69, 70, 71, 69, 72, 73,
+    69, 69, 64, 74, 64, 64, 75, 76, 77, 78, 79, 80, 81, 82, 69, 83,
+    84, 85, 86, 87, 88, 89, 69, 69, 90, 76, 76, 76, 76, 76, 76, 76,
+    76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76,
+    76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76,
+    76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 91, 90, 76, 76, 76,
+    76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76,
+    76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76,
+    76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76,
+    76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76,
+    76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76,
+    76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76,
+    76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76,
+    76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76,
+    76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76,
+    76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 92,
+    93, 34, 34, 34, 34, 34, 34, 34, 34, 94, 34, 34, 95, 96, 97, 98,
+    99, 100, 101, 102, 103, 104, 105, 106, 90, 76, 76, 76, 76, 76, 76, 76,
+    76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76,
+    76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76,
+    76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76,
+    76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76,
+    76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 107,
+    76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76,
+    108, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76,
+    76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76,
+    76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76,
+    76, 109, 34, 34, 110, 111, 112, 113, 34, 34, 114, 115, 116, 117, 118, 119,
+    120, 121, 122, 123, 76, 124, 125, 126, 127, 128, 76, 76, 76, 76, 76, 76,
+    129, 76, 130, 131, 132, 76, 133, 76, 134, 76, 76, 76, 135, 76, 76, 76,
+    136, 137, 138, 139, 76, 76, 76, 76, 76, 76, 76, 76, 76, 140, 76, 76,
+    76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76,
+    34, 34, 34, 34, 34, 34, 141, 76, 142, 76, 76, 76, 76, 76, 76, 76,
+    76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76,
+    34, 34, 34, 34, 34, 34, 34, 34, 143, 76, 76, 76, 76, 76, 76, 76,
+    76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76,
+    76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76,
+    76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76,
+    76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76,
+    76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76,
+    76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76,
+    34, 34, 34, 34, 144, 76, 76, 76, 76, 76, 76, 76, 76, 76, 145, 146,
+    76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76,
+    76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76,
+    76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76,
+    76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76,
+    76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76,
+    76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76,
+    76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76,
+    76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76,
+    147, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76,
+    76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76,
+    76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76,
+    76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76,
+    69, 148, 149, 150, 151, 76, 152, 76, 153, 154, 155, 156, 157, 158, 159, 160,
+    76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76,
+    76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76,
+    76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 161, 162, 76, 76,
+    163, 164, 165, 166, 167, 76, 168, 169, 170, 171, 172, 173, 174, 175, 176, 76,
+    76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76,
+    90, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76,
+    76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76,
+    76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76,
+    76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76,
+    76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76,
+    76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76,
+    76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76,
+    76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76,
+    76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76,
+    76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76,
+    76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76,
+    76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76,
+    76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76,
+    76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76,
+    76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76,
+    76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76,
+    76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76,
+    76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76,
+    76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76,
+    76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76,
+    76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 177, 90, 76,
+    76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76,
+    76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 178, 76,
+    179, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76,
+    76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76,
+    76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76,
+    76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76,
+    76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76,
+    76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76,
+    76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76,
+    76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76,
+    34, 34, 34, 34, 180, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76,
+    76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76,
+    76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76,
+    76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76,
+    76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76,
+    76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76,
+    76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76,
+    76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76,
+    76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76,
+    76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76,
+    76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76,
+    76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76,
+    76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76,
+    76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76,
+    76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76,
+    76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76,
+    76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76,
+    76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76,
+    76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76,
+    76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76,
+    76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76,
+    76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76,
+    76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76,
+    76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76,
+    76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76,
+    76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76,
+    76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76,
+    76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76,
+    76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76,
+    76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76,
+    76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76,
+    76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76,
+    76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76,
+    76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76,
+    76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76,
+    76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76,
+    76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76,
+    76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76,
+    76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76,
+    76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76,
+    76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76,
+    76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76,
+    76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76,
+    76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76,
+    76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76,
+    76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76,
+    76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76,
+    76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76,
+    76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76,
+    76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76,
+    76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76,
+    76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76,
+    76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76,
+    76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76,
+    76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76,
+    76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76,
+    76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76,
+    76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76,
+    76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76,
+    76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76,
+    76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76,
+    76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76,
+    76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76,
+    76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76,
+    76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76,
+    76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76,
+    76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76,
+    76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76,
+    76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76,
+    76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76,
+    76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76,
+    76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76,
+    76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76,
+    76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76,
+    76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76,
+    76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76,
+    76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76,
+    76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76,
+    76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76,
+    76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76,
+    76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76,
+    76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76,
+    76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76,
+    76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76,
+    76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76,
+    76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76,
+    76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76,
+    76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76,
+    76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76,
+    76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76,
+    76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76,
+    76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76,
+    76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76,
+    76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76,
+    76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76,
+    76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76,
+    76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76,
+    76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76,
+    76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76,
+    76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76,
+    76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76,
+    76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76,
+    76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76,
+    76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76,
+    76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76,
+    76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76,
+    76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76,
+    76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76,
+    76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76,
+    76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76,
+    76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76,
+    76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76,
+    76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76,
+    76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76,
+    76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76,
+    76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76,
+    76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76,
+    76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76,
+    76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76,
+    76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76,
+    76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76,
+    76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76,
+    76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76,
+    76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76,
+    76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76,
+    76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76,
+    76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76,
+    76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76,
+    76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76,
+    76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76,
+    76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76,
+    76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76,
+    76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76,
+    76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76,
+    76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76,
+    76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76,
+    76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76,
+    76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76,
+    76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76,
+    76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76,
+    76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76,
+    76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76,
+    76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76,
+    76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76,
+    76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76,
+    76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76,
+    76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76,
+    76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76,
+    76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76,
+    76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76,
+    76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76,
+    76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76,
+    76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76,
+    76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76,
+    76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76,
+    76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76,
+    76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76,
+    76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76,
+    76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76,
+    76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76,
+    76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76,
+    76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76,
+    76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76,
+    76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76,
+    76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76,
+    76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76,
+    76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76,
+    76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76,
+    76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76,
+    76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76,
+    76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76,
+    76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76,
+    76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76,
+    76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76,
+    76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76,
+    76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76,
+    76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76,
+    76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76,
+    76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76,
+    76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76,
+    76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76,
+    76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76,
+    76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76,
+    76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76,
+    76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76,
+    76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76,
+    76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76,
+    76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76,
+    76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76,
+    76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76,
+    76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76,
+    76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76,
+    76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76,
+    76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76,
+    76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76,
+    76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76,
+    76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76,
+    76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76,
+    76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76,
+    76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76,
+    76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76,
+    76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76,
+    76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76,
+    76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76,
+    76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76,
+    76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76,
+    76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76,
+    76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76,
+    76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76,
+    76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76,
+    76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76,
+    76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76,
+    76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76,
+    76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76,
+    76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76,
+    76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76,
+    76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76,
+    76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76,
+    76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76,
+    76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76,
+    76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76,
+    76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76,
+    76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76,
+    76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76,
+    76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76,
+    76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76,
+    76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76,
+    76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76,
+    76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76,
+    76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76,
+    76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76,
+    76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76,
+    76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76,
+    76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76,
+    76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76,
+    76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76,
+    76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76,
+    76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76,
+    76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76,
+    76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76,
+    76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76,
+    76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76,
+    76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76,
+    76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76,
+    76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76,
+    76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76,
+    76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76,
+    76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76,
+    76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76,
+    76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76,
+    76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76,
+    76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76,
+    76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76,
+    76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76,
+    76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76,
+    76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76,
+    76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76,
+    76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76,
+    76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76,
+    76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76,
+    76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76,
+    76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76,
+    76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76,
+    76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76,
+    76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76,
+    76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76,
+    76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76,
+    76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76,
+    76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76,
+    76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76,
+    76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76,
+    76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76,
+    76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76,
+    76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76,
+    76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76,
+    76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76,
+    76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76,
+    76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76,
+    76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76,
+    76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76,
+    76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76,
+    76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76,
+    76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76,
+    76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76,
+    76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76,
+    76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76,
+    76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76,
+    76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76,
+    76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76,
+    76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76,
+    76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76,
+    76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76,
+    76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76,
+    76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76,
+    76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76,
+    76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76,
+    76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76,
+    76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76,
+    76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76,
+    76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76,
+    76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76,
+    76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76,
+    76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76,
+    76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76,
+    76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76,
+    76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76,
+    76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76,
+    76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76,
+    76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76,
+    76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76,
+    76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76,
+    76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76,
+    76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76,
+    76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76,
+    76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76,
+    76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76,
+    76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76,
+    76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76,
+    76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76,
+    76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76,
+    76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76,
+    76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76,
+    76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76,
+    76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76,
+    76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76,
+    76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76,
+    76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76,
+    76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76,
+    76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76,
+    76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76,
+    76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76,
+    76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76,
+    76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76,
+    76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76,
+    76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76,
+    76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76,
+    76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76,
+    76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76,
+    76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76,
+    76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76,
+    76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76,
+    76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76,
+    76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76,
+    76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76,
+    76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76,
+    76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76,
+    76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76,
+    76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76,
+    76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76,
+    76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76,
+    76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76,
+    76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76,
+    76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76,
+    76, 76, 181, 182, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76,
+    76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76,
+    76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76,
+    76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76,
+    76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76,
+    76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76,
+    76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76,
+    76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76,
+    76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76,
+    76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76,
+    76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76,
+    76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76,
+    76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76,
+    76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76,
+    76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76,
+    76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76,
+    76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76,
+    76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76,
+    76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76,
+    76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76,
+    76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76,
+    76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76,
+    76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76,
+    76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76,
+    76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76,
+    76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76,
+    76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76,
+    76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76,
+    76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76,
+    76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76,
+    76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76,
+    76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76,
+    108, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76,
+    76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76,
+    76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76,
+    76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76,
+    76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76,
+    76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76,
+    76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76,
+    76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76,
+    76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76,
+    76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76,
+    76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76,
+    76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76,
+    76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76,
+    76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76,
+    76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76,
+    76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76,
+    76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76,
+    76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76,
+    76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76,
+    76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76,
+    76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76,
+    76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76,
+    76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76,
+    76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76,
+    76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76,
+    76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76,
+    76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76,
+    76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76,
+    76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76,
+    76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76,
+    76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76,
+    76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 183,
+    108, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76,
+    76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76,
+    76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76,
+    76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76,
+    76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76,
+    76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76,
+    76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76,
+    76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76,
+    76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76,
+    76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76,
+    76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76,
+    76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76,
+    76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76,
+    76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76,
+    76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76,
+    76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76,
+    76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76,
+    76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76,
+    76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76,
+    76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76,
+    76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76,
+    76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76,
+    76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76,
+    76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76,
+    76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76,
+    76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76,
+    76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76,
+    76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76,
+    76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76,
+    76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76,
+    76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76,
+    76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 183,
 };
-static int
-esch_unicode_range_co_up_bound[] = 
+static const unsigned char
+esch_unicode_category_stage2[] =
 {
-    0xe000, 
-    0xf8ff, 
-    0xf0000, 
-    0xffffd, 
-    0x100000, 
-    0x10fffd, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 13, 13, 13, 14, 13, 13, 13, 0, 0, 13, 15, 13, 11, 13, 13,
+    8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 13, 13, 15, 15, 15, 13,
+    13, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 13, 0, 16, 12,
+    16, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 0, 15, 0, 15, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 13, 14, 14, 14, 14, 17, 13, 16, 17, 5, 0, 15, 0, 17, 16,
+    17, 15, 10, 10, 16, 2, 13, 13, 16, 10, 5, 0, 10, 10, 10, 13,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 15, 1, 1, 1, 1, 1, 1, 1, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 15, 2, 2, 2, 2, 2, 2, 2, 2,
+    1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2,
+    1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2,
+    1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2,
+    1, 2, 1, 2, 1, 2, 1, 2, 2, 1, 2, 1, 2, 1, 2, 1,
+    2, 1, 2, 1, 2, 1, 2, 1, 2, 2, 1, 2, 1, 2, 1, 2,
+    1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2,
+    1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2,
+    1, 2, 1, 2, 1, 2, 1, 2, 1, 1, 2, 1, 2, 1, 2, 2,
+    2, 1, 1, 2, 1, 2, 1, 1, 2, 1, 1, 1, 2, 2, 1, 1,
+    1, 1, 2, 1, 1, 2, 1, 1, 1, 2, 2, 2, 1, 1, 2, 1,
+    1, 2, 1, 2, 1, 2, 1, 1, 2, 1, 2, 2, 1, 2, 1, 1,
+    2, 1, 1, 1, 2, 1, 2, 1, 1, 2, 2, 5, 1, 2, 2, 2,
+    5, 5, 5, 5, 1, 3, 2, 1, 3, 2, 1, 3, 2, 1, 2, 1,
+    2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 2, 1, 2,
+    1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2,
+    2, 1, 3, 2, 1, 2, 1, 1, 1, 2, 1, 2, 1, 2, 1, 2,
+    1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2,
+    1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2,
+    1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2,
+    1, 2, 1, 2, 2, 2, 2, 2, 2, 2, 1, 1, 2, 1, 1, 2,
+    2, 1, 2, 1, 1, 1, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 5, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    4, 4, 16, 16, 16, 16, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    4, 4, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,
+    4, 4, 4, 4, 4, 16, 16, 16, 16, 16, 16, 16, 4, 16, 4, 16,
+    16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,
+    6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+    6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+    6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+    6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+    6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+    6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+    6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+    1, 2, 1, 2, 4, 16, 1, 2, 0, 0, 4, 2, 2, 2, 13, 0,
+    0, 0, 0, 0, 16, 16, 1, 13, 1, 1, 1, 0, 1, 0, 1, 1,
+    2, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 1,
+    2, 2, 1, 1, 1, 2, 2, 2, 1, 2, 1, 2, 1, 2, 1, 2,
+    1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2,
+    2, 2, 2, 2, 1, 2, 15, 1, 2, 1, 1, 2, 2, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2,
+    1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2,
+    1, 2, 17, 6, 6, 6, 6, 6, 0, 0, 1, 2, 1, 2, 1, 2,
+    1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2,
+    1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2,
+    1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2,
+    1, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 2,
+    1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2,
+    1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2,
+    1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2,
+    1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2,
+    1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2,
+    1, 2, 1, 2, 1, 2, 1, 2, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 0, 0, 4, 13, 13, 13, 13, 13, 13,
+    0, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 0, 13, 11, 0, 0, 0, 0, 14,
+    0, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+    6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+    6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 11, 6,
+    13, 6, 6, 13, 6, 6, 13, 6, 0, 0, 0, 0, 0, 0, 0, 0,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 0, 0, 0, 0, 0,
+    5, 5, 5, 13, 13, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 15, 15, 15, 13, 13, 14, 13, 13, 17, 17,
+    6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 13, 0, 0, 13, 13,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    4, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 6, 6, 6, 6, 6,
+    6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+    8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 13, 13, 13, 13, 5, 5,
+    6, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 13, 5, 6, 6, 6, 6, 6, 6, 6, 0, 17, 6,
+    6, 6, 6, 6, 6, 4, 4, 6, 6, 17, 6, 6, 6, 6, 5, 5,
+    8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 5, 5, 5, 17, 17, 5,
+    13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 0, 0,
+    5, 6, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+    6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 0, 0, 5, 5, 5,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 5, 5, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+    6, 5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 6, 6, 6, 6, 6,
+    6, 6, 6, 6, 4, 4, 17, 13, 13, 13, 4, 0, 0, 0, 0, 0,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 5, 5, 6, 6, 6, 6, 4, 6, 6, 6, 6, 6,
+    6, 6, 6, 6, 4, 6, 6, 6, 4, 6, 6, 6, 6, 6, 0, 0,
+    13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 0,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 6, 6, 6, 0, 0, 13, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    5, 0, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+    6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 0,
+    6, 6, 6, 7, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 6, 7, 6, 5, 7, 7,
+    7, 6, 6, 6, 6, 6, 6, 6, 6, 7, 7, 7, 7, 6, 7, 7,
+    5, 6, 6, 6, 6, 6, 6, 6, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 6, 6, 13, 13, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8,
+    13, 4, 5, 5, 5, 5, 5, 5, 0, 5, 5, 5, 5, 5, 5, 5,
+    0, 6, 7, 7, 0, 5, 5, 5, 5, 5, 5, 5, 5, 0, 0, 5,
+    5, 0, 0, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 0, 5, 5, 5, 5, 5, 5,
+    5, 0, 5, 0, 0, 0, 5, 5, 5, 5, 0, 0, 6, 5, 7, 7,
+    7, 6, 6, 6, 6, 0, 0, 7, 7, 0, 0, 7, 7, 6, 5, 0,
+    0, 0, 0, 0, 0, 0, 0, 7, 0, 0, 0, 0, 5, 5, 0, 5,
+    5, 5, 6, 6, 0, 0, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8,
+    5, 5, 14, 14, 10, 10, 10, 10, 10, 10, 17, 14, 0, 0, 0, 0,
+    0, 6, 6, 7, 0, 5, 5, 5, 5, 5, 5, 0, 0, 0, 0, 5,
+    5, 0, 0, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 0, 5, 5, 5, 5, 5, 5,
+    5, 0, 5, 5, 0, 5, 5, 0, 5, 5, 0, 0, 6, 0, 7, 7,
+    7, 6, 6, 0, 0, 0, 0, 6, 6, 0, 0, 6, 6, 6, 0, 0,
+    0, 6, 0, 0, 0, 0, 0, 0, 0, 5, 5, 5, 5, 0, 5, 0,
+    0, 0, 0, 0, 0, 0, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8,
+    6, 6, 5, 5, 5, 6, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 6, 6, 7, 0, 5, 5, 5, 5, 5, 5, 5, 5, 5, 0, 5,
+    5, 5, 0, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 0, 5, 5, 5, 5, 5, 5,
+    5, 0, 5, 5, 0, 5, 5, 5, 5, 5, 0, 0, 6, 5, 7, 7,
+    7, 6, 6, 6, 6, 6, 0, 6, 6, 7, 0, 7, 7, 6, 0, 0,
+    5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    5, 5, 6, 6, 0, 0, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8,
+    13, 14, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 6, 7, 7, 0, 5, 5, 5, 5, 5, 5, 5, 5, 0, 0, 5,
+    5, 0, 0, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 0, 5, 5, 5, 5, 5, 5,
+    5, 0, 5, 5, 0, 5, 5, 5, 5, 5, 0, 0, 6, 5, 7, 6,
+    7, 6, 6, 6, 6, 0, 0, 7, 7, 0, 0, 7, 7, 6, 0, 0,
+    0, 0, 0, 0, 0, 0, 6, 7, 0, 0, 0, 0, 5, 5, 0, 5,
+    5, 5, 6, 6, 0, 0, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8,
+    17, 5, 10, 10, 10, 10, 10, 10, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 6, 5, 0, 5, 5, 5, 5, 5, 5, 0, 0, 0, 5, 5,
+    5, 0, 5, 5, 5, 5, 0, 0, 0, 5, 5, 0, 5, 0, 5, 5,
+    0, 0, 0, 5, 5, 0, 0, 0, 5, 5, 5, 0, 0, 0, 5, 5,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 0, 0, 0, 0, 7, 7,
+    6, 7, 7, 0, 0, 0, 7, 7, 7, 0, 7, 7, 7, 6, 0, 0,
+    5, 0, 0, 0, 0, 0, 0, 7, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8,
+    10, 10, 10, 17, 17, 17, 17, 17, 17, 14, 17, 0, 0, 0, 0, 0,
+    0, 7, 7, 7, 0, 5, 5, 5, 5, 5, 5, 5, 5, 0, 5, 5,
+    5, 0, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 0, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 0, 5, 5, 5, 5, 5, 0, 0, 0, 5, 6, 6,
+    6, 7, 7, 7, 7, 0, 6, 6, 6, 0, 6, 6, 6, 6, 0, 0,
+    0, 0, 0, 0, 0, 6, 6, 0, 5, 5, 0, 0, 0, 0, 0, 0,
+    5, 5, 6, 6, 0, 0, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8,
+    0, 0, 0, 0, 0, 0, 0, 0, 10, 10, 10, 10, 10, 10, 10, 17,
+    0, 0, 7, 7, 0, 5, 5, 5, 5, 5, 5, 5, 5, 0, 5, 5,
+    5, 0, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 0, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 0, 5, 5, 5, 5, 5, 0, 0, 6, 5, 7, 6,
+    7, 7, 7, 7, 7, 0, 6, 7, 7, 0, 7, 7, 6, 6, 0, 0,
+    0, 0, 0, 0, 0, 7, 7, 0, 0, 0, 0, 0, 0, 0, 5, 0,
+    5, 5, 6, 6, 0, 0, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8,
+    0, 5, 5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 7, 7, 0, 5, 5, 5, 5, 5, 5, 5, 5, 0, 5, 5,
+    5, 0, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 0, 0, 5, 7, 7,
+    7, 6, 6, 6, 6, 0, 7, 7, 7, 0, 7, 7, 7, 6, 5, 0,
+    0, 0, 0, 0, 0, 0, 0, 7, 0, 0, 0, 0, 0, 0, 0, 0,
+    5, 5, 6, 6, 0, 0, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8,
+    10, 10, 10, 10, 10, 10, 0, 0, 0, 17, 5, 5, 5, 5, 5, 5,
+    0, 0, 7, 7, 0, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 5, 5, 5, 0, 0, 0, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 0, 5, 5, 5, 5, 5, 5, 5, 5, 5, 0, 5, 0, 0,
+    5, 5, 5, 5, 5, 5, 5, 0, 0, 0, 6, 0, 0, 0, 0, 7,
+    7, 7, 6, 6, 6, 0, 6, 0, 7, 7, 7, 7, 7, 7, 7, 7,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 7, 7, 13, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 6, 5, 5, 6, 6, 6, 6, 6, 6, 6, 0, 0, 0, 0, 14,
+    5, 5, 5, 5, 5, 5, 4, 6, 6, 6, 6, 6, 6, 6, 6, 13,
+    8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 13, 13, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 5, 5, 0, 5, 0, 0, 5, 5, 0, 5, 0, 0, 5, 0, 0,
+    0, 0, 0, 0, 5, 5, 5, 5, 0, 5, 5, 5, 5, 5, 5, 5,
+    0, 5, 5, 5, 0, 5, 0, 5, 0, 0, 5, 5, 0, 5, 5, 5,
+    5, 6, 5, 5, 6, 6, 6, 6, 6, 6, 0, 6, 6, 5, 0, 0,
+    5, 5, 5, 5, 5, 0, 4, 0, 6, 6, 6, 6, 6, 6, 0, 0,
+    8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 0, 0, 5, 5, 5, 5,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    5, 17, 17, 17, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
+    13, 13, 13, 17, 13, 17, 17, 17, 6, 6, 17, 17, 17, 17, 17, 17,
+    8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 10, 10, 10, 10, 10, 10,
+    10, 10, 10, 10, 17, 6, 17, 6, 17, 6, 0, 0, 0, 0, 7, 7,
+    5, 5, 5, 5, 5, 5, 5, 5, 0, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 0, 0, 0,
+    0, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 7,
+    6, 6, 6, 6, 6, 13, 6, 6, 5, 5, 5, 5, 5, 6, 6, 6,
+    6, 6, 6, 6, 6, 6, 6, 6, 0, 6, 6, 6, 6, 6, 6, 6,
+    6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+    6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 0, 17, 17,
+    17, 17, 17, 17, 17, 17, 6, 17, 17, 17, 17, 17, 17, 0, 17, 17,
+    13, 13, 13, 13, 13, 17, 17, 17, 17, 13, 13, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 7, 7, 6, 6, 6,
+    6, 7, 6, 6, 6, 6, 6, 6, 7, 6, 6, 7, 7, 6, 6, 5,
+    8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 13, 13, 13, 13, 13, 13,
+    5, 5, 5, 5, 5, 5, 7, 7, 6, 6, 5, 5, 5, 5, 6, 6,
+    6, 5, 7, 7, 7, 5, 5, 7, 7, 7, 7, 7, 7, 7, 5, 5,
+    5, 6, 6, 6, 6, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 6, 7, 7, 6, 6, 7, 7, 7, 7, 7, 7, 6, 5, 7,
+    8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 7, 7, 7, 6, 17, 17,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 0, 1, 0, 0, 0, 0, 0, 1, 0, 0,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 13, 4, 5, 5, 5,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 0, 5, 5, 5, 5, 0, 0,
+    5, 5, 5, 5, 5, 5, 5, 0, 5, 0, 5, 5, 5, 5, 0, 0,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 0, 5, 5, 5, 5, 0, 0,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 0, 5, 5, 5, 5, 0, 0, 5, 5, 5, 5, 5, 5, 5, 0,
+    5, 0, 5, 5, 5, 5, 0, 0, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 5, 5, 5, 0, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 0, 5, 5, 5, 5, 0, 0, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 0, 0, 6, 6, 6,
+    13, 13, 13, 13, 13, 13, 13, 13, 13, 10, 10, 10, 10, 10, 10, 10,
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 0, 0, 0,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 0, 0, 0, 0, 0, 0,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    11, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 13, 13, 5,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    0, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 0, 0, 0, 0, 0,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 13, 13, 13, 9, 9,
+    9, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 0, 5, 5,
+    5, 5, 6, 6, 6, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 6, 6, 6, 13, 13, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 6, 6, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 0, 5, 5,
+    5, 0, 6, 6, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 6, 6, 7, 6, 6, 6, 6, 6, 6, 6, 7, 7,
+    7, 7, 7, 7, 7, 7, 6, 7, 7, 6, 6, 6, 6, 6, 6, 6,
+    6, 6, 6, 6, 13, 13, 13, 4, 13, 13, 13, 14, 5, 6, 0, 0,
+    8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 0, 0, 0, 0, 0, 0,
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 0, 0, 0, 0, 0, 0,
+    13, 13, 13, 13, 13, 13, 11, 13, 13, 13, 13, 6, 6, 6, 0, 0,
+    8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 0, 0, 0, 0, 0, 0,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 4, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 5, 5, 5, 5, 0, 0, 0, 0, 0, 0, 0, 0,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 6, 5, 0, 0, 0, 0, 0,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 5, 5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 0, 0, 0,
+    6, 6, 6, 7, 7, 7, 7, 6, 6, 7, 7, 7, 0, 0, 0, 0,
+    7, 7, 6, 7, 7, 7, 7, 7, 7, 6, 6, 6, 0, 0, 0, 0,
+    17, 0, 0, 0, 13, 13, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 0, 0,
+    5, 5, 5, 5, 5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 0, 0, 0, 0,
+    7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+    7, 5, 5, 5, 5, 5, 5, 5, 7, 7, 0, 0, 0, 0, 0, 0,
+    8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 10, 0, 0, 0, 17, 17,
+    17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+    17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 5, 5, 5, 6, 6, 7, 7, 7, 0, 0, 13, 13,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 5, 7, 6, 7, 6, 6, 6, 6, 6, 6, 6, 0,
+    6, 7, 6, 7, 7, 6, 6, 6, 6, 6, 6, 6, 6, 7, 7, 7,
+    7, 7, 7, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 0, 0, 6,
+    8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 0, 0, 0, 0, 0, 0,
+    8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 0, 0, 0, 0, 0, 0,
+    13, 13, 13, 13, 13, 13, 13, 4, 13, 13, 13, 13, 13, 13, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    6, 6, 6, 6, 7, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 6, 7, 6, 6, 6, 6, 6, 7, 6, 7, 7, 7,
+    7, 7, 6, 7, 7, 5, 5, 5, 5, 5, 5, 5, 0, 0, 0, 0,
+    8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 13, 13, 13, 13, 13, 13,
+    13, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 6, 6, 6, 6, 6,
+    6, 6, 6, 6, 17, 17, 17, 17, 17, 17, 17, 17, 17, 0, 0, 0,
+    6, 6, 7, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 7, 6, 6, 6, 6, 7, 7, 6, 6, 7, 6, 7, 7, 5, 5,
+    8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 5, 5, 6, 7, 6, 6, 7, 7, 7, 6, 7, 6,
+    6, 6, 7, 7, 0, 0, 0, 0, 0, 0, 0, 0, 13, 13, 13, 13,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 7, 7, 7, 7, 7, 7, 7, 7, 6, 6, 6, 6,
+    6, 6, 6, 6, 7, 7, 6, 6, 0, 0, 0, 13, 13, 13, 13, 13,
+    8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 0, 0, 0, 5, 5, 5,
+    8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 5, 5, 5, 5, 4, 4, 4, 4, 4, 4, 13, 13,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    13, 13, 13, 13, 13, 13, 13, 13, 0, 0, 0, 0, 0, 0, 0, 0,
+    6, 6, 6, 13, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+    6, 7, 6, 6, 6, 6, 6, 6, 6, 5, 5, 5, 5, 6, 5, 5,
+    5, 5, 7, 7, 6, 5, 5, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 4, 4, 4, 4,
+    4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 4, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 4, 4, 4, 4, 4,
+    4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+    6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+    6, 6, 6, 6, 6, 6, 6, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 6, 6, 6, 6,
+    1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2,
+    1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2,
+    1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2,
+    1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2,
+    1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2,
+    1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2,
+    1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2,
+    1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2,
+    1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2,
+    1, 2, 1, 2, 1, 2, 2, 2, 2, 2, 2, 2, 2, 2, 1, 2,
+    1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2,
+    1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2,
+    1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2,
+    1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2,
+    1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2,
+    1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 1, 1, 1, 1, 1, 1, 1, 1,
+    2, 2, 2, 2, 2, 2, 0, 0, 1, 1, 1, 1, 1, 1, 0, 0,
+    2, 2, 2, 2, 2, 2, 2, 2, 1, 1, 1, 1, 1, 1, 1, 1,
+    2, 2, 2, 2, 2, 2, 2, 2, 1, 1, 1, 1, 1, 1, 1, 1,
+    2, 2, 2, 2, 2, 2, 0, 0, 1, 1, 1, 1, 1, 1, 0, 0,
+    2, 2, 2, 2, 2, 2, 2, 2, 0, 1, 0, 1, 0, 1, 0, 1,
+    2, 2, 2, 2, 2, 2, 2, 2, 1, 1, 1, 1, 1, 1, 1, 1,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 0, 0,
+    2, 2, 2, 2, 2, 2, 2, 2, 3, 3, 3, 3, 3, 3, 3, 3,
+    2, 2, 2, 2, 2, 2, 2, 2, 3, 3, 3, 3, 3, 3, 3, 3,
+    2, 2, 2, 2, 2, 2, 2, 2, 3, 3, 3, 3, 3, 3, 3, 3,
+    2, 2, 2, 2, 2, 0, 2, 2, 1, 1, 1, 1, 3, 16, 2, 16,
+    16, 16, 2, 2, 2, 0, 2, 2, 1, 1, 1, 1, 3, 16, 16, 16,
+    2, 2, 2, 2, 0, 0, 2, 2, 1, 1, 1, 1, 0, 16, 16, 16,
+    2, 2, 2, 2, 2, 2, 2, 2, 1, 1, 1, 1, 1, 16, 16, 16,
+    0, 0, 2, 2, 2, 0, 2, 2, 1, 1, 1, 1, 3, 16, 16, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    11, 11, 11, 11, 11, 11, 13, 13, 0, 0, 0, 0, 0, 0, 0, 0,
+    13, 13, 13, 13, 13, 13, 13, 13, 0, 0, 0, 0, 0, 0, 0, 0,
+    13, 13, 13, 13, 13, 13, 13, 13, 13, 0, 0, 13, 13, 13, 13, 12,
+    12, 13, 13, 13, 15, 0, 0, 13, 13, 13, 13, 13, 13, 13, 13, 13,
+    13, 13, 15, 13, 12, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    10, 4, 0, 0, 10, 10, 10, 10, 10, 10, 15, 15, 15, 0, 0, 4,
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 15, 15, 15, 0, 0, 0,
+    4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 0, 0, 0,
+    14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14,
+    14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 0, 0, 0,
+    0, 6, 0, 0, 0, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+    6, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    17, 17, 1, 17, 17, 17, 17, 1, 17, 17, 2, 1, 1, 1, 2, 2,
+    1, 1, 1, 2, 17, 1, 17, 17, 15, 1, 1, 1, 1, 1, 17, 17,
+    17, 17, 17, 17, 1, 17, 1, 17, 1, 17, 1, 1, 1, 1, 17, 2,
+    1, 1, 1, 1, 2, 5, 5, 5, 5, 2, 17, 17, 2, 2, 1, 1,
+    15, 15, 15, 15, 15, 1, 2, 2, 2, 2, 17, 15, 17, 17, 2, 17,
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+    9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9,
+    9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9,
+    9, 9, 9, 1, 2, 9, 9, 9, 9, 10, 0, 0, 0, 0, 0, 0,
+    15, 15, 15, 15, 15, 17, 17, 17, 17, 17, 15, 15, 17, 17, 17, 17,
+    15, 17, 17, 15, 17, 17, 15, 17, 17, 17, 17, 17, 17, 17, 15, 17,
+    17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+    17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 15, 15,
+    17, 17, 15, 17, 15, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+    17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+    17, 17, 17, 17, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15,
+    15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15,
+    15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15,
+    15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15,
+    15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15,
+    15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15,
+    15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15,
+    15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15,
+    15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15,
+    17, 17, 17, 17, 17, 17, 17, 17, 15, 15, 15, 15, 17, 17, 17, 17,
+    17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+    15, 15, 17, 17, 17, 17, 17, 17, 17, 0, 0, 17, 17, 17, 17, 17,
+    17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+    17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+    17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+    17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+    17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 15, 17, 17, 17,
+    17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+    17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 15, 15, 15, 15, 15,
+    15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15,
+    15, 15, 15, 15, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+    17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+    17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 15, 15, 15, 15,
+    15, 15, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+    17, 17, 17, 17, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+    17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+    17, 17, 17, 17, 17, 17, 17, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 17, 17, 17, 17,
+    17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+    17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+    17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+    17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+    17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 10, 10, 10, 10, 10, 10,
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+    17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+    17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+    17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+    17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+    17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+    17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+    17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+    17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+    17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+    17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+    17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+    17, 17, 17, 17, 17, 17, 17, 15, 17, 17, 17, 17, 17, 17, 17, 17,
+    17, 15, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+    17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+    17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+    17, 17, 17, 17, 17, 17, 17, 17, 15, 15, 15, 15, 15, 15, 15, 15,
+    17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+    17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+    17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+    17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+    17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+    17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+    17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 15,
+    17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+    0, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+    17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+    17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+    17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+    17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+    17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+    17, 17, 17, 17, 17, 17, 17, 17, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+    10, 10, 10, 10, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+    17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+    17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+    15, 15, 15, 15, 15, 0, 0, 15, 15, 15, 15, 15, 15, 15, 15, 15,
+    15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15,
+    15, 15, 15, 15, 15, 15, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15,
+    15, 15, 15, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 15, 15, 15, 15, 15, 15, 15,
+    15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15,
+    15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15,
+    15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15,
+    15, 15, 15, 15, 15, 15, 15, 15, 0, 0, 0, 0, 15, 15, 15, 15,
+    15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15,
+    15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 0, 0, 15, 15,
+    17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+    17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+    17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+    15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15,
+    15, 15, 15, 15, 15, 17, 17, 15, 15, 15, 15, 15, 15, 0, 0, 0,
+    17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 0,
+    1, 2, 1, 1, 1, 2, 2, 1, 2, 1, 2, 1, 2, 1, 1, 1,
+    1, 2, 1, 2, 2, 1, 2, 2, 2, 2, 2, 2, 4, 4, 1, 1,
+    1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2,
+    1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2,
+    1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2,
+    1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2,
+    1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2,
+    1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2,
+    1, 2, 1, 2, 2, 17, 17, 17, 17, 17, 17, 1, 2, 1, 2, 6,
+    6, 6, 1, 2, 0, 0, 0, 0, 0, 13, 13, 13, 13, 10, 13, 13,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 0, 2, 0, 0, 0, 0, 0, 2, 0, 0,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 5, 5, 5, 5, 0, 0, 0, 0, 0, 0, 0, 4,
+    13, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 6,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 5, 5, 5, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    5, 5, 5, 5, 5, 5, 5, 0, 5, 5, 5, 5, 5, 5, 5, 0,
+    5, 5, 5, 5, 5, 5, 5, 0, 5, 5, 5, 5, 5, 5, 5, 0,
+    5, 5, 5, 5, 5, 5, 5, 0, 5, 5, 5, 5, 5, 5, 5, 0,
+    5, 5, 5, 5, 5, 5, 5, 0, 5, 5, 5, 5, 5, 5, 5, 0,
+    6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+    6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+    13, 13, 0, 0, 0, 0, 13, 13, 13, 0, 0, 13, 0, 0, 13, 13,
+    13, 13, 13, 13, 13, 13, 13, 11, 13, 13, 11, 13, 0, 0, 13, 13,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 13, 13, 13, 13, 13, 4,
+    13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 11, 11, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+    17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 0, 17, 17, 17, 17, 17,
+    17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+    17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+    17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+    17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+    17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+    17, 17, 17, 17, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+    17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+    17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+    17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+    17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+    17, 17, 17, 17, 17, 17, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 0, 0, 0, 0,
+    0, 13, 13, 13, 17, 4, 5, 9, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 17, 17, 0, 0, 0, 0, 0, 0, 0, 0, 11, 0, 0, 0,
+    17, 9, 9, 9, 9, 9, 9, 9, 9, 9, 6, 6, 6, 6, 7, 7,
+    11, 4, 4, 4, 4, 4, 17, 17, 9, 9, 9, 4, 5, 13, 17, 17,
+    0, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 5, 5, 5, 0, 0, 6, 6, 16, 16, 4, 4, 5,
+    11, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 13, 4, 4, 4, 5,
+    0, 0, 0, 0, 0, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 0, 0,
+    0, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 0,
+    17, 17, 10, 10, 10, 10, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 0, 0, 0, 0, 0,
+    17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+    17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+    17, 17, 17, 17, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+    17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 0,
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 17, 17, 17, 17, 17, 17,
+    17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+    17, 17, 17, 17, 17, 17, 17, 17, 10, 10, 10, 10, 10, 10, 10, 10,
+    17, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+    17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+    17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 17, 17, 17, 17, 17, 17,
+    17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+    17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+    17, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+    17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+    17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+    17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+    17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 0,
+    5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+    17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+    17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+    17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 5, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 5, 4, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 0, 0, 0,
+    17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+    17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+    17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+    17, 17, 17, 17, 17, 17, 17, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 5, 5, 5, 5, 4, 4, 4, 4, 4, 4, 13, 13,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 4, 13, 13, 13,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 5, 5, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2,
+    1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2,
+    1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 5, 6,
+    0, 0, 0, 13, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 13, 4,
+    1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2,
+    1, 2, 1, 2, 1, 2, 1, 2, 0, 0, 0, 0, 0, 0, 0, 6,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 5, 5, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9,
+    6, 6, 13, 13, 13, 13, 13, 13, 0, 0, 0, 0, 0, 0, 0, 0,
+    16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,
+    16, 16, 16, 16, 16, 16, 16, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    16, 16, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2,
+    2, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2,
+    1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2,
+    1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2,
+    1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2,
+    4, 2, 2, 2, 2, 2, 2, 2, 2, 1, 2, 1, 2, 1, 1, 2,
+    1, 2, 1, 2, 1, 2, 1, 2, 4, 16, 16, 1, 2, 1, 2, 0,
+    1, 2, 1, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 4, 4, 2, 5, 5, 5, 5, 5,
+    5, 5, 6, 5, 5, 5, 6, 5, 5, 5, 5, 6, 5, 5, 5, 5,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 7, 7, 6, 6, 7, 17, 17, 17, 17, 0, 0, 0, 0,
+    10, 10, 10, 10, 10, 10, 17, 17, 14, 17, 0, 0, 0, 0, 0, 0,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 13, 13, 13, 13, 0, 0, 0, 0, 0, 0, 0, 0,
+    7, 7, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+    7, 7, 7, 7, 6, 0, 0, 0, 0, 0, 0, 0, 0, 0, 13, 13,
+    8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 0, 0, 0, 0, 0, 0,
+    6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+    6, 6, 5, 5, 5, 5, 5, 5, 13, 13, 13, 5, 0, 0, 0, 0,
+    8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 5, 5, 6, 6, 6, 6, 6, 6, 6, 6, 13, 13,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 5, 5, 5, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+    6, 6, 7, 7, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 13,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 0, 0, 0,
+    6, 6, 6, 7, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 6, 7, 7, 6, 6, 6, 6, 7, 7, 6, 7, 7, 7,
+    7, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 0, 4,
+    8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 0, 0, 0, 0, 13, 13,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 6, 6, 6, 6, 6, 6, 7,
+    7, 6, 6, 7, 7, 6, 6, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    5, 5, 5, 6, 5, 5, 5, 5, 5, 5, 5, 5, 6, 7, 0, 0,
+    8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 0, 0, 13, 13, 13, 13,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    4, 5, 5, 5, 5, 5, 5, 17, 17, 17, 5, 7, 0, 0, 0, 0,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    6, 5, 6, 6, 6, 5, 5, 6, 6, 5, 5, 5, 5, 5, 6, 6,
+    5, 6, 5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 5, 5, 4, 13, 13,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 7, 6, 6, 7, 7,
+    13, 13, 5, 4, 4, 7, 6, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 5, 5, 5, 5, 5, 5, 0, 0, 5, 5, 5, 5, 5, 5, 0,
+    0, 5, 5, 5, 5, 5, 5, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    5, 5, 5, 5, 5, 5, 5, 0, 5, 5, 5, 5, 5, 5, 5, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 7, 7, 6, 7, 7, 6, 7, 7, 13, 7, 6, 0, 0,
+    8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 5, 5, 5, 0, 0, 0, 0, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 0, 0, 0, 0,
+    18, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 18,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 0, 0,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    2, 2, 2, 2, 2, 2, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 2, 2, 2, 2, 2, 0, 0, 0, 0, 0, 5, 6, 5,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 15, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 5, 5, 5, 0, 5, 5, 5, 5, 5, 0, 5, 0,
+    5, 5, 0, 5, 5, 0, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,
+    16, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    0, 0, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 5, 5, 5, 5, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 14, 17, 0, 0,
+    6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+    13, 13, 13, 13, 13, 13, 13, 0, 0, 13, 0, 0, 0, 0, 0, 0,
+    6, 6, 6, 6, 6, 6, 6, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    13, 11, 11, 12, 12, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 13, 13, 0, 0, 13, 13, 13, 13, 12, 12, 12,
+    13, 13, 13, 0, 13, 13, 13, 13, 11, 0, 0, 0, 0, 0, 0, 13,
+    13, 13, 15, 11, 15, 15, 15, 0, 13, 14, 13, 13, 0, 0, 0, 0,
+    5, 5, 5, 5, 5, 0, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 0, 0, 0,
+    0, 13, 13, 13, 14, 13, 13, 13, 0, 0, 13, 15, 13, 11, 13, 13,
+    8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 13, 13, 15, 15, 15, 13,
+    13, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 13, 0, 16, 12,
+    16, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 0, 15, 0, 15, 0,
+    0, 13, 0, 0, 13, 13, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    4, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 4, 4,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 0,
+    0, 0, 5, 5, 5, 5, 5, 5, 0, 0, 5, 5, 5, 5, 5, 5,
+    0, 0, 5, 5, 5, 5, 5, 5, 0, 0, 5, 5, 5, 0, 0, 0,
+    14, 14, 15, 16, 17, 14, 14, 0, 17, 15, 15, 15, 15, 17, 17, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 17, 17, 0, 0,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 0, 5, 5, 5,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 5, 5, 5, 0, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 0, 5, 5, 0, 5,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 0, 0,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 0, 0, 0, 0, 0,
+    13, 13, 13, 0, 0, 0, 0, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+    10, 10, 10, 10, 0, 0, 0, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+    9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9,
+    9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9,
+    9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9,
+    9, 9, 9, 9, 9, 10, 10, 10, 10, 17, 17, 17, 17, 17, 17, 17,
+    17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 10, 0, 0, 0, 0, 0,
+    17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+    17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+    17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 6, 0, 0,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 0, 0, 0,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 0,
+    10, 10, 10, 10, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 9, 5, 5, 5, 5, 5, 5, 5, 5, 9, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 0, 13,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 0, 0, 0, 0, 5, 5, 5, 5, 5, 5, 5, 5,
+    13, 9, 9, 9, 9, 9, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 0, 0,
+    8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    5, 5, 5, 5, 5, 5, 0, 0, 5, 0, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 5, 5, 0, 5, 5, 0, 0, 0, 5, 0, 0, 5,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 5, 5, 0, 13, 10, 10, 10, 10, 10, 10, 10, 10,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 5, 5, 10, 10, 10, 10, 10, 10, 0, 0, 0, 13,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 0, 0, 0, 0, 0, 13,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 5, 5, 5, 5, 0, 0, 0, 0, 0, 0, 5, 5,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    5, 6, 6, 6, 0, 6, 6, 0, 0, 0, 0, 0, 6, 6, 6, 6,
+    5, 5, 5, 5, 0, 5, 5, 5, 0, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 0, 0, 0, 0, 6, 6, 6, 0, 0, 0, 0, 6,
+    10, 10, 10, 10, 10, 10, 10, 10, 0, 0, 0, 0, 0, 0, 0, 0,
+    13, 13, 13, 13, 13, 13, 13, 13, 13, 0, 0, 0, 0, 0, 0, 0,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 10, 10, 13,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 5, 5, 0, 0, 0, 13, 13, 13, 13, 13, 13, 13,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 5, 5, 0, 0, 10, 10, 10, 10, 10, 10, 10, 10,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 0, 0, 0, 0, 0, 10, 10, 10, 10, 10, 10, 10, 10,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 0,
+    7, 6, 7, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 5, 5, 5, 5, 6, 6, 6, 6, 6, 6, 6, 6,
+    6, 6, 6, 6, 6, 6, 6, 13, 13, 13, 13, 13, 13, 13, 0, 0,
+    0, 0, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+    10, 10, 10, 10, 10, 10, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    6, 6, 7, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    7, 7, 7, 6, 6, 6, 6, 7, 7, 6, 6, 13, 13, 0, 13, 13,
+    13, 13, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 0, 0, 0, 0, 0, 0, 0,
+    8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 0, 0, 0, 0, 0, 0,
+    6, 6, 6, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 5, 5, 5, 6, 6, 6, 6, 6, 7, 6, 6, 6,
+    6, 6, 6, 6, 6, 0, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8,
+    13, 13, 13, 13, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    6, 6, 7, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 7, 7, 7, 6, 6, 6, 6, 6, 6, 6, 6, 6, 7,
+    7, 5, 5, 5, 5, 13, 13, 13, 13, 0, 0, 0, 0, 0, 0, 0,
+    8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 6, 7, 6, 7, 7,
+    6, 6, 6, 6, 6, 6, 7, 6, 0, 0, 0, 0, 0, 0, 0, 0,
+    8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9,
+    9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9,
+    9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9,
+    9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9,
+    9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9,
+    9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9,
+    9, 9, 9, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    13, 13, 13, 13, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    5, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+    7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+    7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 6,
+    6, 6, 6, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    5, 5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+    17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+    17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+    17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+    17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+    17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+    17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+    17, 17, 17, 17, 17, 17, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+    17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+    17, 17, 17, 17, 17, 17, 17, 0, 0, 17, 17, 17, 17, 17, 17, 17,
+    17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+    17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+    17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+    17, 17, 17, 17, 17, 7, 7, 6, 6, 6, 17, 17, 17, 7, 7, 7,
+    7, 7, 7, 0, 0, 0, 0, 0, 0, 0, 0, 6, 6, 6, 6, 6,
+    6, 6, 6, 17, 17, 6, 6, 6, 6, 6, 6, 6, 17, 17, 17, 17,
+    17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+    17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 6, 6, 6, 6, 17, 17,
+    17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+    17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+    17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+    17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+    17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+    17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+    17, 17, 6, 6, 6, 17, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+    17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+    17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+    17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+    17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+    17, 17, 17, 17, 17, 17, 17, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+    10, 10, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 2, 2,
+    2, 2, 2, 2, 2, 0, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 1, 0, 1, 1,
+    0, 0, 1, 0, 0, 1, 1, 0, 0, 1, 1, 1, 1, 0, 1, 1,
+    1, 1, 1, 1, 1, 1, 2, 2, 2, 2, 0, 2, 0, 2, 2, 2,
+    2, 2, 2, 2, 0, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 1, 1, 0, 1, 1, 1, 1, 0, 0, 1, 1, 1,
+    1, 1, 1, 1, 1, 0, 1, 1, 1, 1, 1, 1, 1, 0, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 1, 1, 0, 1, 1, 1, 1, 0,
+    1, 1, 1, 1, 1, 0, 1, 0, 0, 0, 1, 1, 1, 1, 1, 1,
+    1, 0, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 0, 0, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 15, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 15, 2, 2, 2, 2,
+    2, 2, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 15, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 15, 2, 2, 2, 2, 2, 2, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 15, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 15,
+    2, 2, 2, 2, 2, 2, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 15,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 15, 2, 2, 2, 2, 2, 2,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 15, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 15, 2, 2, 2, 2, 2, 2, 1, 2, 0, 0, 8, 8,
+    8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8,
+    8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8,
+    8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8,
+    5, 5, 5, 5, 0, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    0, 5, 5, 0, 5, 0, 0, 5, 0, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 0, 5, 5, 5, 5, 0, 5, 0, 5, 0, 0, 0, 0,
+    0, 0, 5, 0, 0, 0, 0, 5, 0, 5, 0, 5, 0, 5, 5, 5,
+    0, 5, 5, 0, 5, 0, 0, 5, 0, 5, 0, 5, 0, 5, 0, 5,
+    0, 5, 5, 0, 5, 0, 0, 5, 5, 5, 5, 0, 5, 5, 5, 5,
+    5, 5, 5, 0, 5, 5, 5, 5, 0, 5, 5, 5, 5, 0, 5, 0,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 0, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 0, 0, 0, 0,
+    0, 5, 5, 5, 0, 5, 5, 5, 5, 5, 0, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    15, 15, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+    17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+    17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 0, 0, 0, 0,
+    17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+    17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+    17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+    17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+    17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+    17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+    17, 17, 17, 17, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 0,
+    0, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 0,
+    0, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+    0, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 0, 0, 0, 0, 0,
+    17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+    17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 0,
+    17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+    17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+    17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+    17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 0, 0, 0, 0,
+    17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+    17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+    17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+    17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+    17, 17, 17, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+    17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+    17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 0, 0, 0, 0, 0,
+    17, 17, 17, 17, 17, 17, 17, 17, 17, 0, 0, 0, 0, 0, 0, 0,
+    17, 17, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+    17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+    17, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    17, 17, 17, 17, 17, 17, 0, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+    17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+    17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+    17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+    17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 0, 0, 0,
+    17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+    17, 17, 17, 17, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+    17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+    17, 17, 17, 17, 17, 0, 17, 17, 17, 17, 17, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+    17, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+    17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+    17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+    17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 0,
+    17, 0, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+    17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+    17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+    17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+    17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+    17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+    17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+    17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+    17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+    17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+    17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+    17, 17, 17, 17, 17, 17, 17, 17, 0, 17, 17, 17, 17, 0, 0, 0,
+    17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+    17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+    17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+    17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 0, 0,
+    17, 17, 17, 17, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+    17, 17, 17, 17, 17, 17, 17, 17, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 17, 17, 17, 17, 17,
+    17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+    17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+    17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+    17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+    17, 0, 0, 0, 0, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+    17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+    17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+    17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+    17, 17, 17, 17, 17, 17, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+    17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+    17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+    17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+    17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+    17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+    17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+    17, 17, 17, 17, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 5, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 5, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+    6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+    6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+    6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+    6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+    6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+    6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+    6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+    6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+    6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+    6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+    6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+    6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+    6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+    6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 18, 0, 0,
 };
+
 int
-esch_unicode_is_range_co(esch_unicode ch)
-{
-    size_t n = 0;
-    for (; n < sizeof(esch_unicode_range_co_up_bound) / sizeof(esch_unicode); ++n)
-    {
-        if (ch >= esch_unicode_range_co_low_bound[n] && ch <= esch_unicode_range_co_up_bound[n])
-            return 1;
-    }
-    return 0;
-}
-#include "esch.h"
-static int
-esch_unicode_range_ll_low_bound[] = 
-{
-    0x61, 
-    0xb5, 
-    0xdf, 
-    0xf8, 
-    0x101, 
-    0x103, 
-    0x105, 
-    0x107, 
-    0x109, 
-    0x10b, 
-    0x10d, 
-    0x10f, 
-    0x111, 
-    0x113, 
-    0x115, 
-    0x117, 
-    0x119, 
-    0x11b, 
-    0x11d, 
-    0x11f, 
-    0x121, 
-    0x123, 
-    0x125, 
-    0x127, 
-    0x129, 
-    0x12b, 
-    0x12d, 
-    0x12f, 
-    0x131, 
-    0x133, 
-    0x135, 
-    0x137, 
-    0x13a, 
-    0x13c, 
-    0x13e, 
-    0x140, 
-    0x142, 
-    0x144, 
-    0x146, 
-    0x148, 
-    0x14b, 
-    0x14d, 
-    0x14f, 
-    0x151, 
-    0x153, 
-    0x155, 
-    0x157, 
-    0x159, 
-    0x15b, 
-    0x15d, 
-    0x15f, 
-    0x161, 
-    0x163, 
-    0x165, 
-    0x167, 
-    0x169, 
-    0x16b, 
-    0x16d, 
-    0x16f, 
-    0x171, 
-    0x173, 
-    0x175, 
-    0x177, 
-    0x17a, 
-    0x17c, 
-    0x17e, 
-    0x183, 
-    0x185, 
-    0x188, 
-    0x18c, 
-    0x192, 
-    0x195, 
-    0x199, 
-    0x19e, 
-    0x1a1, 
-    0x1a3, 
-    0x1a5, 
-    0x1a8, 
-    0x1aa, 
-    0x1ad, 
-    0x1b0, 
-    0x1b4, 
-    0x1b6, 
-    0x1b9, 
-    0x1bd, 
-    0x1c6, 
-    0x1c9, 
-    0x1cc, 
-    0x1ce, 
-    0x1d0, 
-    0x1d2, 
-    0x1d4, 
-    0x1d6, 
-    0x1d8, 
-    0x1da, 
-    0x1dc, 
-    0x1df, 
-    0x1e1, 
-    0x1e3, 
-    0x1e5, 
-    0x1e7, 
-    0x1e9, 
-    0x1eb, 
-    0x1ed, 
-    0x1ef, 
-    0x1f3, 
-    0x1f5, 
-    0x1f9, 
-    0x1fb, 
-    0x1fd, 
-    0x1ff, 
-    0x201, 
-    0x203, 
-    0x205, 
-    0x207, 
-    0x209, 
-    0x20b, 
-    0x20d, 
-    0x20f, 
-    0x211, 
-    0x213, 
-    0x215, 
-    0x217, 
-    0x219, 
-    0x21b, 
-    0x21d, 
-    0x21f, 
-    0x221, 
-    0x223, 
-    0x225, 
-    0x227, 
-    0x229, 
-    0x22b, 
-    0x22d, 
-    0x22f, 
-    0x231, 
-    0x233, 
-    0x23c, 
-    0x23f, 
-    0x242, 
-    0x247, 
-    0x249, 
-    0x24b, 
-    0x24d, 
-    0x24f, 
-    0x295, 
-    0x371, 
-    0x373, 
-    0x377, 
-    0x37b, 
-    0x390, 
-    0x3ac, 
-    0x3d0, 
-    0x3d5, 
-    0x3d9, 
-    0x3db, 
-    0x3dd, 
-    0x3df, 
-    0x3e1, 
-    0x3e3, 
-    0x3e5, 
-    0x3e7, 
-    0x3e9, 
-    0x3eb, 
-    0x3ed, 
-    0x3ef, 
-    0x3f5, 
-    0x3f8, 
-    0x3fb, 
-    0x430, 
-    0x461, 
-    0x463, 
-    0x465, 
-    0x467, 
-    0x469, 
-    0x46b, 
-    0x46d, 
-    0x46f, 
-    0x471, 
-    0x473, 
-    0x475, 
-    0x477, 
-    0x479, 
-    0x47b, 
-    0x47d, 
-    0x47f, 
-    0x481, 
-    0x48b, 
-    0x48d, 
-    0x48f, 
-    0x491, 
-    0x493, 
-    0x495, 
-    0x497, 
-    0x499, 
-    0x49b, 
-    0x49d, 
-    0x49f, 
-    0x4a1, 
-    0x4a3, 
-    0x4a5, 
-    0x4a7, 
-    0x4a9, 
-    0x4ab, 
-    0x4ad, 
-    0x4af, 
-    0x4b1, 
-    0x4b3, 
-    0x4b5, 
-    0x4b7, 
-    0x4b9, 
-    0x4bb, 
-    0x4bd, 
-    0x4bf, 
-    0x4c2, 
-    0x4c4, 
-    0x4c6, 
-    0x4c8, 
-    0x4ca, 
-    0x4cc, 
-    0x4ce, 
-    0x4d1, 
-    0x4d3, 
-    0x4d5, 
-    0x4d7, 
-    0x4d9, 
-    0x4db, 
-    0x4dd, 
-    0x4df, 
-    0x4e1, 
-    0x4e3, 
-    0x4e5, 
-    0x4e7, 
-    0x4e9, 
-    0x4eb, 
-    0x4ed, 
-    0x4ef, 
-    0x4f1, 
-    0x4f3, 
-    0x4f5, 
-    0x4f7, 
-    0x4f9, 
-    0x4fb, 
-    0x4fd, 
-    0x4ff, 
-    0x501, 
-    0x503, 
-    0x505, 
-    0x507, 
-    0x509, 
-    0x50b, 
-    0x50d, 
-    0x50f, 
-    0x511, 
-    0x513, 
-    0x515, 
-    0x517, 
-    0x519, 
-    0x51b, 
-    0x51d, 
-    0x51f, 
-    0x521, 
-    0x523, 
-    0x525, 
-    0x527, 
-    0x561, 
-    0x1d00, 
-    0x1d6b, 
-    0x1d79, 
-    0x1e01, 
-    0x1e03, 
-    0x1e05, 
-    0x1e07, 
-    0x1e09, 
-    0x1e0b, 
-    0x1e0d, 
-    0x1e0f, 
-    0x1e11, 
-    0x1e13, 
-    0x1e15, 
-    0x1e17, 
-    0x1e19, 
-    0x1e1b, 
-    0x1e1d, 
-    0x1e1f, 
-    0x1e21, 
-    0x1e23, 
-    0x1e25, 
-    0x1e27, 
-    0x1e29, 
-    0x1e2b, 
-    0x1e2d, 
-    0x1e2f, 
-    0x1e31, 
-    0x1e33, 
-    0x1e35, 
-    0x1e37, 
-    0x1e39, 
-    0x1e3b, 
-    0x1e3d, 
-    0x1e3f, 
-    0x1e41, 
-    0x1e43, 
-    0x1e45, 
-    0x1e47, 
-    0x1e49, 
-    0x1e4b, 
-    0x1e4d, 
-    0x1e4f, 
-    0x1e51, 
-    0x1e53, 
-    0x1e55, 
-    0x1e57, 
-    0x1e59, 
-    0x1e5b, 
-    0x1e5d, 
-    0x1e5f, 
-    0x1e61, 
-    0x1e63, 
-    0x1e65, 
-    0x1e67, 
-    0x1e69, 
-    0x1e6b, 
-    0x1e6d, 
-    0x1e6f, 
-    0x1e71, 
-    0x1e73, 
-    0x1e75, 
-    0x1e77, 
-    0x1e79, 
-    0x1e7b, 
-    0x1e7d, 
-    0x1e7f, 
-    0x1e81, 
-    0x1e83, 
-    0x1e85, 
-    0x1e87, 
-    0x1e89, 
-    0x1e8b, 
-    0x1e8d, 
-    0x1e8f, 
-    0x1e91, 
-    0x1e93, 
-    0x1e95, 
-    0x1e9f, 
-    0x1ea1, 
-    0x1ea3, 
-    0x1ea5, 
-    0x1ea7, 
-    0x1ea9, 
-    0x1eab, 
-    0x1ead, 
-    0x1eaf, 
-    0x1eb1, 
-    0x1eb3, 
-    0x1eb5, 
-    0x1eb7, 
-    0x1eb9, 
-    0x1ebb, 
-    0x1ebd, 
-    0x1ebf, 
-    0x1ec1, 
-    0x1ec3, 
-    0x1ec5, 
-    0x1ec7, 
-    0x1ec9, 
-    0x1ecb, 
-    0x1ecd, 
-    0x1ecf, 
-    0x1ed1, 
-    0x1ed3, 
-    0x1ed5, 
-    0x1ed7, 
-    0x1ed9, 
-    0x1edb, 
-    0x1edd, 
-    0x1edf, 
-    0x1ee1, 
-    0x1ee3, 
-    0x1ee5, 
-    0x1ee7, 
-    0x1ee9, 
-    0x1eeb, 
-    0x1eed, 
-    0x1eef, 
-    0x1ef1, 
-    0x1ef3, 
-    0x1ef5, 
-    0x1ef7, 
-    0x1ef9, 
-    0x1efb, 
-    0x1efd, 
-    0x1eff, 
-    0x1f10, 
-    0x1f20, 
-    0x1f30, 
-    0x1f40, 
-    0x1f50, 
-    0x1f60, 
-    0x1f70, 
-    0x1f80, 
-    0x1f90, 
-    0x1fa0, 
-    0x1fb0, 
-    0x1fb6, 
-    0x1fbe, 
-    0x1fc2, 
-    0x1fc6, 
-    0x1fd0, 
-    0x1fd6, 
-    0x1fe0, 
-    0x1ff2, 
-    0x1ff6, 
-    0x210a, 
-    0x210e, 
-    0x2113, 
-    0x212f, 
-    0x2134, 
-    0x2139, 
-    0x213c, 
-    0x2146, 
-    0x214e, 
-    0x2184, 
-    0x2c30, 
-    0x2c61, 
-    0x2c65, 
-    0x2c68, 
-    0x2c6a, 
-    0x2c6c, 
-    0x2c71, 
-    0x2c73, 
-    0x2c76, 
-    0x2c81, 
-    0x2c83, 
-    0x2c85, 
-    0x2c87, 
-    0x2c89, 
-    0x2c8b, 
-    0x2c8d, 
-    0x2c8f, 
-    0x2c91, 
-    0x2c93, 
-    0x2c95, 
-    0x2c97, 
-    0x2c99, 
-    0x2c9b, 
-    0x2c9d, 
-    0x2c9f, 
-    0x2ca1, 
-    0x2ca3, 
-    0x2ca5, 
-    0x2ca7, 
-    0x2ca9, 
-    0x2cab, 
-    0x2cad, 
-    0x2caf, 
-    0x2cb1, 
-    0x2cb3, 
-    0x2cb5, 
-    0x2cb7, 
-    0x2cb9, 
-    0x2cbb, 
-    0x2cbd, 
-    0x2cbf, 
-    0x2cc1, 
-    0x2cc3, 
-    0x2cc5, 
-    0x2cc7, 
-    0x2cc9, 
-    0x2ccb, 
-    0x2ccd, 
-    0x2ccf, 
-    0x2cd1, 
-    0x2cd3, 
-    0x2cd5, 
-    0x2cd7, 
-    0x2cd9, 
-    0x2cdb, 
-    0x2cdd, 
-    0x2cdf, 
-    0x2ce1, 
-    0x2ce3, 
-    0x2cec, 
-    0x2cee, 
-    0x2cf3, 
-    0x2d00, 
-    0x2d27, 
-    0x2d2d, 
-    0xa641, 
-    0xa643, 
-    0xa645, 
-    0xa647, 
-    0xa649, 
-    0xa64b, 
-    0xa64d, 
-    0xa64f, 
-    0xa651, 
-    0xa653, 
-    0xa655, 
-    0xa657, 
-    0xa659, 
-    0xa65b, 
-    0xa65d, 
-    0xa65f, 
-    0xa661, 
-    0xa663, 
-    0xa665, 
-    0xa667, 
-    0xa669, 
-    0xa66b, 
-    0xa66d, 
-    0xa681, 
-    0xa683, 
-    0xa685, 
-    0xa687, 
-    0xa689, 
-    0xa68b, 
-    0xa68d, 
-    0xa68f, 
-    0xa691, 
-    0xa693, 
-    0xa695, 
-    0xa697, 
-    0xa723, 
-    0xa725, 
-    0xa727, 
-    0xa729, 
-    0xa72b, 
-    0xa72d, 
-    0xa72f, 
-    0xa733, 
-    0xa735, 
-    0xa737, 
-    0xa739, 
-    0xa73b, 
-    0xa73d, 
-    0xa73f, 
-    0xa741, 
-    0xa743, 
-    0xa745, 
-    0xa747, 
-    0xa749, 
-    0xa74b, 
-    0xa74d, 
-    0xa74f, 
-    0xa751, 
-    0xa753, 
-    0xa755, 
-    0xa757, 
-    0xa759, 
-    0xa75b, 
-    0xa75d, 
-    0xa75f, 
-    0xa761, 
-    0xa763, 
-    0xa765, 
-    0xa767, 
-    0xa769, 
-    0xa76b, 
-    0xa76d, 
-    0xa76f, 
-    0xa771, 
-    0xa77a, 
-    0xa77c, 
-    0xa77f, 
-    0xa781, 
-    0xa783, 
-    0xa785, 
-    0xa787, 
-    0xa78c, 
-    0xa78e, 
-    0xa791, 
-    0xa793, 
-    0xa7a1, 
-    0xa7a3, 
-    0xa7a5, 
-    0xa7a7, 
-    0xa7a9, 
-    0xa7fa, 
-    0xfb00, 
-    0xfb13, 
-    0xff41, 
-    0x10428, 
-    0x1d41a, 
-    0x1d44e, 
-    0x1d456, 
-    0x1d482, 
-    0x1d4b6, 
-    0x1d4bb, 
-    0x1d4bd, 
-    0x1d4c5, 
-    0x1d4ea, 
-    0x1d51e, 
-    0x1d552, 
-    0x1d586, 
-    0x1d5ba, 
-    0x1d5ee, 
-    0x1d622, 
-    0x1d656, 
-    0x1d68a, 
-    0x1d6c2, 
-    0x1d6dc, 
-    0x1d6fc, 
-    0x1d716, 
-    0x1d736, 
-    0x1d750, 
-    0x1d770, 
-    0x1d78a, 
-    0x1d7aa, 
-    0x1d7c4, 
-    0x1d7cb, 
-};
-static int
-esch_unicode_range_ll_up_bound[] = 
-{
-    0x7a, 
-    0xb5, 
-    0xf6, 
-    0xff, 
-    0x101, 
-    0x103, 
-    0x105, 
-    0x107, 
-    0x109, 
-    0x10b, 
-    0x10d, 
-    0x10f, 
-    0x111, 
-    0x113, 
-    0x115, 
-    0x117, 
-    0x119, 
-    0x11b, 
-    0x11d, 
-    0x11f, 
-    0x121, 
-    0x123, 
-    0x125, 
-    0x127, 
-    0x129, 
-    0x12b, 
-    0x12d, 
-    0x12f, 
-    0x131, 
-    0x133, 
-    0x135, 
-    0x138, 
-    0x13a, 
-    0x13c, 
-    0x13e, 
-    0x140, 
-    0x142, 
-    0x144, 
-    0x146, 
-    0x149, 
-    0x14b, 
-    0x14d, 
-    0x14f, 
-    0x151, 
-    0x153, 
-    0x155, 
-    0x157, 
-    0x159, 
-    0x15b, 
-    0x15d, 
-    0x15f, 
-    0x161, 
-    0x163, 
-    0x165, 
-    0x167, 
-    0x169, 
-    0x16b, 
-    0x16d, 
-    0x16f, 
-    0x171, 
-    0x173, 
-    0x175, 
-    0x177, 
-    0x17a, 
-    0x17c, 
-    0x180, 
-    0x183, 
-    0x185, 
-    0x188, 
-    0x18d, 
-    0x192, 
-    0x195, 
-    0x19b, 
-    0x19e, 
-    0x1a1, 
-    0x1a3, 
-    0x1a5, 
-    0x1a8, 
-    0x1ab, 
-    0x1ad, 
-    0x1b0, 
-    0x1b4, 
-    0x1b6, 
-    0x1ba, 
-    0x1bf, 
-    0x1c6, 
-    0x1c9, 
-    0x1cc, 
-    0x1ce, 
-    0x1d0, 
-    0x1d2, 
-    0x1d4, 
-    0x1d6, 
-    0x1d8, 
-    0x1da, 
-    0x1dd, 
-    0x1df, 
-    0x1e1, 
-    0x1e3, 
-    0x1e5, 
-    0x1e7, 
-    0x1e9, 
-    0x1eb, 
-    0x1ed, 
-    0x1f0, 
-    0x1f3, 
-    0x1f5, 
-    0x1f9, 
-    0x1fb, 
-    0x1fd, 
-    0x1ff, 
-    0x201, 
-    0x203, 
-    0x205, 
-    0x207, 
-    0x209, 
-    0x20b, 
-    0x20d, 
-    0x20f, 
-    0x211, 
-    0x213, 
-    0x215, 
-    0x217, 
-    0x219, 
-    0x21b, 
-    0x21d, 
-    0x21f, 
-    0x221, 
-    0x223, 
-    0x225, 
-    0x227, 
-    0x229, 
-    0x22b, 
-    0x22d, 
-    0x22f, 
-    0x231, 
-    0x239, 
-    0x23c, 
-    0x240, 
-    0x242, 
-    0x247, 
-    0x249, 
-    0x24b, 
-    0x24d, 
-    0x293, 
-    0x2af, 
-    0x371, 
-    0x373, 
-    0x377, 
-    0x37d, 
-    0x390, 
-    0x3ce, 
-    0x3d1, 
-    0x3d7, 
-    0x3d9, 
-    0x3db, 
-    0x3dd, 
-    0x3df, 
-    0x3e1, 
-    0x3e3, 
-    0x3e5, 
-    0x3e7, 
-    0x3e9, 
-    0x3eb, 
-    0x3ed, 
-    0x3f3, 
-    0x3f5, 
-    0x3f8, 
-    0x3fc, 
-    0x45f, 
-    0x461, 
-    0x463, 
-    0x465, 
-    0x467, 
-    0x469, 
-    0x46b, 
-    0x46d, 
-    0x46f, 
-    0x471, 
-    0x473, 
-    0x475, 
-    0x477, 
-    0x479, 
-    0x47b, 
-    0x47d, 
-    0x47f, 
-    0x481, 
-    0x48b, 
-    0x48d, 
-    0x48f, 
-    0x491, 
-    0x493, 
-    0x495, 
-    0x497, 
-    0x499, 
-    0x49b, 
-    0x49d, 
-    0x49f, 
-    0x4a1, 
-    0x4a3, 
-    0x4a5, 
-    0x4a7, 
-    0x4a9, 
-    0x4ab, 
-    0x4ad, 
-    0x4af, 
-    0x4b1, 
-    0x4b3, 
-    0x4b5, 
-    0x4b7, 
-    0x4b9, 
-    0x4bb, 
-    0x4bd, 
-    0x4bf, 
-    0x4c2, 
-    0x4c4, 
-    0x4c6, 
-    0x4c8, 
-    0x4ca, 
-    0x4cc, 
-    0x4cf, 
-    0x4d1, 
-    0x4d3, 
-    0x4d5, 
-    0x4d7, 
-    0x4d9, 
-    0x4db, 
-    0x4dd, 
-    0x4df, 
-    0x4e1, 
-    0x4e3, 
-    0x4e5, 
-    0x4e7, 
-    0x4e9, 
-    0x4eb, 
-    0x4ed, 
-    0x4ef, 
-    0x4f1, 
-    0x4f3, 
-    0x4f5, 
-    0x4f7, 
-    0x4f9, 
-    0x4fb, 
-    0x4fd, 
-    0x4ff, 
-    0x501, 
-    0x503, 
-    0x505, 
-    0x507, 
-    0x509, 
-    0x50b, 
-    0x50d, 
-    0x50f, 
-    0x511, 
-    0x513, 
-    0x515, 
-    0x517, 
-    0x519, 
-    0x51b, 
-    0x51d, 
-    0x51f, 
-    0x521, 
-    0x523, 
-    0x525, 
-    0x527, 
-    0x587, 
-    0x1d2b, 
-    0x1d77, 
-    0x1d9a, 
-    0x1e01, 
-    0x1e03, 
-    0x1e05, 
-    0x1e07, 
-    0x1e09, 
-    0x1e0b, 
-    0x1e0d, 
-    0x1e0f, 
-    0x1e11, 
-    0x1e13, 
-    0x1e15, 
-    0x1e17, 
-    0x1e19, 
-    0x1e1b, 
-    0x1e1d, 
-    0x1e1f, 
-    0x1e21, 
-    0x1e23, 
-    0x1e25, 
-    0x1e27, 
-    0x1e29, 
-    0x1e2b, 
-    0x1e2d, 
-    0x1e2f, 
-    0x1e31, 
-    0x1e33, 
-    0x1e35, 
-    0x1e37, 
-    0x1e39, 
-    0x1e3b, 
-    0x1e3d, 
-    0x1e3f, 
-    0x1e41, 
-    0x1e43, 
-    0x1e45, 
-    0x1e47, 
-    0x1e49, 
-    0x1e4b, 
-    0x1e4d, 
-    0x1e4f, 
-    0x1e51, 
-    0x1e53, 
-    0x1e55, 
-    0x1e57, 
-    0x1e59, 
-    0x1e5b, 
-    0x1e5d, 
-    0x1e5f, 
-    0x1e61, 
-    0x1e63, 
-    0x1e65, 
-    0x1e67, 
-    0x1e69, 
-    0x1e6b, 
-    0x1e6d, 
-    0x1e6f, 
-    0x1e71, 
-    0x1e73, 
-    0x1e75, 
-    0x1e77, 
-    0x1e79, 
-    0x1e7b, 
-    0x1e7d, 
-    0x1e7f, 
-    0x1e81, 
-    0x1e83, 
-    0x1e85, 
-    0x1e87, 
-    0x1e89, 
-    0x1e8b, 
-    0x1e8d, 
-    0x1e8f, 
-    0x1e91, 
-    0x1e93, 
-    0x1e9d, 
-    0x1e9f, 
-    0x1ea1, 
-    0x1ea3, 
-    0x1ea5, 
-    0x1ea7, 
-    0x1ea9, 
-    0x1eab, 
-    0x1ead, 
-    0x1eaf, 
-    0x1eb1, 
-    0x1eb3, 
-    0x1eb5, 
-    0x1eb7, 
-    0x1eb9, 
-    0x1ebb, 
-    0x1ebd, 
-    0x1ebf, 
-    0x1ec1, 
-    0x1ec3, 
-    0x1ec5, 
-    0x1ec7, 
-    0x1ec9, 
-    0x1ecb, 
-    0x1ecd, 
-    0x1ecf, 
-    0x1ed1, 
-    0x1ed3, 
-    0x1ed5, 
-    0x1ed7, 
-    0x1ed9, 
-    0x1edb, 
-    0x1edd, 
-    0x1edf, 
-    0x1ee1, 
-    0x1ee3, 
-    0x1ee5, 
-    0x1ee7, 
-    0x1ee9, 
-    0x1eeb, 
-    0x1eed, 
-    0x1eef, 
-    0x1ef1, 
-    0x1ef3, 
-    0x1ef5, 
-    0x1ef7, 
-    0x1ef9, 
-    0x1efb, 
-    0x1efd, 
-    0x1f07, 
-    0x1f15, 
-    0x1f27, 
-    0x1f37, 
-    0x1f45, 
-    0x1f57, 
-    0x1f67, 
-    0x1f7d, 
-    0x1f87, 
-    0x1f97, 
-    0x1fa7, 
-    0x1fb4, 
-    0x1fb7, 
-    0x1fbe, 
-    0x1fc4, 
-    0x1fc7, 
-    0x1fd3, 
-    0x1fd7, 
-    0x1fe7, 
-    0x1ff4, 
-    0x1ff7, 
-    0x210a, 
-    0x210f, 
-    0x2113, 
-    0x212f, 
-    0x2134, 
-    0x2139, 
-    0x213d, 
-    0x2149, 
-    0x214e, 
-    0x2184, 
-    0x2c5e, 
-    0x2c61, 
-    0x2c66, 
-    0x2c68, 
-    0x2c6a, 
-    0x2c6c, 
-    0x2c71, 
-    0x2c74, 
-    0x2c7b, 
-    0x2c81, 
-    0x2c83, 
-    0x2c85, 
-    0x2c87, 
-    0x2c89, 
-    0x2c8b, 
-    0x2c8d, 
-    0x2c8f, 
-    0x2c91, 
-    0x2c93, 
-    0x2c95, 
-    0x2c97, 
-    0x2c99, 
-    0x2c9b, 
-    0x2c9d, 
-    0x2c9f, 
-    0x2ca1, 
-    0x2ca3, 
-    0x2ca5, 
-    0x2ca7, 
-    0x2ca9, 
-    0x2cab, 
-    0x2cad, 
-    0x2caf, 
-    0x2cb1, 
-    0x2cb3, 
-    0x2cb5, 
-    0x2cb7, 
-    0x2cb9, 
-    0x2cbb, 
-    0x2cbd, 
-    0x2cbf, 
-    0x2cc1, 
-    0x2cc3, 
-    0x2cc5, 
-    0x2cc7, 
-    0x2cc9, 
-    0x2ccb, 
-    0x2ccd, 
-    0x2ccf, 
-    0x2cd1, 
-    0x2cd3, 
-    0x2cd5, 
-    0x2cd7, 
-    0x2cd9, 
-    0x2cdb, 
-    0x2cdd, 
-    0x2cdf, 
-    0x2ce1, 
-    0x2ce4, 
-    0x2cec, 
-    0x2cee, 
-    0x2cf3, 
-    0x2d25, 
-    0x2d27, 
-    0x2d2d, 
-    0xa641, 
-    0xa643, 
-    0xa645, 
-    0xa647, 
-    0xa649, 
-    0xa64b, 
-    0xa64d, 
-    0xa64f, 
-    0xa651, 
-    0xa653, 
-    0xa655, 
-    0xa657, 
-    0xa659, 
-    0xa65b, 
-    0xa65d, 
-    0xa65f, 
-    0xa661, 
-    0xa663, 
-    0xa665, 
-    0xa667, 
-    0xa669, 
-    0xa66b, 
-    0xa66d, 
-    0xa681, 
-    0xa683, 
-    0xa685, 
-    0xa687, 
-    0xa689, 
-    0xa68b, 
-    0xa68d, 
-    0xa68f, 
-    0xa691, 
-    0xa693, 
-    0xa695, 
-    0xa697, 
-    0xa723, 
-    0xa725, 
-    0xa727, 
-    0xa729, 
-    0xa72b, 
-    0xa72d, 
-    0xa731, 
-    0xa733, 
-    0xa735, 
-    0xa737, 
-    0xa739, 
-    0xa73b, 
-    0xa73d, 
-    0xa73f, 
-    0xa741, 
-    0xa743, 
-    0xa745, 
-    0xa747, 
-    0xa749, 
-    0xa74b, 
-    0xa74d, 
-    0xa74f, 
-    0xa751, 
-    0xa753, 
-    0xa755, 
-    0xa757, 
-    0xa759, 
-    0xa75b, 
-    0xa75d, 
-    0xa75f, 
-    0xa761, 
-    0xa763, 
-    0xa765, 
-    0xa767, 
-    0xa769, 
-    0xa76b, 
-    0xa76d, 
-    0xa76f, 
-    0xa778, 
-    0xa77a, 
-    0xa77c, 
-    0xa77f, 
-    0xa781, 
-    0xa783, 
-    0xa785, 
-    0xa787, 
-    0xa78c, 
-    0xa78e, 
-    0xa791, 
-    0xa793, 
-    0xa7a1, 
-    0xa7a3, 
-    0xa7a5, 
-    0xa7a7, 
-    0xa7a9, 
-    0xa7fa, 
-    0xfb06, 
-    0xfb17, 
-    0xff5a, 
-    0x1044f, 
-    0x1d433, 
-    0x1d454, 
-    0x1d467, 
-    0x1d49b, 
-    0x1d4b9, 
-    0x1d4bb, 
-    0x1d4c3, 
-    0x1d4cf, 
-    0x1d503, 
-    0x1d537, 
-    0x1d56b, 
-    0x1d59f, 
-    0x1d5d3, 
-    0x1d607, 
-    0x1d63b, 
-    0x1d66f, 
-    0x1d6a5, 
-    0x1d6da, 
-    0x1d6e1, 
-    0x1d714, 
-    0x1d71b, 
-    0x1d74e, 
-    0x1d755, 
-    0x1d788, 
-    0x1d78f, 
-    0x1d7c2, 
-    0x1d7c9, 
-    0x1d7cb, 
-};
-int
-esch_unicode_is_range_ll(esch_unicode ch)
+esch_unicode_get_category(esch_unicode ch)
 {
-    size_t n = 0;
-    for (; n < sizeof(esch_unicode_range_ll_up_bound) / sizeof(esch_unicode); ++n)
-    {
-        if (ch >= esch_unicode_range_ll_low_bound[n] && ch <= esch_unicode_range_ll_up_bound[n])
-            return 1;
-    }
-    return 0;
+    if (ch < 0 || ch > 0x10FFFF)
+        return ESCH_UNICODE_CATEGORY_NONE;
+    return esch_unicode_category_stage2[
+        (esch_unicode_category_stage1[ch >> ESCH_UNICODE_BLOCK_SHIFT]
+         << ESCH_UNICODE_BLOCK_SHIFT) | (ch & ESCH_UNICODE_BLOCK_MASK)];
 }
-#include "esch.h"
-static int
-esch_unicode_range_lm_low_bound[] = 
-{
-    0x2b0, 
-    0x2c6, 
-    0x2e0, 
-    0x2ec, 
-    0x2ee, 
-    0x374, 
-    0x37a, 
-    0x559, 
-    0x640, 
-    0x6e5, 
-    0x7f4, 
-    0x7fa, 
-    0x81a, 
-    0x824, 
-    0x828, 
-    0x971, 
-    0xe46, 
-    0xec6, 
-    0x10fc, 
-    0x17d7, 
-    0x1843, 
-    0x1aa7, 
-    0x1c78, 
-    0x1d2c, 
-    0x1d78, 
-    0x1d9b, 
-    0x2071, 
-    0x207f, 
-    0x2090, 
-    0x2c7c, 
-    0x2d6f, 
-    0x2e2f, 
-    0x3005, 
-    0x3031, 
-    0x303b, 
-    0x309d, 
-    0x30fc, 
-    0xa015, 
-    0xa4f8, 
-    0xa60c, 
-    0xa67f, 
-    0xa717, 
-    0xa770, 
-    0xa788, 
-    0xa7f8, 
-    0xa9cf, 
-    0xaa70, 
-    0xaadd, 
-    0xaaf3, 
-    0xff70, 
-    0xff9e, 
-    0x16f93, 
-};
-static int
-esch_unicode_range_lm_up_bound[] = 
-{
-    0x2c1, 
-    0x2d1, 
-    0x2e4, 
-    0x2ec, 
-    0x2ee, 
-    0x374, 
-    0x37a, 
-    0x559, 
-    0x640, 
-    0x6e6, 
-    0x7f5, 
-    0x7fa, 
-    0x81a, 
-    0x824, 
-    0x828, 
-    0x971, 
-    0xe46, 
-    0xec6, 
-    0x10fc, 
-    0x17d7, 
-    0x1843, 
-    0x1aa7, 
-    0x1c7d, 
-    0x1d6a, 
-    0x1d78, 
-    0x1dbf, 
-    0x2071, 
-    0x207f, 
-    0x209c, 
-    0x2c7d, 
-    0x2d6f, 
-    0x2e2f, 
-    0x3005, 
-    0x3035, 
-    0x303b, 
-    0x309e, 
-    0x30fe, 
-    0xa015, 
-    0xa4fd, 
-    0xa60c, 
-    0xa67f, 
-    0xa71f, 
-    0xa770, 
-    0xa788, 
-    0xa7f9, 
-    0xa9cf, 
-    0xaa70, 
-    0xaadd, 
-    0xaaf4, 
-    0xff70, 
-    0xff9f, 
-    0x16f9f, 
-};
 int
-esch_unicode_is_range_lm(esch_unicode ch)
+esch_unicode_is_range_lu(esch_unicode ch)
 {
-    size_t n = 0;
-    for (; n < sizeof(esch_unicode_range_lm_up_bound) / sizeof(esch_unicode); ++n)
-    {
-        if (ch >= esch_unicode_range_lm_low_bound[n] && ch <= esch_unicode_range_lm_up_bound[n])
-            return 1;
-    }
-    return 0;
+    return esch_unicode_get_category(ch) == ESCH_UNICODE_CATEGORY_LU;
 }
-#include "esch.h"
-static int
-esch_unicode_range_lo_low_bound[] = 
-{
-    0xaa, 
-    0xba, 
-    0x1bb, 
-    0x1c0, 
-    0x294, 
-    0x5d0, 
-    0x5f0, 
-    0x620, 
-    0x641, 
-    0x66e, 
-    0x671, 
-    0x6d5, 
-    0x6ee, 
-    0x6fa, 
-    0x6ff, 
-    0x710, 
-    0x712, 
-    0x74d, 
-    0x7b1, 
-    0x7ca, 
-    0x800, 
-    0x840, 
-    0x8a0, 
-    0x8a2, 
-    0x904, 
-    0x93d, 
-    0x950, 
-    0x958, 
-    0x972, 
-    0x979, 
-    0x985, 
-    0x98f, 
-    0x993, 
-    0x9aa, 
-    0x9b2, 
-    0x9b6, 
-    0x9bd, 
-    0x9ce, 
-    0x9dc, 
-    0x9df, 
-    0x9f0, 
-    0xa05, 
-    0xa0f, 
-    0xa13, 
-    0xa2a, 
-    0xa32, 
-    0xa35, 
-    0xa38, 
-    0xa59, 
-    0xa5e, 
-    0xa72, 
-    0xa85, 
-    0xa8f, 
-    0xa93, 
-    0xaaa, 
-    0xab2, 
-    0xab5, 
-    0xabd, 
-    0xad0, 
-    0xae0, 
-    0xb05, 
-    0xb0f, 
-    0xb13, 
-    0xb2a, 
-    0xb32, 
-    0xb35, 
-    0xb3d, 
-    0xb5c, 
-    0xb5f, 
-    0xb71, 
-    0xb83, 
-    0xb85, 
-    0xb8e, 
-    0xb92, 
-    0xb99, 
-    0xb9c, 
-    0xb9e, 
-    0xba3, 
-    0xba8, 
-    0xbae, 
-    0xbd0, 
-    0xc05, 
-    0xc0e, 
-    0xc12, 
-    0xc2a, 
-    0xc35, 
-    0xc3d, 
-    0xc58, 
-    0xc60, 
-    0xc85, 
-    0xc8e, 
-    0xc92, 
-    0xcaa, 
-    0xcb5, 
-    0xcbd, 
-    0xcde, 
-    0xce0, 
-    0xcf1, 
-    0xd05, 
-    0xd0e, 
-    0xd12, 
-    0xd3d, 
-    0xd4e, 
-    0xd60, 
-    0xd7a, 
-    0xd85, 
-    0xd9a, 
-    0xdb3, 
-    0xdbd, 
-    0xdc0, 
-    0xe01, 
-    0xe32, 
-    0xe40, 
-    0xe81, 
-    0xe84, 
-    0xe87, 
-    0xe8a, 
-    0xe8d, 
-    0xe94, 
-    0xe99, 
-    0xea1, 
-    0xea5, 
-    0xea7, 
-    0xeaa, 
-    0xead, 
-    0xeb2, 
-    0xebd, 
-    0xec0, 
-    0xedc, 
-    0xf00, 
-    0xf40, 
-    0xf49, 
-    0xf88, 
-    0x1000, 
-    0x103f, 
-    0x1050, 
-    0x105a, 
-    0x1061, 
-    0x1065, 
-    0x106e, 
-    0x1075, 
-    0x108e, 
-    0x10d0, 
-    0x10fd, 
-    0x124a, 
-    0x1250, 
-    0x1258, 
-    0x125a, 
-    0x1260, 
-    0x128a, 
-    0x1290, 
-    0x12b2, 
-    0x12b8, 
-    0x12c0, 
-    0x12c2, 
-    0x12c8, 
-    0x12d8, 
-    0x1312, 
-    0x1318, 
-    0x1380, 
-    0x13a0, 
-    0x1401, 
-    0x166f, 
-    0x1681, 
-    0x16a0, 
-    0x1700, 
-    0x170e, 
-    0x1720, 
-    0x1740, 
-    0x1760, 
-    0x176e, 
-    0x1780, 
-    0x17dc, 
-    0x1820, 
-    0x1844, 
-    0x1880, 
-    0x18aa, 
-    0x18b0, 
-    0x1900, 
-    0x1950, 
-    0x1970, 
-    0x1980, 
-    0x19c1, 
-    0x1a00, 
-    0x1a20, 
-    0x1b05, 
-    0x1b45, 
-    0x1b83, 
-    0x1bae, 
-    0x1bba, 
-    0x1c00, 
-    0x1c4d, 
-    0x1c5a, 
-    0x1ce9, 
-    0x1cee, 
-    0x1cf5, 
-    0x2135, 
-    0x2d30, 
-    0x2d80, 
-    0x2da0, 
-    0x2da8, 
-    0x2db0, 
-    0x2db8, 
-    0x2dc0, 
-    0x2dc8, 
-    0x2dd0, 
-    0x2dd8, 
-    0x3006, 
-    0x303c, 
-    0x3041, 
-    0x309f, 
-    0x30a1, 
-    0x30ff, 
-    0x3105, 
-    0x3131, 
-    0x31a0, 
-    0x31f0, 
-    0x3400, 
-    0x4db5, 
-    0x4e00, 
-    0x9fcc, 
-    0xa000, 
-    0xa016, 
-    0xa4d0, 
-    0xa500, 
-    0xa610, 
-    0xa62a, 
-    0xa66e, 
-    0xa6a0, 
-    0xa7fb, 
-    0xa803, 
-    0xa807, 
-    0xa80c, 
-    0xa840, 
-    0xa882, 
-    0xa8f2, 
-    0xa8fb, 
-    0xa90a, 
-    0xa930, 
-    0xa960, 
-    0xa984, 
-    0xaa00, 
-    0xaa40, 
-    0xaa44, 
-    0xaa60, 
-    0xaa71, 
-    0xaa7a, 
-    0xaa80, 
-    0xaab1, 
-    0xaab5, 
-    0xaab9, 
-    0xaac0, 
-    0xaac2, 
-    0xaadb, 
-    0xaae0, 
-    0xaaf2, 
-    0xab01, 
-    0xab09, 
-    0xab11, 
-    0xab20, 
-    0xab28, 
-    0xabc0, 
-    0xac00, 
-    0xd7a3, 
-    0xd7b0, 
-    0xd7cb, 
-    0xf900, 
-    0xfa70, 
-    0xfb1d, 
-    0xfb1f, 
-    0xfb2a, 
-    0xfb38, 
-    0xfb3e, 
-    0xfb40, 
-    0xfb43, 
-    0xfb46, 
-    0xfbd3, 
-    0xfd50, 
-    0xfd92, 
-    0xfdf0, 
-    0xfe70, 
-    0xfe76, 
-    0xff66, 
-    0xff71, 
-    0xffa0, 
-    0xffc2, 
-    0xffca, 
-    0xffd2, 
-    0xffda, 
-    0x10000, 
-    0x1000d, 
-    0x10028, 
-    0x1003c, 
-    0x1003f, 
-    0x10050, 
-    0x10080, 
-    0x10280, 
-    0x102a0, 
-    0x10300, 
-    0x10330, 
-    0x10342, 
-    0x10380, 
-    0x103a0, 
-    0x103c8, 
-    0x10450, 
-    0x10800, 
-    0x10808, 
-    0x1080a, 
-    0x10837, 
-    0x1083c, 
-    0x1083f, 
-    0x10900, 
-    0x10920, 
-    0x10980, 
-    0x109be, 
-    0x10a00, 
-    0x10a10, 
-    0x10a15, 
-    0x10a19, 
-    0x10a60, 
-    0x10b00, 
-    0x10b40, 
-    0x10b60, 
-    0x10c00, 
-    0x11003, 
-    0x11083, 
-    0x110d0, 
-    0x11103, 
-    0x11183, 
-    0x111c1, 
-    0x11680, 
-    0x12000, 
-    0x13000, 
-    0x16800, 
-    0x16f00, 
-    0x16f50, 
-    0x1b000, 
-    0x1ee00, 
-    0x1ee05, 
-    0x1ee21, 
-    0x1ee24, 
-    0x1ee27, 
-    0x1ee29, 
-    0x1ee34, 
-    0x1ee39, 
-    0x1ee3b, 
-    0x1ee42, 
-    0x1ee47, 
-    0x1ee49, 
-    0x1ee4b, 
-    0x1ee4d, 
-    0x1ee51, 
-    0x1ee54, 
-    0x1ee57, 
-    0x1ee59, 
-    0x1ee5b, 
-    0x1ee5d, 
-    0x1ee5f, 
-    0x1ee61, 
-    0x1ee64, 
-    0x1ee67, 
-    0x1ee6c, 
-    0x1ee74, 
-    0x1ee79, 
-    0x1ee7e, 
-    0x1ee80, 
-    0x1ee8b, 
-    0x1eea1, 
-    0x1eea5, 
-    0x1eeab, 
-    0x20000, 
-    0x2a6d6, 
-    0x2a700, 
-    0x2b734, 
-    0x2b740, 
-    0x2b81d, 
-    0x2f800, 
-};
-static int
-esch_unicode_range_lo_up_bound[] = 
-{
-    0xaa, 
-    0xba, 
-    0x1bb, 
-    0x1c3, 
-    0x294, 
-    0x5ea, 
-    0x5f2, 
-    0x63f, 
-    0x64a, 
-    0x66f, 
-    0x6d3, 
-    0x6d5, 
-    0x6ef, 
-    0x6fc, 
-    0x6ff, 
-    0x710, 
-    0x72f, 
-    0x7a5, 
-    0x7b1, 
-    0x7ea, 
-    0x815, 
-    0x858, 
-    0x8a0, 
-    0x8ac, 
-    0x939, 
-    0x93d, 
-    0x950, 
-    0x961, 
-    0x977, 
-    0x97f, 
-    0x98c, 
-    0x990, 
-    0x9a8, 
-    0x9b0, 
-    0x9b2, 
-    0x9b9, 
-    0x9bd, 
-    0x9ce, 
-    0x9dd, 
-    0x9e1, 
-    0x9f1, 
-    0xa0a, 
-    0xa10, 
-    0xa28, 
-    0xa30, 
-    0xa33, 
-    0xa36, 
-    0xa39, 
-    0xa5c, 
-    0xa5e, 
-    0xa74, 
-    0xa8d, 
-    0xa91, 
-    0xaa8, 
-    0xab0, 
-    0xab3, 
-    0xab9, 
-    0xabd, 
-    0xad0, 
-    0xae1, 
-    0xb0c, 
-    0xb10, 
-    0xb28, 
-    0xb30, 
-    0xb33, 
-    0xb39, 
-    0xb3d, 
-    0xb5d, 
-    0xb61, 
-    0xb71, 
-    0xb83, 
-    0xb8a, 
-    0xb90, 
-    0xb95, 
-    0xb9a, 
-    0xb9c, 
-    0xb9f, 
-    0xba4, 
-    0xbaa, 
-    0xbb9, 
-    0xbd0, 
-    0xc0c, 
-    0xc10, 
-    0xc28, 
-    0xc33, 
-    0xc39, 
-    0xc3d, 
-    0xc59, 
-    0xc61, 
-    0xc8c, 
-    0xc90, 
-    0xca8, 
-    0xcb3, 
-    0xcb9, 
-    0xcbd, 
-    0xcde, 
-    0xce1, 
-    0xcf2, 
-    0xd0c, 
-    0xd10, 
-    0xd3a, 
-    0xd3d, 
-    0xd4e, 
-    0xd61, 
-    0xd7f, 
-    0xd96, 
-    0xdb1, 
-    0xdbb, 
-    0xdbd, 
-    0xdc6, 
-    0xe30, 
-    0xe33, 
-    0xe45, 
-    0xe82, 
-    0xe84, 
-    0xe88, 
-    0xe8a, 
-    0xe8d, 
-    0xe97, 
-    0xe9f, 
-    0xea3, 
-    0xea5, 
-    0xea7, 
-    0xeab, 
-    0xeb0, 
-    0xeb3, 
-    0xebd, 
-    0xec4, 
-    0xedf, 
-    0xf00, 
-    0xf47, 
-    0xf6c, 
-    0xf8c, 
-    0x102a, 
-    0x103f, 
-    0x1055, 
-    0x105d, 
-    0x1061, 
-    0x1066, 
-    0x1070, 
-    0x1081, 
-    0x108e, 
-    0x10fa, 
-    0x1248, 
-    0x124d, 
-    0x1256, 
-    0x1258, 
-    0x125d, 
-    0x1288, 
-    0x128d, 
-    0x12b0, 
-    0x12b5, 
-    0x12be, 
-    0x12c0, 
-    0x12c5, 
-    0x12d6, 
-    0x1310, 
-    0x1315, 
-    0x135a, 
-    0x138f, 
-    0x13f4, 
-    0x166c, 
-    0x167f, 
-    0x169a, 
-    0x16ea, 
-    0x170c, 
-    0x1711, 
-    0x1731, 
-    0x1751, 
-    0x176c, 
-    0x1770, 
-    0x17b3, 
-    0x17dc, 
-    0x1842, 
-    0x1877, 
-    0x18a8, 
-    0x18aa, 
-    0x18f5, 
-    0x191c, 
-    0x196d, 
-    0x1974, 
-    0x19ab, 
-    0x19c7, 
-    0x1a16, 
-    0x1a54, 
-    0x1b33, 
-    0x1b4b, 
-    0x1ba0, 
-    0x1baf, 
-    0x1be5, 
-    0x1c23, 
-    0x1c4f, 
-    0x1c77, 
-    0x1cec, 
-    0x1cf1, 
-    0x1cf6, 
-    0x2138, 
-    0x2d67, 
-    0x2d96, 
-    0x2da6, 
-    0x2dae, 
-    0x2db6, 
-    0x2dbe, 
-    0x2dc6, 
-    0x2dce, 
-    0x2dd6, 
-    0x2dde, 
-    0x3006, 
-    0x303c, 
-    0x3096, 
-    0x309f, 
-    0x30fa, 
-    0x30ff, 
-    0x312d, 
-    0x318e, 
-    0x31ba, 
-    0x31ff, 
-    0x3400, 
-    0x4db5, 
-    0x4e00, 
-    0x9fcc, 
-    0xa014, 
-    0xa48c, 
-    0xa4f7, 
-    0xa60b, 
-    0xa61f, 
-    0xa62b, 
-    0xa66e, 
-    0xa6e5, 
-    0xa801, 
-    0xa805, 
-    0xa80a, 
-    0xa822, 
-    0xa873, 
-    0xa8b3, 
-    0xa8f7, 
-    0xa8fb, 
-    0xa925, 
-    0xa946, 
-    0xa97c, 
-    0xa9b2, 
-    0xaa28, 
-    0xaa42, 
-    0xaa4b, 
-    0xaa6f, 
-    0xaa76, 
-    0xaa7a, 
-    0xaaaf, 
-    0xaab1, 
-    0xaab6, 
-    0xaabd, 
-    0xaac0, 
-    0xaac2, 
-    0xaadc, 
-    0xaaea, 
-    0xaaf2, 
-    0xab06, 
-    0xab0e, 
-    0xab16, 
-    0xab26, 
-    0xab2e, 
-    0xabe2, 
-    0xac00, 
-    0xd7a3, 
-    0xd7c6, 
-    0xd7fb, 
-    0xfa6d, 
-    0xfad9, 
-    0xfb1d, 
-    0xfb28, 
-    0xfb36, 
-    0xfb3c, 
-    0xfb3e, 
-    0xfb41, 
-    0xfb44, 
-    0xfbb1, 
-    0xfd3d, 
-    0xfd8f, 
-    0xfdc7, 
-    0xfdfb, 
-    0xfe74, 
-    0xfefc, 
-    0xff6f, 
-    0xff9d, 
-    0xffbe, 
-    0xffc7, 
-    0xffcf, 
-    0xffd7, 
-    0xffdc, 
-    0x1000b, 
-    0x10026, 
-    0x1003a, 
-    0x1003d, 
-    0x1004d, 
-    0x1005d, 
-    0x100fa, 
-    0x1029c, 
-    0x102d0, 
-    0x1031e, 
-    0x10340, 
-    0x10349, 
-    0x1039d, 
-    0x103c3, 
-    0x103cf, 
-    0x1049d, 
-    0x10805, 
-    0x10808, 
-    0x10835, 
-    0x10838, 
-    0x1083c, 
-    0x10855, 
-    0x10915, 
-    0x10939, 
-    0x109b7, 
-    0x109bf, 
-    0x10a00, 
-    0x10a13, 
-    0x10a17, 
-    0x10a33, 
-    0x10a7c, 
-    0x10b35, 
-    0x10b55, 
-    0x10b72, 
-    0x10c48, 
-    0x11037, 
-    0x110af, 
-    0x110e8, 
-    0x11126, 
-    0x111b2, 
-    0x111c4, 
-    0x116aa, 
-    0x1236e, 
-    0x1342e, 
-    0x16a38, 
-    0x16f44, 
-    0x16f50, 
-    0x1b001, 
-    0x1ee03, 
-    0x1ee1f, 
-    0x1ee22, 
-    0x1ee24, 
-    0x1ee27, 
-    0x1ee32, 
-    0x1ee37, 
-    0x1ee39, 
-    0x1ee3b, 
-    0x1ee42, 
-    0x1ee47, 
-    0x1ee49, 
-    0x1ee4b, 
-    0x1ee4f, 
-    0x1ee52, 
-    0x1ee54, 
-    0x1ee57, 
-    0x1ee59, 
-    0x1ee5b, 
-    0x1ee5d, 
-    0x1ee5f, 
-    0x1ee62, 
-    0x1ee64, 
-    0x1ee6a, 
-    0x1ee72, 
-    0x1ee77, 
-    0x1ee7c, 
-    0x1ee7e, 
-    0x1ee89, 
-    0x1ee9b, 
-    0x1eea3, 
-    0x1eea9, 
-    0x1eebb, 
-    0x20000, 
-    0x2a6d6, 
-    0x2a700, 
-    0x2b734, 
-    0x2b740, 
-    0x2b81d, 
-    0x2fa1d, 
-};
 int
-esch_unicode_is_range_lo(esch_unicode ch)
+esch_unicode_is_range_ll(esch_unicode ch)
 {
-    size_t n = 0;
-    for (; n < sizeof(esch_unicode_range_lo_up_bound) / sizeof(esch_unicode); ++n)
-    {
-        if (ch >= esch_unicode_range_lo_low_bound[n] && ch <= esch_unicode_range_lo_up_bound[n])
-            return 1;
-    }
-    return 0;
+    return esch_unicode_get_category(ch) == ESCH_UNICODE_CATEGORY_LL;
 }
-#include "esch.h"
-static int
-esch_unicode_range_lt_low_bound[] = 
-{
-    0x1c5, 
-    0x1c8, 
-    0x1cb, 
-    0x1f2, 
-    0x1f88, 
-    0x1f98, 
-    0x1fa8, 
-    0x1fbc, 
-    0x1fcc, 
-    0x1ffc, 
-};
-static int
-esch_unicode_range_lt_up_bound[] = 
-{
-    0x1c5, 
-    0x1c8, 
-    0x1cb, 
-    0x1f2, 
-    0x1f8f, 
-    0x1f9f, 
-    0x1faf, 
-    0x1fbc, 
-    0x1fcc, 
-    0x1ffc, 
-};
 int
 esch_unicode_is_range_lt(esch_unicode ch)
 {
-    size_t n = 0;
-    for (; n < sizeof(esch_unicode_range_lt_up_bound) / sizeof(esch_unicode); ++n)
-    {
-        if (ch >= esch_unicode_range_lt_low_bound[n] && ch <= esch_unicode_range_lt_up_bound[n])
-            return 1;
-    }
-    return 0;
+    return esch_unicode_get_category(ch) == ESCH_UNICODE_CATEGORY_LT;
 }
-#include "esch.h"
-static int
-esch_unicode_range_lu_low_bound[] = 
-{
-    0x41, 
-    0xc0, 
-    0xd8, 
-    0x100, 
-    0x102, 
-    0x104, 
-    0x106, 
-    0x108, 
-    0x10a, 
-    0x10c, 
-    0x10e, 
-    0x110, 
-    0x112, 
-    0x114, 
-    0x116, 
-    0x118, 
-    0x11a, 
-    0x11c, 
-    0x11e, 
-    0x120, 
-    0x122, 
-    0x124, 
-    0x126, 
-    0x128, 
-    0x12a, 
-    0x12c, 
-    0x12e, 
-    0x130, 
-    0x132, 
-    0x134, 
-    0x136, 
-    0x139, 
-    0x13b, 
-    0x13d, 
-    0x13f, 
-    0x141, 
-    0x143, 
-    0x145, 
-    0x147, 
-    0x14a, 
-    0x14c, 
-    0x14e, 
-    0x150, 
-    0x152, 
-    0x154, 
-    0x156, 
-    0x158, 
-    0x15a, 
-    0x15c, 
-    0x15e, 
-    0x160, 
-    0x162, 
-    0x164, 
-    0x166, 
-    0x168, 
-    0x16a, 
-    0x16c, 
-    0x16e, 
-    0x170, 
-    0x172, 
-    0x174, 
-    0x176, 
-    0x178, 
-    0x17b, 
-    0x17d, 
-    0x181, 
-    0x184, 
-    0x186, 
-    0x189, 
-    0x18e, 
-    0x193, 
-    0x196, 
-    0x19c, 
-    0x19f, 
-    0x1a2, 
-    0x1a4, 
-    0x1a6, 
-    0x1a9, 
-    0x1ac, 
-    0x1ae, 
-    0x1b1, 
-    0x1b5, 
-    0x1b7, 
-    0x1bc, 
-    0x1c4, 
-    0x1c7, 
-    0x1ca, 
-    0x1cd, 
-    0x1cf, 
-    0x1d1, 
-    0x1d3, 
-    0x1d5, 
-    0x1d7, 
-    0x1d9, 
-    0x1db, 
-    0x1de, 
-    0x1e0, 
-    0x1e2, 
-    0x1e4, 
-    0x1e6, 
-    0x1e8, 
-    0x1ea, 
-    0x1ec, 
-    0x1ee, 
-    0x1f1, 
-    0x1f4, 
-    0x1f6, 
-    0x1fa, 
-    0x1fc, 
-    0x1fe, 
-    0x200, 
-    0x202, 
-    0x204, 
-    0x206, 
-    0x208, 
-    0x20a, 
-    0x20c, 
-    0x20e, 
-    0x210, 
-    0x212, 
-    0x214, 
-    0x216, 
-    0x218, 
-    0x21a, 
-    0x21c, 
-    0x21e, 
-    0x220, 
-    0x222, 
-    0x224, 
-    0x226, 
-    0x228, 
-    0x22a, 
-    0x22c, 
-    0x22e, 
-    0x230, 
-    0x232, 
-    0x23a, 
-    0x23d, 
-    0x241, 
-    0x243, 
-    0x248, 
-    0x24a, 
-    0x24c, 
-    0x24e, 
-    0x370, 
-    0x372, 
-    0x376, 
-    0x386, 
-    0x388, 
-    0x38c, 
-    0x38e, 
-    0x391, 
-    0x3a3, 
-    0x3cf, 
-    0x3d2, 
-    0x3d8, 
-    0x3da, 
-    0x3dc, 
-    0x3de, 
-    0x3e0, 
-    0x3e2, 
-    0x3e4, 
-    0x3e6, 
-    0x3e8, 
-    0x3ea, 
-    0x3ec, 
-    0x3ee, 
-    0x3f4, 
-    0x3f7, 
-    0x3f9, 
-    0x3fd, 
-    0x460, 
-    0x462, 
-    0x464, 
-    0x466, 
-    0x468, 
-    0x46a, 
-    0x46c, 
-    0x46e, 
-    0x470, 
-    0x472, 
-    0x474, 
-    0x476, 
-    0x478, 
-    0x47a, 
-    0x47c, 
-    0x47e, 
-    0x480, 
-    0x48a, 
-    0x48c, 
-    0x48e, 
-    0x490, 
-    0x492, 
-    0x494, 
-    0x496, 
-    0x498, 
-    0x49a, 
-    0x49c, 
-    0x49e, 
-    0x4a0, 
-    0x4a2, 
-    0x4a4, 
-    0x4a6, 
-    0x4a8, 
-    0x4aa, 
-    0x4ac, 
-    0x4ae, 
-    0x4b0, 
-    0x4b2, 
-    0x4b4, 
-    0x4b6, 
-    0x4b8, 
-    0x4ba, 
-    0x4bc, 
-    0x4be, 
-    0x4c0, 
-    0x4c3, 
-    0x4c5, 
-    0x4c7, 
-    0x4c9, 
-    0x4cb, 
-    0x4cd, 
-    0x4d0, 
-    0x4d2, 
-    0x4d4, 
-    0x4d6, 
-    0x4d8, 
-    0x4da, 
-    0x4dc, 
-    0x4de, 
-    0x4e0, 
-    0x4e2, 
-    0x4e4, 
-    0x4e6, 
-    0x4e8, 
-    0x4ea, 
-    0x4ec, 
-    0x4ee, 
-    0x4f0, 
-    0x4f2, 
-    0x4f4, 
-    0x4f6, 
-    0x4f8, 
-    0x4fa, 
-    0x4fc, 
-    0x4fe, 
-    0x500, 
-    0x502, 
-    0x504, 
-    0x506, 
-    0x508, 
-    0x50a, 
-    0x50c, 
-    0x50e, 
-    0x510, 
-    0x512, 
-    0x514, 
-    0x516, 
-    0x518, 
-    0x51a, 
-    0x51c, 
-    0x51e, 
-    0x520, 
-    0x522, 
-    0x524, 
-    0x526, 
-    0x531, 
-    0x10a0, 
-    0x10c7, 
-    0x10cd, 
-    0x1e00, 
-    0x1e02, 
-    0x1e04, 
-    0x1e06, 
-    0x1e08, 
-    0x1e0a, 
-    0x1e0c, 
-    0x1e0e, 
-    0x1e10, 
-    0x1e12, 
-    0x1e14, 
-    0x1e16, 
-    0x1e18, 
-    0x1e1a, 
-    0x1e1c, 
-    0x1e1e, 
-    0x1e20, 
-    0x1e22, 
-    0x1e24, 
-    0x1e26, 
-    0x1e28, 
-    0x1e2a, 
-    0x1e2c, 
-    0x1e2e, 
-    0x1e30, 
-    0x1e32, 
-    0x1e34, 
-    0x1e36, 
-    0x1e38, 
-    0x1e3a, 
-    0x1e3c, 
-    0x1e3e, 
-    0x1e40, 
-    0x1e42, 
-    0x1e44, 
-    0x1e46, 
-    0x1e48, 
-    0x1e4a, 
-    0x1e4c, 
-    0x1e4e, 
-    0x1e50, 
-    0x1e52, 
-    0x1e54, 
-    0x1e56, 
-    0x1e58, 
-    0x1e5a, 
-    0x1e5c, 
-    0x1e5e, 
-    0x1e60, 
-    0x1e62, 
-    0x1e64, 
-    0x1e66, 
-    0x1e68, 
-    0x1e6a, 
-    0x1e6c, 
-    0x1e6e, 
-    0x1e70, 
-    0x1e72, 
-    0x1e74, 
-    0x1e76, 
-    0x1e78, 
-    0x1e7a, 
-    0x1e7c, 
-    0x1e7e, 
-    0x1e80, 
-    0x1e82, 
-    0x1e84, 
-    0x1e86, 
-    0x1e88, 
-    0x1e8a, 
-    0x1e8c, 
-    0x1e8e, 
-    0x1e90, 
-    0x1e92, 
-    0x1e94, 
-    0x1e9e, 
-    0x1ea0, 
-    0x1ea2, 
-    0x1ea4, 
-    0x1ea6, 
-    0x1ea8, 
-    0x1eaa, 
-    0x1eac, 
-    0x1eae, 
-    0x1eb0, 
-    0x1eb2, 
-    0x1eb4, 
-    0x1eb6, 
-    0x1eb8, 
-    0x1eba, 
-    0x1ebc, 
-    0x1ebe, 
-    0x1ec0, 
-    0x1ec2, 
-    0x1ec4, 
-    0x1ec6, 
-    0x1ec8, 
-    0x1eca, 
-    0x1ecc, 
-    0x1ece, 
-    0x1ed0, 
-    0x1ed2, 
-    0x1ed4, 
-    0x1ed6, 
-    0x1ed8, 
-    0x1eda, 
-    0x1edc, 
-    0x1ede, 
-    0x1ee0, 
-    0x1ee2, 
-    0x1ee4, 
-    0x1ee6, 
-    0x1ee8, 
-    0x1eea, 
-    0x1eec, 
-    0x1eee, 
-    0x1ef0, 
-    0x1ef2, 
-    0x1ef4, 
-    0x1ef6, 
-    0x1ef8, 
-    0x1efa, 
-    0x1efc, 
-    0x1efe, 
-    0x1f08, 
-    0x1f18, 
-    0x1f28, 
-    0x1f38, 
-    0x1f48, 
-    0x1f59, 
-    0x1f5b, 
-    0x1f5d, 
-    0x1f5f, 
-    0x1f68, 
-    0x1fb8, 
-    0x1fc8, 
-    0x1fd8, 
-    0x1fe8, 
-    0x1ff8, 
-    0x2102, 
-    0x2107, 
-    0x210b, 
-    0x2110, 
-    0x2115, 
-    0x2119, 
-    0x2124, 
-    0x2126, 
-    0x2128, 
-    0x212a, 
-    0x2130, 
-    0x213e, 
-    0x2145, 
-    0x2183, 
-    0x2c00, 
-    0x2c60, 
-    0x2c62, 
-    0x2c67, 
-    0x2c69, 
-    0x2c6b, 
-    0x2c6d, 
-    0x2c72, 
-    0x2c75, 
-    0x2c7e, 
-    0x2c82, 
-    0x2c84, 
-    0x2c86, 
-    0x2c88, 
-    0x2c8a, 
-    0x2c8c, 
-    0x2c8e, 
-    0x2c90, 
-    0x2c92, 
-    0x2c94, 
-    0x2c96, 
-    0x2c98, 
-    0x2c9a, 
-    0x2c9c, 
-    0x2c9e, 
-    0x2ca0, 
-    0x2ca2, 
-    0x2ca4, 
-    0x2ca6, 
-    0x2ca8, 
-    0x2caa, 
-    0x2cac, 
-    0x2cae, 
-    0x2cb0, 
-    0x2cb2, 
-    0x2cb4, 
-    0x2cb6, 
-    0x2cb8, 
-    0x2cba, 
-    0x2cbc, 
-    0x2cbe, 
-    0x2cc0, 
-    0x2cc2, 
-    0x2cc4, 
-    0x2cc6, 
-    0x2cc8, 
-    0x2cca, 
-    0x2ccc, 
-    0x2cce, 
-    0x2cd0, 
-    0x2cd2, 
-    0x2cd4, 
-    0x2cd6, 
-    0x2cd8, 
-    0x2cda, 
-    0x2cdc, 
-    0x2cde, 
-    0x2ce0, 
-    0x2ce2, 
-    0x2ceb, 
-    0x2ced, 
-    0x2cf2, 
-    0xa640, 
-    0xa642, 
-    0xa644, 
-    0xa646, 
-    0xa648, 
-    0xa64a, 
-    0xa64c, 
-    0xa64e, 
-    0xa650, 
-    0xa652, 
-    0xa654, 
-    0xa656, 
-    0xa658, 
-    0xa65a, 
-    0xa65c, 
-    0xa65e, 
-    0xa660, 
-    0xa662, 
-    0xa664, 
-    0xa666, 
-    0xa668, 
-    0xa66a, 
-    0xa66c, 
-    0xa680, 
-    0xa682, 
-    0xa684, 
-    0xa686, 
-    0xa688, 
-    0xa68a, 
-    0xa68c, 
-    0xa68e, 
-    0xa690, 
-    0xa692, 
-    0xa694, 
-    0xa696, 
-    0xa722, 
-    0xa724, 
-    0xa726, 
-    0xa728, 
-    0xa72a, 
-    0xa72c, 
-    0xa72e, 
-    0xa732, 
-    0xa734, 
-    0xa736, 
-    0xa738, 
-    0xa73a, 
-    0xa73c, 
-    0xa73e, 
-    0xa740, 
-    0xa742, 
-    0xa744, 
-    0xa746, 
-    0xa748, 
-    0xa74a, 
-    0xa74c, 
-    0xa74e, 
-    0xa750, 
-    0xa752, 
-    0xa754, 
-    0xa756, 
-    0xa758, 
-    0xa75a, 
-    0xa75c, 
-    0xa75e, 
-    0xa760, 
-    0xa762, 
-    0xa764, 
-    0xa766, 
-    0xa768, 
-    0xa76a, 
-    0xa76c, 
-    0xa76e, 
-    0xa779, 
-    0xa77b, 
-    0xa77d, 
-    0xa780, 
-    0xa782, 
-    0xa784, 
-    0xa786, 
-    0xa78b, 
-    0xa78d, 
-    0xa790, 
-    0xa792, 
-    0xa7a0, 
-    0xa7a2, 
-    0xa7a4, 
-    0xa7a6, 
-    0xa7a8, 
-    0xa7aa, 
-    0xff21, 
-    0x10400, 
-    0x1d400, 
-    0x1d434, 
-    0x1d468, 
-    0x1d49c, 
-    0x1d49e, 
-    0x1d4a2, 
-    0x1d4a5, 
-    0x1d4a9, 
-    0x1d4ae, 
-    0x1d4d0, 
-    0x1d504, 
-    0x1d507, 
-    0x1d50d, 
-    0x1d516, 
-    0x1d538, 
-    0x1d53b, 
-    0x1d540, 
-    0x1d546, 
-    0x1d54a, 
-    0x1d56c, 
-    0x1d5a0, 
-    0x1d5d4, 
-    0x1d608, 
-    0x1d63c, 
-    0x1d670, 
-    0x1d6a8, 
-    0x1d6e2, 
-    0x1d71c, 
-    0x1d756, 
-    0x1d790, 
-    0x1d7ca, 
-};
-static int
-esch_unicode_range_lu_up_bound[] = 
-{
-    0x5a, 
-    0xd6, 
-    0xde, 
-    0x100, 
-    0x102, 
-    0x104, 
-    0x106, 
-    0x108, 
-    0x10a, 
-    0x10c, 
-    0x10e, 
-    0x110, 
-    0x112, 
-    0x114, 
-    0x116, 
-    0x118, 
-    0x11a, 
-    0x11c, 
-    0x11e, 
-    0x120, 
-    0x122, 
-    0x124, 
-    0x126, 
-    0x128, 
-    0x12a, 
-    0x12c, 
-    0x12e, 
-    0x130, 
-    0x132, 
-    0x134, 
-    0x136, 
-    0x139, 
-    0x13b, 
-    0x13d, 
-    0x13f, 
-    0x141, 
-    0x143, 
-    0x145, 
-    0x147, 
-    0x14a, 
-    0x14c, 
-    0x14e, 
-    0x150, 
-    0x152, 
-    0x154, 
-    0x156, 
-    0x158, 
-    0x15a, 
-    0x15c, 
-    0x15e, 
-    0x160, 
-    0x162, 
-    0x164, 
-    0x166, 
-    0x168, 
-    0x16a, 
-    0x16c, 
-    0x16e, 
-    0x170, 
-    0x172, 
-    0x174, 
-    0x176, 
-    0x179, 
-    0x17b, 
-    0x17d, 
-    0x182, 
-    0x184, 
-    0x187, 
-    0x18b, 
-    0x191, 
-    0x194, 
-    0x198, 
-    0x19d, 
-    0x1a0, 
-    0x1a2, 
-    0x1a4, 
-    0x1a7, 
-    0x1a9, 
-    0x1ac, 
-    0x1af, 
-    0x1b3, 
-    0x1b5, 
-    0x1b8, 
-    0x1bc, 
-    0x1c4, 
-    0x1c7, 
-    0x1ca, 
-    0x1cd, 
-    0x1cf, 
-    0x1d1, 
-    0x1d3, 
-    0x1d5, 
-    0x1d7, 
-    0x1d9, 
-    0x1db, 
-    0x1de, 
-    0x1e0, 
-    0x1e2, 
-    0x1e4, 
-    0x1e6, 
-    0x1e8, 
-    0x1ea, 
-    0x1ec, 
-    0x1ee, 
-    0x1f1, 
-    0x1f4, 
-    0x1f8, 
-    0x1fa, 
-    0x1fc, 
-    0x1fe, 
-    0x200, 
-    0x202, 
-    0x204, 
-    0x206, 
-    0x208, 
-    0x20a, 
-    0x20c, 
-    0x20e, 
-    0x210, 
-    0x212, 
-    0x214, 
-    0x216, 
-    0x218, 
-    0x21a, 
-    0x21c, 
-    0x21e, 
-    0x220, 
-    0x222, 
-    0x224, 
-    0x226, 
-    0x228, 
-    0x22a, 
-    0x22c, 
-    0x22e, 
-    0x230, 
-    0x232, 
-    0x23b, 
-    0x23e, 
-    0x241, 
-    0x246, 
-    0x248, 
-    0x24a, 
-    0x24c, 
-    0x24e, 
-    0x370, 
-    0x372, 
-    0x376, 
-    0x386, 
-    0x38a, 
-    0x38c, 
-    0x38f, 
-    0x3a1, 
-    0x3ab, 
-    0x3cf, 
-    0x3d4, 
-    0x3d8, 
-    0x3da, 
-    0x3dc, 
-    0x3de, 
-    0x3e0, 
-    0x3e2, 
-    0x3e4, 
-    0x3e6, 
-    0x3e8, 
-    0x3ea, 
-    0x3ec, 
-    0x3ee, 
-    0x3f4, 
-    0x3f7, 
-    0x3fa, 
-    0x42f, 
-    0x460, 
-    0x462, 
-    0x464, 
-    0x466, 
-    0x468, 
-    0x46a, 
-    0x46c, 
-    0x46e, 
-    0x470, 
-    0x472, 
-    0x474, 
-    0x476, 
-    0x478, 
-    0x47a, 
-    0x47c, 
-    0x47e, 
-    0x480, 
-    0x48a, 
-    0x48c, 
-    0x48e, 
-    0x490, 
-    0x492, 
-    0x494, 
-    0x496, 
-    0x498, 
-    0x49a, 
-    0x49c, 
-    0x49e, 
-    0x4a0, 
-    0x4a2, 
-    0x4a4, 
-    0x4a6, 
-    0x4a8, 
-    0x4aa, 
-    0x4ac, 
-    0x4ae, 
-    0x4b0, 
-    0x4b2, 
-    0x4b4, 
-    0x4b6, 
-    0x4b8, 
-    0x4ba, 
-    0x4bc, 
-    0x4be, 
-    0x4c1, 
-    0x4c3, 
-    0x4c5, 
-    0x4c7, 
-    0x4c9, 
-    0x4cb, 
-    0x4cd, 
-    0x4d0, 
-    0x4d2, 
-    0x4d4, 
-    0x4d6, 
-    0x4d8, 
-    0x4da, 
-    0x4dc, 
-    0x4de, 
-    0x4e0, 
-    0x4e2, 
-    0x4e4, 
-    0x4e6, 
-    0x4e8, 
-    0x4ea, 
-    0x4ec, 
-    0x4ee, 
-    0x4f0, 
-    0x4f2, 
-    0x4f4, 
-    0x4f6, 
-    0x4f8, 
-    0x4fa, 
-    0x4fc, 
-    0x4fe, 
-    0x500, 
-    0x502, 
-    0x504, 
-    0x506, 
-    0x508, 
-    0x50a, 
-    0x50c, 
-    0x50e, 
-    0x510, 
-    0x512, 
-    0x514, 
-    0x516, 
-    0x518, 
-    0x51a, 
-    0x51c, 
-    0x51e, 
-    0x520, 
-    0x522, 
-    0x524, 
-    0x526, 
-    0x556, 
-    0x10c5, 
-    0x10c7, 
-    0x10cd, 
-    0x1e00, 
-    0x1e02, 
-    0x1e04, 
-    0x1e06, 
-    0x1e08, 
-    0x1e0a, 
-    0x1e0c, 
-    0x1e0e, 
-    0x1e10, 
-    0x1e12, 
-    0x1e14, 
-    0x1e16, 
-    0x1e18, 
-    0x1e1a, 
-    0x1e1c, 
-    0x1e1e, 
-    0x1e20, 
-    0x1e22, 
-    0x1e24, 
-    0x1e26, 
-    0x1e28, 
-    0x1e2a, 
-    0x1e2c, 
-    0x1e2e, 
-    0x1e30, 
-    0x1e32, 
-    0x1e34, 
-    0x1e36, 
-    0x1e38, 
-    0x1e3a, 
-    0x1e3c, 
-    0x1e3e, 
-    0x1e40, 
-    0x1e42, 
-    0x1e44, 
-    0x1e46, 
-    0x1e48, 
-    0x1e4a, 
-    0x1e4c, 
-    0x1e4e, 
-    0x1e50, 
-    0x1e52, 
-    0x1e54, 
-    0x1e56, 
-    0x1e58, 
-    0x1e5a, 
-    0x1e5c, 
-    0x1e5e, 
-    0x1e60, 
-    0x1e62, 
-    0x1e64, 
-    0x1e66, 
-    0x1e68, 
-    0x1e6a, 
-    0x1e6c, 
-    0x1e6e, 
-    0x1e70, 
-    0x1e72, 
-    0x1e74, 
-    0x1e76, 
-    0x1e78, 
-    0x1e7a, 
-    0x1e7c, 
-    0x1e7e, 
-    0x1e80, 
-    0x1e82, 
-    0x1e84, 
-    0x1e86, 
-    0x1e88, 
-    0x1e8a, 
-    0x1e8c, 
-    0x1e8e, 
-    0x1e90, 
-    0x1e92, 
-    0x1e94, 
-    0x1e9e, 
-    0x1ea0, 
-    0x1ea2, 
-    0x1ea4, 
-    0x1ea6, 
-    0x1ea8, 
-    0x1eaa, 
-    0x1eac, 
-    0x1eae, 
-    0x1eb0, 
-    0x1eb2, 
-    0x1eb4, 
-    0x1eb6, 
-    0x1eb8, 
-    0x1eba, 
-    0x1ebc, 
-    0x1ebe, 
-    0x1ec0, 
-    0x1ec2, 
-    0x1ec4, 
-    0x1ec6, 
-    0x1ec8, 
-    0x1eca, 
-    0x1ecc, 
-    0x1ece, 
-    0x1ed0, 
-    0x1ed2, 
-    0x1ed4, 
-    0x1ed6, 
-    0x1ed8, 
-    0x1eda, 
-    0x1edc, 
-    0x1ede, 
-    0x1ee0, 
-    0x1ee2, 
-    0x1ee4, 
-    0x1ee6, 
-    0x1ee8, 
-    0x1eea, 
-    0x1eec, 
-    0x1eee, 
-    0x1ef0, 
-    0x1ef2, 
-    0x1ef4, 
-    0x1ef6, 
-    0x1ef8, 
-    0x1efa, 
-    0x1efc, 
-    0x1efe, 
-    0x1f0f, 
-    0x1f1d, 
-    0x1f2f, 
-    0x1f3f, 
-    0x1f4d, 
-    0x1f59, 
-    0x1f5b, 
-    0x1f5d, 
-    0x1f5f, 
-    0x1f6f, 
-    0x1fbb, 
-    0x1fcb, 
-    0x1fdb, 
-    0x1fec, 
-    0x1ffb, 
-    0x2102, 
-    0x2107, 
-    0x210d, 
-    0x2112, 
-    0x2115, 
-    0x211d, 
-    0x2124, 
-    0x2126, 
-    0x2128, 
-    0x212d, 
-    0x2133, 
-    0x213f, 
-    0x2145, 
-    0x2183, 
-    0x2c2e, 
-    0x2c60, 
-    0x2c64, 
-    0x2c67, 
-    0x2c69, 
-    0x2c6b, 
-    0x2c70, 
-    0x2c72, 
-    0x2c75, 
-    0x2c80, 
-    0x2c82, 
-    0x2c84, 
-    0x2c86, 
-    0x2c88, 
-    0x2c8a, 
-    0x2c8c, 
-    0x2c8e, 
-    0x2c90, 
-    0x2c92, 
-    0x2c94, 
-    0x2c96, 
-    0x2c98, 
-    0x2c9a, 
-    0x2c9c, 
-    0x2c9e, 
-    0x2ca0, 
-    0x2ca2, 
-    0x2ca4, 
-    0x2ca6, 
-    0x2ca8, 
-    0x2caa, 
-    0x2cac, 
-    0x2cae, 
-    0x2cb0, 
-    0x2cb2, 
-    0x2cb4, 
-    0x2cb6, 
-    0x2cb8, 
-    0x2cba, 
-    0x2cbc, 
-    0x2cbe, 
-    0x2cc0, 
-    0x2cc2, 
-    0x2cc4, 
-    0x2cc6, 
-    0x2cc8, 
-    0x2cca, 
-    0x2ccc, 
-    0x2cce, 
-    0x2cd0, 
-    0x2cd2, 
-    0x2cd4, 
-    0x2cd6, 
-    0x2cd8, 
-    0x2cda, 
-    0x2cdc, 
-    0x2cde, 
-    0x2ce0, 
-    0x2ce2, 
-    0x2ceb, 
-    0x2ced, 
-    0x2cf2, 
-    0xa640, 
-    0xa642, 
-    0xa644, 
-    0xa646, 
-    0xa648, 
-    0xa64a, 
-    0xa64c, 
-    0xa64e, 
-    0xa650, 
-    0xa652, 
-    0xa654, 
-    0xa656, 
-    0xa658, 
-    0xa65a, 
-    0xa65c, 
-    0xa65e, 
-    0xa660, 
-    0xa662, 
-    0xa664, 
-    0xa666, 
-    0xa668, 
-    0xa66a, 
-    0xa66c, 
-    0xa680, 
-    0xa682, 
-    0xa684, 
-    0xa686, 
-    0xa688, 
-    0xa68a, 
-    0xa68c, 
-    0xa68e, 
-    0xa690, 
-    0xa692, 
-    0xa694, 
-    0xa696, 
-    0xa722, 
-    0xa724, 
-    0xa726, 
-    0xa728, 
-    0xa72a, 
-    0xa72c, 
-    0xa72e, 
-    0xa732, 
-    0xa734, 
-    0xa736, 
-    0xa738, 
-    0xa73a, 
-    0xa73c, 
-    0xa73e, 
-    0xa740, 
-    0xa742, 
-    0xa744, 
-    0xa746, 
-    0xa748, 
-    0xa74a, 
-    0xa74c, 
-    0xa74e, 
-    0xa750, 
-    0xa752, 
-    0xa754, 
-    0xa756, 
-    0xa758, 
-    0xa75a, 
-    0xa75c, 
-    0xa75e, 
-    0xa760, 
-    0xa762, 
-    0xa764, 
-    0xa766, 
-    0xa768, 
-    0xa76a, 
-    0xa76c, 
-    0xa76e, 
-    0xa779, 
-    0xa77b, 
-    0xa77e, 
-    0xa780, 
-    0xa782, 
-    0xa784, 
-    0xa786, 
-    0xa78b, 
-    0xa78d, 
-    0xa790, 
-    0xa792, 
-    0xa7a0, 
-    0xa7a2, 
-    0xa7a4, 
-    0xa7a6, 
-    0xa7a8, 
-    0xa7aa, 
-    0xff3a, 
-    0x10427, 
-    0x1d419, 
-    0x1d44d, 
-    0x1d481, 
-    0x1d49c, 
-    0x1d49f, 
-    0x1d4a2, 
-    0x1d4a6, 
-    0x1d4ac, 
-    0x1d4b5, 
-    0x1d4e9, 
-    0x1d505, 
-    0x1d50a, 
-    0x1d514, 
-    0x1d51c, 
-    0x1d539, 
-    0x1d53e, 
-    0x1d544, 
-    0x1d546, 
-    0x1d550, 
-    0x1d585, 
-    0x1d5b9, 
-    0x1d5ed, 
-    0x1d621, 
-    0x1d655, 
-    0x1d689, 
-    0x1d6c0, 
-    0x1d6fa, 
-    0x1d734, 
-    0x1d76e, 
-    0x1d7a8, 
-    0x1d7ca, 
-};
 int
-esch_unicode_is_range_lu(esch_unicode ch)
+esch_unicode_is_range_lm(esch_unicode ch)
 {
-    size_t n = 0;
-    for (; n < sizeof(esch_unicode_range_lu_up_bound) / sizeof(esch_unicode); ++n)
-    {
-        if (ch >= esch_unicode_range_lu_low_bound[n] && ch <= esch_unicode_range_lu_up_bound[n])
-            return 1;
-    }
-    return 0;
+    return esch_unicode_get_category(ch) == ESCH_UNICODE_CATEGORY_LM;
 }
-#include "esch.h"
-static int
-esch_unicode_range_mc_low_bound[] = 
-{
-    0x903, 
-    0x93b, 
-    0x93e, 
-    0x949, 
-    0x94e, 
-    0x982, 
-    0x9be, 
-    0x9c7, 
-    0x9cb, 
-    0x9d7, 
-    0xa03, 
-    0xa3e, 
-    0xa83, 
-    0xabe, 
-    0xac9, 
-    0xacb, 
-    0xb02, 
-    0xb3e, 
-    0xb40, 
-    0xb47, 
-    0xb4b, 
-    0xb57, 
-    0xbbe, 
-    0xbc1, 
-    0xbc6, 
-    0xbca, 
-    0xbd7, 
-    0xc01, 
-    0xc41, 
-    0xc82, 
-    0xcbe, 
-    0xcc0, 
-    0xcc7, 
-    0xcca, 
-    0xcd5, 
-    0xd02, 
-    0xd3e, 
-    0xd46, 
-    0xd4a, 
-    0xd57, 
-    0xd82, 
-    0xdcf, 
-    0xdd8, 
-    0xdf2, 
-    0xf3e, 
-    0xf7f, 
-    0x102b, 
-    0x1031, 
-    0x1038, 
-    0x103b, 
-    0x1056, 
-    0x1062, 
-    0x1067, 
-    0x1083, 
-    0x1087, 
-    0x108f, 
-    0x109a, 
-    0x17b6, 
-    0x17be, 
-    0x17c7, 
-    0x1923, 
-    0x1929, 
-    0x1930, 
-    0x1933, 
-    0x19b0, 
-    0x19c8, 
-    0x1a19, 
-    0x1a55, 
-    0x1a57, 
-    0x1a61, 
-    0x1a63, 
-    0x1a6d, 
-    0x1b04, 
-    0x1b35, 
-    0x1b3b, 
-    0x1b3d, 
-    0x1b43, 
-    0x1b82, 
-    0x1ba1, 
-    0x1ba6, 
-    0x1baa, 
-    0x1bac, 
-    0x1be7, 
-    0x1bea, 
-    0x1bee, 
-    0x1bf2, 
-    0x1c24, 
-    0x1c34, 
-    0x1ce1, 
-    0x1cf2, 
-    0x302e, 
-    0xa823, 
-    0xa827, 
-    0xa880, 
-    0xa8b4, 
-    0xa952, 
-    0xa983, 
-    0xa9b4, 
-    0xa9ba, 
-    0xa9bd, 
-    0xaa2f, 
-    0xaa33, 
-    0xaa4d, 
-    0xaa7b, 
-    0xaaeb, 
-    0xaaee, 
-    0xaaf5, 
-    0xabe3, 
-    0xabe6, 
-    0xabe9, 
-    0xabec, 
-    0x11000, 
-    0x11002, 
-    0x11082, 
-    0x110b0, 
-    0x110b7, 
-    0x1112c, 
-    0x11182, 
-    0x111b3, 
-    0x111bf, 
-    0x116ac, 
-    0x116ae, 
-    0x116b6, 
-    0x16f51, 
-    0x1d165, 
-    0x1d16d, 
-};
-static int
-esch_unicode_range_mc_up_bound[] = 
-{
-    0x903, 
-    0x93b, 
-    0x940, 
-    0x94c, 
-    0x94f, 
-    0x983, 
-    0x9c0, 
-    0x9c8, 
-    0x9cc, 
-    0x9d7, 
-    0xa03, 
-    0xa40, 
-    0xa83, 
-    0xac0, 
-    0xac9, 
-    0xacc, 
-    0xb03, 
-    0xb3e, 
-    0xb40, 
-    0xb48, 
-    0xb4c, 
-    0xb57, 
-    0xbbf, 
-    0xbc2, 
-    0xbc8, 
-    0xbcc, 
-    0xbd7, 
-    0xc03, 
-    0xc44, 
-    0xc83, 
-    0xcbe, 
-    0xcc4, 
-    0xcc8, 
-    0xccb, 
-    0xcd6, 
-    0xd03, 
-    0xd40, 
-    0xd48, 
-    0xd4c, 
-    0xd57, 
-    0xd83, 
-    0xdd1, 
-    0xddf, 
-    0xdf3, 
-    0xf3f, 
-    0xf7f, 
-    0x102c, 
-    0x1031, 
-    0x1038, 
-    0x103c, 
-    0x1057, 
-    0x1064, 
-    0x106d, 
-    0x1084, 
-    0x108c, 
-    0x108f, 
-    0x109c, 
-    0x17b6, 
-    0x17c5, 
-    0x17c8, 
-    0x1926, 
-    0x192b, 
-    0x1931, 
-    0x1938, 
-    0x19c0, 
-    0x19c9, 
-    0x1a1b, 
-    0x1a55, 
-    0x1a57, 
-    0x1a61, 
-    0x1a64, 
-    0x1a72, 
-    0x1b04, 
-    0x1b35, 
-    0x1b3b, 
-    0x1b41, 
-    0x1b44, 
-    0x1b82, 
-    0x1ba1, 
-    0x1ba7, 
-    0x1baa, 
-    0x1bad, 
-    0x1be7, 
-    0x1bec, 
-    0x1bee, 
-    0x1bf3, 
-    0x1c2b, 
-    0x1c35, 
-    0x1ce1, 
-    0x1cf3, 
-    0x302f, 
-    0xa824, 
-    0xa827, 
-    0xa881, 
-    0xa8c3, 
-    0xa953, 
-    0xa983, 
-    0xa9b5, 
-    0xa9bb, 
-    0xa9c0, 
-    0xaa30, 
-    0xaa34, 
-    0xaa4d, 
-    0xaa7b, 
-    0xaaeb, 
-    0xaaef, 
-    0xaaf5, 
-    0xabe4, 
-    0xabe7, 
-    0xabea, 
-    0xabec, 
-    0x11000, 
-    0x11002, 
-    0x11082, 
-    0x110b2, 
-    0x110b8, 
-    0x1112c, 
-    0x11182, 
-    0x111b5, 
-    0x111c0, 
-    0x116ac, 
-    0x116af, 
-    0x116b6, 
-    0x16f7e, 
-    0x1d166, 
-    0x1d172, 
-};
 int
-esch_unicode_is_range_mc(esch_unicode ch)
+esch_unicode_is_range_lo(esch_unicode ch)
 {
-    size_t n = 0;
-    for (; n < sizeof(esch_unicode_range_mc_up_bound) / sizeof(esch_unicode); ++n)
-    {
-        if (ch >= esch_unicode_range_mc_low_bound[n] && ch <= esch_unicode_range_mc_up_bound[n])
-            return 1;
-    }
-    return 0;
+    return esch_unicode_get_category(ch) == ESCH_UNICODE_CATEGORY_LO;
 }
-#include "esch.h"
-static int
-esch_unicode_range_mn_low_bound[] = 
-{
-    0x300, 
-    0x483, 
-    0x591, 
-    0x5bf, 
-    0x5c1, 
-    0x5c4, 
-    0x5c7, 
-    0x610, 
-    0x64b, 
-    0x670, 
-    0x6d6, 
-    0x6df, 
-    0x6e7, 
-    0x6ea, 
-    0x711, 
-    0x730, 
-    0x7a6, 
-    0x7eb, 
-    0x816, 
-    0x81b, 
-    0x825, 
-    0x829, 
-    0x859, 
-    0x8e4, 
-    0x900, 
-    0x93a, 
-    0x93c, 
-    0x941, 
-    0x94d, 
-    0x951, 
-    0x962, 
-    0x981, 
-    0x9bc, 
-    0x9c1, 
-    0x9cd, 
-    0x9e2, 
-    0xa01, 
-    0xa3c, 
-    0xa41, 
-    0xa47, 
-    0xa4b, 
-    0xa51, 
-    0xa70, 
-    0xa75, 
-    0xa81, 
-    0xabc, 
-    0xac1, 
-    0xac7, 
-    0xacd, 
-    0xae2, 
-    0xb01, 
-    0xb3c, 
-    0xb3f, 
-    0xb41, 
-    0xb4d, 
-    0xb56, 
-    0xb62, 
-    0xb82, 
-    0xbc0, 
-    0xbcd, 
-    0xc3e, 
-    0xc46, 
-    0xc4a, 
-    0xc55, 
-    0xc62, 
-    0xcbc, 
-    0xcbf, 
-    0xcc6, 
-    0xccc, 
-    0xce2, 
-    0xd41, 
-    0xd4d, 
-    0xd62, 
-    0xdca, 
-    0xdd2, 
-    0xdd6, 
-    0xe31, 
-    0xe34, 
-    0xe47, 
-    0xeb1, 
-    0xeb4, 
-    0xebb, 
-    0xec8, 
-    0xf18, 
-    0xf35, 
-    0xf37, 
-    0xf39, 
-    0xf71, 
-    0xf80, 
-    0xf86, 
-    0xf8d, 
-    0xf99, 
-    0xfc6, 
-    0x102d, 
-    0x1032, 
-    0x1039, 
-    0x103d, 
-    0x1058, 
-    0x105e, 
-    0x1071, 
-    0x1082, 
-    0x1085, 
-    0x108d, 
-    0x109d, 
-    0x135d, 
-    0x1712, 
-    0x1732, 
-    0x1752, 
-    0x1772, 
-    0x17b4, 
-    0x17b7, 
-    0x17c6, 
-    0x17c9, 
-    0x17dd, 
-    0x180b, 
-    0x18a9, 
-    0x1920, 
-    0x1927, 
-    0x1932, 
-    0x1939, 
-    0x1a17, 
-    0x1a56, 
-    0x1a58, 
-    0x1a60, 
-    0x1a62, 
-    0x1a65, 
-    0x1a73, 
-    0x1a7f, 
-    0x1b00, 
-    0x1b34, 
-    0x1b36, 
-    0x1b3c, 
-    0x1b42, 
-    0x1b6b, 
-    0x1b80, 
-    0x1ba2, 
-    0x1ba8, 
-    0x1bab, 
-    0x1be6, 
-    0x1be8, 
-    0x1bed, 
-    0x1bef, 
-    0x1c2c, 
-    0x1c36, 
-    0x1cd0, 
-    0x1cd4, 
-    0x1ce2, 
-    0x1ced, 
-    0x1cf4, 
-    0x1dc0, 
-    0x1dfc, 
-    0x20d0, 
-    0x20e1, 
-    0x20e5, 
-    0x2cef, 
-    0x2d7f, 
-    0x2de0, 
-    0x302a, 
-    0x3099, 
-    0xa66f, 
-    0xa674, 
-    0xa69f, 
-    0xa6f0, 
-    0xa802, 
-    0xa806, 
-    0xa80b, 
-    0xa825, 
-    0xa8c4, 
-    0xa8e0, 
-    0xa926, 
-    0xa947, 
-    0xa980, 
-    0xa9b3, 
-    0xa9b6, 
-    0xa9bc, 
-    0xaa29, 
-    0xaa31, 
-    0xaa35, 
-    0xaa43, 
-    0xaa4c, 
-    0xaab0, 
-    0xaab2, 
-    0xaab7, 
-    0xaabe, 
-    0xaac1, 
-    0xaaec, 
-    0xaaf6, 
-    0xabe5, 
-    0xabe8, 
-    0xabed, 
-    0xfb1e, 
-    0xfe00, 
-    0xfe20, 
-    0x101fd, 
-    0x10a01, 
-    0x10a05, 
-    0x10a0c, 
-    0x10a38, 
-    0x10a3f, 
-    0x11001, 
-    0x11038, 
-    0x11080, 
-    0x110b3, 
-    0x110b9, 
-    0x11100, 
-    0x11127, 
-    0x1112d, 
-    0x11180, 
-    0x111b6, 
-    0x116ab, 
-    0x116ad, 
-    0x116b0, 
-    0x116b7, 
-    0x16f8f, 
-    0x1d167, 
-    0x1d17b, 
-    0x1d185, 
-    0x1d1aa, 
-    0x1d242, 
-    0xe0100, 
-};
-static int
-esch_unicode_range_mn_up_bound[] = 
-{
-    0x36f, 
-    0x487, 
-    0x5bd, 
-    0x5bf, 
-    0x5c2, 
-    0x5c5, 
-    0x5c7, 
-    0x61a, 
-    0x65f, 
-    0x670, 
-    0x6dc, 
-    0x6e4, 
-    0x6e8, 
-    0x6ed, 
-    0x711, 
-    0x74a, 
-    0x7b0, 
-    0x7f3, 
-    0x819, 
-    0x823, 
-    0x827, 
-    0x82d, 
-    0x85b, 
-    0x8fe, 
-    0x902, 
-    0x93a, 
-    0x93c, 
-    0x948, 
-    0x94d, 
-    0x957, 
-    0x963, 
-    0x981, 
-    0x9bc, 
-    0x9c4, 
-    0x9cd, 
-    0x9e3, 
-    0xa02, 
-    0xa3c, 
-    0xa42, 
-    0xa48, 
-    0xa4d, 
-    0xa51, 
-    0xa71, 
-    0xa75, 
-    0xa82, 
-    0xabc, 
-    0xac5, 
-    0xac8, 
-    0xacd, 
-    0xae3, 
-    0xb01, 
-    0xb3c, 
-    0xb3f, 
-    0xb44, 
-    0xb4d, 
-    0xb56, 
-    0xb63, 
-    0xb82, 
-    0xbc0, 
-    0xbcd, 
-    0xc40, 
-    0xc48, 
-    0xc4d, 
-    0xc56, 
-    0xc63, 
-    0xcbc, 
-    0xcbf, 
-    0xcc6, 
-    0xccd, 
-    0xce3, 
-    0xd44, 
-    0xd4d, 
-    0xd63, 
-    0xdca, 
-    0xdd4, 
-    0xdd6, 
-    0xe31, 
-    0xe3a, 
-    0xe4e, 
-    0xeb1, 
-    0xeb9, 
-    0xebc, 
-    0xecd, 
-    0xf19, 
-    0xf35, 
-    0xf37, 
-    0xf39, 
-    0xf7e, 
-    0xf84, 
-    0xf87, 
-    0xf97, 
-    0xfbc, 
-    0xfc6, 
-    0x1030, 
-    0x1037, 
-    0x103a, 
-    0x103e, 
-    0x1059, 
-    0x1060, 
-    0x1074, 
-    0x1082, 
-    0x1086, 
-    0x108d, 
-    0x109d, 
-    0x135f, 
-    0x1714, 
-    0x1734, 
-    0x1753, 
-    0x1773, 
-    0x17b5, 
-    0x17bd, 
-    0x17c6, 
-    0x17d3, 
-    0x17dd, 
-    0x180d, 
-    0x18a9, 
-    0x1922, 
-    0x1928, 
-    0x1932, 
-    0x193b, 
-    0x1a18, 
-    0x1a56, 
-    0x1a5e, 
-    0x1a60, 
-    0x1a62, 
-    0x1a6c, 
-    0x1a7c, 
-    0x1a7f, 
-    0x1b03, 
-    0x1b34, 
-    0x1b3a, 
-    0x1b3c, 
-    0x1b42, 
-    0x1b73, 
-    0x1b81, 
-    0x1ba5, 
-    0x1ba9, 
-    0x1bab, 
-    0x1be6, 
-    0x1be9, 
-    0x1bed, 
-    0x1bf1, 
-    0x1c33, 
-    0x1c37, 
-    0x1cd2, 
-    0x1ce0, 
-    0x1ce8, 
-    0x1ced, 
-    0x1cf4, 
-    0x1de6, 
-    0x1dff, 
-    0x20dc, 
-    0x20e1, 
-    0x20f0, 
-    0x2cf1, 
-    0x2d7f, 
-    0x2dff, 
-    0x302d, 
-    0x309a, 
-    0xa66f, 
-    0xa67d, 
-    0xa69f, 
-    0xa6f1, 
-    0xa802, 
-    0xa806, 
-    0xa80b, 
-    0xa826, 
-    0xa8c4, 
-    0xa8f1, 
-    0xa92d, 
-    0xa951, 
-    0xa982, 
-    0xa9b3, 
-    0xa9b9, 
-    0xa9bc, 
-    0xaa2e, 
-    0xaa32, 
-    0xaa36, 
-    0xaa43, 
-    0xaa4c, 
-    0xaab0, 
-    0xaab4, 
-    0xaab8, 
-    0xaabf, 
-    0xaac1, 
-    0xaaed, 
-    0xaaf6, 
-    0xabe5, 
-    0xabe8, 
-    0xabed, 
-    0xfb1e, 
-    0xfe0f, 
-    0xfe26, 
-    0x101fd, 
-    0x10a03, 
-    0x10a06, 
-    0x10a0f, 
-    0x10a3a, 
-    0x10a3f, 
-    0x11001, 
-    0x11046, 
-    0x11081, 
-    0x110b6, 
-    0x110ba, 
-    0x11102, 
-    0x1112b, 
-    0x11134, 
-    0x11181, 
-    0x111be, 
-    0x116ab, 
-    0x116ad, 
-    0x116b5, 
-    0x116b7, 
-    0x16f92, 
-    0x1d169, 
-    0x1d182, 
-    0x1d18b, 
-    0x1d1ad, 
-    0x1d244, 
-    0xe01ef, 
-};
 int
 esch_unicode_is_range_mn(esch_unicode ch)
 {
-    size_t n = 0;
-    for (; n < sizeof(esch_unicode_range_mn_up_bound) / sizeof(esch_unicode); ++n)
-    {
-        if (ch >= esch_unicode_range_mn_low_bound[n] && ch <= esch_unicode_range_mn_up_bound[n])
-            return 1;
-    }
-    return 0;
+    return esch_unicode_get_category(ch) == ESCH_UNICODE_CATEGORY_MN;
 }
-#include "esch.h"
-static int
-esch_unicode_range_nd_low_bound[] = 
-{
-    0x30, 
-    0x660, 
-    0x6f0, 
-    0x7c0, 
-    0x966, 
-    0x9e6, 
-    0xa66, 
-    0xae6, 
-    0xb66, 
-    0xbe6, 
-    0xc66, 
-    0xce6, 
-    0xd66, 
-    0xe50, 
-    0xed0, 
-    0xf20, 
-    0x1040, 
-    0x1090, 
-    0x17e0, 
-    0x1810, 
-    0x1946, 
-    0x19d0, 
-    0x1a80, 
-    0x1a90, 
-    0x1b50, 
-    0x1bb0, 
-    0x1c40, 
-    0x1c50, 
-    0xa620, 
-    0xa8d0, 
-    0xa900, 
-    0xa9d0, 
-    0xaa50, 
-    0xabf0, 
-    0xff10, 
-    0x104a0, 
-    0x11066, 
-    0x110f0, 
-    0x11136, 
-    0x111d0, 
-    0x116c0, 
-    0x1d7ce, 
-};
-static int
-esch_unicode_range_nd_up_bound[] = 
+int
+esch_unicode_is_range_mc(esch_unicode ch)
 {
-    0x39, 
-    0x669, 
-    0x6f9, 
-    0x7c9, 
-    0x96f, 
-    0x9ef, 
-    0xa6f, 
-    0xaef, 
-    0xb6f, 
-    0xbef, 
-    0xc6f, 
-    0xcef, 
-    0xd6f, 
-    0xe59, 
-    0xed9, 
-    0xf29, 
-    0x1049, 
-    0x1099, 
-    0x17e9, 
-    0x1819, 
-    0x194f, 
-    0x19d9, 
-    0x1a89, 
-    0x1a99, 
-    0x1b59, 
-    0x1bb9, 
-    0x1c49, 
-    0x1c59, 
-    0xa629, 
-    0xa8d9, 
-    0xa909, 
-    0xa9d9, 
-    0xaa59, 
-    0xabf9, 
-    0xff19, 
-    0x104a9, 
-    0x1106f, 
-    0x110f9, 
-    0x1113f, 
-    0x111d9, 
-    0x116c9, 
-    0x1d7ff, 
-};
+    return esch_unicode_get_category(ch) == ESCH_UNICODE_CATEGORY_MC;
+}
 int
 esch_unicode_is_range_nd(esch_unicode ch)
 {
-    size_t n = 0;
-    for (; n < sizeof(esch_unicode_range_nd_up_bound) / sizeof(esch_unicode); ++n)
-    {
-        if (ch >= esch_unicode_range_nd_low_bound[n] && ch <= esch_unicode_range_nd_up_bound[n])
-            return 1;
-    }
-    return 0;
+    return esch_unicode_get_category(ch) == ESCH_UNICODE_CATEGORY_ND;
 }
-#include "esch.h"
-static int
-esch_unicode_range_nl_low_bound[] = 
-{
-    0x16ee, 
-    0x2160, 
-    0x2185, 
-    0x3007, 
-    0x3021, 
-    0x3038, 
-    0xa6e6, 
-    0x10140, 
-    0x10341, 
-    0x1034a, 
-    0x103d1, 
-    0x12400, 
-};
-static int
-esch_unicode_range_nl_up_bound[] = 
-{
-    0x16f0, 
-    0x2182, 
-    0x2188, 
-    0x3007, 
-    0x3029, 
-    0x303a, 
-    0xa6ef, 
-    0x10174, 
-    0x10341, 
-    0x1034a, 
-    0x103d5, 
-    0x12462, 
-};
 int
 esch_unicode_is_range_nl(esch_unicode ch)
 {
-    size_t n = 0;
-    for (; n < sizeof(esch_unicode_range_nl_up_bound) / sizeof(esch_unicode); ++n)
-    {
-        if (ch >= esch_unicode_range_nl_low_bound[n] && ch <= esch_unicode_range_nl_up_bound[n])
-            return 1;
-    }
-    return 0;
+    return esch_unicode_get_category(ch) == ESCH_UNICODE_CATEGORY_NL;
 }
-#include "esch.h"
-static int
-esch_unicode_range_no_low_bound[] = 
-{
-    0xb2, 
-    0xb9, 
-    0xbc, 
-    0x9f4, 
-    0xb72, 
-    0xbf0, 
-    0xc78, 
-    0xd70, 
-    0xf2a, 
-    0x1369, 
-    0x17f0, 
-    0x19da, 
-    0x2070, 
-    0x2074, 
-    0x2080, 
-    0x2150, 
-    0x2189, 
-    0x2460, 
-    0x24ea, 
-    0x2776, 
-    0x2cfd, 
-    0x3192, 
-    0x3220, 
-    0x3248, 
-    0x3251, 
-    0x3280, 
-    0x32b1, 
-    0xa830, 
-    0x10107, 
-    0x10175, 
-    0x1018a, 
-    0x10320, 
-    0x10858, 
-    0x10916, 
-    0x10a40, 
-    0x10a7d, 
-    0x10b58, 
-    0x10b78, 
-    0x10e60, 
-    0x11052, 
-    0x1d360, 
-    0x1f100, 
-};
-static int
-esch_unicode_range_no_up_bound[] = 
-{
-    0xb3, 
-    0xb9, 
-    0xbe, 
-    0x9f9, 
-    0xb77, 
-    0xbf2, 
-    0xc7e, 
-    0xd75, 
-    0xf33, 
-    0x137c, 
-    0x17f9, 
-    0x19da, 
-    0x2070, 
-    0x2079, 
-    0x2089, 
-    0x215f, 
-    0x2189, 
-    0x249b, 
-    0x24ff, 
-    0x2793, 
-    0x2cfd, 
-    0x3195, 
-    0x3229, 
-    0x324f, 
-    0x325f, 
-    0x3289, 
-    0x32bf, 
-    0xa835, 
-    0x10133, 
-    0x10178, 
-    0x1018a, 
-    0x10323, 
-    0x1085f, 
-    0x1091b, 
-    0x10a47, 
-    0x10a7e, 
-    0x10b5f, 
-    0x10b7f, 
-    0x10e7e, 
-    0x11065, 
-    0x1d371, 
-    0x1f10a, 
-};
 int
 esch_unicode_is_range_no(esch_unicode ch)
 {
-    size_t n = 0;
-    for (; n < sizeof(esch_unicode_range_no_up_bound) / sizeof(esch_unicode); ++n)
-    {
-        if (ch >= esch_unicode_range_no_low_bound[n] && ch <= esch_unicode_range_no_up_bound[n])
-            return 1;
-    }
-    return 0;
+    return esch_unicode_get_category(ch) == ESCH_UNICODE_CATEGORY_NO;
 }
-#include "esch.h"
-static int
-esch_unicode_range_pc_low_bound[] = 
-{
-    0x5f, 
-    0x203f, 
-    0x2054, 
-    0xfe33, 
-    0xfe4d, 
-    0xff3f, 
-};
-static int
-esch_unicode_range_pc_up_bound[] = 
-{
-    0x5f, 
-    0x2040, 
-    0x2054, 
-    0xfe34, 
-    0xfe4f, 
-    0xff3f, 
-};
 int
-esch_unicode_is_range_pc(esch_unicode ch)
+esch_unicode_is_range_pd(esch_unicode ch)
 {
-    size_t n = 0;
-    for (; n < sizeof(esch_unicode_range_pc_up_bound) / sizeof(esch_unicode); ++n)
-    {
-        if (ch >= esch_unicode_range_pc_low_bound[n] && ch <= esch_unicode_range_pc_up_bound[n])
-            return 1;
-    }
-    return 0;
+    return esch_unicode_get_category(ch) == ESCH_UNICODE_CATEGORY_PD;
 }
-#include "esch.h"
-static int
-esch_unicode_range_pd_low_bound[] = 
-{
-    0x2d, 
-    0x58a, 
-    0x5be, 
-    0x1400, 
-    0x1806, 
-    0x2010, 
-    0x2e17, 
-    0x2e1a, 
-    0x2e3a, 
-    0x301c, 
-    0x3030, 
-    0x30a0, 
-    0xfe31, 
-    0xfe58, 
-    0xfe63, 
-    0xff0d, 
-};
-static int
-esch_unicode_range_pd_up_bound[] = 
-{
-    0x2d, 
-    0x58a, 
-    0x5be, 
-    0x1400, 
-    0x1806, 
-    0x2015, 
-    0x2e17, 
-    0x2e1a, 
-    0x2e3b, 
-    0x301c, 
-    0x3030, 
-    0x30a0, 
-    0xfe32, 
-    0xfe58, 
-    0xfe63, 
-    0xff0d, 
-};
 int
-esch_unicode_is_range_pd(esch_unicode ch)
+esch_unicode_is_range_pc(esch_unicode ch)
 {
-    size_t n = 0;
-    for (; n < sizeof(esch_unicode_range_pd_up_bound) / sizeof(esch_unicode); ++n)
-    {
-        if (ch >= esch_unicode_range_pd_low_bound[n] && ch <= esch_unicode_range_pd_up_bound[n])
-            return 1;
-    }
-    return 0;
+    return esch_unicode_get_category(ch) == ESCH_UNICODE_CATEGORY_PC;
 }
-#include "esch.h"
-static int
-esch_unicode_range_po_low_bound[] = 
-{
-    0x21, 
-    0x25, 
-    0x2a, 
-    0x2c, 
-    0x2e, 
-    0x3a, 
-    0x3f, 
-    0x5c, 
-    0xa1, 
-    0xa7, 
-    0xb6, 
-    0xbf, 
-    0x37e, 
-    0x387, 
-    0x55a, 
-    0x589, 
-    0x5c0, 
-    0x5c3, 
-    0x5c6, 
-    0x5f3, 
-    0x609, 
-    0x60c, 
-    0x61b, 
-    0x61e, 
-    0x66a, 
-    0x6d4, 
-    0x700, 
-    0x7f7, 
-    0x830, 
-    0x85e, 
-    0x964, 
-    0x970, 
-    0xaf0, 
-    0xdf4, 
-    0xe4f, 
-    0xe5a, 
-    0xf04, 
-    0xf14, 
-    0xf85, 
-    0xfd0, 
-    0xfd9, 
-    0x104a, 
-    0x10fb, 
-    0x1360, 
-    0x166d, 
-    0x16eb, 
-    0x1735, 
-    0x17d4, 
-    0x17d8, 
-    0x1800, 
-    0x1807, 
-    0x1944, 
-    0x1a1e, 
-    0x1aa0, 
-    0x1aa8, 
-    0x1b5a, 
-    0x1bfc, 
-    0x1c3b, 
-    0x1c7e, 
-    0x1cc0, 
-    0x1cd3, 
-    0x2016, 
-    0x2020, 
-    0x2030, 
-    0x203b, 
-    0x2041, 
-    0x2047, 
-    0x2053, 
-    0x2055, 
-    0x2cf9, 
-    0x2cfe, 
-    0x2d70, 
-    0x2e00, 
-    0x2e06, 
-    0x2e0b, 
-    0x2e0e, 
-    0x2e18, 
-    0x2e1b, 
-    0x2e1e, 
-    0x2e2a, 
-    0x2e30, 
-    0x3001, 
-    0x303d, 
-    0x30fb, 
-    0xa4fe, 
-    0xa60d, 
-    0xa673, 
-    0xa67e, 
-    0xa6f2, 
-    0xa874, 
-    0xa8ce, 
-    0xa8f8, 
-    0xa92e, 
-    0xa95f, 
-    0xa9c1, 
-    0xa9de, 
-    0xaa5c, 
-    0xaade, 
-    0xaaf0, 
-    0xabeb, 
-    0xfe10, 
-    0xfe19, 
-    0xfe30, 
-    0xfe45, 
-    0xfe49, 
-    0xfe50, 
-    0xfe54, 
-    0xfe5f, 
-    0xfe68, 
-    0xfe6a, 
-    0xff01, 
-    0xff05, 
-    0xff0a, 
-    0xff0c, 
-    0xff0e, 
-    0xff1a, 
-    0xff1f, 
-    0xff3c, 
-    0xff61, 
-    0xff64, 
-    0x10100, 
-    0x1039f, 
-    0x103d0, 
-    0x10857, 
-    0x1091f, 
-    0x1093f, 
-    0x10a50, 
-    0x10a7f, 
-    0x10b39, 
-    0x11047, 
-    0x110bb, 
-    0x110be, 
-    0x11140, 
-    0x111c5, 
-    0x12470, 
-};
-static int
-esch_unicode_range_po_up_bound[] = 
-{
-    0x23, 
-    0x27, 
-    0x2a, 
-    0x2c, 
-    0x2f, 
-    0x3b, 
-    0x40, 
-    0x5c, 
-    0xa1, 
-    0xa7, 
-    0xb7, 
-    0xbf, 
-    0x37e, 
-    0x387, 
-    0x55f, 
-    0x589, 
-    0x5c0, 
-    0x5c3, 
-    0x5c6, 
-    0x5f4, 
-    0x60a, 
-    0x60d, 
-    0x61b, 
-    0x61f, 
-    0x66d, 
-    0x6d4, 
-    0x70d, 
-    0x7f9, 
-    0x83e, 
-    0x85e, 
-    0x965, 
-    0x970, 
-    0xaf0, 
-    0xdf4, 
-    0xe4f, 
-    0xe5b, 
-    0xf12, 
-    0xf14, 
-    0xf85, 
-    0xfd4, 
-    0xfda, 
-    0x104f, 
-    0x10fb, 
-    0x1368, 
-    0x166e, 
-    0x16ed, 
-    0x1736, 
-    0x17d6, 
-    0x17da, 
-    0x1805, 
-    0x180a, 
-    0x1945, 
-    0x1a1f, 
-    0x1aa6, 
-    0x1aad, 
-    0x1b60, 
-    0x1bff, 
-    0x1c3f, 
-    0x1c7f, 
-    0x1cc7, 
-    0x1cd3, 
-    0x2017, 
-    0x2027, 
-    0x2038, 
-    0x203e, 
-    0x2043, 
-    0x2051, 
-    0x2053, 
-    0x205e, 
-    0x2cfc, 
-    0x2cff, 
-    0x2d70, 
-    0x2e01, 
-    0x2e08, 
-    0x2e0b, 
-    0x2e16, 
-    0x2e19, 
-    0x2e1b, 
-    0x2e1f, 
-    0x2e2e, 
-    0x2e39, 
-    0x3003, 
-    0x303d, 
-    0x30fb, 
-    0xa4ff, 
-    0xa60f, 
-    0xa673, 
-    0xa67e, 
-    0xa6f7, 
-    0xa877, 
-    0xa8cf, 
-    0xa8fa, 
-    0xa92f, 
-    0xa95f, 
-    0xa9cd, 
-    0xa9df, 
-    0xaa5f, 
-    0xaadf, 
-    0xaaf1, 
-    0xabeb, 
-    0xfe16, 
-    0xfe19, 
-    0xfe30, 
-    0xfe46, 
-    0xfe4c, 
-    0xfe52, 
-    0xfe57, 
-    0xfe61, 
-    0xfe68, 
-    0xfe6b, 
-    0xff03, 
-    0xff07, 
-    0xff0a, 
-    0xff0c, 
-    0xff0f, 
-    0xff1b, 
-    0xff20, 
-    0xff3c, 
-    0xff61, 
-    0xff65, 
-    0x10102, 
-    0x1039f, 
-    0x103d0, 
-    0x10857, 
-    0x1091f, 
-    0x1093f, 
-    0x10a58, 
-    0x10a7f, 
-    0x10b3f, 
-    0x1104d, 
-    0x110bc, 
-    0x110c1, 
-    0x11143, 
-    0x111c8, 
-    0x12473, 
-};
 int
 esch_unicode_is_range_po(esch_unicode ch)
 {
-    size_t n = 0;
-    for (; n < sizeof(esch_unicode_range_po_up_bound) / sizeof(esch_unicode); ++n)
-    {
-        if (ch >= esch_unicode_range_po_low_bound[n] && ch <= esch_unicode_range_po_up_bound[n])
-            return 1;
-    }
-    return 0;
+    return esch_unicode_get_category(ch) == ESCH_UNICODE_CATEGORY_PO;
 }
-#include "esch.h"
-static int
-esch_unicode_range_sc_low_bound[] = 
-{
-    0x24, 
-    0xa2, 
-    0x58f, 
-    0x60b, 
-    0x9f2, 
-    0x9fb, 
-    0xaf1, 
-    0xbf9, 
-    0xe3f, 
-    0x17db, 
-    0x20a0, 
-    0xa838, 
-    0xfdfc, 
-    0xfe69, 
-    0xff04, 
-    0xffe0, 
-    0xffe5, 
-};
-static int
-esch_unicode_range_sc_up_bound[] = 
-{
-    0x24, 
-    0xa5, 
-    0x58f, 
-    0x60b, 
-    0x9f3, 
-    0x9fb, 
-    0xaf1, 
-    0xbf9, 
-    0xe3f, 
-    0x17db, 
-    0x20b9, 
-    0xa838, 
-    0xfdfc, 
-    0xfe69, 
-    0xff04, 
-    0xffe1, 
-    0xffe6, 
-};
 int
 esch_unicode_is_range_sc(esch_unicode ch)
 {
-    size_t n = 0;
-    for (; n < sizeof(esch_unicode_range_sc_up_bound) / sizeof(esch_unicode); ++n)
-    {
-        if (ch >= esch_unicode_range_sc_low_bound[n] && ch <= esch_unicode_range_sc_up_bound[n])
-            return 1;
-    }
-    return 0;
+    return esch_unicode_get_category(ch) == ESCH_UNICODE_CATEGORY_SC;
 }
-#include "esch.h"
-static int
-esch_unicode_range_sk_low_bound[] = 
-{
-    0x5e, 
-    0x60, 
-    0xa8, 
-    0xaf, 
-    0xb4, 
-    0xb8, 
-    0x2c2, 
-    0x2d2, 
-    0x2e5, 
-    0x2ed, 
-    0x2ef, 
-    0x375, 
-    0x384, 
-    0x1fbd, 
-    0x1fbf, 
-    0x1fcd, 
-    0x1fdd, 
-    0x1fed, 
-    0x1ffd, 
-    0x309b, 
-    0xa700, 
-    0xa720, 
-    0xa789, 
-    0xfbb2, 
-    0xff3e, 
-    0xff40, 
-    0xffe3, 
-};
-static int
-esch_unicode_range_sk_up_bound[] = 
+int
+esch_unicode_is_range_sm(esch_unicode ch)
 {
-    0x5e, 
-    0x60, 
-    0xa8, 
-    0xaf, 
-    0xb4, 
-    0xb8, 
-    0x2c5, 
-    0x2df, 
-    0x2eb, 
-    0x2ed, 
-    0x2ff, 
-    0x375, 
-    0x385, 
-    0x1fbd, 
-    0x1fc1, 
-    0x1fcf, 
-    0x1fdf, 
-    0x1fef, 
-    0x1ffe, 
-    0x309c, 
-    0xa716, 
-    0xa721, 
-    0xa78a, 
-    0xfbc1, 
-    0xff3e, 
-    0xff40, 
-    0xffe3, 
-};
+    return esch_unicode_get_category(ch) == ESCH_UNICODE_CATEGORY_SM;
+}
 int
 esch_unicode_is_range_sk(esch_unicode ch)
 {
-    size_t n = 0;
-    for (; n < sizeof(esch_unicode_range_sk_up_bound) / sizeof(esch_unicode); ++n)
-    {
-        if (ch >= esch_unicode_range_sk_low_bound[n] && ch <= esch_unicode_range_sk_up_bound[n])
-            return 1;
-    }
-    return 0;
+    return esch_unicode_get_category(ch) == ESCH_UNICODE_CATEGORY_SK;
 }
-#include "esch.h"
-static int
-esch_unicode_range_sm_low_bound[] = 
-{
-    0x2b, 
-    0x3c, 
-    0x7c, 
-    0x7e, 
-    0xac, 
-    0xb1, 
-    0xd7, 
-    0xf7, 
-    0x3f6, 
-    0x606, 
-    0x2044, 
-    0x2052, 
-    0x207a, 
-    0x208a, 
-    0x2118, 
-    0x2140, 
-    0x214b, 
-    0x2190, 
-    0x219a, 
-    0x21a0, 
-    0x21a3, 
-    0x21a6, 
-    0x21ae, 
-    0x21ce, 
-    0x21d2, 
-    0x21d4, 
-    0x21f4, 
-    0x2308, 
-    0x2320, 
-    0x237c, 
-    0x239b, 
-    0x23dc, 
-    0x25b7, 
-    0x25c1, 
-    0x25f8, 
-    0x266f, 
-    0x27c0, 
-    0x27c7, 
-    0x27f0, 
-    0x2900, 
-    0x2999, 
-    0x29dc, 
-    0x29fe, 
-    0x2b30, 
-    0x2b47, 
-    0xfb29, 
-    0xfe62, 
-    0xfe64, 
-    0xff0b, 
-    0xff1c, 
-    0xff5c, 
-    0xff5e, 
-    0xffe2, 
-    0xffe9, 
-    0x1d6c1, 
-    0x1d6db, 
-    0x1d6fb, 
-    0x1d715, 
-    0x1d735, 
-    0x1d74f, 
-    0x1d76f, 
-    0x1d789, 
-    0x1d7a9, 
-    0x1d7c3, 
-    0x1eef0, 
-};
-static int
-esch_unicode_range_sm_up_bound[] = 
+int
+esch_unicode_is_range_so(esch_unicode ch)
 {
-    0x2b, 
-    0x3e, 
-    0x7c, 
-    0x7e, 
-    0xac, 
-    0xb1, 
-    0xd7, 
-    0xf7, 
-    0x3f6, 
-    0x608, 
-    0x2044, 
-    0x2052, 
-    0x207c, 
-    0x208c, 
-    0x2118, 
-    0x2144, 
-    0x214b, 
-    0x2194, 
-    0x219b, 
-    0x21a0, 
-    0x21a3, 
-    0x21a6, 
-    0x21ae, 
-    0x21cf, 
-    0x21d2, 
-    0x21d4, 
-    0x22ff, 
-    0x230b, 
-    0x2321, 
-    0x237c, 
-    0x23b3, 
-    0x23e1, 
-    0x25b7, 
-    0x25c1, 
-    0x25ff, 
-    0x266f, 
-    0x27c4, 
-    0x27e5, 
-    0x27ff, 
-    0x2982, 
-    0x29d7, 
-    0x29fb, 
-    0x2aff, 
-    0x2b44, 
-    0x2b4c, 
-    0xfb29, 
-    0xfe62, 
-    0xfe66, 
-    0xff0b, 
-    0xff1e, 
-    0xff5c, 
-    0xff5e, 
-    0xffe2, 
-    0xffec, 
-    0x1d6c1, 
-    0x1d6db, 
-    0x1d6fb, 
-    0x1d715, 
-    0x1d735, 
-    0x1d74f, 
-    0x1d76f, 
-    0x1d789, 
-    0x1d7a9, 
-    0x1d7c3, 
-    0x1eef1, 
-};
+    return esch_unicode_get_category(ch) == ESCH_UNICODE_CATEGORY_SO;
+}
 int
-esch_unicode_is_range_sm(esch_unicode ch)
+esch_unicode_is_range_co(esch_unicode ch)
 {
-    size_t n = 0;
-    for (; n < sizeof(esch_unicode_range_sm_up_bound) / sizeof(esch_unicode); ++n)
-    {
-        if (ch >= esch_unicode_range_sm_low_bound[n] && ch <= esch_unicode_range_sm_up_bound[n])
-            return 1;
-    }
-    return 0;
+    return esch_unicode_get_category(ch) == ESCH_UNICODE_CATEGORY_CO;
 }
-#include "esch.h"
-static int
-esch_unicode_range_so_low_bound[] = 
+
+/*
+ * Identifier classes of ASCII characters, for inline checks:
+ * ESCH_IDENTIFIER_INITIAL | ESCH_IDENTIFIER_SUBSEQUENT.
+ */
+const unsigned char
+esch_unicode_identifier_ascii[] =
 {
-    0xa6, 
-    0xa9, 
-    0xae, 
-    0xb0, 
-    0x482, 
-    0x60e, 
-    0x6de, 
-    0x6e9, 
-    0x6fd, 
-    0x7f6, 
-    0x9fa, 
-    0xb70, 
-    0xbf3, 
-    0xbfa, 
-    0xc7f, 
-    0xd79, 
-    0xf01, 
-    0xf13, 
-    0xf15, 
-    0xf1a, 
-    0xf34, 
-    0xf36, 
-    0xf38, 
-    0xfbe, 
-    0xfc7, 
-    0xfce, 
-    0xfd5, 
-    0x109e, 
-    0x1390, 
-    0x1940, 
-    0x19de, 
-    0x1b61, 
-    0x1b74, 
-    0x2100, 
-    0x2103, 
-    0x2108, 
-    0x2114, 
-    0x2116, 
-    0x211e, 
-    0x2125, 
-    0x2127, 
-    0x2129, 
-    0x212e, 
-    0x213a, 
-    0x214a, 
-    0x214c, 
-    0x214f, 
-    0x2195, 
-    0x219c, 
-    0x21a1, 
-    0x21a4, 
-    0x21a7, 
-    0x21af, 
-    0x21d0, 
-    0x21d3, 
-    0x21d5, 
-    0x2300, 
-    0x230c, 
-    0x2322, 
-    0x232b, 
-    0x237d, 
-    0x23b4, 
-    0x23e2, 
-    0x2400, 
-    0x2440, 
-    0x249c, 
-    0x2500, 
-    0x25b8, 
-    0x25c2, 
-    0x2600, 
-    0x2670, 
-    0x2701, 
-    0x2794, 
-    0x2800, 
-    0x2b00, 
-    0x2b45, 
-    0x2b50, 
-    0x2ce5, 
-    0x2e80, 
-    0x2e9b, 
-    0x2f00, 
-    0x2ff0, 
-    0x3004, 
-    0x3012, 
-    0x3020, 
-    0x3036, 
-    0x303e, 
-    0x3190, 
-    0x3196, 
-    0x31c0, 
-    0x3200, 
-    0x322a, 
-    0x3250, 
-    0x3260, 
-    0x328a, 
-    0x32c0, 
-    0x3300, 
-    0x4dc0, 
-    0xa490, 
-    0xa828, 
-    0xa836, 
-    0xa839, 
-    0xaa77, 
-    0xfdfd, 
-    0xffe4, 
-    0xffe8, 
-    0xffed, 
-    0xfffc, 
-    0x10137, 
-    0x10179, 
-    0x10190, 
-    0x101d0, 
-    0x1d000, 
-    0x1d100, 
-    0x1d129, 
-    0x1d16a, 
-    0x1d183, 
-    0x1d18c, 
-    0x1d1ae, 
-    0x1d200, 
-    0x1d245, 
-    0x1d300, 
-    0x1f000, 
-    0x1f030, 
-    0x1f0a0, 
-    0x1f0b1, 
-    0x1f0c1, 
-    0x1f0d1, 
-    0x1f110, 
-    0x1f130, 
-    0x1f170, 
-    0x1f1e6, 
-    0x1f210, 
-    0x1f240, 
-    0x1f250, 
-    0x1f300, 
-    0x1f330, 
-    0x1f337, 
-    0x1f380, 
-    0x1f3a0, 
-    0x1f3c6, 
-    0x1f3e0, 
-    0x1f400, 
-    0x1f440, 
-    0x1f442, 
-    0x1f4f9, 
-    0x1f500, 
-    0x1f540, 
-    0x1f550, 
-    0x1f5fb, 
-    0x1f645, 
-    0x1f680, 
-    0x1f700, 
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 3, 1, 1, 3, 3, 3, 1, 1, 1, 3, 3, 1, 3, 3, 3,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 3, 1, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 1, 1, 1, 3, 3,
+    1, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 1, 1, 1, 3, 1,
 };
-static int
-esch_unicode_range_so_up_bound[] = 
+
+/*
+ * Identifier bitsets, in blocks of 256 code points. Each block
+ * has 8 words for first character, then 8 words for other
+ * characters. Blocks with same content are shared.
+ */
+#define ESCH_IDENTIFIER_SHIFT 8
+#define ESCH_IDENTIFIER_WORDS 8
+#define ESCH_IDENTIFIER_BLOCK(ch) \
+    (esch_unicode_identifier_bits + \
+     esch_unicode_identifier_stage1[(ch) >> ESCH_IDENTIFIER_SHIFT] * \
+     ESCH_IDENTIFIER_WORDS * 2)
+
+static const unsigned char
+esch_unicode_identifier_stage1[] =
 {
-    0xa6, 
-    0xa9, 
-    0xae, 
-    0xb0, 
-    0x482, 
-    0x60f, 
-    0x6de, 
-    0x6e9, 
-    0x6fe, 
-    0x7f6, 
-    0x9fa, 
-    0xb70, 
-    0xbf8, 
-    0xbfa, 
-    0xc7f, 
-    0xd79, 
-    0xf03, 
-    0xf13, 
-    0xf17, 
-    0xf1f, 
-    0xf34, 
-    0xf36, 
-    0xf38, 
-    0xfc5, 
-    0xfcc, 
-    0xfcf, 
-    0xfd8, 
-    0x109f, 
-    0x1399, 
-    0x1940, 
-    0x19ff, 
-    0x1b6a, 
-    0x1b7c, 
-    0x2101, 
-    0x2106, 
-    0x2109, 
-    0x2114, 
-    0x2117, 
-    0x2123, 
-    0x2125, 
-    0x2127, 
-    0x2129, 
-    0x212e, 
-    0x213b, 
-    0x214a, 
-    0x214d, 
-    0x214f, 
-    0x2199, 
-    0x219f, 
-    0x21a2, 
-    0x21a5, 
-    0x21ad, 
-    0x21cd, 
-    0x21d1, 
-    0x21d3, 
-    0x21f3, 
-    0x2307, 
-    0x231f, 
-    0x2328, 
-    0x237b, 
-    0x239a, 
-    0x23db, 
-    0x23f3, 
-    0x2426, 
-    0x244a, 
-    0x24e9, 
-    0x25b6, 
-    0x25c0, 
-    0x25f7, 
-    0x266e, 
-    0x26ff, 
-    0x2767, 
-    0x27bf, 
-    0x28ff, 
-    0x2b2f, 
-    0x2b46, 
-    0x2b59, 
-    0x2cea, 
-    0x2e99, 
-    0x2ef3, 
-    0x2fd5, 
-    0x2ffb, 
-    0x3004, 
-    0x3013, 
-    0x3020, 
-    0x3037, 
-    0x303f, 
-    0x3191, 
-    0x319f, 
-    0x31e3, 
-    0x321e, 
-    0x3247, 
-    0x3250, 
-    0x327f, 
-    0x32b0, 
-    0x32fe, 
-    0x33ff, 
-    0x4dff, 
-    0xa4c6, 
-    0xa82b, 
-    0xa837, 
-    0xa839, 
-    0xaa79, 
-    0xfdfd, 
-    0xffe4, 
-    0xffe8, 
-    0xffee, 
-    0xfffd, 
-    0x1013f, 
-    0x10189, 
-    0x1019b, 
-    0x101fc, 
-    0x1d0f5, 
-    0x1d126, 
-    0x1d164, 
-    0x1d16c, 
-    0x1d184, 
-    0x1d1a9, 
-    0x1d1dd, 
-    0x1d241, 
-    0x1d245, 
-    0x1d356, 
-    0x1f02b, 
-    0x1f093, 
-    0x1f0ae, 
-    0x1f0be, 
-    0x1f0cf, 
-    0x1f0df, 
-    0x1f12e, 
-    0x1f16b, 
-    0x1f19a, 
-    0x1f202, 
-    0x1f23a, 
-    0x1f248, 
-    0x1f251, 
-    0x1f320, 
-    0x1f335, 
-    0x1f37c, 
-    0x1f393, 
-    0x1f3c4, 
-    0x1f3ca, 
-    0x1f3f0, 
-    0x1f43e, 
-    0x1f440, 
-    0x1f4f7, 
-    0x1f4fc, 
-    0x1f53d, 
-    0x1f543, 
-    0x1f567, 
-    0x1f640, 
-    0x1f64f, 
-    0x1f6c5, 
-    0x1f773, 
+    0, 1, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14,
+    15, 1, 16, 17, 1, 1, 18, 19, 20, 21, 22, 23, 24, 25, 1, 26,
+    27, 28, 1, 29, 30, 1, 1, 31, 1, 32, 1, 33, 34, 35, 36, 37,
+    38, 39, 40, 1, 41, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42,
+    42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 43, 41, 42,
+    42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42,
+    42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42,
+    42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42,
+    42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42,
+    42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 44,
+    1, 1, 1, 1, 45, 1, 46, 47, 48, 49, 50, 51, 41, 42, 42, 42,
+    42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42,
+    42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42,
+    42, 42, 42, 42, 42, 42, 42, 52, 42, 42, 42, 42, 42, 42, 42, 42,
+    41, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42,
+    42, 42, 42, 42, 42, 42, 42, 42, 53, 1, 54, 55, 1, 56, 57, 58,
+    59, 60, 61, 62, 63, 42, 42, 42, 64, 65, 66, 67, 68, 42, 69, 42,
+    70, 71, 42, 42, 42, 42, 72, 42, 42, 42, 42, 42, 42, 42, 42, 42,
+    1, 1, 1, 73, 74, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42,
+    1, 1, 1, 1, 75, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42,
+    42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42,
+    42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42,
+    42, 42, 42, 42, 42, 42, 42, 42, 1, 1, 76, 42, 42, 42, 42, 77,
+    42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42,
+    42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42,
+    42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42,
+    42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42,
+    78, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42,
+    42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42,
+    79, 80, 81, 82, 83, 84, 85, 86, 42, 42, 42, 42, 42, 42, 42, 42,
+    42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 87, 42,
+    88, 89, 90, 91, 92, 93, 94, 95, 42, 42, 42, 42, 42, 42, 42, 42,
+    41, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42,
+    42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42,
+    42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42,
+    42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42,
+    42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42,
+    42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42,
+    42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42,
+    42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42,
+    42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42,
+    42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42,
+    42, 42, 42, 42, 42, 42, 96, 41, 42, 42, 42, 42, 42, 42, 42, 42,
+    42, 42, 42, 42, 42, 42, 42, 97, 98, 42, 42, 42, 42, 42, 42, 42,
+    42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42,
+    42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42,
+    42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42,
+    42, 42, 42, 42, 42, 42, 42, 42, 1, 1, 99, 42, 42, 42, 42, 42,
+    42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42,
+    42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42,
+    42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42,
+    42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42,
+    42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42,
+    42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42,
+    42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42,
+    42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42,
+    42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42,
+    42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42,
+    42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42,
+    42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42,
+    42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42,
+    42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42,
+    42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42,
+    42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42,
+    42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42,
+    42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42,
+    42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42,
+    42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42,
+    42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42,
+    42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42,
+    42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42,
+    42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42,
+    42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42,
+    42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42,
+    42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42,
+    42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42,
+    42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42,
+    42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42,
+    42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42,
+    42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42,
+    42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42,
+    42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42,
+    42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42,
+    42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42,
+    42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42,
+    42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42,
+    42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42,
+    42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42,
+    42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42,
+    42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42,
+    42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42,
+    42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42,
+    42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42,
+    42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42,
+    42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42,
+    42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42,
+    42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42,
+    42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42,
+    42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42,
+    42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42,
+    42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42,
+    42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42,
+    42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42,
+    42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42,
+    42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42,
+    42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42,
+    42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42,
+    42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42,
+    42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42,
+    42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42,
+    42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42,
+    42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42,
+    42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42,
+    42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42,
+    42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42,
+    42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42,
+    42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42,
+    42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42,
+    42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42,
+    42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42,
+    42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42,
+    42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42,
+    42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42,
+    42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42,
+    42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42,
+    42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42,
+    42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42,
+    42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42,
+    42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42,
+    42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42,
+    42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42,
+    42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42,
+    42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42,
+    42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42,
+    42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42,
+    42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42,
+    42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42,
+    42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42,
+    42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42,
+    42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42,
+    42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42,
+    42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42,
+    42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42,
+    42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42,
+    42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42,
+    42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42,
+    42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42,
+    42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42,
+    42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42,
+    42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42,
+    42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42,
+    42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42,
+    42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42,
+    42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42,
+    42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42,
+    42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42,
+    42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42,
+    42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42,
+    42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42,
+    42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42,
+    42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42,
+    42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42,
+    42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42,
+    42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42,
+    42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42,
+    42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42,
+    42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42,
+    42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42,
+    42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42,
+    42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42,
+    42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42,
+    42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42,
+    42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42,
+    42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42,
+    42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42,
+    42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42,
+    42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42,
+    42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42,
+    42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42,
+    42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42,
+    42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42,
+    42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42,
+    42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42,
+    42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42,
+    42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42,
+    42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42,
+    42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42,
+    42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42,
+    42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42,
+    42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42,
+    42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42,
+    42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42,
+    42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42,
+    42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42,
+    42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42,
+    42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42,
+    42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42,
+    42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42,
+    42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42,
+    42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42,
+    42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42,
+    42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42,
+    42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42,
+    42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42,
+    42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42,
+    42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42,
+    42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42,
+    42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42,
+    42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42,
+    42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42,
+    42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42,
+    42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42,
+    42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42,
+    42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42,
+    42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42,
+    42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42,
+    42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42,
+    42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42,
+    42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42,
+    42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42,
+    42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42,
+    42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42,
+    42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42,
+    42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42,
+    42, 100, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42,
+    42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42,
+    42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42,
+    42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42,
+    42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42,
+    42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42,
+    42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42,
+    42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42,
+    42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42,
+    42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42,
+    42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42,
+    42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42,
+    42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42,
+    42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42,
+    42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42,
+    42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42,
+    41, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42,
+    42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42,
+    42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42,
+    42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42,
+    42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42,
+    42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42,
+    42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42,
+    42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42,
+    42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42,
+    42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42,
+    42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42,
+    42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42,
+    42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42,
+    42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42,
+    42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42,
+    42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 101,
+    41, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42,
+    42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42,
+    42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42,
+    42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42,
+    42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42,
+    42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42,
+    42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42,
+    42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42,
+    42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42,
+    42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42,
+    42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42,
+    42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42,
+    42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42,
+    42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42,
+    42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42,
+    42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 101,
 };
+static const uint32_t
+esch_unicode_identifier_bits[] =
+{
+    0xffffffff, 0xfc00ffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0x8df3ffff, 0xffffffff, 0xffffffff,
+    0x00000000, 0xf7ffec72, 0xc7ffffff, 0x47fffffe,
+    0x00000000, 0xf7ffd7fe, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0x7cffffff,
+    0xffffd7f0, 0xfffffffb, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xfffffcff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xfffe00ff, 0xfe7fffff, 0xfffffffe,
+    0xfffe86ff, 0xffffffff, 0xffff00ff, 0x001f07ff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xfffffc00,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xfc00ffff,
+    0xcfffffc0, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xdfffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xfffffc00, 0xffffffff,
+    0xffff3fff, 0xffffffff, 0xffffe7ff, 0xffffffff,
+    0xffffffff, 0x0003ffff, 0xffffffff, 0x07ffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0x7fff3fff, 0x4fffffff, 0x00000000,
+    0x00000000, 0x00001ffd, 0x00000000, 0x7ffffff0,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffff003f,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xfc0f003f,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xfeffffff,
+    0xfff99fee, 0xf3c5fdff, 0xb080799f, 0x0fffffcf,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffff003f,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffff003f,
+    0xfff987ee, 0xd36dfdff, 0x5e023987, 0x003fffc0,
+    0xfffbbfee, 0xf3edfdff, 0x00013bbf, 0x0003ffcf,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xff03003f,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xfff8003f,
+    0xfff99fee, 0xf3edfdff, 0xb0c0399f, 0x00ffffcf,
+    0xd63dc7ec, 0xc3ffc718, 0x00813dc7, 0x07ffffc0,
+    0xffffffff, 0xffffffff, 0xffffffff, 0x80ff003f,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffff003f,
+    0xfffddfee, 0xe3effdff, 0x03603ddf, 0xff00ffcf,
+    0xfffddfec, 0xf3effdff, 0x40603ddf, 0x0006ffcf,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffc0003f,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xfffddfec, 0xe7ffffff, 0x00807ddf, 0xfe3fffcf,
+    0xfc7fffec, 0x2ffbffff, 0xff5f847f, 0x001c0000,
+    0xffffffff, 0xffffffff, 0xfc00ffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xfc00ffff, 0xffffffff,
+    0xfffffffe, 0x87ffffff, 0x0fffffff, 0x00000000,
+    0xfef02596, 0x3bffecae, 0xf3ff3f5f, 0x00000000,
+    0xffffffff, 0xfff00000, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xc3ffffff, 0xfffffeff, 0xfffe1fff,
+    0xfeffffff, 0xdfffffff, 0x07ffdfff, 0x00000000,
+    0xffffffff, 0xffffffff, 0xfffffc00, 0xffffffff,
+    0xfc00ffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffff20bf, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0x3d7f3dff, 0xffffffff,
+    0xffff3dff, 0x7f3dffff, 0xff7fff3d, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xe00001ff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xff3dffff, 0xffffffff, 0xe7ffffff, 0x1fffffff,
+    0x03ffffff, 0xffffffff, 0xffffffff, 0x001fffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xfffe3fff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0x07fffffe, 0xffffffff, 0xffffffff, 0x0001ffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xfc00fc00,
+    0x001fdfff, 0x007fffff, 0x000fffff, 0x000ddfff,
+    0xffffffff, 0xffffffff, 0x3fffffff, 0x03ff03ff,
+    0xfc00ffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0x03ff3fff, 0xffffffff, 0xffffffff, 0x00ffffff,
+    0xffffffff, 0xffff07ff, 0xffffffff, 0x003fffff,
+    0xffffffff, 0xffffffff, 0xffff003f, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xf800ffff, 0xffffffff,
+    0x1fffffff, 0x0fff0fff, 0xfffffff1, 0x001f3fff,
+    0xffffffff, 0xffff0fff, 0xc7ff03ff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xfc00fc00, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xcfffffff, 0xffffffff, 0x7fffffff, 0x9fffffff,
+    0x03ff03ff, 0x00003fff, 0x00000000, 0x00000000,
+    0xffffffff, 0xffffffff, 0xfc00ffff, 0xffffffff,
+    0xffffffff, 0xfc00ffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffff0fff, 0x1fffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xf00fffff,
+    0xffffffff, 0xffffffff, 0xfc00fc00, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xf8ffffff, 0xffffe3ff, 0xffffffff,
+    0x00000000, 0x00000000, 0xffff00ff, 0x007fffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xf000007f,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0x3f3fffff, 0xffffffff, 0xaaff3f3f, 0x3fffffff,
+    0xffffffff, 0xffdfffff, 0xefcfffdf, 0x7fdcffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xfc0effff,
+    0xfffffc00, 0xffffffff, 0xffffffff, 0xffffffff,
+    0x00ff0000, 0xf9ff00ff, 0x7fffff9f, 0x9ff30000,
+    0x1fff1fff, 0x03ffffff, 0x1fff0000, 0x0001ffe2,
+    0xffffffff, 0xffffffff, 0x0000ffff, 0x00000000,
+    0xfffffc18, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffff03ff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xfffff9ff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0x000fffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0x00000000,
+    0xf0000000, 0xffffffff, 0xffffffff, 0x000003ff,
+    0xffffffff, 0x0000007f, 0x000007ff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0x003fffff,
+    0xfff00000, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xfffffffe, 0xffffffff, 0xffffffff, 0xffc000ff,
+    0xffffffff, 0xffffffff, 0xffffff9f, 0xffff003f,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xfe000007, 0xffffffff, 0xf0ffffff, 0xcfffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0x03ff1fff, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xdfffffff,
+    0xffffffff, 0xffff7fff, 0x7fffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xfe0fffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffff20bf, 0xffffffff, 0x800180ff,
+    0x007fffff, 0x7f7f7f7f, 0x7f7f7f7f, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xcfffc9c3, 0x0ffffc00, 0x00000000, 0x00000000,
+    0xfbffffff, 0xffffffff, 0xffffffff, 0x000fffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0x003fffff, 0x0fff0000,
+    0xffffff7f, 0xf8fffc01, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0x100c00fe, 0xffffffff, 0xfffffffe, 0xffffffff,
+    0xfe7fffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffc3ffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffe0, 0xfffe3fff, 0xffffffff, 0xffffffff,
+    0xffff7fff, 0x07ffffff, 0xffffffff, 0xffff000f,
+    0xffffffff, 0xfffffc00, 0x000100ff, 0xffffffff,
+    0xfffffc00, 0x0001ffff, 0xffffffff, 0xffffffff,
+    0x7fffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0x7fffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0x00000001, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00200000, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00001000, 0x00000000,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffff1fff, 0xffffffff, 0xffff007f, 0xffffffff,
+    0xffffffff, 0xfffffc00, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffff003f,
+    0xffffffff, 0x00000fff, 0xffffffff, 0xfff8ffff,
+    0x80ffffff, 0xffffffff, 0xffffffff, 0x00ffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0x000f7fff, 0x000007ff, 0x00000000, 0xff000000,
+    0xffffffff, 0xffc0ffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xfc00ffff, 0xffffffff,
+    0xffffffff, 0x03ff0fff, 0xffffffff, 0x00ffffff,
+    0xffffffff, 0xffffffff, 0x03ffc01f, 0x0fffffff,
+    0xfffffc00, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xfc00ffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0x800fffff, 0x1fffffff,
+    0xffffffff, 0xffffffff, 0xc3ffbfff, 0x00000000,
+    0xffffffff, 0xffffffff, 0xfc00ffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0x007fffff, 0xf3ff3fff, 0x0fffffff,
+    0xffffffff, 0xffffffff, 0xf8000007, 0x007fffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xfc00ffff,
+    0x007e7e7e, 0x00007f7f, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0xffffffff, 0x03ff3fff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0xffff0008, 0xfffff87f, 0x0fffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x80000000,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffff3fff,
+    0xffffffff, 0xffffffff, 0x03ffffff, 0x00000000,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xe0f8007f, 0x5f7fffff, 0xffffffdb, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xfff80003, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0x3fffffff, 0xffff0000, 0xffffffff,
+    0xfffcffff, 0xffffffff, 0x000000ff, 0x3fff0000,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0x027fffff, 0x001f007f, 0x81f7fe60, 0xffdf0f7f,
+    0xffffffff, 0xffffffff, 0xffffffff, 0x1fffffff,
+    0xfc00ffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xfffffcfe, 0xd7ffffff, 0x57ffffff, 0xfffffff2,
+    0xffffffff, 0x7fffffff, 0x1cfcfcfc, 0x30007f7f,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffefff, 0xb7ffff7f, 0x3fff3fff, 0x00000000,
+    0xffffffff, 0xffffffff, 0xffffffff, 0x07ffffff,
+    0x0000007f, 0xfff00000, 0x00000000, 0xfe000000,
+    0xfffffbff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffff87, 0xff8fffff, 0xffffffff, 0xffffffff,
+    0x0fff07ff, 0x00000000, 0xffff0000, 0x3fffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x1fffffff, 0xffffffff, 0x0001ffff, 0x00000000,
+    0xffffffff, 0xfffffff0, 0xfffffbfd, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffc1ffff, 0xffffffff,
+    0x7fffffff, 0xffff000f, 0x000007ff, 0x00000000,
+    0xbfffffff, 0xffffffff, 0x003fff0f, 0x00000000,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xfffffc00, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0x3fffffff, 0x000003ff, 0x00000000, 0x00000000,
+    0xffffffff, 0xffffffff, 0x00ffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xfffffd3f, 0x91bfffff, 0xffbfffff, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0xf03fffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0x8fffffff, 0x83ffffff, 0x00000000, 0x00000000,
+    0xffffffff, 0xc0ffffff, 0x00000000, 0x00000000,
+    0xffffffff, 0xffffffff, 0xffffff00, 0x9fffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xfeeff06f, 0x870fffff, 0x01ff00ff, 0xffffffff,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0xffffffff, 0xffffffff, 0x00ffffff, 0x00ffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xfe3fffff, 0xff3fffff, 0xff07ffff,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0x000001ff, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0xffffffff, 0xffffffff, 0xffffffff, 0x80000000,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0x00000000, 0x00000000, 0x00000000, 0x7fffffff,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0xffffffff, 0xffffffff, 0x0003ffff, 0xffff0000,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xfc00ffff,
+    0xffffffff, 0xffffffff, 0xfffc3fff, 0x0000ffff,
+    0xffffffff, 0xdfffffff, 0xffff0003, 0x03ff01ff,
+    0xffffffff, 0x003fffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xfc00ffff, 0xffffffff,
+    0xffffffff, 0xffdfffff, 0x0000000f, 0x00000000,
+    0xffffffff, 0xffffffff, 0x03ff01ff, 0x00000000,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xfffffc00, 0xffffffff,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0xffffffff, 0x00ffffff, 0x000003ff, 0x00000000,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0x00007fff,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0xfffffff8,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0x000f0007,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0x00007fff, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0x01ffffff, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffff001f, 0x7fffffff,
+    0xffff8000, 0x00000000, 0x00000000, 0x00000000,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0x00000003, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0x003fffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xfffffe7f, 0xffffffff, 0xf807ffff,
+    0xffffffff, 0xffffffff, 0x3fffffff, 0x00000000,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0x0000003f, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xfffc0000,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0x007fffff, 0x0003ffff,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffdfffff, 0xffffffff,
+    0xdfffffff, 0xebffde64, 0xffffffef, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xdfdfe7bf, 0x7bffffff, 0xfffdfc5f, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffff3f, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0x00003fff, 0x00000000,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffcfff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffef, 0x0af7fe96, 0xaa96ea84, 0x5ef7f796,
+    0x0ffffbff, 0x0ffffbee, 0x00000000, 0x00030000,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffff0fff, 0xffffffff, 0xffffffff,
+    0x000fffff, 0x7ffe7fff, 0xfffefffe, 0x00000000,
+    0xfffff800, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffff07ff, 0xffff7fff, 0xffffffff, 0xffff0fff,
+    0x07ffffff, 0x00000000, 0x00000000, 0xffffffc0,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffff0007, 0x07ffffff, 0x000301ff, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffbf0001, 0xffffffff, 0x1fffffff,
+    0x000fffff, 0xffffffff, 0x000007df, 0x0001ffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0x7fffffff, 0xfffffffd, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0x1effffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0x3fffffff, 0xffff000f, 0x000000ff,
+    0x00000000, 0x00000000, 0x00000000, 0xf8000000,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0x0000ffe1, 0x00000000,
+    0xffffffff, 0xffffffff, 0x0000003f, 0x00000000,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0x000fffff,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00400000, 0x00000000,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0x00000000, 0x00100000, 0x00000001, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0x20000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0x3fffffff, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0x0000ffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x20000000,
+};
+
 int
-esch_unicode_is_range_so(esch_unicode ch)
+esch_unicode_is_identifier_initial(esch_unicode ch)
+{
+    const uint32_t* block = NULL;
+    if (ch < 0 || ch > 0x10FFFF)
+        return 0;
+    block = ESCH_IDENTIFIER_BLOCK(ch);
+    return (block[(ch >> 5) & (ESCH_IDENTIFIER_WORDS - 1)] >> (ch & 31)) & 1;
+}
+int
+esch_unicode_is_identifier_subsequent(esch_unicode ch)
 {
-    size_t n = 0;
-    for (; n < sizeof(esch_unicode_range_so_up_bound) / sizeof(esch_unicode); ++n)
-    {
-        if (ch >= esch_unicode_range_so_low_bound[n] && ch <= esch_unicode_range_so_up_bound[n])
-            return 1;
-    }
-    return 0;
+    const uint32_t* block = NULL;
+    if (ch < 0 || ch > 0x10FFFF)
+        return 0;
+    block = ESCH_IDENTIFIER_BLOCK(ch) + ESCH_IDENTIFIER_WORDS;
+    return (block[(ch >> 5) & (ESCH_IDENTIFIER_WORDS - 1)] >> (ch & 31)) & 1;
 }
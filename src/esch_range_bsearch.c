@@ -0,0 +1,753 @@
+/* DON'T MODIFY: The code below is automatically generated. */
+/* Data source: http://www.fileformat.info/info/unicode/category/index.htm */
+#include "esch_string.h"
+
+/*
+ * Sorted, merged ranges for low-memory builds: each entry of
+ * starts begins a range of code points that runs to the next
+ * entry, and all code points in it have the same category.
+ */
+#define ESCH_UNICODE_SEGMENTS 3119
+
+static const esch_unicode
+esch_unicode_category_starts[] =
+{
+    0x0, 0x21, 0x24, 0x25, 0x28, 0x2a, 0x2b, 0x2c,
+    0x2d, 0x2e, 0x30, 0x3a, 0x3c, 0x3f, 0x41, 0x5b,
+    0x5c, 0x5d, 0x5e, 0x5f, 0x60, 0x61, 0x7b, 0x7c,
+    0x7d, 0x7e, 0x7f, 0xa1, 0xa2, 0xa6, 0xa7, 0xa8,
+    0xa9, 0xaa, 0xab, 0xac, 0xad, 0xae, 0xaf, 0xb0,
+    0xb1, 0xb2, 0xb4, 0xb5, 0xb6, 0xb8, 0xb9, 0xba,
+    0xbb, 0xbc, 0xbf, 0xc0, 0xd7, 0xd8, 0xdf, 0xf7,
+    0xf8, 0x100, 0x101, 0x102, 0x103, 0x104, 0x105, 0x106,
+    0x107, 0x108, 0x109, 0x10a, 0x10b, 0x10c, 0x10d, 0x10e,
+    0x10f, 0x110, 0x111, 0x112, 0x113, 0x114, 0x115, 0x116,
+    0x117, 0x118, 0x119, 0x11a, 0x11b, 0x11c, 0x11d, 0x11e,
+    0x11f, 0x120, 0x121, 0x122, 0x123, 0x124, 0x125, 0x126,
+    0x127, 0x128, 0x129, 0x12a, 0x12b, 0x12c, 0x12d, 0x12e,
+    0x12f, 0x130, 0x131, 0x132, 0x133, 0x134, 0x135, 0x136,
+    0x137, 0x139, 0x13a, 0x13b, 0x13c, 0x13d, 0x13e, 0x13f,
+    0x140, 0x141, 0x142, 0x143, 0x144, 0x145, 0x146, 0x147,
+    0x148, 0x14a, 0x14b, 0x14c, 0x14d, 0x14e, 0x14f, 0x150,
+    0x151, 0x152, 0x153, 0x154, 0x155, 0x156, 0x157, 0x158,
+    0x159, 0x15a, 0x15b, 0x15c, 0x15d, 0x15e, 0x15f, 0x160,
+    0x161, 0x162, 0x163, 0x164, 0x165, 0x166, 0x167, 0x168,
+    0x169, 0x16a, 0x16b, 0x16c, 0x16d, 0x16e, 0x16f, 0x170,
+    0x171, 0x172, 0x173, 0x174, 0x175, 0x176, 0x177, 0x178,
+    0x17a, 0x17b, 0x17c, 0x17d, 0x17e, 0x181, 0x183, 0x184,
+    0x185, 0x186, 0x188, 0x189, 0x18c, 0x18e, 0x192, 0x193,
+    0x195, 0x196, 0x199, 0x19c, 0x19e, 0x19f, 0x1a1, 0x1a2,
+    0x1a3, 0x1a4, 0x1a5, 0x1a6, 0x1a8, 0x1a9, 0x1aa, 0x1ac,
+    0x1ad, 0x1ae, 0x1b0, 0x1b1, 0x1b4, 0x1b5, 0x1b6, 0x1b7,
+    0x1b9, 0x1bb, 0x1bc, 0x1bd, 0x1c0, 0x1c4, 0x1c5, 0x1c6,
+    0x1c7, 0x1c8, 0x1c9, 0x1ca, 0x1cb, 0x1cc, 0x1cd, 0x1ce,
+    0x1cf, 0x1d0, 0x1d1, 0x1d2, 0x1d3, 0x1d4, 0x1d5, 0x1d6,
+    0x1d7, 0x1d8, 0x1d9, 0x1da, 0x1db, 0x1dc, 0x1de, 0x1df,
+    0x1e0, 0x1e1, 0x1e2, 0x1e3, 0x1e4, 0x1e5, 0x1e6, 0x1e7,
+    0x1e8, 0x1e9, 0x1ea, 0x1eb, 0x1ec, 0x1ed, 0x1ee, 0x1ef,
+    0x1f1, 0x1f2, 0x1f3, 0x1f4, 0x1f5, 0x1f6, 0x1f9, 0x1fa,
+    0x1fb, 0x1fc, 0x1fd, 0x1fe, 0x1ff, 0x200, 0x201, 0x202,
+    0x203, 0x204, 0x205, 0x206, 0x207, 0x208, 0x209, 0x20a,
+    0x20b, 0x20c, 0x20d, 0x20e, 0x20f, 0x210, 0x211, 0x212,
+    0x213, 0x214, 0x215, 0x216, 0x217, 0x218, 0x219, 0x21a,
+    0x21b, 0x21c, 0x21d, 0x21e, 0x21f, 0x220, 0x221, 0x222,
+    0x223, 0x224, 0x225, 0x226, 0x227, 0x228, 0x229, 0x22a,
+    0x22b, 0x22c, 0x22d, 0x22e, 0x22f, 0x230, 0x231, 0x232,
+    0x233, 0x23a, 0x23c, 0x23d, 0x23f, 0x241, 0x242, 0x243,
+    0x247, 0x248, 0x249, 0x24a, 0x24b, 0x24c, 0x24d, 0x24e,
+    0x24f, 0x294, 0x295, 0x2b0, 0x2c2, 0x2c6, 0x2d2, 0x2e0,
+    0x2e5, 0x2ec, 0x2ed, 0x2ee, 0x2ef, 0x300, 0x370, 0x371,
+    0x372, 0x373, 0x374, 0x375, 0x376, 0x377, 0x378, 0x37a,
+    0x37b, 0x37e, 0x37f, 0x384, 0x386, 0x387, 0x388, 0x38b,
+    0x38c, 0x38d, 0x38e, 0x390, 0x391, 0x3a2, 0x3a3, 0x3ac,
+    0x3cf, 0x3d0, 0x3d2, 0x3d5, 0x3d8, 0x3d9, 0x3da, 0x3db,
+    0x3dc, 0x3dd, 0x3de, 0x3df, 0x3e0, 0x3e1, 0x3e2, 0x3e3,
+    0x3e4, 0x3e5, 0x3e6, 0x3e7, 0x3e8, 0x3e9, 0x3ea, 0x3eb,
+    0x3ec, 0x3ed, 0x3ee, 0x3ef, 0x3f4, 0x3f5, 0x3f6, 0x3f7,
+    0x3f8, 0x3f9, 0x3fb, 0x3fd, 0x430, 0x460, 0x461, 0x462,
+    0x463, 0x464, 0x465, 0x466, 0x467, 0x468, 0x469, 0x46a,
+    0x46b, 0x46c, 0x46d, 0x46e, 0x46f, 0x470, 0x471, 0x472,
+    0x473, 0x474, 0x475, 0x476, 0x477, 0x478, 0x479, 0x47a,
+    0x47b, 0x47c, 0x47d, 0x47e, 0x47f, 0x480, 0x481, 0x482,
+    0x483, 0x488, 0x48a, 0x48b, 0x48c, 0x48d, 0x48e, 0x48f,
+    0x490, 0x491, 0x492, 0x493, 0x494, 0x495, 0x496, 0x497,
+    0x498, 0x499, 0x49a, 0x49b, 0x49c, 0x49d, 0x49e, 0x49f,
+    0x4a0, 0x4a1, 0x4a2, 0x4a3, 0x4a4, 0x4a5, 0x4a6, 0x4a7,
+    0x4a8, 0x4a9, 0x4aa, 0x4ab, 0x4ac, 0x4ad, 0x4ae, 0x4af,
+    0x4b0, 0x4b1, 0x4b2, 0x4b3, 0x4b4, 0x4b5, 0x4b6, 0x4b7,
+    0x4b8, 0x4b9, 0x4ba, 0x4bb, 0x4bc, 0x4bd, 0x4be, 0x4bf,
+    0x4c0, 0x4c2, 0x4c3, 0x4c4, 0x4c5, 0x4c6, 0x4c7, 0x4c8,
+    0x4c9, 0x4ca, 0x4cb, 0x4cc, 0x4cd, 0x4ce, 0x4d0, 0x4d1,
+    0x4d2, 0x4d3, 0x4d4, 0x4d5, 0x4d6, 0x4d7, 0x4d8, 0x4d9,
+    0x4da, 0x4db, 0x4dc, 0x4dd, 0x4de, 0x4df, 0x4e0, 0x4e1,
+    0x4e2, 0x4e3, 0x4e4, 0x4e5, 0x4e6, 0x4e7, 0x4e8, 0x4e9,
+    0x4ea, 0x4eb, 0x4ec, 0x4ed, 0x4ee, 0x4ef, 0x4f0, 0x4f1,
+    0x4f2, 0x4f3, 0x4f4, 0x4f5, 0x4f6, 0x4f7, 0x4f8, 0x4f9,
+    0x4fa, 0x4fb, 0x4fc, 0x4fd, 0x4fe, 0x4ff, 0x500, 0x501,
+    0x502, 0x503, 0x504, 0x505, 0x506, 0x507, 0x508, 0x509,
+    0x50a, 0x50b, 0x50c, 0x50d, 0x50e, 0x50f, 0x510, 0x511,
+    0x512, 0x513, 0x514, 0x515, 0x516, 0x517, 0x518, 0x519,
+    0x51a, 0x51b, 0x51c, 0x51d, 0x51e, 0x51f, 0x520, 0x521,
+    0x522, 0x523, 0x524, 0x525, 0x526, 0x527, 0x528, 0x531,
+    0x557, 0x559, 0x55a, 0x560, 0x561, 0x588, 0x589, 0x58a,
+    0x58b, 0x58f, 0x590, 0x591, 0x5be, 0x5bf, 0x5c0, 0x5c1,
+    0x5c3, 0x5c4, 0x5c6, 0x5c7, 0x5c8, 0x5d0, 0x5eb, 0x5f0,
+    0x5f3, 0x5f5, 0x606, 0x609, 0x60b, 0x60c, 0x60e, 0x610,
+    0x61b, 0x61c, 0x61e, 0x620, 0x640, 0x641, 0x64b, 0x660,
+    0x66a, 0x66e, 0x670, 0x671, 0x6d4, 0x6d5, 0x6d6, 0x6dd,
+    0x6de, 0x6df, 0x6e5, 0x6e7, 0x6e9, 0x6ea, 0x6ee, 0x6f0,
+    0x6fa, 0x6fd, 0x6ff, 0x700, 0x70e, 0x710, 0x711, 0x712,
+    0x730, 0x74b, 0x74d, 0x7a6, 0x7b1, 0x7b2, 0x7c0, 0x7ca,
+    0x7eb, 0x7f4, 0x7f6, 0x7f7, 0x7fa, 0x7fb, 0x800, 0x816,
+    0x81a, 0x81b, 0x824, 0x825, 0x828, 0x829, 0x82e, 0x830,
+    0x83f, 0x840, 0x859, 0x85c, 0x85e, 0x85f, 0x8a0, 0x8a1,
+    0x8a2, 0x8ad, 0x8e4, 0x8ff, 0x900, 0x903, 0x904, 0x93a,
+    0x93b, 0x93c, 0x93d, 0x93e, 0x941, 0x949, 0x94d, 0x94e,
+    0x950, 0x951, 0x958, 0x962, 0x964, 0x966, 0x970, 0x971,
+    0x972, 0x978, 0x979, 0x980, 0x981, 0x982, 0x984, 0x985,
+    0x98d, 0x98f, 0x991, 0x993, 0x9a9, 0x9aa, 0x9b1, 0x9b2,
+    0x9b3, 0x9b6, 0x9ba, 0x9bc, 0x9bd, 0x9be, 0x9c1, 0x9c5,
+    0x9c7, 0x9c9, 0x9cb, 0x9cd, 0x9ce, 0x9cf, 0x9d7, 0x9d8,
+    0x9dc, 0x9de, 0x9df, 0x9e2, 0x9e4, 0x9e6, 0x9f0, 0x9f2,
+    0x9f4, 0x9fa, 0x9fb, 0x9fc, 0xa01, 0xa03, 0xa04, 0xa05,
+    0xa0b, 0xa0f, 0xa11, 0xa13, 0xa29, 0xa2a, 0xa31, 0xa32,
+    0xa34, 0xa35, 0xa37, 0xa38, 0xa3a, 0xa3c, 0xa3d, 0xa3e,
+    0xa41, 0xa43, 0xa47, 0xa49, 0xa4b, 0xa4e, 0xa51, 0xa52,
+    0xa59, 0xa5d, 0xa5e, 0xa5f, 0xa66, 0xa70, 0xa72, 0xa75,
+    0xa76, 0xa81, 0xa83, 0xa84, 0xa85, 0xa8e, 0xa8f, 0xa92,
+    0xa93, 0xaa9, 0xaaa, 0xab1, 0xab2, 0xab4, 0xab5, 0xaba,
+    0xabc, 0xabd, 0xabe, 0xac1, 0xac6, 0xac7, 0xac9, 0xaca,
+    0xacb, 0xacd, 0xace, 0xad0, 0xad1, 0xae0, 0xae2, 0xae4,
+    0xae6, 0xaf0, 0xaf1, 0xaf2, 0xb01, 0xb02, 0xb04, 0xb05,
+    0xb0d, 0xb0f, 0xb11, 0xb13, 0xb29, 0xb2a, 0xb31, 0xb32,
+    0xb34, 0xb35, 0xb3a, 0xb3c, 0xb3d, 0xb3e, 0xb3f, 0xb40,
+    0xb41, 0xb45, 0xb47, 0xb49, 0xb4b, 0xb4d, 0xb4e, 0xb56,
+    0xb57, 0xb58, 0xb5c, 0xb5e, 0xb5f, 0xb62, 0xb64, 0xb66,
+    0xb70, 0xb71, 0xb72, 0xb78, 0xb82, 0xb83, 0xb84, 0xb85,
+    0xb8b, 0xb8e, 0xb91, 0xb92, 0xb96, 0xb99, 0xb9b, 0xb9c,
+    0xb9d, 0xb9e, 0xba0, 0xba3, 0xba5, 0xba8, 0xbab, 0xbae,
+    0xbba, 0xbbe, 0xbc0, 0xbc1, 0xbc3, 0xbc6, 0xbc9, 0xbca,
+    0xbcd, 0xbce, 0xbd0, 0xbd1, 0xbd7, 0xbd8, 0xbe6, 0xbf0,
+    0xbf3, 0xbf9, 0xbfa, 0xbfb, 0xc01, 0xc04, 0xc05, 0xc0d,
+    0xc0e, 0xc11, 0xc12, 0xc29, 0xc2a, 0xc34, 0xc35, 0xc3a,
+    0xc3d, 0xc3e, 0xc41, 0xc45, 0xc46, 0xc49, 0xc4a, 0xc4e,
+    0xc55, 0xc57, 0xc58, 0xc5a, 0xc60, 0xc62, 0xc64, 0xc66,
+    0xc70, 0xc78, 0xc7f, 0xc80, 0xc82, 0xc84, 0xc85, 0xc8d,
+    0xc8e, 0xc91, 0xc92, 0xca9, 0xcaa, 0xcb4, 0xcb5, 0xcba,
+    0xcbc, 0xcbd, 0xcbe, 0xcbf, 0xcc0, 0xcc5, 0xcc6, 0xcc7,
+    0xcc9, 0xcca, 0xccc, 0xcce, 0xcd5, 0xcd7, 0xcde, 0xcdf,
+    0xce0, 0xce2, 0xce4, 0xce6, 0xcf0, 0xcf1, 0xcf3, 0xd02,
+    0xd04, 0xd05, 0xd0d, 0xd0e, 0xd11, 0xd12, 0xd3b, 0xd3d,
+    0xd3e, 0xd41, 0xd45, 0xd46, 0xd49, 0xd4a, 0xd4d, 0xd4e,
+    0xd4f, 0xd57, 0xd58, 0xd60, 0xd62, 0xd64, 0xd66, 0xd70,
+    0xd76, 0xd79, 0xd7a, 0xd80, 0xd82, 0xd84, 0xd85, 0xd97,
+    0xd9a, 0xdb2, 0xdb3, 0xdbc, 0xdbd, 0xdbe, 0xdc0, 0xdc7,
+    0xdca, 0xdcb, 0xdcf, 0xdd2, 0xdd5, 0xdd6, 0xdd7, 0xdd8,
+    0xde0, 0xdf2, 0xdf4, 0xdf5, 0xe01, 0xe31, 0xe32, 0xe34,
+    0xe3b, 0xe3f, 0xe40, 0xe46, 0xe47, 0xe4f, 0xe50, 0xe5a,
+    0xe5c, 0xe81, 0xe83, 0xe84, 0xe85, 0xe87, 0xe89, 0xe8a,
+    0xe8b, 0xe8d, 0xe8e, 0xe94, 0xe98, 0xe99, 0xea0, 0xea1,
+    0xea4, 0xea5, 0xea6, 0xea7, 0xea8, 0xeaa, 0xeac, 0xead,
+    0xeb1, 0xeb2, 0xeb4, 0xeba, 0xebb, 0xebd, 0xebe, 0xec0,
+    0xec5, 0xec6, 0xec7, 0xec8, 0xece, 0xed0, 0xeda, 0xedc,
+    0xee0, 0xf00, 0xf01, 0xf04, 0xf13, 0xf14, 0xf15, 0xf18,
+    0xf1a, 0xf20, 0xf2a, 0xf34, 0xf35, 0xf36, 0xf37, 0xf38,
+    0xf39, 0xf3a, 0xf3e, 0xf40, 0xf48, 0xf49, 0xf6d, 0xf71,
+    0xf7f, 0xf80, 0xf85, 0xf86, 0xf88, 0xf8d, 0xf98, 0xf99,
+    0xfbd, 0xfbe, 0xfc6, 0xfc7, 0xfcd, 0xfce, 0xfd0, 0xfd5,
+    0xfd9, 0xfdb, 0x1000, 0x102b, 0x102d, 0x1031, 0x1032, 0x1038,
+    0x1039, 0x103b, 0x103d, 0x103f, 0x1040, 0x104a, 0x1050, 0x1056,
+    0x1058, 0x105a, 0x105e, 0x1061, 0x1062, 0x1065, 0x1067, 0x106e,
+    0x1071, 0x1075, 0x1082, 0x1083, 0x1085, 0x1087, 0x108d, 0x108e,
+    0x108f, 0x1090, 0x109a, 0x109d, 0x109e, 0x10a0, 0x10c6, 0x10c7,
+    0x10c8, 0x10cd, 0x10ce, 0x10d0, 0x10fb, 0x10fc, 0x10fd, 0x1249,
+    0x124a, 0x124e, 0x1250, 0x1257, 0x1258, 0x1259, 0x125a, 0x125e,
+    0x1260, 0x1289, 0x128a, 0x128e, 0x1290, 0x12b1, 0x12b2, 0x12b6,
+    0x12b8, 0x12bf, 0x12c0, 0x12c1, 0x12c2, 0x12c6, 0x12c8, 0x12d7,
+    0x12d8, 0x1311, 0x1312, 0x1316, 0x1318, 0x135b, 0x135d, 0x1360,
+    0x1369, 0x137d, 0x1380, 0x1390, 0x139a, 0x13a0, 0x13f5, 0x1400,
+    0x1401, 0x166d, 0x166f, 0x1680, 0x1681, 0x169b, 0x16a0, 0x16eb,
+    0x16ee, 0x16f1, 0x1700, 0x170d, 0x170e, 0x1712, 0x1715, 0x1720,
+    0x1732, 0x1735, 0x1737, 0x1740, 0x1752, 0x1754, 0x1760, 0x176d,
+    0x176e, 0x1771, 0x1772, 0x1774, 0x1780, 0x17b4, 0x17b6, 0x17b7,
+    0x17be, 0x17c6, 0x17c7, 0x17c9, 0x17d4, 0x17d7, 0x17d8, 0x17db,
+    0x17dc, 0x17dd, 0x17de, 0x17e0, 0x17ea, 0x17f0, 0x17fa, 0x1800,
+    0x1806, 0x1807, 0x180b, 0x180e, 0x1810, 0x181a, 0x1820, 0x1843,
+    0x1844, 0x1878, 0x1880, 0x18a9, 0x18aa, 0x18ab, 0x18b0, 0x18f6,
+    0x1900, 0x191d, 0x1920, 0x1923, 0x1927, 0x1929, 0x192c, 0x1930,
+    0x1932, 0x1933, 0x1939, 0x193c, 0x1940, 0x1941, 0x1944, 0x1946,
+    0x1950, 0x196e, 0x1970, 0x1975, 0x1980, 0x19ac, 0x19b0, 0x19c1,
+    0x19c8, 0x19ca, 0x19d0, 0x19da, 0x19db, 0x19de, 0x1a00, 0x1a17,
+    0x1a19, 0x1a1c, 0x1a1e, 0x1a20, 0x1a55, 0x1a56, 0x1a57, 0x1a58,
+    0x1a5f, 0x1a60, 0x1a61, 0x1a62, 0x1a63, 0x1a65, 0x1a6d, 0x1a73,
+    0x1a7d, 0x1a7f, 0x1a80, 0x1a8a, 0x1a90, 0x1a9a, 0x1aa0, 0x1aa7,
+    0x1aa8, 0x1aae, 0x1b00, 0x1b04, 0x1b05, 0x1b34, 0x1b35, 0x1b36,
+    0x1b3b, 0x1b3c, 0x1b3d, 0x1b42, 0x1b43, 0x1b45, 0x1b4c, 0x1b50,
+    0x1b5a, 0x1b61, 0x1b6b, 0x1b74, 0x1b7d, 0x1b80, 0x1b82, 0x1b83,
+    0x1ba1, 0x1ba2, 0x1ba6, 0x1ba8, 0x1baa, 0x1bab, 0x1bac, 0x1bae,
+    0x1bb0, 0x1bba, 0x1be6, 0x1be7, 0x1be8, 0x1bea, 0x1bed, 0x1bee,
+    0x1bef, 0x1bf2, 0x1bf4, 0x1bfc, 0x1c00, 0x1c24, 0x1c2c, 0x1c34,
+    0x1c36, 0x1c38, 0x1c3b, 0x1c40, 0x1c4a, 0x1c4d, 0x1c50, 0x1c5a,
+    0x1c78, 0x1c7e, 0x1c80, 0x1cc0, 0x1cc8, 0x1cd0, 0x1cd3, 0x1cd4,
+    0x1ce1, 0x1ce2, 0x1ce9, 0x1ced, 0x1cee, 0x1cf2, 0x1cf4, 0x1cf5,
+    0x1cf7, 0x1d00, 0x1d2c, 0x1d6b, 0x1d78, 0x1d79, 0x1d9b, 0x1dc0,
+    0x1de7, 0x1dfc, 0x1e00, 0x1e01, 0x1e02, 0x1e03, 0x1e04, 0x1e05,
+    0x1e06, 0x1e07, 0x1e08, 0x1e09, 0x1e0a, 0x1e0b, 0x1e0c, 0x1e0d,
+    0x1e0e, 0x1e0f, 0x1e10, 0x1e11, 0x1e12, 0x1e13, 0x1e14, 0x1e15,
+    0x1e16, 0x1e17, 0x1e18, 0x1e19, 0x1e1a, 0x1e1b, 0x1e1c, 0x1e1d,
+    0x1e1e, 0x1e1f, 0x1e20, 0x1e21, 0x1e22, 0x1e23, 0x1e24, 0x1e25,
+    0x1e26, 0x1e27, 0x1e28, 0x1e29, 0x1e2a, 0x1e2b, 0x1e2c, 0x1e2d,
+    0x1e2e, 0x1e2f, 0x1e30, 0x1e31, 0x1e32, 0x1e33, 0x1e34, 0x1e35,
+    0x1e36, 0x1e37, 0x1e38, 0x1e39, 0x1e3a, 0x1e3b, 0x1e3c, 0x1e3d,
+    0x1e3e, 0x1e3f, 0x1e40, 0x1e41, 0x1e42, 0x1e43, 0x1e44, 0x1e45,
+    0x1e46, 0x1e47, 0x1e48, 0x1e49, 0x1e4a, 0x1e4b, 0x1e4c, 0x1e4d,
+    0x1e4e, 0x1e4f, 0x1e50, 0x1e51, 0x1e52, 0x1e53, 0x1e54, 0x1e55,
+    0x1e56, 0x1e57, 0x1e58, 0x1e59, 0x1e5a, 0x1e5b, 0x1e5c, 0x1e5d,
+    0x1e5e, 0x1e5f, 0x1e60, 0x1e61, 0x1e62, 0x1e63, 0x1e64, 0x1e65,
+    0x1e66, 0x1e67, 0x1e68, 0x1e69, 0x1e6a, 0x1e6b, 0x1e6c, 0x1e6d,
+    0x1e6e, 0x1e6f, 0x1e70, 0x1e71, 0x1e72, 0x1e73, 0x1e74, 0x1e75,
+    0x1e76, 0x1e77, 0x1e78, 0x1e79, 0x1e7a, 0x1e7b, 0x1e7c, 0x1e7d,
+    0x1e7e, 0x1e7f, 0x1e80, 0x1e81, 0x1e82, 0x1e83, 0x1e84, 0x1e85,
+    0x1e86, 0x1e87, 0x1e88, 0x1e89, 0x1e8a, 0x1e8b, 0x1e8c, 0x1e8d,
+    0x1e8e, 0x1e8f, 0x1e90, 0x1e91, 0x1e92, 0x1e93, 0x1e94, 0x1e95,
+    0x1e9e, 0x1e9f, 0x1ea0, 0x1ea1, 0x1ea2, 0x1ea3, 0x1ea4, 0x1ea5,
+    0x1ea6, 0x1ea7, 0x1ea8, 0x1ea9, 0x1eaa, 0x1eab, 0x1eac, 0x1ead,
+    0x1eae, 0x1eaf, 0x1eb0, 0x1eb1, 0x1eb2, 0x1eb3, 0x1eb4, 0x1eb5,
+    0x1eb6, 0x1eb7, 0x1eb8, 0x1eb9, 0x1eba, 0x1ebb, 0x1ebc, 0x1ebd,
+    0x1ebe, 0x1ebf, 0x1ec0, 0x1ec1, 0x1ec2, 0x1ec3, 0x1ec4, 0x1ec5,
+    0x1ec6, 0x1ec7, 0x1ec8, 0x1ec9, 0x1eca, 0x1ecb, 0x1ecc, 0x1ecd,
+    0x1ece, 0x1ecf, 0x1ed0, 0x1ed1, 0x1ed2, 0x1ed3, 0x1ed4, 0x1ed5,
+    0x1ed6, 0x1ed7, 0x1ed8, 0x1ed9, 0x1eda, 0x1edb, 0x1edc, 0x1edd,
+    0x1ede, 0x1edf, 0x1ee0, 0x1ee1, 0x1ee2, 0x1ee3, 0x1ee4, 0x1ee5,
+    0x1ee6, 0x1ee7, 0x1ee8, 0x1ee9, 0x1eea, 0x1eeb, 0x1eec, 0x1eed,
+    0x1eee, 0x1eef, 0x1ef0, 0x1ef1, 0x1ef2, 0x1ef3, 0x1ef4, 0x1ef5,
+    0x1ef6, 0x1ef7, 0x1ef8, 0x1ef9, 0x1efa, 0x1efb, 0x1efc, 0x1efd,
+    0x1efe, 0x1eff, 0x1f08, 0x1f10, 0x1f16, 0x1f18, 0x1f1e, 0x1f20,
+    0x1f28, 0x1f30, 0x1f38, 0x1f40, 0x1f46, 0x1f48, 0x1f4e, 0x1f50,
+    0x1f58, 0x1f59, 0x1f5a, 0x1f5b, 0x1f5c, 0x1f5d, 0x1f5e, 0x1f5f,
+    0x1f60, 0x1f68, 0x1f70, 0x1f7e, 0x1f80, 0x1f88, 0x1f90, 0x1f98,
+    0x1fa0, 0x1fa8, 0x1fb0, 0x1fb5, 0x1fb6, 0x1fb8, 0x1fbc, 0x1fbd,
+    0x1fbe, 0x1fbf, 0x1fc2, 0x1fc5, 0x1fc6, 0x1fc8, 0x1fcc, 0x1fcd,
+    0x1fd0, 0x1fd4, 0x1fd6, 0x1fd8, 0x1fdc, 0x1fdd, 0x1fe0, 0x1fe8,
+    0x1fed, 0x1ff0, 0x1ff2, 0x1ff5, 0x1ff6, 0x1ff8, 0x1ffc, 0x1ffd,
+    0x1fff, 0x2010, 0x2016, 0x2018, 0x2020, 0x2028, 0x2030, 0x2039,
+    0x203b, 0x203f, 0x2041, 0x2044, 0x2045, 0x2047, 0x2052, 0x2053,
+    0x2054, 0x2055, 0x205f, 0x2070, 0x2071, 0x2072, 0x2074, 0x207a,
+    0x207d, 0x207f, 0x2080, 0x208a, 0x208d, 0x2090, 0x209d, 0x20a0,
+    0x20ba, 0x20d0, 0x20dd, 0x20e1, 0x20e2, 0x20e5, 0x20f1, 0x2100,
+    0x2102, 0x2103, 0x2107, 0x2108, 0x210a, 0x210b, 0x210e, 0x2110,
+    0x2113, 0x2114, 0x2115, 0x2116, 0x2118, 0x2119, 0x211e, 0x2124,
+    0x2125, 0x2126, 0x2127, 0x2128, 0x2129, 0x212a, 0x212e, 0x212f,
+    0x2130, 0x2134, 0x2135, 0x2139, 0x213a, 0x213c, 0x213e, 0x2140,
+    0x2145, 0x2146, 0x214a, 0x214b, 0x214c, 0x214e, 0x214f, 0x2150,
+    0x2160, 0x2183, 0x2184, 0x2185, 0x2189, 0x218a, 0x2190, 0x2195,
+    0x219a, 0x219c, 0x21a0, 0x21a1, 0x21a3, 0x21a4, 0x21a6, 0x21a7,
+    0x21ae, 0x21af, 0x21ce, 0x21d0, 0x21d2, 0x21d3, 0x21d4, 0x21d5,
+    0x21f4, 0x2300, 0x2308, 0x230c, 0x2320, 0x2322, 0x2329, 0x232b,
+    0x237c, 0x237d, 0x239b, 0x23b4, 0x23dc, 0x23e2, 0x23f4, 0x2400,
+    0x2427, 0x2440, 0x244b, 0x2460, 0x249c, 0x24ea, 0x2500, 0x25b7,
+    0x25b8, 0x25c1, 0x25c2, 0x25f8, 0x2600, 0x266f, 0x2670, 0x2700,
+    0x2701, 0x2768, 0x2776, 0x2794, 0x27c0, 0x27c5, 0x27c7, 0x27e6,
+    0x27f0, 0x2800, 0x2900, 0x2983, 0x2999, 0x29d8, 0x29dc, 0x29fc,
+    0x29fe, 0x2b00, 0x2b30, 0x2b45, 0x2b47, 0x2b4d, 0x2b50, 0x2b5a,
+    0x2c00, 0x2c2f, 0x2c30, 0x2c5f, 0x2c60, 0x2c61, 0x2c62, 0x2c65,
+    0x2c67, 0x2c68, 0x2c69, 0x2c6a, 0x2c6b, 0x2c6c, 0x2c6d, 0x2c71,
+    0x2c72, 0x2c73, 0x2c75, 0x2c76, 0x2c7c, 0x2c7e, 0x2c81, 0x2c82,
+    0x2c83, 0x2c84, 0x2c85, 0x2c86, 0x2c87, 0x2c88, 0x2c89, 0x2c8a,
+    0x2c8b, 0x2c8c, 0x2c8d, 0x2c8e, 0x2c8f, 0x2c90, 0x2c91, 0x2c92,
+    0x2c93, 0x2c94, 0x2c95, 0x2c96, 0x2c97, 0x2c98, 0x2c99, 0x2c9a,
+    0x2c9b, 0x2c9c, 0x2c9d, 0x2c9e, 0x2c9f, 0x2ca0, 0x2ca1, 0x2ca2,
+    0x2ca3, 0x2ca4, 0x2ca5, 0x2ca6, 0x2ca7, 0x2ca8, 0x2ca9, 0x2caa,
+    0x2cab, 0x2cac, 0x2cad, 0x2cae, 0x2caf, 0x2cb0, 0x2cb1, 0x2cb2,
+    0x2cb3, 0x2cb4, 0x2cb5, 0x2cb6, 0x2cb7, 0x2cb8, 0x2cb9, 0x2cba,
+    0x2cbb, 0x2cbc, 0x2cbd, 0x2cbe, 0x2cbf, 0x2cc0, 0x2cc1, 0x2cc2,
+    0x2cc3, 0x2cc4, 0x2cc5, 0x2cc6, 0x2cc7, 0x2cc8, 0x2cc9, 0x2cca,
+    0x2ccb, 0x2ccc, 0x2ccd, 0x2cce, 0x2ccf, 0x2cd0, 0x2cd1, 0x2cd2,
+    0x2cd3, 0x2cd4, 0x2cd5, 0x2cd6, 0x2cd7, 0x2cd8, 0x2cd9, 0x2cda,
+    0x2cdb, 0x2cdc, 0x2cdd, 0x2cde, 0x2cdf, 0x2ce0, 0x2ce1, 0x2ce2,
+    0x2ce3, 0x2ce5, 0x2ceb, 0x2cec, 0x2ced, 0x2cee, 0x2cef, 0x2cf2,
+    0x2cf3, 0x2cf4, 0x2cf9, 0x2cfd, 0x2cfe, 0x2d00, 0x2d26, 0x2d27,
+    0x2d28, 0x2d2d, 0x2d2e, 0x2d30, 0x2d68, 0x2d6f, 0x2d70, 0x2d71,
+    0x2d7f, 0x2d80, 0x2d97, 0x2da0, 0x2da7, 0x2da8, 0x2daf, 0x2db0,
+    0x2db7, 0x2db8, 0x2dbf, 0x2dc0, 0x2dc7, 0x2dc8, 0x2dcf, 0x2dd0,
+    0x2dd7, 0x2dd8, 0x2ddf, 0x2de0, 0x2e00, 0x2e02, 0x2e06, 0x2e09,
+    0x2e0b, 0x2e0c, 0x2e0e, 0x2e17, 0x2e18, 0x2e1a, 0x2e1b, 0x2e1c,
+    0x2e1e, 0x2e20, 0x2e2a, 0x2e2f, 0x2e30, 0x2e3a, 0x2e3c, 0x2e80,
+    0x2e9a, 0x2e9b, 0x2ef4, 0x2f00, 0x2fd6, 0x2ff0, 0x2ffc, 0x3001,
+    0x3004, 0x3005, 0x3006, 0x3007, 0x3008, 0x3012, 0x3014, 0x301c,
+    0x301d, 0x3020, 0x3021, 0x302a, 0x302e, 0x3030, 0x3031, 0x3036,
+    0x3038, 0x303b, 0x303c, 0x303d, 0x303e, 0x3040, 0x3041, 0x3097,
+    0x3099, 0x309b, 0x309d, 0x309f, 0x30a0, 0x30a1, 0x30fb, 0x30fc,
+    0x30ff, 0x3100, 0x3105, 0x312e, 0x3131, 0x318f, 0x3190, 0x3192,
+    0x3196, 0x31a0, 0x31bb, 0x31c0, 0x31e4, 0x31f0, 0x3200, 0x321f,
+    0x3220, 0x322a, 0x3248, 0x3250, 0x3251, 0x3260, 0x3280, 0x328a,
+    0x32b1, 0x32c0, 0x32ff, 0x3300, 0x3400, 0x3401, 0x4db5, 0x4db6,
+    0x4dc0, 0x4e00, 0x4e01, 0x9fcc, 0x9fcd, 0xa000, 0xa015, 0xa016,
+    0xa48d, 0xa490, 0xa4c7, 0xa4d0, 0xa4f8, 0xa4fe, 0xa500, 0xa60c,
+    0xa60d, 0xa610, 0xa620, 0xa62a, 0xa62c, 0xa640, 0xa641, 0xa642,
+    0xa643, 0xa644, 0xa645, 0xa646, 0xa647, 0xa648, 0xa649, 0xa64a,
+    0xa64b, 0xa64c, 0xa64d, 0xa64e, 0xa64f, 0xa650, 0xa651, 0xa652,
+    0xa653, 0xa654, 0xa655, 0xa656, 0xa657, 0xa658, 0xa659, 0xa65a,
+    0xa65b, 0xa65c, 0xa65d, 0xa65e, 0xa65f, 0xa660, 0xa661, 0xa662,
+    0xa663, 0xa664, 0xa665, 0xa666, 0xa667, 0xa668, 0xa669, 0xa66a,
+    0xa66b, 0xa66c, 0xa66d, 0xa66e, 0xa66f, 0xa670, 0xa673, 0xa674,
+    0xa67e, 0xa67f, 0xa680, 0xa681, 0xa682, 0xa683, 0xa684, 0xa685,
+    0xa686, 0xa687, 0xa688, 0xa689, 0xa68a, 0xa68b, 0xa68c, 0xa68d,
+    0xa68e, 0xa68f, 0xa690, 0xa691, 0xa692, 0xa693, 0xa694, 0xa695,
+    0xa696, 0xa697, 0xa698, 0xa69f, 0xa6a0, 0xa6e6, 0xa6f0, 0xa6f2,
+    0xa6f8, 0xa700, 0xa717, 0xa720, 0xa722, 0xa723, 0xa724, 0xa725,
+    0xa726, 0xa727, 0xa728, 0xa729, 0xa72a, 0xa72b, 0xa72c, 0xa72d,
+    0xa72e, 0xa72f, 0xa732, 0xa733, 0xa734, 0xa735, 0xa736, 0xa737,
+    0xa738, 0xa739, 0xa73a, 0xa73b, 0xa73c, 0xa73d, 0xa73e, 0xa73f,
+    0xa740, 0xa741, 0xa742, 0xa743, 0xa744, 0xa745, 0xa746, 0xa747,
+    0xa748, 0xa749, 0xa74a, 0xa74b, 0xa74c, 0xa74d, 0xa74e, 0xa74f,
+    0xa750, 0xa751, 0xa752, 0xa753, 0xa754, 0xa755, 0xa756, 0xa757,
+    0xa758, 0xa759, 0xa75a, 0xa75b, 0xa75c, 0xa75d, 0xa75e, 0xa75f,
+    0xa760, 0xa761, 0xa762, 0xa763, 0xa764, 0xa765, 0xa766, 0xa767,
+    0xa768, 0xa769, 0xa76a, 0xa76b, 0xa76c, 0xa76d, 0xa76e, 0xa76f,
+    0xa770, 0xa771, 0xa779, 0xa77a, 0xa77b, 0xa77c, 0xa77d, 0xa77f,
+    0xa780, 0xa781, 0xa782, 0xa783, 0xa784, 0xa785, 0xa786, 0xa787,
+    0xa788, 0xa789, 0xa78b, 0xa78c, 0xa78d, 0xa78e, 0xa78f, 0xa790,
+    0xa791, 0xa792, 0xa793, 0xa794, 0xa7a0, 0xa7a1, 0xa7a2, 0xa7a3,
+    0xa7a4, 0xa7a5, 0xa7a6, 0xa7a7, 0xa7a8, 0xa7a9, 0xa7aa, 0xa7ab,
+    0xa7f8, 0xa7fa, 0xa7fb, 0xa802, 0xa803, 0xa806, 0xa807, 0xa80b,
+    0xa80c, 0xa823, 0xa825, 0xa827, 0xa828, 0xa82c, 0xa830, 0xa836,
+    0xa838, 0xa839, 0xa83a, 0xa840, 0xa874, 0xa878, 0xa880, 0xa882,
+    0xa8b4, 0xa8c4, 0xa8c5, 0xa8ce, 0xa8d0, 0xa8da, 0xa8e0, 0xa8f2,
+    0xa8f8, 0xa8fb, 0xa8fc, 0xa900, 0xa90a, 0xa926, 0xa92e, 0xa930,
+    0xa947, 0xa952, 0xa954, 0xa95f, 0xa960, 0xa97d, 0xa980, 0xa983,
+    0xa984, 0xa9b3, 0xa9b4, 0xa9b6, 0xa9ba, 0xa9bc, 0xa9bd, 0xa9c1,
+    0xa9ce, 0xa9cf, 0xa9d0, 0xa9da, 0xa9de, 0xa9e0, 0xaa00, 0xaa29,
+    0xaa2f, 0xaa31, 0xaa33, 0xaa35, 0xaa37, 0xaa40, 0xaa43, 0xaa44,
+    0xaa4c, 0xaa4d, 0xaa4e, 0xaa50, 0xaa5a, 0xaa5c, 0xaa60, 0xaa70,
+    0xaa71, 0xaa77, 0xaa7a, 0xaa7b, 0xaa7c, 0xaa80, 0xaab0, 0xaab1,
+    0xaab2, 0xaab5, 0xaab7, 0xaab9, 0xaabe, 0xaac0, 0xaac1, 0xaac2,
+    0xaac3, 0xaadb, 0xaadd, 0xaade, 0xaae0, 0xaaeb, 0xaaec, 0xaaee,
+    0xaaf0, 0xaaf2, 0xaaf3, 0xaaf5, 0xaaf6, 0xaaf7, 0xab01, 0xab07,
+    0xab09, 0xab0f, 0xab11, 0xab17, 0xab20, 0xab27, 0xab28, 0xab2f,
+    0xabc0, 0xabe3, 0xabe5, 0xabe6, 0xabe8, 0xabe9, 0xabeb, 0xabec,
+    0xabed, 0xabee, 0xabf0, 0xabfa, 0xac00, 0xac01, 0xd7a3, 0xd7a4,
+    0xd7b0, 0xd7c7, 0xd7cb, 0xd7fc, 0xe000, 0xe001, 0xf8ff, 0xf900,
+    0xfa6e, 0xfa70, 0xfada, 0xfb00, 0xfb07, 0xfb13, 0xfb18, 0xfb1d,
+    0xfb1e, 0xfb1f, 0xfb29, 0xfb2a, 0xfb37, 0xfb38, 0xfb3d, 0xfb3e,
+    0xfb3f, 0xfb40, 0xfb42, 0xfb43, 0xfb45, 0xfb46, 0xfbb2, 0xfbc2,
+    0xfbd3, 0xfd3e, 0xfd50, 0xfd90, 0xfd92, 0xfdc8, 0xfdf0, 0xfdfc,
+    0xfdfd, 0xfdfe, 0xfe00, 0xfe10, 0xfe17, 0xfe19, 0xfe1a, 0xfe20,
+    0xfe27, 0xfe30, 0xfe31, 0xfe33, 0xfe35, 0xfe45, 0xfe47, 0xfe49,
+    0xfe4d, 0xfe50, 0xfe53, 0xfe54, 0xfe58, 0xfe59, 0xfe5f, 0xfe62,
+    0xfe63, 0xfe64, 0xfe67, 0xfe68, 0xfe69, 0xfe6a, 0xfe6c, 0xfe70,
+    0xfe75, 0xfe76, 0xfefd, 0xff01, 0xff04, 0xff05, 0xff08, 0xff0a,
+    0xff0b, 0xff0c, 0xff0d, 0xff0e, 0xff10, 0xff1a, 0xff1c, 0xff1f,
+    0xff21, 0xff3b, 0xff3c, 0xff3d, 0xff3e, 0xff3f, 0xff40, 0xff41,
+    0xff5b, 0xff5c, 0xff5d, 0xff5e, 0xff5f, 0xff61, 0xff62, 0xff64,
+    0xff66, 0xff70, 0xff71, 0xff9e, 0xffa0, 0xffbf, 0xffc2, 0xffc8,
+    0xffca, 0xffd0, 0xffd2, 0xffd8, 0xffda, 0xffdd, 0xffe0, 0xffe2,
+    0xffe3, 0xffe4, 0xffe5, 0xffe7, 0xffe8, 0xffe9, 0xffed, 0xffef,
+    0xfffc, 0xfffe, 0x10000, 0x1000c, 0x1000d, 0x10027, 0x10028, 0x1003b,
+    0x1003c, 0x1003e, 0x1003f, 0x1004e, 0x10050, 0x1005e, 0x10080, 0x100fb,
+    0x10100, 0x10103, 0x10107, 0x10134, 0x10137, 0x10140, 0x10175, 0x10179,
+    0x1018a, 0x1018b, 0x10190, 0x1019c, 0x101d0, 0x101fd, 0x101fe, 0x10280,
+    0x1029d, 0x102a0, 0x102d1, 0x10300, 0x1031f, 0x10320, 0x10324, 0x10330,
+    0x10341, 0x10342, 0x1034a, 0x1034b, 0x10380, 0x1039e, 0x1039f, 0x103a0,
+    0x103c4, 0x103c8, 0x103d0, 0x103d1, 0x103d6, 0x10400, 0x10428, 0x10450,
+    0x1049e, 0x104a0, 0x104aa, 0x10800, 0x10806, 0x10808, 0x10809, 0x1080a,
+    0x10836, 0x10837, 0x10839, 0x1083c, 0x1083d, 0x1083f, 0x10856, 0x10857,
+    0x10858, 0x10860, 0x10900, 0x10916, 0x1091c, 0x1091f, 0x10920, 0x1093a,
+    0x1093f, 0x10940, 0x10980, 0x109b8, 0x109be, 0x109c0, 0x10a00, 0x10a01,
+    0x10a04, 0x10a05, 0x10a07, 0x10a0c, 0x10a10, 0x10a14, 0x10a15, 0x10a18,
+    0x10a19, 0x10a34, 0x10a38, 0x10a3b, 0x10a3f, 0x10a40, 0x10a48, 0x10a50,
+    0x10a59, 0x10a60, 0x10a7d, 0x10a7f, 0x10a80, 0x10b00, 0x10b36, 0x10b39,
+    0x10b40, 0x10b56, 0x10b58, 0x10b60, 0x10b73, 0x10b78, 0x10b80, 0x10c00,
+    0x10c49, 0x10e60, 0x10e7f, 0x11000, 0x11001, 0x11002, 0x11003, 0x11038,
+    0x11047, 0x1104e, 0x11052, 0x11066, 0x11070, 0x11080, 0x11082, 0x11083,
+    0x110b0, 0x110b3, 0x110b7, 0x110b9, 0x110bb, 0x110bd, 0x110be, 0x110c2,
+    0x110d0, 0x110e9, 0x110f0, 0x110fa, 0x11100, 0x11103, 0x11127, 0x1112c,
+    0x1112d, 0x11135, 0x11136, 0x11140, 0x11144, 0x11180, 0x11182, 0x11183,
+    0x111b3, 0x111b6, 0x111bf, 0x111c1, 0x111c5, 0x111c9, 0x111d0, 0x111da,
+    0x11680, 0x116ab, 0x116ac, 0x116ad, 0x116ae, 0x116b0, 0x116b6, 0x116b7,
+    0x116b8, 0x116c0, 0x116ca, 0x12000, 0x1236f, 0x12400, 0x12463, 0x12470,
+    0x12474, 0x13000, 0x1342f, 0x16800, 0x16a39, 0x16f00, 0x16f45, 0x16f50,
+    0x16f51, 0x16f7f, 0x16f8f, 0x16f93, 0x16fa0, 0x1b000, 0x1b002, 0x1d000,
+    0x1d0f6, 0x1d100, 0x1d127, 0x1d129, 0x1d165, 0x1d167, 0x1d16a, 0x1d16d,
+    0x1d173, 0x1d17b, 0x1d183, 0x1d185, 0x1d18c, 0x1d1aa, 0x1d1ae, 0x1d1de,
+    0x1d200, 0x1d242, 0x1d245, 0x1d246, 0x1d300, 0x1d357, 0x1d360, 0x1d372,
+    0x1d400, 0x1d41a, 0x1d434, 0x1d44e, 0x1d455, 0x1d456, 0x1d468, 0x1d482,
+    0x1d49c, 0x1d49d, 0x1d49e, 0x1d4a0, 0x1d4a2, 0x1d4a3, 0x1d4a5, 0x1d4a7,
+    0x1d4a9, 0x1d4ad, 0x1d4ae, 0x1d4b6, 0x1d4ba, 0x1d4bb, 0x1d4bc, 0x1d4bd,
+    0x1d4c4, 0x1d4c5, 0x1d4d0, 0x1d4ea, 0x1d504, 0x1d506, 0x1d507, 0x1d50b,
+    0x1d50d, 0x1d515, 0x1d516, 0x1d51d, 0x1d51e, 0x1d538, 0x1d53a, 0x1d53b,
+    0x1d53f, 0x1d540, 0x1d545, 0x1d546, 0x1d547, 0x1d54a, 0x1d551, 0x1d552,
+    0x1d56c, 0x1d586, 0x1d5a0, 0x1d5ba, 0x1d5d4, 0x1d5ee, 0x1d608, 0x1d622,
+    0x1d63c, 0x1d656, 0x1d670, 0x1d68a, 0x1d6a6, 0x1d6a8, 0x1d6c1, 0x1d6c2,
+    0x1d6db, 0x1d6dc, 0x1d6e2, 0x1d6fb, 0x1d6fc, 0x1d715, 0x1d716, 0x1d71c,
+    0x1d735, 0x1d736, 0x1d74f, 0x1d750, 0x1d756, 0x1d76f, 0x1d770, 0x1d789,
+    0x1d78a, 0x1d790, 0x1d7a9, 0x1d7aa, 0x1d7c3, 0x1d7c4, 0x1d7ca, 0x1d7cb,
+    0x1d7cc, 0x1d7ce, 0x1d800, 0x1ee00, 0x1ee04, 0x1ee05, 0x1ee20, 0x1ee21,
+    0x1ee23, 0x1ee24, 0x1ee25, 0x1ee27, 0x1ee28, 0x1ee29, 0x1ee33, 0x1ee34,
+    0x1ee38, 0x1ee39, 0x1ee3a, 0x1ee3b, 0x1ee3c, 0x1ee42, 0x1ee43, 0x1ee47,
+    0x1ee48, 0x1ee49, 0x1ee4a, 0x1ee4b, 0x1ee4c, 0x1ee4d, 0x1ee50, 0x1ee51,
+    0x1ee53, 0x1ee54, 0x1ee55, 0x1ee57, 0x1ee58, 0x1ee59, 0x1ee5a, 0x1ee5b,
+    0x1ee5c, 0x1ee5d, 0x1ee5e, 0x1ee5f, 0x1ee60, 0x1ee61, 0x1ee63, 0x1ee64,
+    0x1ee65, 0x1ee67, 0x1ee6b, 0x1ee6c, 0x1ee73, 0x1ee74, 0x1ee78, 0x1ee79,
+    0x1ee7d, 0x1ee7e, 0x1ee7f, 0x1ee80, 0x1ee8a, 0x1ee8b, 0x1ee9c, 0x1eea1,
+    0x1eea4, 0x1eea5, 0x1eeaa, 0x1eeab, 0x1eebc, 0x1eef0, 0x1eef2, 0x1f000,
+    0x1f02c, 0x1f030, 0x1f094, 0x1f0a0, 0x1f0af, 0x1f0b1, 0x1f0bf, 0x1f0c1,
+    0x1f0d0, 0x1f0d1, 0x1f0e0, 0x1f100, 0x1f10b, 0x1f110, 0x1f12f, 0x1f130,
+    0x1f16c, 0x1f170, 0x1f19b, 0x1f1e6, 0x1f203, 0x1f210, 0x1f23b, 0x1f240,
+    0x1f249, 0x1f250, 0x1f252, 0x1f300, 0x1f321, 0x1f330, 0x1f336, 0x1f337,
+    0x1f37d, 0x1f380, 0x1f394, 0x1f3a0, 0x1f3c5, 0x1f3c6, 0x1f3cb, 0x1f3e0,
+    0x1f3f1, 0x1f400, 0x1f43f, 0x1f440, 0x1f441, 0x1f442, 0x1f4f8, 0x1f4f9,
+    0x1f4fd, 0x1f500, 0x1f53e, 0x1f540, 0x1f544, 0x1f550, 0x1f568, 0x1f5fb,
+    0x1f641, 0x1f645, 0x1f650, 0x1f680, 0x1f6c6, 0x1f700, 0x1f774, 0x20000,
+    0x20001, 0x2a6d6, 0x2a6d7, 0x2a700, 0x2a701, 0x2b734, 0x2b735, 0x2b740,
+    0x2b741, 0x2b81d, 0x2b81e, 0x2f800, 0x2fa1e, 0xe0100, 0xe01f0, 0xf0000,
+    0xf0001, 0xffffd, 0xffffe, 0x100000, 0x100001, 0x10fffd, 0x10fffe,
+};
+static const unsigned char
+esch_unicode_category_ids[] =
+{
+    0, 13, 14, 13, 0, 13, 15, 13, 11, 13, 8, 13, 15, 13, 1, 0,
+    13, 0, 16, 12, 16, 2, 0, 15, 0, 15, 0, 13, 14, 17, 13, 16,
+    17, 5, 0, 15, 0, 17, 16, 17, 15, 10, 16, 2, 13, 16, 10, 5,
+    0, 10, 13, 1, 15, 1, 2, 15, 2, 1, 2, 1, 2, 1, 2, 1,
+    2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1,
+    2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1,
+    2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1,
+    2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1,
+    2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1,
+    2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1,
+    2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1,
+    2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1,
+    2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1,
+    2, 1, 2, 1, 2, 1, 2, 1, 2, 5, 1, 2, 5, 1, 3, 2,
+    1, 3, 2, 1, 3, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2,
+    1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2,
+    1, 2, 1, 2, 1, 2, 1, 2, 1, 3, 2, 1, 2, 1, 2, 1,
+    2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1,
+    2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1,
+    2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1,
+    2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1,
+    2, 1, 2, 1, 2, 1, 2, 1, 2, 5, 2, 4, 16, 4, 16, 4,
+    16, 4, 16, 4, 16, 6, 1, 2, 1, 2, 4, 16, 1, 2, 0, 4,
+    2, 13, 0, 16, 1, 13, 1, 0, 1, 0, 1, 2, 1, 0, 1, 2,
+    1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2,
+    1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 15, 1,
+    2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1,
+    2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1,
+    2, 1, 2, 1, 2, 1, 2, 17, 6, 0, 1, 2, 1, 2, 1, 2,
+    1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2,
+    1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2,
+    1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2,
+    1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2,
+    1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2,
+    1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2,
+    1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2,
+    1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2,
+    1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2,
+    1, 2, 1, 2, 1, 2, 0, 1, 0, 4, 13, 0, 2, 0, 13, 11,
+    0, 14, 0, 6, 11, 6, 13, 6, 13, 6, 13, 6, 0, 5, 0, 5,
+    13, 0, 15, 13, 14, 13, 17, 6, 13, 0, 13, 5, 4, 5, 6, 8,
+    13, 5, 6, 5, 13, 5, 6, 0, 17, 6, 4, 6, 17, 6, 5, 8,
+    5, 17, 5, 13, 0, 5, 6, 5, 6, 0, 5, 6, 5, 0, 8, 5,
+    6, 4, 17, 13, 4, 0, 5, 6, 4, 6, 4, 6, 4, 6, 0, 13,
+    0, 5, 6, 0, 13, 0, 5, 0, 5, 0, 6, 0, 6, 7, 5, 6,
+    7, 6, 5, 7, 6, 7, 6, 7, 5, 6, 5, 6, 13, 8, 13, 4,
+    5, 0, 5, 0, 6, 7, 0, 5, 0, 5, 0, 5, 0, 5, 0, 5,
+    0, 5, 0, 6, 5, 7, 6, 0, 7, 0, 7, 6, 5, 0, 7, 0,
+    5, 0, 5, 6, 0, 8, 5, 14, 10, 17, 14, 0, 6, 7, 0, 5,
+    0, 5, 0, 5, 0, 5, 0, 5, 0, 5, 0, 5, 0, 6, 0, 7,
+    6, 0, 6, 0, 6, 0, 6, 0, 5, 0, 5, 0, 8, 6, 5, 6,
+    0, 6, 7, 0, 5, 0, 5, 0, 5, 0, 5, 0, 5, 0, 5, 0,
+    6, 5, 7, 6, 0, 6, 7, 0, 7, 6, 0, 5, 0, 5, 6, 0,
+    8, 13, 14, 0, 6, 7, 0, 5, 0, 5, 0, 5, 0, 5, 0, 5,
+    0, 5, 0, 6, 5, 7, 6, 7, 6, 0, 7, 0, 7, 6, 0, 6,
+    7, 0, 5, 0, 5, 6, 0, 8, 17, 5, 10, 0, 6, 5, 0, 5,
+    0, 5, 0, 5, 0, 5, 0, 5, 0, 5, 0, 5, 0, 5, 0, 5,
+    0, 7, 6, 7, 0, 7, 0, 7, 6, 0, 5, 0, 7, 0, 8, 10,
+    17, 14, 17, 0, 7, 0, 5, 0, 5, 0, 5, 0, 5, 0, 5, 0,
+    5, 6, 7, 0, 6, 0, 6, 0, 6, 0, 5, 0, 5, 6, 0, 8,
+    0, 10, 17, 0, 7, 0, 5, 0, 5, 0, 5, 0, 5, 0, 5, 0,
+    6, 5, 7, 6, 7, 0, 6, 7, 0, 7, 6, 0, 7, 0, 5, 0,
+    5, 6, 0, 8, 0, 5, 0, 7, 0, 5, 0, 5, 0, 5, 0, 5,
+    7, 6, 0, 7, 0, 7, 6, 5, 0, 7, 0, 5, 6, 0, 8, 10,
+    0, 17, 5, 0, 7, 0, 5, 0, 5, 0, 5, 0, 5, 0, 5, 0,
+    6, 0, 7, 6, 0, 6, 0, 7, 0, 7, 13, 0, 5, 6, 5, 6,
+    0, 14, 5, 4, 6, 13, 8, 13, 0, 5, 0, 5, 0, 5, 0, 5,
+    0, 5, 0, 5, 0, 5, 0, 5, 0, 5, 0, 5, 0, 5, 0, 5,
+    6, 5, 6, 0, 6, 5, 0, 5, 0, 4, 0, 6, 0, 8, 0, 5,
+    0, 5, 17, 13, 17, 13, 17, 6, 17, 8, 10, 17, 6, 17, 6, 17,
+    6, 0, 7, 5, 0, 5, 0, 6, 7, 6, 13, 6, 5, 6, 0, 6,
+    0, 17, 6, 17, 0, 17, 13, 17, 13, 0, 5, 7, 6, 7, 6, 7,
+    6, 7, 6, 5, 8, 13, 5, 7, 6, 5, 6, 5, 7, 5, 7, 5,
+    6, 5, 6, 7, 6, 7, 6, 5, 7, 8, 7, 6, 17, 1, 0, 1,
+    0, 1, 0, 5, 13, 4, 5, 0, 5, 0, 5, 0, 5, 0, 5, 0,
+    5, 0, 5, 0, 5, 0, 5, 0, 5, 0, 5, 0, 5, 0, 5, 0,
+    5, 0, 5, 0, 5, 0, 6, 13, 10, 0, 5, 17, 0, 5, 0, 11,
+    5, 13, 5, 0, 5, 0, 5, 13, 9, 0, 5, 0, 5, 6, 0, 5,
+    6, 13, 0, 5, 6, 0, 5, 0, 5, 0, 6, 0, 5, 6, 7, 6,
+    7, 6, 7, 6, 13, 4, 13, 14, 5, 6, 0, 8, 0, 10, 0, 13,
+    11, 13, 6, 0, 8, 0, 5, 4, 5, 0, 5, 6, 5, 0, 5, 0,
+    5, 0, 6, 7, 6, 7, 0, 7, 6, 7, 6, 0, 17, 0, 13, 8,
+    5, 0, 5, 0, 5, 0, 7, 5, 7, 0, 8, 10, 0, 17, 5, 6,
+    7, 0, 13, 5, 7, 6, 7, 6, 0, 6, 7, 6, 7, 6, 7, 6,
+    0, 6, 8, 0, 8, 0, 13, 4, 13, 0, 6, 7, 5, 6, 7, 6,
+    7, 6, 7, 6, 7, 5, 0, 8, 13, 17, 6, 17, 0, 6, 7, 5,
+    7, 6, 7, 6, 7, 6, 7, 5, 8, 5, 6, 7, 6, 7, 6, 7,
+    6, 7, 0, 13, 5, 7, 6, 7, 6, 0, 13, 8, 0, 5, 8, 5,
+    4, 13, 0, 13, 0, 6, 13, 6, 7, 6, 5, 6, 5, 7, 6, 5,
+    0, 2, 4, 2, 4, 2, 4, 6, 0, 6, 1, 2, 1, 2, 1, 2,
+    1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2,
+    1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2,
+    1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2,
+    1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2,
+    1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2,
+    1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2,
+    1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2,
+    1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2,
+    1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2,
+    1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2,
+    1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2,
+    1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2,
+    1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2,
+    1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2,
+    1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2,
+    1, 2, 1, 2, 0, 1, 0, 2, 1, 2, 1, 2, 0, 1, 0, 2,
+    0, 1, 0, 1, 0, 1, 0, 1, 2, 1, 2, 0, 2, 3, 2, 3,
+    2, 3, 2, 0, 2, 1, 3, 16, 2, 16, 2, 0, 2, 1, 3, 16,
+    2, 0, 2, 1, 0, 16, 2, 1, 16, 0, 2, 0, 2, 1, 3, 16,
+    0, 11, 13, 0, 13, 0, 13, 0, 13, 12, 13, 15, 0, 13, 15, 13,
+    12, 13, 0, 10, 4, 0, 10, 15, 0, 4, 10, 15, 0, 4, 0, 14,
+    0, 6, 0, 6, 0, 6, 0, 17, 1, 17, 1, 17, 2, 1, 2, 1,
+    2, 17, 1, 17, 15, 1, 17, 1, 17, 1, 17, 1, 17, 1, 17, 2,
+    1, 2, 5, 2, 17, 2, 1, 15, 1, 2, 17, 15, 17, 2, 17, 10,
+    9, 1, 2, 9, 10, 0, 15, 17, 15, 17, 15, 17, 15, 17, 15, 17,
+    15, 17, 15, 17, 15, 17, 15, 17, 15, 17, 15, 17, 15, 17, 0, 17,
+    15, 17, 15, 17, 15, 17, 0, 17, 0, 17, 0, 10, 17, 10, 17, 15,
+    17, 15, 17, 15, 17, 15, 17, 0, 17, 0, 10, 17, 15, 0, 15, 0,
+    15, 17, 15, 0, 15, 0, 15, 0, 15, 17, 15, 17, 15, 0, 17, 0,
+    1, 0, 2, 0, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2,
+    1, 2, 1, 2, 4, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1,
+    2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1,
+    2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1,
+    2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1,
+    2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1,
+    2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1,
+    2, 1, 2, 1, 2, 1, 2, 1, 2, 17, 1, 2, 1, 2, 6, 1,
+    2, 0, 13, 10, 13, 2, 0, 2, 0, 2, 0, 5, 0, 4, 13, 0,
+    6, 5, 0, 5, 0, 5, 0, 5, 0, 5, 0, 5, 0, 5, 0, 5,
+    0, 5, 0, 6, 13, 0, 13, 0, 13, 0, 13, 11, 13, 11, 13, 0,
+    13, 0, 13, 4, 13, 11, 0, 17, 0, 17, 0, 17, 0, 17, 0, 13,
+    17, 4, 5, 9, 0, 17, 0, 11, 0, 17, 9, 6, 7, 11, 4, 17,
+    9, 4, 5, 13, 17, 0, 5, 0, 6, 16, 4, 5, 11, 5, 13, 4,
+    5, 0, 5, 0, 5, 0, 17, 10, 17, 5, 0, 17, 0, 5, 17, 0,
+    10, 17, 10, 17, 10, 17, 10, 17, 10, 17, 0, 17, 5, 0, 5, 0,
+    17, 5, 0, 5, 0, 5, 4, 5, 0, 17, 0, 5, 4, 13, 5, 4,
+    13, 5, 8, 5, 0, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1,
+    2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1,
+    2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1,
+    2, 1, 2, 5, 6, 0, 13, 6, 13, 4, 1, 2, 1, 2, 1, 2,
+    1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2,
+    1, 2, 0, 6, 5, 9, 6, 13, 0, 16, 4, 16, 1, 2, 1, 2,
+    1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2,
+    1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2,
+    1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2,
+    1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2,
+    1, 2, 1, 2, 1, 2, 1, 2, 4, 2, 1, 2, 1, 2, 1, 2,
+    1, 2, 1, 2, 1, 2, 1, 2, 4, 16, 1, 2, 1, 2, 0, 1,
+    2, 1, 2, 0, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 0,
+    4, 2, 5, 6, 5, 6, 5, 6, 5, 7, 6, 7, 17, 0, 10, 17,
+    14, 17, 0, 5, 13, 0, 7, 5, 7, 6, 0, 13, 8, 0, 6, 5,
+    13, 5, 0, 8, 5, 6, 13, 5, 6, 7, 0, 13, 5, 0, 6, 7,
+    5, 6, 7, 6, 7, 6, 7, 13, 0, 4, 8, 0, 13, 0, 5, 6,
+    7, 6, 7, 6, 0, 5, 6, 5, 6, 7, 0, 8, 0, 13, 5, 4,
+    5, 17, 5, 7, 0, 5, 6, 5, 6, 5, 6, 5, 6, 5, 6, 5,
+    0, 5, 4, 13, 5, 7, 6, 7, 13, 5, 4, 7, 6, 0, 5, 0,
+    5, 0, 5, 0, 5, 0, 5, 0, 5, 7, 6, 7, 6, 7, 13, 7,
+    6, 0, 8, 0, 5, 0, 5, 0, 5, 0, 5, 0, 18, 0, 18, 5,
+    0, 5, 0, 2, 0, 2, 0, 5, 6, 5, 15, 5, 0, 5, 0, 5,
+    0, 5, 0, 5, 0, 5, 16, 0, 5, 0, 5, 0, 5, 0, 5, 14,
+    17, 0, 6, 13, 0, 13, 0, 6, 0, 13, 11, 12, 0, 13, 0, 13,
+    12, 13, 0, 13, 11, 0, 13, 15, 11, 15, 0, 13, 14, 13, 0, 5,
+    0, 5, 0, 13, 14, 13, 0, 13, 15, 13, 11, 13, 8, 13, 15, 13,
+    1, 0, 13, 0, 16, 12, 16, 2, 0, 15, 0, 15, 0, 13, 0, 13,
+    5, 4, 5, 4, 5, 0, 5, 0, 5, 0, 5, 0, 5, 0, 14, 15,
+    16, 17, 14, 0, 17, 15, 17, 0, 17, 0, 5, 0, 5, 0, 5, 0,
+    5, 0, 5, 0, 5, 0, 5, 0, 13, 0, 10, 0, 17, 9, 10, 17,
+    10, 0, 17, 0, 17, 6, 0, 5, 0, 5, 0, 5, 0, 10, 0, 5,
+    9, 5, 9, 0, 5, 0, 13, 5, 0, 5, 13, 9, 0, 1, 2, 5,
+    0, 8, 0, 5, 0, 5, 0, 5, 0, 5, 0, 5, 0, 5, 0, 13,
+    10, 0, 5, 10, 0, 13, 5, 0, 13, 0, 5, 0, 5, 0, 5, 6,
+    0, 6, 0, 6, 5, 0, 5, 0, 5, 0, 6, 0, 6, 10, 0, 13,
+    0, 5, 10, 13, 0, 5, 0, 13, 5, 0, 10, 5, 0, 10, 0, 5,
+    0, 10, 0, 7, 6, 7, 5, 6, 13, 0, 10, 8, 0, 6, 7, 5,
+    7, 6, 7, 6, 13, 0, 13, 0, 5, 0, 8, 0, 6, 5, 6, 7,
+    6, 0, 8, 13, 0, 6, 7, 5, 7, 6, 7, 5, 13, 0, 8, 0,
+    5, 6, 7, 6, 7, 6, 7, 6, 0, 8, 0, 5, 0, 9, 0, 13,
+    0, 5, 0, 5, 0, 5, 0, 5, 7, 0, 6, 4, 0, 5, 0, 17,
+    0, 17, 0, 17, 7, 6, 17, 7, 0, 6, 17, 6, 17, 6, 17, 0,
+    17, 6, 17, 0, 17, 0, 10, 0, 1, 2, 1, 2, 0, 2, 1, 2,
+    1, 0, 1, 0, 1, 0, 1, 0, 1, 0, 1, 2, 0, 2, 0, 2,
+    0, 2, 1, 2, 1, 0, 1, 0, 1, 0, 1, 0, 2, 1, 0, 1,
+    0, 1, 0, 1, 0, 1, 0, 2, 1, 2, 1, 2, 1, 2, 1, 2,
+    1, 2, 1, 2, 0, 1, 15, 2, 15, 2, 1, 15, 2, 15, 2, 1,
+    15, 2, 15, 2, 1, 15, 2, 15, 2, 1, 15, 2, 15, 2, 1, 2,
+    0, 8, 0, 5, 0, 5, 0, 5, 0, 5, 0, 5, 0, 5, 0, 5,
+    0, 5, 0, 5, 0, 5, 0, 5, 0, 5, 0, 5, 0, 5, 0, 5,
+    0, 5, 0, 5, 0, 5, 0, 5, 0, 5, 0, 5, 0, 5, 0, 5,
+    0, 5, 0, 5, 0, 5, 0, 5, 0, 5, 0, 5, 0, 5, 0, 5,
+    0, 5, 0, 5, 0, 15, 0, 17, 0, 17, 0, 17, 0, 17, 0, 17,
+    0, 17, 0, 10, 0, 17, 0, 17, 0, 17, 0, 17, 0, 17, 0, 17,
+    0, 17, 0, 17, 0, 17, 0, 17, 0, 17, 0, 17, 0, 17, 0, 17,
+    0, 17, 0, 17, 0, 17, 0, 17, 0, 17, 0, 17, 0, 17, 0, 17,
+    0, 17, 0, 17, 0, 17, 0, 5, 0, 5, 0, 5, 0, 5, 0, 5,
+    0, 5, 0, 5, 0, 6, 0, 18, 0, 18, 0, 18, 0, 18, 0,
+};
+
+int
+esch_unicode_get_category(esch_unicode ch)
+{
+    const esch_unicode* base = esch_unicode_category_starts;
+    size_t n = ESCH_UNICODE_SEGMENTS;
+    size_t half = 0;
+    if (ch < 0 || ch > 0x10FFFF)
+        return ESCH_UNICODE_CATEGORY_NONE;
+    /* Branchless: compiler turns the select into cmov. */
+    while (n > 1)
+    {
+        half = n / 2;
+        base = (base[half] <= ch? base + half: base);
+        n -= half;
+    }
+    return esch_unicode_category_ids[base - esch_unicode_category_starts];
+}
+int
+esch_unicode_is_range_lu(esch_unicode ch)
+{
+    return esch_unicode_get_category(ch) == ESCH_UNICODE_CATEGORY_LU;
+}
+int
+esch_unicode_is_range_ll(esch_unicode ch)
+{
+    return esch_unicode_get_category(ch) == ESCH_UNICODE_CATEGORY_LL;
+}
+int
+esch_unicode_is_range_lt(esch_unicode ch)
+{
+    return esch_unicode_get_category(ch) == ESCH_UNICODE_CATEGORY_LT;
+}
+int
+esch_unicode_is_range_lm(esch_unicode ch)
+{
+    return esch_unicode_get_category(ch) == ESCH_UNICODE_CATEGORY_LM;
+}
+int
+esch_unicode_is_range_lo(esch_unicode ch)
+{
+    return esch_unicode_get_category(ch) == ESCH_UNICODE_CATEGORY_LO;
+}
+int
+esch_unicode_is_range_mn(esch_unicode ch)
+{
+    return esch_unicode_get_category(ch) == ESCH_UNICODE_CATEGORY_MN;
+}
+int
+esch_unicode_is_range_mc(esch_unicode ch)
+{
+    return esch_unicode_get_category(ch) == ESCH_UNICODE_CATEGORY_MC;
+}
+int
+esch_unicode_is_range_nd(esch_unicode ch)
+{
+    return esch_unicode_get_category(ch) == ESCH_UNICODE_CATEGORY_ND;
+}
+int
+esch_unicode_is_range_nl(esch_unicode ch)
+{
+    return esch_unicode_get_category(ch) == ESCH_UNICODE_CATEGORY_NL;
+}
+int
+esch_unicode_is_range_no(esch_unicode ch)
+{
+    return esch_unicode_get_category(ch) == ESCH_UNICODE_CATEGORY_NO;
+}
+int
+esch_unicode_is_range_pd(esch_unicode ch)
+{
+    return esch_unicode_get_category(ch) == ESCH_UNICODE_CATEGORY_PD;
+}
+int
+esch_unicode_is_range_pc(esch_unicode ch)
+{
+    return esch_unicode_get_category(ch) == ESCH_UNICODE_CATEGORY_PC;
+}
+int
+esch_unicode_is_range_po(esch_unicode ch)
+{
+    return esch_unicode_get_category(ch) == ESCH_UNICODE_CATEGORY_PO;
+}
+int
+esch_unicode_is_range_sc(esch_unicode ch)
+{
+    return esch_unicode_get_category(ch) == ESCH_UNICODE_CATEGORY_SC;
+}
+int
+esch_unicode_is_range_sm(esch_unicode ch)
+{
+    return esch_unicode_get_category(ch) == ESCH_UNICODE_CATEGORY_SM;
+}
+int
+esch_unicode_is_range_sk(esch_unicode ch)
+{
+    return esch_unicode_get_category(ch) == ESCH_UNICODE_CATEGORY_SK;
+}
+int
+esch_unicode_is_range_so(esch_unicode ch)
+{
+    return esch_unicode_get_category(ch) == ESCH_UNICODE_CATEGORY_SO;
+}
+int
+esch_unicode_is_range_co(esch_unicode ch)
+{
+    return esch_unicode_get_category(ch) == ESCH_UNICODE_CATEGORY_CO;
+}
+
+/*
+ * Identifier classes of ASCII characters, for inline checks:
+ * ESCH_IDENTIFIER_INITIAL | ESCH_IDENTIFIER_SUBSEQUENT.
+ */
+const unsigned char
+esch_unicode_identifier_ascii[] =
+{
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 3, 1, 1, 3, 3, 3, 1, 1, 1, 3, 3, 1, 3, 3, 3,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 3, 1, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 1, 1, 1, 3, 3,
+    1, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 1, 1, 1, 3, 1,
+};
+int
+esch_unicode_is_identifier_initial(esch_unicode ch)
+{
+    int category = ESCH_UNICODE_CATEGORY_NONE;
+    if (ch < 0 || ch > 0x10FFFF)
+        return 0;
+    if (ch < 127)
+        return !esch_unicode_is_digit(ch);
+    category = esch_unicode_get_category(ch);
+    return !(category == ESCH_UNICODE_CATEGORY_ND ||
+             category == ESCH_UNICODE_CATEGORY_NL ||
+             category == ESCH_UNICODE_CATEGORY_NO);
+}
+int
+esch_unicode_is_identifier_subsequent(esch_unicode ch)
+{
+    if (ch < 0)
+        return 0;
+    if (ch < 127)
+        return (esch_unicode_is_digit(ch) ||
+                esch_unicode_is_alpha(ch) ||
+                esch_unicode_is_extended_alphabetic(ch));
+    return esch_unicode_get_category(ch) != ESCH_UNICODE_CATEGORY_NONE;
+}
@@ -8,6 +8,16 @@
 #include "esch_alloc.h"
 #include <string.h>
 
+#if defined(__SSE2__) || defined(_M_X64) || \
+    (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#    include <emmintrin.h>
+#    define ESCH_STRING_USE_SSE2
+#else
+/* High bit of each byte in a word. C89 has no 64-bit constants. */
+#    define ESCH_STRING_HIGH_BITS \
+        (((uint64_t)0x80808080U << 32) | (uint64_t)0x80808080U)
+#endif
+
 static esch_error
 esch_string_default_new(esch_config* config, esch_object** obj);
 static esch_error
@@ -16,14 +26,28 @@ static esch_error
 esch_string_copy_object(esch_object* input, esch_object** output);
 static esch_error
 esch_string_copy_string(esch_object* input, esch_string** output);
+static size_t
+scan_ascii(const unsigned char* utf8, size_t len);
+static size_t
+decode_ascii(const unsigned char* utf8, size_t len, esch_unicode* unicode);
+static int
+is_ascii_identifier(const unsigned char* utf8, size_t len);
 static int
-utf8_get_unicode_len(char* utf8, int begin, int end, int* bad_index);
-static void
-write_unicode_from_utf8(char* utf8, int begin, int end,
-                        esch_unicode* unicode);
+decode_utf8_i(const unsigned char* utf8, size_t len,
+              esch_unicode* unicode, size_t* unicode_len, size_t* bad_index);
+static esch_error
+esch_string_materialize_i(esch_string* str);
+static esch_error
+esch_string_new_view_i(esch_config* config, esch_string* str,
+                       size_t begin, size_t end,
+                       size_t utf8_begin, size_t utf8_end,
+                       esch_string** output);
+static esch_error
+esch_string_terminate_view_i(esch_string* str);
+static esch_error
+esch_string_build_index_i(esch_string* str);
 static esch_error
-decode_utf8(char* utf8, int begin, int end, 
-            esch_config* config, esch_unicode** str, size_t* unicode_len);
+esch_string_view_get_iterator_i(esch_object* obj, esch_iterator* iter);
 
 struct esch_builtin_type esch_string_type = 
 {
@@ -46,20 +70,69 @@ struct esch_builtin_type esch_string_type =
     },
 };
 
-enum esch_unicode_parse_state
+/* Short string, with UTF-8 bytes stored in object. */
+struct esch_builtin_type esch_string_inline_type = 
+{
+    {
+        &(esch_meta_type.type),
+        NULL, /* No alloc */
+        &(esch_log_do_nothing.log),
+        NULL, /* Non-GC object */
+        NULL,
+    },
+    {
+        ESCH_VERSION,
+        sizeof(esch_string) + ESCH_STRING_INLINE_SIZE,
+        esch_string_default_new,
+        esch_string_destructor,
+        esch_string_copy_object, /* String copy */
+        esch_string_copy_string, /* String.toString() */
+        esch_type_default_no_doc,
+        esch_type_default_no_iterator
+    },
+};
+
+/* Substring sharing buffers of its parent. */
+struct esch_builtin_type esch_string_view_type = 
+{
+    {
+        &(esch_meta_type.type),
+        NULL, /* No alloc */
+        &(esch_log_do_nothing.log),
+        NULL, /* Non-GC object */
+        NULL,
+    },
+    {
+        ESCH_VERSION,
+        sizeof(esch_string) + sizeof(struct esch_string_view),
+        esch_string_default_new,
+        esch_string_destructor,
+        esch_string_copy_object, /* Copy as flat string */
+        esch_string_copy_string, /* String.toString() */
+        esch_type_default_no_doc,
+        esch_string_view_get_iterator_i /* Parent is traced by GC */
+    },
+};
+
+struct esch_builtin_type esch_string_rope_type = 
 {
-    ESCH_WRONG_BYTE = 0,
-    ESCH_BEGIN_BYTE,
-    ESCH_ONE_BYTE_FIRST_BYTE,
-    ESCH_TWO_BYTES_FIRST_BYTE,
-    ESCH_TWO_BYTES_SECOND_BYTE,
-    ESCH_THREE_BYTES_FIRST_BYTE,
-    ESCH_THREE_BYTES_SECOND_BYTE,
-    ESCH_THREE_BYTES_THIRD_BYTE,
-    ESCH_FOUR_BYTES_FIRST_BYTE,
-    ESCH_FOUR_BYTES_SECOND_BYTE,
-    ESCH_FOUR_BYTES_THIRD_BYTE,
-    ESCH_FOUR_BYTES_FOURTH_BYTE,
+    {
+        &(esch_meta_type.type),
+        NULL, /* No alloc */
+        &(esch_log_do_nothing.log),
+        NULL, /* Non-GC object */
+        NULL,
+    },
+    {
+        ESCH_VERSION,
+        sizeof(esch_string),
+        esch_string_default_new,
+        esch_string_destructor,
+        esch_string_copy_object, /* Copy as flat string */
+        esch_string_copy_string, /* String.toString() */
+        esch_type_default_no_doc,
+        esch_string_rope_get_iterator_i /* Leaves are traced by GC */
+    },
 };
 
 /*
@@ -79,9 +152,10 @@ esch_string_new_from_utf8(esch_config* config, const char* utf8,
     esch_alloc* alloc = NULL;
     esch_log* log = NULL;
     esch_utf8* new_utf8 = NULL;
-    esch_unicode* new_unicode = NULL;
     size_t len = 0;
     size_t unicode_len = 0;
+    size_t bad_index = 0;
+    int status = 0;
     ESCH_CHECK_PARAM_PUBLIC(utf8 != NULL);
     ESCH_CHECK_PARAM_PUBLIC(str != NULL);
 
@@ -110,32 +184,47 @@ esch_string_new_from_utf8(esch_config* config, const char* utf8,
         ESCH_CHECK(ret, log, "Invalid length", ret);
     }
 
-    ret = esch_alloc_realloc(alloc, NULL, sizeof(char) * (len + 1),
-                             (void**)&new_utf8);
-    ESCH_CHECK(ret == ESCH_OK, log, "Can't malloc UTF-8", ret);
-    (void)strncpy(new_utf8, (utf8 + begin), len);
-
-    ret = decode_utf8(new_utf8, 0, len, config, &new_unicode, &unicode_len);
-    ESCH_CHECK(ret == ESCH_OK, log, "Can't decode UTF-8", ret);
-
-    ret = esch_object_new_i(config, &(esch_string_type.type), &new_obj);
-    ESCH_CHECK(ret == ESCH_OK, log, "Can't create string object", ret);
-    new_str = ESCH_CAST_FROM_OBJECT(new_obj, esch_string);
+    /* Validate and count only. Unicode buffer is created on demand,
+     * see esch_string_get_unicode_ref(). */
+    status = decode_utf8_i((const unsigned char*)(utf8 + begin), len,
+                           NULL, &unicode_len, &bad_index);
+    ESCH_CHECK_1(status == 0, log, "Bad Unicode at index %d",
+                 (int)bad_index, ESCH_ERROR_INVALID_PARAMETER);
 
-    new_str->utf8 = new_utf8;
-    new_str->unicode = new_unicode;
+    if (len < ESCH_STRING_INLINE_SIZE)
+    {
+        /* Short string: one allocation for object and UTF-8 bytes. */
+        ret = esch_object_new_i(config, &(esch_string_inline_type.type),
+                                &new_obj);
+        ESCH_CHECK(ret == ESCH_OK, log, "Can't create string object", ret);
+        new_str = ESCH_CAST_FROM_OBJECT(new_obj, esch_string);
+        new_str->utf8 = ESCH_STRING_INLINE_UTF8(new_str);
+    }
+    else
+    {
+        ret = esch_alloc_realloc(alloc, NULL, sizeof(char) * (len + 1),
+                                 (void**)&new_utf8);
+        ESCH_CHECK(ret == ESCH_OK, log, "Can't malloc UTF-8", ret);
+        ret = esch_object_new_i(config, &(esch_string_type.type), &new_obj);
+        ESCH_CHECK(ret == ESCH_OK, log, "Can't create string object", ret);
+        new_str = ESCH_CAST_FROM_OBJECT(new_obj, esch_string);
+        new_str->utf8 = new_utf8;
+    }
+    memcpy(new_str->utf8, (utf8 + begin), len);
+    new_str->utf8[len] = '\0';
+    new_str->unicode = NULL;
     new_str->utf8_len = len;
     new_str->unicode_len = unicode_len;
+    new_str->rope = NULL;
+    new_str->offsets = NULL;
     ESCH_CHECK_PARAM_INTERNAL(ESCH_IS_VALID_STRING(new_str));
     (*str) = new_str;
 
     new_str = NULL;
     new_utf8 = NULL;
-    new_unicode = NULL;
     new_obj = NULL;
 Exit:
     esch_alloc_free(alloc, new_utf8);
-    esch_alloc_free(alloc, new_unicode);
     esch_alloc_free(alloc, new_str);
     if (new_obj != NULL)
     {
@@ -150,6 +239,16 @@ esch_string_get_utf8_ref(esch_string* str)
     /* NOTE: For performance consideration, we don't check input. */
     ESCH_CHECK_PARAM_INTERNAL(str != NULL);
     ESCH_CHECK_PARAM_INTERNAL(ESCH_IS_VALID_STRING(str));
+    if (str != NULL && str->utf8 == NULL)
+    {
+        /* Rope string. Returns NULL if we can't allocate buffer. */
+        (void)esch_string_rope_flatten_i(str);
+    }
+    else if (str != NULL && str->utf8[str->utf8_len] != '\0')
+    {
+        /* View in middle of parent. Same as above. */
+        (void)esch_string_terminate_view_i(str);
+    }
     return (str == NULL? NULL: str->utf8);
 }
 
@@ -159,9 +258,77 @@ esch_string_get_unicode_ref(esch_string* str)
     /* NOTE: For performance consideration, we don't check input. */
     ESCH_CHECK_PARAM_INTERNAL(str != NULL);
     ESCH_CHECK_PARAM_INTERNAL(ESCH_IS_VALID_STRING(str));
+    if (str != NULL && str->unicode == NULL)
+    {
+        /* Returns NULL if we can't allocate buffer. */
+        if (ESCH_STRING_IS_VIEW(str) &&
+            ESCH_STRING_VIEW(str)->begin + str->unicode_len ==
+            ESCH_STRING_VIEW(str)->parent->unicode_len)
+        {
+            /* View ends where parent ends. Share '\0' of parent. */
+            if (esch_string_get_unicode_ref(
+                        ESCH_STRING_VIEW(str)->parent) != NULL)
+            {
+                str->unicode = ESCH_STRING_VIEW(str)->parent->unicode +
+                               ESCH_STRING_VIEW(str)->begin;
+            }
+        }
+        else if (str->rope == NULL || esch_string_get_utf8_ref(str) != NULL)
+        {
+            if (esch_string_materialize_i(str) == ESCH_OK &&
+                ESCH_STRING_IS_VIEW(str))
+            {
+                ESCH_STRING_VIEW(str)->own_unicode = ESCH_TRUE;
+            }
+        }
+    }
     return (str == NULL? NULL: str->unicode);
 }
 
+esch_error
+esch_string_get_unicode_at(esch_string* str, size_t index,
+                           esch_unicode* ch)
+{
+    esch_error ret = ESCH_OK;
+    ESCH_CHECK_PARAM_PUBLIC(str != NULL);
+    ESCH_CHECK_PARAM_PUBLIC(ESCH_IS_VALID_STRING(str));
+    ESCH_CHECK_PARAM_PUBLIC(ch != NULL);
+    ESCH_CHECK_1(index < str->unicode_len, str,
+                 "Index out of range: %d", (int)index,
+                 ESCH_ERROR_OUT_OF_BOUND);
+
+    if (str->rope != NULL)
+    {
+        /* Find it from leaves. Don't flatten rope string. */
+        ret = esch_string_rope_get_unicode_at_i(str, index, ch);
+    }
+    else if (ESCH_STRING_IS_ASCII(str))
+    {
+        /* Bytes are characters. Never need Unicode buffer. */
+        (*ch) = (esch_unicode)(unsigned char)(str->utf8[index]);
+    }
+    else if (str->unicode == NULL && ESCH_STRING_IS_VIEW(str))
+    {
+        /* Decode parent once, instead of each view. */
+        ret = (esch_string_get_unicode_ref(ESCH_STRING_VIEW(str)->parent)
+               == NULL? ESCH_ERROR_OUT_OF_MEMORY: ESCH_OK);
+        ESCH_CHECK(ret == ESCH_OK, str, "Can't decode string", ret);
+        (*ch) = ESCH_STRING_VIEW(str)->parent->unicode[
+                    ESCH_STRING_VIEW(str)->begin + index];
+    }
+    else
+    {
+        if (str->unicode == NULL)
+        {
+            ret = esch_string_materialize_i(str);
+            ESCH_CHECK(ret == ESCH_OK, str, "Can't decode string", ret);
+        }
+        (*ch) = str->unicode[index];
+    }
+Exit:
+    return ret;
+}
+
 size_t
 esch_string_get_utf8_length(esch_string* str)
 {
@@ -184,7 +351,7 @@ int
 esch_unicode_string_is_valid_identifier(const esch_unicode* unicode)
 {
     const esch_unicode* ptr = NULL;
-    if (unicode == NULL)
+    if (unicode == NULL || unicode[0] == '\0')
         return 0;
 
     /* TODO: Need to convert escape characters. */
@@ -194,49 +361,13 @@ esch_unicode_string_is_valid_identifier(const esch_unicode* unicode)
 
     ptr = unicode;
     /* Always start from non-digital */
-    if (esch_unicode_is_ascii(*ptr))
-    {
-        if (esch_unicode_is_digit(*ptr))
-        {
-            return 0;
-        }
-    }
-    else if (esch_unicode_is_range_nd(*ptr) ||
-                esch_unicode_is_range_no(*ptr) ||
-                esch_unicode_is_range_nl(*ptr))
+    if (!esch_unicode_is_identifier_initial(*ptr))
     {
         return 0;
     }
     for (++ptr; *ptr != '\0'; ++ptr)
     {
-        if (esch_unicode_is_ascii(*ptr))
-        {
-            if (!(esch_unicode_is_digit(*ptr) ||
-                    esch_unicode_is_alpha(*ptr) ||
-                    esch_unicode_is_extended_alphabetic(*ptr)))
-            {
-                return 0;
-            }
-        }
-        else if (!(esch_unicode_is_range_lu(*ptr) ||
-                   esch_unicode_is_range_ll(*ptr) ||
-                   esch_unicode_is_range_lt(*ptr) ||
-                   esch_unicode_is_range_lm(*ptr) ||
-                   esch_unicode_is_range_lo(*ptr) ||
-                   esch_unicode_is_range_mn(*ptr) ||
-                   esch_unicode_is_range_mc(*ptr) ||
-                   esch_unicode_is_range_nd(*ptr) ||
-                   esch_unicode_is_range_nl(*ptr) ||
-                   esch_unicode_is_range_no(*ptr) ||
-                   esch_unicode_is_range_pd(*ptr) ||
-                   esch_unicode_is_range_pc(*ptr) ||
-                   esch_unicode_is_range_po(*ptr) ||
-                   esch_unicode_is_range_sc(*ptr) ||
-                   esch_unicode_is_range_sm(*ptr) ||
-                   esch_unicode_is_range_sk(*ptr) ||
-                   esch_unicode_is_range_so(*ptr) ||
-                   esch_unicode_is_range_co(*ptr)))
-
+        if (!ESCH_UNICODE_IS_IDENTIFIER_SUBSEQUENT(*ptr))
         {
             return 0;
         }
@@ -244,6 +375,28 @@ esch_unicode_string_is_valid_identifier(const esch_unicode* unicode)
     return 1;
 }
 
+int
+esch_string_is_valid_identifier(esch_string* str)
+{
+    const esch_unicode* unicode = NULL;
+    const esch_utf8* utf8 = NULL;
+    ESCH_CHECK_PARAM_INTERNAL(str != NULL);
+    ESCH_CHECK_PARAM_INTERNAL(ESCH_IS_VALID_STRING(str));
+    if (str == NULL || str->unicode_len == 0)
+        return 0;
+    if (ESCH_STRING_IS_ASCII(str))
+    {
+        /* A view is not terminated, but its bytes are enough here. */
+        utf8 = (str->utf8 != NULL? str->utf8: esch_string_get_utf8_ref(str));
+        return (utf8 != NULL &&
+                is_ascii_identifier((const unsigned char*)utf8,
+                                    str->utf8_len));
+    }
+    unicode = esch_string_get_unicode_ref(str);
+    return (unicode != NULL &&
+            esch_unicode_string_is_valid_identifier(unicode));
+}
+
 esch_error
 esch_string_duplicate(esch_string* input, esch_string** output)
 {
@@ -269,18 +422,25 @@ esch_string_duplicate(esch_string* input, esch_string** output)
     ESCH_CHECK(ret == ESCH_OK, log, "Can't alloc config", ret);
 
     if (gc != NULL) {
-        ret = esch_config_set_obj(config, ESCH_CONFIG_KEY_GC,
-                                  ESCH_CAST_TO_OBJECT(gc));
+        ret = esch_config_set_obj_by_id(config, ESCH_CONFIG_KEY_ID_GC,
+                                        ESCH_CAST_TO_OBJECT(gc));
         ESCH_CHECK(ret == ESCH_OK, log, "Can't set GC", ret);
     }
-    ret = esch_config_set_obj(config, ESCH_CONFIG_KEY_ALLOC,
-                              ESCH_CAST_TO_OBJECT(alloc));
+    ret = esch_config_set_obj_by_id(config, ESCH_CONFIG_KEY_ID_ALLOC,
+                                    ESCH_CAST_TO_OBJECT(alloc));
     ESCH_CHECK(ret == ESCH_OK, log, "Can't set alloc", ret);
-    ret = esch_config_set_obj(config, ESCH_CONFIG_KEY_LOG,
-                              ESCH_CAST_TO_OBJECT(log));
+    ret = esch_config_set_obj_by_id(config, ESCH_CONFIG_KEY_ID_LOG,
+                                    ESCH_CAST_TO_OBJECT(log));
     ESCH_CHECK(ret == ESCH_OK, log, "Can't set log", ret);
 
-    ret = esch_string_new_from_utf8(config, input->utf8, 0, -1, &new_str);
+    if (input->utf8 == NULL)
+    {
+        ret = (esch_string_get_utf8_ref(input) == NULL?
+               ESCH_ERROR_OUT_OF_MEMORY: ESCH_OK);
+        ESCH_CHECK(ret == ESCH_OK, log, "Can't flatten string", ret);
+    }
+    ret = esch_string_new_from_utf8(config, input->utf8,
+                                    0, (int)input->utf8_len, &new_str);
     ESCH_CHECK(ret == ESCH_OK, log, "Can't copy string", ret);
 
     (*output) = new_str;
@@ -297,11 +457,109 @@ Exit:
     return ret;
 }
 
+esch_error
+esch_string_substring(esch_config* config, esch_string* str,
+                      size_t begin, size_t end, esch_string** output)
+{
+    esch_error ret = ESCH_OK;
+    size_t utf8_begin = 0;
+    size_t utf8_end = 0;
+    ESCH_CHECK_PARAM_PUBLIC(config != NULL);
+    ESCH_CHECK_PARAM_PUBLIC(str != NULL);
+    ESCH_CHECK_PARAM_PUBLIC(ESCH_IS_VALID_STRING(str));
+    ESCH_CHECK_PARAM_PUBLIC(output != NULL);
+    ESCH_CHECK_2(begin <= end && end <= str->unicode_len, str,
+                 "Bad substring range: %d - %d", (int)begin, (int)end,
+                 ESCH_ERROR_OUT_OF_BOUND);
+
+    if (str->rope != NULL)
+    {
+        /* Share leaves with rope string */
+        ret = esch_string_rope_substring_i(config, str, begin, end, output);
+    }
+    else
+    {
+        utf8_begin = esch_string_utf8_offset_i(str, begin);
+        utf8_end = esch_string_utf8_offset_i(str, end);
+        if (utf8_end - utf8_begin < ESCH_STRING_INLINE_SIZE)
+        {
+            /* Copying is cheaper than keeping parent alive. */
+            ret = esch_string_new_from_utf8(config, str->utf8,
+                                            (int)utf8_begin, (int)utf8_end,
+                                            output);
+        }
+        else
+        {
+            ret = esch_string_new_view_i(config, str, begin, end,
+                                         utf8_begin, utf8_end, output);
+        }
+    }
+Exit:
+    return ret;
+}
+
 /*
  * -----------------------------------------------------------------
  * Internal functions.
  * -----------------------------------------------------------------
  */
+int
+esch_string_validate_utf8_i(const esch_utf8* utf8, size_t len,
+                            size_t* unicode_len, size_t* bad_index)
+{
+    return decode_utf8_i((const unsigned char*)utf8, len,
+                         NULL, unicode_len, bad_index);
+}
+
+size_t
+esch_string_utf8_offset_i(esch_string* str, size_t index)
+{
+    const unsigned char* utf8 = (const unsigned char*)str->utf8;
+    struct esch_string_view* view = NULL;
+    size_t n = 0;
+    size_t i = 0;
+    ESCH_CHECK_PARAM_INTERNAL(str->utf8 != NULL);
+    ESCH_CHECK_PARAM_INTERNAL(index <= str->unicode_len);
+    if (ESCH_STRING_IS_ASCII(str))
+    {
+        return index;
+    }
+    if (ESCH_STRING_IS_VIEW(str))
+    {
+        /* Use index of parent. */
+        view = ESCH_STRING_VIEW(str);
+        return esch_string_utf8_offset_i(view->parent, view->begin + index)
+               - view->utf8_begin;
+    }
+    if (index >= ESCH_STRING_INDEX_STEP)
+    {
+        if (str->offsets == NULL)
+        {
+            /* Without index, just scan from beginning. */
+            (void)esch_string_build_index_i(str);
+        }
+        if (str->offsets != NULL)
+        {
+            n = index - index % ESCH_STRING_INDEX_STEP;
+            i = str->offsets[index / ESCH_STRING_INDEX_STEP];
+        }
+    }
+    /* Buffer is valid UTF-8, so each character starts with exactly one
+     * byte that is not 10xxxxxx. */
+    for (; i < str->utf8_len; ++i)
+    {
+        if ((utf8[i] & 0xC0) != 0x80)
+        {
+            if (n == index)
+            {
+                return i;
+            }
+            ++n;
+        }
+    }
+    return str->utf8_len;
+}
+
 static esch_error
 esch_string_destructor(esch_object* obj)
 {
@@ -309,6 +567,7 @@ esch_string_destructor(esch_object* obj)
     esch_string* str = NULL;
     esch_alloc* alloc = NULL;
     esch_log* log = NULL;
+    struct esch_string_view* view = NULL;
 
     if (obj == NULL)
     {
@@ -321,10 +580,43 @@ esch_string_destructor(esch_object* obj)
     alloc = ESCH_OBJECT_GET_ALLOC(obj);
     ESCH_CHECK_PARAM_INTERNAL(log != NULL);
     ESCH_CHECK_PARAM_INTERNAL(alloc != NULL);
-    ret = esch_alloc_free(alloc, str->utf8);
-    ESCH_CHECK(ret == ESCH_OK, log, "Can't free UTF-8 string", ret);
-    ret = esch_alloc_free(alloc, str->unicode);
-    ESCH_CHECK(ret == ESCH_OK, log, "Can't free Unicode string", ret);
+    if (str->rope != NULL)
+    {
+        /* Leaves are not deleted here, see esch_string_rope.c */
+        esch_string_rope_release_i(str);
+    }
+    if (ESCH_STRING_IS_VIEW(str))
+    {
+        /* Free only buffers not shared with parent. Never touch
+         * parent, which may have been recycled by GC. */
+        view = ESCH_STRING_VIEW(str);
+        if (view->own_utf8)
+        {
+            ret = esch_alloc_free(alloc, str->utf8);
+            ESCH_CHECK(ret == ESCH_OK, log, "Can't free UTF-8 string", ret);
+        }
+        if (view->own_unicode)
+        {
+            ret = esch_alloc_free(alloc, str->unicode);
+            ESCH_CHECK(ret == ESCH_OK, log, "Can't free Unicode string", ret);
+        }
+        view->parent = NULL;
+    }
+    else
+    {
+        if (!ESCH_STRING_IS_INLINE(str))
+        {
+            ret = esch_alloc_free(alloc, str->utf8);
+            ESCH_CHECK(ret == ESCH_OK, log, "Can't free UTF-8 string", ret);
+        }
+        if (str->unicode != NULL)
+        {
+            ret = esch_alloc_free(alloc, str->unicode);
+            ESCH_CHECK(ret == ESCH_OK, log, "Can't free Unicode string", ret);
+        }
+    }
+    ret = esch_alloc_free(alloc, str->offsets);
+    ESCH_CHECK(ret == ESCH_OK, log, "Can't free index", ret);
 
     str->utf8 = NULL;
     str->unicode = NULL;
@@ -392,189 +684,466 @@ Exit:
     return ret;
 }
 
-static int
-utf8_get_unicode_len(char* utf8, int begin, int end, int* bad_index)
+/*
+ * Count leading ASCII characters. Same as decode_ascii(), but only
+ * check bytes without writing anything.
+ */
+static size_t
+scan_ascii(const unsigned char* utf8, size_t len)
 {
-    int len = 0;
-    int idx = begin;
-    unsigned char ch = '\0';
-    enum esch_unicode_parse_state state = ESCH_BEGIN_BYTE;
-    /*
-     * UTF-8 format: http://www.fileformat.info/info/unicode/utf8.htm
-     * 0xxxxxxx
-     * 110xxxxx 10xxxxxx
-     * 1110xxxx 10xxxxxx 10xxxxxx
-     * 11110xxx 10xxxxxx 10xxxxxx 10xxxxxx
-     */
-    for (idx = begin; idx < end && state != ESCH_WRONG_BYTE; ++idx)
+    size_t i = 0;
+#ifdef ESCH_STRING_USE_SSE2
+    for (i = 0; i + 16 <= len; i += 16)
     {
-        ch = (unsigned char)utf8[idx];
-        if ((ch >> 7) == 0)
+        if (_mm_movemask_epi8(
+                _mm_loadu_si128((const __m128i*)(utf8 + i))) != 0)
         {
-            state = ESCH_ONE_BYTE_FIRST_BYTE;
-            len += 1;
+            break;
         }
-        else if ((ch >> 5) == 0x6)
+    }
+#else
+    uint64_t word = 0;
+    for (i = 0; i + 8 <= len; i += 8)
+    {
+        memcpy(&word, utf8 + i, sizeof(word));
+        if ((word & ESCH_STRING_HIGH_BITS) != 0)
         {
-            state = ESCH_TWO_BYTES_FIRST_BYTE;
-            len += 1;
+            break;
         }
-        else if ((ch >> 4) == 0xE)
+    }
+#endif
+    while (i < len && utf8[i] < 0x80)
+    {
+        ++i;
+    }
+    return i;
+}
+
+/*
+ * Decode leading ASCII characters, as many as possible. Return number
+ * of characters decoded. It may stop before a non-ASCII byte, so
+ * caller must check rest bytes.
+ */
+static size_t
+decode_ascii(const unsigned char* utf8, size_t len, esch_unicode* unicode)
+{
+    size_t i = 0;
+#ifdef ESCH_STRING_USE_SSE2
+    __m128i zero = _mm_setzero_si128();
+    __m128i bytes;
+    __m128i low;
+    __m128i high;
+    /* 16 bytes per step: check high bits, then widen to 32-bit. */
+    for (i = 0; i + 16 <= len; i += 16)
+    {
+        bytes = _mm_loadu_si128((const __m128i*)(utf8 + i));
+        if (_mm_movemask_epi8(bytes) != 0)
         {
-            state = ESCH_THREE_BYTES_FIRST_BYTE;
-            len += 1;
+            break;
         }
-        else if ((ch >> 3) == 0x1E)
+        low = _mm_unpacklo_epi8(bytes, zero);
+        high = _mm_unpackhi_epi8(bytes, zero);
+        _mm_storeu_si128((__m128i*)(unicode + i),
+                         _mm_unpacklo_epi16(low, zero));
+        _mm_storeu_si128((__m128i*)(unicode + i + 4),
+                         _mm_unpackhi_epi16(low, zero));
+        _mm_storeu_si128((__m128i*)(unicode + i + 8),
+                         _mm_unpacklo_epi16(high, zero));
+        _mm_storeu_si128((__m128i*)(unicode + i + 12),
+                         _mm_unpackhi_epi16(high, zero));
+    }
+#else
+    uint64_t word = 0;
+    size_t j = 0;
+    /* 8 bytes per step: check high bits of a machine word. */
+    for (i = 0; i + 8 <= len; i += 8)
+    {
+        memcpy(&word, utf8 + i, sizeof(word));
+        if ((word & ESCH_STRING_HIGH_BITS) != 0)
         {
-            state = ESCH_FOUR_BYTES_FIRST_BYTE;
-            len += 1;
+            break;
         }
-        else if ((ch >> 6) == 0x2)
+        for (j = 0; j < 8; ++j)
         {
-            switch (state)
-            {
-                case ESCH_TWO_BYTES_FIRST_BYTE:
-                    state = ESCH_TWO_BYTES_SECOND_BYTE;
-                    break;
-                case ESCH_THREE_BYTES_FIRST_BYTE:
-                    state = ESCH_THREE_BYTES_SECOND_BYTE;
-                    break;
-                case ESCH_THREE_BYTES_SECOND_BYTE:
-                    state = ESCH_THREE_BYTES_THIRD_BYTE;
-                    break;
-                case ESCH_FOUR_BYTES_FIRST_BYTE:
-                    state = ESCH_FOUR_BYTES_SECOND_BYTE;
-                    break;
-                case ESCH_FOUR_BYTES_THIRD_BYTE:
-                    state = ESCH_FOUR_BYTES_FOURTH_BYTE;
-                    break;
-                case ESCH_TWO_BYTES_SECOND_BYTE:
-                case ESCH_THREE_BYTES_THIRD_BYTE:
-                case ESCH_FOUR_BYTES_FOURTH_BYTE:
-                default:
-                    state = ESCH_WRONG_BYTE;
-                    (*bad_index) = idx;
-                    break;
-            }
+            unicode[i + j] = utf8[i + j];
         }
     }
-    return (state == ESCH_WRONG_BYTE? -1: len);
+#endif
+    for (; i < len && utf8[i] < 0x80; ++i)
+    {
+        unicode[i] = utf8[i];
+    }
+    return i;
 }
-static void
-write_unicode_from_utf8(char* utf8, int begin, int end, esch_unicode* unicode)
+
+#ifdef ESCH_STRING_USE_SSE2
+/* Mark ASCII bytes in [lo, hi] as 0xFF. */
+#define ESCH_SSE2_IN_RANGE(bytes, lo, hi) \
+    _mm_and_si128(_mm_cmpgt_epi8((bytes), _mm_set1_epi8((lo) - 1)), \
+                  _mm_cmplt_epi8((bytes), _mm_set1_epi8((hi) + 1)))
+#endif
+
+/*
+ * Check identifier rules on an ASCII string. Characters after the
+ * first one must be letters, digits or extended alphabetic characters.
+ */
+static int
+is_ascii_identifier(const unsigned char* utf8, size_t len)
 {
-    int utf8_idx = begin;
-    int unicode_idx = 0;
-    unsigned char utf8_ch = '\0';
-    enum esch_unicode_parse_state state = ESCH_BEGIN_BYTE;
+    size_t i = 1;
+#ifdef ESCH_STRING_USE_SSE2
+    __m128i bytes;
+    __m128i valid;
+#endif
+    ESCH_ASSERT(len > 0);
+    if (!(esch_unicode_identifier_ascii[utf8[0]] & ESCH_IDENTIFIER_INITIAL))
+    {
+        return 0;
+    }
+#ifdef ESCH_STRING_USE_SSE2
     /*
-     * UTF-8 format: http://www.fileformat.info/info/unicode/utf8.htm
-     * 0xxxxxxx
-     * 110xxxxx 10xxxxxx
-     * 1110xxxx 10xxxxxx 10xxxxxx
-     * 11110xxx 10xxxxxx 10xxxxxx 10xxxxxx
+     * 16 bytes per step. Allowed characters are 8 ranges:
+     * ! $%& *+ -./0-9: <=>?@A-Z ^_ a-z ~
+     * Last step overlaps previous bytes instead of a scalar tail.
      */
-    for (utf8_idx = begin, unicode_idx = 0; utf8_idx < end; ++utf8_idx)
+    for (i = 1; len > 16 && i < len; i += 16)
     {
-        utf8_ch = (unsigned char)utf8[utf8_idx];
-        if ((utf8_ch >> 7) == 0)
+        if (i + 16 > len)
         {
-            state = ESCH_ONE_BYTE_FIRST_BYTE;
-            unicode[unicode_idx] = (utf8_ch & 0x7F);
-            ++unicode_idx;
+            i = len - 16;
         }
-        else if ((utf8_ch >> 5) == 0x6)
+        bytes = _mm_loadu_si128((const __m128i*)(utf8 + i));
+        valid = _mm_or_si128(
+                    _mm_or_si128(
+                        _mm_or_si128(
+                            _mm_cmpeq_epi8(bytes, _mm_set1_epi8('!')),
+                            ESCH_SSE2_IN_RANGE(bytes, '$', '&')),
+                        _mm_or_si128(
+                            ESCH_SSE2_IN_RANGE(bytes, '*', '+'),
+                            ESCH_SSE2_IN_RANGE(bytes, '-', ':'))),
+                    _mm_or_si128(
+                        _mm_or_si128(
+                            ESCH_SSE2_IN_RANGE(bytes, '<', 'Z'),
+                            ESCH_SSE2_IN_RANGE(bytes, '^', '_')),
+                        _mm_or_si128(
+                            ESCH_SSE2_IN_RANGE(bytes, 'a', 'z'),
+                            _mm_cmpeq_epi8(bytes, _mm_set1_epi8('~')))));
+        if (_mm_movemask_epi8(valid) != 0xFFFF)
         {
-            state = ESCH_TWO_BYTES_FIRST_BYTE;
-            unicode[unicode_idx] = (utf8_ch & 0x1F);
+            return 0;
         }
-        else if ((utf8_ch >> 4) == 0xE)
+    }
+#endif
+    for (; i < len; ++i)
+    {
+        if (!(esch_unicode_identifier_ascii[utf8[i]] &
+              ESCH_IDENTIFIER_SUBSEQUENT))
         {
-            state = ESCH_THREE_BYTES_FIRST_BYTE;
-            unicode[unicode_idx] = (utf8_ch & 0xF);
+            return 0;
         }
-        else if ((utf8_ch >> 3) == 0x1E)
+    }
+    return 1;
+}
+
+/*
+ * Validate and decode UTF-8 in one pass. The unicode buffer must hold
+ * at least (len + 1) characters. If unicode is NULL, only validate
+ * and count characters. Return 0 if success, or -1 if input is not
+ * valid UTF-8, with index of bad byte in bad_index.
+ *
+ * UTF-8 format: http://www.fileformat.info/info/unicode/utf8.htm
+ * 0xxxxxxx
+ * 110xxxxx 10xxxxxx
+ * 1110xxxx 10xxxxxx 10xxxxxx
+ * 11110xxx 10xxxxxx 10xxxxxx 10xxxxxx
+ *
+ * Valid ranges follow table 3-7 of Unicode standard. Only the second
+ * byte has a range other than 80..BF, which rejects overlong forms
+ * (C0, C1, E0 80..9F, F0 80..8F), surrogates (ED A0..BF) and values
+ * beyond 10FFFF (F4 90..BF, F5..FF).
+ */
+static int
+decode_utf8_i(const unsigned char* utf8, size_t len,
+              esch_unicode* unicode, size_t* unicode_len, size_t* bad_index)
+{
+    size_t i = 0;
+    size_t n = 0;
+    size_t ascii = 0;
+    size_t follow = 0;
+    size_t k = 0;
+    unsigned char ch = 0;
+    unsigned char low = 0x80;
+    unsigned char high = 0xBF;
+    esch_unicode value = 0;
+
+    while (i < len)
+    {
+        ch = utf8[i];
+        if (ch < 0x80)
+        {
+            ascii = (unicode == NULL?
+                     scan_ascii(utf8 + i, len - i):
+                     decode_ascii(utf8 + i, len - i, unicode + n));
+            i += ascii;
+            n += ascii;
+            continue;
+        }
+        low = 0x80;
+        high = 0xBF;
+        if (ch < 0xC2)
+        {
+            (*bad_index) = i;
+            return -1;
+        }
+        else if (ch < 0xE0)
+        {
+            follow = 1;
+            value = (ch & 0x1F);
+        }
+        else if (ch < 0xF0)
+        {
+            follow = 2;
+            value = (ch & 0xF);
+            low = (ch == 0xE0? 0xA0: 0x80);
+            high = (ch == 0xED? 0x9F: 0xBF);
+        }
+        else if (ch < 0xF5)
+        {
+            follow = 3;
+            value = (ch & 0x7);
+            low = (ch == 0xF0? 0x90: 0x80);
+            high = (ch == 0xF4? 0x8F: 0xBF);
+        }
+        else
+        {
+            (*bad_index) = i;
+            return -1;
+        }
+        if (follow >= len - i)
         {
-            state = ESCH_FOUR_BYTES_FIRST_BYTE;
-            unicode[unicode_idx] = (utf8_ch & 0x7);
+            (*bad_index) = len;
+            return -1;
         }
-        else if ((utf8_ch >> 6) == 0x2)
+        for (k = 1; k <= follow; ++k)
         {
-            switch (state)
+            ch = utf8[i + k];
+            if (ch < low || ch > high)
             {
-                case ESCH_TWO_BYTES_FIRST_BYTE:
-                    state = ESCH_TWO_BYTES_SECOND_BYTE;
-                    unicode[unicode_idx] <<= 6;
-                    unicode[unicode_idx] += (utf8_ch & 0x3F);
-                    ++unicode_idx;
-                    break;
-                case ESCH_THREE_BYTES_FIRST_BYTE:
-                    state = ESCH_THREE_BYTES_SECOND_BYTE;
-                    unicode[unicode_idx] <<= 6;
-                    unicode[unicode_idx] += (utf8_ch & 0x3F);
-                    break;
-                case ESCH_THREE_BYTES_SECOND_BYTE:
-                    state = ESCH_THREE_BYTES_THIRD_BYTE;
-                    unicode[unicode_idx] <<= 6;
-                    unicode[unicode_idx] += (utf8_ch & 0x3F);
-                    ++unicode_idx;
-                    break;
-                case ESCH_FOUR_BYTES_FIRST_BYTE:
-                    state = ESCH_FOUR_BYTES_SECOND_BYTE;
-                    unicode[unicode_idx] <<= 6;
-                    unicode[unicode_idx] += (utf8_ch & 0x3F);
-                    break;
-                case ESCH_FOUR_BYTES_THIRD_BYTE:
-                    state = ESCH_FOUR_BYTES_FOURTH_BYTE;
-                    unicode[unicode_idx] <<= 6;
-                    unicode[unicode_idx] += (utf8_ch & 0x3F);
-                    ++unicode_idx;
-                    break;
-                case ESCH_TWO_BYTES_SECOND_BYTE:
-                case ESCH_THREE_BYTES_THIRD_BYTE:
-                case ESCH_FOUR_BYTES_FOURTH_BYTE:
-                default:
-                    /* Impossible to happen: we've got correct
-                     * calcaulation. */
-                    ESCH_CHECK_PARAM_INTERNAL(0);
-                    state = ESCH_WRONG_BYTE;
-                    break;
+                (*bad_index) = i + k;
+                return -1;
             }
+            value = (value << 6) | (ch & 0x3F);
+            low = 0x80;
+            high = 0xBF;
         }
+        if (unicode != NULL)
+        {
+            unicode[n] = value;
+        }
+        ++n;
+        i += follow + 1;
     }
-    ESCH_CHECK_PARAM_INTERNAL(state != ESCH_WRONG_BYTE);
-    unicode[unicode_idx] = L'\0';
-    return;
+    if (unicode != NULL)
+    {
+        unicode[n] = 0;
+    }
+    (*unicode_len) = n;
+    return 0;
 }
 
+/*
+ * Create Unicode buffer of a string. The UTF-8 buffer has been
+ * validated when string is created, so decoding never fails here.
+ */
 static esch_error
-decode_utf8(char* utf8, int begin, int end, 
-            esch_config* config, esch_unicode** str, size_t* unicode_len)
+esch_string_materialize_i(esch_string* str)
 {
     esch_error ret = ESCH_OK;
-    int len = 0;
-    int bad_index;
-    int buf_size = 0;
-    unsigned char* ptr = (unsigned char*)utf8;
-    esch_unicode* new_str = NULL;
+    int status = 0;
+    size_t bad_index = 0;
+    size_t count = 0;
+    esch_unicode* new_unicode = NULL;
     esch_alloc* alloc = NULL;
     esch_log* log = NULL;
 
-    alloc = ESCH_CAST_FROM_OBJECT(ESCH_CONFIG_GET_ALLOC(config), esch_alloc);
-    log = ESCH_CAST_FROM_OBJECT(ESCH_CONFIG_GET_LOG(config), esch_log);
-
-    len = utf8_get_unicode_len(utf8, begin, end, &bad_index);
-    ESCH_CHECK_1(len >= 0, log, "Bad Unicode at index %d", bad_index,
-                 ESCH_ERROR_INVALID_PARAMETER);
+    alloc = ESCH_OBJECT_GET_ALLOC(ESCH_CAST_TO_OBJECT(str));
+    log = ESCH_OBJECT_GET_LOG(ESCH_CAST_TO_OBJECT(str));
+    ESCH_CHECK_PARAM_INTERNAL(alloc != NULL);
+    ESCH_CHECK_PARAM_INTERNAL(log != NULL);
 
-    buf_size = sizeof(esch_unicode) * (len + 1);
-    ret = esch_alloc_realloc(alloc, NULL, buf_size, (void**)&new_str);
+    ret = esch_alloc_realloc(alloc, NULL,
+                             sizeof(esch_unicode) * (str->unicode_len + 1),
+                             (void**)&new_unicode);
     ESCH_CHECK(ret == ESCH_OK, log, "Can't malloc new buffer", ret);
-    write_unicode_from_utf8(utf8, begin, end, new_str);
-    (*str) = new_str;
-    (*unicode_len) = (size_t)len;
-    new_str = NULL;
+    status = decode_utf8_i((const unsigned char*)str->utf8, str->utf8_len,
+                           new_unicode, &count, &bad_index);
+    ESCH_CHECK_1(status == 0 && count == str->unicode_len, log,
+                 "Bad Unicode at index %d", (int)bad_index,
+                 ESCH_ERROR_INVALID_STATE);
+    str->unicode = new_unicode;
+    new_unicode = NULL;
+Exit:
+    esch_alloc_free(alloc, new_unicode);
+    return ret;
+}
+
+/*
+ * Create a view of characters [begin, end) of str. A view of view
+ * refers to the original parent directly.
+ */
+static esch_error
+esch_string_new_view_i(esch_config* config, esch_string* str,
+                       size_t begin, size_t end,
+                       size_t utf8_begin, size_t utf8_end,
+                       esch_string** output)
+{
+    esch_error ret = ESCH_OK;
+    esch_object* new_obj = NULL;
+    esch_string* new_str = NULL;
+    esch_string* parent = str;
+    struct esch_string_view* view = NULL;
+
+    if (ESCH_STRING_IS_VIEW(str))
+    {
+        parent = ESCH_STRING_VIEW(str)->parent;
+        begin += ESCH_STRING_VIEW(str)->begin;
+        end += ESCH_STRING_VIEW(str)->begin;
+        utf8_begin += ESCH_STRING_VIEW(str)->utf8_begin;
+        utf8_end += ESCH_STRING_VIEW(str)->utf8_begin;
+    }
+    ESCH_CHECK_PARAM_INTERNAL(parent->utf8 != NULL);
+
+    ret = esch_object_new_i(config, &(esch_string_view_type.type), &new_obj);
+    ESCH_CHECK(ret == ESCH_OK, str, "Can't create string object", ret);
+    new_str = ESCH_CAST_FROM_OBJECT(new_obj, esch_string);
+    new_str->utf8 = parent->utf8 + utf8_begin;
+    new_str->utf8_len = utf8_end - utf8_begin;
+    new_str->unicode = NULL;
+    new_str->unicode_len = end - begin;
+    new_str->rope = NULL;
+    new_str->offsets = NULL;
+    view = ESCH_STRING_VIEW(new_str);
+    view->parent = parent;
+    view->begin = begin;
+    view->utf8_begin = utf8_begin;
+    view->own_utf8 = ESCH_FALSE;
+    view->own_unicode = ESCH_FALSE;
+    ESCH_CHECK_PARAM_INTERNAL(ESCH_IS_VALID_STRING(new_str));
+    (*output) = new_str;
+Exit:
+    return ret;
+}
+
+/*
+ * Copy UTF-8 bytes of a view to its own buffer, to end it with '\0'.
+ */
+static esch_error
+esch_string_terminate_view_i(esch_string* str)
+{
+    esch_error ret = ESCH_OK;
+    esch_alloc* alloc = NULL;
+    esch_utf8* new_utf8 = NULL;
+    ESCH_CHECK_PARAM_INTERNAL(ESCH_STRING_IS_VIEW(str));
+    ESCH_CHECK_PARAM_INTERNAL(!ESCH_STRING_VIEW(str)->own_utf8);
+
+    alloc = ESCH_OBJECT_GET_ALLOC(ESCH_CAST_TO_OBJECT(str));
+    ret = esch_alloc_realloc(alloc, NULL, str->utf8_len + 1,
+                             (void**)&new_utf8);
+    ESCH_CHECK(ret == ESCH_OK, str, "Can't malloc UTF-8", ret);
+    memcpy(new_utf8, str->utf8, str->utf8_len);
+    new_utf8[str->utf8_len] = '\0';
+    str->utf8 = new_utf8;
+    ESCH_STRING_VIEW(str)->own_utf8 = ESCH_TRUE;
 Exit:
-    esch_alloc_free(alloc, new_str);
     return ret;
 }
+
+/*
+ * Record UTF-8 offset of every ESCH_STRING_INDEX_STEP characters.
+ */
+static esch_error
+esch_string_build_index_i(esch_string* str)
+{
+    esch_error ret = ESCH_OK;
+    esch_alloc* alloc = NULL;
+    const unsigned char* utf8 = (const unsigned char*)str->utf8;
+    size_t* offsets = NULL;
+    size_t n = 0;
+    size_t i = 0;
+    ESCH_CHECK_PARAM_INTERNAL(str->utf8 != NULL);
+    ESCH_CHECK_PARAM_INTERNAL(str->offsets == NULL);
+
+    alloc = ESCH_OBJECT_GET_ALLOC(ESCH_CAST_TO_OBJECT(str));
+    ret = esch_alloc_realloc(alloc, NULL, sizeof(size_t) *
+                             (str->unicode_len / ESCH_STRING_INDEX_STEP + 1),
+                             (void**)&offsets);
+    ESCH_CHECK(ret == ESCH_OK, str, "Can't malloc index", ret);
+    for (i = 0; i < str->utf8_len; ++i)
+    {
+        if ((utf8[i] & 0xC0) != 0x80)
+        {
+            if (n % ESCH_STRING_INDEX_STEP == 0)
+            {
+                offsets[n / ESCH_STRING_INDEX_STEP] = i;
+            }
+            ++n;
+        }
+    }
+    if (n % ESCH_STRING_INDEX_STEP == 0)
+    {
+        offsets[n / ESCH_STRING_INDEX_STEP] = str->utf8_len;
+    }
+    str->offsets = offsets;
+Exit:
+    return ret;
+}
+
+/*
+ * Iterator of view returns its parent only, so GC keeps parent alive.
+ */
+static esch_error
+esch_string_view_iterator_get_value_i(esch_iterator* iter,
+                                      esch_value* value)
+{
+    esch_string* str = NULL;
+    ESCH_CHECK_PARAM_INTERNAL(iter != NULL);
+    ESCH_CHECK_PARAM_INTERNAL(value != NULL);
+    ESCH_CHECK_PARAM_INTERNAL(iter->container != NULL);
+
+    str = ESCH_CAST_FROM_OBJECT(iter->container, esch_string);
+    if (iter->iterator == NULL)
+    {
+        value->type = ESCH_VALUE_TYPE_OBJECT;
+        value->val.o = ESCH_CAST_TO_OBJECT(ESCH_STRING_VIEW(str)->parent);
+    }
+    else
+    {
+        value->type = ESCH_VALUE_TYPE_END;
+        value->val.o = NULL;
+    }
+    return ESCH_OK;
+}
+
+static esch_error
+esch_string_view_iterator_get_next_i(esch_iterator* iter)
+{
+    ESCH_CHECK_PARAM_INTERNAL(iter != NULL);
+    iter->iterator = (void*)1;
+    return ESCH_OK;
+}
+
+static esch_error
+esch_string_view_get_iterator_i(esch_object* obj, esch_iterator* iter)
+{
+    ESCH_CHECK_PARAM_INTERNAL(obj != NULL);
+    ESCH_CHECK_PARAM_INTERNAL(iter != NULL);
+    ESCH_CHECK_PARAM_INTERNAL(ESCH_STRING_IS_VIEW(
+                ESCH_CAST_FROM_OBJECT(obj, esch_string)));
+
+    iter->container = obj;
+    iter->iterator = NULL;
+    iter->get_value = esch_string_view_iterator_get_value_i;
+    iter->get_next = esch_string_view_iterator_get_next_i;
+    iter->seek_object = NULL;
+    return ESCH_OK;
+}
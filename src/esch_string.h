@@ -11,19 +11,107 @@
 extern "C" {
 #endif /* __cplusplus */
 
+struct esch_rope_node;
+
+/*
+ * A string is either flat, or a rope (see esch_string_rope.c). Both
+ * kinds share the same structure, but rope strings use type
+ * esch_string_rope_type, which is a container for GC.
+ */
 struct esch_string
 {
-    esch_utf8* utf8;
+    esch_utf8* utf8;       /* Rope string: NULL until it's flattened. */
     size_t utf8_len;
-    esch_unicode* unicode;
-    size_t unicode_len;
+    esch_unicode* unicode; /* Created on demand. May be NULL. */
+    size_t unicode_len;    /* Always valid, counted on creation. */
+    struct esch_rope_node* rope; /* Tree of rope string, or NULL. */
+    size_t* offsets; /* Sparse index of UTF-8 offsets. May be NULL. */
+};
+
+extern struct esch_builtin_type esch_string_type;
+extern struct esch_builtin_type esch_string_inline_type;
+extern struct esch_builtin_type esch_string_rope_type;
+extern struct esch_builtin_type esch_string_view_type;
+
+/*
+ * Short strings use esch_string_inline_type. UTF-8 bytes are kept
+ * right after esch_string structure, so object and bytes need only one
+ * allocation. Size includes '\0'.
+ */
+#define ESCH_STRING_INLINE_SIZE 24
+#define ESCH_STRING_INLINE_UTF8(str) ((esch_utf8*)((str) + 1))
+#define ESCH_STRING_IS_INLINE(str) \
+    (ESCH_OBJECT_GET_TYPE(ESCH_CAST_TO_OBJECT(str)) == \
+     &(esch_string_inline_type.type))
+
+/*
+ * Substring of a flat string is a view, using esch_string_view_type.
+ * It shares UTF-8 buffer of its parent, and also Unicode buffer if it
+ * ends where parent ends. GC keeps parent alive via iterator of view.
+ * Fields below are kept right after esch_string structure.
+ */
+struct esch_string_view
+{
+    esch_string* parent; /* Always a flat string, never a view */
+    size_t begin;        /* Index of first character in parent */
+    size_t utf8_begin;   /* Offset of first byte in parent */
+    esch_bool own_utf8;    /* Buffer copied when '\0' is needed */
+    esch_bool own_unicode; /* Buffer not shared with parent */
 };
+#define ESCH_STRING_VIEW(str) ((struct esch_string_view*)((str) + 1))
+#define ESCH_STRING_IS_VIEW(str) \
+    (ESCH_OBJECT_GET_TYPE(ESCH_CAST_TO_OBJECT(str)) == \
+     &(esch_string_view_type.type))
+
+/*
+ * Non-ASCII strings keep UTF-8 offset of every ESCH_STRING_INDEX_STEP
+ * characters, so finding a character scans at most that many
+ * characters. Index is created on first use.
+ */
+#define ESCH_STRING_INDEX_STEP 64
 
 #define ESCH_IS_VALID_STRING(str) \
     ((str) != NULL && \
      ESCH_IS_VALID_OBJECT(ESCH_CAST_TO_OBJECT(str)) && \
-     (str)->utf8 != NULL && \
-     (str)->unicode != NULL)
+     ((str)->utf8 != NULL || (str)->rope != NULL))
+
+/* One byte per character: UTF-8 buffer can be indexed directly. */
+#define ESCH_STRING_IS_ASCII(str) ((str)->utf8_len == (str)->unicode_len)
+
+/* Identifier classes of ASCII characters, generated in esch_range.c. */
+extern const unsigned char esch_unicode_identifier_ascii[];
+#define ESCH_IDENTIFIER_INITIAL 1
+#define ESCH_IDENTIFIER_SUBSEQUENT 2
+#define ESCH_UNICODE_IS_IDENTIFIER_SUBSEQUENT(ch) \
+    ((uint32_t)(ch) < 128? \
+     (esch_unicode_identifier_ascii[(ch)] & ESCH_IDENTIFIER_SUBSEQUENT) != 0: \
+     esch_unicode_is_identifier_subsequent(ch))
+
+/**
+ * Check if given bytes are valid UTF-8, and count characters. Shared
+ * by types keeping UTF-8 names without esch_string.
+ * @return 0 if valid, -1 if not, with index of bad byte in bad_index.
+ */
+int esch_string_validate_utf8_i(const esch_utf8* utf8, size_t len,
+                                size_t* unicode_len, size_t* bad_index);
+/**
+ * Get offset in UTF-8 buffer of a character, given its Unicode index.
+ * String must be flat.
+ */
+size_t esch_string_utf8_offset_i(esch_string* str, size_t index);
+
+/* Rope strings, see esch_string_rope.c */
+esch_error esch_string_rope_flatten_i(esch_string* str);
+esch_error esch_string_rope_get_unicode_at_i(esch_string* str,
+                                             size_t index,
+                                             esch_unicode* ch);
+esch_error esch_string_rope_substring_i(esch_config* config,
+                                        esch_string* str,
+                                        size_t begin, size_t end,
+                                        esch_string** output);
+void esch_string_rope_release_i(esch_string* str);
+esch_error esch_string_rope_get_iterator_i(esch_object* obj,
+                                           esch_iterator* iter);
 
 #ifdef __cplusplus
 }
@@ -0,0 +1,808 @@
+/* vim:ft=c expandtab tw=72 sw=4
+ */
+/* See Copyright notice in esch.h */
+#include "esch_string.h"
+#include "esch_log.h"
+#include "esch_debug.h"
+#include "esch_config.h"
+#include "esch_alloc.h"
+#include <string.h>
+
+/*
+ * Rope string: a height balanced (AVL) tree, with flat esch_string
+ * objects as leaves. Each node keeps lengths of its subtree, so
+ * concatenation, substring and indexing by character take O(log n)
+ * steps. UTF-8 buffer is created only when it's asked for.
+ *
+ * Tree nodes are not objects. They never change after creation, and
+ * are shared between rope strings with reference counting, so deleting
+ * one rope string never breaks another rope string built from it.
+ *
+ * Leaves are objects. With GC, they are traced via iterator of rope
+ * string. Without GC, leaves created by rope itself (pieces of
+ * substring, or merged short leaves) are owned by leaf node and deleted
+ * with it, while strings from caller are never deleted. Caller must
+ * keep them until rope strings using them are deleted.
+ */
+struct esch_rope_node
+{
+    size_t refs;
+    size_t utf8_len;
+    size_t unicode_len;
+    size_t leaves;
+    int height; /* Leaf node: 0 */
+    esch_bool owned; /* Leaf string is deleted with node */
+    struct esch_rope_node* left;
+    struct esch_rope_node* right;
+    esch_string* leaf;
+};
+
+/* Information shared by all nodes created in one operation. */
+struct esch_rope_context
+{
+    esch_config* config;
+    esch_alloc* alloc;
+    esch_log* log;
+    esch_bool own_leaves; /* ESCH_TRUE if there's no GC */
+};
+
+/*
+ * Two leaves are merged (copied) when concatenated, if they are short
+ * enough. It keeps tree small when a long string is built from
+ * characters or short tokens.
+ */
+#define ESCH_ROPE_SHORT_LEAF 64
+
+static esch_error
+esch_rope_context_init_i(esch_config* config, struct esch_rope_context* ctx);
+static void
+esch_rope_unref_i(esch_alloc* alloc, struct esch_rope_node* node);
+static esch_error
+esch_rope_leaf_new_i(struct esch_rope_context* ctx, esch_string* str,
+                     esch_bool owned, struct esch_rope_node** node);
+static esch_error
+esch_rope_node_new_i(struct esch_rope_context* ctx,
+                     struct esch_rope_node* left,
+                     struct esch_rope_node* right,
+                     struct esch_rope_node** node);
+static esch_error
+esch_rope_merge_i(struct esch_rope_context* ctx,
+                  struct esch_rope_node* left,
+                  struct esch_rope_node* right,
+                  struct esch_rope_node** node);
+static esch_error
+esch_rope_balance_i(struct esch_rope_context* ctx,
+                    struct esch_rope_node* left,
+                    struct esch_rope_node* right,
+                    struct esch_rope_node** node);
+static esch_error
+esch_rope_join_i(struct esch_rope_context* ctx,
+                 struct esch_rope_node* left,
+                 struct esch_rope_node* right,
+                 struct esch_rope_node** node);
+static esch_error
+esch_rope_sub_i(struct esch_rope_context* ctx, struct esch_rope_node* node,
+                size_t begin, size_t end, struct esch_rope_node** output);
+static esch_error
+esch_rope_of_string_i(struct esch_rope_context* ctx, esch_string* str,
+                      struct esch_rope_node** node);
+static esch_error
+esch_rope_string_new_i(struct esch_rope_context* ctx,
+                       struct esch_rope_node* tree, esch_string** str);
+static esch_string*
+esch_rope_find_leaf_i(struct esch_rope_node* node, size_t* index);
+static size_t
+esch_rope_copy_utf8_i(struct esch_rope_node* node, esch_utf8* buf);
+static esch_string*
+esch_rope_leaf_at_i(struct esch_rope_node* node, size_t index);
+
+/*
+ * ---------------------------------------------------------------
+ * Public interfaces
+ * ---------------------------------------------------------------
+ */
+esch_error
+esch_string_concat(esch_config* config, esch_string* left,
+                   esch_string* right, esch_string** str)
+{
+    esch_error ret = ESCH_OK;
+    struct esch_rope_context ctx = { NULL, NULL, NULL, ESCH_FALSE };
+    struct esch_rope_node* left_node = NULL;
+    struct esch_rope_node* right_node = NULL;
+    struct esch_rope_node* tree = NULL;
+    ESCH_CHECK_PARAM_PUBLIC(config != NULL);
+    ESCH_CHECK_PARAM_PUBLIC(left != NULL);
+    ESCH_CHECK_PARAM_PUBLIC(ESCH_IS_VALID_STRING(left));
+    ESCH_CHECK_PARAM_PUBLIC(right != NULL);
+    ESCH_CHECK_PARAM_PUBLIC(ESCH_IS_VALID_STRING(right));
+    ESCH_CHECK_PARAM_PUBLIC(str != NULL);
+
+    ret = esch_rope_context_init_i(config, &ctx);
+    ESCH_CHECK(ret == ESCH_OK, left, "Bad config", ret);
+
+    ret = esch_rope_of_string_i(&ctx, left, &left_node);
+    ESCH_CHECK(ret == ESCH_OK, ctx.log, "Can't get left rope", ret);
+    ret = esch_rope_of_string_i(&ctx, right, &right_node);
+    ESCH_CHECK(ret == ESCH_OK, ctx.log, "Can't get right rope", ret);
+
+    /* Empty string does not need a leaf. */
+    if (right_node->unicode_len == 0)
+    {
+        tree = left_node;
+        left_node = NULL;
+    }
+    else if (left_node->unicode_len == 0)
+    {
+        tree = right_node;
+        right_node = NULL;
+    }
+    else
+    {
+        ret = esch_rope_join_i(&ctx, left_node, right_node, &tree);
+        left_node = NULL;
+        right_node = NULL;
+        ESCH_CHECK(ret == ESCH_OK, ctx.log, "Can't join ropes", ret);
+    }
+    ret = esch_rope_string_new_i(&ctx, tree, str);
+    tree = NULL;
+    ESCH_CHECK(ret == ESCH_OK, ctx.log, "Can't create rope string", ret);
+Exit:
+    if (left_node != NULL)
+    {
+        esch_rope_unref_i(ctx.alloc, left_node);
+    }
+    if (right_node != NULL)
+    {
+        esch_rope_unref_i(ctx.alloc, right_node);
+    }
+    return ret;
+}
+
+/*
+ * -----------------------------------------------------------------
+ * Internal functions, called by esch_string.c
+ * -----------------------------------------------------------------
+ */
+esch_error
+esch_string_rope_flatten_i(esch_string* str)
+{
+    esch_error ret = ESCH_OK;
+    esch_alloc* alloc = NULL;
+    esch_log* log = NULL;
+    esch_utf8* new_utf8 = NULL;
+    size_t len = 0;
+    ESCH_CHECK_PARAM_INTERNAL(str != NULL);
+    ESCH_CHECK_PARAM_INTERNAL(str->rope != NULL);
+
+    alloc = ESCH_OBJECT_GET_ALLOC(ESCH_CAST_TO_OBJECT(str));
+    log = ESCH_OBJECT_GET_LOG(ESCH_CAST_TO_OBJECT(str));
+    ret = esch_alloc_realloc(alloc, NULL,
+                             sizeof(esch_utf8) * (str->utf8_len + 1),
+                             (void**)&new_utf8);
+    ESCH_CHECK(ret == ESCH_OK, log, "Can't malloc UTF-8", ret);
+    len = esch_rope_copy_utf8_i(str->rope, new_utf8);
+    ESCH_CHECK_PARAM_INTERNAL(len == str->utf8_len);
+    new_utf8[len] = '\0';
+
+    /* Now it's a flat string. Leaves are not needed any more. */
+    str->utf8 = new_utf8;
+    new_utf8 = NULL;
+    esch_string_rope_release_i(str);
+Exit:
+    esch_alloc_free(alloc, new_utf8);
+    return ret;
+}
+
+esch_error
+esch_string_rope_get_unicode_at_i(esch_string* str, size_t index,
+                                  esch_unicode* ch)
+{
+    esch_string* leaf = NULL;
+    ESCH_CHECK_PARAM_INTERNAL(str != NULL);
+    ESCH_CHECK_PARAM_INTERNAL(str->rope != NULL);
+    ESCH_CHECK_PARAM_INTERNAL(index < str->unicode_len);
+
+    leaf = esch_rope_find_leaf_i(str->rope, &index);
+    return esch_string_get_unicode_at(leaf, index, ch);
+}
+
+esch_error
+esch_string_rope_substring_i(esch_config* config, esch_string* str,
+                             size_t begin, size_t end,
+                             esch_string** output)
+{
+    esch_error ret = ESCH_OK;
+    struct esch_rope_context ctx = { NULL, NULL, NULL, ESCH_FALSE };
+    struct esch_rope_node* tree = NULL;
+    ESCH_CHECK_PARAM_INTERNAL(str != NULL);
+    ESCH_CHECK_PARAM_INTERNAL(str->rope != NULL);
+    ESCH_CHECK_PARAM_INTERNAL(begin <= end && end <= str->unicode_len);
+
+    if (begin == end)
+    {
+        ret = esch_string_new_from_utf8(config, "", 0, 0, output);
+        goto Exit;
+    }
+    ret = esch_rope_context_init_i(config, &ctx);
+    ESCH_CHECK(ret == ESCH_OK, str, "Bad config", ret);
+    ret = esch_rope_sub_i(&ctx, str->rope, begin, end, &tree);
+    ESCH_CHECK(ret == ESCH_OK, ctx.log, "Can't split rope", ret);
+    ret = esch_rope_string_new_i(&ctx, tree, output);
+    ESCH_CHECK(ret == ESCH_OK, ctx.log, "Can't create rope string", ret);
+Exit:
+    return ret;
+}
+
+void
+esch_string_rope_release_i(esch_string* str)
+{
+    ESCH_CHECK_PARAM_INTERNAL(str != NULL);
+    if (str->rope != NULL)
+    {
+        esch_rope_unref_i(ESCH_OBJECT_GET_ALLOC(ESCH_CAST_TO_OBJECT(str)),
+                          str->rope);
+        str->rope = NULL;
+    }
+}
+
+/*
+ * Iterator of rope string returns leaves, so GC can mark them. A
+ * flattened rope string has no leaves.
+ */
+static esch_error
+esch_string_rope_iterator_get_value_i(esch_iterator* iter,
+                                      esch_value* value)
+{
+    esch_string* str = NULL;
+    size_t index = 0;
+    ESCH_CHECK_PARAM_INTERNAL(iter != NULL);
+    ESCH_CHECK_PARAM_INTERNAL(value != NULL);
+    ESCH_CHECK_PARAM_INTERNAL(iter->container != NULL);
+
+    str = ESCH_CAST_FROM_OBJECT(iter->container, esch_string);
+    index = (size_t)(iter->iterator);
+    if (str->rope == NULL || index >= str->rope->leaves)
+    {
+        value->type = ESCH_VALUE_TYPE_END;
+        value->val.o = NULL;
+    }
+    else
+    {
+        value->type = ESCH_VALUE_TYPE_OBJECT;
+        value->val.o = ESCH_CAST_TO_OBJECT(
+                esch_rope_leaf_at_i(str->rope, index));
+    }
+    return ESCH_OK;
+}
+
+static esch_error
+esch_string_rope_iterator_get_next_i(esch_iterator* iter)
+{
+    ESCH_CHECK_PARAM_INTERNAL(iter != NULL);
+    iter->iterator = (void*)(((size_t)iter->iterator) + 1);
+    return ESCH_OK;
+}
+
+esch_error
+esch_string_rope_get_iterator_i(esch_object* obj, esch_iterator* iter)
+{
+    esch_error ret = ESCH_OK;
+    ESCH_CHECK_PARAM_INTERNAL(obj != NULL);
+    ESCH_CHECK_PARAM_INTERNAL(iter != NULL);
+    ESCH_CHECK_PARAM_INTERNAL(ESCH_IS_VALID_STRING(
+                ESCH_CAST_FROM_OBJECT(obj, esch_string)));
+
+    iter->container = obj;
+    iter->iterator = (void*)0;
+    iter->get_value = esch_string_rope_iterator_get_value_i;
+    iter->get_next = esch_string_rope_iterator_get_next_i;
+    iter->seek_object = NULL; /* Leaves are all objects */
+    return ret;
+}
+
+/*
+ * -----------------------------------------------------------------
+ * Tree operations. Functions taking nodes as parameter "consume" them:
+ * caller gives up its references, even if function fails.
+ * -----------------------------------------------------------------
+ */
+static esch_error
+esch_rope_context_init_i(esch_config* config, struct esch_rope_context* ctx)
+{
+    esch_error ret = ESCH_OK;
+    esch_object* alloc_obj = NULL;
+    esch_object* log_obj = NULL;
+    ESCH_CHECK_PARAM_INTERNAL(config != NULL);
+    ESCH_CHECK_PARAM_INTERNAL(ctx != NULL);
+
+    alloc_obj = ESCH_CONFIG_GET_ALLOC(config);
+    log_obj = ESCH_CONFIG_GET_LOG(config);
+    ESCH_CHECK_PARAM_PUBLIC(alloc_obj != NULL);
+    ESCH_CHECK_PARAM_PUBLIC(log_obj != NULL);
+    ctx->config = config;
+    ctx->alloc = ESCH_CAST_FROM_OBJECT(alloc_obj, esch_alloc);
+    ctx->log = ESCH_CAST_FROM_OBJECT(log_obj, esch_log);
+    ctx->own_leaves = (ESCH_CONFIG_GET_GC(config) == NULL?
+                       ESCH_TRUE: ESCH_FALSE);
+Exit:
+    return ret;
+}
+
+static void
+esch_rope_unref_i(esch_alloc* alloc, struct esch_rope_node* node)
+{
+    ESCH_CHECK_PARAM_INTERNAL(node != NULL);
+    ESCH_CHECK_PARAM_INTERNAL(node->refs > 0);
+    if (--node->refs > 0)
+    {
+        return;
+    }
+    if (node->height == 0)
+    {
+        /* With GC, leaf may have been recycled already, so it's never
+         * touched. Owned leaf exists only without GC. */
+        if (node->owned)
+        {
+            (void)esch_object_delete_i(ESCH_CAST_TO_OBJECT(node->leaf));
+        }
+    }
+    else
+    {
+        esch_rope_unref_i(alloc, node->left);
+        esch_rope_unref_i(alloc, node->right);
+    }
+    (void)esch_alloc_free(alloc, node);
+}
+
+static esch_error
+esch_rope_leaf_new_i(struct esch_rope_context* ctx, esch_string* str,
+                     esch_bool owned, struct esch_rope_node** node)
+{
+    esch_error ret = ESCH_OK;
+    struct esch_rope_node* new_node = NULL;
+    ESCH_CHECK_PARAM_INTERNAL(str != NULL);
+    ESCH_CHECK_PARAM_INTERNAL(str->utf8 != NULL);
+
+    ret = esch_alloc_realloc(ctx->alloc, NULL, sizeof(struct esch_rope_node),
+                             (void**)&new_node);
+    ESCH_CHECK(ret == ESCH_OK, ctx->log, "Can't malloc leaf node", ret);
+    new_node->refs = 1;
+    new_node->utf8_len = str->utf8_len;
+    new_node->unicode_len = str->unicode_len;
+    new_node->leaves = 1;
+    new_node->height = 0;
+    new_node->owned = owned;
+    new_node->left = NULL;
+    new_node->right = NULL;
+    new_node->leaf = str;
+    (*node) = new_node;
+Exit:
+    return ret;
+}
+
+static esch_error
+esch_rope_node_new_i(struct esch_rope_context* ctx,
+                     struct esch_rope_node* left,
+                     struct esch_rope_node* right,
+                     struct esch_rope_node** node)
+{
+    esch_error ret = ESCH_OK;
+    struct esch_rope_node* new_node = NULL;
+    ESCH_CHECK_PARAM_INTERNAL(left != NULL);
+    ESCH_CHECK_PARAM_INTERNAL(right != NULL);
+    /* AVL property: callers must have balanced both sides. */
+    ESCH_CHECK_PARAM_INTERNAL(left->height <= right->height + 1 &&
+                              right->height <= left->height + 1);
+
+    ret = esch_alloc_realloc(ctx->alloc, NULL, sizeof(struct esch_rope_node),
+                             (void**)&new_node);
+    ESCH_CHECK(ret == ESCH_OK, ctx->log, "Can't malloc tree node", ret);
+    new_node->refs = 1;
+    new_node->utf8_len = left->utf8_len + right->utf8_len;
+    new_node->unicode_len = left->unicode_len + right->unicode_len;
+    new_node->leaves = left->leaves + right->leaves;
+    new_node->height = (left->height > right->height?
+                        left->height: right->height) + 1;
+    new_node->owned = ESCH_FALSE;
+    new_node->left = left;
+    new_node->right = right;
+    new_node->leaf = NULL;
+    (*node) = new_node;
+    left = NULL;
+    right = NULL;
+Exit:
+    if (left != NULL)
+    {
+        esch_rope_unref_i(ctx->alloc, left);
+    }
+    if (right != NULL)
+    {
+        esch_rope_unref_i(ctx->alloc, right);
+    }
+    return ret;
+}
+
+/*
+ * Copy two short leaves into one new leaf.
+ */
+static esch_error
+esch_rope_merge_i(struct esch_rope_context* ctx,
+                  struct esch_rope_node* left,
+                  struct esch_rope_node* right,
+                  struct esch_rope_node** node)
+{
+    esch_error ret = ESCH_OK;
+    esch_string* new_str = NULL;
+    esch_utf8 buf[ESCH_ROPE_SHORT_LEAF + 1];
+    ESCH_CHECK_PARAM_INTERNAL(left->height == 0 && right->height == 0);
+    ESCH_CHECK_PARAM_INTERNAL(left->utf8_len + right->utf8_len <=
+                              ESCH_ROPE_SHORT_LEAF);
+
+    memcpy(buf, left->leaf->utf8, left->utf8_len);
+    memcpy(buf + left->utf8_len, right->leaf->utf8, right->utf8_len);
+    ret = esch_string_new_from_utf8(ctx->config, buf, 0,
+                                    (int)(left->utf8_len + right->utf8_len),
+                                    &new_str);
+    ESCH_CHECK(ret == ESCH_OK, ctx->log, "Can't merge leaves", ret);
+    ret = esch_rope_leaf_new_i(ctx, new_str, ctx->own_leaves, node);
+    ESCH_CHECK(ret == ESCH_OK, ctx->log, "Can't create leaf", ret);
+    new_str = NULL;
+Exit:
+    if (new_str != NULL && ctx->own_leaves)
+    {
+        (void)esch_object_delete_i(ESCH_CAST_TO_OBJECT(new_str));
+    }
+    esch_rope_unref_i(ctx->alloc, left);
+    esch_rope_unref_i(ctx->alloc, right);
+    return ret;
+}
+
+/*
+ * Create a node from two balanced trees, whose heights differ at most
+ * by 2. Rotate once or twice if needed, as AVL tree does.
+ */
+static esch_error
+esch_rope_balance_i(struct esch_rope_context* ctx,
+                    struct esch_rope_node* left,
+                    struct esch_rope_node* right,
+                    struct esch_rope_node** node)
+{
+    esch_error ret = ESCH_OK;
+    struct esch_rope_node* a = NULL;
+    struct esch_rope_node* b = NULL;
+    struct esch_rope_node* c = NULL;
+    struct esch_rope_node* d = NULL;
+    struct esch_rope_node* inner = NULL;
+    struct esch_rope_node* outer = NULL;
+
+    if (right->height > left->height + 1)
+    {
+        /* Right side is too high. Result is ((left b) c) or
+         * ((left c1) (c2 d)), where right is (b c) or ((c1 c2) d). */
+        a = left;
+        b = right->left;
+        d = right->right;
+        b->refs++;
+        d->refs++;
+        esch_rope_unref_i(ctx->alloc, right);
+        left = NULL;
+        right = NULL;
+        if (d->height >= b->height)
+        {
+            ret = esch_rope_node_new_i(ctx, a, b, &inner);
+            a = NULL;
+            b = NULL;
+            ESCH_CHECK(ret == ESCH_OK, ctx->log, "Can't rotate", ret);
+            ret = esch_rope_node_new_i(ctx, inner, d, node);
+            inner = NULL;
+            d = NULL;
+            ESCH_CHECK(ret == ESCH_OK, ctx->log, "Can't rotate", ret);
+        }
+        else
+        {
+            c = b->right;
+            c->refs++;
+            inner = b->left;
+            inner->refs++;
+            esch_rope_unref_i(ctx->alloc, b);
+            b = inner;
+            inner = NULL;
+            ret = esch_rope_node_new_i(ctx, a, b, &inner);
+            a = NULL;
+            b = NULL;
+            ESCH_CHECK(ret == ESCH_OK, ctx->log, "Can't rotate", ret);
+            ret = esch_rope_node_new_i(ctx, c, d, &outer);
+            c = NULL;
+            d = NULL;
+            ESCH_CHECK(ret == ESCH_OK, ctx->log, "Can't rotate", ret);
+            ret = esch_rope_node_new_i(ctx, inner, outer, node);
+            inner = NULL;
+            outer = NULL;
+            ESCH_CHECK(ret == ESCH_OK, ctx->log, "Can't rotate", ret);
+        }
+    }
+    else if (left->height > right->height + 1)
+    {
+        /* Mirror of above. Left is (a b) or (a (b1 b2)). */
+        a = left->left;
+        c = left->right;
+        d = right;
+        a->refs++;
+        c->refs++;
+        esch_rope_unref_i(ctx->alloc, left);
+        left = NULL;
+        right = NULL;
+        if (a->height >= c->height)
+        {
+            ret = esch_rope_node_new_i(ctx, c, d, &inner);
+            c = NULL;
+            d = NULL;
+            ESCH_CHECK(ret == ESCH_OK, ctx->log, "Can't rotate", ret);
+            ret = esch_rope_node_new_i(ctx, a, inner, node);
+            a = NULL;
+            inner = NULL;
+            ESCH_CHECK(ret == ESCH_OK, ctx->log, "Can't rotate", ret);
+        }
+        else
+        {
+            b = c->left;
+            b->refs++;
+            inner = c->right;
+            inner->refs++;
+            esch_rope_unref_i(ctx->alloc, c);
+            c = inner;
+            inner = NULL;
+            ret = esch_rope_node_new_i(ctx, a, b, &outer);
+            a = NULL;
+            b = NULL;
+            ESCH_CHECK(ret == ESCH_OK, ctx->log, "Can't rotate", ret);
+            ret = esch_rope_node_new_i(ctx, c, d, &inner);
+            c = NULL;
+            d = NULL;
+            ESCH_CHECK(ret == ESCH_OK, ctx->log, "Can't rotate", ret);
+            ret = esch_rope_node_new_i(ctx, outer, inner, node);
+            inner = NULL;
+            outer = NULL;
+            ESCH_CHECK(ret == ESCH_OK, ctx->log, "Can't rotate", ret);
+        }
+    }
+    else
+    {
+        ret = esch_rope_node_new_i(ctx, left, right, node);
+        left = NULL;
+        right = NULL;
+    }
+Exit:
+    if (a != NULL) esch_rope_unref_i(ctx->alloc, a);
+    if (b != NULL) esch_rope_unref_i(ctx->alloc, b);
+    if (c != NULL) esch_rope_unref_i(ctx->alloc, c);
+    if (d != NULL) esch_rope_unref_i(ctx->alloc, d);
+    if (inner != NULL) esch_rope_unref_i(ctx->alloc, inner);
+    if (outer != NULL) esch_rope_unref_i(ctx->alloc, outer);
+    return ret;
+}
+
+/*
+ * Concatenate two trees. The higher one is walked down along its inner
+ * edge until heights are close, so it takes O(difference of heights)
+ * steps, and only nodes on the path are created.
+ */
+static esch_error
+esch_rope_join_i(struct esch_rope_context* ctx,
+                 struct esch_rope_node* left,
+                 struct esch_rope_node* right,
+                 struct esch_rope_node** node)
+{
+    esch_error ret = ESCH_OK;
+    struct esch_rope_node* keep = NULL;
+    struct esch_rope_node* walk = NULL;
+    struct esch_rope_node* joined = NULL;
+
+    if (left->height == 0 && right->height == 0 &&
+            left->utf8_len + right->utf8_len <= ESCH_ROPE_SHORT_LEAF)
+    {
+        ret = esch_rope_merge_i(ctx, left, right, node);
+    }
+    else if (left->height > right->height + 1)
+    {
+        keep = left->left;
+        walk = left->right;
+        keep->refs++;
+        walk->refs++;
+        esch_rope_unref_i(ctx->alloc, left);
+        ret = esch_rope_join_i(ctx, walk, right, &joined);
+        if (ret != ESCH_OK)
+        {
+            esch_rope_unref_i(ctx->alloc, keep);
+            return ret;
+        }
+        ret = esch_rope_balance_i(ctx, keep, joined, node);
+    }
+    else if (right->height > left->height + 1)
+    {
+        walk = right->left;
+        keep = right->right;
+        keep->refs++;
+        walk->refs++;
+        esch_rope_unref_i(ctx->alloc, right);
+        ret = esch_rope_join_i(ctx, left, walk, &joined);
+        if (ret != ESCH_OK)
+        {
+            esch_rope_unref_i(ctx->alloc, keep);
+            return ret;
+        }
+        ret = esch_rope_balance_i(ctx, joined, keep, node);
+    }
+    else
+    {
+        ret = esch_rope_node_new_i(ctx, left, right, node);
+    }
+    return ret;
+}
+
+/*
+ * Get a tree with characters in [begin, end) of given tree. Whole
+ * subtrees are shared. Only leaves at both ends are copied.
+ */
+static esch_error
+esch_rope_sub_i(struct esch_rope_context* ctx, struct esch_rope_node* node,
+                size_t begin, size_t end, struct esch_rope_node** output)
+{
+    esch_error ret = ESCH_OK;
+    esch_string* new_str = NULL;
+    struct esch_rope_node* left = NULL;
+    struct esch_rope_node* right = NULL;
+    size_t left_len = 0;
+    ESCH_CHECK_PARAM_INTERNAL(begin < end && end <= node->unicode_len);
+
+    if (begin == 0 && end == node->unicode_len)
+    {
+        node->refs++;
+        (*output) = node;
+    }
+    else if (node->height == 0)
+    {
+        ret = esch_string_new_from_utf8(ctx->config, node->leaf->utf8,
+                    (int)esch_string_utf8_offset_i(node->leaf, begin),
+                    (int)esch_string_utf8_offset_i(node->leaf, end),
+                    &new_str);
+        ESCH_CHECK(ret == ESCH_OK, ctx->log, "Can't split leaf", ret);
+        ret = esch_rope_leaf_new_i(ctx, new_str, ctx->own_leaves, output);
+        ESCH_CHECK(ret == ESCH_OK, ctx->log, "Can't create leaf", ret);
+        new_str = NULL;
+    }
+    else
+    {
+        left_len = node->left->unicode_len;
+        if (end <= left_len)
+        {
+            ret = esch_rope_sub_i(ctx, node->left, begin, end, output);
+        }
+        else if (begin >= left_len)
+        {
+            ret = esch_rope_sub_i(ctx, node->right,
+                                  begin - left_len, end - left_len, output);
+        }
+        else
+        {
+            ret = esch_rope_sub_i(ctx, node->left, begin, left_len, &left);
+            ESCH_CHECK(ret == ESCH_OK, ctx->log, "Can't split left", ret);
+            ret = esch_rope_sub_i(ctx, node->right,
+                                  0, end - left_len, &right);
+            ESCH_CHECK(ret == ESCH_OK, ctx->log, "Can't split right", ret);
+            ret = esch_rope_join_i(ctx, left, right, output);
+            left = NULL;
+            right = NULL;
+        }
+    }
+Exit:
+    if (new_str != NULL && ctx->own_leaves)
+    {
+        (void)esch_object_delete_i(ESCH_CAST_TO_OBJECT(new_str));
+    }
+    if (left != NULL)
+    {
+        esch_rope_unref_i(ctx->alloc, left);
+    }
+    return ret;
+}
+
+/*
+ * Get tree of a string. Rope string shares its tree. Flat string
+ * becomes a leaf, which is not owned by rope.
+ */
+static esch_error
+esch_rope_of_string_i(struct esch_rope_context* ctx, esch_string* str,
+                      struct esch_rope_node** node)
+{
+    if (str->rope != NULL)
+    {
+        str->rope->refs++;
+        (*node) = str->rope;
+        return ESCH_OK;
+    }
+    return esch_rope_leaf_new_i(ctx, str, ESCH_FALSE, node);
+}
+
+static esch_error
+esch_rope_string_new_i(struct esch_rope_context* ctx,
+                       struct esch_rope_node* tree, esch_string** str)
+{
+    esch_error ret = ESCH_OK;
+    esch_object* new_obj = NULL;
+    esch_string* new_str = NULL;
+
+    ret = esch_object_new_i(ctx->config, &(esch_string_rope_type.type),
+                            &new_obj);
+    ESCH_CHECK(ret == ESCH_OK, ctx->log, "Can't create string object", ret);
+    new_str = ESCH_CAST_FROM_OBJECT(new_obj, esch_string);
+    new_str->utf8 = NULL;
+    new_str->utf8_len = tree->utf8_len;
+    new_str->unicode = NULL;
+    new_str->unicode_len = tree->unicode_len;
+    new_str->rope = tree;
+    new_str->offsets = NULL;
+    tree = NULL;
+    ESCH_CHECK_PARAM_INTERNAL(ESCH_IS_VALID_STRING(new_str));
+    (*str) = new_str;
+Exit:
+    if (tree != NULL)
+    {
+        esch_rope_unref_i(ctx->alloc, tree);
+    }
+    return ret;
+}
+
+/*
+ * Find leaf containing given character. Index is updated to index
+ * within leaf.
+ */
+static esch_string*
+esch_rope_find_leaf_i(struct esch_rope_node* node, size_t* index)
+{
+    while (node->height > 0)
+    {
+        if ((*index) < node->left->unicode_len)
+        {
+            node = node->left;
+        }
+        else
+        {
+            (*index) -= node->left->unicode_len;
+            node = node->right;
+        }
+    }
+    return node->leaf;
+}
+
+static esch_string*
+esch_rope_leaf_at_i(struct esch_rope_node* node, size_t index)
+{
+    while (node->height > 0)
+    {
+        if (index < node->left->leaves)
+        {
+            node = node->left;
+        }
+        else
+        {
+            index -= node->left->leaves;
+            node = node->right;
+        }
+    }
+    return node->leaf;
+}
+
+static size_t
+esch_rope_copy_utf8_i(struct esch_rope_node* node, esch_utf8* buf)
+{
+    size_t len = 0;
+    /* Loop on right side, so recursion depth is within tree height. */
+    while (node->height > 0)
+    {
+        len += esch_rope_copy_utf8_i(node->left, buf + len);
+        node = node->right;
+    }
+    memcpy(buf + len, node->leaf->utf8, node->utf8_len);
+    return len + node->utf8_len;
+}
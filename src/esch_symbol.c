@@ -0,0 +1,539 @@
+/* vim:ft=c expandtab tw=72 sw=4
+ */
+/* See Copyright notice in esch.h */
+#include "esch_symbol.h"
+#include "esch_string.h"
+#include "esch_config.h"
+#include "esch_alloc.h"
+#include "esch_log.h"
+#include "esch_type.h"
+#include "esch_debug.h"
+#include <string.h>
+
+const size_t ESCH_SYMBOL_TABLE_INITIAL_SLOTS = 64;
+
+/* Marks a slot whose symbol has been removed. Probing goes on. */
+static esch_symbol esch_symbol_tombstone;
+#define TOMBSTONE (&esch_symbol_tombstone)
+
+static esch_error
+esch_symbol_new_default_as_object_i(esch_config* config, esch_object** obj);
+static esch_error
+esch_symbol_destructor_i(esch_object* obj);
+static esch_error
+esch_symbol_table_new_as_object_i(esch_config* config, esch_object** obj);
+static esch_error
+esch_symbol_table_destructor_i(esch_object* obj);
+static esch_error
+esch_symbol_table_new_i(esch_config* config, esch_symbol_table** table);
+static uint32_t
+esch_symbol_hash_i(const char* utf8, size_t len);
+static size_t
+esch_symbol_table_find_i(esch_symbol_table* table, const char* utf8,
+                         size_t len, uint32_t hash);
+static esch_error
+esch_symbol_table_reserve_i(esch_symbol_table* table);
+
+struct esch_builtin_type esch_symbol_type =
+{
+    {
+        &(esch_meta_type.type),
+        NULL, /* No alloc */
+        &(esch_log_do_nothing.log),
+        NULL, /* Non-GC object */
+        NULL,
+    },
+    {
+        ESCH_VERSION,
+        sizeof(esch_symbol),
+        esch_symbol_new_default_as_object_i,
+        esch_symbol_destructor_i,
+        esch_type_default_non_copiable, /* Symbols are unique */
+        esch_type_default_no_string_form,
+        esch_type_default_no_doc,
+        esch_type_default_no_iterator
+    },
+};
+
+struct esch_builtin_type esch_symbol_table_type =
+{
+    {
+        &(esch_meta_type.type),
+        NULL, /* No alloc */
+        &(esch_log_do_nothing.log),
+        NULL, /* Non-GC object */
+        NULL,
+    },
+    {
+        ESCH_VERSION,
+        sizeof(esch_symbol_table),
+        esch_symbol_table_new_as_object_i,
+        esch_symbol_table_destructor_i,
+        esch_type_default_non_copiable,
+        esch_type_default_no_string_form,
+        esch_type_default_no_doc,
+        /* Weak reference: GC does not see symbols through table. */
+        esch_type_default_no_iterator
+    },
+};
+
+/*
+ * ---------------------------------------------------------------
+ * Public interfaces
+ * ---------------------------------------------------------------
+ */
+esch_error
+esch_symbol_table_new(esch_config* config, esch_symbol_table** table)
+{
+    esch_error ret = ESCH_OK;
+    esch_object* alloc_obj = NULL;
+    esch_object* log_obj = NULL;
+
+    ESCH_CHECK_PARAM_PUBLIC(config != NULL);
+    ESCH_CHECK_PARAM_PUBLIC(table != NULL);
+    ESCH_CHECK_PARAM_PUBLIC(ESCH_IS_VALID_CONFIG(config));
+
+    alloc_obj = ESCH_CONFIG_GET_ALLOC(config);
+    log_obj = ESCH_CONFIG_GET_LOG(config);
+    ESCH_CHECK_PARAM_PUBLIC(alloc_obj != NULL);
+    ESCH_CHECK_PARAM_PUBLIC(log_obj != NULL);
+
+    ret = esch_symbol_table_new_i(config, table);
+Exit:
+    return ret;
+}
+
+esch_error
+esch_symbol_table_intern(esch_symbol_table* table, const char* utf8,
+                         int begin, int end, esch_symbol** symbol)
+{
+    esch_error ret = ESCH_OK;
+    esch_log* log = NULL;
+    esch_alloc* alloc = NULL;
+    esch_object* new_obj = NULL;
+    esch_symbol* new_sym = NULL;
+    esch_utf8* new_utf8 = NULL;
+    const char* name = NULL;
+    size_t len = 0;
+    size_t index = 0;
+    size_t unicode_len = 0;
+    size_t bad_index = 0;
+    uint32_t hash = 0;
+    int status = 0;
+
+    ESCH_CHECK_PARAM_PUBLIC(table != NULL);
+    ESCH_CHECK_PARAM_PUBLIC(ESCH_IS_VALID_SYMBOL_TABLE(table));
+    ESCH_CHECK_PARAM_PUBLIC(utf8 != NULL);
+    ESCH_CHECK_PARAM_PUBLIC(symbol != NULL);
+    log = ESCH_OBJECT_GET_LOG(ESCH_CAST_TO_OBJECT(table));
+    alloc = ESCH_OBJECT_GET_ALLOC(ESCH_CAST_TO_OBJECT(table));
+
+    if (begin == 0 && end < 0)
+    {
+        len = strlen(utf8);
+    }
+    else
+    {
+        ESCH_CHECK(begin >= 0 && end >= begin, log,
+                   "symbol:intern: Invalid length",
+                   ESCH_ERROR_INVALID_PARAMETER);
+        len = (size_t)(end - begin);
+    }
+    ESCH_CHECK(len <= 0xFFFFFFFFU, log, "symbol:intern: Name too long",
+               ESCH_ERROR_INVALID_PARAMETER);
+    name = utf8 + begin;
+    hash = esch_symbol_hash_i(name, len);
+
+    /* Most of times the name is already there. */
+    index = esch_symbol_table_find_i(table, name, len, hash);
+    if (index < table->slots)
+    {
+        (*symbol) = table->entries[index].symbol;
+        goto Exit;
+    }
+
+    status = esch_string_validate_utf8_i(name, len,
+                                         &unicode_len, &bad_index);
+    ESCH_CHECK_1(status == 0, log,
+                 "symbol:intern: Bad Unicode at index %d",
+                 (int)bad_index, ESCH_ERROR_INVALID_PARAMETER);
+
+    /* Make room before creating symbol. Creating an object may trigger
+     * GC, which only removes symbols, so the room is still there. */
+    ret = esch_symbol_table_reserve_i(table);
+    ESCH_CHECK(ret == ESCH_OK, log, "symbol:intern: Can't grow", ret);
+
+    ret = esch_alloc_realloc(alloc, NULL, len + 1, (void**)&new_utf8);
+    ESCH_CHECK(ret == ESCH_OK, log, "symbol:intern: Can't copy name", ret);
+    memcpy(new_utf8, name, len);
+    new_utf8[len] = '\0';
+
+    ret = esch_object_new_i(table->config,
+                            &(esch_symbol_type.type), &new_obj);
+    ESCH_CHECK(ret == ESCH_OK, log, "symbol:intern: Can't create", ret);
+    new_sym = ESCH_CAST_FROM_OBJECT(new_obj, esch_symbol);
+    new_sym->table = table;
+    new_sym->hash = hash;
+    new_sym->utf8_len = len;
+    new_sym->utf8 = new_utf8;
+    new_utf8 = NULL;
+
+    /* Reuse first tombstone or empty slot along the probe sequence. */
+    index = hash & (table->slots - 1);
+    while (table->entries[index].symbol != NULL &&
+           table->entries[index].symbol != TOMBSTONE)
+    {
+        index = (index + 1) & (table->slots - 1);
+    }
+    if (table->entries[index].symbol == TOMBSTONE)
+    {
+        table->tombstones -= 1;
+    }
+    table->entries[index].hash = hash;
+    table->entries[index].symbol = new_sym;
+    table->entries[index].utf8_len = (uint32_t)len;
+    table->entries[index].utf8 = new_sym->utf8;
+    table->count += 1;
+    (*symbol) = new_sym;
+Exit:
+    esch_alloc_free(alloc, new_utf8);
+    return ret;
+}
+
+esch_error
+esch_symbol_table_lookup(esch_symbol_table* table, const char* utf8,
+                         int begin, int end, esch_symbol** symbol)
+{
+    esch_error ret = ESCH_OK;
+    size_t len = 0;
+    size_t index = 0;
+
+    ESCH_CHECK_PARAM_PUBLIC(table != NULL);
+    ESCH_CHECK_PARAM_PUBLIC(ESCH_IS_VALID_SYMBOL_TABLE(table));
+    ESCH_CHECK_PARAM_PUBLIC(utf8 != NULL);
+    ESCH_CHECK_PARAM_PUBLIC(symbol != NULL);
+
+    if (begin == 0 && end < 0)
+    {
+        len = strlen(utf8);
+    }
+    else
+    {
+        ESCH_CHECK_PARAM_PUBLIC(begin >= 0 && end >= begin);
+        len = (size_t)(end - begin);
+    }
+    index = esch_symbol_table_find_i(table, utf8 + begin, len,
+                                     esch_symbol_hash_i(utf8 + begin,
+                                                        len));
+    if (index < table->slots)
+    {
+        (*symbol) = table->entries[index].symbol;
+    }
+    else
+    {
+        ret = ESCH_ERROR_NOT_FOUND;
+    }
+Exit:
+    return ret;
+}
+
+esch_error
+esch_symbol_table_get_count(esch_symbol_table* table, size_t* count)
+{
+    esch_error ret = ESCH_OK;
+    ESCH_CHECK_PARAM_PUBLIC(table != NULL);
+    ESCH_CHECK_PARAM_PUBLIC(ESCH_IS_VALID_SYMBOL_TABLE(table));
+    ESCH_CHECK_PARAM_PUBLIC(count != NULL);
+    (*count) = table->count;
+Exit:
+    return ret;
+}
+
+char*
+esch_symbol_get_utf8_ref(esch_symbol* symbol)
+{
+    /* NOTE: For performance consideration, we don't check input. */
+    ESCH_CHECK_PARAM_INTERNAL(symbol != NULL);
+    ESCH_CHECK_PARAM_INTERNAL(ESCH_IS_VALID_SYMBOL(symbol));
+    return (symbol == NULL? NULL: symbol->utf8);
+}
+
+size_t
+esch_symbol_get_utf8_length(esch_symbol* symbol)
+{
+    /* NOTE: For performance consideration, we don't check input. */
+    ESCH_CHECK_PARAM_INTERNAL(symbol != NULL);
+    ESCH_CHECK_PARAM_INTERNAL(ESCH_IS_VALID_SYMBOL(symbol));
+    return (symbol == NULL? 0: symbol->utf8_len);
+}
+
+/*
+ * -----------------------------------------------------------------
+ * Internal functions.
+ * -----------------------------------------------------------------
+ */
+
+/*
+ * FNV-1a. Identifiers are short, so a simple byte loop beats hash
+ * functions designed for long keys.
+ */
+static uint32_t
+esch_symbol_hash_i(const char* utf8, size_t len)
+{
+    uint32_t hash = 2166136261U;
+    size_t i = 0;
+    for (i = 0; i < len; ++i)
+    {
+        hash ^= (unsigned char)utf8[i];
+        hash *= 16777619U;
+    }
+    return hash;
+}
+
+/*
+ * Return index of slot holding given name, or table->slots if not
+ * found.
+ */
+static size_t
+esch_symbol_table_find_i(esch_symbol_table* table, const char* utf8,
+                         size_t len, uint32_t hash)
+{
+    size_t mask = table->slots - 1;
+    size_t index = hash & mask;
+    struct esch_symbol_entry* entry = NULL;
+
+    for (;;)
+    {
+        entry = &(table->entries[index]);
+        if (entry->symbol == NULL)
+        {
+            return table->slots;
+        }
+        if (entry->hash == hash && entry->symbol != TOMBSTONE &&
+            entry->utf8_len == len && memcmp(entry->utf8, utf8, len) == 0)
+        {
+            return index;
+        }
+        index = (index + 1) & mask;
+    }
+}
+
+/*
+ * Make sure one more symbol can be added while keeping load factor
+ * (live symbols and tombstones) under 3/4. Rehashing drops tombstones.
+ */
+static esch_error
+esch_symbol_table_reserve_i(esch_symbol_table* table)
+{
+    esch_error ret = ESCH_OK;
+    esch_alloc* alloc = NULL;
+    esch_log* log = NULL;
+    struct esch_symbol_entry* new_entries = NULL;
+    struct esch_symbol_entry* old_entries = NULL;
+    esch_symbol* sym = NULL;
+    size_t new_slots = 0;
+    size_t index = 0;
+    size_t i = 0;
+
+    if ((table->count + table->tombstones + 1) * 4 <= table->slots * 3)
+    {
+        return ESCH_OK;
+    }
+    alloc = ESCH_OBJECT_GET_ALLOC(ESCH_CAST_TO_OBJECT(table));
+    log = ESCH_OBJECT_GET_LOG(ESCH_CAST_TO_OBJECT(table));
+
+    /* Keep it half full after rehashing. */
+    new_slots = table->slots;
+    while ((table->count + 1) * 2 > new_slots)
+    {
+        new_slots *= 2;
+    }
+    ret = esch_alloc_realloc(alloc, NULL,
+                             sizeof(struct esch_symbol_entry) * new_slots,
+                             (void**)&new_entries);
+    ESCH_CHECK(ret == ESCH_OK, log, "symbol:Can't allocate slots", ret);
+    memset(new_entries, 0, sizeof(struct esch_symbol_entry) * new_slots);
+
+    for (i = 0; i < table->slots; ++i)
+    {
+        sym = table->entries[i].symbol;
+        if (sym == NULL || sym == TOMBSTONE)
+        {
+            continue;
+        }
+        index = table->entries[i].hash & (new_slots - 1);
+        while (new_entries[index].symbol != NULL)
+        {
+            index = (index + 1) & (new_slots - 1);
+        }
+        new_entries[index] = table->entries[i];
+    }
+    old_entries = table->entries;
+    table->entries = new_entries;
+    table->slots = new_slots;
+    table->tombstones = 0;
+    new_entries = NULL;
+    ret = esch_alloc_free(alloc, old_entries);
+Exit:
+    esch_alloc_free(alloc, new_entries);
+    return ret;
+}
+
+static esch_error
+esch_symbol_table_new_i(esch_config* config, esch_symbol_table** table)
+{
+    esch_error ret = ESCH_OK;
+    esch_object* alloc_obj = NULL;
+    esch_object* log_obj = NULL;
+    esch_object* gc_obj = NULL;
+    esch_alloc* alloc = NULL;
+    esch_log* log = NULL;
+    esch_config* new_config = NULL;
+    struct esch_symbol_entry* entries = NULL;
+    esch_object* new_obj = NULL;
+    esch_symbol_table* new_table = NULL;
+    size_t size = 0;
+
+    alloc_obj = ESCH_CONFIG_GET_ALLOC(config);
+    log_obj = ESCH_CONFIG_GET_LOG(config);
+    gc_obj = ESCH_CONFIG_GET_GC(config);
+    alloc = ESCH_CAST_FROM_OBJECT(alloc_obj, esch_alloc);
+    log = ESCH_CAST_FROM_OBJECT(log_obj, esch_log);
+
+    /* Symbols are created with same alloc, log and GC of table. Keep
+     * them in a private config, so callers pass only table. */
+    ret = esch_config_new(log, alloc, &new_config);
+    ESCH_CHECK(ret == ESCH_OK, log, "symbol:Can't create config", ret);
+    ret = esch_config_set_obj_by_id(new_config, ESCH_CONFIG_KEY_ID_ALLOC,
+                                    alloc_obj);
+    ESCH_CHECK(ret == ESCH_OK, log, "symbol:Can't set alloc", ret);
+    ret = esch_config_set_obj_by_id(new_config, ESCH_CONFIG_KEY_ID_LOG,
+                                    log_obj);
+    ESCH_CHECK(ret == ESCH_OK, log, "symbol:Can't set log", ret);
+    if (gc_obj != NULL)
+    {
+        ret = esch_config_set_obj_by_id(new_config, ESCH_CONFIG_KEY_ID_GC,
+                                        gc_obj);
+        ESCH_CHECK(ret == ESCH_OK, log, "symbol:Can't set GC", ret);
+    }
+
+    size = sizeof(struct esch_symbol_entry) *
+           ESCH_SYMBOL_TABLE_INITIAL_SLOTS;
+    ret = esch_alloc_realloc(alloc, NULL, size, (void**)&entries);
+    ESCH_CHECK(ret == ESCH_OK, log, "symbol:Can't allocate slots", ret);
+    memset(entries, 0, size);
+
+    ret = esch_object_new_i(config, &(esch_symbol_table_type.type),
+                            &new_obj);
+    ESCH_CHECK(ret == ESCH_OK, log, "symbol:Can't create table", ret);
+    new_table = ESCH_CAST_FROM_OBJECT(new_obj, esch_symbol_table);
+    new_table->config = new_config;
+    new_table->entries = entries;
+    new_table->slots = ESCH_SYMBOL_TABLE_INITIAL_SLOTS;
+    new_table->count = 0;
+    new_table->tombstones = 0;
+
+    (*table) = new_table;
+    new_config = NULL;
+    entries = NULL;
+Exit:
+    esch_alloc_free(alloc, entries);
+    if (new_config != NULL)
+    {
+        (void)esch_object_delete(ESCH_CAST_TO_OBJECT(new_config));
+    }
+    return ret;
+}
+
+static esch_error
+esch_symbol_table_new_as_object_i(esch_config* config, esch_object** obj)
+{
+    esch_error ret = ESCH_OK;
+    esch_symbol_table* table = NULL;
+    ret = esch_symbol_table_new_i(config, &table);
+    if (ret == ESCH_OK)
+    {
+        (*obj) = ESCH_CAST_TO_OBJECT(table);
+    }
+    return ret;
+}
+
+static esch_error
+esch_symbol_table_destructor_i(esch_object* obj)
+{
+    esch_error ret = ESCH_OK;
+    esch_symbol_table* table = NULL;
+    esch_alloc* alloc = NULL;
+    esch_symbol* sym = NULL;
+    size_t i = 0;
+
+    ESCH_CHECK_PARAM_INTERNAL(obj != NULL);
+    table = ESCH_CAST_FROM_OBJECT(obj, esch_symbol_table);
+    ESCH_CHECK_PARAM_INTERNAL(ESCH_IS_VALID_SYMBOL_TABLE(table));
+    alloc = ESCH_OBJECT_GET_ALLOC(obj);
+
+    /* Symbols managed by GC may live longer than table, so only detach
+     * them. Without GC, table owns the symbols. */
+    for (i = 0; i < table->slots; ++i)
+    {
+        sym = table->entries[i].symbol;
+        if (sym == NULL || sym == TOMBSTONE)
+        {
+            continue;
+        }
+        table->entries[i].symbol = TOMBSTONE;
+        sym->table = NULL;
+        if (ESCH_OBJECT_GET_GC(ESCH_CAST_TO_OBJECT(sym)) == NULL)
+        {
+            (void)esch_object_delete_i(ESCH_CAST_TO_OBJECT(sym));
+        }
+    }
+    (void)esch_alloc_free(alloc, table->entries);
+    (void)esch_object_delete(ESCH_CAST_TO_OBJECT(table->config));
+    table->entries = NULL;
+    table->config = NULL;
+    table->slots = 0;
+    table->count = 0;
+    table->tombstones = 0;
+    return ret;
+}
+
+static esch_error
+esch_symbol_new_default_as_object_i(esch_config* config, esch_object** obj)
+{
+    /* A symbol must be created by a symbol table. */
+    (void)config;
+    (void)obj;
+    return ESCH_ERROR_NOT_SUPPORTED;
+}
+
+static esch_error
+esch_symbol_destructor_i(esch_object* obj)
+{
+    esch_error ret = ESCH_OK;
+    esch_symbol* sym = NULL;
+    esch_symbol_table* table = NULL;
+    size_t index = 0;
+
+    ESCH_CHECK_PARAM_INTERNAL(obj != NULL);
+    sym = ESCH_CAST_FROM_OBJECT(obj, esch_symbol);
+    ESCH_CHECK_PARAM_INTERNAL(ESCH_IS_VALID_SYMBOL(sym));
+
+    table = sym->table;
+    if (table != NULL)
+    {
+        index = sym->hash & (table->slots - 1);
+        while (table->entries[index].symbol != sym)
+        {
+            ESCH_ASSERT(table->entries[index].symbol != NULL);
+            index = (index + 1) & (table->slots - 1);
+        }
+        table->entries[index].symbol = TOMBSTONE;
+        table->count -= 1;
+        table->tombstones += 1;
+    }
+    ret = esch_alloc_free(ESCH_OBJECT_GET_ALLOC(obj), sym->utf8);
+    sym->utf8 = NULL;
+    sym->table = NULL;
+    return ret;
+}
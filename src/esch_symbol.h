@@ -0,0 +1,74 @@
+/* vim:ft=c expandtab tw=72 sw=4
+ */
+/* See Copyright notice in esch.h */
+#ifndef _ESCH_SYMBOL_H_
+#define _ESCH_SYMBOL_H_
+
+#include "esch.h"
+#include "esch_object.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif /* __cplusplus */
+
+/*
+ * Symbols are interned: a symbol table keeps at most one symbol for
+ * each name, so two symbols are equal only if they are the same object.
+ *
+ * The table is an open-addressing hash table with linear probing. Each
+ * slot keeps hash of the name next to the symbol pointer, so probing
+ * compares names only when hash matches.
+ *
+ * The table holds symbols weakly. It's not a container for GC, so a
+ * symbol that is not reachable from GC root is recycled, and its
+ * destructor removes itself from table (leaving a tombstone slot).
+ */
+struct esch_symbol
+{
+    esch_symbol_table* table; /* NULL when table is gone */
+    uint32_t hash;
+    size_t utf8_len;
+    esch_utf8* utf8;
+};
+
+struct esch_symbol_entry
+{
+    uint32_t hash;
+    uint32_t utf8_len;
+    esch_symbol* symbol; /* NULL: empty. Tombstone: removed. */
+    const esch_utf8* utf8; /* Name of symbol, saves one pointer hop */
+};
+
+struct esch_symbol_table
+{
+    esch_config* config; /* Private config to create symbols */
+    struct esch_symbol_entry* entries;
+    size_t slots; /* Always power of 2 */
+    size_t count; /* Live symbols */
+    size_t tombstones;
+};
+
+extern struct esch_builtin_type esch_symbol_type;
+extern struct esch_builtin_type esch_symbol_table_type;
+extern const size_t ESCH_SYMBOL_TABLE_INITIAL_SLOTS;
+
+#define ESCH_IS_VALID_SYMBOL(sym) \
+    ((sym) != NULL && \
+     ESCH_IS_VALID_OBJECT(ESCH_CAST_TO_OBJECT(sym)) && \
+     (ESCH_OBJECT_GET_TYPE(ESCH_CAST_TO_OBJECT(sym)) == \
+      &(esch_symbol_type.type)) && \
+     (sym)->utf8 != NULL)
+
+#define ESCH_IS_VALID_SYMBOL_TABLE(tbl) \
+    ((tbl) != NULL && \
+     ESCH_IS_VALID_OBJECT(ESCH_CAST_TO_OBJECT(tbl)) && \
+     (ESCH_OBJECT_GET_TYPE(ESCH_CAST_TO_OBJECT(tbl)) == \
+      &(esch_symbol_table_type.type)) && \
+     (tbl)->entries != NULL && \
+     (tbl)->config != NULL)
+
+#ifdef __cplusplus
+}
+#endif /* __cplusplus */
+
+#endif /* _ESCH_SYMBOL_H_ */
@@ -0,0 +1,343 @@
+/* vim:ft=c expandtab tw=72 sw=4
+ */
+/* See Copyright notice in esch.h */
+#ifndef _WIN32
+/* For nanosleep() and clock_gettime() in strict C89 mode. */
+#    define _XOPEN_SOURCE 500
+#endif
+#include "esch_thread.h"
+#include "esch_debug.h"
+#ifndef _WIN32
+#    include <time.h>
+#endif
+
+#ifdef _WIN32
+
+static DWORD WINAPI
+esch_thread_entry_i(LPVOID param)
+{
+    esch_thread* thread = (esch_thread*)param;
+    thread->routine(thread->arg);
+    return 0;
+}
+
+esch_error
+esch_thread_start_i(esch_thread* thread,
+                    esch_thread_routine_f routine, void* arg)
+{
+    ESCH_CHECK_PARAM_INTERNAL(thread != NULL);
+    ESCH_CHECK_PARAM_INTERNAL(routine != NULL);
+    thread->routine = routine;
+    thread->arg = arg;
+    thread->handle = CreateThread(NULL, 0, esch_thread_entry_i,
+                                  thread, 0, NULL);
+    return (thread->handle != NULL? ESCH_OK: ESCH_ERROR_NOT_SUPPORTED);
+}
+
+esch_error
+esch_thread_join_i(esch_thread* thread)
+{
+    ESCH_CHECK_PARAM_INTERNAL(thread != NULL);
+    if (WaitForSingleObject(thread->handle, INFINITE) != WAIT_OBJECT_0)
+    {
+        return ESCH_ERROR_INVALID_STATE;
+    }
+    (void)CloseHandle(thread->handle);
+    thread->handle = NULL;
+    return ESCH_OK;
+}
+
+esch_error
+esch_mutex_init_i(esch_mutex* mutex)
+{
+    ESCH_CHECK_PARAM_INTERNAL(mutex != NULL);
+    InitializeCriticalSection(&(mutex->handle));
+    return ESCH_OK;
+}
+
+void
+esch_mutex_destroy_i(esch_mutex* mutex)
+{
+    DeleteCriticalSection(&(mutex->handle));
+}
+
+void
+esch_mutex_lock_i(esch_mutex* mutex)
+{
+    EnterCriticalSection(&(mutex->handle));
+}
+
+void
+esch_mutex_unlock_i(esch_mutex* mutex)
+{
+    LeaveCriticalSection(&(mutex->handle));
+}
+
+esch_error
+esch_cond_init_i(esch_cond* cond)
+{
+    ESCH_CHECK_PARAM_INTERNAL(cond != NULL);
+    InitializeConditionVariable(&(cond->handle));
+    return ESCH_OK;
+}
+
+void
+esch_cond_destroy_i(esch_cond* cond)
+{
+    /* Windows condition variables need no cleanup. */
+    (void)cond;
+}
+
+void
+esch_cond_wait_i(esch_cond* cond, esch_mutex* mutex)
+{
+    (void)SleepConditionVariableCS(&(cond->handle), &(mutex->handle),
+                                   INFINITE);
+}
+
+void
+esch_cond_broadcast_i(esch_cond* cond)
+{
+    WakeAllConditionVariable(&(cond->handle));
+}
+
+void
+esch_thread_sleep_i(int ms)
+{
+    Sleep((DWORD)ms);
+}
+
+uint64_t
+esch_thread_now_ns_i(void)
+{
+    static LARGE_INTEGER frequency;
+    LARGE_INTEGER counter;
+    if (frequency.QuadPart == 0)
+    {
+        (void)QueryPerformanceFrequency(&frequency);
+    }
+    (void)QueryPerformanceCounter(&counter);
+    /* Split to avoid overflow of counter * 10^9. */
+    return (uint64_t)(counter.QuadPart / frequency.QuadPart) * 1000000000 +
+           (uint64_t)(counter.QuadPart % frequency.QuadPart) * 1000000000 /
+           (uint64_t)frequency.QuadPart;
+}
+
+#ifdef _WIN64
+#    define ESCH_INTERLOCKED_CAS(ptr, d, e) \
+        ((size_t)InterlockedCompareExchange64((volatile LONGLONG*)(ptr), \
+                                              (LONGLONG)(d), (LONGLONG)(e)))
+#    define ESCH_INTERLOCKED_ADD(ptr, v) \
+        ((size_t)InterlockedExchangeAdd64((volatile LONGLONG*)(ptr), \
+                                          (LONGLONG)(v)))
+#else
+#    define ESCH_INTERLOCKED_CAS(ptr, d, e) \
+        ((size_t)InterlockedCompareExchange((volatile LONG*)(ptr), \
+                                            (LONG)(d), (LONG)(e)))
+#    define ESCH_INTERLOCKED_ADD(ptr, v) \
+        ((size_t)InterlockedExchangeAdd((volatile LONG*)(ptr), (LONG)(v)))
+#endif /* _WIN64 */
+
+size_t
+esch_atomic_load_i(volatile size_t* ptr)
+{
+    return ESCH_INTERLOCKED_ADD(ptr, 0);
+}
+
+void
+esch_atomic_store_i(volatile size_t* ptr, size_t value)
+{
+    MemoryBarrier();
+    (*ptr) = value;
+    MemoryBarrier();
+}
+
+esch_bool
+esch_atomic_cas_i(volatile size_t* ptr, size_t expected, size_t desired)
+{
+    return (ESCH_INTERLOCKED_CAS(ptr, desired, expected) == expected?
+            ESCH_TRUE: ESCH_FALSE);
+}
+
+size_t
+esch_atomic_add_i(volatile size_t* ptr, size_t delta)
+{
+    return ESCH_INTERLOCKED_ADD(ptr, delta);
+}
+
+#else
+
+static void*
+esch_thread_entry_i(void* param)
+{
+    esch_thread* thread = (esch_thread*)param;
+    thread->routine(thread->arg);
+    return NULL;
+}
+
+esch_error
+esch_thread_start_i(esch_thread* thread,
+                    esch_thread_routine_f routine, void* arg)
+{
+    ESCH_CHECK_PARAM_INTERNAL(thread != NULL);
+    ESCH_CHECK_PARAM_INTERNAL(routine != NULL);
+    thread->routine = routine;
+    thread->arg = arg;
+    if (pthread_create(&(thread->handle), NULL,
+                       esch_thread_entry_i, thread) != 0)
+    {
+        return ESCH_ERROR_NOT_SUPPORTED;
+    }
+    return ESCH_OK;
+}
+
+esch_error
+esch_thread_join_i(esch_thread* thread)
+{
+    ESCH_CHECK_PARAM_INTERNAL(thread != NULL);
+    if (pthread_join(thread->handle, NULL) != 0)
+    {
+        return ESCH_ERROR_INVALID_STATE;
+    }
+    return ESCH_OK;
+}
+
+esch_error
+esch_mutex_init_i(esch_mutex* mutex)
+{
+    ESCH_CHECK_PARAM_INTERNAL(mutex != NULL);
+    return (pthread_mutex_init(&(mutex->handle), NULL) == 0?
+            ESCH_OK: ESCH_ERROR_NOT_SUPPORTED);
+}
+
+void
+esch_mutex_destroy_i(esch_mutex* mutex)
+{
+    (void)pthread_mutex_destroy(&(mutex->handle));
+}
+
+void
+esch_mutex_lock_i(esch_mutex* mutex)
+{
+    (void)pthread_mutex_lock(&(mutex->handle));
+}
+
+void
+esch_mutex_unlock_i(esch_mutex* mutex)
+{
+    (void)pthread_mutex_unlock(&(mutex->handle));
+}
+
+esch_error
+esch_cond_init_i(esch_cond* cond)
+{
+    ESCH_CHECK_PARAM_INTERNAL(cond != NULL);
+    return (pthread_cond_init(&(cond->handle), NULL) == 0?
+            ESCH_OK: ESCH_ERROR_NOT_SUPPORTED);
+}
+
+void
+esch_cond_destroy_i(esch_cond* cond)
+{
+    (void)pthread_cond_destroy(&(cond->handle));
+}
+
+void
+esch_cond_wait_i(esch_cond* cond, esch_mutex* mutex)
+{
+    (void)pthread_cond_wait(&(cond->handle), &(mutex->handle));
+}
+
+void
+esch_cond_broadcast_i(esch_cond* cond)
+{
+    (void)pthread_cond_broadcast(&(cond->handle));
+}
+
+void
+esch_thread_sleep_i(int ms)
+{
+    struct timespec ts;
+    ts.tv_sec = ms / 1000;
+    ts.tv_nsec = (long)(ms % 1000) * 1000000L;
+    (void)nanosleep(&ts, NULL);
+}
+
+uint64_t
+esch_thread_now_ns_i(void)
+{
+    struct timespec ts;
+    (void)clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t)ts.tv_sec * 1000000000 + (uint64_t)ts.tv_nsec;
+}
+
+/*
+ * GCC and clang builtins, all sequentially consistent. Prefer __atomic
+ * builtins (GCC 4.7 and later), which tools like thread sanitizer
+ * understand.
+ */
+#ifdef __ATOMIC_SEQ_CST
+
+size_t
+esch_atomic_load_i(volatile size_t* ptr)
+{
+    return __atomic_load_n(ptr, __ATOMIC_SEQ_CST);
+}
+
+void
+esch_atomic_store_i(volatile size_t* ptr, size_t value)
+{
+    __atomic_store_n(ptr, value, __ATOMIC_SEQ_CST);
+}
+
+esch_bool
+esch_atomic_cas_i(volatile size_t* ptr, size_t expected, size_t desired)
+{
+    return (__atomic_compare_exchange_n(ptr, &expected, desired, 0,
+                                        __ATOMIC_SEQ_CST,
+                                        __ATOMIC_SEQ_CST)?
+            ESCH_TRUE: ESCH_FALSE);
+}
+
+size_t
+esch_atomic_add_i(volatile size_t* ptr, size_t delta)
+{
+    return __atomic_fetch_add(ptr, delta, __ATOMIC_SEQ_CST);
+}
+
+#else
+
+size_t
+esch_atomic_load_i(volatile size_t* ptr)
+{
+    size_t value = 0;
+    __sync_synchronize();
+    value = (*ptr);
+    __sync_synchronize();
+    return value;
+}
+
+void
+esch_atomic_store_i(volatile size_t* ptr, size_t value)
+{
+    __sync_synchronize();
+    (*ptr) = value;
+    __sync_synchronize();
+}
+
+esch_bool
+esch_atomic_cas_i(volatile size_t* ptr, size_t expected, size_t desired)
+{
+    return (__sync_bool_compare_and_swap(ptr, expected, desired)?
+            ESCH_TRUE: ESCH_FALSE);
+}
+
+size_t
+esch_atomic_add_i(volatile size_t* ptr, size_t delta)
+{
+    return __sync_fetch_and_add(ptr, delta);
+}
+
+#endif /* __ATOMIC_SEQ_CST */
+
+#endif /* _WIN32 */
@@ -0,0 +1,151 @@
+/* vim:ft=c expandtab tw=72 sw=4
+ */
+/* See Copyright notice in esch.h */
+#ifndef _ESCH_THREAD_H_
+#define _ESCH_THREAD_H_
+
+#include "esch.h"
+
+#ifdef _WIN32
+#    include <windows.h>
+#else
+#    include <pthread.h>
+#endif
+
+#ifdef __cplusplus
+extern "C" {
+#endif /* __cplusplus */
+
+/*
+ * A thin wrapper on platform threading library. It's internal only, so
+ * Esch code does not need to care about pthread or Win32 thread API.
+ *
+ * NOTE: Threading is one of the two places Esch can't stay in pure
+ * C89 (see readme.rst). Keep everything platform-dependent here.
+ */
+typedef void (*esch_thread_routine_f)(void*);
+
+typedef struct esch_thread esch_thread;
+struct esch_thread
+{
+#ifdef _WIN32
+    HANDLE handle;
+#else
+    pthread_t handle;
+#endif
+    esch_thread_routine_f routine;
+    void* arg;
+};
+
+/**
+ * Start a new thread. The thread structure must be kept alive until
+ * esch_thread_join_i() returns.
+ * @param thread Thread structure to be initialized.
+ * @param routine Routine to run on new thread.
+ * @param arg Argument passed to routine.
+ * @return Return code. ESCH_ERROR_NOT_SUPPORTED if thread can't start.
+ */
+esch_error esch_thread_start_i(esch_thread* thread,
+                               esch_thread_routine_f routine,
+                               void* arg);
+/**
+ * Wait until given thread exits.
+ * @param thread A thread started by esch_thread_start_i().
+ * @return Return code. ESCH_OK if success.
+ */
+esch_error esch_thread_join_i(esch_thread* thread);
+
+/*
+ * Mutex and condition variable, for threads that wait for each other
+ * instead of polling. On Windows they need Vista or later.
+ */
+typedef struct esch_mutex esch_mutex;
+struct esch_mutex
+{
+#ifdef _WIN32
+    CRITICAL_SECTION handle;
+#else
+    pthread_mutex_t handle;
+#endif
+};
+typedef struct esch_cond esch_cond;
+struct esch_cond
+{
+#ifdef _WIN32
+    CONDITION_VARIABLE handle;
+#else
+    pthread_cond_t handle;
+#endif
+};
+
+/**
+ * Initialize a mutex. Release it with esch_mutex_destroy_i().
+ * @return Return code. ESCH_ERROR_NOT_SUPPORTED if it can't be created.
+ */
+esch_error esch_mutex_init_i(esch_mutex* mutex);
+void esch_mutex_destroy_i(esch_mutex* mutex);
+void esch_mutex_lock_i(esch_mutex* mutex);
+void esch_mutex_unlock_i(esch_mutex* mutex);
+/**
+ * Initialize a condition variable. Release it with
+ * esch_cond_destroy_i().
+ * @return Return code. ESCH_ERROR_NOT_SUPPORTED if it can't be created.
+ */
+esch_error esch_cond_init_i(esch_cond* cond);
+void esch_cond_destroy_i(esch_cond* cond);
+/**
+ * Release mutex and wait until condition is signaled, then lock mutex
+ * again. It may also wake up without a signal, so caller must check
+ * its condition in a loop.
+ */
+void esch_cond_wait_i(esch_cond* cond, esch_mutex* mutex);
+/**
+ * Wake up all threads waiting on condition.
+ */
+void esch_cond_broadcast_i(esch_cond* cond);
+
+/*
+ * Storage class of thread-local variables. Compiler extension, not
+ * C89.
+ */
+#ifdef _MSC_VER
+#    define ESCH_THREAD_LOCAL __declspec(thread)
+#else
+#    define ESCH_THREAD_LOCAL __thread
+#endif
+
+/**
+ * Read a monotonic clock.
+ * @return Time in nanoseconds from an unspecified start point.
+ */
+uint64_t esch_thread_now_ns_i(void);
+/**
+ * Put current thread to sleep.
+ * @param ms Time to sleep in milliseconds.
+ */
+void esch_thread_sleep_i(int ms);
+
+/*
+ * Atomic operations on size_t. All of them are full barriers, so a
+ * value written before esch_atomic_store_i() is visible to a thread
+ * that reads the stored value with esch_atomic_load_i().
+ */
+size_t esch_atomic_load_i(volatile size_t* ptr);
+void esch_atomic_store_i(volatile size_t* ptr, size_t value);
+/**
+ * Compare and swap.
+ * @return ESCH_TRUE if (*ptr) was expected and is replaced by desired.
+ */
+esch_bool esch_atomic_cas_i(volatile size_t* ptr,
+                            size_t expected, size_t desired);
+/**
+ * Add delta to (*ptr).
+ * @return Value before add.
+ */
+size_t esch_atomic_add_i(volatile size_t* ptr, size_t delta);
+
+#ifdef __cplusplus
+}
+#endif /* __cplusplus */
+
+#endif /* _ESCH_THREAD_H_ */
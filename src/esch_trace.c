@@ -0,0 +1,236 @@
+/* vim:ft=c expandtab tw=72 sw=4
+ */
+/* See Copyright notice in esch.h */
+#include "esch_trace.h"
+#include "esch_debug.h"
+#include "esch_thread.h"
+#include "esch_type.h"
+#include "esch_gc.h"
+#include "esch_pair.h"
+#include "esch_number.h"
+#include "esch_string.h"
+#include "esch_symbol.h"
+#include "esch_vector.h"
+#include "esch_hashtable.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+/* 4096 records are 128KB. A thread writes file once per buffer. */
+#define ESCH_TRACE_BUFFER_RECORDS 4096
+
+/*
+ * Buffers are never freed, because thread-local pointers of finished
+ * threads can't be reset. They are kept in a list, so stop() can write
+ * buffers of all threads, and reused by next trace.
+ */
+struct esch_trace_buffer
+{
+    struct esch_trace_buffer* next;
+    uint16_t thread;
+    volatile size_t busy; /* Non-zero while owner thread appends. */
+    size_t count;
+    struct esch_trace_record records[ESCH_TRACE_BUFFER_RECORDS];
+};
+
+volatile size_t esch_trace_enabled = 0;
+static FILE* esch_trace_file = NULL;
+static volatile size_t esch_trace_lock = 0;
+static struct esch_trace_buffer* esch_trace_buffers = NULL;
+static uint16_t esch_trace_threads = 0;
+static ESCH_THREAD_LOCAL struct esch_trace_buffer* esch_trace_local = NULL;
+
+/* Names of builtin types that create objects with esch_object_new_i(). */
+static const struct
+{
+    esch_type* type;
+    const char* name;
+} esch_trace_type_names[] =
+{
+    { &(esch_string_type.type), "string" },
+    { &(esch_string_inline_type.type), "string:inline" },
+    { &(esch_string_view_type.type), "string:view" },
+    { &(esch_string_rope_type.type), "string:rope" },
+    { &(esch_vector_type.type), "vector" },
+    { &(esch_pair_type.type), "pair" },
+    { &(esch_integer_type.type), "integer" },
+    { &(esch_fraction_type.type), "fraction" },
+    { &(esch_symbol_type.type), "symbol" },
+    { &(esch_symbol_table_type.type), "symbol_table" },
+    { &(esch_hashtable_type.type), "hashtable" },
+    { &(esch_gc_type.type), "gc" },
+};
+
+static void esch_trace_lock_i(void);
+static void esch_trace_unlock_i(void);
+static void esch_trace_write_buffer_i(struct esch_trace_buffer* buffer);
+static void esch_trace_write_type_names_i(void);
+
+esch_error
+esch_trace_start(const char* path)
+{
+    esch_error ret = ESCH_OK;
+    struct esch_trace_header header;
+    ESCH_CHECK_PARAM_PUBLIC(path != NULL);
+    ESCH_CHECK(esch_trace_file == NULL, esch_global_log,
+               "trace:start: Trace is running", ESCH_ERROR_INVALID_STATE);
+
+    esch_trace_file = fopen(path, "wb");
+    ESCH_CHECK(esch_trace_file != NULL, esch_global_log,
+               "trace:start: Can't create trace file", ESCH_ERROR_NOT_FOUND);
+    memset(&header, 0, sizeof(header));
+    memcpy(header.magic, ESCH_TRACE_MAGIC, sizeof(ESCH_TRACE_MAGIC));
+    header.version = ESCH_TRACE_VERSION;
+    header.record_size = sizeof(struct esch_trace_record);
+    (void)fwrite(&header, sizeof(header), 1, esch_trace_file);
+    esch_trace_write_type_names_i();
+    esch_atomic_store_i(&esch_trace_enabled, 1);
+Exit:
+    return ret;
+}
+
+esch_error
+esch_trace_stop(void)
+{
+    esch_error ret = ESCH_OK;
+    struct esch_trace_buffer* head = NULL;
+    struct esch_trace_buffer* each = NULL;
+    ESCH_CHECK(esch_trace_file != NULL, esch_global_log,
+               "trace:stop: Trace is not running", ESCH_ERROR_INVALID_STATE);
+
+    esch_atomic_store_i(&esch_trace_enabled, 0);
+    /* Wait for threads that passed ESCH_TRACE check before trace is
+     * disabled. Buffers added after this see trace disabled. */
+    esch_trace_lock_i();
+    head = esch_trace_buffers;
+    esch_trace_unlock_i();
+    for (each = head; each != NULL; each = each->next)
+    {
+        while (esch_atomic_load_i(&(each->busy)))
+        {
+            esch_thread_sleep_i(0);
+        }
+    }
+    esch_trace_lock_i();
+    for (each = esch_trace_buffers; each != NULL; each = each->next)
+    {
+        esch_trace_write_buffer_i(each);
+    }
+    (void)fclose(esch_trace_file);
+    esch_trace_file = NULL;
+    esch_trace_unlock_i();
+Exit:
+    return ret;
+}
+
+/*
+ * Append one record to buffer of current thread. Only a full buffer
+ * takes lock. Buffer is marked busy while record is appended, and
+ * trace is checked again after that, so stop() never writes a buffer
+ * in the middle of an append.
+ */
+void
+esch_trace_emit_i(esch_trace_event event, esch_type* type,
+                  size_t size, void* gc_id)
+{
+    struct esch_trace_buffer* buffer = esch_trace_local;
+    struct esch_trace_record* record = NULL;
+
+    if (buffer == NULL)
+    {
+        buffer = (struct esch_trace_buffer*)malloc(sizeof(*buffer));
+        if (buffer == NULL)
+        {
+            return;
+        }
+        buffer->count = 0;
+        buffer->busy = 0;
+        esch_trace_lock_i();
+        buffer->thread = esch_trace_threads++;
+        buffer->next = esch_trace_buffers;
+        esch_trace_buffers = buffer;
+        esch_trace_unlock_i();
+        esch_trace_local = buffer;
+    }
+    esch_atomic_store_i(&(buffer->busy), 1);
+    if (!esch_atomic_load_i(&esch_trace_enabled))
+    {
+        esch_atomic_store_i(&(buffer->busy), 0);
+        return;
+    }
+    record = &(buffer->records[buffer->count]);
+    record->timestamp = esch_thread_now_ns_i();
+    record->event = (uint16_t)event;
+    record->thread = buffer->thread;
+    record->size = (uint32_t)size;
+    record->type = (uint64_t)(size_t)type;
+    record->gc_id = (uint64_t)(size_t)gc_id;
+    ++(buffer->count);
+    if (buffer->count == ESCH_TRACE_BUFFER_RECORDS)
+    {
+        esch_trace_lock_i();
+        esch_trace_write_buffer_i(buffer);
+        esch_trace_unlock_i();
+    }
+    esch_atomic_store_i(&(buffer->busy), 0);
+}
+
+static void
+esch_trace_lock_i(void)
+{
+    while (!esch_atomic_cas_i(&esch_trace_lock, 0, 1))
+    {
+        /* Only held while writing 128KB, so don't sleep long. */
+        esch_thread_sleep_i(0);
+    }
+}
+
+static void
+esch_trace_unlock_i(void)
+{
+    esch_atomic_store_i(&esch_trace_lock, 0);
+}
+
+/* Caller must hold lock. */
+static void
+esch_trace_write_buffer_i(struct esch_trace_buffer* buffer)
+{
+    if (esch_trace_file != NULL && buffer->count > 0)
+    {
+        (void)fwrite(buffer->records, sizeof(struct esch_trace_record),
+                     buffer->count, esch_trace_file);
+    }
+    buffer->count = 0;
+}
+
+static void
+esch_trace_write_type_names_i(void)
+{
+    struct esch_trace_record record;
+    size_t length = 0;
+    size_t offset = 0;
+    size_t chunk = 0;
+    size_t i = 0;
+    size_t count = sizeof(esch_trace_type_names) /
+                   sizeof(esch_trace_type_names[0]);
+
+    for (i = 0; i < count; ++i)
+    {
+        length = strlen(esch_trace_type_names[i].name);
+        memset(&record, 0, sizeof(record));
+        record.timestamp = esch_thread_now_ns_i();
+        record.event = ESCH_TRACE_TYPE_NAME;
+        record.size = (uint32_t)length;
+        record.type = (uint64_t)(size_t)(esch_trace_type_names[i].type);
+        (void)fwrite(&record, sizeof(record), 1, esch_trace_file);
+        /* Name follows in raw records. */
+        for (offset = 0; offset < length; offset += sizeof(record))
+        {
+            chunk = (length - offset < sizeof(record)?
+                     length - offset: sizeof(record));
+            memset(&record, 0, sizeof(record));
+            memcpy(&record, esch_trace_type_names[i].name + offset, chunk);
+            (void)fwrite(&record, sizeof(record), 1, esch_trace_file);
+        }
+    }
+}
@@ -0,0 +1,78 @@
+/* vim:ft=c expandtab tw=72 sw=4
+ */
+/* See Copyright notice in esch.h */
+#ifndef _ESCH_TRACE_H_
+#define _ESCH_TRACE_H_
+
+#include "esch.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif /* __cplusplus */
+
+/*
+ * Binary event trace. Each event is a fixed-size record, appended to a
+ * buffer of current thread without lock. Full buffers are written to
+ * trace file. Use tools/trace/decode.py to read trace file.
+ *
+ * File layout: one header record, then event records. Records use
+ * byte order of host. A ESCH_TRACE_TYPE_NAME record is followed by
+ * (size + 31) / 32 records of raw bytes, which hold name of type.
+ */
+typedef enum esch_trace_event {
+    ESCH_TRACE_TYPE_NAME = 1,    /* type, size = length of name */
+    ESCH_TRACE_OBJECT_NEW,       /* type, size = bytes, gc_id */
+    ESCH_TRACE_OBJECT_DELETE,    /* type, gc_id is always 0 */
+    ESCH_TRACE_GC_ATTACH,        /* type, gc_id */
+    ESCH_TRACE_GC_MARK_BEGIN,    /* size = slots */
+    ESCH_TRACE_GC_SWEEP_BEGIN,   /* size = slots */
+    ESCH_TRACE_GC_RECYCLE_END,   /* size = objects freed */
+} esch_trace_event;
+
+#define ESCH_TRACE_MAGIC "ESCHTRC"
+#define ESCH_TRACE_VERSION 1
+
+struct esch_trace_record
+{
+    uint64_t timestamp; /* Nanoseconds, monotonic clock */
+    uint16_t event;     /* esch_trace_event */
+    uint16_t thread;    /* Index of thread, from 0 */
+    uint32_t size;
+    uint64_t type;      /* Address of esch_type */
+    uint64_t gc_id;
+};
+
+struct esch_trace_header
+{
+    char magic[8];      /* ESCH_TRACE_MAGIC */
+    uint32_t version;   /* ESCH_TRACE_VERSION */
+    uint32_t record_size;
+    uint64_t reserved[2];
+};
+
+/* Non-zero between esch_trace_start() and esch_trace_stop(). */
+extern volatile size_t esch_trace_enabled;
+
+void esch_trace_emit_i(esch_trace_event event, esch_type* type,
+                       size_t size, void* gc_id);
+
+/*
+ * A disabled trace costs one load and branch. Define ESCH_NO_TRACE to
+ * remove it. The load is a plain read, so it may be stale: emit
+ * checks again with an atomic load before it appends.
+ */
+#ifdef ESCH_NO_TRACE
+#    define ESCH_TRACE(event, type, size, gc_id)
+#else
+#    define ESCH_TRACE(event, type, size, gc_id) { \
+        if (esch_trace_enabled) { \
+            esch_trace_emit_i(event, type, size, gc_id); \
+        } \
+    }
+#endif /* ESCH_NO_TRACE */
+
+#ifdef __cplusplus
+}
+#endif /* __cplusplus */
+
+#endif /* _ESCH_TRACE_H_ */
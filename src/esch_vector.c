@@ -25,6 +25,171 @@ esch_vector_get_iterator_i(esch_object* obj, esch_iterator* iter);
 esch_error
 esch_vector_new_default_as_object_i(esch_config* config, esch_object** vec);
 
+/*
+ * -----------------------------------------------------------------
+ * Element storage. Every layout defines the functions below, and a
+ * vector picks them by esch_vector::layout.
+ * -----------------------------------------------------------------
+ */
+struct esch_vector_storage
+{
+    /* Allocate or reallocate buffers to hold given number of slots. */
+    esch_error (*resize)(esch_vector*, esch_alloc*, size_t);
+    /* Free all buffers. */
+    esch_error (*release)(esch_vector*, esch_alloc*);
+    void (*read)(esch_vector*, size_t, esch_value*);
+    void (*write)(esch_vector*, size_t, esch_value*);
+    /* Return first index of object at or after given index. */
+    size_t (*seek_object)(esch_vector*, size_t);
+};
+
+static esch_error
+esch_vector_mixed_resize_i(esch_vector* vec, esch_alloc* alloc,
+                           size_t slots)
+{
+    esch_error ret = ESCH_OK;
+    esch_value* new_array = NULL;
+    ret = esch_alloc_realloc(alloc, vec->begin,
+                             sizeof(esch_value) * (slots + 1),
+                             (void**)&new_array);
+    if (ret == ESCH_OK) {
+        vec->begin = new_array;
+    }
+    return ret;
+}
+static esch_error
+esch_vector_mixed_release_i(esch_vector* vec, esch_alloc* alloc)
+{
+    esch_error ret = esch_alloc_free(alloc, vec->begin);
+    vec->begin = NULL;
+    return ret;
+}
+static void
+esch_vector_mixed_read_i(esch_vector* vec, size_t index, esch_value* value)
+{
+    (*value) = vec->begin[index];
+}
+static void
+esch_vector_mixed_write_i(esch_vector* vec, size_t index, esch_value* value)
+{
+    vec->begin[index] = (*value);
+}
+static size_t
+esch_vector_mixed_seek_object_i(esch_vector* vec, size_t index)
+{
+    while (index < vec->length &&
+           vec->begin[index].type != ESCH_VALUE_TYPE_OBJECT) {
+        ++index;
+    }
+    return index;
+}
+
+static esch_error
+esch_vector_split_resize_i(esch_vector* vec, esch_alloc* alloc,
+                           size_t slots)
+{
+    esch_error ret = ESCH_OK;
+    esch_value_data* new_data = NULL;
+    esch_byte* new_tags = NULL;
+    ret = esch_alloc_realloc(alloc, vec->data,
+                             sizeof(esch_value_data) * (slots + 1),
+                             (void**)&new_data);
+    if (ret != ESCH_OK) {
+        return ret;
+    }
+    /* A larger data buffer does no harm even if tags fails below. */
+    vec->data = new_data;
+    ret = esch_alloc_realloc(alloc, vec->tags,
+                             sizeof(esch_byte) * (slots + 1),
+                             (void**)&new_tags);
+    if (ret == ESCH_OK) {
+        vec->tags = new_tags;
+    }
+    return ret;
+}
+static esch_error
+esch_vector_split_release_i(esch_vector* vec, esch_alloc* alloc)
+{
+    esch_error ret = ESCH_OK;
+    esch_error ret_tags = ESCH_OK;
+    ret = esch_alloc_free(alloc, vec->data);
+    ret_tags = esch_alloc_free(alloc, vec->tags);
+    vec->data = NULL;
+    vec->tags = NULL;
+    return (ret != ESCH_OK? ret: ret_tags);
+}
+static void
+esch_vector_split_read_i(esch_vector* vec, size_t index, esch_value* value)
+{
+    value->type = (esch_value_type)vec->tags[index];
+    value->val = vec->data[index];
+}
+static void
+esch_vector_split_write_i(esch_vector* vec, size_t index, esch_value* value)
+{
+    vec->tags[index] = (esch_byte)value->type;
+    vec->data[index] = value->val;
+}
+static size_t
+esch_vector_split_seek_object_i(esch_vector* vec, size_t index)
+{
+    esch_byte* found = NULL;
+    if (index >= vec->length) {
+        return vec->length;
+    }
+    /* Tags are bytes, so memchr() scans them in bulk. */
+    found = (esch_byte*)memchr(vec->tags + index, ESCH_VALUE_TYPE_OBJECT,
+                               vec->length - index);
+    return (found == NULL? vec->length: (size_t)(found - vec->tags));
+}
+
+static struct esch_vector_storage esch_vector_storage[2] = {
+    { /* ESCH_VECTOR_LAYOUT_MIXED */
+        esch_vector_mixed_resize_i,
+        esch_vector_mixed_release_i,
+        esch_vector_mixed_read_i,
+        esch_vector_mixed_write_i,
+        esch_vector_mixed_seek_object_i
+    },
+    { /* ESCH_VECTOR_LAYOUT_SPLIT */
+        esch_vector_split_resize_i,
+        esch_vector_split_release_i,
+        esch_vector_split_read_i,
+        esch_vector_split_write_i,
+        esch_vector_split_seek_object_i
+    },
+};
+
+void
+esch_vector_read_i(esch_vector* vec, size_t index, esch_value* value)
+{
+    ESCH_ASSERT(index < vec->length);
+    esch_vector_storage[vec->layout].read(vec, index, value);
+}
+
+void
+esch_vector_write_i(esch_vector* vec, size_t index, esch_value* value)
+{
+    ESCH_ASSERT(index < vec->length);
+    esch_vector_storage[vec->layout].write(vec, index, value);
+}
+
+esch_error
+esch_vector_reserve_i(esch_vector* vec, size_t slots)
+{
+    esch_error ret = ESCH_OK;
+    esch_alloc* alloc = ESCH_OBJECT_GET_ALLOC(ESCH_CAST_TO_OBJECT(vec));
+    if (slots > vec->slots)
+    {
+        ret = esch_vector_storage[vec->layout].resize(vec, alloc, slots);
+        if (ret == ESCH_OK)
+        {
+            vec->slots = slots;
+        }
+    }
+    return ret;
+}
+
 struct esch_builtin_type esch_vector_type = 
 {
     {
@@ -99,7 +264,7 @@ esch_vector_new_i(esch_config* config, esch_vector** vec)
     esch_object* vec_obj = NULL;
     esch_vector* new_vec = NULL;
     int initial_length = 0;
-    esch_value* array = NULL;
+    esch_vector_layout layout = ESCH_VECTOR_LAYOUT_MIXED;
 
     ESCH_CHECK_PARAM_INTERNAL(config != NULL);
     ESCH_CHECK_PARAM_INTERNAL(vec != NULL);
@@ -122,10 +287,13 @@ esch_vector_new_i(esch_config* config, esch_vector** vec)
         initial_length = ESCH_VECTOR_MINIMAL_INITIAL_LENGTH;
     }
 
-    ret = esch_alloc_realloc(alloc, NULL,
-                             sizeof(esch_value) * (initial_length + 1),
-                             (void**)&array);
-    ESCH_CHECK(ret == ESCH_OK, log, "Failed to allocate array", ret);
+    layout = ESCH_CONFIG_GET_VECTOR_LAYOUT(config);
+    if (layout != ESCH_VECTOR_LAYOUT_MIXED &&
+            layout != ESCH_VECTOR_LAYOUT_SPLIT)
+    {
+        ESCH_LOG_WARN_1(log, "vec:new:Unknown layout %d, use mixed", layout);
+        layout = ESCH_VECTOR_LAYOUT_MIXED;
+    }
 
     ret = esch_object_new_i(config, &(esch_vector_type.type), &vec_obj);
     ESCH_CHECK(ret == ESCH_OK, log, "Failed to new vector object", ret);
@@ -134,17 +302,25 @@ esch_vector_new_i(esch_config* config, esch_vector** vec)
 
     new_vec->enlarge = (ESCH_CONFIG_GET_VECTOR_ENLARGE(config)?
                         ESCH_TRUE: ESCH_FALSE);
+    new_vec->sort_threads = ESCH_CONFIG_GET_VECTOR_SORT_THREADS(config);
+    if (new_vec->sort_threads < 1)
+    {
+        new_vec->sort_threads = 1;
+    }
+    new_vec->layout = layout;
+    new_vec->slots = 0;
+    new_vec->length = 0;
+    new_vec->begin = NULL;
+    new_vec->tags = NULL;
+    new_vec->data = NULL;
+    ret = esch_vector_storage[layout].resize(new_vec, alloc,
+                                             (size_t)initial_length);
+    ESCH_CHECK(ret == ESCH_OK, log, "Failed to allocate array", ret);
     new_vec->slots = (size_t)initial_length;
-    new_vec->begin = array;
-    new_vec->next = &(new_vec->begin[0]);
-    array = NULL;
+
     (*vec) = new_vec;
     new_vec = NULL;
 Exit:
-    if (array != NULL)
-    {
-        (void)esch_alloc_free(alloc, array);
-    }
     if (new_vec != NULL)
     {
         (void)esch_object_delete(vec_obj);
@@ -159,7 +335,7 @@ esch_vector_get_length(esch_vector* vec, size_t* length)
     ESCH_CHECK_PARAM_PUBLIC(vec != NULL);
     ESCH_CHECK_PARAM_PUBLIC(length != NULL);
     ESCH_CHECK_PARAM_PUBLIC(ESCH_IS_VALID_VECTOR(vec));
-    (*length) = (vec->next - vec->begin);
+    (*length) = vec->length;
 Exit:
     return ret;
 }
@@ -182,9 +358,8 @@ esch_vector_destructor_i(esch_object* obj)
     vec = ESCH_CAST_FROM_OBJECT(obj, esch_vector);
     ESCH_CHECK_PARAM_INTERNAL(ESCH_IS_VALID_VECTOR(vec));
 
-    ret = esch_alloc_free(alloc, vec->begin);
-    vec->begin = NULL;
-    vec->next = NULL;
+    ret = esch_vector_storage[vec->layout].release(vec, alloc);
+    vec->length = 0;
     vec->slots = 0;
     /* Object ref is deleted. */
 Exit:
@@ -206,6 +381,8 @@ esch_vector_copy_object_i(esch_object* input, esch_object** output)
     esch_log* log = NULL;
     esch_gc* gc = NULL;
     esch_config* config = NULL;
+    esch_value value;
+    size_t i = 0;
 
     ESCH_CHECK_PARAM_INTERNAL(input != NULL);
     ESCH_CHECK_PARAM_INTERNAL(output != NULL);
@@ -223,21 +400,28 @@ esch_vector_copy_object_i(esch_object* input, esch_object** output)
 
     ret = esch_config_new(log, alloc, &config);
     ESCH_CHECK(ret == ESCH_OK, log, "vec:Can't create config", ret);
-    ret = esch_config_set_obj(config, ESCH_CONFIG_KEY_ALLOC,
-                              ESCH_CAST_TO_OBJECT(alloc));
+    ret = esch_config_set_obj_by_id(config, ESCH_CONFIG_KEY_ID_ALLOC,
+                                    ESCH_CAST_TO_OBJECT(alloc));
     ESCH_CHECK(ret == ESCH_OK, log, "vec:Can't insert alloc", ret);
-    ret = esch_config_set_obj(config, ESCH_CONFIG_KEY_LOG,
-                              ESCH_CAST_TO_OBJECT(log));
+    ret = esch_config_set_obj_by_id(config, ESCH_CONFIG_KEY_ID_LOG,
+                                    ESCH_CAST_TO_OBJECT(log));
     ESCH_CHECK(ret == ESCH_OK, log, "vec:Can't insert log", ret);
     if (gc != NULL)
     {
-        ret = esch_config_set_obj(config, ESCH_CONFIG_KEY_GC,
-                                  ESCH_CAST_TO_OBJECT(gc));
+        ret = esch_config_set_obj_by_id(config, ESCH_CONFIG_KEY_ID_GC,
+                                        ESCH_CAST_TO_OBJECT(gc));
         ESCH_CHECK(ret == ESCH_OK, log, "vec:Can't insert gc", ret);
     }
-    ret = esch_config_set_int(config, ESCH_CONFIG_KEY_VECTOR_LENGTH,
-                              vec->slots);
+    ret = esch_config_set_int_by_id(config, ESCH_CONFIG_KEY_ID_VECTOR_LENGTH,
+                                    vec->slots);
     ESCH_CHECK(ret == ESCH_OK, log, "vec:Can't set initial length", ret);
+    ret = esch_config_set_int_by_id(config,
+                                    ESCH_CONFIG_KEY_ID_VECTOR_SORT_THREADS,
+                                    vec->sort_threads);
+    ESCH_CHECK(ret == ESCH_OK, log, "vec:Can't set sort threads", ret);
+    ret = esch_config_set_int_by_id(config, ESCH_CONFIG_KEY_ID_VECTOR_LAYOUT,
+                                    vec->layout);
+    ESCH_CHECK(ret == ESCH_OK, log, "vec:Can't set layout", ret);
 
     ret = esch_vector_new_i(config, &new_vec);
     ESCH_CHECK(ret == ESCH_OK, log, "vec:Can't create new vector", ret);
@@ -245,8 +429,12 @@ esch_vector_copy_object_i(esch_object* input, esch_object** output)
      * Copy connects so two vectors contains same objects.
      * NOTE: We don't do real deep copy.
      */
-    memcpy(new_vec->begin, vec->begin, sizeof(esch_value) * (vec->slots));
-    new_vec->next = new_vec->begin + (vec->next - vec->begin);
+    new_vec->length = vec->length;
+    for (i = 0; i < vec->length; ++i)
+    {
+        esch_vector_read_i(vec, i, &value);
+        esch_vector_write_i(new_vec, i, &value);
+    }
 
     (*output) = ESCH_CAST_TO_OBJECT(new_vec);
 
@@ -268,16 +456,34 @@ esch_vector_iterator_get_value_i(esch_iterator* iter, esch_value* value)
     ESCH_CHECK_PARAM_PUBLIC(ESCH_IS_VALID_VECTOR(vec));
 
     offset = (size_t)(iter->iterator);
-    if (offset >= vec->next - vec->begin) {
+    if (offset >= vec->length) {
         value->type = ESCH_VALUE_TYPE_END;
         value->val.o = 0;
     } else {
-        (*value) = vec->begin[offset];
+        esch_vector_read_i(vec, offset, value);
     }
 Exit:
     return ret;
 }
 
+static esch_error
+esch_vector_iterator_seek_object_i(esch_iterator* iter)
+{
+    esch_error ret = ESCH_OK;
+    esch_vector* vec = NULL;
+    size_t offset = 0;
+    ESCH_CHECK_PARAM_PUBLIC(iter != NULL);
+    ESCH_CHECK_PARAM_INTERNAL(iter->container != NULL);
+    vec = ESCH_CAST_FROM_OBJECT(iter->container, esch_vector);
+    ESCH_CHECK_PARAM_INTERNAL(ESCH_IS_VALID_VECTOR(vec));
+
+    offset = (size_t)(iter->iterator);
+    offset = esch_vector_storage[vec->layout].seek_object(vec, offset);
+    iter->iterator = (void*)offset;
+Exit:
+    return ret;
+}
+
 static esch_error
 esch_vector_get_next_i(esch_iterator* iter)
 {
@@ -312,6 +518,7 @@ esch_vector_get_iterator_i(esch_object* obj, esch_iterator* iter)
     iter->iterator = (void*)0;
     iter->get_value = esch_vector_iterator_get_value_i;
     iter->get_next = esch_vector_get_next_i;
+    iter->seek_object = esch_vector_iterator_seek_object_i;
 Exit:
     return ret;
 }
@@ -328,8 +535,7 @@ esch_vector_append_value_i(esch_vector* vec, esch_value* value)
     size_t new_slots = 0;
     esch_alloc* alloc = NULL;
     esch_log* log = NULL;
-    esch_value* new_array = NULL;
-    esch_value* slot = NULL;
+    esch_value slot;
     ESCH_CHECK_PARAM_INTERNAL(vec != NULL);
     ESCH_CHECK_PARAM_INTERNAL(value != NULL);
     ESCH_CHECK_PARAM_INTERNAL(ESCH_IS_VALID_VECTOR(vec));
@@ -340,21 +546,18 @@ esch_vector_append_value_i(esch_vector* vec, esch_value* value)
     alloc = ESCH_OBJECT_GET_ALLOC(ESCH_CAST_TO_OBJECT(vec));
     log = ESCH_OBJECT_GET_LOG(ESCH_CAST_TO_OBJECT(vec));
 
-    if (vec->next == vec->begin + vec->slots) {
+    if (vec->length == vec->slots) {
         /* vector buffer is full */
         if (vec->enlarge) {
             new_slots = vec->slots * 2;
             ESCH_ASSERT(alloc != NULL);
             ESCH_ASSERT(ESCH_IS_VALID_ALLOC(alloc));
 
-            ret = esch_alloc_realloc(alloc, vec->begin,
-                             sizeof(esch_value) * (new_slots + 1),
-                             (void**)&new_array);
+            ret = esch_vector_storage[vec->layout].resize(vec, alloc,
+                                                          new_slots);
             ESCH_CHECK(ret == ESCH_OK, log,
                        "vec:append:Failed to reallocate vec", ret);
 
-            vec->begin = new_array;
-            vec->next = vec->begin + vec->slots;
             vec->slots = new_slots;
         } else {
             /* Enlarge is by default not allowed. */
@@ -363,14 +566,16 @@ esch_vector_append_value_i(esch_vector* vec, esch_value* value)
             goto Exit;
         }
     }
-    slot = vec->next;
-    vec->next += 1;
     /* NOTE: Use function table instead of if-type check to avoid
      * runtime cost.
      */
     ret = esch_value_assign[
                  esch_value_check[value->type](value)
-                 ](slot, value);
+                 ](&slot, value);
+    if (ret == ESCH_OK) {
+        vec->length += 1;
+        esch_vector_write_i(vec, vec->length - 1, &slot);
+    }
 Exit:
     return ret;
 }
@@ -392,24 +597,25 @@ esch_vector_get_value_i(esch_vector* vec, int index,
     log = ESCH_OBJECT_GET_LOG(ESCH_CAST_TO_OBJECT(vec));
     real_index = index;
     if (real_index < 0) {
-        if (real_index >= -((int)(vec->next - vec->begin))) {
-            real_index += (vec->next - vec->begin);
+        if (real_index >= -((int)vec->length)) {
+            real_index += (int)vec->length;
             ESCH_ASSERT(real_index >= 0);
         } else {
-            esch_log_info(log, "vec:obj = 0x%x, idx = %d", vec, index);
+            ESCH_LOG_INFO_2(log, "vec:obj = 0x%x, idx = %d", vec, index);
             ret = ESCH_ERROR_OUT_OF_BOUND;
             goto Exit;
         }
     }
-    if (real_index >= 0 && vec->next - vec->begin > real_index) {
-        esch_value_type real_type = vec->begin[real_index].type;
+    if (real_index >= 0 && vec->length > (size_t)real_index) {
+        esch_value slot;
+        esch_vector_read_i(vec, (size_t)real_index, &slot);
         /* NOTE: Use function table instead of if-type check to avoid
          * runtime cost. */
         ret = esch_value_assign[
-                esch_value_type_check[expected_type][real_type]
-            ](value, &(vec->begin[real_index]));
+                esch_value_type_check[expected_type][slot.type]
+            ](value, &slot);
     } else {
-        esch_log_info(log, "vec:obj = 0x%x, idx = %d", vec, index);
+        ESCH_LOG_INFO_2(log, "vec:obj = 0x%x, idx = %d", vec, index);
         ret = ESCH_ERROR_OUT_OF_BOUND;
     }
 Exit:
@@ -428,26 +634,28 @@ esch_vector_set_value_i(esch_vector* vec, int index, esch_value* value)
     log = ESCH_OBJECT_GET_LOG(ESCH_CAST_TO_OBJECT(vec));
     real_index = index;
     if (real_index < 0) {
-        if (real_index >= -((int)(vec->next - vec->begin))) {
-            real_index += (vec->next - vec->begin);
+        if (real_index >= -((int)vec->length)) {
+            real_index += (int)vec->length;
             ESCH_ASSERT(real_index >= 0);
         } else {
-            esch_log_info(log, "vec:obj = 0x%x, idx = %d", vec, index);
+            ESCH_LOG_INFO_2(log, "vec:obj = 0x%x, idx = %d", vec, index);
             ret = ESCH_ERROR_OUT_OF_BOUND;
             goto Exit;
         }
     }
-    if (real_index >= 0 && vec->next - vec->begin > real_index) {
-        esch_value_type real_type = vec->begin[real_index].type;
-        ESCH_CHECK_PARAM_INTERNAL(real_type > ESCH_VALUE_TYPE_UNKNOWN);
-        ESCH_CHECK_PARAM_INTERNAL(real_type < ESCH_VALUE_TYPE_END);
+    if (real_index >= 0 && vec->length > (size_t)real_index) {
+        esch_value slot;
+        esch_vector_read_i(vec, (size_t)real_index, &slot);
+        ESCH_CHECK_PARAM_INTERNAL(slot.type > ESCH_VALUE_TYPE_UNKNOWN);
+        ESCH_CHECK_PARAM_INTERNAL(slot.type < ESCH_VALUE_TYPE_END);
         /* NOTE: Use function table instead of if-type check to avoid
          * runtime cost.  */
         ret = esch_value_assign[
-                esch_value_type_check[ESCH_VALUE_TYPE_END][real_type]
-            ](&(vec->begin[real_index]), value);
+                esch_value_type_check[ESCH_VALUE_TYPE_END][slot.type]
+            ](&slot, value);
+        esch_vector_write_i(vec, (size_t)real_index, &slot);
     } else {
-        esch_log_info(log, "vec:obj = 0x%x, idx = %d", vec, index);
+        ESCH_LOG_INFO_2(log, "vec:obj = 0x%x, idx = %d", vec, index);
         ret = ESCH_ERROR_OUT_OF_BOUND;
     }
 Exit:
@@ -16,9 +16,15 @@ extern "C" {
 struct esch_vector
 {
     esch_bool enlarge;
+    int sort_threads; /* Worker threads used by esch_vector_sort() */
+    esch_vector_layout layout;
     size_t slots;
+    size_t length; /* Number of elements, for all layouts */
+    /* ESCH_VECTOR_LAYOUT_MIXED */
     esch_value* begin;
-    esch_value* next; /* Next available slot */
+    /* ESCH_VECTOR_LAYOUT_SPLIT */
+    esch_byte* tags; /* Type of each element, as esch_value_type */
+    esch_value_data* data; /* Payload of each element */
 };
 
 #define ESCH_IS_VALID_VECTOR(vec) \
@@ -31,6 +37,16 @@ struct esch_vector
 extern struct esch_builtin_type esch_vector_type;
 extern const size_t ESCH_VECTOR_MINIMAL_INITIAL_LENGTH;
 extern const size_t ESCH_VECTOR_MAX_LENGTH;
+extern const size_t ESCH_VECTOR_PARALLEL_SORT_THRESHOLD;
+
+/* Raw element access for any layout. Index must be within length. */
+void esch_vector_read_i(esch_vector* vec, size_t index, esch_value* value);
+void esch_vector_write_i(esch_vector* vec, size_t index, esch_value* value);
+/*
+ * Make room for given number of elements at once, even when enlarge is
+ * off. Used when final length is known, like converting a list.
+ */
+esch_error esch_vector_reserve_i(esch_vector* vec, size_t slots);
 
 #ifdef __cplusplus
 }
@@ -0,0 +1,790 @@
+/* vim:ft=c expandtab tw=72 sw=4
+ */
+/* See Copyright notice in esch.h */
+#include <string.h>
+#include "esch_vector.h"
+#include "esch_debug.h"
+#include "esch_log.h"
+#include "esch_thread.h"
+
+/*
+ * Sorting and searching on esch_vector. Sorting works on an array of
+ * esch_value: esch_vector::begin itself for mixed layout, or a copy
+ * gathered from tags and payloads for split layout.
+ *
+ * There are two algorithms:
+ *
+ * 1. Radix sort. It's used when no compare function is given and all
+ *    elements have the same numeric type (byte, unicode, integer or
+ *    float). Keys are copied out to a compact array, sorted with LSD
+ *    radix sort, then written back. We can do this because elements
+ *    of the same type are fully described by their keys.
+ * 2. Merge sort. It's used for everything else. It's a bottom-up merge
+ *    sort with insertion sort for short runs. Large inputs are split
+ *    into chunks, sorted and merged by worker threads. The merge steps
+ *    are also parallel: each merge is cut into independent parts by
+ *    "merge path" partitioning, so all workers stay busy until the
+ *    last merge.
+ *
+ * Both algorithms are stable.
+ */
+
+const size_t ESCH_VECTOR_PARALLEL_SORT_THRESHOLD = 65536;
+
+#define ESCH_SORT_INSERTION_RUN 32
+#define ESCH_SORT_MAX_THREADS 64
+#define ESCH_SORT_MIN(a, b) ((a) < (b)? (a): (b))
+#define ESCH_SORT_COMPARE(a, b) ((a) < (b)? -1: ((a) > (b)? 1: 0))
+#define ESCH_SORT_FLOAT_SIGN ((uint64_t)1 << 63)
+#define ESCH_SORT_INT_SIGN ((uint32_t)1 << 31)
+
+/* =================================================================
+ * Built-in order
+ * ================================================================= */
+
+/*
+ * Map a double to an unsigned key, which keeps the order of doubles
+ * when compared as unsigned integer. Negative values are flipped.
+ */
+static uint64_t
+esch_sort_float_to_key(double f)
+{
+    uint64_t bits = 0;
+    memcpy(&bits, &f, sizeof(bits));
+    return ((bits & ESCH_SORT_FLOAT_SIGN)?
+            ~bits: (bits | ESCH_SORT_FLOAT_SIGN));
+}
+
+static double
+esch_sort_key_to_float(uint64_t key)
+{
+    double f = 0.0;
+    uint64_t bits = ((key & ESCH_SORT_FLOAT_SIGN)?
+                     (key & ~ESCH_SORT_FLOAT_SIGN): ~key);
+    memcpy(&f, &bits, sizeof(f));
+    return f;
+}
+
+static int
+esch_sort_compare_nothing(esch_value* left, esch_value* right)
+{
+    (void)left;
+    (void)right;
+    return 0;
+}
+static int
+esch_sort_compare_byte(esch_value* left, esch_value* right)
+{
+    return ESCH_SORT_COMPARE(left->val.b, right->val.b);
+}
+static int
+esch_sort_compare_unicode(esch_value* left, esch_value* right)
+{
+    return ESCH_SORT_COMPARE(left->val.u, right->val.u);
+}
+static int
+esch_sort_compare_integer(esch_value* left, esch_value* right)
+{
+    return ESCH_SORT_COMPARE(left->val.i, right->val.i);
+}
+static int
+esch_sort_compare_float(esch_value* left, esch_value* right)
+{
+    uint64_t left_key = esch_sort_float_to_key(left->val.f);
+    uint64_t right_key = esch_sort_float_to_key(right->val.f);
+    return ESCH_SORT_COMPARE(left_key, right_key);
+}
+static int
+esch_sort_compare_object(esch_value* left, esch_value* right)
+{
+    return ESCH_SORT_COMPARE((size_t)left->val.o, (size_t)right->val.o);
+}
+
+/* NOTE: Use function table instead of if-type check to avoid runtime
+ * cost. */
+static esch_value_compare_f esch_sort_compare_same_type[8] = {
+    esch_sort_compare_nothing, /* ESCH_VALUE_TYPE_UNKNOWN */
+    esch_sort_compare_byte, /* ESCH_VALUE_TYPE_BYTE */
+    esch_sort_compare_unicode, /* ESCH_VALUE_TYPE_UNICODE */
+    esch_sort_compare_integer, /* ESCH_VALUE_TYPE_INTEGER */
+    esch_sort_compare_float, /* ESCH_VALUE_TYPE_FLOAT */
+    esch_sort_compare_object, /* ESCH_VALUE_TYPE_OBJECT */
+    esch_sort_compare_nothing, /* ESCH_VALUE_TYPE_NIL */
+    esch_sort_compare_nothing, /* ESCH_VALUE_TYPE_END */
+};
+
+/*
+ * The built-in order: order by type, then by value.
+ */
+static int
+esch_sort_compare_default(esch_value* left, esch_value* right)
+{
+    if (left->type != right->type)
+    {
+        return ESCH_SORT_COMPARE(left->type, right->type);
+    }
+    return esch_sort_compare_same_type[left->type](left, right);
+}
+
+/* =================================================================
+ * Radix sort
+ * ================================================================= */
+
+/*
+ * Define an LSD radix sort on unsigned keys, 8 bits per pass. All
+ * histograms are collected with one scan. A pass is skipped when all
+ * keys share the same digit, which is common for small integers.
+ * Result is always written back to keys.
+ */
+#define ESCH_SORT_DEF_RADIX(suffix, kt) \
+static void \
+esch_sort_radix_##suffix(kt* keys, kt* buffer, size_t n) \
+{ \
+    size_t count[sizeof(kt)][256]; \
+    size_t pass = 0; \
+    size_t i = 0; \
+    size_t sum = 0; \
+    size_t c = 0; \
+    size_t shift = 0; \
+    kt* src = keys; \
+    kt* dst = buffer; \
+    kt* tmp = NULL; \
+    memset(count, 0, sizeof(count)); \
+    for (i = 0; i < n; ++i) { \
+        for (pass = 0; pass < sizeof(kt); ++pass) { \
+            ++count[pass][(src[i] >> (pass << 3)) & 0xFF]; \
+        } \
+    } \
+    for (pass = 0; pass < sizeof(kt); ++pass) { \
+        shift = (pass << 3); \
+        if (count[pass][(src[0] >> shift) & 0xFF] == n) { \
+            continue; \
+        } \
+        for (sum = 0, i = 0; i < 256; ++i) { \
+            c = count[pass][i]; \
+            count[pass][i] = sum; \
+            sum += c; \
+        } \
+        for (i = 0; i < n; ++i) { \
+            dst[count[pass][(src[i] >> shift) & 0xFF]++] = src[i]; \
+        } \
+        tmp = src; \
+        src = dst; \
+        dst = tmp; \
+    } \
+    if (src != keys) { \
+        memcpy(keys, src, sizeof(kt) * n); \
+    } \
+}
+
+ESCH_SORT_DEF_RADIX(u32, uint32_t)
+ESCH_SORT_DEF_RADIX(u64, uint64_t)
+
+typedef esch_error (*esch_sort_radix_f)(esch_value*, size_t,
+                                         esch_alloc*, esch_log*);
+
+static esch_error
+esch_sort_radix_byte(esch_value* base, size_t n,
+                     esch_alloc* alloc, esch_log* log)
+{
+    /* Byte has only 256 values: counting sort, no buffer needed. */
+    size_t count[256];
+    size_t i = 0;
+    size_t c = 0;
+    esch_value* slot = base;
+
+    (void)alloc;
+    (void)log;
+    memset(count, 0, sizeof(count));
+    for (i = 0; i < n; ++i) {
+        ++count[base[i].val.b];
+    }
+    for (i = 0; i < 256; ++i) {
+        for (c = count[i]; c > 0; --c, ++slot) {
+            slot->val.b = (esch_byte)i;
+        }
+    }
+    return ESCH_OK;
+}
+
+/*
+ * Define a radix sort for 32-bit signed values. Flipping sign bit maps
+ * signed order to unsigned order.
+ */
+#define ESCH_SORT_DEF_RADIX_32(suffix, field) \
+static esch_error \
+esch_sort_radix_##suffix(esch_value* base, size_t n, \
+                         esch_alloc* alloc, esch_log* log) \
+{ \
+    esch_error ret = ESCH_OK; \
+    uint32_t* keys = NULL; \
+    size_t i = 0; \
+    ESCH_ASSERT(sizeof(base[0].val. field) == sizeof(uint32_t)); \
+    ret = esch_alloc_realloc(alloc, NULL, sizeof(uint32_t) * n * 2, \
+                             (void**)&keys); \
+    ESCH_CHECK(ret == ESCH_OK, log, "vec:sort:Can't allocate keys", ret); \
+    for (i = 0; i < n; ++i) { \
+        keys[i] = ((uint32_t)base[i].val. field) ^ \
+                  ESCH_SORT_INT_SIGN; \
+    } \
+    esch_sort_radix_u32(keys, keys + n, n); \
+    for (i = 0; i < n; ++i) { \
+        base[i].val. field = \
+            (int32_t)(keys[i] ^ ESCH_SORT_INT_SIGN); \
+    } \
+Exit: \
+    (void)esch_alloc_free(alloc, keys); \
+    return ret; \
+}
+
+ESCH_SORT_DEF_RADIX_32(unicode, u)
+ESCH_SORT_DEF_RADIX_32(integer, i)
+
+static esch_error
+esch_sort_radix_float(esch_value* base, size_t n,
+                      esch_alloc* alloc, esch_log* log)
+{
+    esch_error ret = ESCH_OK;
+    uint64_t* keys = NULL;
+    size_t i = 0;
+
+    ret = esch_alloc_realloc(alloc, NULL, sizeof(uint64_t) * n * 2,
+                             (void**)&keys);
+    ESCH_CHECK(ret == ESCH_OK, log, "vec:sort:Can't allocate keys", ret);
+    for (i = 0; i < n; ++i) {
+        keys[i] = esch_sort_float_to_key(base[i].val.f);
+    }
+    esch_sort_radix_u64(keys, keys + n, n);
+    for (i = 0; i < n; ++i) {
+        base[i].val.f = esch_sort_key_to_float(keys[i]);
+    }
+Exit:
+    (void)esch_alloc_free(alloc, keys);
+    return ret;
+}
+
+/* Radix sort for homogeneous vector. NULL = not supported. */
+static esch_sort_radix_f esch_sort_radix[8] = {
+    NULL, /* ESCH_VALUE_TYPE_UNKNOWN */
+    esch_sort_radix_byte, /* ESCH_VALUE_TYPE_BYTE */
+    esch_sort_radix_unicode, /* ESCH_VALUE_TYPE_UNICODE */
+    esch_sort_radix_integer, /* ESCH_VALUE_TYPE_INTEGER */
+    esch_sort_radix_float, /* ESCH_VALUE_TYPE_FLOAT */
+    NULL, /* ESCH_VALUE_TYPE_OBJECT */
+    NULL, /* ESCH_VALUE_TYPE_NIL */
+    NULL, /* ESCH_VALUE_TYPE_END */
+};
+
+/* =================================================================
+ * Merge sort
+ * ================================================================= */
+static void
+esch_sort_insertion(esch_value* base, size_t n,
+                    esch_value_compare_f compare)
+{
+    size_t i = 0;
+    size_t j = 0;
+    esch_value value;
+    for (i = 1; i < n; ++i) {
+        value = base[i];
+        for (j = i; j > 0 && compare(&(base[j - 1]), &value) > 0; --j) {
+            base[j] = base[j - 1];
+        }
+        base[j] = value;
+    }
+}
+
+/*
+ * Merge two sorted arrays into out. Elements from left win ties, so
+ * merge is stable.
+ */
+static void
+esch_sort_merge(esch_value* left, size_t left_len,
+                esch_value* right, size_t right_len,
+                esch_value* out, esch_value_compare_f compare)
+{
+    size_t i = 0;
+    size_t j = 0;
+    while (i < left_len && j < right_len) {
+        if (compare(&(right[j]), &(left[i])) < 0) {
+            (*out++) = right[j++];
+        } else {
+            (*out++) = left[i++];
+        }
+    }
+    if (i < left_len) {
+        memcpy(out, left + i, sizeof(esch_value) * (left_len - i));
+    }
+    if (j < right_len) {
+        memcpy(out, right + j, sizeof(esch_value) * (right_len - j));
+    }
+}
+
+/*
+ * Sort base[0, n) with buffer[0, n) as scratch memory. The result is
+ * always in base.
+ */
+static void
+esch_sort_merge_sort(esch_value* base, esch_value* buffer, size_t n,
+                     esch_value_compare_f compare)
+{
+    size_t width = 0;
+    size_t i = 0;
+    size_t left_len = 0;
+    size_t right_len = 0;
+    esch_value* src = base;
+    esch_value* dst = buffer;
+    esch_value* tmp = NULL;
+
+    for (i = 0; i < n; i += ESCH_SORT_INSERTION_RUN) {
+        esch_sort_insertion(base + i,
+                            ESCH_SORT_MIN(ESCH_SORT_INSERTION_RUN, n - i),
+                            compare);
+    }
+    for (width = ESCH_SORT_INSERTION_RUN; width < n; width <<= 1) {
+        for (i = 0; i < n; i += (width << 1)) {
+            left_len = ESCH_SORT_MIN(width, n - i);
+            right_len = ESCH_SORT_MIN(width, n - i - left_len);
+            esch_sort_merge(src + i, left_len,
+                            src + i + left_len, right_len,
+                            dst + i, compare);
+        }
+        tmp = src;
+        src = dst;
+        dst = tmp;
+    }
+    if (src != base) {
+        memcpy(base, src, sizeof(esch_value) * n);
+    }
+}
+
+/*
+ * Merge path partition: find how many elements of left are within the
+ * first k elements of merged output. It's a binary search on the
+ * diagonal k of merge matrix, honoring the stable order.
+ */
+static size_t
+esch_sort_merge_path(esch_value* left, size_t left_len,
+                     esch_value* right, size_t right_len,
+                     size_t k, esch_value_compare_f compare)
+{
+    size_t low = (k > right_len? k - right_len: 0);
+    size_t high = ESCH_SORT_MIN(k, left_len);
+    size_t mid = 0;
+    while (low < high) {
+        mid = low + ((high - low) >> 1);
+        if (compare(&(left[mid]), &(right[k - mid - 1])) <= 0) {
+            low = mid + 1;
+        } else {
+            high = mid;
+        }
+    }
+    return low;
+}
+
+/*
+ * A unit of work executed by one thread. A sort task sorts left with
+ * out as buffer. A merge task produces out[begin, end) of merged
+ * output of left and right.
+ */
+struct esch_sort_task
+{
+    void (*run)(struct esch_sort_task*);
+    esch_value* left;
+    size_t left_len;
+    esch_value* right;
+    size_t right_len;
+    esch_value* out;
+    size_t begin;
+    size_t end;
+    esch_value_compare_f compare;
+};
+
+/*
+ * Workers of one parallel sort. They are started once and kept for
+ * all passes: chunk sort, then every merge round. For each pass,
+ * current thread publishes tasks and bumps pass, then workers and
+ * current thread claim tasks one by one, until all are finished.
+ */
+struct esch_sort_pool
+{
+    esch_mutex lock;
+    esch_cond wake;   /* New pass, or stop */
+    esch_cond done;   /* All tasks of current pass finished */
+    struct esch_sort_task* tasks;
+    size_t task_count;
+    size_t next;      /* Next task to claim */
+    size_t finished;
+    size_t pass;
+    esch_bool stop;
+    esch_thread threads[ESCH_SORT_MAX_THREADS];
+    size_t started;
+};
+
+static void
+esch_sort_task_sort(struct esch_sort_task* task)
+{
+    esch_sort_merge_sort(task->left, task->out, task->left_len,
+                         task->compare);
+}
+
+static void
+esch_sort_task_merge(struct esch_sort_task* task)
+{
+    size_t left_begin = 0;
+    size_t left_end = 0;
+    left_begin = esch_sort_merge_path(task->left, task->left_len,
+                                      task->right, task->right_len,
+                                      task->begin, task->compare);
+    left_end = esch_sort_merge_path(task->left, task->left_len,
+                                    task->right, task->right_len,
+                                    task->end, task->compare);
+    esch_sort_merge(task->left + left_begin, left_end - left_begin,
+                    task->right + (task->begin - left_begin),
+                    (task->end - left_end) - (task->begin - left_begin),
+                    task->out + task->begin, task->compare);
+}
+
+/*
+ * Claim and run tasks of current pass until none is left. Called with
+ * lock held.
+ */
+static void
+esch_sort_pool_work(struct esch_sort_pool* pool)
+{
+    struct esch_sort_task* task = NULL;
+    while (pool->next < pool->task_count) {
+        task = &(pool->tasks[pool->next]);
+        pool->next += 1;
+        esch_mutex_unlock_i(&(pool->lock));
+        task->run(task);
+        esch_mutex_lock_i(&(pool->lock));
+        pool->finished += 1;
+        if (pool->finished == pool->task_count) {
+            esch_cond_broadcast_i(&(pool->done));
+        }
+    }
+}
+
+static void
+esch_sort_pool_worker(void* arg)
+{
+    struct esch_sort_pool* pool = (struct esch_sort_pool*)arg;
+    size_t seen = 0;
+    esch_mutex_lock_i(&(pool->lock));
+    while (ESCH_TRUE) {
+        while (pool->pass == seen && !pool->stop) {
+            esch_cond_wait_i(&(pool->wake), &(pool->lock));
+        }
+        if (pool->stop) {
+            break;
+        }
+        seen = pool->pass;
+        esch_sort_pool_work(pool);
+    }
+    esch_mutex_unlock_i(&(pool->lock));
+}
+
+/*
+ * Start (threads - 1) workers, current thread is the last one. If a
+ * thread can't be started, the pool just has fewer workers.
+ */
+static esch_error
+esch_sort_pool_start(esch_log* log, struct esch_sort_pool* pool,
+                     size_t threads)
+{
+    esch_error ret = ESCH_OK;
+    size_t i = 0;
+
+    pool->tasks = NULL;
+    pool->task_count = 0;
+    pool->next = 0;
+    pool->finished = 0;
+    pool->pass = 0;
+    pool->stop = ESCH_FALSE;
+    pool->started = 0;
+    ret = esch_mutex_init_i(&(pool->lock));
+    if (ret != ESCH_OK) {
+        return ret;
+    }
+    ret = esch_cond_init_i(&(pool->wake));
+    if (ret != ESCH_OK) {
+        esch_mutex_destroy_i(&(pool->lock));
+        return ret;
+    }
+    ret = esch_cond_init_i(&(pool->done));
+    if (ret != ESCH_OK) {
+        esch_cond_destroy_i(&(pool->wake));
+        esch_mutex_destroy_i(&(pool->lock));
+        return ret;
+    }
+    for (i = 1; i < threads; ++i) {
+        ret = esch_thread_start_i(&(pool->threads[pool->started]),
+                                  esch_sort_pool_worker, pool);
+        if (ret != ESCH_OK) {
+            ESCH_LOG_WARN_1(log, "vec:sort:Can't start thread %d", (int)i);
+            break;
+        }
+        pool->started += 1;
+    }
+    return ESCH_OK;
+}
+
+static void
+esch_sort_pool_stop(struct esch_sort_pool* pool)
+{
+    size_t i = 0;
+    esch_mutex_lock_i(&(pool->lock));
+    pool->stop = ESCH_TRUE;
+    esch_cond_broadcast_i(&(pool->wake));
+    esch_mutex_unlock_i(&(pool->lock));
+    for (i = 0; i < pool->started; ++i) {
+        (void)esch_thread_join_i(&(pool->threads[i]));
+    }
+    esch_cond_destroy_i(&(pool->done));
+    esch_cond_destroy_i(&(pool->wake));
+    esch_mutex_destroy_i(&(pool->lock));
+}
+
+/*
+ * Run one pass on pool, and return when all its tasks are finished.
+ */
+static void
+esch_sort_pool_run(struct esch_sort_pool* pool,
+                   struct esch_sort_task* tasks, size_t task_count)
+{
+    esch_mutex_lock_i(&(pool->lock));
+    pool->tasks = tasks;
+    pool->task_count = task_count;
+    pool->next = 0;
+    pool->finished = 0;
+    pool->pass += 1;
+    esch_cond_broadcast_i(&(pool->wake));
+    esch_sort_pool_work(pool);
+    while (pool->finished < pool->task_count) {
+        esch_cond_wait_i(&(pool->done), &(pool->lock));
+    }
+    esch_mutex_unlock_i(&(pool->lock));
+}
+
+static esch_error
+esch_sort_parallel_merge_sort(esch_log* log,
+                              esch_value* base, esch_value* buffer,
+                              size_t n, size_t threads,
+                              esch_value_compare_f compare)
+{
+    esch_error ret = ESCH_OK;
+    struct esch_sort_task tasks[ESCH_SORT_MAX_THREADS];
+    struct esch_sort_pool pool;
+    size_t bounds[ESCH_SORT_MAX_THREADS + 1];
+    size_t chunks = threads;
+    size_t pairs = 0;
+    size_t parts = 0;
+    size_t task_count = 0;
+    size_t total = 0;
+    size_t left_begin = 0;
+    size_t middle = 0;
+    size_t right_end = 0;
+    size_t i = 0;
+    size_t j = 0;
+    esch_value* src = base;
+    esch_value* dst = buffer;
+    esch_value* tmp = NULL;
+
+    ESCH_ASSERT(threads > 1 && threads <= ESCH_SORT_MAX_THREADS);
+    ret = esch_sort_pool_start(log, &pool, threads);
+    if (ret != ESCH_OK) {
+        return ret;
+    }
+    /* Step 1: Sort chunks independently. */
+    for (i = 0; i < chunks; ++i) {
+        bounds[i] = n / chunks * i;
+    }
+    bounds[chunks] = n;
+    for (i = 0; i < chunks; ++i) {
+        tasks[i].run = esch_sort_task_sort;
+        tasks[i].left = base + bounds[i];
+        tasks[i].left_len = bounds[i + 1] - bounds[i];
+        tasks[i].out = buffer + bounds[i];
+        tasks[i].compare = compare;
+    }
+    esch_sort_pool_run(&pool, tasks, chunks);
+
+    /* Step 2: Merge chunks pair by pair, until one chunk is left.
+     * Every merge is split into parts so each thread gets one part. */
+    while (chunks > 1) {
+        pairs = (chunks + 1) >> 1;
+        parts = threads / pairs;
+        task_count = 0;
+        for (i = 0; i < pairs; ++i) {
+            left_begin = bounds[i << 1];
+            middle = bounds[ESCH_SORT_MIN((i << 1) + 1, chunks)];
+            right_end = bounds[ESCH_SORT_MIN((i << 1) + 2, chunks)];
+            total = right_end - left_begin;
+            for (j = 0; j < parts; ++j, ++task_count) {
+                tasks[task_count].run = esch_sort_task_merge;
+                tasks[task_count].left = src + left_begin;
+                tasks[task_count].left_len = middle - left_begin;
+                tasks[task_count].right = src + middle;
+                tasks[task_count].right_len = right_end - middle;
+                tasks[task_count].out = dst + left_begin;
+                tasks[task_count].begin = total / parts * j;
+                tasks[task_count].end = (j + 1 == parts?
+                                         total: total / parts * (j + 1));
+                tasks[task_count].compare = compare;
+            }
+            bounds[i] = left_begin;
+        }
+        bounds[pairs] = n;
+        chunks = pairs;
+        esch_sort_pool_run(&pool, tasks, task_count);
+        tmp = src;
+        src = dst;
+        dst = tmp;
+    }
+    esch_sort_pool_stop(&pool);
+    if (src != base) {
+        memcpy(base, src, sizeof(esch_value) * n);
+    }
+    return ESCH_OK;
+}
+
+/* =================================================================
+ * Public interfaces
+ * ================================================================= */
+static esch_error
+esch_vector_sort_i(esch_vector* vec, esch_value_compare_f compare)
+{
+    esch_error ret = ESCH_OK;
+    esch_alloc* alloc = NULL;
+    esch_log* log = NULL;
+    esch_value* base = NULL;
+    esch_value* buffer = NULL;
+    esch_value_type first_type = ESCH_VALUE_TYPE_UNKNOWN;
+    size_t n = 0;
+    size_t i = 0;
+    size_t threads = 0;
+
+    ESCH_CHECK_PARAM_INTERNAL(vec != NULL);
+    ESCH_CHECK_PARAM_INTERNAL(ESCH_IS_VALID_VECTOR(vec));
+    alloc = ESCH_OBJECT_GET_ALLOC(ESCH_CAST_TO_OBJECT(vec));
+    log = ESCH_OBJECT_GET_LOG(ESCH_CAST_TO_OBJECT(vec));
+
+    n = vec->length;
+    if (n < 2) {
+        goto Exit;
+    }
+    if (vec->layout == ESCH_VECTOR_LAYOUT_MIXED) {
+        base = vec->begin;
+    } else {
+        ret = esch_alloc_realloc(alloc, NULL, sizeof(esch_value) * n,
+                                 (void**)&base);
+        ESCH_CHECK(ret == ESCH_OK, log,
+                   "vec:sort:Can't allocate values", ret);
+        for (i = 0; i < n; ++i) {
+            esch_vector_read_i(vec, i, &(base[i]));
+        }
+    }
+    if (compare == NULL) {
+        first_type = base[0].type;
+        for (i = 1; i < n && base[i].type == first_type; ++i) {
+            /* Check if all elements are in same type. */
+        }
+        if (i == n && esch_sort_radix[first_type] != NULL) {
+            ret = esch_sort_radix[first_type](base, n, alloc, log);
+            goto Done;
+        }
+        compare = esch_sort_compare_default;
+    }
+
+    ret = esch_alloc_realloc(alloc, NULL, sizeof(esch_value) * n,
+                             (void**)&buffer);
+    ESCH_CHECK(ret == ESCH_OK, log, "vec:sort:Can't allocate buffer", ret);
+
+    threads = (size_t)vec->sort_threads;
+    if (threads > ESCH_SORT_MAX_THREADS) {
+        threads = ESCH_SORT_MAX_THREADS;
+    }
+    if (threads > 1 && n >= ESCH_VECTOR_PARALLEL_SORT_THRESHOLD) {
+        ESCH_LOG_INFO_1(log, "vec:sort:Parallel sort: %d threads",
+                        (int)threads);
+        ret = esch_sort_parallel_merge_sort(log, base, buffer,
+                                            n, threads, compare);
+        if (ret != ESCH_OK) {
+            ESCH_LOG_WARN(log, "vec:sort:No thread pool, sort on one thread.");
+            esch_sort_merge_sort(base, buffer, n, compare);
+            ret = ESCH_OK;
+        }
+    } else {
+        esch_sort_merge_sort(base, buffer, n, compare);
+    }
+Done:
+    if (ret == ESCH_OK && base != vec->begin) {
+        for (i = 0; i < n; ++i) {
+            esch_vector_write_i(vec, i, &(base[i]));
+        }
+    }
+Exit:
+    if (buffer != NULL) {
+        (void)esch_alloc_free(alloc, buffer);
+    }
+    if (base != NULL && base != vec->begin) {
+        (void)esch_alloc_free(alloc, base);
+    }
+    return ret;
+}
+
+esch_error
+esch_vector_sort(esch_vector* vec, esch_value_compare_f compare)
+{
+    esch_error ret = ESCH_OK;
+
+    ESCH_CHECK_PARAM_PUBLIC(vec != NULL);
+    ESCH_CHECK_PARAM_PUBLIC(ESCH_IS_VALID_VECTOR(vec));
+
+    ret = esch_vector_sort_i(vec, compare);
+Exit:
+    return ret;
+}
+
+esch_error
+esch_vector_binary_search(esch_vector* vec, esch_value* key,
+                          esch_value_compare_f compare, int* index)
+{
+    esch_error ret = ESCH_OK;
+    size_t low = 0;
+    size_t high = 0;
+    size_t mid = 0;
+    esch_value element;
+
+    ESCH_CHECK_PARAM_PUBLIC(vec != NULL);
+    ESCH_CHECK_PARAM_PUBLIC(key != NULL);
+    ESCH_CHECK_PARAM_PUBLIC(index != NULL);
+    ESCH_CHECK_PARAM_PUBLIC(ESCH_IS_VALID_VECTOR(vec));
+    ESCH_CHECK_PARAM_PUBLIC(key->type > ESCH_VALUE_TYPE_UNKNOWN);
+    ESCH_CHECK_PARAM_PUBLIC(key->type < ESCH_VALUE_TYPE_END);
+
+    if (compare == NULL) {
+        compare = esch_sort_compare_default;
+    }
+    /* Lower bound: first element not less than key. */
+    high = vec->length;
+    while (low < high) {
+        mid = low + ((high - low) >> 1);
+        esch_vector_read_i(vec, mid, &element);
+        if (compare(&element, key) < 0) {
+            low = mid + 1;
+        } else {
+            high = mid;
+        }
+    }
+    (*index) = (int)low;
+    if (low < vec->length) {
+        esch_vector_read_i(vec, low, &element);
+    }
+    if (low == vec->length || compare(&element, key) != 0) {
+        ret = ESCH_ERROR_NOT_FOUND;
+    }
+Exit:
+    return ret;
+}
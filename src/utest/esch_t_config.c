@@ -1,67 +1,134 @@
 /* vim:ft=c expandtab tw=72 sw=4
  */
-#include <esch.h>
 #include <stdio.h>
+#include <string.h>
 #include "esch_utest.h"
 #include "esch_debug.h"
+#include "esch_config.h"
 
-esch_error test_config()
+esch_error test_config(esch_config* config)
 {
     esch_error ret = ESCH_OK;
-    esch_config* config = NULL;
+    esch_config* new_config = NULL;
     esch_alloc* alloc = NULL;
     esch_log* log = NULL;
-    esch_alloc* alloc_get = NULL;
-    esch_log* log_get = NULL;
-    esch_log* do_nothing = NULL;
-    esch_object* unknown = NULL;
+    esch_object* obj = NULL;
+    esch_config_key_id id = ESCH_CONFIG_KEY_ID_PREDEFINED;
+    esch_config_key_id str_id = ESCH_CONFIG_KEY_ID_PREDEFINED;
+    esch_config_key_id ids[40];
+    char name[32];
+    char* str = NULL;
+    int value = 0;
+    int i = 0;
 
-    (void)esch_log_new_do_nothing(&do_nothing);
-#ifdef NDEBUG
-    log = do_nothing;
-#else
-    log = g_testLog;
-#endif
-    
-    ret = esch_config_new(&config);
-    ESCH_TEST_CHECK(ret == ESCH_OK, "Failed to create config", ret);
-
-    ret = esch_config_set_obj(config, ESCH_CONFIG_KEY_LOG,
-                              (esch_object*)log);
-    ESCH_TEST_CHECK(ret == ESCH_OK, "Failed to set log", ret);
-
-    ret = esch_alloc_new_c_default(config, &alloc);
-    ESCH_TEST_CHECK(ret == ESCH_OK, "Failed to create alloc", ret);
+    alloc = ESCH_CAST_FROM_OBJECT(ESCH_CONFIG_GET_ALLOC(config), esch_alloc);
+    log = ESCH_CAST_FROM_OBJECT(ESCH_CONFIG_GET_LOG(config), esch_log);
 
-    ret = esch_config_set_obj(config, ESCH_CONFIG_KEY_ALLOC,
-                              (esch_object*)alloc);
+    esch_log_info(g_testLog, "Case 1: Predefined keys");
+    ret = esch_config_new(log, alloc, &new_config);
+    ESCH_TEST_CHECK(ret == ESCH_OK, "Failed to create config", ret);
+    ret = esch_config_set_obj(new_config, ESCH_CONFIG_KEY_ALLOC,
+                              ESCH_CAST_TO_OBJECT(alloc));
     ESCH_TEST_CHECK(ret == ESCH_OK, "Failed to set alloc", ret);
-
-    ret = esch_config_set_obj(config, ESCH_CONFIG_KEY_LOG,
-                              (esch_object*)log);
-    ESCH_TEST_CHECK(ret == ESCH_OK, "Failed to set log", ret);
-
-    ret = esch_config_get_obj(config, ESCH_CONFIG_KEY_ALLOC,
-                              (esch_object**)&alloc_get);
-    ESCH_TEST_CHECK(ret == ESCH_OK, "Failed to get alloc", ret);
-    ESCH_TEST_CHECK(alloc == alloc_get, "Received bad alloc", ret);
-
-    ret = esch_config_get_obj(config, ESCH_CONFIG_KEY_LOG,
-                              (esch_object**)&log_get);
-    ESCH_TEST_CHECK(ret == ESCH_OK, "Failed to get log", ret);
-    ESCH_TEST_CHECK(log == log_get, "Received bad alloc", ret);
-
-    ret = esch_config_set_obj(config, "nothing:unknown", NULL);
+    ret = esch_config_set_obj_by_id(new_config, ESCH_CONFIG_KEY_ID_LOG,
+                                    ESCH_CAST_TO_OBJECT(log));
+    ESCH_TEST_CHECK(ret == ESCH_OK, "Failed to set log by ID", ret);
+    ret = esch_config_get_obj_by_id(new_config, ESCH_CONFIG_KEY_ID_ALLOC,
+                                    &obj);
+    ESCH_TEST_CHECK(ret == ESCH_OK, "Failed to get alloc by ID", ret);
+    ret = ESCH_ERROR_INVALID_STATE;
+    ESCH_TEST_CHECK(obj == ESCH_CAST_TO_OBJECT(alloc),
+                    "Received bad alloc", ret);
+    ESCH_TEST_CHECK(ESCH_CONFIG_GET_LOG(new_config) ==
+                    ESCH_CAST_TO_OBJECT(log), "Received bad log", ret);
+    ret = esch_config_find_key(new_config, ESCH_CONFIG_KEY_VECTOR_LENGTH,
+                               &id);
+    ESCH_TEST_CHECK(ret == ESCH_OK, "Failed to find key", ret);
+    ret = ESCH_ERROR_INVALID_STATE;
+    ESCH_TEST_CHECK(id == ESCH_CONFIG_KEY_ID_VECTOR_LENGTH,
+                    "Predefined key has bad ID", ret);
+    ret = esch_config_set_int(new_config, ESCH_CONFIG_KEY_VECTOR_LENGTH, 7);
+    ESCH_TEST_CHECK(ret == ESCH_OK, "Failed to set int", ret);
+    ret = ESCH_ERROR_INVALID_STATE;
+    ESCH_TEST_CHECK(ESCH_CONFIG_GET_VECOTR_LENGTH(new_config) == 7,
+                    "Macro does not see new value", ret);
+    ret = esch_config_get_int_by_id(new_config, ESCH_CONFIG_KEY_ID_ALLOC,
+                                    &value);
+    ESCH_TEST_CHECK(ret == ESCH_ERROR_BAD_VALUE_TYPE,
+                    "Unexpected: get object as int", ret);
+    ret = esch_config_set_obj(new_config, "nothing:unknown", NULL);
     ESCH_TEST_CHECK(ret == ESCH_ERROR_NOT_FOUND, "Can't set unknown", ret);
-    ret = esch_config_get_obj(config, "nothing:unknown", &unknown);
+    ret = esch_config_get_obj(new_config, "nothing:unknown", &obj);
     ESCH_TEST_CHECK(ret == ESCH_ERROR_NOT_FOUND, "Can't get unknown", ret);
+    ret = esch_config_get_obj_by_id(new_config,
+                                    ESCH_CONFIG_KEY_ID_PREDEFINED, &obj);
+    ESCH_TEST_CHECK(ret == ESCH_ERROR_NOT_FOUND,
+                    "Unexpected: get ID not in config", ret);
+    ret = ESCH_OK;
+    esch_log_info(g_testLog, "[PASSED] Predefined keys");
 
+    esch_log_info(g_testLog, "Case 2: Add keys");
+    ret = esch_config_add_key(new_config, "test:string",
+                              ESCH_CONFIG_VALUE_TYPE_STRING, &str_id);
+    ESCH_TEST_CHECK(ret == ESCH_OK, "Failed to add key", ret);
+    ret = ESCH_ERROR_INVALID_STATE;
+    ESCH_TEST_CHECK(str_id == ESCH_CONFIG_KEY_ID_PREDEFINED,
+                    "New key has bad ID", ret);
+    strcpy(name, "hello");
+    ret = esch_config_set_str(new_config, "test:string", name);
+    ESCH_TEST_CHECK(ret == ESCH_OK, "Failed to set string", ret);
+    /* Config keeps its own copy. */
+    name[0] = 'j';
+    ret = esch_config_get_str_by_id(new_config, str_id, &str);
+    ESCH_TEST_CHECK(ret == ESCH_OK, "Failed to get string", ret);
+    ret = ESCH_ERROR_INVALID_STATE;
+    ESCH_TEST_CHECK(strcmp(str, "hello") == 0, "Bad string value", ret);
+    ret = esch_config_add_key(new_config, "test:string",
+                              ESCH_CONFIG_VALUE_TYPE_STRING, &id);
+    ESCH_TEST_CHECK(ret == ESCH_OK, "Failed to add same key", ret);
+    ret = ESCH_ERROR_INVALID_STATE;
+    ESCH_TEST_CHECK(id == str_id, "Same key should return same ID", ret);
+    ret = esch_config_add_key(new_config, "test:string",
+                              ESCH_CONFIG_VALUE_TYPE_INTEGER, &id);
+    ESCH_TEST_CHECK(ret == ESCH_ERROR_BAD_VALUE_TYPE,
+                    "Unexpected: add key with another type", ret);
+    ret = ESCH_OK;
+    esch_log_info(g_testLog, "[PASSED] Add keys");
 
-    ret = esch_alloc_delete(alloc);
-    ESCH_TEST_CHECK(ret == ESCH_OK, "Failed to delete log", ret);
-
-    ret = esch_config_delete(config);
-    ESCH_TEST_CHECK(ret == ESCH_OK, "Failed to delete config", ret);
+    esch_log_info(g_testLog, "Case 3: Grow config");
+    for (i = 0; i < 40; ++i)
+    {
+        sprintf(name, "test:int:%d", i);
+        ret = esch_config_add_key(new_config, name,
+                                  ESCH_CONFIG_VALUE_TYPE_INTEGER, &ids[i]);
+        ESCH_TEST_CHECK(ret == ESCH_OK, "Failed to add int key", ret);
+        ret = esch_config_set_int_by_id(new_config, ids[i], i * 3);
+        ESCH_TEST_CHECK(ret == ESCH_OK, "Failed to set int by ID", ret);
+    }
+    for (i = 0; i < 40; ++i)
+    {
+        sprintf(name, "test:int:%d", i);
+        ret = esch_config_find_key(new_config, name, &id);
+        ESCH_TEST_CHECK(ret == ESCH_OK, "Failed to find key", ret);
+        ret = esch_config_get_int(new_config, name, &value);
+        ESCH_TEST_CHECK(ret == ESCH_OK, "Failed to get int", ret);
+        ret = ESCH_ERROR_INVALID_STATE;
+        ESCH_TEST_CHECK(id == ids[i], "Key ID changed after grow", ret);
+        ESCH_TEST_CHECK(value == i * 3, "Bad int value after grow", ret);
+    }
+    ret = esch_config_get_str_by_id(new_config, str_id, &str);
+    ESCH_TEST_CHECK(ret == ESCH_OK, "Failed to get string", ret);
+    ret = ESCH_ERROR_INVALID_STATE;
+    ESCH_TEST_CHECK(strcmp(str, "hello") == 0,
+                    "Bad string value after grow", ret);
+    ESCH_TEST_CHECK(ESCH_CONFIG_GET_ALLOC(new_config) ==
+                    ESCH_CAST_TO_OBJECT(alloc), "Bad alloc after grow", ret);
+    ret = ESCH_OK;
+    esch_log_info(g_testLog, "[PASSED] Grow config");
 Exit:
+    if (new_config != NULL)
+    {
+        (void)esch_object_delete(ESCH_CAST_TO_OBJECT(new_config));
+    }
     return ret;
 }
@@ -0,0 +1,431 @@
+#include <stdio.h>
+#include <string.h>
+#include "esch_utest.h"
+#include "esch_debug.h"
+#include "esch_hashtable.h"
+#include "esch_symbol.h"
+#include "esch_string.h"
+#include "esch_vector.h"
+#include "esch_gc.h"
+#include "esch_config.h"
+
+#define LONG_LEFT "0123456789012345678901234567890123456789"
+#define LONG_RIGHT "abcdefghijabcdefghijabcdefghijabcdefghij"
+
+static esch_value
+make_value(esch_value_type type, esch_object* obj, int i)
+{
+    esch_value value;
+    value.type = type;
+    value.val.o = NULL;
+    if (type == ESCH_VALUE_TYPE_OBJECT) {
+        value.val.o = obj;
+    } else {
+        value.val.i = i;
+    }
+    return value;
+}
+
+/* Find key in table, and check its value if found. */
+static esch_bool
+has_key(esch_hashtable* table, esch_value key, int expected)
+{
+    esch_value value;
+    esch_error ret = esch_hashtable_ref(table, &key, &value);
+    return (ret == ESCH_OK &&
+            (expected < 0 ||
+             (value.type == ESCH_VALUE_TYPE_INTEGER &&
+              value.val.i == expected)));
+}
+
+static esch_error
+test_hashtableBase(esch_config* config)
+{
+    esch_error ret = ESCH_OK;
+    esch_hashtable* table = NULL;
+    esch_value key;
+    esch_value value;
+    size_t count = 0;
+    esch_bool moving = ESCH_FALSE;
+    int i = 0;
+
+    esch_log_info(g_testLog, "Case 1: Set, ref and delete.");
+    ret = esch_hashtable_new(config, ESCH_HASHTABLE_EQ, &table);
+    ESCH_TEST_CHECK(ret == ESCH_OK && table != NULL,
+                    "Failed to create hashtable", ret);
+    key = make_value(ESCH_VALUE_TYPE_INTEGER, NULL, 42);
+    value = make_value(ESCH_VALUE_TYPE_INTEGER, NULL, 1);
+    ret = esch_hashtable_set(table, &key, &value);
+    ESCH_TEST_CHECK(ret == ESCH_OK, "Failed to set key", ret);
+    key.type = ESCH_VALUE_TYPE_FLOAT;
+    key.val.f = 0.5;
+    value.val.i = 2;
+    ret = esch_hashtable_set(table, &key, &value);
+    ESCH_TEST_CHECK(ret == ESCH_OK, "Failed to set float key", ret);
+    key.type = ESCH_VALUE_TYPE_UNICODE;
+    key.val.u = 42;
+    value.val.i = 3;
+    ret = esch_hashtable_set(table, &key, &value);
+    ESCH_TEST_CHECK(ret == ESCH_OK, "Failed to set char key", ret);
+    key = make_value(ESCH_VALUE_TYPE_NIL, NULL, 0);
+    value.val.i = 4;
+    ret = esch_hashtable_set(table, &key, &value);
+    ESCH_TEST_CHECK(ret == ESCH_OK, "Failed to set nil key", ret);
+    /* Replace value. */
+    key = make_value(ESCH_VALUE_TYPE_INTEGER, NULL, 42);
+    value.val.i = 5;
+    ret = esch_hashtable_set(table, &key, &value);
+    ESCH_TEST_CHECK(ret == ESCH_OK, "Failed to replace value", ret);
+    ret = esch_hashtable_get_count(table, &count);
+    ESCH_TEST_CHECK(ret == ESCH_OK && count == 4, "Bad key count", ret);
+
+    ret = ESCH_ERROR_INVALID_STATE;
+    ESCH_TEST_CHECK(has_key(table, key, 5), "Can't find integer key", ret);
+    key.type = ESCH_VALUE_TYPE_UNICODE;
+    ESCH_TEST_CHECK(has_key(table, key, 3), "Can't find char key", ret);
+    key = make_value(ESCH_VALUE_TYPE_NIL, NULL, 0);
+    ESCH_TEST_CHECK(has_key(table, key, 4), "Can't find nil key", ret);
+    key.type = ESCH_VALUE_TYPE_FLOAT;
+    key.val.f = 0.5;
+    ESCH_TEST_CHECK(has_key(table, key, 2), "Can't find float key", ret);
+    key = make_value(ESCH_VALUE_TYPE_INTEGER, NULL, 43);
+    ESCH_TEST_CHECK(!has_key(table, key, -1), "Unexpected key", ret);
+
+    key = make_value(ESCH_VALUE_TYPE_UNICODE, NULL, 42);
+    ret = esch_hashtable_delete(table, &key);
+    ESCH_TEST_CHECK(ret == ESCH_OK, "Failed to delete key", ret);
+    ret = esch_hashtable_delete(table, &key);
+    ESCH_TEST_CHECK(ret == ESCH_ERROR_NOT_FOUND,
+                    "Unexpected: delete key twice", ret);
+    ret = esch_hashtable_ref(table, &key, &value);
+    ESCH_TEST_CHECK(ret == ESCH_ERROR_NOT_FOUND,
+                    "Deleted key is still in table", ret);
+    key = make_value(ESCH_VALUE_TYPE_END, NULL, 0);
+    ret = esch_hashtable_set(table, &key, &value);
+    ESCH_TEST_CHECK(ret == ESCH_ERROR_INVALID_PARAMETER,
+                    "Unexpected: set END key", ret);
+    ret = esch_hashtable_get_count(table, &count);
+    ESCH_TEST_CHECK(ret == ESCH_OK && count == 3,
+                    "Bad key count after delete", ret);
+    ret = esch_object_delete(ESCH_CAST_TO_OBJECT(table));
+    ESCH_TEST_CHECK(ret == ESCH_OK, "Failed to delete table", ret);
+    table = NULL;
+    esch_log_info(g_testLog, "[PASSED] Set, ref and delete.");
+
+    esch_log_info(g_testLog, "Case 2: Grow incrementally.");
+    ret = esch_hashtable_new(config, ESCH_HASHTABLE_EQ, &table);
+    ESCH_TEST_CHECK(ret == ESCH_OK, "Failed to create hashtable", ret);
+    for (i = 0; i < 10000; ++i) {
+        key = make_value(ESCH_VALUE_TYPE_INTEGER, NULL, i * 3);
+        value = make_value(ESCH_VALUE_TYPE_INTEGER, NULL, i);
+        ret = esch_hashtable_set(table, &key, &value);
+        ESCH_TEST_CHECK(ret == ESCH_OK, "Failed to set key", ret);
+        if (table->old_entries != NULL) {
+            moving = ESCH_TRUE;
+            /* Old and new tables are both visible while moving. */
+            key = make_value(ESCH_VALUE_TYPE_INTEGER, NULL, 0);
+            ret = ESCH_ERROR_INVALID_STATE;
+            ESCH_TEST_CHECK(has_key(table, key, 0),
+                            "Can't find key while moving", ret);
+            ret = ESCH_OK;
+        }
+    }
+    ret = ESCH_ERROR_INVALID_STATE;
+    ESCH_TEST_CHECK(moving, "Table never moves", ret);
+    for (i = 0; i < 10000; ++i) {
+        key = make_value(ESCH_VALUE_TYPE_INTEGER, NULL, i * 3);
+        ESCH_TEST_CHECK(has_key(table, key, i),
+                        "Can't find key after growing", ret);
+    }
+    /* Delete every other key, which shifts entries back. */
+    for (i = 0; i < 10000; i += 2) {
+        key = make_value(ESCH_VALUE_TYPE_INTEGER, NULL, i * 3);
+        ret = esch_hashtable_delete(table, &key);
+        ESCH_TEST_CHECK(ret == ESCH_OK, "Failed to delete key", ret);
+    }
+    ret = ESCH_ERROR_INVALID_STATE;
+    for (i = 0; i < 10000; ++i) {
+        key = make_value(ESCH_VALUE_TYPE_INTEGER, NULL, i * 3);
+        ESCH_TEST_CHECK((i % 2 == 0) == !has_key(table, key, i),
+                        "Bad key after delete", ret);
+    }
+    ret = esch_hashtable_get_count(table, &count);
+    ESCH_TEST_CHECK(ret == ESCH_OK && count == 5000,
+                    "Bad key count after delete", ret);
+    esch_log_info(g_testLog, "[PASSED] Grow incrementally.");
+Exit:
+    if (table != NULL) {
+        esch_object_delete(ESCH_CAST_TO_OBJECT(table));
+    }
+    return ret;
+}
+
+static esch_error
+test_hashtableEquivalence(esch_config* config, esch_vector* root)
+{
+    esch_error ret = ESCH_OK;
+    esch_hashtable* eq = NULL;
+    esch_hashtable* eqv = NULL;
+    esch_hashtable* equal = NULL;
+    esch_integer* seven = NULL;
+    esch_integer* big1 = NULL;
+    esch_integer* big2 = NULL;
+    esch_fraction* third1 = NULL;
+    esch_fraction* third2 = NULL;
+    esch_string* left = NULL;
+    esch_string* right = NULL;
+    esch_string* rope = NULL;
+    esch_string* flat = NULL;
+    esch_string* view = NULL;
+    esch_pair* list1 = NULL;
+    esch_pair* list2 = NULL;
+    esch_pair* loop1 = NULL;
+    esch_pair* loop2 = NULL;
+    esch_vector* vec1 = NULL;
+    esch_vector* vec2 = NULL;
+    esch_value key;
+    esch_value value;
+    esch_value items[3];
+
+    esch_log_info(g_testLog, "Case 3: eq and eqv on numbers.");
+    ret = esch_hashtable_new(config, ESCH_HASHTABLE_EQ, &eq);
+    ESCH_TEST_CHECK(ret == ESCH_OK, "Failed to create eq table", ret);
+    ret = esch_vector_append_object(root, ESCH_CAST_TO_OBJECT(eq));
+    ret = esch_hashtable_new(config, ESCH_HASHTABLE_EQV, &eqv);
+    ESCH_TEST_CHECK(ret == ESCH_OK, "Failed to create eqv table", ret);
+    ret = esch_vector_append_object(root, ESCH_CAST_TO_OBJECT(eqv));
+    ret = esch_integer_new_from_int(config, 7, &seven);
+    ESCH_TEST_CHECK(ret == ESCH_OK, "Failed to create integer", ret);
+    ret = esch_integer_new_from_base10(config,
+                                       "123456789012345678901234567890",
+                                       NULL, &big1);
+    ESCH_TEST_CHECK(ret == ESCH_OK, "Failed to create integer", ret);
+    ret = esch_integer_new_from_base10(config,
+                                       "123456789012345678901234567890",
+                                       NULL, &big2);
+    ESCH_TEST_CHECK(ret == ESCH_OK, "Failed to create integer", ret);
+    ret = esch_fraction_new_from_int(config, 2, 6, &third1);
+    ESCH_TEST_CHECK(ret == ESCH_OK, "Failed to create fraction", ret);
+    ret = esch_fraction_new_from_int(config, 1, 3, &third2);
+    ESCH_TEST_CHECK(ret == ESCH_OK, "Failed to create fraction", ret);
+    ret = esch_vector_append_object(root, ESCH_CAST_TO_OBJECT(seven));
+    ret = esch_vector_append_object(root, ESCH_CAST_TO_OBJECT(big2));
+    ret = esch_vector_append_object(root, ESCH_CAST_TO_OBJECT(third2));
+
+    value = make_value(ESCH_VALUE_TYPE_INTEGER, NULL, 1);
+    key = make_value(ESCH_VALUE_TYPE_INTEGER, NULL, 7);
+    ret = esch_hashtable_set(eq, &key, &value);
+    ESCH_TEST_CHECK(ret == ESCH_OK, "Failed to set key", ret);
+    ret = esch_hashtable_set(eqv, &key, &value);
+    ESCH_TEST_CHECK(ret == ESCH_OK, "Failed to set key", ret);
+    value.val.i = 2;
+    key = make_value(ESCH_VALUE_TYPE_OBJECT, ESCH_CAST_TO_OBJECT(big1), 0);
+    ret = esch_hashtable_set(eq, &key, &value);
+    ESCH_TEST_CHECK(ret == ESCH_OK, "Failed to set key", ret);
+    ret = esch_hashtable_set(eqv, &key, &value);
+    ESCH_TEST_CHECK(ret == ESCH_OK, "Failed to set key", ret);
+    value.val.i = 3;
+    key = make_value(ESCH_VALUE_TYPE_OBJECT, ESCH_CAST_TO_OBJECT(third1), 0);
+    ret = esch_hashtable_set(eqv, &key, &value);
+    ESCH_TEST_CHECK(ret == ESCH_OK, "Failed to set key", ret);
+    value.val.i = 4;
+    key.type = ESCH_VALUE_TYPE_FLOAT;
+    key.val.f = 0.0;
+    ret = esch_hashtable_set(eqv, &key, &value);
+    ESCH_TEST_CHECK(ret == ESCH_OK, "Failed to set key", ret);
+
+    ret = ESCH_ERROR_INVALID_STATE;
+    /* Integer object holding 7 is same number as fixnum 7. */
+    key = make_value(ESCH_VALUE_TYPE_OBJECT, ESCH_CAST_TO_OBJECT(seven), 0);
+    ESCH_TEST_CHECK(has_key(eqv, key, 1), "eqv: 7 not found", ret);
+    ESCH_TEST_CHECK(!has_key(eq, key, -1), "eq: 7 found", ret);
+    key = make_value(ESCH_VALUE_TYPE_OBJECT, ESCH_CAST_TO_OBJECT(big2), 0);
+    ESCH_TEST_CHECK(has_key(eqv, key, 2), "eqv: big not found", ret);
+    ESCH_TEST_CHECK(!has_key(eq, key, -1), "eq: big found", ret);
+    key = make_value(ESCH_VALUE_TYPE_OBJECT, ESCH_CAST_TO_OBJECT(third2), 0);
+    ESCH_TEST_CHECK(has_key(eqv, key, 3), "eqv: 1/3 not found", ret);
+    key.type = ESCH_VALUE_TYPE_FLOAT;
+    key.val.f = -0.0;
+    ESCH_TEST_CHECK(!has_key(eqv, key, -1), "eqv: -0.0 found", ret);
+    key.val.f = 0.0;
+    ESCH_TEST_CHECK(has_key(eqv, key, 4), "eqv: 0.0 not found", ret);
+    /* Exact 7 and inexact 7.0 are different. */
+    key.val.f = 7.0;
+    ESCH_TEST_CHECK(!has_key(eqv, key, -1), "eqv: 7.0 found", ret);
+    ret = ESCH_OK;
+    esch_log_info(g_testLog, "[PASSED] eq and eqv on numbers.");
+
+    esch_log_info(g_testLog, "Case 4: equal on strings, lists, vectors.");
+    ret = esch_hashtable_new(config, ESCH_HASHTABLE_EQUAL, &equal);
+    ESCH_TEST_CHECK(ret == ESCH_OK, "Failed to create equal table", ret);
+    ret = esch_vector_append_object(root, ESCH_CAST_TO_OBJECT(equal));
+    ret = esch_string_new_from_utf8(config, LONG_LEFT, 0, -1, &left);
+    ESCH_TEST_CHECK(ret == ESCH_OK, "Failed to create string", ret);
+    ret = esch_string_new_from_utf8(config, LONG_RIGHT, 0, -1, &right);
+    ESCH_TEST_CHECK(ret == ESCH_OK, "Failed to create string", ret);
+    ret = esch_string_concat(config, left, right, &rope);
+    ESCH_TEST_CHECK(ret == ESCH_OK && rope->rope != NULL,
+                    "Failed to create rope", ret);
+    ret = esch_string_new_from_utf8(config, LONG_LEFT LONG_RIGHT, 0, -1,
+                                    &flat);
+    ESCH_TEST_CHECK(ret == ESCH_OK, "Failed to create string", ret);
+    ret = esch_string_substring(config, flat, 0, 40, &view);
+    ESCH_TEST_CHECK(ret == ESCH_OK, "Failed to create view", ret);
+    ret = esch_vector_append_object(root, ESCH_CAST_TO_OBJECT(left));
+    ret = esch_vector_append_object(root, ESCH_CAST_TO_OBJECT(flat));
+    ret = esch_vector_append_object(root, ESCH_CAST_TO_OBJECT(view));
+
+    value.val.i = 1;
+    key = make_value(ESCH_VALUE_TYPE_OBJECT, ESCH_CAST_TO_OBJECT(rope), 0);
+    ret = esch_hashtable_set(equal, &key, &value);
+    ESCH_TEST_CHECK(ret == ESCH_OK, "Failed to set rope key", ret);
+    ret = esch_hashtable_set(eqv, &key, &value);
+    ESCH_TEST_CHECK(ret == ESCH_OK, "Failed to set rope key", ret);
+    value.val.i = 2;
+    key = make_value(ESCH_VALUE_TYPE_OBJECT, ESCH_CAST_TO_OBJECT(left), 0);
+    ret = esch_hashtable_set(equal, &key, &value);
+    ESCH_TEST_CHECK(ret == ESCH_OK, "Failed to set string key", ret);
+
+    items[0] = make_value(ESCH_VALUE_TYPE_INTEGER, NULL, 1);
+    items[1] = make_value(ESCH_VALUE_TYPE_OBJECT,
+                          ESCH_CAST_TO_OBJECT(flat), 0);
+    items[2] = make_value(ESCH_VALUE_TYPE_OBJECT,
+                          ESCH_CAST_TO_OBJECT(big1), 0);
+    ret = esch_pair_list_from_values(config, items, 3, &list1);
+    ESCH_TEST_CHECK(ret == ESCH_OK, "Failed to create list", ret);
+    items[1] = make_value(ESCH_VALUE_TYPE_OBJECT,
+                          ESCH_CAST_TO_OBJECT(rope), 0);
+    items[2] = make_value(ESCH_VALUE_TYPE_OBJECT,
+                          ESCH_CAST_TO_OBJECT(big2), 0);
+    ret = esch_pair_list_from_values(config, items, 3, &list2);
+    ESCH_TEST_CHECK(ret == ESCH_OK, "Failed to create list", ret);
+    ret = esch_vector_append_object(root, ESCH_CAST_TO_OBJECT(list2));
+    ret = esch_list_to_vector(config, list1, &vec1);
+    ESCH_TEST_CHECK(ret == ESCH_OK, "Failed to create vector", ret);
+    ret = esch_list_to_vector(config, list2, &vec2);
+    ESCH_TEST_CHECK(ret == ESCH_OK, "Failed to create vector", ret);
+    ret = esch_vector_append_object(root, ESCH_CAST_TO_OBJECT(vec2));
+    value.val.i = 3;
+    key = make_value(ESCH_VALUE_TYPE_OBJECT, ESCH_CAST_TO_OBJECT(list1), 0);
+    ret = esch_hashtable_set(equal, &key, &value);
+    ESCH_TEST_CHECK(ret == ESCH_OK, "Failed to set list key", ret);
+    value.val.i = 4;
+    key = make_value(ESCH_VALUE_TYPE_OBJECT, ESCH_CAST_TO_OBJECT(vec1), 0);
+    ret = esch_hashtable_set(equal, &key, &value);
+    ESCH_TEST_CHECK(ret == ESCH_OK, "Failed to set vector key", ret);
+
+    ret = ESCH_ERROR_INVALID_STATE;
+    key = make_value(ESCH_VALUE_TYPE_OBJECT, ESCH_CAST_TO_OBJECT(flat), 0);
+    ESCH_TEST_CHECK(has_key(equal, key, 1), "equal: flat not found", ret);
+    ESCH_TEST_CHECK(!has_key(eqv, key, -1), "eqv: flat found", ret);
+    key = make_value(ESCH_VALUE_TYPE_OBJECT, ESCH_CAST_TO_OBJECT(view), 0);
+    ESCH_TEST_CHECK(has_key(equal, key, 2), "equal: view not found", ret);
+    key = make_value(ESCH_VALUE_TYPE_OBJECT, ESCH_CAST_TO_OBJECT(list2), 0);
+    ESCH_TEST_CHECK(has_key(equal, key, 3), "equal: list not found", ret);
+    key = make_value(ESCH_VALUE_TYPE_OBJECT, ESCH_CAST_TO_OBJECT(vec2), 0);
+    ESCH_TEST_CHECK(has_key(equal, key, 4), "equal: vector not found", ret);
+
+    /* Circular keys are compared without endless loop. */
+    ret = esch_pair_new(config, &items[0], &items[0], &loop1);
+    ESCH_TEST_CHECK(ret == ESCH_OK, "Failed to create pair", ret);
+    ret = esch_pair_new(config, &items[0], &items[0], &loop2);
+    ESCH_TEST_CHECK(ret == ESCH_OK, "Failed to create pair", ret);
+    ret = esch_vector_append_object(root, ESCH_CAST_TO_OBJECT(loop2));
+    key = make_value(ESCH_VALUE_TYPE_OBJECT, ESCH_CAST_TO_OBJECT(loop1), 0);
+    ret = esch_pair_set_tail(loop1, &key);
+    ESCH_TEST_CHECK(ret == ESCH_OK, "Failed to set tail", ret);
+    value = make_value(ESCH_VALUE_TYPE_OBJECT, ESCH_CAST_TO_OBJECT(loop2), 0);
+    ret = esch_pair_set_tail(loop2, &value);
+    ESCH_TEST_CHECK(ret == ESCH_OK, "Failed to set tail", ret);
+    value = make_value(ESCH_VALUE_TYPE_INTEGER, NULL, 5);
+    ret = esch_hashtable_set(equal, &key, &value);
+    ESCH_TEST_CHECK(ret == ESCH_OK, "Failed to set circular key", ret);
+    ret = ESCH_ERROR_INVALID_STATE;
+    ESCH_TEST_CHECK(has_key(equal, key, 5), "equal: loop not found", ret);
+    key = make_value(ESCH_VALUE_TYPE_OBJECT, ESCH_CAST_TO_OBJECT(loop2), 0);
+    (void)has_key(equal, key, -1);
+    ret = ESCH_OK;
+    esch_log_info(g_testLog, "[PASSED] equal on strings, lists, vectors.");
+Exit:
+    return ret;
+}
+
+esch_error test_hashtable(esch_config* config)
+{
+    esch_error ret = ESCH_OK;
+    esch_vector* root = NULL;
+    esch_gc* gc = NULL;
+    esch_symbol_table* symbols = NULL;
+    esch_symbol* sym = NULL;
+    esch_hashtable* table = NULL;
+    esch_value key;
+    esch_value value;
+    char name[32];
+    int i = 0;
+
+    ret = test_hashtableBase(config);
+    ESCH_TEST_CHECK(ret == ESCH_OK, "test_hashtableBase() failed", ret);
+
+    ret = esch_vector_new(config, &root);
+    ESCH_TEST_CHECK(ret == ESCH_OK, "Failed to create gc root", ret);
+    ret = esch_config_set_obj(config, ESCH_CONFIG_KEY_GC_NAIVE_ROOT,
+                              ESCH_CAST_TO_OBJECT(root));
+    ret = esch_gc_new_naive_mark_sweep(config, &gc);
+    ESCH_TEST_CHECK(ret == ESCH_OK, "Failed to create gc", ret);
+    ret = esch_config_set_obj(config, ESCH_CONFIG_KEY_GC,
+                              ESCH_CAST_TO_OBJECT(gc));
+
+    ret = test_hashtableEquivalence(config, root);
+    ESCH_TEST_CHECK(ret == ESCH_OK, "test_hashtableEquivalence() failed",
+                    ret);
+
+    esch_log_info(g_testLog, "Case 5: GC keeps keys and values.");
+    /* Symbol table is weak, so it tells which symbols are recycled. */
+    ret = esch_symbol_table_new(config, &symbols);
+    ESCH_TEST_CHECK(ret == ESCH_OK, "Failed to create symbol table", ret);
+    ret = esch_vector_append_object(root, ESCH_CAST_TO_OBJECT(symbols));
+    ret = esch_hashtable_new(config, ESCH_HASHTABLE_EQ, &table);
+    ESCH_TEST_CHECK(ret == ESCH_OK, "Failed to create hashtable", ret);
+    ret = esch_vector_append_object(root, ESCH_CAST_TO_OBJECT(table));
+    /* Stop while table is moving, so both tables are traced. */
+    for (i = 0; table->old_entries == NULL || i < 200; ++i) {
+        sprintf(name, "key-%d", i);
+        ret = esch_symbol_table_intern(symbols, name, 0, -1, &sym);
+        ESCH_TEST_CHECK(ret == ESCH_OK, "Failed to intern symbol", ret);
+        key = make_value(ESCH_VALUE_TYPE_OBJECT, ESCH_CAST_TO_OBJECT(sym), 0);
+        sprintf(name, "value-%d", i);
+        ret = esch_symbol_table_intern(symbols, name, 0, -1, &sym);
+        ESCH_TEST_CHECK(ret == ESCH_OK, "Failed to intern symbol", ret);
+        value = make_value(ESCH_VALUE_TYPE_OBJECT,
+                           ESCH_CAST_TO_OBJECT(sym), 0);
+        ret = esch_hashtable_set(table, &key, &value);
+        ESCH_TEST_CHECK(ret == ESCH_OK, "Failed to set key", ret);
+    }
+    ret = esch_symbol_table_intern(symbols, "dropped", 0, -1, &sym);
+    ESCH_TEST_CHECK(ret == ESCH_OK, "Failed to intern symbol", ret);
+
+    ret = esch_gc_recycle(gc);
+    ESCH_TEST_CHECK(ret == ESCH_OK, "Failed to recycle", ret);
+    ret = esch_symbol_table_lookup(symbols, "dropped", 0, -1, &sym);
+    ESCH_TEST_CHECK(ret == ESCH_ERROR_NOT_FOUND,
+                    "Unreachable symbol is not recycled", ret);
+    ret = esch_symbol_table_lookup(symbols, "key-0", 0, -1, &sym);
+    ESCH_TEST_CHECK(ret == ESCH_OK, "Key is recycled", ret);
+    key = make_value(ESCH_VALUE_TYPE_OBJECT, ESCH_CAST_TO_OBJECT(sym), 0);
+    ret = esch_hashtable_ref(table, &key, &value);
+    ESCH_TEST_CHECK(ret == ESCH_OK, "Can't find key after GC", ret);
+    ret = esch_symbol_table_lookup(symbols, "value-0", 0, -1, &sym);
+    ESCH_TEST_CHECK(ret == ESCH_OK && value.val.o == ESCH_CAST_TO_OBJECT(sym),
+                    "Value is recycled", ret);
+    sprintf(name, "value-%d", i - 1);
+    ret = esch_symbol_table_lookup(symbols, name, 0, -1, &sym);
+    ESCH_TEST_CHECK(ret == ESCH_OK, "Last value is recycled", ret);
+    esch_log_info(g_testLog, "[PASSED] GC keeps keys and values.");
+Exit:
+    if (gc != NULL) {
+        esch_object_delete(ESCH_CAST_TO_OBJECT(gc));
+    }
+    (void)esch_config_set_obj(config, ESCH_CONFIG_KEY_GC, NULL);
+    (void)esch_config_set_obj(config, ESCH_CONFIG_KEY_GC_NAIVE_ROOT, NULL);
+    return ret;
+}
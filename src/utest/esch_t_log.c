@@ -0,0 +1,164 @@
+/* vim:ft=c expandtab tw=72 sw=4
+ */
+#include <stdio.h>
+#include "esch_utest.h"
+#include "esch_debug.h"
+#include "esch_config.h"
+#include "esch_thread.h"
+
+#define TEST_LOG_THREADS 4
+#define TEST_LOG_MESSAGES 20000
+
+static void
+test_logAsyncProducer(void* arg)
+{
+    esch_log* log = (esch_log*)arg;
+    int i = 0;
+    for (i = 0; i < TEST_LOG_MESSAGES; ++i)
+    {
+        (void)esch_log_info(log, "test:log:async: message %d", i);
+    }
+}
+
+esch_error test_logLevel(esch_config* config)
+{
+    esch_error ret = ESCH_OK;
+    esch_log* log = NULL;
+    esch_log* do_nothing = NULL;
+    esch_log* async = NULL;
+    esch_log_level level = ESCH_LOG_LEVEL_NONE;
+
+    esch_log_info(g_testLog, "Case 1: Default levels");
+    ret = esch_log_new_printf(NULL, &log);
+    ESCH_TEST_CHECK(ret == ESCH_OK, "Failed to create printf log", ret);
+    ret = esch_log_new_do_nothing(NULL, &do_nothing);
+    ESCH_TEST_CHECK(ret == ESCH_OK, "Failed to create do-nothing log", ret);
+    ret = esch_log_get_level(log, &level);
+    ESCH_TEST_CHECK(ret == ESCH_OK, "Failed to get level", ret);
+    ret = ESCH_ERROR_INVALID_STATE;
+    ESCH_TEST_CHECK(level == ESCH_LOG_LEVEL_INFO,
+                    "Printf log should log everything", ret);
+    ret = esch_log_get_level(do_nothing, &level);
+    ESCH_TEST_CHECK(ret == ESCH_OK, "Failed to get level", ret);
+    ret = ESCH_ERROR_INVALID_STATE;
+    ESCH_TEST_CHECK(level == ESCH_LOG_LEVEL_NONE,
+                    "Do-nothing log should log nothing", ret);
+    ESCH_TEST_CHECK(!ESCH_LOG_IS_ENABLED(do_nothing, ESCH_LOG_LEVEL_ERROR),
+                    "Do-nothing log should skip all messages", ret);
+    ret = esch_log_set_level(do_nothing, ESCH_LOG_LEVEL_INFO);
+    ESCH_TEST_CHECK(ret == ESCH_ERROR_NOT_SUPPORTED,
+                    "Unexpected: change level of do-nothing log", ret);
+    ret = esch_log_set_level(log, ESCH_LOG_LEVEL_WARN);
+    ESCH_TEST_CHECK(ret == ESCH_ERROR_NOT_SUPPORTED,
+                    "Unexpected: change level of printf log", ret);
+    ret = ESCH_OK;
+    esch_log_info(g_testLog, "[PASSED] Default levels");
+
+    esch_log_info(g_testLog, "Case 2: Change level");
+    /* Async log is a log of its own. */
+    ret = esch_log_new_async(config, &async);
+    ESCH_TEST_CHECK(ret == ESCH_OK, "Failed to create async log", ret);
+    ret = esch_log_set_level(async, ESCH_LOG_LEVEL_WARN);
+    ESCH_TEST_CHECK(ret == ESCH_OK, "Failed to set level", ret);
+    /* Nothing printed. */
+    ret = esch_log_info(async, "test:log: This message should not show.");
+    ESCH_TEST_CHECK(ret == ESCH_OK, "Failed to skip message", ret);
+    ret = ESCH_ERROR_INVALID_STATE;
+    ESCH_TEST_CHECK(!ESCH_LOG_IS_ENABLED(async, ESCH_LOG_LEVEL_INFO),
+                    "Info should be disabled", ret);
+    ESCH_TEST_CHECK(ESCH_LOG_LEVEL < ESCH_LOG_LEVEL_WARN ||
+                    ESCH_LOG_IS_ENABLED(async, ESCH_LOG_LEVEL_WARN),
+                    "Warning should be enabled", ret);
+    ret = esch_log_set_level(async,
+                             (esch_log_level)(ESCH_LOG_LEVEL_INFO + 1));
+    ESCH_TEST_CHECK(ret == ESCH_ERROR_INVALID_PARAMETER,
+                    "Unexpected: set bad level", ret);
+    ret = ESCH_OK;
+    esch_log_info(g_testLog, "[PASSED] Change level");
+Exit:
+    if (async != NULL)
+    {
+        (void)esch_object_delete(ESCH_CAST_TO_OBJECT(async));
+    }
+    return ret;
+}
+
+esch_error test_logAsync(esch_config* config)
+{
+    esch_error ret = ESCH_OK;
+    esch_log* log = NULL;
+    esch_thread threads[TEST_LOG_THREADS];
+    int started = 0;
+    size_t written = 0;
+    size_t dropped = 0;
+    int i = 0;
+
+    esch_log_info(g_testLog, "Case 1: Write messages in order");
+    /* Async log writes to stdout directly, after messages before. */
+    (void)fflush(stdout);
+    ret = esch_log_new_async(config, &log);
+    ESCH_TEST_CHECK(ret == ESCH_OK, "Failed to create async log", ret);
+    for (i = 0; i < 3; ++i)
+    {
+        ret = esch_log_info(log, "test:log:async: line %d of 3", i + 1);
+        ESCH_TEST_CHECK(ret == ESCH_OK, "Failed to write message", ret);
+    }
+    ret = esch_log_warn(log, "test:log:async: %s", "warning");
+    ESCH_TEST_CHECK(ret == ESCH_OK, "Failed to write warning", ret);
+    ret = esch_log_flush(log);
+    ESCH_TEST_CHECK(ret == ESCH_OK, "Failed to flush", ret);
+    ret = esch_log_get_counters(log, &written, &dropped);
+    ESCH_TEST_CHECK(ret == ESCH_OK, "Failed to get counters", ret);
+    ret = ESCH_ERROR_INVALID_STATE;
+    ESCH_TEST_CHECK(written == 4 && dropped == 0, "Bad counters", ret);
+    ret = esch_object_delete(ESCH_CAST_TO_OBJECT(log));
+    log = NULL;
+    ESCH_TEST_CHECK(ret == ESCH_OK, "Failed to delete async log", ret);
+    esch_log_info(g_testLog, "[PASSED] Write messages in order");
+
+    esch_log_info(g_testLog, "Case 2: Many producers, small buffer");
+    /* Bad fd: messages can't be written, so all are dropped, either
+     * when buffer is full or when drain thread fails to write. */
+    ret = esch_config_set_int(config, ESCH_CONFIG_KEY_LOG_ASYNC_FD, -1);
+    ESCH_TEST_CHECK(ret == ESCH_OK, "Failed to set fd", ret);
+    ret = esch_config_set_int(config, ESCH_CONFIG_KEY_LOG_ASYNC_SLOTS, 5);
+    ESCH_TEST_CHECK(ret == ESCH_OK, "Failed to set slots", ret);
+    ret = esch_log_new_async(config, &log);
+    ESCH_TEST_CHECK(ret == ESCH_OK, "Failed to create async log", ret);
+    for (started = 0; started < TEST_LOG_THREADS; ++started)
+    {
+        ret = esch_thread_start_i(&(threads[started]),
+                                  test_logAsyncProducer, log);
+        ESCH_TEST_CHECK(ret == ESCH_OK, "Failed to start thread", ret);
+    }
+    for (i = 0; i < TEST_LOG_THREADS; ++i)
+    {
+        (void)esch_thread_join_i(&(threads[i]));
+    }
+    started = 0;
+    ret = esch_log_flush(log);
+    ESCH_TEST_CHECK(ret == ESCH_OK, "Failed to flush", ret);
+    ret = esch_log_get_counters(log, &written, &dropped);
+    ESCH_TEST_CHECK(ret == ESCH_OK, "Failed to get counters", ret);
+    esch_log_info(g_testLog, "written = %d, dropped = %d",
+                  (int)written, (int)dropped);
+    ret = ESCH_ERROR_INVALID_STATE;
+    ESCH_TEST_CHECK(written == 0 &&
+                    dropped == TEST_LOG_THREADS * TEST_LOG_MESSAGES,
+                    "Failed writes are not dropped", ret);
+    ret = ESCH_OK;
+    esch_log_info(g_testLog, "[PASSED] Many producers, small buffer");
+Exit:
+    for (i = 0; i < started; ++i)
+    {
+        (void)esch_thread_join_i(&(threads[i]));
+    }
+    if (log != NULL)
+    {
+        (void)esch_object_delete(ESCH_CAST_TO_OBJECT(log));
+    }
+    (void)esch_config_set_int(config, ESCH_CONFIG_KEY_LOG_ASYNC_FD, 1);
+    (void)esch_config_set_int(config, ESCH_CONFIG_KEY_LOG_ASYNC_SLOTS,
+                              ESCH_LOG_ASYNC_DEFAULT_SLOTS);
+    return ret;
+}
@@ -1,121 +1,797 @@
+/* vim:ft=c expandtab tw=72 sw=4
+ */
 #include <stdio.h>
 #include <string.h>
+#include <limits.h>
 #include "esch_utest.h"
 #include "esch_debug.h"
+#include "esch_config.h"
 #include "esch_number.h"
 
-esch_error test_integer()
+static const char* factorial_100 =
+    "93326215443944152681699238856266700490715968264381621468592963895"
+    "21759999322991560894146397615651828625369792082722375825118521091"
+    "6864000000000000000000000000";
+
+/* Long enough for divide-and-conquer conversion. */
+#define TEST_INTEGER_LONG_DIGITS 6000
+static char test_integerDigits[TEST_INTEGER_LONG_DIGITS + 2];
+static char test_integerOutput[TEST_INTEGER_LONG_DIGITS + 2];
+
+static esch_error
+test_integerExpect(esch_integer* val, const char* expected)
 {
     esch_error ret = ESCH_OK;
-    esch_alloc* alloc = NULL;
-    esch_parser* parser = NULL;
-    esch_config* config = NULL;
-    esch_integer* val = NULL;
-    esch_integer* bigval1 = NULL;
-    esch_integer* bigval2 = NULL;
-    esch_log* log = NULL;
-    esch_log* do_nothing = NULL;
-    unsigned char bval_array[] = {
-        0x56, 0x34, 0x12, 0x90, 0x78, 0x56, 0x34, 0x12, 0x9
-    };
-
-    (void)esch_log_new_do_nothing(&do_nothing);
-#ifdef NDEBUG
-    log = do_nothing;
-#else
-    log = g_testLog;
-#endif
-
-    ret = esch_config_new(&config);
-    ESCH_TEST_CHECK(ret == ESCH_OK, "Failed to create config", ret);
-    ret = esch_config_set_obj(config, ESCH_CONFIG_KEY_LOG, (esch_object*)log);
-    ESCH_TEST_CHECK(ret == ESCH_OK, "Failed to set config:log:log", ret);
-
-    ret = esch_alloc_new_c_default(config, &alloc);
-    ESCH_TEST_CHECK(ret == ESCH_OK, "Failed to create alloc", ret);
-
-    /* The config validation is enabled only in debug build  */
-
-    ret = esch_config_set_obj(config, ESCH_CONFIG_KEY_ALLOC, (esch_object*)alloc);
-    ESCH_TEST_CHECK(ret == ESCH_OK, "Failed to set config:alloc:obj", ret);
-    ret = esch_config_set_obj(config, ESCH_CONFIG_KEY_LOG, (esch_object*)log);
-    ESCH_TEST_CHECK(ret == ESCH_OK, "Failed to set config:log:obj", ret);
-
-    /* Regular integer */
-    ret = esch_integer_new_from_base10(config, "765", NULL, &val);
-    ESCH_TEST_CHECK(ret == ESCH_OK, "Failed to create int", ret);
+    char buffer[256];
+    size_t length = 0;
+
+    ret = esch_integer_to_base10(val, buffer, sizeof(buffer), &length);
+    ESCH_TEST_CHECK(ret == ESCH_OK, "Failed to convert integer", ret);
     ret = ESCH_ERROR_INVALID_STATE;
-    ESCH_TEST_CHECK(!val->big, "Bad big integer detection: 765", ret);
-    esch_log_info(log, "Integer: Converted int = %d, expected = 765",
-                  val->value.ival);
-    ESCH_TEST_CHECK(val->value.ival == 765, "Bad integer value: 765", ret);
+    ESCH_TEST_CHECK(length == strlen(expected) &&
+                    strcmp(buffer, expected) == 0,
+                    "Bad integer value", ret);
     ret = ESCH_OK;
+Exit:
+    if (ret != ESCH_OK)
+    {
+        esch_log_info(g_testLog, "Expected: %s", expected);
+        esch_log_info(g_testLog, "Received: %s", buffer);
+    }
+    return ret;
+}
 
-    /* Big integer 1 */
-    ret = esch_integer_new_from_base10(config, "91234567890123456",
-                                       NULL, &bigval1);
-    ESCH_TEST_CHECK(ret == ESCH_OK, "Failed to create int", ret);
+/* Integer with given number of limbs, all bits set. */
+static esch_error
+test_integerOnes(esch_config* config, int limbs, esch_integer** val)
+{
+    esch_error ret = ESCH_OK;
+    esch_integer* base = NULL;
+    esch_integer* one = NULL;
+    esch_integer* power = NULL;
+    int i = 0;
+
+    ret = esch_integer_new_from_base10(config, "4294967296", NULL, &base);
+    ESCH_TEST_CHECK(ret == ESCH_OK, "Failed to create base", ret);
+    ret = esch_integer_new_from_int(config, 1, &one);
+    ESCH_TEST_CHECK(ret == ESCH_OK, "Failed to create one", ret);
+    power = one;
+    for (i = 0; i < limbs; ++i)
+    {
+        ret = esch_integer_mul(config, power, base, &power);
+        ESCH_TEST_CHECK(ret == ESCH_OK, "Failed to create power", ret);
+    }
+    ret = esch_integer_sub(config, power, one, val);
+    ESCH_TEST_CHECK(ret == ESCH_OK, "Failed to create ones", ret);
+Exit:
+    return ret;
+}
+
+esch_error test_integer(esch_config* config)
+{
+    esch_error ret = ESCH_OK;
+    esch_vector* root = NULL;
+    esch_gc* gc = NULL;
+    esch_integer* a = NULL;
+    esch_integer* b = NULL;
+    esch_integer* c = NULL;
+    esch_integer* q = NULL;
+    esch_integer* r = NULL;
+    esch_value v1;
+    esch_value v2;
+    esch_value v3;
+    char buffer[8];
+    size_t length = 0;
+    int value = 0;
+    int cmp = 0;
+    int i = 0;
+
+    ret = esch_vector_new(config, &root);
+    ESCH_TEST_CHECK(ret == ESCH_OK, "Failed to create root", ret);
+    ret = esch_config_set_obj(config, ESCH_CONFIG_KEY_GC_NAIVE_ROOT,
+                              ESCH_CAST_TO_OBJECT(root));
+    ESCH_TEST_CHECK(ret == ESCH_OK, "Failed to set gc root", ret);
+    ret = esch_gc_new_naive_mark_sweep(config, &gc);
+    ESCH_TEST_CHECK(ret == ESCH_OK, "Failed to create gc", ret);
+    ret = esch_config_set_obj(config, ESCH_CONFIG_KEY_GC,
+                              ESCH_CAST_TO_OBJECT(gc));
+    ESCH_TEST_CHECK(ret == ESCH_OK, "Failed to set gc", ret);
+
+    esch_log_info(g_testLog, "Case 1: Promote and demote");
+    ret = esch_integer_new_from_int(config, INT_MAX, &a);
+    ESCH_TEST_CHECK(ret == ESCH_OK, "Failed to create INT_MAX", ret);
+    ret = esch_integer_new_from_int(config, 1, &b);
+    ESCH_TEST_CHECK(ret == ESCH_OK, "Failed to create 1", ret);
+    ret = esch_integer_add(config, a, b, &c);
+    ESCH_TEST_CHECK(ret == ESCH_OK, "Failed to add", ret);
+    ret = esch_integer_to_int(c, &value);
+    ESCH_TEST_CHECK(ret == ESCH_ERROR_OUT_OF_BOUND,
+                    "Unexpected: INT_MAX + 1 is small", ret);
+    ret = test_integerExpect(c, "2147483648");
+    ESCH_TEST_CHECK(ret == ESCH_OK, "Bad INT_MAX + 1", ret);
+    ret = esch_integer_sub(config, c, b, &c);
+    ESCH_TEST_CHECK(ret == ESCH_OK, "Failed to subtract", ret);
+    ret = esch_integer_to_int(c, &value);
+    ESCH_TEST_CHECK(ret == ESCH_OK, "Failed to demote", ret);
+    ret = ESCH_ERROR_INVALID_STATE;
+    ESCH_TEST_CHECK(value == INT_MAX, "Bad demoted value", ret);
+    ret = esch_integer_new_from_int(config, INT_MIN, &a);
+    ESCH_TEST_CHECK(ret == ESCH_OK, "Failed to create INT_MIN", ret);
+    ret = esch_integer_mul(config, a, a, &c);
+    ESCH_TEST_CHECK(ret == ESCH_OK, "Failed to multiply", ret);
+    ret = test_integerExpect(c, "4611686018427387904");
+    ESCH_TEST_CHECK(ret == ESCH_OK, "Bad INT_MIN * INT_MIN", ret);
+    ret = esch_integer_compare(c, a, &cmp);
+    ESCH_TEST_CHECK(ret == ESCH_OK, "Failed to compare", ret);
+    ret = ESCH_ERROR_INVALID_STATE;
+    ESCH_TEST_CHECK(cmp > 0, "Bad compare result", ret);
+    ret = ESCH_OK;
+    esch_log_info(g_testLog, "[PASSED] Promote and demote");
+
+    esch_log_info(g_testLog, "Case 2: Base 10");
+    ret = esch_integer_new_from_base10(config,
+            "-123456789012345678901234567890", NULL, &a);
+    ESCH_TEST_CHECK(ret == ESCH_OK, "Failed to parse", ret);
+    ret = test_integerExpect(a, "-123456789012345678901234567890");
+    ESCH_TEST_CHECK(ret == ESCH_OK, "Bad round trip", ret);
+    ret = esch_integer_new_from_base10(config, "-0", NULL, &a);
+    ESCH_TEST_CHECK(ret == ESCH_OK, "Failed to parse -0", ret);
+    ret = test_integerExpect(a, "0");
+    ESCH_TEST_CHECK(ret == ESCH_OK, "Bad -0", ret);
+    ret = esch_integer_new_from_base10(config, "12a", NULL, &a);
+    ESCH_TEST_CHECK(ret == ESCH_ERROR_INVALID_PARAMETER,
+                    "Unexpected: parse bad digit", ret);
+    ret = esch_integer_new_from_base10(config, "-", NULL, &a);
+    ESCH_TEST_CHECK(ret == ESCH_ERROR_INVALID_PARAMETER,
+                    "Unexpected: parse sign only", ret);
+    ret = esch_integer_new_from_base10(config, "1000000000000", NULL, &a);
+    ESCH_TEST_CHECK(ret == ESCH_OK, "Failed to parse", ret);
+    ret = esch_integer_to_base10(a, buffer, sizeof(buffer), &length);
+    ESCH_TEST_CHECK(ret == ESCH_ERROR_OUT_OF_BOUND,
+                    "Unexpected: small buffer", ret);
     ret = ESCH_ERROR_INVALID_STATE;
-    ESCH_TEST_CHECK(bigval1->big,
-                    "Bad big int detection: 91234567890123456", ret);
-    esch_log_info(log, "Integer: Converted length = %d, expected = 9",
-                  bigval1->value.bval.length);
-    ESCH_TEST_CHECK(bigval1->value.bval.length == 9,
-                    "Bad big int length: 91234567890123456", ret);
-    esch_log_info(log, "Big int storage: %x,%x,%x,%x,%x,%x,%x,%x,%x",
-            bigval1->value.bval.digit[0],
-            bigval1->value.bval.digit[1],
-            bigval1->value.bval.digit[2],
-            bigval1->value.bval.digit[3],
-            bigval1->value.bval.digit[4],
-            bigval1->value.bval.digit[5],
-            bigval1->value.bval.digit[6],
-            bigval1->value.bval.digit[7],
-            bigval1->value.bval.digit[8]);
-    ESCH_TEST_CHECK(strncmp((const char*)bigval1->value.bval.digit,
-                            (const char*)bval_array,
-                            9) == 0,
-                    "Bad integer storage", ret);
-    ret = ESCH_OK;
-
-    /* Big integer 2 */
-    ret = esch_integer_new_from_base10(config, "1234567890123456", NULL, &bigval2);
+    ESCH_TEST_CHECK(length == 13, "Bad length of small buffer", ret);
+    ret = ESCH_OK;
+    esch_log_info(g_testLog, "[PASSED] Base 10");
+
+    esch_log_info(g_testLog, "Case 3: Factorial");
+    ret = esch_integer_new_from_int(config, 1, &a);
+    ESCH_TEST_CHECK(ret == ESCH_OK, "Failed to create 1", ret);
+    for (i = 2; i <= 100; ++i)
+    {
+        ret = esch_integer_new_from_int(config, i, &b);
+        ESCH_TEST_CHECK(ret == ESCH_OK, "Failed to create int", ret);
+        ret = esch_integer_mul(config, a, b, &a);
+        ESCH_TEST_CHECK(ret == ESCH_OK, "Failed to multiply", ret);
+    }
+    ret = test_integerExpect(a, factorial_100);
+    ESCH_TEST_CHECK(ret == ESCH_OK, "Bad 100!", ret);
+    /* Divide back down to 1. */
+    for (i = 100; i >= 2; --i)
+    {
+        ret = esch_integer_new_from_int(config, i, &b);
+        ESCH_TEST_CHECK(ret == ESCH_OK, "Failed to create int", ret);
+        ret = esch_integer_divide(config, a, b, &a, &r);
+        ESCH_TEST_CHECK(ret == ESCH_OK, "Failed to divide", ret);
+        ret = test_integerExpect(r, "0");
+        ESCH_TEST_CHECK(ret == ESCH_OK, "Bad remainder", ret);
+    }
+    ret = test_integerExpect(a, "1");
+    ESCH_TEST_CHECK(ret == ESCH_OK, "Bad quotient", ret);
+    esch_log_info(g_testLog, "[PASSED] Factorial");
+
+    esch_log_info(g_testLog, "Case 4: Truncated division");
+    ret = esch_integer_new_from_int(config, -7, &a);
+    ESCH_TEST_CHECK(ret == ESCH_OK, "Failed to create -7", ret);
+    ret = esch_integer_new_from_int(config, 2, &b);
+    ESCH_TEST_CHECK(ret == ESCH_OK, "Failed to create 2", ret);
+    ret = esch_integer_divide(config, a, b, &q, &r);
+    ESCH_TEST_CHECK(ret == ESCH_OK, "Failed to divide", ret);
+    ret = test_integerExpect(q, "-3");
+    ESCH_TEST_CHECK(ret == ESCH_OK, "Bad -7 / 2", ret);
+    ret = test_integerExpect(r, "-1");
+    ESCH_TEST_CHECK(ret == ESCH_OK, "Bad -7 % 2", ret);
+    ret = esch_integer_new_from_int(config, INT_MIN, &a);
+    ESCH_TEST_CHECK(ret == ESCH_OK, "Failed to create INT_MIN", ret);
+    ret = esch_integer_new_from_int(config, -1, &b);
+    ESCH_TEST_CHECK(ret == ESCH_OK, "Failed to create -1", ret);
+    ret = esch_integer_divide(config, a, b, &q, NULL);
+    ESCH_TEST_CHECK(ret == ESCH_OK, "Failed to divide", ret);
+    ret = test_integerExpect(q, "2147483648");
+    ESCH_TEST_CHECK(ret == ESCH_OK, "Bad INT_MIN / -1", ret);
+    ret = esch_integer_new_from_int(config, 0, &b);
+    ESCH_TEST_CHECK(ret == ESCH_OK, "Failed to create 0", ret);
+    ret = esch_integer_divide(config, a, b, &q, &r);
+    ESCH_TEST_CHECK(ret == ESCH_ERROR_INVALID_PARAMETER,
+                    "Unexpected: divided by zero", ret);
+    ret = ESCH_OK;
+    esch_log_info(g_testLog, "[PASSED] Truncated division");
+
+    esch_log_info(g_testLog, "Case 5: Karatsuba and long division");
+    /* (B^n - 1)^2 = B^2n - 2 * B^n + 1, for n above threshold. */
+    ret = test_integerOnes(config, ESCH_BIGNUM_KARATSUBA_THRESHOLD * 3 + 1,
+                           &a);
+    ESCH_TEST_CHECK(ret == ESCH_OK, "Failed to create ones", ret);
+    ret = esch_integer_mul(config, a, a, &c);
+    ESCH_TEST_CHECK(ret == ESCH_OK, "Failed to square", ret);
+    ret = esch_integer_new_from_int(config, 2, &b);
+    ESCH_TEST_CHECK(ret == ESCH_OK, "Failed to create 2", ret);
+    ret = esch_integer_mul(config, a, b, &b);
+    ESCH_TEST_CHECK(ret == ESCH_OK, "Failed to double", ret);
+    ret = esch_integer_add(config, c, b, &c);
+    ESCH_TEST_CHECK(ret == ESCH_OK, "Failed to add", ret);
+    ret = esch_integer_new_from_int(config, 1, &b);
+    ESCH_TEST_CHECK(ret == ESCH_OK, "Failed to create 1", ret);
+    ret = esch_integer_add(config, a, b, &b);
+    ESCH_TEST_CHECK(ret == ESCH_OK, "Failed to add", ret);
+    ret = esch_integer_mul(config, b, b, &b);
+    ESCH_TEST_CHECK(ret == ESCH_OK, "Failed to square B^n", ret);
+    ret = esch_integer_new_from_int(config, 1, &q);
+    ESCH_TEST_CHECK(ret == ESCH_OK, "Failed to create 1", ret);
+    ret = esch_integer_add(config, c, q, &c);
+    ESCH_TEST_CHECK(ret == ESCH_OK, "Failed to add", ret);
+    ret = esch_integer_compare(c, b, &cmp);
+    ESCH_TEST_CHECK(ret == ESCH_OK, "Failed to compare", ret);
+    ret = ESCH_ERROR_INVALID_STATE;
+    ESCH_TEST_CHECK(cmp == 0, "Bad Karatsuba square", ret);
+    /* Unbalanced: a * (b * 12345 + 678), then divide back. */
+    ret = test_integerOnes(config, ESCH_BIGNUM_KARATSUBA_THRESHOLD + 3, &b);
+    ESCH_TEST_CHECK(ret == ESCH_OK, "Failed to create ones", ret);
+    ret = esch_integer_new_from_int(config, 12345, &q);
+    ESCH_TEST_CHECK(ret == ESCH_OK, "Failed to create int", ret);
+    ret = esch_integer_mul(config, a, b, &c);
+    ESCH_TEST_CHECK(ret == ESCH_OK, "Failed to multiply", ret);
+    ret = esch_integer_mul(config, c, q, &c);
+    ESCH_TEST_CHECK(ret == ESCH_OK, "Failed to multiply", ret);
+    ret = esch_integer_new_from_int(config, 678, &r);
     ESCH_TEST_CHECK(ret == ESCH_OK, "Failed to create int", ret);
+    ret = esch_integer_add(config, c, r, &c);
+    ESCH_TEST_CHECK(ret == ESCH_OK, "Failed to add", ret);
+    ret = esch_integer_mul(config, b, q, &b);
+    ESCH_TEST_CHECK(ret == ESCH_OK, "Failed to multiply", ret);
+    ret = esch_integer_divide(config, c, b, &q, &r);
+    ESCH_TEST_CHECK(ret == ESCH_OK, "Failed to divide", ret);
+    ret = esch_integer_compare(q, a, &cmp);
+    ESCH_TEST_CHECK(ret == ESCH_OK, "Failed to compare", ret);
     ret = ESCH_ERROR_INVALID_STATE;
-    ESCH_TEST_CHECK(bigval2->big, "Bad big int detection: 1234567890123456", ret);
-    esch_log_info(log, "Integer: Converted length = %d, expected = 8",
-                  bigval2->value.bval.length);
-    ESCH_TEST_CHECK(bigval2->value.bval.length == 8,
-                    "Bad big int length: 1234567890123456", ret);
-    esch_log_info(log, "Big int storage: %x,%x,%x,%x,%x,%x,%x,%x",
-            bigval2->value.bval.digit[0],
-            bigval2->value.bval.digit[1],
-            bigval2->value.bval.digit[2],
-            bigval2->value.bval.digit[3],
-            bigval2->value.bval.digit[4],
-            bigval2->value.bval.digit[5],
-            bigval2->value.bval.digit[6],
-            bigval2->value.bval.digit[7]);
-    ESCH_TEST_CHECK(strncmp((const char*)bigval2->value.bval.digit,
-                            (const char*)bval_array,
-                            8) == 0,
-                    "Bad integer storage", ret);
-    ret = ESCH_OK;
-
-    ret = esch_integer_delete(val);
-    ESCH_TEST_CHECK(ret == ESCH_OK, "Failed to delete int", ret);
-
-    ret = esch_integer_delete(bigval1);
-    ESCH_TEST_CHECK(ret == ESCH_OK, "Failed to delete int", ret);
-
-    ret = esch_integer_delete(bigval2);
-    ESCH_TEST_CHECK(ret == ESCH_OK, "Failed to delete int", ret);
-
-    ret = esch_alloc_delete(alloc);
-    ESCH_TEST_CHECK(ret == ESCH_OK, "Failed to delete alloc object.", ret);
-
-    ret = esch_config_delete(config);
-    ESCH_TEST_CHECK(ret == ESCH_OK, "Failed to delete config object.", ret);
+    ESCH_TEST_CHECK(cmp == 0, "Bad quotient", ret);
+    ret = test_integerExpect(r, "678");
+    ESCH_TEST_CHECK(ret == ESCH_OK, "Bad remainder", ret);
+    esch_log_info(g_testLog, "[PASSED] Karatsuba and long division");
+
+    esch_log_info(g_testLog, "Case 6: Fixnum values");
+    v1.type = ESCH_VALUE_TYPE_INTEGER;
+    v1.val.i = 40000;
+    v2.type = ESCH_VALUE_TYPE_INTEGER;
+    v2.val.i = -2;
+    /* No allocation on fixnum path, so config is not needed. */
+    ret = esch_value_mul(NULL, &v1, &v2, &v3);
+    ESCH_TEST_CHECK(ret == ESCH_OK, "Failed to multiply fixnums", ret);
+    ret = ESCH_ERROR_INVALID_STATE;
+    ESCH_TEST_CHECK(v3.type == ESCH_VALUE_TYPE_INTEGER &&
+                    v3.val.i == -80000, "Bad fixnum product", ret);
+    v1.val.i = INT_MAX;
+    v2.val.i = 1;
+    ret = esch_value_add(config, &v1, &v2, &v3);
+    ESCH_TEST_CHECK(ret == ESCH_OK, "Failed to add fixnums", ret);
+    ret = ESCH_ERROR_INVALID_STATE;
+    ESCH_TEST_CHECK(v3.type == ESCH_VALUE_TYPE_OBJECT,
+                    "Overflow not promoted", ret);
+    c = ESCH_CAST_FROM_OBJECT(v3.val.o, esch_integer);
+    ret = test_integerExpect(c, "2147483648");
+    ESCH_TEST_CHECK(ret == ESCH_OK, "Bad INT_MAX + 1", ret);
+    /* Mixed fixnum and object, result demoted in place. */
+    ret = esch_value_sub(config, &v3, &v2, &v3);
+    ESCH_TEST_CHECK(ret == ESCH_OK, "Failed to subtract", ret);
+    ret = ESCH_ERROR_INVALID_STATE;
+    ESCH_TEST_CHECK(v3.type == ESCH_VALUE_TYPE_INTEGER &&
+                    v3.val.i == INT_MAX, "Result not demoted", ret);
+    v1.val.i = INT_MIN;
+    v2.val.i = 1;
+    ret = esch_value_sub(config, &v1, &v2, &v3);
+    ESCH_TEST_CHECK(ret == ESCH_OK, "Failed to subtract fixnums", ret);
+    ret = ESCH_ERROR_INVALID_STATE;
+    ESCH_TEST_CHECK(v3.type == ESCH_VALUE_TYPE_OBJECT,
+                    "Underflow not promoted", ret);
+    c = ESCH_CAST_FROM_OBJECT(v3.val.o, esch_integer);
+    ret = test_integerExpect(c, "-2147483649");
+    ESCH_TEST_CHECK(ret == ESCH_OK, "Bad INT_MIN - 1", ret);
+    ret = esch_value_mul(config, &v1, &v1, &v3);
+    ESCH_TEST_CHECK(ret == ESCH_OK, "Failed to multiply fixnums", ret);
+    c = ESCH_CAST_FROM_OBJECT(v3.val.o, esch_integer);
+    ret = test_integerExpect(c, "4611686018427387904");
+    ESCH_TEST_CHECK(ret == ESCH_OK, "Bad INT_MIN * INT_MIN", ret);
+    v1.type = ESCH_VALUE_TYPE_FLOAT;
+    v1.val.f = 1.0;
+    ret = esch_value_add(config, &v1, &v2, &v3);
+    ESCH_TEST_CHECK(ret == ESCH_ERROR_BAD_VALUE_TYPE,
+                    "Unexpected: float accepted", ESCH_ERROR_INVALID_STATE);
+    ret = ESCH_OK;
+    esch_log_info(g_testLog, "[PASSED] Fixnum values");
+
+    esch_log_info(g_testLog, "Case 7: Long base 10");
+    /* 999...9 + 1 == 1000...0 checks parsing without printing. */
+    memset(test_integerDigits, '9', TEST_INTEGER_LONG_DIGITS);
+    test_integerDigits[TEST_INTEGER_LONG_DIGITS] = '\0';
+    ret = esch_integer_new_from_base10(config, test_integerDigits, NULL, &a);
+    ESCH_TEST_CHECK(ret == ESCH_OK, "Failed to parse nines", ret);
+    ret = esch_integer_new_from_int(config, 1, &b);
+    ESCH_TEST_CHECK(ret == ESCH_OK, "Failed to create 1", ret);
+    ret = esch_integer_add(config, a, b, &a);
+    ESCH_TEST_CHECK(ret == ESCH_OK, "Failed to add", ret);
+    test_integerDigits[0] = '1';
+    memset(test_integerDigits + 1, '0', TEST_INTEGER_LONG_DIGITS);
+    test_integerDigits[TEST_INTEGER_LONG_DIGITS + 1] = '\0';
+    ret = esch_integer_new_from_base10(config, test_integerDigits, NULL, &c);
+    ESCH_TEST_CHECK(ret == ESCH_OK, "Failed to parse power of 10", ret);
+    ret = esch_integer_compare(a, c, &cmp);
+    ESCH_TEST_CHECK(ret == ESCH_OK, "Failed to compare", ret);
+    ret = ESCH_ERROR_INVALID_STATE;
+    ESCH_TEST_CHECK(cmp == 0, "Bad parsed value", ret);
+    ret = esch_integer_to_base10(c, test_integerOutput,
+                                 sizeof(test_integerOutput), &length);
+    ESCH_TEST_CHECK(ret == ESCH_OK, "Failed to print power of 10", ret);
+    ret = ESCH_ERROR_INVALID_STATE;
+    ESCH_TEST_CHECK(strcmp(test_integerDigits, test_integerOutput) == 0,
+                    "Bad printed power of 10", ret);
+    /* Mixed digits with leading zeros, which printing drops. */
+    test_integerDigits[0] = '-';
+    for (i = 1; i <= TEST_INTEGER_LONG_DIGITS; ++i)
+    {
+        test_integerDigits[i] = (char)(i < 100? '0': '1' + (i * 7) % 9);
+    }
+    ret = esch_integer_new_from_base10(config, test_integerDigits, NULL, &a);
+    ESCH_TEST_CHECK(ret == ESCH_OK, "Failed to parse digits", ret);
+    ret = esch_integer_to_base10(a, test_integerOutput,
+                                 sizeof(test_integerOutput), &length);
+    ESCH_TEST_CHECK(ret == ESCH_OK, "Failed to print digits", ret);
+    ret = ESCH_ERROR_INVALID_STATE;
+    ESCH_TEST_CHECK(length == TEST_INTEGER_LONG_DIGITS - 98 &&
+                    test_integerOutput[0] == '-' &&
+                    strcmp(test_integerDigits + 100,
+                           test_integerOutput + 1) == 0,
+                    "Bad round trip", ret);
+    /* Bad digit is found in the middle of an 8-digit step. */
+    test_integerDigits[3003] = ':';
+    ret = esch_integer_new_from_base10(config, test_integerDigits, NULL, &a);
+    ESCH_TEST_CHECK(ret == ESCH_ERROR_INVALID_PARAMETER,
+                    "Unexpected: parse bad digit", ESCH_ERROR_INVALID_STATE);
+    ret = ESCH_OK;
+    esch_log_info(g_testLog, "[PASSED] Long base 10");
+
+    esch_log_info(g_testLog, "Case 8: Number literals");
+    ret = esch_value_from_base10(config, "-2147483648", NULL, &v1);
+    ESCH_TEST_CHECK(ret == ESCH_OK, "Failed to read INT_MIN", ret);
+    ret = ESCH_ERROR_INVALID_STATE;
+    ESCH_TEST_CHECK(v1.type == ESCH_VALUE_TYPE_INTEGER &&
+                    v1.val.i == INT_MIN, "Bad INT_MIN", ret);
+    ret = esch_value_from_base10(config, "0000000000000000000000042",
+                                 NULL, &v1);
+    ESCH_TEST_CHECK(ret == ESCH_OK, "Failed to read zeros", ret);
+    ret = ESCH_ERROR_INVALID_STATE;
+    ESCH_TEST_CHECK(v1.type == ESCH_VALUE_TYPE_INTEGER && v1.val.i == 42,
+                    "Bad leading zeros", ret);
+    ret = esch_value_to_base10(&v1, buffer, sizeof(buffer), &length);
+    ESCH_TEST_CHECK(ret == ESCH_OK, "Failed to print fixnum", ret);
+    ret = ESCH_ERROR_INVALID_STATE;
+    ESCH_TEST_CHECK(strcmp(buffer, "42") == 0, "Bad fixnum text", ret);
+    ret = esch_value_from_base10(config, "2147483648", NULL, &v1);
+    ESCH_TEST_CHECK(ret == ESCH_OK, "Failed to read INT_MAX + 1", ret);
+    ret = ESCH_ERROR_INVALID_STATE;
+    ESCH_TEST_CHECK(v1.type == ESCH_VALUE_TYPE_OBJECT, "Not promoted", ret);
+    ret = esch_value_from_base10(config, factorial_100, NULL, &v1);
+    ESCH_TEST_CHECK(ret == ESCH_OK, "Failed to read 100!", ret);
+    ret = esch_value_to_base10(&v1, test_integerOutput,
+                               sizeof(test_integerOutput), &length);
+    ESCH_TEST_CHECK(ret == ESCH_OK, "Failed to print 100!", ret);
+    ret = ESCH_ERROR_INVALID_STATE;
+    ESCH_TEST_CHECK(strcmp(test_integerOutput, factorial_100) == 0,
+                    "Bad 100!", ret);
+    ret = esch_value_from_base10(config, "-1e3", NULL, &v1);
+    ESCH_TEST_CHECK(ret == ESCH_OK, "Failed to read -1e3", ret);
+    ret = ESCH_ERROR_INVALID_STATE;
+    ESCH_TEST_CHECK(v1.type == ESCH_VALUE_TYPE_FLOAT && v1.val.f == -1e3,
+                    "Bad -1e3", ret);
+    ret = esch_value_to_base10(&v1, buffer, sizeof(buffer), &length);
+    ESCH_TEST_CHECK(ret == ESCH_OK, "Failed to print -1e3", ret);
+    ret = ESCH_ERROR_INVALID_STATE;
+    ESCH_TEST_CHECK(strcmp(buffer, "-1000.0") == 0, "Bad float text", ret);
+    ret = esch_value_from_base10(config, "-", NULL, &v1);
+    ESCH_TEST_CHECK(ret == ESCH_ERROR_INVALID_PARAMETER,
+                    "Unexpected: read -", ESCH_ERROR_INVALID_STATE);
+    v1.type = ESCH_VALUE_TYPE_NIL;
+    ret = esch_value_to_base10(&v1, buffer, sizeof(buffer), &length);
+    ESCH_TEST_CHECK(ret == ESCH_ERROR_BAD_VALUE_TYPE,
+                    "Unexpected: print nil", ESCH_ERROR_INVALID_STATE);
+    ret = ESCH_OK;
+    esch_log_info(g_testLog, "[PASSED] Number literals");
+Exit:
+    if (gc != NULL)
+    {
+        (void)esch_object_delete(ESCH_CAST_TO_OBJECT(gc));
+    }
+    (void)esch_config_set_obj(config, ESCH_CONFIG_KEY_GC, NULL);
+    (void)esch_config_set_obj(config, ESCH_CONFIG_KEY_GC_NAIVE_ROOT, NULL);
+    return ret;
+}
+
+struct test_floatCase
+{
+    const char* text;
+    double value;
+};
+
+/* Expected values are converted by compiler. */
+static const struct test_floatCase test_floatParse[] =
+{
+    { "0", 0.0 },
+    { "1", 1.0 },
+    { "-3.14159", -3.14159 },
+    { ".5", 0.5 },
+    { "5.", 5.0 },
+    { "+1E23", 1e23 },
+    { "0.1000000000000000055511151231257827021181583404541015625", 0.1 },
+    /* 2^53 + 1 is halfway: round to even. */
+    { "9007199254740993", 9007199254740992.0 },
+    { "9007199254740995", 9007199254740996.0 },
+    { "2.2250738585072011e-308", 2.2250738585072011e-308 },
+    { "4.9406564584124654e-324", 4.9406564584124654e-324 },
+    /* Just below and just above half of smallest subnormal. */
+    { "2.4703282292062327e-324", 0.0 },
+    { "2.4703282292062328e-324", 4.9406564584124654e-324 },
+    { "1.7976931348623158e308", 1.7976931348623157e308 },
+    { "1e-400", 0.0 },
+};
+
+static const struct test_floatCase test_floatPrint[] =
+{
+    { "1.0", 1.0 },
+    { "0.1", 0.1 },
+    { "-123.456", -123.456 },
+    { "0.3333333333333333", 1.0 / 3 },
+    { "100000000000000000000.0", 1e20 },
+    { "1e21", 1e21 },
+    { "0.000001", 1e-6 },
+    { "1e-7", 1e-7 },
+    { "-2.5e-10", -2.5e-10 },
+    { "5e-324", 4.9406564584124654e-324 },
+    { "1.7976931348623157e308", 1.7976931348623157e308 },
+    { "9007199254740992.0", 9007199254740992.0 },
+};
+
+#define TEST_FLOAT_LONG_ZEROS 1000
+static char test_floatDigits[TEST_FLOAT_LONG_ZEROS + 32];
+
+static esch_bool
+test_floatSame(double a, double b)
+{
+    return memcmp(&a, &b, sizeof(double)) == 0;
+}
+
+esch_error test_float(esch_config* config)
+{
+    esch_error ret = ESCH_OK;
+    char buffer[32];
+    size_t length = 0;
+    size_t i = 0;
+    double value = 0.0;
+    double parsed = 0.0;
+    uint64_t bits = 0;
+    uint64_t seed = 1;
+
+    (void)config;
+    esch_log_info(g_testLog, "Case 1: Parse");
+    for (i = 0; i < sizeof(test_floatParse) / sizeof(test_floatParse[0]);
+         ++i)
+    {
+        ret = esch_float_from_base10(test_floatParse[i].text, NULL, &value);
+        ESCH_TEST_CHECK(ret == ESCH_OK, "Failed to parse float", ret);
+        ret = ESCH_ERROR_INVALID_STATE;
+        ESCH_TEST_CHECK(test_floatSame(value, test_floatParse[i].value),
+                        "Bad parsed float", ret);
+    }
+    ret = esch_float_from_base10("-0.0", NULL, &value);
+    ESCH_TEST_CHECK(ret == ESCH_OK, "Failed to parse -0.0", ret);
+    ret = ESCH_ERROR_INVALID_STATE;
+    ESCH_TEST_CHECK(test_floatSame(value, -0.0), "Bad -0.0", ret);
+    ret = esch_float_from_base10("1.7976931348623159e308", NULL, &value);
+    ESCH_TEST_CHECK(ret == ESCH_OK, "Failed to parse overflow", ret);
+    ret = esch_float_from_base10("+inf.0", NULL, &parsed);
+    ESCH_TEST_CHECK(ret == ESCH_OK, "Failed to parse +inf.0", ret);
+    ret = ESCH_ERROR_INVALID_STATE;
+    ESCH_TEST_CHECK(value == parsed && value > 1.7976931348623157e308,
+                    "Bad overflow", ret);
+    /* Exact halfway, until a non-zero digit far away breaks the tie. */
+    strcpy(test_floatDigits, "9007199254740993.");
+    memset(test_floatDigits + 17, '0', TEST_FLOAT_LONG_ZEROS);
+    strcpy(test_floatDigits + 17 + TEST_FLOAT_LONG_ZEROS, "1");
+    ret = esch_float_from_base10(test_floatDigits, NULL, &value);
+    ESCH_TEST_CHECK(ret == ESCH_OK, "Failed to parse long digits", ret);
+    ret = ESCH_ERROR_INVALID_STATE;
+    ESCH_TEST_CHECK(value == 9007199254740994.0, "Bad long digits", ret);
+    ret = esch_float_from_base10("1e", NULL, &value);
+    ESCH_TEST_CHECK(ret == ESCH_ERROR_INVALID_PARAMETER,
+                    "Unexpected: parse 1e", ESCH_ERROR_INVALID_STATE);
+    ret = esch_float_from_base10("inf.0", NULL, &value);
+    ESCH_TEST_CHECK(ret == ESCH_ERROR_INVALID_PARAMETER,
+                    "Unexpected: parse inf.0", ESCH_ERROR_INVALID_STATE);
+    ret = ESCH_OK;
+    esch_log_info(g_testLog, "[PASSED] Parse");
+
+    esch_log_info(g_testLog, "Case 2: Print");
+    for (i = 0; i < sizeof(test_floatPrint) / sizeof(test_floatPrint[0]);
+         ++i)
+    {
+        ret = esch_float_to_base10(test_floatPrint[i].value,
+                                   buffer, sizeof(buffer), &length);
+        ESCH_TEST_CHECK(ret == ESCH_OK, "Failed to print float", ret);
+        ret = ESCH_ERROR_INVALID_STATE;
+        ESCH_TEST_CHECK(strcmp(buffer, test_floatPrint[i].text) == 0 &&
+                        length == strlen(buffer),
+                        "Bad printed float", ret);
+    }
+    ret = esch_float_to_base10(-0.0, buffer, sizeof(buffer), &length);
+    ESCH_TEST_CHECK(ret == ESCH_OK, "Failed to print -0.0", ret);
+    ret = ESCH_ERROR_INVALID_STATE;
+    ESCH_TEST_CHECK(strcmp(buffer, "-0.0") == 0, "Bad -0.0", ret);
+    value = -parsed;
+    ret = esch_float_to_base10(value, buffer, sizeof(buffer), &length);
+    ESCH_TEST_CHECK(ret == ESCH_OK, "Failed to print -inf.0", ret);
+    ret = ESCH_ERROR_INVALID_STATE;
+    ESCH_TEST_CHECK(strcmp(buffer, "-inf.0") == 0, "Bad -inf.0", ret);
+    value = parsed - parsed;
+    ret = esch_float_to_base10(value, buffer, sizeof(buffer), &length);
+    ESCH_TEST_CHECK(ret == ESCH_OK, "Failed to print nan", ret);
+    ret = ESCH_ERROR_INVALID_STATE;
+    ESCH_TEST_CHECK(strcmp(buffer, "+nan.0") == 0, "Bad +nan.0", ret);
+    ret = esch_float_to_base10(0.1, buffer, 3, &length);
+    ESCH_TEST_CHECK(ret == ESCH_ERROR_OUT_OF_BOUND && length == 3,
+                    "Unexpected: small buffer", ESCH_ERROR_INVALID_STATE);
+    ret = ESCH_OK;
+    esch_log_info(g_testLog, "[PASSED] Print");
+
+    esch_log_info(g_testLog, "Case 3: Round trip");
+    for (i = 0; i < 100000; ++i)
+    {
+        seed = seed * ESCH_NUMBER_U64(0x5851F42D, 0x4C957F2D) +
+               ESCH_NUMBER_U64(0x14057B7E, 0xF767814F);
+        bits = seed;
+        memcpy(&value, &bits, sizeof(value));
+        if (value != value || value - value != 0.0)
+        {
+            continue;
+        }
+        ret = esch_float_to_base10(value, buffer, sizeof(buffer), &length);
+        ESCH_TEST_CHECK(ret == ESCH_OK, "Failed to print", ret);
+        ret = esch_float_from_base10(buffer, buffer + length, &parsed);
+        ESCH_TEST_CHECK(ret == ESCH_OK, "Failed to parse", ret);
+        ret = ESCH_ERROR_INVALID_STATE;
+        ESCH_TEST_CHECK(test_floatSame(value, parsed), "Bad round trip",
+                        ret);
+    }
+    ret = ESCH_OK;
+    esch_log_info(g_testLog, "[PASSED] Round trip");
+Exit:
+    return ret;
+}
+
+static const char* harmonic_100 =
+    "14466636279520351160221518043104131447711/"
+    "2788815009188499086581352357412492142272";
+
+static esch_error
+test_fractionExpect(esch_fraction* val, const char* expected)
+{
+    esch_error ret = ESCH_OK;
+    char buffer[128];
+    size_t length = 0;
+
+    buffer[0] = '\0';
+    ret = esch_fraction_to_base10(val, buffer, sizeof(buffer), &length);
+    ESCH_TEST_CHECK(ret == ESCH_OK, "Failed to convert fraction", ret);
+    ret = ESCH_ERROR_INVALID_STATE;
+    ESCH_TEST_CHECK(length == strlen(expected) &&
+                    strcmp(buffer, expected) == 0,
+                    "Bad fraction value", ret);
+    ret = ESCH_OK;
+Exit:
+    if (ret != ESCH_OK)
+    {
+        esch_log_info(g_testLog, "Expected: %s", expected);
+        esch_log_info(g_testLog, "Received: %s", buffer);
+    }
+    return ret;
+}
+
+/* Sum of 1/k, k from 1 to n. */
+static esch_error
+test_fractionHarmonic(esch_config* config, int n, esch_fraction** val)
+{
+    esch_error ret = ESCH_OK;
+    esch_fraction* sum = NULL;
+    esch_fraction* term = NULL;
+    int k = 0;
+
+    ret = esch_fraction_new_from_int(config, 0, 1, &sum);
+    ESCH_TEST_CHECK(ret == ESCH_OK, "Failed to create 0", ret);
+    for (k = 1; k <= n; ++k)
+    {
+        ret = esch_fraction_new_from_int(config, 1, k, &term);
+        ESCH_TEST_CHECK(ret == ESCH_OK, "Failed to create 1/k", ret);
+        ret = esch_fraction_add(config, sum, term, &sum);
+        ESCH_TEST_CHECK(ret == ESCH_OK, "Failed to add 1/k", ret);
+    }
+    (*val) = sum;
+Exit:
+    return ret;
+}
+
+esch_error test_fraction(esch_config* config)
+{
+    esch_error ret = ESCH_OK;
+    esch_vector* root = NULL;
+    esch_gc* gc = NULL;
+    esch_fraction* a = NULL;
+    esch_fraction* b = NULL;
+    esch_fraction* c = NULL;
+    esch_integer* n = NULL;
+    esch_integer* d = NULL;
+    char buffer[8];
+    size_t length = 0;
+    int value = 0;
+    int cmp = 0;
+    int k = 0;
+
+    ret = esch_vector_new(config, &root);
+    ESCH_TEST_CHECK(ret == ESCH_OK, "Failed to create root", ret);
+    ret = esch_config_set_obj(config, ESCH_CONFIG_KEY_GC_NAIVE_ROOT,
+                              ESCH_CAST_TO_OBJECT(root));
+    ESCH_TEST_CHECK(ret == ESCH_OK, "Failed to set gc root", ret);
+    ret = esch_gc_new_naive_mark_sweep(config, &gc);
+    ESCH_TEST_CHECK(ret == ESCH_OK, "Failed to create gc", ret);
+    ret = esch_config_set_obj(config, ESCH_CONFIG_KEY_GC,
+                              ESCH_CAST_TO_OBJECT(gc));
+    ESCH_TEST_CHECK(ret == ESCH_OK, "Failed to set gc", ret);
+
+    esch_log_info(g_testLog, "Case 1: Normalize");
+    ret = esch_fraction_new_from_int(config, 6, -4, &a);
+    ESCH_TEST_CHECK(ret == ESCH_OK, "Failed to create 6/-4", ret);
+    ret = test_fractionExpect(a, "-3/2");
+    ESCH_TEST_CHECK(ret == ESCH_OK, "Bad 6/-4", ret);
+    ret = esch_fraction_new_from_int(config, 0, -5, &a);
+    ESCH_TEST_CHECK(ret == ESCH_OK, "Failed to create 0/-5", ret);
+    ret = test_fractionExpect(a, "0");
+    ESCH_TEST_CHECK(ret == ESCH_OK, "Bad 0/-5", ret);
+    ret = esch_fraction_new_from_int(config, INT_MIN, -1, &a);
+    ESCH_TEST_CHECK(ret == ESCH_OK, "Failed to create INT_MIN/-1", ret);
+    ret = test_fractionExpect(a, "2147483648");
+    ESCH_TEST_CHECK(ret == ESCH_OK, "Bad INT_MIN/-1", ret);
+    ret = esch_fraction_new_from_int(config, 4, 0, &a);
+    ESCH_TEST_CHECK(ret == ESCH_ERROR_INVALID_PARAMETER,
+                    "Unexpected: create 4/0", ESCH_ERROR_INVALID_STATE);
+    ret = esch_integer_new_from_base10(config, "-12345678901234567890",
+                                       NULL, &n);
+    ESCH_TEST_CHECK(ret == ESCH_OK, "Failed to create numerator", ret);
+    ret = esch_integer_new_from_base10(config, "-98765432109876543210",
+                                       NULL, &d);
+    ESCH_TEST_CHECK(ret == ESCH_OK, "Failed to create denominator", ret);
+    ret = esch_fraction_new(config, n, d, &a);
+    ESCH_TEST_CHECK(ret == ESCH_OK, "Failed to create fraction", ret);
+    ret = test_fractionExpect(a, "13717421/109739369");
+    ESCH_TEST_CHECK(ret == ESCH_OK, "Bad big fraction", ret);
+    ret = ESCH_OK;
+    esch_log_info(g_testLog, "[PASSED] Normalize");
+
+    esch_log_info(g_testLog, "Case 2: Small arithmetic");
+    ret = esch_fraction_new_from_int(config, 1, 2, &a);
+    ESCH_TEST_CHECK(ret == ESCH_OK, "Failed to create 1/2", ret);
+    ret = esch_fraction_new_from_int(config, 1, 3, &b);
+    ESCH_TEST_CHECK(ret == ESCH_OK, "Failed to create 1/3", ret);
+    ret = esch_fraction_add(config, a, b, &c);
+    ESCH_TEST_CHECK(ret == ESCH_OK, "Failed to add", ret);
+    ret = test_fractionExpect(c, "5/6");
+    ESCH_TEST_CHECK(ret == ESCH_OK, "Bad 1/2 + 1/3", ret);
+    ret = esch_fraction_sub(config, b, a, &c);
+    ESCH_TEST_CHECK(ret == ESCH_OK, "Failed to subtract", ret);
+    ret = test_fractionExpect(c, "-1/6");
+    ESCH_TEST_CHECK(ret == ESCH_OK, "Bad 1/3 - 1/2", ret);
+    ret = esch_fraction_mul(config, c, a, &c);
+    ESCH_TEST_CHECK(ret == ESCH_OK, "Failed to multiply", ret);
+    ret = test_fractionExpect(c, "-1/12");
+    ESCH_TEST_CHECK(ret == ESCH_OK, "Bad -1/6 * 1/2", ret);
+    ret = esch_fraction_div(config, b, c, &c);
+    ESCH_TEST_CHECK(ret == ESCH_OK, "Failed to divide", ret);
+    ret = test_fractionExpect(c, "-4");
+    ESCH_TEST_CHECK(ret == ESCH_OK, "Bad 1/3 / -1/12", ret);
+    ret = esch_fraction_sub(config, a, a, &c);
+    ESCH_TEST_CHECK(ret == ESCH_OK, "Failed to subtract", ret);
+    ret = esch_fraction_div(config, a, c, &c);
+    ESCH_TEST_CHECK(ret == ESCH_ERROR_INVALID_PARAMETER,
+                    "Unexpected: divide by 0", ESCH_ERROR_INVALID_STATE);
+    ret = esch_fraction_compare(a, b, &cmp);
+    ESCH_TEST_CHECK(ret == ESCH_OK, "Failed to compare", ret);
+    ret = ESCH_ERROR_INVALID_STATE;
+    ESCH_TEST_CHECK(cmp > 0, "Bad compare result", ret);
+    ret = ESCH_OK;
+    esch_log_info(g_testLog, "[PASSED] Small arithmetic");
+
+    esch_log_info(g_testLog, "Case 3: Promote and demote");
+    ret = esch_fraction_new_from_int(config, 1, INT_MAX, &a);
+    ESCH_TEST_CHECK(ret == ESCH_OK, "Failed to create 1/INT_MAX", ret);
+    ret = esch_fraction_mul(config, a, a, &b);
+    ESCH_TEST_CHECK(ret == ESCH_OK, "Failed to multiply", ret);
+    ret = test_fractionExpect(b, "1/4611686014132420609");
+    ESCH_TEST_CHECK(ret == ESCH_OK, "Bad 1/INT_MAX^2", ret);
+    ret = esch_fraction_new_from_int(config, INT_MAX, 1, &c);
+    ESCH_TEST_CHECK(ret == ESCH_OK, "Failed to create INT_MAX", ret);
+    ret = esch_fraction_mul(config, b, c, &c);
+    ESCH_TEST_CHECK(ret == ESCH_OK, "Failed to multiply", ret);
+    ret = esch_fraction_compare(a, c, &cmp);
+    ESCH_TEST_CHECK(ret == ESCH_OK, "Failed to compare", ret);
+    ret = ESCH_ERROR_INVALID_STATE;
+    ESCH_TEST_CHECK(cmp == 0 && !ESCH_FRACTION_IS_BIG(c),
+                    "Not demoted", ret);
+    ret = esch_fraction_get_denominator(config, c, &d);
+    ESCH_TEST_CHECK(ret == ESCH_OK, "Failed to get denominator", ret);
+    ret = esch_integer_to_int(d, &value);
+    ESCH_TEST_CHECK(ret == ESCH_OK, "Denominator not small", ret);
+    ret = ESCH_ERROR_INVALID_STATE;
+    ESCH_TEST_CHECK(value == INT_MAX, "Bad denominator", ret);
+    ret = ESCH_OK;
+    esch_log_info(g_testLog, "[PASSED] Promote and demote");
+
+    esch_log_info(g_testLog, "Case 4: Harmonic numbers");
+    ret = test_fractionHarmonic(config, 30, &a);
+    ESCH_TEST_CHECK(ret == ESCH_OK, "Failed to sum H(30)", ret);
+    ret = test_fractionExpect(a, "9304682830147/2329089562800");
+    ESCH_TEST_CHECK(ret == ESCH_OK, "Bad H(30)", ret);
+    ret = esch_fraction_get_numerator(config, a, &n);
+    ESCH_TEST_CHECK(ret == ESCH_OK, "Failed to get numerator", ret);
+    ret = test_integerExpect(n, "9304682830147");
+    ESCH_TEST_CHECK(ret == ESCH_OK, "Bad numerator", ret);
+    ret = test_fractionHarmonic(config, 100, &a);
+    ESCH_TEST_CHECK(ret == ESCH_OK, "Failed to sum H(100)", ret);
+    ret = test_fractionExpect(a, harmonic_100);
+    ESCH_TEST_CHECK(ret == ESCH_OK, "Bad H(100)", ret);
+    ret = esch_fraction_new_from_int(config, 5, 1, &b);
+    ESCH_TEST_CHECK(ret == ESCH_OK, "Failed to create 5", ret);
+    ret = esch_fraction_compare(a, b, &cmp);
+    ESCH_TEST_CHECK(ret == ESCH_OK, "Failed to compare", ret);
+    ret = ESCH_ERROR_INVALID_STATE;
+    ESCH_TEST_CHECK(cmp > 0, "Bad compare with 5", ret);
+    for (k = 100; k >= 1; --k)
+    {
+        ret = esch_fraction_new_from_int(config, 1, k, &b);
+        ESCH_TEST_CHECK(ret == ESCH_OK, "Failed to create 1/k", ret);
+        ret = esch_fraction_sub(config, a, b, &a);
+        ESCH_TEST_CHECK(ret == ESCH_OK, "Failed to subtract 1/k", ret);
+    }
+    ret = ESCH_ERROR_INVALID_STATE;
+    ESCH_TEST_CHECK(!ESCH_FRACTION_IS_BIG(a) && a->num == 0,
+                    "Not back to 0", ret);
+    ret = ESCH_OK;
+    esch_log_info(g_testLog, "[PASSED] Harmonic numbers");
+
+    esch_log_info(g_testLog, "Case 5: Short buffer");
+    ret = esch_fraction_new_from_int(config, -22, 7, &a);
+    ESCH_TEST_CHECK(ret == ESCH_OK, "Failed to create -22/7", ret);
+    ret = esch_fraction_to_base10(a, buffer, 5, &length);
+    ESCH_TEST_CHECK(ret == ESCH_ERROR_OUT_OF_BOUND,
+                    "Unexpected: -22/7 fits", ESCH_ERROR_INVALID_STATE);
+    ret = ESCH_ERROR_INVALID_STATE;
+    ESCH_TEST_CHECK(length == 5, "Bad length", ret);
+    ret = esch_fraction_to_base10(a, buffer, 6, &length);
+    ESCH_TEST_CHECK(ret == ESCH_OK, "Failed to print -22/7", ret);
+    ret = ESCH_ERROR_INVALID_STATE;
+    ESCH_TEST_CHECK(strcmp(buffer, "-22/7") == 0, "Bad -22/7", ret);
+    ret = ESCH_OK;
+    esch_log_info(g_testLog, "[PASSED] Short buffer");
 Exit:
+    if (gc != NULL)
+    {
+        (void)esch_object_delete(ESCH_CAST_TO_OBJECT(gc));
+    }
+    (void)esch_config_set_obj(config, ESCH_CONFIG_KEY_GC, NULL);
+    (void)esch_config_set_obj(config, ESCH_CONFIG_KEY_GC_NAIVE_ROOT, NULL);
     return ret;
 }
@@ -3,6 +3,8 @@
 #include "esch_utest.h"
 #include "esch_debug.h"
 #include "esch_pair.h"
+#include "esch_alloc.h"
+#include "esch_vector.h"
 
 esch_error test_pairBase(esch_config* config)
 {
@@ -204,3 +206,555 @@ Exit:
     }
     return ret;
 }
+
+esch_error test_pairPool(esch_config* config)
+{
+    esch_error ret = ESCH_OK;
+    esch_alloc* pool = NULL;
+    esch_alloc_pool* pool_data = NULL;
+    esch_gc* gc = NULL;
+    esch_vector* root = NULL;
+    esch_pair* list = NULL;
+    esch_pair* pair = NULL;
+    esch_value value1, value2, data;
+    esch_iterator iter;
+    esch_bool is_list = ESCH_FALSE;
+    void* buffer = NULL;
+    void* first = NULL;
+    const size_t len = 3000; /* More than one chunk */
+    size_t i = 0;
+
+    ret = esch_alloc_new_pair_pool(config, &pool);
+    ESCH_TEST_CHECK(ret == ESCH_OK, "pair:Can't create pool", ret);
+    pool_data = (esch_alloc_pool*)pool;
+
+    esch_log_info(g_testLog, "Case 1: Reuse cells.");
+    ret = esch_config_set_obj(config, ESCH_CONFIG_KEY_PAIR_ALLOC,
+                              ESCH_CAST_TO_OBJECT(pool));
+    ESCH_TEST_CHECK(ret == ESCH_OK, "pair:Can't set pair alloc", ret);
+    ret = esch_pair_new_empty(config, &pair);
+    ESCH_TEST_CHECK(ret == ESCH_OK, "pair:Can't create pair", ret);
+    first = ESCH_CAST_TO_OBJECT(pair);
+    ESCH_TEST_CHECK(ESCH_OBJECT_GET_ALLOC(ESCH_CAST_TO_OBJECT(pair)) ==
+                    pool && pool_data->inuse == 1,
+                    "pair:Pair not from pool", ESCH_ERROR_INVALID_STATE);
+    /* Leave a length hint in the cell. */
+    ret = esch_pair_is_list(pair, &is_list);
+    ESCH_TEST_CHECK(ret == ESCH_OK && is_list && pair->hint_length != 0,
+                    "pair:No hint on empty list", ESCH_ERROR_INVALID_STATE);
+    ret = esch_object_delete(ESCH_CAST_TO_OBJECT(pair));
+    ESCH_TEST_CHECK(ret == ESCH_OK, "pair:Can't delete pair", ret);
+    ret = esch_pair_new_empty(config, &pair);
+    ESCH_TEST_CHECK(ret == ESCH_OK, "pair:Can't create pair", ret);
+    ESCH_TEST_CHECK((void*)ESCH_CAST_TO_OBJECT(pair) == first,
+                    "pair:Cell not reused", ESCH_ERROR_INVALID_STATE);
+    ESCH_TEST_CHECK(pair->hint_length == 0,
+                    "pair:Reused cell keeps old hint",
+                    ESCH_ERROR_INVALID_STATE);
+    ret = esch_object_delete(ESCH_CAST_TO_OBJECT(pair));
+    ESCH_TEST_CHECK(ret == ESCH_OK, "pair:Can't delete pair", ret);
+    ret = esch_alloc_realloc(pool, NULL, pool_data->cell_size + 1,
+                             &buffer);
+    ESCH_TEST_CHECK(ret == ESCH_ERROR_INVALID_PARAMETER,
+                    "pair:Unexpected: big buffer from pool",
+                    ESCH_ERROR_INVALID_STATE);
+    ret = ESCH_OK;
+    esch_log_info(g_testLog, "[PASSED] Reuse cells.");
+
+    esch_log_info(g_testLog, "Case 2: List in pool, with GC.");
+    ret = esch_vector_new(config, &root);
+    ESCH_TEST_CHECK(ret == ESCH_OK, "pair:Can't create root", ret);
+    ret = esch_config_set_obj(config, ESCH_CONFIG_KEY_GC_NAIVE_ROOT,
+                              ESCH_CAST_TO_OBJECT(root));
+    ESCH_TEST_CHECK(ret == ESCH_OK, "pair:Can't set root", ret);
+    ret = esch_gc_new_naive_mark_sweep(config, &gc);
+    ESCH_TEST_CHECK(ret == ESCH_OK, "pair:Can't create gc", ret);
+    ret = esch_config_set_obj(config, ESCH_CONFIG_KEY_GC,
+                              ESCH_CAST_TO_OBJECT(gc));
+    ESCH_TEST_CHECK(ret == ESCH_OK, "pair:Can't set gc", ret);
+    ret = esch_pair_new_empty(config, &list);
+    ESCH_TEST_CHECK(ret == ESCH_OK, "pair:Can't create empty", ret);
+    for (i = 0; i < len; ++i) {
+        value1.type = ESCH_VALUE_TYPE_INTEGER;
+        value1.val.i = (int)i;
+        value2.type = ESCH_VALUE_TYPE_OBJECT;
+        value2.val.o = ESCH_CAST_TO_OBJECT(list);
+        ret = esch_pair_new(config, &value1, &value2, &list);
+        ESCH_TEST_CHECK(ret == ESCH_OK, "pair:Can't create pair", ret);
+    }
+    ESCH_TEST_CHECK(pool_data->inuse == len + 1,
+                    "pair:Bad cells in use", ESCH_ERROR_INVALID_STATE);
+    ret = esch_pair_is_list(list, &is_list);
+    ESCH_TEST_CHECK(ret == ESCH_OK && is_list,
+                    "pair:Pooled pairs not a list", ESCH_ERROR_INVALID_STATE);
+    ret = esch_object_get_iterator(ESCH_CAST_TO_OBJECT(list), &iter);
+    ESCH_TEST_CHECK(ret == ESCH_OK, "pair:Can't get iterator", ret);
+    for (i = len; i > 0; --i) {
+        ret = iter.get_value(&iter, &data);
+        ESCH_TEST_CHECK(ret == ESCH_OK, "pair:Can't get data", ret);
+        ESCH_TEST_CHECK(data.type == ESCH_VALUE_TYPE_INTEGER &&
+                        data.val.i == (int)(i - 1),
+                        "pair:Bad data", ESCH_ERROR_INVALID_STATE);
+        ret = iter.get_next(&iter);
+        ESCH_TEST_CHECK(ret == ESCH_OK, "pair:Can't get next", ret);
+    }
+    /* Deleting GC deletes all pairs, which go back to pool. */
+    ret = esch_object_delete(ESCH_CAST_TO_OBJECT(gc));
+    gc = NULL;
+    ESCH_TEST_CHECK(ret == ESCH_OK, "pair:Can't delete gc", ret);
+    ESCH_TEST_CHECK(pool_data->inuse == 0,
+                    "pair:Cells not returned", ESCH_ERROR_INVALID_STATE);
+    ret = ESCH_OK;
+    esch_log_info(g_testLog, "[PASSED] List in pool, with GC.");
+Exit:
+    if (gc != NULL) {
+        esch_object_delete(ESCH_CAST_TO_OBJECT(gc));
+    }
+    esch_config_set_obj(config, ESCH_CONFIG_KEY_GC, NULL);
+    esch_config_set_obj(config, ESCH_CONFIG_KEY_GC_NAIVE_ROOT, NULL);
+    esch_config_set_obj(config, ESCH_CONFIG_KEY_PAIR_ALLOC, NULL);
+    if (pool != NULL) {
+        esch_object_delete(ESCH_CAST_TO_OBJECT(pool));
+    }
+    return ret;
+}
+
+esch_error test_pairList(esch_config* config)
+{
+    esch_error ret = ESCH_OK;
+    esch_alloc* pool = NULL;
+    esch_alloc_pool* pool_data = NULL;
+    esch_gc* gc = NULL;
+    esch_vector* root = NULL;
+    esch_pair* list = NULL;
+    esch_pair* each = NULL;
+    esch_pair* middle = NULL;
+    esch_value values[3000];
+    esch_value data;
+    esch_iterator iter;
+    esch_bool is_list = ESCH_FALSE;
+    const size_t len = 3000; /* More than one chunk */
+    size_t i = 0, count = 0, adjacent = 0;
+
+    for (i = 0; i < len; ++i) {
+        values[i].type = ESCH_VALUE_TYPE_INTEGER;
+        values[i].val.i = (int)i;
+    }
+
+    esch_log_info(g_testLog, "Case 1: List without pool.");
+    ret = esch_pair_list_from_values(config, values, 10, &list);
+    ESCH_TEST_CHECK(ret == ESCH_OK, "pair:Can't create list", ret);
+    ret = esch_pair_is_list(list, &is_list);
+    ESCH_TEST_CHECK(ret == ESCH_OK && is_list,
+                    "pair:Not a list", ESCH_ERROR_INVALID_STATE);
+    ret = esch_object_get_iterator(ESCH_CAST_TO_OBJECT(list), &iter);
+    ESCH_TEST_CHECK(ret == ESCH_OK, "pair:Can't get iterator", ret);
+    for (i = 0; i < 10; ++i) {
+        ret = iter.get_value(&iter, &data);
+        ESCH_TEST_CHECK(ret == ESCH_OK && data.val.i == (int)i,
+                        "pair:Bad data", ESCH_ERROR_INVALID_STATE);
+        ret = iter.get_next(&iter);
+        ESCH_TEST_CHECK(ret == ESCH_OK, "pair:Can't get next", ret);
+    }
+    ret = iter.get_value(&iter, &data);
+    ESCH_TEST_CHECK(ret == ESCH_OK && data.type == ESCH_VALUE_TYPE_END,
+                    "pair:List not end", ESCH_ERROR_INVALID_STATE);
+    while (list != NULL) {
+        each = (ESCH_PAIR_NEXT_IS_PAIR(list)?
+                ESCH_CAST_FROM_OBJECT(list->data[1].o, esch_pair): NULL);
+        ret = esch_object_delete(ESCH_CAST_TO_OBJECT(list));
+        ESCH_TEST_CHECK(ret == ESCH_OK, "pair:Can't delete pair", ret);
+        list = each;
+    }
+    ret = esch_pair_list_from_values(config, NULL, 0, &list);
+    ESCH_TEST_CHECK(ret == ESCH_OK, "pair:Can't create empty list", ret);
+    ret = esch_pair_is_list(list, &is_list);
+    ESCH_TEST_CHECK(ret == ESCH_OK && is_list &&
+                    !ESCH_PAIR_NEXT_IS_PAIR(list),
+                    "pair:Bad empty list", ESCH_ERROR_INVALID_STATE);
+    ret = esch_object_delete(ESCH_CAST_TO_OBJECT(list));
+    ESCH_TEST_CHECK(ret == ESCH_OK, "pair:Can't delete pair", ret);
+    list = NULL;
+    esch_log_info(g_testLog, "[PASSED] List without pool.");
+
+    esch_log_info(g_testLog, "Case 2: Adjacent pairs from pool.");
+    ret = esch_alloc_new_pair_pool(config, &pool);
+    ESCH_TEST_CHECK(ret == ESCH_OK, "pair:Can't create pool", ret);
+    pool_data = (esch_alloc_pool*)pool;
+    ret = esch_config_set_obj(config, ESCH_CONFIG_KEY_PAIR_ALLOC,
+                              ESCH_CAST_TO_OBJECT(pool));
+    ESCH_TEST_CHECK(ret == ESCH_OK, "pair:Can't set pair alloc", ret);
+    ret = esch_vector_new(config, &root);
+    ESCH_TEST_CHECK(ret == ESCH_OK, "pair:Can't create root", ret);
+    ret = esch_config_set_obj(config, ESCH_CONFIG_KEY_GC_NAIVE_ROOT,
+                              ESCH_CAST_TO_OBJECT(root));
+    ESCH_TEST_CHECK(ret == ESCH_OK, "pair:Can't set root", ret);
+    ret = esch_gc_new_naive_mark_sweep(config, &gc);
+    ESCH_TEST_CHECK(ret == ESCH_OK, "pair:Can't create gc", ret);
+    ret = esch_config_set_obj(config, ESCH_CONFIG_KEY_GC,
+                              ESCH_CAST_TO_OBJECT(gc));
+    ESCH_TEST_CHECK(ret == ESCH_OK, "pair:Can't set gc", ret);
+
+    ret = esch_pair_list_from_values(config, values, len, &list);
+    ESCH_TEST_CHECK(ret == ESCH_OK, "pair:Can't create list", ret);
+    ESCH_TEST_CHECK(pool_data->inuse == len + 1,
+                    "pair:Bad cells in use", ESCH_ERROR_INVALID_STATE);
+    each = list;
+    for (i = 0; i < len; ++i) {
+        ESCH_TEST_CHECK(ESCH_PAIR_NEXT_IS_PAIR(each),
+                        "pair:Tail is not pair", ESCH_ERROR_INVALID_STATE);
+        if (ESCH_PAIR_NEXT_IS_ADJACENT(each)) {
+            ESCH_TEST_CHECK(ESCH_CAST_TO_OBJECT(ESCH_PAIR_ADJACENT_NEXT(
+                                each)) == each->data[1].o,
+                            "pair:Bad adjacent flag",
+                            ESCH_ERROR_INVALID_STATE);
+            ++adjacent;
+        }
+        if (i == len / 2) {
+            middle = each;
+        }
+        each = ESCH_CAST_FROM_OBJECT(each->data[1].o, esch_pair);
+    }
+    /* Only a few chunk boundaries break the runs. */
+    ESCH_TEST_CHECK(adjacent + 5 > len,
+                    "pair:Cells not adjacent", ESCH_ERROR_INVALID_STATE);
+    esch_log_info(g_testLog, "[PASSED] Adjacent pairs from pool.");
+
+    esch_log_info(g_testLog, "Case 3: Set tail breaks a run.");
+    each = middle;
+    for (i = 0; i < 3; ++i) {
+        ret = esch_pair_get_tail(each, &data);
+        ESCH_TEST_CHECK(ret == ESCH_OK, "pair:Can't get tail", ret);
+        each = ESCH_CAST_FROM_OBJECT(data.val.o, esch_pair);
+    }
+    ret = esch_pair_set_tail(middle, &data); /* Skip two elements */
+    ESCH_TEST_CHECK(ret == ESCH_OK && ESCH_PAIR_NEXT_IS_PAIR(middle) &&
+                    !ESCH_PAIR_NEXT_IS_ADJACENT(middle),
+                    "pair:Run not broken", ESCH_ERROR_INVALID_STATE);
+    ret = esch_object_get_iterator(ESCH_CAST_TO_OBJECT(list), &iter);
+    ESCH_TEST_CHECK(ret == ESCH_OK, "pair:Can't get iterator", ret);
+    count = 0;
+    i = 0;
+    while (ESCH_TRUE) {
+        ret = iter.get_value(&iter, &data);
+        ESCH_TEST_CHECK(ret == ESCH_OK, "pair:Can't get data", ret);
+        if (data.type == ESCH_VALUE_TYPE_END) {
+            break;
+        }
+        ESCH_TEST_CHECK(data.val.i == (int)i,
+                        "pair:Bad data", ESCH_ERROR_INVALID_STATE);
+        i += (i == len / 2? 3: 1);
+        ++count;
+        ret = iter.get_next(&iter);
+        ESCH_TEST_CHECK(ret == ESCH_OK, "pair:Can't get next", ret);
+    }
+    ESCH_TEST_CHECK(count == len - 2, "pair:Bad count",
+                    ESCH_ERROR_INVALID_STATE);
+    /* Deleting GC deletes all pairs, which go back to pool. */
+    ret = esch_object_delete(ESCH_CAST_TO_OBJECT(gc));
+    gc = NULL;
+    ESCH_TEST_CHECK(ret == ESCH_OK, "pair:Can't delete gc", ret);
+    ESCH_TEST_CHECK(pool_data->inuse == 0,
+                    "pair:Cells not returned", ESCH_ERROR_INVALID_STATE);
+    esch_log_info(g_testLog, "[PASSED] Set tail breaks a run.");
+Exit:
+    if (gc != NULL) {
+        esch_object_delete(ESCH_CAST_TO_OBJECT(gc));
+    }
+    esch_config_set_obj(config, ESCH_CONFIG_KEY_GC, NULL);
+    esch_config_set_obj(config, ESCH_CONFIG_KEY_GC_NAIVE_ROOT, NULL);
+    esch_config_set_obj(config, ESCH_CONFIG_KEY_PAIR_ALLOC, NULL);
+    if (pool != NULL) {
+        esch_object_delete(ESCH_CAST_TO_OBJECT(pool));
+    }
+    return ret;
+}
+
+esch_error test_pairLength(esch_config* config)
+{
+    esch_error ret = ESCH_OK;
+    esch_gc* gc = NULL;
+    esch_vector* root = NULL;
+    esch_pair* list = NULL;
+    esch_pair* pair = NULL;
+    esch_pair* middle = NULL;
+    esch_pair* ring = NULL;
+    esch_value values[100];
+    esch_value value1, value2;
+    esch_bool is_list = ESCH_FALSE;
+    size_t length = 0;
+    size_t i = 0;
+
+    ret = esch_vector_new(config, &root);
+    ESCH_TEST_CHECK(ret == ESCH_OK, "pair:Can't create root", ret);
+    ret = esch_config_set_obj(config, ESCH_CONFIG_KEY_GC_NAIVE_ROOT,
+                              ESCH_CAST_TO_OBJECT(root));
+    ESCH_TEST_CHECK(ret == ESCH_OK, "pair:Can't set root", ret);
+    ret = esch_gc_new_naive_mark_sweep(config, &gc);
+    ESCH_TEST_CHECK(ret == ESCH_OK, "pair:Can't create gc", ret);
+    ret = esch_config_set_obj(config, ESCH_CONFIG_KEY_GC,
+                              ESCH_CAST_TO_OBJECT(gc));
+    ESCH_TEST_CHECK(ret == ESCH_OK, "pair:Can't set gc", ret);
+
+    esch_log_info(g_testLog, "Case 1: Length and hints.");
+    ret = esch_pair_new_empty(config, &list);
+    ESCH_TEST_CHECK(ret == ESCH_OK, "pair:Can't create empty", ret);
+    ret = esch_pair_list_length(list, &length);
+    ESCH_TEST_CHECK(ret == ESCH_OK && length == 0,
+                    "pair:Bad length of empty", ESCH_ERROR_INVALID_STATE);
+    value1.type = ESCH_VALUE_TYPE_INTEGER;
+    value2.type = ESCH_VALUE_TYPE_OBJECT;
+    for (i = 0; i < 100; ++i) {
+        value1.val.i = (int)i;
+        value2.val.o = ESCH_CAST_TO_OBJECT(list);
+        ret = esch_pair_new(config, &value1, &value2, &list);
+        ESCH_TEST_CHECK(ret == ESCH_OK, "pair:Can't create pair", ret);
+        if (i == 50) {
+            middle = list;
+        }
+    }
+    ESCH_TEST_CHECK(list->hint_length == 0,
+                    "pair:Unexpected hint", ESCH_ERROR_INVALID_STATE);
+    ret = esch_pair_list_length(list, &length);
+    ESCH_TEST_CHECK(ret == ESCH_OK && length == 100,
+                    "pair:Bad length", ESCH_ERROR_INVALID_STATE);
+    ESCH_TEST_CHECK(list->hint_length == 101 &&
+                    middle->hint_length == 52,
+                    "pair:Hint not kept", ESCH_ERROR_INVALID_STATE);
+    /* A new pair only walks to the first hint. */
+    value1.val.i = 100;
+    value2.val.o = ESCH_CAST_TO_OBJECT(list);
+    ret = esch_pair_new(config, &value1, &value2, &list);
+    ESCH_TEST_CHECK(ret == ESCH_OK, "pair:Can't create pair", ret);
+    ret = esch_pair_is_list(list, &is_list);
+    ESCH_TEST_CHECK(ret == ESCH_OK && is_list && list->hint_length == 102,
+                    "pair:Bad hint of new pair", ESCH_ERROR_INVALID_STATE);
+    /* Improper list */
+    value2.type = ESCH_VALUE_TYPE_INTEGER;
+    value2.val.i = 0;
+    ret = esch_pair_new(config, &value1, &value2, &pair);
+    ESCH_TEST_CHECK(ret == ESCH_OK, "pair:Can't create pair", ret);
+    ret = esch_pair_list_length(pair, &length);
+    ESCH_TEST_CHECK(ret == ESCH_ERROR_BAD_VALUE_TYPE,
+                    "pair:Improper list has length",
+                    ESCH_ERROR_INVALID_STATE);
+    ret = ESCH_OK;
+    esch_log_info(g_testLog, "[PASSED] Length and hints.");
+
+    esch_log_info(g_testLog, "Case 2: Set tail invalidates hints.");
+    value2.type = ESCH_VALUE_TYPE_INTEGER;
+    value2.val.i = 12345;
+    ret = esch_pair_get_tail(middle, &value1);
+    ESCH_TEST_CHECK(ret == ESCH_OK, "pair:Can't get tail", ret);
+    ret = esch_pair_set_tail(middle, &value2);
+    ESCH_TEST_CHECK(ret == ESCH_OK, "pair:Can't set tail", ret);
+    ret = esch_pair_is_list(list, &is_list);
+    ESCH_TEST_CHECK(ret == ESCH_OK && !is_list,
+                    "pair:Stale hint used", ESCH_ERROR_INVALID_STATE);
+    ret = esch_pair_set_tail(middle, &value1);
+    ESCH_TEST_CHECK(ret == ESCH_OK, "pair:Can't set tail", ret);
+    ret = esch_pair_list_length(list, &length);
+    ESCH_TEST_CHECK(ret == ESCH_OK && length == 101,
+                    "pair:Bad length after set tail",
+                    ESCH_ERROR_INVALID_STATE);
+    /* Head of empty decides if list ends there. */
+    pair = list;
+    while (ESCH_PAIR_NEXT_IS_PAIR(pair)) {
+        pair = ESCH_CAST_FROM_OBJECT(pair->data[1].o, esch_pair);
+    }
+    value2.val.i = 1;
+    ret = esch_pair_set_head(pair, &value2);
+    ESCH_TEST_CHECK(ret == ESCH_OK, "pair:Can't set head", ret);
+    ret = esch_pair_is_list(list, &is_list);
+    ESCH_TEST_CHECK(ret == ESCH_OK && !is_list,
+                    "pair:Stale hint used", ESCH_ERROR_INVALID_STATE);
+    value2.type = ESCH_VALUE_TYPE_END;
+    ret = esch_pair_set_head(pair, &value2);
+    ESCH_TEST_CHECK(ret == ESCH_OK, "pair:Can't set head", ret);
+    ret = esch_pair_is_list(list, &is_list);
+    ESCH_TEST_CHECK(ret == ESCH_OK && is_list,
+                    "pair:Not list again", ESCH_ERROR_INVALID_STATE);
+    /* Queue-like use: length, then set tail, many times. Every round
+     * starts a new epoch, and hints still work after all of them. */
+    for (i = 0; i < 70000; ++i) {
+        ret = esch_pair_list_length(list, &length);
+        ESCH_TEST_CHECK(ret == ESCH_OK && length == 101,
+                        "pair:Bad length in loop", ESCH_ERROR_INVALID_STATE);
+        ret = esch_pair_set_tail(middle, &value1);
+        ESCH_TEST_CHECK(ret == ESCH_OK, "pair:Can't set tail", ret);
+    }
+    ret = esch_pair_list_length(list, &length);
+    ESCH_TEST_CHECK(ret == ESCH_OK && length == 101 &&
+                    list->hint_length == 102,
+                    "pair:Hints off after many epochs",
+                    ESCH_ERROR_INVALID_STATE);
+    /* Whole list from values has hints at once. */
+    for (i = 0; i < 100; ++i) {
+        values[i].type = ESCH_VALUE_TYPE_INTEGER;
+        values[i].val.i = (int)i;
+    }
+    ret = esch_pair_list_from_values(config, values, 100, &pair);
+    ESCH_TEST_CHECK(ret == ESCH_OK && pair->hint_length == 101,
+                    "pair:No hint on new list", ESCH_ERROR_INVALID_STATE);
+    esch_log_info(g_testLog, "[PASSED] Set tail invalidates hints.");
+
+    esch_log_info(g_testLog, "Case 3: Circular lists.");
+    /* A pair points to itself. */
+    ret = esch_pair_new_empty(config, &ring);
+    ESCH_TEST_CHECK(ret == ESCH_OK, "pair:Can't create pair", ret);
+    value1.type = ESCH_VALUE_TYPE_OBJECT;
+    value1.val.o = ESCH_CAST_TO_OBJECT(ring);
+    ret = esch_pair_set_tail(ring, &value1);
+    ESCH_TEST_CHECK(ret == ESCH_OK, "pair:Can't set tail", ret);
+    ret = esch_pair_is_list(ring, &is_list);
+    ESCH_TEST_CHECK(ret == ESCH_OK && !is_list,
+                    "pair:Ring is list", ESCH_ERROR_INVALID_STATE);
+    /* Last pair of a long list points back to middle. */
+    pair = list;
+    while (ESCH_PAIR_NEXT_IS_PAIR(
+                ESCH_CAST_FROM_OBJECT(pair->data[1].o, esch_pair))) {
+        pair = ESCH_CAST_FROM_OBJECT(pair->data[1].o, esch_pair);
+    }
+    value1.val.o = ESCH_CAST_TO_OBJECT(middle);
+    ret = esch_pair_set_tail(pair, &value1);
+    ESCH_TEST_CHECK(ret == ESCH_OK, "pair:Can't set tail", ret);
+    ret = esch_pair_is_list(list, &is_list);
+    ESCH_TEST_CHECK(ret == ESCH_OK && !is_list,
+                    "pair:Circular list is list", ESCH_ERROR_INVALID_STATE);
+    ret = esch_pair_list_length(middle, &length);
+    ESCH_TEST_CHECK(ret == ESCH_ERROR_BAD_VALUE_TYPE,
+                    "pair:Circular list has length",
+                    ESCH_ERROR_INVALID_STATE);
+    ret = ESCH_OK;
+    esch_log_info(g_testLog, "[PASSED] Circular lists.");
+Exit:
+    if (gc != NULL) {
+        esch_object_delete(ESCH_CAST_TO_OBJECT(gc));
+    }
+    esch_config_set_obj(config, ESCH_CONFIG_KEY_GC, NULL);
+    esch_config_set_obj(config, ESCH_CONFIG_KEY_GC_NAIVE_ROOT, NULL);
+    return ret;
+}
+
+esch_error test_pairVector(esch_config* config)
+{
+    esch_error ret = ESCH_OK;
+    esch_gc* gc = NULL;
+    esch_vector* root = NULL;
+    esch_vector* vec = NULL;
+    esch_vector* back = NULL;
+    esch_pair* list = NULL;
+    esch_pair* pair = NULL;
+    esch_value value1, value2, data;
+    esch_iterator iter;
+    const size_t len = 500;
+    size_t length = 0;
+    size_t i = 0;
+    int layout = 0;
+
+    ret = esch_vector_new(config, &root);
+    ESCH_TEST_CHECK(ret == ESCH_OK, "pair:Can't create root", ret);
+    ret = esch_config_set_obj(config, ESCH_CONFIG_KEY_GC_NAIVE_ROOT,
+                              ESCH_CAST_TO_OBJECT(root));
+    ESCH_TEST_CHECK(ret == ESCH_OK, "pair:Can't set root", ret);
+    ret = esch_gc_new_naive_mark_sweep(config, &gc);
+    ESCH_TEST_CHECK(ret == ESCH_OK, "pair:Can't create gc", ret);
+    ret = esch_config_set_obj(config, ESCH_CONFIG_KEY_GC,
+                              ESCH_CAST_TO_OBJECT(gc));
+    ESCH_TEST_CHECK(ret == ESCH_OK, "pair:Can't set gc", ret);
+
+    esch_log_info(g_testLog, "Case 1: Vector to list and back.");
+    for (layout = ESCH_VECTOR_LAYOUT_MIXED;
+         layout <= ESCH_VECTOR_LAYOUT_SPLIT; ++layout) {
+        ret = esch_config_set_int(config, ESCH_CONFIG_KEY_VECTOR_LAYOUT,
+                                  layout);
+        ESCH_TEST_CHECK(ret == ESCH_OK, "pair:Can't set layout", ret);
+        ret = esch_vector_new(config, &vec);
+        ESCH_TEST_CHECK(ret == ESCH_OK, "pair:Can't create vector", ret);
+        vec->enlarge = ESCH_TRUE;
+        for (i = 0; i < len; ++i) {
+            ret = esch_vector_append_integer(vec, (int)i);
+            ESCH_TEST_CHECK(ret == ESCH_OK, "pair:Can't append", ret);
+        }
+        ret = esch_vector_append_object(vec, ESCH_CAST_TO_OBJECT(root));
+        ESCH_TEST_CHECK(ret == ESCH_OK, "pair:Can't append", ret);
+        ret = esch_vector_to_list(config, vec, &list);
+        ESCH_TEST_CHECK(ret == ESCH_OK, "pair:Can't convert vector", ret);
+        ret = esch_pair_list_length(list, &length);
+        ESCH_TEST_CHECK(ret == ESCH_OK && length == len + 1,
+                        "pair:Bad length", ESCH_ERROR_INVALID_STATE);
+        ret = esch_object_get_iterator(ESCH_CAST_TO_OBJECT(list), &iter);
+        ESCH_TEST_CHECK(ret == ESCH_OK, "pair:Can't get iterator", ret);
+        for (i = 0; i < len; ++i) {
+            ret = iter.get_value(&iter, &data);
+            ESCH_TEST_CHECK(ret == ESCH_OK &&
+                            data.type == ESCH_VALUE_TYPE_INTEGER &&
+                            data.val.i == (int)i,
+                            "pair:Bad data", ESCH_ERROR_INVALID_STATE);
+            ret = iter.get_next(&iter);
+            ESCH_TEST_CHECK(ret == ESCH_OK, "pair:Can't get next", ret);
+        }
+        ret = iter.get_value(&iter, &data);
+        ESCH_TEST_CHECK(ret == ESCH_OK &&
+                        data.type == ESCH_VALUE_TYPE_OBJECT &&
+                        data.val.o == ESCH_CAST_TO_OBJECT(root),
+                        "pair:Bad object", ESCH_ERROR_INVALID_STATE);
+
+        ret = esch_list_to_vector(config, list, &back);
+        ESCH_TEST_CHECK(ret == ESCH_OK, "pair:Can't convert list", ret);
+        ESCH_TEST_CHECK(back->length == len + 1 &&
+                        back->layout == (esch_vector_layout)layout,
+                        "pair:Bad vector", ESCH_ERROR_INVALID_STATE);
+        for (i = 0; i <= len; ++i) {
+            esch_vector_read_i(vec, i, &value1);
+            esch_vector_read_i(back, i, &value2);
+            ESCH_TEST_CHECK(value1.type == value2.type &&
+                            (value1.type == ESCH_VALUE_TYPE_OBJECT?
+                             value1.val.o == value2.val.o:
+                             value1.val.i == value2.val.i),
+                            "pair:Values not same", ESCH_ERROR_INVALID_STATE);
+        }
+    }
+    (void)esch_config_set_int(config, ESCH_CONFIG_KEY_VECTOR_LAYOUT,
+                              ESCH_VECTOR_LAYOUT_MIXED);
+    /* Not a list */
+    value1.type = ESCH_VALUE_TYPE_INTEGER;
+    value1.val.i = 1;
+    ret = esch_pair_new(config, &value1, &value1, &pair);
+    ESCH_TEST_CHECK(ret == ESCH_OK, "pair:Can't create pair", ret);
+    back = NULL;
+    ret = esch_list_to_vector(config, pair, &back);
+    ESCH_TEST_CHECK(ret == ESCH_ERROR_BAD_VALUE_TYPE && back == NULL,
+                    "pair:Unexpected: pair to vector",
+                    ESCH_ERROR_INVALID_STATE);
+    esch_log_info(g_testLog, "Expected failure captured");
+    ret = ESCH_OK;
+    esch_log_info(g_testLog, "[PASSED] Vector to list and back.");
+
+    esch_log_info(g_testLog, "Case 2: GC keeps every pair of a list.");
+    ret = esch_vector_append_object(root, ESCH_CAST_TO_OBJECT(list));
+    ESCH_TEST_CHECK(ret == ESCH_OK, "pair:Can't keep list", ret);
+    /* A circular list must not hang GC. */
+    value2.type = ESCH_VALUE_TYPE_OBJECT;
+    value2.val.o = ESCH_CAST_TO_OBJECT(pair);
+    ret = esch_pair_set_tail(pair, &value2);
+    ESCH_TEST_CHECK(ret == ESCH_OK, "pair:Can't set tail", ret);
+    ret = esch_vector_append_object(root, ESCH_CAST_TO_OBJECT(pair));
+    ESCH_TEST_CHECK(ret == ESCH_OK, "pair:Can't keep pair", ret);
+    ret = esch_gc_recycle(gc);
+    ESCH_TEST_CHECK(ret == ESCH_OK, "pair:Can't recycle", ret);
+    ret = esch_pair_list_length(list, &length);
+    ESCH_TEST_CHECK(ret == ESCH_OK && length == len + 1,
+                    "pair:Bad length after GC", ESCH_ERROR_INVALID_STATE);
+    ret = esch_list_to_vector(config, list, &back);
+    ESCH_TEST_CHECK(ret == ESCH_OK && back->length == len + 1,
+                    "pair:Bad list after GC", ESCH_ERROR_INVALID_STATE);
+    esch_log_info(g_testLog, "[PASSED] GC keeps every pair of a list.");
+Exit:
+    if (gc != NULL) {
+        esch_object_delete(ESCH_CAST_TO_OBJECT(gc));
+    }
+    esch_config_set_obj(config, ESCH_CONFIG_KEY_GC, NULL);
+    esch_config_set_obj(config, ESCH_CONFIG_KEY_GC_NAIVE_ROOT, NULL);
+    return ret;
+}
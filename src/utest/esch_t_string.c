@@ -6,6 +6,8 @@
 #include <string.h>
 #include "esch_config.h"
 #include "esch_alloc.h"
+#include "esch_vector.h"
+#include "esch_gc.h"
 
 static size_t unicode_len_i(esch_unicode* ustr)
 {
@@ -51,12 +53,34 @@ esch_error test_string(esch_config* config)
     esch_unicode output[] = { 0x4F60, 0x597D, 0 };
     size_t input_len = 6;
     size_t output_len = 2;
+    /* Overlong, surrogate, out of range, truncated, stray byte. */
+    const char* bad_input[] = {
+        "\xc0\x80", "\xe0\x80\xaf", "\xf0\x8f\xbf\xbf",
+        "\xed\xa0\x80", "\xf4\x90\x80\x80", "\xf5\x80\x80\x80",
+        "abcdefghijklmnopqrstuvwxyz\xe4\xbd", "\xe4\xbd\xa0\xbf",
+        NULL
+    };
+    /* 20 ASCII characters, hello in Chinese, U+1F600 and U+10FFFF */
+    const char* mixed_input =
+        "abcdefghijklmnopqrst\xe4\xbd\xa0\xe5\xa5\xbd"
+        "\xf0\x9f\x98\x80\xf4\x8f\xbf\xbf!";
+    esch_unicode mixed_output[] = {
+        'a', 'b', 'c', 'd', 'e', 'f', 'g', 'h', 'i', 'j',
+        'k', 'l', 'm', 'n', 'o', 'p', 'q', 'r', 's', 't',
+        0x4F60, 0x597D, 0x1F600, 0x10FFFF, '!', 0
+    };
+    size_t i = 0;
+    esch_unicode ch = 0;
 
     esch_log_info(g_testLog, "Case 1: Create a string from UTF-8 input.");
     ret = esch_string_new_from_utf8(config, input, 0, -1, &str);
     ESCH_TEST_CHECK(ret == ESCH_OK && str != NULL,
             "Failed to create string - begin = 0, end = -1", ret);
     ret = ESCH_ERROR_INVALID_STATE;
+    ESCH_TEST_CHECK(str->unicode == NULL,
+            "Unicode buffer created before it's used", ret);
+    ESCH_TEST_CHECK(esch_string_get_unicode_ref(str) != NULL,
+            "Can't create Unicode buffer", ret);
     ESCH_TEST_CHECK(unicode_len_i(str->unicode) == 2,
             "Unicode conversion error: length != 2 - begin = 3, end = 6", ret);
     ret = ESCH_ERROR_INVALID_STATE;
@@ -89,7 +113,7 @@ esch_error test_string(esch_config* config)
     ESCH_TEST_CHECK(ret == ESCH_OK && str != NULL,
             "Failed to create string - begin = 3, end = 6", ret);
     ret = ESCH_ERROR_INVALID_STATE;
-    ESCH_TEST_CHECK(str->unicode[0] == output[1],
+    ESCH_TEST_CHECK(esch_string_get_unicode_ref(str)[0] == output[1],
             "Unicode conversion error: bad content - begin = 3, end = 6", ret);
     ESCH_TEST_CHECK(str->unicode[1] == 0,
             "Unicode conversion error: bad content - longer string", ret);
@@ -127,7 +151,490 @@ esch_error test_string(esch_config* config)
     ESCH_TEST_CHECK(ret == ESCH_OK, "Failed to delete string", ret);
     esch_log_info(g_testLog, "[PASSED] Duplicate existing string");
 
+    esch_log_info(g_testLog, "Case 5: Reject ill-formed UTF-8");
+    for (i = 0; bad_input[i] != NULL; ++i)
+    {
+        str = NULL;
+        ret = esch_string_new_from_utf8(config, bad_input[i], 0, -1, &str);
+        ESCH_TEST_CHECK(ret != ESCH_OK && str == NULL,
+                "Unexpected: create string from ill-formed UTF-8", ret);
+    }
+    ret = ESCH_OK;
+    esch_log_info(g_testLog, "[PASSED] Reject ill-formed UTF-8");
+
+    esch_log_info(g_testLog, "Case 6: Long string with mixed characters");
+    ret = esch_string_new_from_utf8(config, mixed_input, 0, -1, &str);
+    ESCH_TEST_CHECK(ret == ESCH_OK && str != NULL,
+            "Failed to create mixed string", ret);
+    ret = ESCH_ERROR_INVALID_STATE;
+    ESCH_TEST_CHECK(esch_string_get_unicode_length(str) ==
+                    unicode_len_i(mixed_output),
+            "Mixed string: bad Unicode length", ret);
+    ESCH_TEST_CHECK(unicode_compare_i(esch_string_get_unicode_ref(str),
+                                      mixed_output) == 0,
+            "Mixed string: bad Unicode content", ret);
+    ret = esch_object_cast_to_object(str, &str_obj);
+    ESCH_TEST_CHECK(ret == ESCH_OK, "failed to cast to object", ret);
+    ret = esch_object_delete(str_obj);
+    ESCH_TEST_CHECK(ret == ESCH_OK, "Failed to delete string", ret);
+    esch_log_info(g_testLog, "[PASSED] Long string with mixed characters");
+
+    esch_log_info(g_testLog, "Case 7: Get characters by index");
+    ret = esch_string_new_from_utf8(config, "lambda", 0, -1, &str);
+    ESCH_TEST_CHECK(ret == ESCH_OK && str != NULL,
+            "Failed to create ASCII string", ret);
+    ret = esch_string_get_unicode_at(str, 5, &ch);
+    ESCH_TEST_CHECK(ret == ESCH_OK && ch == 'a',
+            "Bad character from ASCII string", ret);
+    ret = ESCH_ERROR_INVALID_STATE;
+    ESCH_TEST_CHECK(str->unicode == NULL,
+            "ASCII string should not create Unicode buffer", ret);
+    ret = esch_string_get_unicode_at(str, 6, &ch);
+    ESCH_TEST_CHECK(ret == ESCH_ERROR_OUT_OF_BOUND,
+            "Index out of range is not detected", ret);
+    ret = esch_object_delete(ESCH_CAST_TO_OBJECT(str));
+    ESCH_TEST_CHECK(ret == ESCH_OK, "Failed to delete string", ret);
+
+    ret = esch_string_new_from_utf8(config, mixed_input, 0, -1, &str);
+    ESCH_TEST_CHECK(ret == ESCH_OK && str != NULL,
+            "Failed to create mixed string", ret);
+    ret = esch_string_get_unicode_at(str, 22, &ch);
+    ESCH_TEST_CHECK(ret == ESCH_OK && ch == 0x1F600,
+            "Bad character from mixed string", ret);
+    ret = esch_object_delete(ESCH_CAST_TO_OBJECT(str));
+    ESCH_TEST_CHECK(ret == ESCH_OK, "Failed to delete string", ret);
+    esch_log_info(g_testLog, "[PASSED] Get characters by index");
+
+    esch_log_info(g_testLog, "Case 8: Short string in one allocation");
+    /* 23 bytes is the longest inline string. */
+    ret = esch_string_new_from_utf8(config, mixed_input, 0, 23, &str);
+    ESCH_TEST_CHECK(ret == ESCH_OK && str != NULL,
+            "Failed to create short string", ret);
+    ret = ESCH_ERROR_INVALID_STATE;
+    ESCH_TEST_CHECK(str->utf8 == ESCH_STRING_INLINE_UTF8(str) &&
+                    esch_string_get_utf8_ref(str) == str->utf8,
+            "Short string does not use inline buffer", ret);
+    ESCH_TEST_CHECK(strncmp(str->utf8, mixed_input, 23) == 0 &&
+                    str->utf8[23] == '\0',
+            "Bad content of short string", ret);
+    ESCH_TEST_CHECK(esch_string_get_unicode_length(str) == 21 &&
+                    esch_string_get_unicode_ref(str)[20] == 0x4F60,
+            "Bad Unicode of short string", ret);
+    ret = esch_string_duplicate(str, &str_dup);
+    ESCH_TEST_CHECK(ret == ESCH_OK && str_dup->utf8 != str->utf8 &&
+                    strcmp(str_dup->utf8, str->utf8) == 0,
+            "Failed to duplicate short string", ret);
+    (void)esch_object_delete(ESCH_CAST_TO_OBJECT(str_dup));
+    ret = esch_object_delete(ESCH_CAST_TO_OBJECT(str));
+    ESCH_TEST_CHECK(ret == ESCH_OK, "Failed to delete string", ret);
+
+    ret = esch_string_new_from_utf8(config, mixed_input, 0, 26, &str);
+    ESCH_TEST_CHECK(ret == ESCH_OK && str != NULL,
+            "Failed to create long string", ret);
+    ret = ESCH_ERROR_INVALID_STATE;
+    ESCH_TEST_CHECK(!ESCH_STRING_IS_INLINE(str),
+            "Long string should not use inline buffer", ret);
+    ret = esch_object_delete(ESCH_CAST_TO_OBJECT(str));
+    ESCH_TEST_CHECK(ret == ESCH_OK, "Failed to delete string", ret);
+    esch_log_info(g_testLog, "[PASSED] Short string in one allocation");
+
+Exit:
+    return ret;
+}
+
+/*
+ * Build a rope string from pieces, appending and prepending in turn.
+ * Expected UTF-8 content is written to buf.
+ */
+static esch_error
+rope_build_i(esch_config* config, esch_string** pieces, int count,
+             char* buf, esch_string** rope)
+{
+    esch_error ret = ESCH_OK;
+    esch_string* acc = NULL;
+    esch_string* next = NULL;
+    char piece[32];
+    size_t len = 0;
+    size_t used = 0;
+    int i = 0;
+
+    ret = esch_string_new_from_utf8(config, "", 0, -1, &acc);
+    ESCH_TEST_CHECK(ret == ESCH_OK, "Failed to create empty string", ret);
+    buf[0] = '\0';
+    for (i = 0; i < count; ++i)
+    {
+        /* Hello in Chinese in every third piece */
+        len = sprintf(piece, (i % 3 == 0? "w%d\xe4\xbd\xa0\xe5\xa5\xbd ":
+                                          "w%d "), i);
+        ret = esch_string_new_from_utf8(config, piece, 0, -1, &(pieces[i]));
+        ESCH_TEST_CHECK(ret == ESCH_OK, "Failed to create piece", ret);
+        if (i % 2 == 0)
+        {
+            ret = esch_string_concat(config, acc, pieces[i], &next);
+            memcpy(buf + used, piece, len + 1);
+        }
+        else
+        {
+            ret = esch_string_concat(config, pieces[i], acc, &next);
+            memmove(buf + len, buf, used + 1);
+            memcpy(buf, piece, len);
+        }
+        ESCH_TEST_CHECK(ret == ESCH_OK, "Failed to concat strings", ret);
+        used += len;
+        /* Old string can be deleted. New string keeps its tree. */
+        if (ESCH_OBJECT_GET_GC(ESCH_CAST_TO_OBJECT(acc)) == NULL)
+        {
+            ret = esch_object_delete(ESCH_CAST_TO_OBJECT(acc));
+            ESCH_TEST_CHECK(ret == ESCH_OK, "Failed to delete string", ret);
+        }
+        acc = next;
+        next = NULL;
+    }
+    (*rope) = acc;
+    acc = NULL;
+Exit:
+    if (acc != NULL && ESCH_OBJECT_GET_GC(ESCH_CAST_TO_OBJECT(acc)) == NULL)
+    {
+        (void)esch_object_delete(ESCH_CAST_TO_OBJECT(acc));
+    }
+    return ret;
+}
+
+esch_error test_stringRope(esch_config* config)
+{
+    esch_error ret = ESCH_OK;
+    esch_string* left = NULL;
+    esch_string* right = NULL;
+    esch_string* rope = NULL;
+    esch_string* sub = NULL;
+    esch_string* flat = NULL;
+    esch_string* flat_sub = NULL;
+    esch_string* pieces[1000] = { NULL };
+    esch_vector* root = NULL;
+    esch_gc* gc = NULL;
+    const int count = 1000;
+    char* buf = NULL;
+    esch_unicode ch1 = 0;
+    esch_unicode ch2 = 0;
+    size_t len = 0;
+    size_t begin = 0;
+    size_t end = 0;
+    size_t i = 0;
+
+    ret = esch_alloc_realloc(ESCH_CAST_FROM_OBJECT(
+                                 ESCH_CONFIG_GET_ALLOC(config), esch_alloc),
+                             NULL, 16 * 1024, (void**)&buf);
+    ESCH_TEST_CHECK(ret == ESCH_OK, "Failed to create buffer", ret);
+
+    esch_log_info(g_testLog, "Case 1: Concatenate two strings");
+    ret = esch_string_new_from_utf8(config, "hello, ", 0, -1, &left);
+    ESCH_TEST_CHECK(ret == ESCH_OK, "Failed to create left string", ret);
+    ret = esch_string_new_from_utf8(config, "\xe4\xbd\xa0\xe5\xa5\xbd",
+                                    0, -1, &right);
+    ESCH_TEST_CHECK(ret == ESCH_OK, "Failed to create right string", ret);
+    ret = esch_string_concat(config, left, right, &rope);
+    ESCH_TEST_CHECK(ret == ESCH_OK && rope != NULL,
+                    "Failed to concat strings", ret);
+    ret = ESCH_ERROR_INVALID_STATE;
+    ESCH_TEST_CHECK(rope->utf8 == NULL,
+                    "Rope string is flattened before it's used", ret);
+    ESCH_TEST_CHECK(esch_string_get_utf8_length(rope) == 13 &&
+                    esch_string_get_unicode_length(rope) == 9,
+                    "Bad length of rope string", ret);
+    ret = esch_string_get_unicode_at(rope, 7, &ch1);
+    ESCH_TEST_CHECK(ret == ESCH_OK && ch1 == 0x4F60,
+                    "Bad character from rope string", ret);
+    ret = ESCH_ERROR_INVALID_STATE;
+    ESCH_TEST_CHECK(rope->utf8 == NULL,
+                    "Indexing should not flatten rope string", ret);
+    ESCH_TEST_CHECK(strcmp(esch_string_get_utf8_ref(rope),
+                           "hello, \xe4\xbd\xa0\xe5\xa5\xbd") == 0,
+                    "Bad content of rope string", ret);
+    ESCH_TEST_CHECK(rope->rope == NULL,
+                    "Flattened string still keeps leaves", ret);
+    ESCH_TEST_CHECK(esch_string_get_unicode_ref(rope)[8] == 0x597D,
+                    "Bad Unicode buffer of rope string", ret);
+    ret = esch_object_delete(ESCH_CAST_TO_OBJECT(rope));
+    ESCH_TEST_CHECK(ret == ESCH_OK, "Failed to delete rope string", ret);
+    rope = NULL;
+    (void)esch_object_delete(ESCH_CAST_TO_OBJECT(left));
+    (void)esch_object_delete(ESCH_CAST_TO_OBJECT(right));
+    esch_log_info(g_testLog, "[PASSED] Concatenate two strings");
+
+    esch_log_info(g_testLog, "Case 2: Long rope string");
+    ret = rope_build_i(config, pieces, count, buf, &rope);
+    ESCH_TEST_CHECK(ret == ESCH_OK, "Failed to build rope string", ret);
+    ret = esch_string_new_from_utf8(config, buf, 0, -1, &flat);
+    ESCH_TEST_CHECK(ret == ESCH_OK, "Failed to create flat string", ret);
+    len = esch_string_get_unicode_length(flat);
+    ret = ESCH_ERROR_INVALID_STATE;
+    ESCH_TEST_CHECK(esch_string_get_unicode_length(rope) == len &&
+                    esch_string_get_utf8_length(rope) == strlen(buf),
+                    "Bad length of long rope string", ret);
+    for (i = 0; i < len; i += 7)
+    {
+        ret = esch_string_get_unicode_at(rope, i, &ch1);
+        ESCH_TEST_CHECK(ret == ESCH_OK, "Failed to get character", ret);
+        ret = esch_string_get_unicode_at(flat, i, &ch2);
+        ESCH_TEST_CHECK(ret == ESCH_OK && ch1 == ch2,
+                        "Bad character from long rope string", ret);
+    }
+    for (begin = 0; begin < len; begin += len / 5 + 3)
+    {
+        end = begin + (len - begin) * 2 / 3;
+        ret = esch_string_substring(config, rope, begin, end, &sub);
+        ESCH_TEST_CHECK(ret == ESCH_OK, "Failed to get substring", ret);
+        ret = esch_string_substring(config, flat, begin, end, &flat_sub);
+        ESCH_TEST_CHECK(ret == ESCH_OK, "Failed to get flat substring", ret);
+        ret = ESCH_ERROR_INVALID_STATE;
+        ESCH_TEST_CHECK(strcmp(esch_string_get_utf8_ref(sub),
+                               esch_string_get_utf8_ref(flat_sub)) == 0,
+                        "Bad substring of rope string", ret);
+        (void)esch_object_delete(ESCH_CAST_TO_OBJECT(sub));
+        (void)esch_object_delete(ESCH_CAST_TO_OBJECT(flat_sub));
+        sub = NULL;
+        flat_sub = NULL;
+    }
+    ret = esch_string_substring(config, rope, 2, len + 1, &sub);
+    ESCH_TEST_CHECK(ret == ESCH_ERROR_OUT_OF_BOUND,
+                    "Unexpected: substring out of range", ret);
+    ret = ESCH_ERROR_INVALID_STATE;
+    ESCH_TEST_CHECK(strcmp(esch_string_get_utf8_ref(rope), buf) == 0,
+                    "Bad content of long rope string", ret);
+    ret = ESCH_OK;
+    (void)esch_object_delete(ESCH_CAST_TO_OBJECT(rope));
+    (void)esch_object_delete(ESCH_CAST_TO_OBJECT(flat));
+    rope = NULL;
+    flat = NULL;
+    for (i = 0; i < (size_t)count; ++i)
+    {
+        (void)esch_object_delete(ESCH_CAST_TO_OBJECT(pieces[i]));
+        pieces[i] = NULL;
+    }
+    esch_log_info(g_testLog, "[PASSED] Long rope string");
+
+    esch_log_info(g_testLog, "Case 3: GC keeps leaves of rope string");
+    ret = esch_vector_new(config, &root);
+    ESCH_TEST_CHECK(ret == ESCH_OK, "Failed to create gc root", ret);
+    ret = esch_config_set_obj(config, ESCH_CONFIG_KEY_GC_NAIVE_ROOT,
+                              ESCH_CAST_TO_OBJECT(root));
+    ret = esch_gc_new_naive_mark_sweep(config, &gc);
+    ESCH_TEST_CHECK(ret == ESCH_OK, "Failed to create gc", ret);
+    ret = esch_config_set_obj(config, ESCH_CONFIG_KEY_GC,
+                              ESCH_CAST_TO_OBJECT(gc));
+    ret = rope_build_i(config, pieces, count, buf, &rope);
+    ESCH_TEST_CHECK(ret == ESCH_OK, "Failed to build rope string", ret);
+    ret = esch_string_substring(config, rope, 3, 300, &sub);
+    ESCH_TEST_CHECK(ret == ESCH_OK, "Failed to get substring", ret);
+    /* Only substring is reachable. Pieces are only referred by it. */
+    ret = esch_vector_append_object(root, ESCH_CAST_TO_OBJECT(sub));
+    ESCH_TEST_CHECK(ret == ESCH_OK, "Failed to append string", ret);
+    ret = esch_gc_recycle(gc);
+    ESCH_TEST_CHECK(ret == ESCH_OK, "Failed to recycle", ret);
+    ret = esch_string_new_from_utf8(config, buf, 0, -1, &flat);
+    ESCH_TEST_CHECK(ret == ESCH_OK, "Failed to create flat string", ret);
+    ret = esch_string_substring(config, flat, 3, 300, &flat_sub);
+    ESCH_TEST_CHECK(ret == ESCH_OK, "Failed to get flat substring", ret);
+    ret = ESCH_ERROR_INVALID_STATE;
+    ESCH_TEST_CHECK(strcmp(esch_string_get_utf8_ref(sub),
+                           esch_string_get_utf8_ref(flat_sub)) == 0,
+                    "Bad substring after GC", ret);
+    ret = esch_object_delete(ESCH_CAST_TO_OBJECT(gc));
+    ESCH_TEST_CHECK(ret == ESCH_OK, "Failed to delete GC", ret);
+    gc = NULL;
+    esch_log_info(g_testLog, "[PASSED] GC keeps leaves of rope string");
 Exit:
+    if (gc != NULL)
+    {
+        (void)esch_object_delete(ESCH_CAST_TO_OBJECT(gc));
+    }
+    (void)esch_config_set_obj(config, ESCH_CONFIG_KEY_GC, NULL);
+    (void)esch_config_set_obj(config, ESCH_CONFIG_KEY_GC_NAIVE_ROOT, NULL);
+    esch_alloc_free(ESCH_CAST_FROM_OBJECT(ESCH_CONFIG_GET_ALLOC(config),
+                                          esch_alloc), buf);
+    return ret;
+}
+
+/* Offset of a character in UTF-8 bytes, by counting lead bytes. */
+static size_t
+utf8_offset_i(const char* utf8, size_t index)
+{
+    size_t i = 0;
+    size_t n = 0;
+    for (i = 0; utf8[i] != '\0'; ++i)
+    {
+        if ((utf8[i] & 0xC0) != 0x80)
+        {
+            if (n == index)
+            {
+                return i;
+            }
+            ++n;
+        }
+    }
+    return i;
+}
+
+esch_error test_stringView(esch_config* config)
+{
+    esch_error ret = ESCH_OK;
+    esch_string* parent = NULL;
+    esch_string* view = NULL;
+    esch_string* view2 = NULL;
+    esch_string* suffix = NULL;
+    esch_vector* root = NULL;
+    esch_gc* gc = NULL;
+    /* 25 characters: ASCII, CJK and characters beyond BMP */
+    const char* mixed_input =
+        "abcdefghijklmnopqrst\xe4\xbd\xa0\xe5\xa5\xbd"
+        "\xf0\x9f\x98\x80\xf4\x8f\xbf\xbf!";
+    char buf[2048];
+    esch_unicode ch1 = 0;
+    esch_unicode ch2 = 0;
+    size_t len = 0;
+    size_t i = 0;
+
+    buf[0] = '\0';
+    for (i = 0; i < 50; ++i)
+    {
+        strcat(buf, mixed_input);
+    }
+
+    esch_log_info(g_testLog, "Case 1: View shares buffers of parent");
+    ret = esch_string_new_from_utf8(config, buf, 0, -1, &parent);
+    ESCH_TEST_CHECK(ret == ESCH_OK, "Failed to create parent", ret);
+    len = esch_string_get_unicode_length(parent);
+    ret = esch_string_substring(config, parent, 30, 100, &view);
+    ESCH_TEST_CHECK(ret == ESCH_OK && view != NULL,
+                    "Failed to create view", ret);
+    ret = ESCH_ERROR_INVALID_STATE;
+    ESCH_TEST_CHECK(ESCH_STRING_IS_VIEW(view) &&
+                    view->utf8 == parent->utf8 + utf8_offset_i(buf, 30),
+                    "View does not share UTF-8 buffer", ret);
+    ESCH_TEST_CHECK(esch_string_get_unicode_length(view) == 70 &&
+                    esch_string_get_utf8_length(view) ==
+                    utf8_offset_i(buf, 100) - utf8_offset_i(buf, 30),
+                    "Bad length of view", ret);
+    for (i = 0; i < 70; ++i)
+    {
+        ret = esch_string_get_unicode_at(view, i, &ch1);
+        ESCH_TEST_CHECK(ret == ESCH_OK, "Failed to get character", ret);
+        ret = esch_string_get_unicode_at(parent, i + 30, &ch2);
+        ESCH_TEST_CHECK(ret == ESCH_OK && ch1 == ch2,
+                        "Bad character from view", ret);
+    }
+    ret = ESCH_ERROR_INVALID_STATE;
+    ESCH_TEST_CHECK(view->unicode == NULL && parent->unicode != NULL,
+                    "View should use Unicode buffer of parent", ret);
+    /* View in middle needs its own buffer to end with '\0'. */
+    ESCH_TEST_CHECK(esch_string_get_utf8_ref(view) != NULL &&
+                    view->utf8[view->utf8_len] == '\0' &&
+                    strncmp(view->utf8, buf + utf8_offset_i(buf, 30),
+                            view->utf8_len) == 0,
+                    "Bad UTF-8 buffer of view", ret);
+
+    ret = esch_string_substring(config, parent, 1000, len, &suffix);
+    ESCH_TEST_CHECK(ret == ESCH_OK, "Failed to create suffix", ret);
+    ret = ESCH_ERROR_INVALID_STATE;
+    ESCH_TEST_CHECK(esch_string_get_utf8_ref(suffix) ==
+                    parent->utf8 + utf8_offset_i(buf, 1000),
+                    "Suffix does not share UTF-8 buffer", ret);
+    ESCH_TEST_CHECK(esch_string_get_unicode_ref(suffix) ==
+                    parent->unicode + 1000,
+                    "Suffix does not share Unicode buffer", ret);
+
+    ret = esch_string_substring(config, view, 10, 60, &view2);
+    ESCH_TEST_CHECK(ret == ESCH_OK, "Failed to create view of view", ret);
+    ret = ESCH_ERROR_INVALID_STATE;
+    ESCH_TEST_CHECK(ESCH_STRING_VIEW(view2)->parent == parent &&
+                    view2->utf8 == parent->utf8 + utf8_offset_i(buf, 40),
+                    "View of view should refer to parent", ret);
+    (void)esch_object_delete(ESCH_CAST_TO_OBJECT(view2));
+    view2 = NULL;
+
+    ret = esch_string_substring(config, parent, 3, 5, &view2);
+    ESCH_TEST_CHECK(ret == ESCH_OK, "Failed to create short substring", ret);
+    ret = ESCH_ERROR_INVALID_STATE;
+    ESCH_TEST_CHECK(ESCH_STRING_IS_INLINE(view2) &&
+                    strcmp(view2->utf8, "de") == 0,
+                    "Short substring should be copied", ret);
+    ret = ESCH_OK;
+    (void)esch_object_delete(ESCH_CAST_TO_OBJECT(view2));
+    (void)esch_object_delete(ESCH_CAST_TO_OBJECT(suffix));
+    (void)esch_object_delete(ESCH_CAST_TO_OBJECT(view));
+    view2 = NULL;
+    suffix = NULL;
+    view = NULL;
+    esch_log_info(g_testLog, "[PASSED] View shares buffers of parent");
+
+    esch_log_info(g_testLog, "Case 2: Find characters with sparse index");
+    for (i = 0; i <= len; ++i)
+    {
+        ret = esch_string_substring(config, parent, i, len, &view);
+        ESCH_TEST_CHECK(ret == ESCH_OK, "Failed to create suffix", ret);
+        ret = ESCH_ERROR_INVALID_STATE;
+        ESCH_TEST_CHECK(strcmp(esch_string_get_utf8_ref(view),
+                               buf + utf8_offset_i(buf, i)) == 0,
+                        "Bad offset of character", ret);
+        ret = esch_object_delete(ESCH_CAST_TO_OBJECT(view));
+        view = NULL;
+    }
+    ret = ESCH_ERROR_INVALID_STATE;
+    ESCH_TEST_CHECK(parent->offsets != NULL,
+                    "Sparse index is not created", ret);
+    ret = esch_object_delete(ESCH_CAST_TO_OBJECT(parent));
+    ESCH_TEST_CHECK(ret == ESCH_OK, "Failed to delete parent", ret);
+    parent = NULL;
+    esch_log_info(g_testLog, "[PASSED] Find characters with sparse index");
+
+    esch_log_info(g_testLog, "Case 3: GC keeps parent of view");
+    ret = esch_vector_new(config, &root);
+    ESCH_TEST_CHECK(ret == ESCH_OK, "Failed to create gc root", ret);
+    ret = esch_config_set_obj(config, ESCH_CONFIG_KEY_GC_NAIVE_ROOT,
+                              ESCH_CAST_TO_OBJECT(root));
+    ret = esch_gc_new_naive_mark_sweep(config, &gc);
+    ESCH_TEST_CHECK(ret == ESCH_OK, "Failed to create gc", ret);
+    ret = esch_config_set_obj(config, ESCH_CONFIG_KEY_GC,
+                              ESCH_CAST_TO_OBJECT(gc));
+    ret = esch_string_new_from_utf8(config, buf, 0, -1, &parent);
+    ESCH_TEST_CHECK(ret == ESCH_OK, "Failed to create parent", ret);
+    ret = esch_string_substring(config, parent, 500, 700, &view);
+    ESCH_TEST_CHECK(ret == ESCH_OK, "Failed to create view", ret);
+    ret = esch_vector_append_object(root, ESCH_CAST_TO_OBJECT(view));
+    ESCH_TEST_CHECK(ret == ESCH_OK, "Failed to append view", ret);
+    ret = esch_gc_recycle(gc);
+    ESCH_TEST_CHECK(ret == ESCH_OK, "Failed to recycle", ret);
+    ret = esch_string_get_unicode_at(view, 20, &ch1);
+    ESCH_TEST_CHECK(ret == ESCH_OK && ch1 == 0x4F60,
+                    "Bad character after GC", ret);
+    ret = ESCH_ERROR_INVALID_STATE;
+    ESCH_TEST_CHECK(strncmp(esch_string_get_utf8_ref(view),
+                            buf + utf8_offset_i(buf, 500),
+                            view->utf8_len) == 0,
+                    "Bad content after GC", ret);
+    ret = esch_object_delete(ESCH_CAST_TO_OBJECT(gc));
+    ESCH_TEST_CHECK(ret == ESCH_OK, "Failed to delete GC", ret);
+    gc = NULL;
+    parent = NULL;
+    view = NULL;
+    esch_log_info(g_testLog, "[PASSED] GC keeps parent of view");
+Exit:
+    if (gc != NULL)
+    {
+        (void)esch_object_delete(ESCH_CAST_TO_OBJECT(gc));
+        parent = NULL;
+        view = NULL;
+    }
+    (void)esch_config_set_obj(config, ESCH_CONFIG_KEY_GC, NULL);
+    (void)esch_config_set_obj(config, ESCH_CONFIG_KEY_GC_NAIVE_ROOT, NULL);
+    if (view != NULL)
+    {
+        (void)esch_object_delete(ESCH_CAST_TO_OBJECT(view));
+    }
+    if (parent != NULL)
+    {
+        (void)esch_object_delete(ESCH_CAST_TO_OBJECT(parent));
+    }
     return ret;
 }
 
@@ -166,6 +673,118 @@ esch_error test_identifier()
     val = esch_unicode_string_is_valid_identifier(nl_str);
     ESCH_TEST_CHECK(val, "Nl string should be identifier",
             ESCH_ERROR_INVALID_PARAMETER);
+    val = (esch_unicode_get_category('A') == ESCH_UNICODE_CATEGORY_LU &&
+           esch_unicode_get_category(0x3078) == ESCH_UNICODE_CATEGORY_LO &&
+           esch_unicode_get_category(0xB2) == ESCH_UNICODE_CATEGORY_NO &&
+           esch_unicode_get_category(0x10FFFD) == ESCH_UNICODE_CATEGORY_CO);
+    ESCH_TEST_CHECK(val, "Bad Unicode category",
+            ESCH_ERROR_INVALID_PARAMETER);
+    val = (esch_unicode_get_category(0x4F60) == ESCH_UNICODE_CATEGORY_NONE &&
+           esch_unicode_get_category(-1) == ESCH_UNICODE_CATEGORY_NONE &&
+           esch_unicode_get_category(0x110000) == ESCH_UNICODE_CATEGORY_NONE);
+    ESCH_TEST_CHECK(val, "Code point should not be in any category",
+            ESCH_ERROR_INVALID_PARAMETER);
 Exit:
     return ret;
 }
+
+esch_error test_stringIdentifier(esch_config* config)
+{
+    esch_error ret = ESCH_OK;
+    esch_string* str = NULL;
+    esch_string* view = NULL;
+    esch_unicode ch = 0;
+    int category = ESCH_UNICODE_CATEGORY_NONE;
+    int expected = 0;
+    char buf[48];
+    size_t pos = 0;
+    int c = 0;
+
+    esch_log_info(g_testLog, "Case 1: Identifier bitsets match categories");
+    for (ch = 0; ch <= 0x10FFFF; ++ch)
+    {
+        category = esch_unicode_get_category(ch);
+        expected = (esch_unicode_is_ascii(ch)?
+                    !esch_unicode_is_digit(ch):
+                    (category != ESCH_UNICODE_CATEGORY_ND &&
+                     category != ESCH_UNICODE_CATEGORY_NL &&
+                     category != ESCH_UNICODE_CATEGORY_NO));
+        ESCH_TEST_CHECK(esch_unicode_is_identifier_initial(ch) == expected,
+                        "Bad identifier initial bit",
+                        ESCH_ERROR_INVALID_STATE);
+        expected = (esch_unicode_is_ascii(ch)?
+                    (esch_unicode_is_digit(ch) ||
+                     esch_unicode_is_alpha(ch) ||
+                     esch_unicode_is_extended_alphabetic(ch)):
+                    category != ESCH_UNICODE_CATEGORY_NONE);
+        ESCH_TEST_CHECK(esch_unicode_is_identifier_subsequent(ch) == expected,
+                        "Bad identifier subsequent bit",
+                        ESCH_ERROR_INVALID_STATE);
+    }
+    ESCH_TEST_CHECK(!esch_unicode_is_identifier_initial(-1) &&
+                    !esch_unicode_is_identifier_subsequent(0x110000),
+                    "Invalid code point should not be identifier",
+                    ESCH_ERROR_INVALID_STATE);
+    esch_log_info(g_testLog, "[PASSED] Identifier bitsets match categories");
+
+    esch_log_info(g_testLog, "Case 2: Check ASCII identifier by bytes");
+    /* Replace each byte of a long identifier by all ASCII characters. */
+    for (pos = 0; pos < 40; ++pos)
+    {
+        for (c = 1; c < 128; ++c)
+        {
+            strcpy(buf, "call-with-current-continuation/vector-ref");
+            buf[pos] = (char)c;
+            ret = esch_string_new_from_utf8(config, buf, 0, -1, &str);
+            ESCH_TEST_CHECK(ret == ESCH_OK, "Failed to create string", ret);
+            expected = esch_unicode_string_is_valid_identifier(
+                            esch_string_get_unicode_ref(str));
+            ret = ESCH_ERROR_INVALID_STATE;
+            ESCH_TEST_CHECK(esch_string_is_valid_identifier(str) == expected,
+                            "ASCII identifier check mismatch", ret);
+            ret = esch_object_delete(ESCH_CAST_TO_OBJECT(str));
+            str = NULL;
+        }
+    }
+    esch_log_info(g_testLog, "[PASSED] Check ASCII identifier by bytes");
+
+    esch_log_info(g_testLog, "Case 3: Check identifier of any string");
+    ret = esch_string_new_from_utf8(config,
+                                    "gr\xc3\xb6\xc3\x9f" "e-\xce\xbb", 0, -1,
+                                    &str);
+    ESCH_TEST_CHECK(ret == ESCH_OK, "Failed to create string", ret);
+    ret = ESCH_ERROR_INVALID_STATE;
+    ESCH_TEST_CHECK(esch_string_is_valid_identifier(str),
+                    "Non-ASCII string should be identifier", ret);
+    ret = esch_object_delete(ESCH_CAST_TO_OBJECT(str));
+    str = NULL;
+    ret = esch_string_new_from_utf8(config,
+                                    "(list->vector call-with-values)",
+                                    0, -1, &str);
+    ESCH_TEST_CHECK(ret == ESCH_OK, "Failed to create string", ret);
+    ret = esch_string_substring(config, str, 1, 13, &view);
+    ESCH_TEST_CHECK(ret == ESCH_OK, "Failed to create substring", ret);
+    ret = ESCH_ERROR_INVALID_STATE;
+    ESCH_TEST_CHECK(!esch_string_is_valid_identifier(str) &&
+                    esch_string_is_valid_identifier(view),
+                    "Bad identifier check on substring", ret);
+    ret = esch_object_delete(ESCH_CAST_TO_OBJECT(view));
+    view = NULL;
+    ret = esch_string_substring(config, str, 14, 14, &view);
+    ESCH_TEST_CHECK(ret == ESCH_OK, "Failed to create substring", ret);
+    ret = ESCH_ERROR_INVALID_STATE;
+    ESCH_TEST_CHECK(!esch_string_is_valid_identifier(view),
+                    "Empty string should not be identifier", ret);
+    ret = ESCH_OK;
+    esch_log_info(g_testLog, "[PASSED] Check identifier of any string");
+Exit:
+    if (view != NULL)
+    {
+        (void)esch_object_delete(ESCH_CAST_TO_OBJECT(view));
+    }
+    if (str != NULL)
+    {
+        (void)esch_object_delete(ESCH_CAST_TO_OBJECT(str));
+    }
+    return ret;
+}
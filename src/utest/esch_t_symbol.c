@@ -0,0 +1,139 @@
+#include <stdio.h>
+#include <string.h>
+#include "esch_utest.h"
+#include "esch_debug.h"
+#include "esch_symbol.h"
+#include "esch_vector.h"
+#include "esch_gc.h"
+#include "esch_config.h"
+
+esch_error test_symbol(esch_config* config)
+{
+    esch_error ret = ESCH_OK;
+    esch_symbol_table* table = NULL;
+    esch_symbol* sym1 = NULL;
+    esch_symbol* sym2 = NULL;
+    esch_symbol* sym3 = NULL;
+    esch_vector* root = NULL;
+    esch_gc* gc = NULL;
+    size_t count = 0;
+    char name[32];
+    int i = 0;
+
+    esch_log_info(g_testLog, "Case 1: Intern symbols");
+    ret = esch_symbol_table_new(config, &table);
+    ESCH_TEST_CHECK(ret == ESCH_OK && table != NULL,
+                    "Failed to create symbol table", ret);
+    ret = esch_symbol_table_intern(table, "lambda", 0, -1, &sym1);
+    ESCH_TEST_CHECK(ret == ESCH_OK && sym1 != NULL,
+                    "Failed to intern symbol", ret);
+    /* Same name from a substring */
+    ret = esch_symbol_table_intern(table, "(lambda (x) x)", 1, 7, &sym2);
+    ESCH_TEST_CHECK(ret == ESCH_OK && sym2 == sym1,
+                    "Same name should return same symbol", ret);
+    ret = esch_symbol_table_intern(table, "lambda*", 0, -1, &sym3);
+    ESCH_TEST_CHECK(ret == ESCH_OK && sym3 != sym1,
+                    "Different name should return new symbol", ret);
+    ret = ESCH_ERROR_INVALID_STATE;
+    ESCH_TEST_CHECK(strcmp(esch_symbol_get_utf8_ref(sym1), "lambda") == 0,
+                    "Bad symbol name", ret);
+    ESCH_TEST_CHECK(esch_symbol_get_utf8_length(sym3) == 7,
+                    "Bad symbol name length", ret);
+    ret = esch_symbol_table_get_count(table, &count);
+    ESCH_TEST_CHECK(ret == ESCH_OK && count == 2, "Bad symbol count", ret);
+    esch_log_info(g_testLog, "[PASSED] Intern symbols");
+
+    esch_log_info(g_testLog, "Case 2: Lookup and bad names");
+    ret = esch_symbol_table_lookup(table, "lambda", 0, -1, &sym2);
+    ESCH_TEST_CHECK(ret == ESCH_OK && sym2 == sym1,
+                    "Failed to find symbol", ret);
+    ret = esch_symbol_table_lookup(table, "define", 0, -1, &sym2);
+    ESCH_TEST_CHECK(ret == ESCH_ERROR_NOT_FOUND,
+                    "Unexpected: find symbol not interned", ret);
+    ret = esch_symbol_table_intern(table, "\xc0\x80", 0, -1, &sym2);
+    ESCH_TEST_CHECK(ret == ESCH_ERROR_INVALID_PARAMETER,
+                    "Unexpected: intern ill-formed UTF-8", ret);
+    ret = ESCH_OK;
+    esch_log_info(g_testLog, "[PASSED] Lookup and bad names");
+
+    esch_log_info(g_testLog, "Case 3: Delete symbol and grow table");
+    ret = esch_object_delete(ESCH_CAST_TO_OBJECT(sym3));
+    ESCH_TEST_CHECK(ret == ESCH_OK, "Failed to delete symbol", ret);
+    ret = esch_symbol_table_lookup(table, "lambda*", 0, -1, &sym3);
+    ESCH_TEST_CHECK(ret == ESCH_ERROR_NOT_FOUND,
+                    "Deleted symbol is still in table", ret);
+    for (i = 0; i < 5000; ++i) {
+        sprintf(name, "id-%d", i);
+        ret = esch_symbol_table_intern(table, name, 0, -1, &sym2);
+        ESCH_TEST_CHECK(ret == ESCH_OK, "Failed to intern symbol", ret);
+    }
+    for (i = 0; i < 5000; i += 7) {
+        sprintf(name, "id-%d", i);
+        ret = esch_symbol_table_lookup(table, name, 0, -1, &sym2);
+        ESCH_TEST_CHECK(ret == ESCH_OK &&
+                        strcmp(esch_symbol_get_utf8_ref(sym2), name) == 0,
+                        "Failed to find symbol after growing", ret);
+    }
+    ret = esch_symbol_table_lookup(table, "lambda", 0, -1, &sym2);
+    ESCH_TEST_CHECK(ret == ESCH_OK && sym2 == sym1,
+                    "Symbol changed after growing", ret);
+    ret = esch_symbol_table_get_count(table, &count);
+    ESCH_TEST_CHECK(ret == ESCH_OK && count == 5001,
+                    "Bad symbol count after growing", ret);
+    /* Symbols are deleted with table. */
+    ret = esch_object_delete(ESCH_CAST_TO_OBJECT(table));
+    ESCH_TEST_CHECK(ret == ESCH_OK, "Failed to delete table", ret);
+    table = NULL;
+    esch_log_info(g_testLog, "[PASSED] Delete symbol and grow table");
+
+    esch_log_info(g_testLog, "Case 4: GC recycles unreachable symbols");
+    ret = esch_vector_new(config, &root);
+    ESCH_TEST_CHECK(ret == ESCH_OK, "Failed to create gc root", ret);
+    ret = esch_config_set_obj(config, ESCH_CONFIG_KEY_GC_NAIVE_ROOT,
+                              ESCH_CAST_TO_OBJECT(root));
+    ret = esch_gc_new_naive_mark_sweep(config, &gc);
+    ESCH_TEST_CHECK(ret == ESCH_OK, "Failed to create gc", ret);
+    ret = esch_config_set_obj(config, ESCH_CONFIG_KEY_GC,
+                              ESCH_CAST_TO_OBJECT(gc));
+    ret = esch_symbol_table_new(config, &table);
+    ESCH_TEST_CHECK(ret == ESCH_OK, "Failed to create symbol table", ret);
+    ret = esch_vector_append_object(root, ESCH_CAST_TO_OBJECT(table));
+    ret = esch_symbol_table_intern(table, "kept", 0, -1, &sym1);
+    ESCH_TEST_CHECK(ret == ESCH_OK, "Failed to intern symbol", ret);
+    ret = esch_symbol_table_intern(table, "dropped", 0, -1, &sym2);
+    ESCH_TEST_CHECK(ret == ESCH_OK, "Failed to intern symbol", ret);
+    ret = esch_vector_append_object(root, ESCH_CAST_TO_OBJECT(sym1));
+    ESCH_TEST_CHECK(ret == ESCH_OK, "Failed to append symbol", ret);
+
+    ret = esch_gc_recycle(gc);
+    ESCH_TEST_CHECK(ret == ESCH_OK, "Failed to recycle", ret);
+    ret = esch_symbol_table_lookup(table, "kept", 0, -1, &sym3);
+    ESCH_TEST_CHECK(ret == ESCH_OK && sym3 == sym1,
+                    "Reachable symbol is recycled", ret);
+    ret = esch_symbol_table_lookup(table, "dropped", 0, -1, &sym3);
+    ESCH_TEST_CHECK(ret == ESCH_ERROR_NOT_FOUND,
+                    "Unreachable symbol is not recycled", ret);
+    ret = esch_symbol_table_get_count(table, &count);
+    ESCH_TEST_CHECK(ret == ESCH_OK && count == 1,
+                    "Bad symbol count after GC", ret);
+    /* Name can be interned again. */
+    ret = esch_symbol_table_intern(table, "dropped", 0, -1, &sym2);
+    ESCH_TEST_CHECK(ret == ESCH_OK, "Failed to intern symbol again", ret);
+
+    ret = esch_object_delete(ESCH_CAST_TO_OBJECT(gc));
+    ESCH_TEST_CHECK(ret == ESCH_OK, "Failed to delete GC", ret);
+    gc = NULL;
+    table = NULL;
+    esch_log_info(g_testLog, "[PASSED] GC recycles unreachable symbols");
+Exit:
+    if (gc != NULL) {
+        esch_object_delete(ESCH_CAST_TO_OBJECT(gc));
+        table = NULL;
+    }
+    (void)esch_config_set_obj(config, ESCH_CONFIG_KEY_GC, NULL);
+    (void)esch_config_set_obj(config, ESCH_CONFIG_KEY_GC_NAIVE_ROOT, NULL);
+    if (table != NULL) {
+        esch_object_delete(ESCH_CAST_TO_OBJECT(table));
+    }
+    return ret;
+}
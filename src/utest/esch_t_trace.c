@@ -0,0 +1,242 @@
+/* vim:ft=c expandtab tw=72 sw=4
+ */
+#include <stdio.h>
+#include <string.h>
+#include "esch_utest.h"
+#include "esch_debug.h"
+#include "esch_config.h"
+#include "esch_trace.h"
+#include "esch_thread.h"
+
+#define TEST_TRACE_FILE "esch_utest_trace.bin"
+#define TEST_TRACE_THREADS 4
+#define TEST_TRACE_EVENTS 200000
+
+/* Emit events with increasing size, so broken records can be seen. */
+static void
+test_traceProducer(void* arg)
+{
+    size_t i = 0;
+    (void)arg;
+    for (i = 1; i <= TEST_TRACE_EVENTS; ++i)
+    {
+        ESCH_TRACE(ESCH_TRACE_GC_ATTACH, NULL, i, NULL);
+    }
+}
+
+/* Stop trace while other threads still emit events. */
+static esch_error
+test_traceStopWhileEmitting(void)
+{
+    esch_error ret = ESCH_OK;
+    esch_thread threads[TEST_TRACE_THREADS];
+    int started = 0;
+    FILE* fd = NULL;
+    struct esch_trace_header header;
+    struct esch_trace_record record;
+    uint32_t last[64];
+    size_t events = 0;
+    int names = 0;
+    int i = 0;
+
+    memset(last, 0, sizeof(last));
+    ret = esch_trace_start(TEST_TRACE_FILE);
+    ESCH_TEST_CHECK(ret == ESCH_OK, "Failed to start trace", ret);
+    for (started = 0; started < TEST_TRACE_THREADS; ++started)
+    {
+        ret = esch_thread_start_i(&(threads[started]),
+                                  test_traceProducer, NULL);
+        ESCH_TEST_CHECK(ret == ESCH_OK, "Failed to start thread", ret);
+    }
+    esch_thread_sleep_i(1);
+    ret = esch_trace_stop();
+    ESCH_TEST_CHECK(ret == ESCH_OK, "Failed to stop trace", ret);
+
+    fd = fopen(TEST_TRACE_FILE, "rb");
+    ret = ESCH_ERROR_INVALID_STATE;
+    ESCH_TEST_CHECK(fd != NULL, "Failed to open trace file", ret);
+    ESCH_TEST_CHECK(fread(&header, sizeof(header), 1, fd) == 1,
+                    "Failed to read header", ret);
+    while (fread(&record, sizeof(record), 1, fd) == 1)
+    {
+        if (record.event == ESCH_TRACE_TYPE_NAME)
+        {
+            names = (int)(record.size + sizeof(record) - 1) /
+                    (int)sizeof(record);
+            for (i = 0; i < names; ++i)
+            {
+                ESCH_TEST_CHECK(fread(&record, sizeof(record), 1, fd) == 1,
+                                "Failed to read type name", ret);
+            }
+            continue;
+        }
+        /* Earlier tests may leave buffers of other threads. */
+        ESCH_TEST_CHECK(record.event == ESCH_TRACE_GC_ATTACH &&
+                        record.type == 0 && record.gc_id == 0 &&
+                        record.thread < 64 &&
+                        record.size > last[record.thread],
+                        "Broken record", ret);
+        last[record.thread] = record.size;
+        ++events;
+    }
+    esch_log_info(g_testLog, "events = %d", (int)events);
+    ret = ESCH_OK;
+Exit:
+    for (i = 0; i < started; ++i)
+    {
+        (void)esch_thread_join_i(&(threads[i]));
+    }
+    if (fd != NULL)
+    {
+        (void)fclose(fd);
+        (void)remove(TEST_TRACE_FILE);
+    }
+    return ret;
+}
+
+esch_error test_trace(esch_config* config)
+{
+    esch_error ret = ESCH_OK;
+    esch_vector* root = NULL;
+    esch_gc* gc = NULL;
+    esch_string* str = NULL;
+    esch_type* str_type = NULL;
+    FILE* fd = NULL;
+    struct esch_trace_header header;
+    struct esch_trace_record record;
+    uint64_t last_timestamp = 0;
+    int created = 0;
+    int deleted = 0;
+    int attached = 0;
+    int phase = 0;
+    int names = 0;
+    int i = 0;
+
+    esch_log_info(g_testLog, "Case 1: Start and stop");
+    ret = esch_trace_start(TEST_TRACE_FILE);
+    ESCH_TEST_CHECK(ret == ESCH_OK, "Failed to start trace", ret);
+    ret = esch_trace_start(TEST_TRACE_FILE);
+    ESCH_TEST_CHECK(ret == ESCH_ERROR_INVALID_STATE,
+                    "Unexpected: start trace twice", ret);
+    ret = ESCH_OK;
+    esch_log_info(g_testLog, "[PASSED] Start and stop");
+
+    esch_log_info(g_testLog, "Case 2: Trace objects and GC");
+    ret = esch_vector_new(config, &root);
+    ESCH_TEST_CHECK(ret == ESCH_OK, "Failed to create root", ret);
+    ret = esch_config_set_obj(config, ESCH_CONFIG_KEY_GC_NAIVE_ROOT,
+                              ESCH_CAST_TO_OBJECT(root));
+    ESCH_TEST_CHECK(ret == ESCH_OK, "Failed to set gc root", ret);
+    ret = esch_gc_new_naive_mark_sweep(config, &gc);
+    ESCH_TEST_CHECK(ret == ESCH_OK, "Failed to create gc", ret);
+    ret = esch_config_set_obj(config, ESCH_CONFIG_KEY_GC,
+                              ESCH_CAST_TO_OBJECT(gc));
+    ESCH_TEST_CHECK(ret == ESCH_OK, "Failed to set gc", ret);
+    /* Root keeps half of strings. */
+    for (i = 0; i < 10; ++i)
+    {
+        ret = esch_string_new_from_utf8(config, "trace", 0, -1, &str);
+        ESCH_TEST_CHECK(ret == ESCH_OK, "Failed to create string", ret);
+        str_type = ESCH_OBJECT_GET_TYPE(ESCH_CAST_TO_OBJECT(str));
+        if (i % 2 == 0)
+        {
+            ret = esch_vector_append_object(root, ESCH_CAST_TO_OBJECT(str));
+            ESCH_TEST_CHECK(ret == ESCH_OK, "Failed to append", ret);
+        }
+    }
+    ret = esch_gc_recycle(gc);
+    ESCH_TEST_CHECK(ret == ESCH_OK, "Failed to recycle", ret);
+    ret = esch_trace_stop();
+    ESCH_TEST_CHECK(ret == ESCH_OK, "Failed to stop trace", ret);
+    ret = esch_trace_stop();
+    ESCH_TEST_CHECK(ret == ESCH_ERROR_INVALID_STATE,
+                    "Unexpected: stop trace twice", ret);
+
+    fd = fopen(TEST_TRACE_FILE, "rb");
+    ret = ESCH_ERROR_INVALID_STATE;
+    ESCH_TEST_CHECK(fd != NULL, "Failed to open trace file", ret);
+    ESCH_TEST_CHECK(fread(&header, sizeof(header), 1, fd) == 1,
+                    "Failed to read header", ret);
+    ESCH_TEST_CHECK(strcmp(header.magic, ESCH_TRACE_MAGIC) == 0 &&
+                    header.version == ESCH_TRACE_VERSION &&
+                    header.record_size == sizeof(record),
+                    "Bad trace header", ret);
+    while (fread(&record, sizeof(record), 1, fd) == 1)
+    {
+        if (record.event == ESCH_TRACE_TYPE_NAME)
+        {
+            /* Skip name. */
+            names = (int)(record.size + sizeof(record) - 1) /
+                    (int)sizeof(record);
+            for (i = 0; i < names; ++i)
+            {
+                ESCH_TEST_CHECK(fread(&record, sizeof(record), 1, fd) == 1,
+                                "Failed to read type name", ret);
+            }
+            continue;
+        }
+        ESCH_TEST_CHECK(record.timestamp >= last_timestamp,
+                        "Time goes back", ret);
+        last_timestamp = record.timestamp;
+        if (record.type == (uint64_t)(size_t)str_type)
+        {
+            if (record.event == ESCH_TRACE_OBJECT_NEW)
+            {
+                ++created;
+            }
+            else if (record.event == ESCH_TRACE_OBJECT_DELETE)
+            {
+                ++deleted;
+            }
+            else if (record.event == ESCH_TRACE_GC_ATTACH)
+            {
+                ++attached;
+            }
+        }
+        /* Phases come in order. */
+        if (record.event == ESCH_TRACE_GC_MARK_BEGIN)
+        {
+            ESCH_TEST_CHECK(phase == 0, "Bad mark event", ret);
+            phase = 1;
+        }
+        else if (record.event == ESCH_TRACE_GC_SWEEP_BEGIN)
+        {
+            ESCH_TEST_CHECK(phase == 1, "Bad sweep event", ret);
+            phase = 2;
+        }
+        else if (record.event == ESCH_TRACE_GC_RECYCLE_END)
+        {
+            ESCH_TEST_CHECK(phase == 2 && record.size == 5,
+                            "Bad recycle end event", ret);
+            phase = 3;
+        }
+    }
+    esch_log_info(g_testLog, "created = %d, attached = %d, deleted = %d",
+                  created, attached, deleted);
+    ESCH_TEST_CHECK(created == 10 && attached == 10 && deleted == 5,
+                    "Bad event count", ret);
+    ESCH_TEST_CHECK(phase == 3, "Missing GC events", ret);
+    ret = ESCH_OK;
+    esch_log_info(g_testLog, "[PASSED] Trace objects and GC");
+    (void)fclose(fd);
+    fd = NULL;
+
+    esch_log_info(g_testLog, "Case 3: Stop while emitting");
+    ret = test_traceStopWhileEmitting();
+    ESCH_TEST_CHECK(ret == ESCH_OK, "Failed to stop while emitting", ret);
+    esch_log_info(g_testLog, "[PASSED] Stop while emitting");
+Exit:
+    if (fd != NULL)
+    {
+        (void)fclose(fd);
+        (void)remove(TEST_TRACE_FILE);
+    }
+    (void)esch_trace_stop();
+    if (gc != NULL)
+    {
+        (void)esch_object_delete(ESCH_CAST_TO_OBJECT(gc));
+    }
+    (void)esch_config_set_obj(config, ESCH_CONFIG_KEY_GC, NULL);
+    (void)esch_config_set_obj(config, ESCH_CONFIG_KEY_GC_NAIVE_ROOT, NULL);
+    return ret;
+}
@@ -237,12 +237,9 @@ esch_error test_vectorIteration(esch_config* config)
 
     ESCH_TEST_CHECK(vec->begin != vec_copy->begin,
             "Copy: begin should be different", ESCH_ERROR_BAD_VALUE_TYPE);
-    ESCH_TEST_CHECK(vec->next != vec_copy->next,
-            "Copy: next should be different", ESCH_ERROR_BAD_VALUE_TYPE);
     ESCH_TEST_CHECK(vec->slots == vec_copy->slots,
             "Copy: elements should be same", ESCH_ERROR_BAD_VALUE_TYPE);
-    ESCH_TEST_CHECK(vec->next - vec->begin == 
-                    vec_copy->next - vec_copy->begin,
+    ESCH_TEST_CHECK(vec->length == vec_copy->length,
             "Copy: elements should be same", ESCH_ERROR_BAD_VALUE_TYPE);
     ret = EnumerateAndCompare(log, vec_copy, str, 100);
     ESCH_TEST_CHECK(ret == ESCH_OK,
@@ -592,3 +589,321 @@ Exit:
     }
     return ret;
 }
+
+static int
+test_vectorCompareGroup(esch_value* left, esch_value* right)
+{
+    /* Compare by group only, so stability can be observed. */
+    int left_group = left->val.i / 100000;
+    int right_group = right->val.i / 100000;
+    return left_group - right_group;
+}
+
+esch_error test_vectorSort(esch_config* config)
+{
+    esch_error ret = ESCH_OK;
+    esch_vector* vec = NULL;
+    esch_value value;
+    unsigned int seed = 12345;
+    size_t length = 0;
+    int count = 0;
+    int index = 0;
+    int i = 0;
+    int ival = 0;
+    int ival2 = 0;
+    double fval = 0.0;
+    double fval2 = 0.0;
+
+    ret = esch_config_set_int(config, ESCH_CONFIG_KEY_VECTOR_ENLARGE, 1);
+
+    esch_log_info(g_testLog, "Case 1: Radix sort on integers.");
+    ret = esch_vector_new(config, &vec);
+    ESCH_TEST_CHECK(ret == ESCH_OK, "Failed to create vector", ret);
+    for (i = 0; i < 10000; ++i) {
+        seed = seed * 1103515245 + 12345;
+        ret = esch_vector_append_integer(vec, (int)(seed >> 8) - 8000000);
+        ESCH_TEST_CHECK(ret == ESCH_OK, "Failed to append integer", ret);
+    }
+    ret = esch_vector_sort(vec, NULL);
+    ESCH_TEST_CHECK(ret == ESCH_OK, "Failed to sort integers", ret);
+    ret = esch_vector_get_length(vec, &length);
+    ESCH_TEST_CHECK(length == 10000, "Length changed after sort",
+                    ESCH_ERROR_INVALID_STATE);
+    for (i = 1; i < 10000; ++i) {
+        ret = esch_vector_get_integer(vec, i - 1, &ival);
+        ret = esch_vector_get_integer(vec, i, &ival2);
+        ESCH_TEST_CHECK(ival <= ival2, "Integers not sorted",
+                        ESCH_ERROR_INVALID_STATE);
+    }
+    ret = esch_object_delete(ESCH_CAST_TO_OBJECT(vec));
+    vec = NULL;
+
+    esch_log_info(g_testLog, "Case 2: Radix sort on floats.");
+    ret = esch_vector_new(config, &vec);
+    ESCH_TEST_CHECK(ret == ESCH_OK, "Failed to create vector", ret);
+    for (i = 0; i < 1000; ++i) {
+        seed = seed * 1103515245 + 12345;
+        fval = ((double)(seed >> 8) - 8000000.0) / 3.0;
+        ret = esch_vector_append_float(vec, fval);
+        ESCH_TEST_CHECK(ret == ESCH_OK, "Failed to append float", ret);
+    }
+    ret = esch_vector_sort(vec, NULL);
+    ESCH_TEST_CHECK(ret == ESCH_OK, "Failed to sort floats", ret);
+    for (i = 1; i < 1000; ++i) {
+        ret = esch_vector_get_float(vec, i - 1, &fval);
+        ret = esch_vector_get_float(vec, i, &fval2);
+        ESCH_TEST_CHECK(fval <= fval2, "Floats not sorted",
+                        ESCH_ERROR_INVALID_STATE);
+    }
+    ret = esch_object_delete(ESCH_CAST_TO_OBJECT(vec));
+    vec = NULL;
+
+    esch_log_info(g_testLog, "Case 3: Merge sort on mixed values.");
+    ret = esch_vector_new(config, &vec);
+    ESCH_TEST_CHECK(ret == ESCH_OK, "Failed to create vector", ret);
+    for (i = 0; i < 100; ++i) {
+        ret = esch_vector_append_float(vec, (double)(100 - i));
+        ret = esch_vector_append_integer(vec, 100 - i);
+        ESCH_TEST_CHECK(ret == ESCH_OK, "Failed to append value", ret);
+    }
+    ret = esch_vector_sort(vec, NULL);
+    ESCH_TEST_CHECK(ret == ESCH_OK, "Failed to sort mixed values", ret);
+    for (i = 0; i < 100; ++i) {
+        /* Integers come before floats in built-in order. */
+        ret = esch_vector_get_integer(vec, i, &ival);
+        ESCH_TEST_CHECK(ret == ESCH_OK && ival == i + 1,
+                        "Integer not in place", ESCH_ERROR_INVALID_STATE);
+        ret = esch_vector_get_float(vec, i + 100, &fval);
+        ESCH_TEST_CHECK(ret == ESCH_OK && fval == (double)(i + 1),
+                        "Float not in place", ESCH_ERROR_INVALID_STATE);
+    }
+    ret = esch_object_delete(ESCH_CAST_TO_OBJECT(vec));
+    vec = NULL;
+
+    esch_log_info(g_testLog, "Case 4: Parallel sort is stable.");
+    ret = esch_config_set_int(config,
+                              ESCH_CONFIG_KEY_VECTOR_SORT_THREADS, 4);
+    ret = esch_vector_new(config, &vec);
+    ESCH_TEST_CHECK(ret == ESCH_OK, "Failed to create vector", ret);
+    count = (int)ESCH_VECTOR_PARALLEL_SORT_THRESHOLD + 1234;
+    for (i = 0; i < count; ++i) {
+        seed = seed * 1103515245 + 12345;
+        ival = (int)((seed >> 16) % 50) * 100000 + i;
+        ret = esch_vector_append_integer(vec, ival);
+        ESCH_TEST_CHECK(ret == ESCH_OK, "Failed to append integer", ret);
+    }
+    ret = esch_vector_sort(vec, test_vectorCompareGroup);
+    ESCH_TEST_CHECK(ret == ESCH_OK, "Failed to sort in parallel", ret);
+    ret = esch_vector_get_length(vec, &length);
+    ESCH_TEST_CHECK(length == (size_t)count, "Length changed after sort",
+                    ESCH_ERROR_INVALID_STATE);
+    for (i = 1; i < count; ++i) {
+        ret = esch_vector_get_integer(vec, i - 1, &ival);
+        ret = esch_vector_get_integer(vec, i, &ival2);
+        if (ival / 100000 == ival2 / 100000) {
+            ESCH_TEST_CHECK(ival < ival2, "Sort is not stable",
+                            ESCH_ERROR_INVALID_STATE);
+        } else {
+            ESCH_TEST_CHECK(ival < ival2, "Groups not sorted",
+                            ESCH_ERROR_INVALID_STATE);
+        }
+    }
+
+    esch_log_info(g_testLog, "Case 5: Binary search.");
+    value.type = ESCH_VALUE_TYPE_INTEGER;
+    value.val.i = 2500000;
+    ret = esch_vector_binary_search(vec, &value,
+                                    test_vectorCompareGroup, &index);
+    ESCH_TEST_CHECK(ret == ESCH_OK, "Failed to find group 25", ret);
+    ret = esch_vector_get_integer(vec, index, &ival);
+    ESCH_TEST_CHECK(ival / 100000 == 25, "Found wrong group",
+                    ESCH_ERROR_INVALID_STATE);
+    if (index > 0) {
+        ret = esch_vector_get_integer(vec, index - 1, &ival);
+        ESCH_TEST_CHECK(ival / 100000 == 24, "Not first of group",
+                        ESCH_ERROR_INVALID_STATE);
+    }
+    value.val.i = 5000000;
+    ret = esch_vector_binary_search(vec, &value,
+                                    test_vectorCompareGroup, &index);
+    ESCH_TEST_CHECK(ret == ESCH_ERROR_NOT_FOUND,
+                    "Should not find group 50", ESCH_ERROR_INVALID_STATE);
+    ESCH_TEST_CHECK(index == count, "Insert point should be end",
+                    ESCH_ERROR_INVALID_STATE);
+    ret = ESCH_OK;
+Exit:
+    (void)esch_config_set_int(config,
+                              ESCH_CONFIG_KEY_VECTOR_SORT_THREADS, 1);
+    if (vec != NULL) {
+        esch_object_delete(ESCH_CAST_TO_OBJECT(vec));
+    }
+    return ret;
+}
+
+esch_error test_vectorSplitLayout(esch_config* config)
+{
+    esch_error ret = ESCH_OK;
+    esch_vector* vec = NULL;
+    esch_vector* root = NULL;
+    esch_object* vec_copy_obj = NULL;
+    esch_vector* vec_copy = NULL;
+    esch_string* str = NULL;
+    esch_gc* gc = NULL;
+    esch_object* obj = NULL;
+    esch_iterator iter;
+    esch_value value;
+    size_t length = 0;
+    int objects = 0;
+    int ival = 0;
+    double fval = 0.0;
+    int i = 0;
+
+    ret = esch_config_set_int(config, ESCH_CONFIG_KEY_VECTOR_ENLARGE, 1);
+    ret = esch_config_set_int(config, ESCH_CONFIG_KEY_VECTOR_LAYOUT,
+                              ESCH_VECTOR_LAYOUT_SPLIT);
+
+    esch_log_info(g_testLog, "Case 1: Append and get mixed values.");
+    ret = esch_vector_new(config, &vec);
+    ESCH_TEST_CHECK(ret == ESCH_OK, "Failed to create vector", ret);
+    ESCH_TEST_CHECK(vec->layout == ESCH_VECTOR_LAYOUT_SPLIT &&
+                    vec->begin == NULL && vec->tags != NULL &&
+                    vec->data != NULL, "Not split layout",
+                    ESCH_ERROR_INVALID_STATE);
+    ret = esch_string_new_from_utf8(config, "split", 0, -1, &str);
+    ESCH_TEST_CHECK(ret == ESCH_OK, "Failed to create string", ret);
+    for (i = 0; i < 100; ++i) {
+        if (i % 10 == 0) {
+            ret = esch_vector_append_object(vec, ESCH_CAST_TO_OBJECT(str));
+        } else if (i % 2 == 0) {
+            ret = esch_vector_append_float(vec, (double)i);
+        } else {
+            ret = esch_vector_append_integer(vec, i);
+        }
+        ESCH_TEST_CHECK(ret == ESCH_OK, "Failed to append value", ret);
+    }
+    ret = esch_vector_get_length(vec, &length);
+    ESCH_TEST_CHECK(length == 100, "Length not match",
+                    ESCH_ERROR_INVALID_STATE);
+    ESCH_TEST_CHECK(vec->slots > ESCH_VECTOR_MINIMAL_INITIAL_LENGTH,
+                    "Vector not enlarged", ESCH_ERROR_INVALID_STATE);
+    ret = esch_vector_get_integer(vec, 11, &ival);
+    ESCH_TEST_CHECK(ret == ESCH_OK && ival == 11, "Integer not match",
+                    ESCH_ERROR_INVALID_STATE);
+    ret = esch_vector_get_float(vec, -2, &fval);
+    ESCH_TEST_CHECK(ret == ESCH_OK && fval == 98.0, "Float not match",
+                    ESCH_ERROR_INVALID_STATE);
+    ret = esch_vector_get_float(vec, 11, &fval);
+    ESCH_TEST_CHECK(ret == ESCH_ERROR_BAD_VALUE_TYPE,
+                    "Type check should fail", ESCH_ERROR_INVALID_STATE);
+    ret = esch_vector_get_object(vec, 20, &obj);
+    ESCH_TEST_CHECK(ret == ESCH_OK && obj == ESCH_CAST_TO_OBJECT(str),
+                    "Object not match", ESCH_ERROR_INVALID_STATE);
+
+    esch_log_info(g_testLog, "Case 2: Set value with new type.");
+    ret = esch_vector_set_byte(vec, 11, 'x');
+    ESCH_TEST_CHECK(ret == ESCH_OK, "Failed to set byte", ret);
+    ret = esch_vector_get_value(vec, 11, ESCH_VALUE_TYPE_END, &value);
+    ESCH_TEST_CHECK(ret == ESCH_OK && value.type == ESCH_VALUE_TYPE_BYTE
+                    && value.val.b == 'x', "Byte not match",
+                    ESCH_ERROR_INVALID_STATE);
+    ret = esch_vector_set_integer(vec, 11, 11);
+
+    esch_log_info(g_testLog, "Case 3: Iterator seeks objects only.");
+    ret = esch_object_get_iterator(ESCH_CAST_TO_OBJECT(vec), &iter);
+    ESCH_TEST_CHECK(ret == ESCH_OK && iter.seek_object != NULL,
+                    "Failed to get iterator", ESCH_ERROR_INVALID_STATE);
+    while (ESCH_TRUE) {
+        ret = iter.seek_object(&iter);
+        ret = iter.get_value(&iter, &value);
+        if (value.type == ESCH_VALUE_TYPE_END) {
+            break;
+        }
+        ESCH_TEST_CHECK(value.type == ESCH_VALUE_TYPE_OBJECT &&
+                        value.val.o == ESCH_CAST_TO_OBJECT(str),
+                        "Seek returns non-object",
+                        ESCH_ERROR_INVALID_STATE);
+        ++objects;
+        ret = iter.get_next(&iter);
+    }
+    ESCH_TEST_CHECK(objects == 10, "Object count not match",
+                    ESCH_ERROR_INVALID_STATE);
+
+    esch_log_info(g_testLog, "Case 4: Copy keeps layout.");
+    ret = esch_vector_type.type.object_copy(ESCH_CAST_TO_OBJECT(vec),
+                                            &vec_copy_obj);
+    ESCH_TEST_CHECK(ret == ESCH_OK, "Fail to copy object", ret);
+    vec_copy = ESCH_CAST_FROM_OBJECT(vec_copy_obj, esch_vector);
+    ESCH_TEST_CHECK(vec_copy->layout == ESCH_VECTOR_LAYOUT_SPLIT &&
+                    vec_copy->length == vec->length,
+                    "Copy: layout or length not match",
+                    ESCH_ERROR_INVALID_STATE);
+    ret = esch_vector_get_integer(vec_copy, 99, &ival);
+    ESCH_TEST_CHECK(ret == ESCH_OK && ival == 99, "Copy: value not match",
+                    ESCH_ERROR_INVALID_STATE);
+
+    esch_log_info(g_testLog, "Case 5: Sort split vector.");
+    ret = esch_vector_sort(vec, NULL);
+    ESCH_TEST_CHECK(ret == ESCH_OK, "Failed to sort", ret);
+    ret = esch_vector_get_integer(vec, 0, &ival);
+    ESCH_TEST_CHECK(ret == ESCH_OK && ival == 1, "Sort: first integer",
+                    ESCH_ERROR_INVALID_STATE);
+    ret = esch_vector_get_object(vec, -1, &obj);
+    ESCH_TEST_CHECK(ret == ESCH_OK && obj == ESCH_CAST_TO_OBJECT(str),
+                    "Sort: objects come last", ESCH_ERROR_INVALID_STATE);
+    esch_object_delete(vec_copy_obj);
+    vec_copy_obj = NULL;
+    esch_object_delete(ESCH_CAST_TO_OBJECT(vec));
+    vec = NULL;
+    esch_object_delete(ESCH_CAST_TO_OBJECT(str));
+    str = NULL;
+
+    esch_log_info(g_testLog, "Case 6: GC visits objects in split vector.");
+    ret = esch_vector_new(config, &root);
+    ESCH_TEST_CHECK(ret == ESCH_OK, "Failed to create gc root", ret);
+    ret = esch_config_set_obj(config, ESCH_CONFIG_KEY_GC_NAIVE_ROOT,
+                              ESCH_CAST_TO_OBJECT(root));
+    ret = esch_gc_new_naive_mark_sweep(config, &gc);
+    ESCH_TEST_CHECK(ret == ESCH_OK, "Failed to create gc", ret);
+    ret = esch_config_set_obj(config, ESCH_CONFIG_KEY_GC,
+                              ESCH_CAST_TO_OBJECT(gc));
+    ret = esch_vector_new(config, &vec);
+    ESCH_TEST_CHECK(ret == ESCH_OK, "Failed to create child", ret);
+    ret = esch_string_new_from_utf8(config, "alive", 0, -1, &str);
+    ESCH_TEST_CHECK(ret == ESCH_OK, "Failed to create string", ret);
+    for (i = 0; i < 50; ++i) {
+        ret = esch_vector_append_integer(root, i);
+        ret = esch_vector_append_float(vec, (double)i);
+    }
+    ret = esch_vector_append_object(root, ESCH_CAST_TO_OBJECT(vec));
+    ret = esch_vector_append_object(vec, ESCH_CAST_TO_OBJECT(str));
+    ESCH_TEST_CHECK(ret == ESCH_OK, "Failed to append string", ret);
+    ret = esch_gc_recycle(gc);
+    ESCH_TEST_CHECK(ret == ESCH_OK, "Failed to recycle", ret);
+    ESCH_TEST_CHECK(ESCH_CAST_TO_OBJECT(str)->gc == gc,
+                    "Reachable string is recycled", ESCH_ERROR_INVALID_STATE);
+    ret = esch_object_delete(ESCH_CAST_TO_OBJECT(gc));
+    ESCH_TEST_CHECK(ret == ESCH_OK, "Failed to delete GC", ret);
+    gc = NULL;
+    vec = NULL;
+    str = NULL;
+Exit:
+    if (gc != NULL) {
+        esch_object_delete(ESCH_CAST_TO_OBJECT(gc));
+        vec = NULL;
+        str = NULL;
+    }
+    (void)esch_config_set_obj(config, ESCH_CONFIG_KEY_GC, NULL);
+    (void)esch_config_set_obj(config, ESCH_CONFIG_KEY_GC_NAIVE_ROOT, NULL);
+    (void)esch_config_set_int(config, ESCH_CONFIG_KEY_VECTOR_LAYOUT,
+                              ESCH_VECTOR_LAYOUT_MIXED);
+    if (vec_copy_obj != NULL) {
+        esch_object_delete(vec_copy_obj);
+    }
+    if (vec != NULL) {
+        esch_object_delete(ESCH_CAST_TO_OBJECT(vec));
+    }
+    if (str != NULL) {
+        esch_object_delete(ESCH_CAST_TO_OBJECT(str));
+    }
+    return ret;
+}
@@ -51,11 +51,26 @@ int main(int argc, char* argv[])
     ESCH_TEST_CHECK(ret == ESCH_OK, "test_string() failed", ret);
     esch_log_info(g_testLog, "[PASSED] test_string()");
 
+    esch_log_info(testLog, "Start: test_stringRope()");
+    ret = test_stringRope(config);
+    ESCH_TEST_CHECK(ret == ESCH_OK, "test_stringRope() failed", ret);
+    esch_log_info(g_testLog, "[PASSED] test_stringRope()");
+
+    esch_log_info(testLog, "Start: test_stringView()");
+    ret = test_stringView(config);
+    ESCH_TEST_CHECK(ret == ESCH_OK, "test_stringView() failed", ret);
+    esch_log_info(g_testLog, "[PASSED] test_stringView()");
+
     esch_log_info(testLog, "Start: test_identifier()");
     ret = test_identifier();
     ESCH_TEST_CHECK(ret == ESCH_OK, "test_identifier() failed", ret);
     esch_log_info(g_testLog, "[PASSED] test_identifier()");
 
+    esch_log_info(testLog, "Start: test_stringIdentifier()");
+    ret = test_stringIdentifier(config);
+    ESCH_TEST_CHECK(ret == ESCH_OK, "test_stringIdentifier() failed", ret);
+    esch_log_info(g_testLog, "[PASSED] test_stringIdentifier()");
+
     ret = test_vectorBase(config);
     ESCH_TEST_CHECK(ret == ESCH_OK, "test_vectorBase() failed", ret);
     esch_log_info(g_testLog, "[PASSED] test_vectorBase()");
@@ -101,20 +116,85 @@ int main(int argc, char* argv[])
                     ret);
     esch_log_info(testLog, "[PASSED] test_vectorDifferentValues()");
 
+    esch_log_info(testLog, "Start: test_vectorSort()");
+    ret = test_vectorSort(config);
+    ESCH_TEST_CHECK(ret == ESCH_OK, "test_vectorSort() failed", ret);
+    esch_log_info(testLog, "[PASSED] test_vectorSort()");
+
+    esch_log_info(testLog, "Start: test_vectorSplitLayout()");
+    ret = test_vectorSplitLayout(config);
+    ESCH_TEST_CHECK(ret == ESCH_OK, "test_vectorSplitLayout() failed", ret);
+    esch_log_info(testLog, "[PASSED] test_vectorSplitLayout()");
+
     esch_log_info(testLog, "Start: test_pairBase()");
     ret = test_pairBase(config);
     ESCH_TEST_CHECK(ret == ESCH_OK, "test_pairBase() failed", ret);
     esch_log_info(testLog, "[PASSED] test_pairBase()");
 
-    /*
-    ret = test_config();
+    esch_log_info(testLog, "Start: test_pairPool()");
+    ret = test_pairPool(config);
+    ESCH_TEST_CHECK(ret == ESCH_OK, "test_pairPool() failed", ret);
+    esch_log_info(testLog, "[PASSED] test_pairPool()");
+
+    esch_log_info(testLog, "Start: test_pairList()");
+    ret = test_pairList(config);
+    ESCH_TEST_CHECK(ret == ESCH_OK, "test_pairList() failed", ret);
+    esch_log_info(testLog, "[PASSED] test_pairList()");
+
+    esch_log_info(testLog, "Start: test_pairLength()");
+    ret = test_pairLength(config);
+    ESCH_TEST_CHECK(ret == ESCH_OK, "test_pairLength() failed", ret);
+    esch_log_info(testLog, "[PASSED] test_pairLength()");
+
+    esch_log_info(testLog, "Start: test_pairVector()");
+    ret = test_pairVector(config);
+    ESCH_TEST_CHECK(ret == ESCH_OK, "test_pairVector() failed", ret);
+    esch_log_info(testLog, "[PASSED] test_pairVector()");
+
+    esch_log_info(testLog, "Start: test_symbol()");
+    ret = test_symbol(config);
+    ESCH_TEST_CHECK(ret == ESCH_OK, "test_symbol() failed", ret);
+    esch_log_info(testLog, "[PASSED] test_symbol()");
+
+    esch_log_info(testLog, "Start: test_hashtable()");
+    ret = test_hashtable(config);
+    ESCH_TEST_CHECK(ret == ESCH_OK, "test_hashtable() failed", ret);
+    esch_log_info(testLog, "[PASSED] test_hashtable()");
+
+    esch_log_info(testLog, "Start: test_config()");
+    ret = test_config(config);
     ESCH_TEST_CHECK(ret == ESCH_OK, "test_config() failed", ret);
-    esch_log_info(g_testLog, "[PASSED] test_config()");
+    esch_log_info(testLog, "[PASSED] test_config()");
 
-    ret = test_integer();
+    esch_log_info(testLog, "Start: test_logLevel()");
+    ret = test_logLevel(config);
+    ESCH_TEST_CHECK(ret == ESCH_OK, "test_logLevel() failed", ret);
+    esch_log_info(testLog, "[PASSED] test_logLevel()");
+
+    esch_log_info(testLog, "Start: test_logAsync()");
+    ret = test_logAsync(config);
+    ESCH_TEST_CHECK(ret == ESCH_OK, "test_logAsync() failed", ret);
+    esch_log_info(testLog, "[PASSED] test_logAsync()");
+
+    esch_log_info(testLog, "Start: test_trace()");
+    ret = test_trace(config);
+    ESCH_TEST_CHECK(ret == ESCH_OK, "test_trace() failed", ret);
+    esch_log_info(testLog, "[PASSED] test_trace()");
+
+    esch_log_info(testLog, "Start: test_integer()");
+    ret = test_integer(config);
     ESCH_TEST_CHECK(ret == ESCH_OK, "test_integer() failed", ret);
-    esch_log_info(g_testLog, "[PASSED] test_integer()");
-    */
+    esch_log_info(testLog, "[PASSED] test_integer()");
+
+    esch_log_info(testLog, "Start: test_float()");
+    ret = test_float(config);
+    ESCH_TEST_CHECK(ret == ESCH_OK, "test_float() failed", ret);
+    esch_log_info(testLog, "[PASSED] test_float()");
+
+    esch_log_info(testLog, "Start: test_fraction()");
+    ret = test_fraction(config);
+    ESCH_TEST_CHECK(ret == ESCH_OK, "test_fraction() failed", ret);
+    esch_log_info(testLog, "[PASSED] test_fraction()");
 
     esch_log_info(testLog, "All passed.");
 Exit:
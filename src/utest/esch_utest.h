@@ -16,19 +16,35 @@ extern esch_log* g_testLog;
 /* test cases */
 extern esch_error test_AllocCreateDeleteCDefault(esch_config* config);
 extern esch_error test_string(esch_config* config);
+extern esch_error test_stringRope(esch_config* config);
+extern esch_error test_stringView(esch_config* config);
 extern esch_error test_identifier();
+extern esch_error test_stringIdentifier(esch_config* config);
 extern esch_error test_config(esch_config* config);
+extern esch_error test_logLevel(esch_config* config);
+extern esch_error test_logAsync(esch_config* config);
+extern esch_error test_trace(esch_config* config);
 extern esch_error test_vectorBase(esch_config* config);
 extern esch_error test_vectorElementType(esch_config* config);
 extern esch_error test_vectorIteration(esch_config* config);
 extern esch_error test_vectorResizeFlag(esch_config* config);
 extern esch_error test_vectorDifferentValues(esch_config* config);
-extern esch_error test_integer();
+extern esch_error test_vectorSort(esch_config* config);
+extern esch_error test_vectorSplitLayout(esch_config* config);
+extern esch_error test_integer(esch_config* config);
+extern esch_error test_float(esch_config* config);
+extern esch_error test_fraction(esch_config* config);
 extern esch_error test_gcCreateDelete(esch_config* config);
 extern esch_error test_gcRecycleLogic(esch_config* config);
 extern esch_error test_gcNoExpand(esch_config* config);
 extern esch_error test_gcExpand(esch_config* config);
 extern esch_error test_pairBase(esch_config* config);
+extern esch_error test_pairPool(esch_config* config);
+extern esch_error test_pairList(esch_config* config);
+extern esch_error test_pairLength(esch_config* config);
+extern esch_error test_pairVector(esch_config* config);
+extern esch_error test_symbol(esch_config* config);
+extern esch_error test_hashtable(esch_config* config);
 
 #ifdef __cplusplus
 }
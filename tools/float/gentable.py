@@ -0,0 +1,72 @@
+#!/usr/bin/env python
+# Generate src/esch_float_table.c:
+#     python gentable.py > ../../src/esch_float_table.c
+import sys
+
+# Eisel-Lemire parsing: 5^q for q in [POW5_MIN, POW5_MAX], as 128 most
+# significant bits. Negative powers are rounded up before truncation.
+POW5_MIN = -342
+POW5_MAX = 308
+# Shortest printing: 10^k for k in [POW10_MIN, POW10_MAX], as 128 bits
+# with top bit set, rounded up.
+POW10_MIN = -292
+POW10_MAX = 326
+
+def pow5_128(q):
+    if q >= 0:
+        power5 = 5 ** q
+        while power5 < (1 << 127):
+            power5 *= 2
+        while power5 >= (1 << 128):
+            power5 //= 2
+        return power5
+    power5 = 5 ** -q
+    z = power5.bit_length()
+    if q >= -27:
+        return (1 << (z + 127)) // power5 + 1
+    c = (1 << (2 * z + 128)) // power5 + 1
+    while c >= (1 << 128):
+        c //= 2
+    return c
+
+def pow10_128(k):
+    # Smallest g >= 10^k / 2^e, with 2^127 <= g < 2^128.
+    if k >= 0:
+        num, den = 10 ** k, 1
+    else:
+        num, den = 1, 10 ** -k
+    e = num.bit_length() - den.bit_length()
+    if (num << max(-e, 0)) < (den << max(e, 0)):
+        e -= 1
+    # Now 2^e <= 10^k < 2^(e + 1).
+    shift = 127 - e
+    if shift >= 0:
+        num <<= shift
+    else:
+        den <<= -shift
+    return -(-num // den)
+
+def print_table(name, first, last, func):
+    print('const uint64_t %s[] =' % name)
+    print('{')
+    for n in range(first, last + 1):
+        value = func(n)
+        assert (1 << 127) <= value < (1 << 128)
+        hi = value >> 64
+        lo = value & ((1 << 64) - 1)
+        print('    ESCH_FLOAT_U128(0x%08x, 0x%08x, 0x%08x, 0x%08x), /* %d */' %
+              (hi >> 32, hi & 0xFFFFFFFF, lo >> 32, lo & 0xFFFFFFFF, n))
+    print('};')
+
+if __name__ == '__main__':
+    print('/* DON\'T MODIFY: The code below is automatically generated. */')
+    print('/* Generator: tools/float/gentable.py */')
+    print('#include "esch_number.h"')
+    print('')
+    print('/* 5^q, q in [%d, %d]: high 64 bits, then low 64 bits. */' %
+          (POW5_MIN, POW5_MAX))
+    print_table('esch_float_pow5_128', POW5_MIN, POW5_MAX, pow5_128)
+    print('')
+    print('/* 10^k, k in [%d, %d]: high 64 bits, then low 64 bits. */' %
+          (POW10_MIN, POW10_MAX))
+    print_table('esch_float_pow10_128', POW10_MIN, POW10_MAX, pow10_128)
@@ -0,0 +1,123 @@
+#!/usr/bin/env python
+# Decode binary trace written by esch_trace_start(). See src/esch_trace.h
+# for file layout.
+import sys
+import struct
+import json
+
+USAGE = 'Usage: decode.py [--chrome <output.json>] <trace file>'
+MAGIC = b'ESCHTRC\0'
+VERSION = 1
+HEADER = '8sII16x'
+RECORD = 'QHHIQQ'
+RECORD_SIZE = struct.calcsize('<' + RECORD)
+
+# Same order as enum esch_trace_event.
+(TYPE_NAME, OBJECT_NEW, OBJECT_DELETE, GC_ATTACH,
+ GC_MARK_BEGIN, GC_SWEEP_BEGIN, GC_RECYCLE_END) = range(1, 8)
+
+def read_records(filename):
+    data = open(filename, 'rb').read()
+    # Trace uses byte order of host. Guess it from version.
+    for order in [ '<', '>' ]:
+        magic, version, size = struct.unpack_from(order + HEADER, data, 0)
+        if version == VERSION:
+            break
+    if magic != MAGIC or version != VERSION or size != RECORD_SIZE:
+        raise ValueError('%s: not a trace file of version %d' %
+                         (filename, VERSION))
+    records = []
+    names = {}
+    offset = struct.calcsize(order + HEADER)
+    while offset + RECORD_SIZE <= len(data):
+        record = struct.unpack_from(order + RECORD, data, offset)
+        offset += RECORD_SIZE
+        if record[1] == TYPE_NAME:
+            length = record[3]
+            raw = data[offset:offset + length]
+            offset += (length + RECORD_SIZE - 1) // RECORD_SIZE * RECORD_SIZE
+            names[record[4]] = raw.decode('utf-8')
+        else:
+            records.append(record)
+    # Threads write buffers in turn, so sort by time.
+    records.sort(key=lambda r: r[0])
+    return records, names
+
+def type_name(names, type_id):
+    return names.get(type_id, '0x%x' % type_id)
+
+def count_types(records, names):
+    counts = {}
+    for timestamp, event, thread, size, type_id, gc_id in records:
+        if event not in [ OBJECT_NEW, OBJECT_DELETE, GC_ATTACH ]:
+            continue
+        entry = counts.setdefault(type_name(names, type_id), [ 0, 0, 0, 0 ])
+        if event == OBJECT_NEW:
+            entry[0] += 1
+            entry[1] += size
+        elif event == OBJECT_DELETE:
+            entry[2] += 1
+        else:
+            entry[3] += 1
+    return counts
+
+def find_pauses(records):
+    # One pause: (thread, mark begin, sweep begin, end, freed)
+    pauses = []
+    started = {}
+    for timestamp, event, thread, size, type_id, gc_id in records:
+        if event == GC_MARK_BEGIN:
+            started[thread] = [ timestamp, timestamp ]
+        elif event == GC_SWEEP_BEGIN and thread in started:
+            started[thread][1] = timestamp
+        elif event == GC_RECYCLE_END and thread in started:
+            begin, sweep = started.pop(thread)
+            pauses.append((thread, begin, sweep, timestamp, size))
+    return pauses
+
+def print_summary(counts, pauses):
+    print('%-24s %10s %12s %10s %10s' %
+          ('type', 'new', 'bytes', 'delete', 'attach'))
+    for name in sorted(counts, key=lambda n: -counts[n][0]):
+        entry = counts[name]
+        print('%-24s %10d %12d %10d %10d' %
+              (name, entry[0], entry[1], entry[2], entry[3]))
+    if len(pauses) == 0:
+        return
+    total = [ p[3] - p[1] for p in pauses ]
+    print('')
+    print('GC pauses: %d, total %.3f ms, max %.3f ms, freed %d objects' %
+          (len(pauses), sum(total) / 1e6, max(total) / 1e6,
+           sum([ p[4] for p in pauses ])))
+
+def chrome_trace(records, pauses):
+    # Chrome trace format uses microseconds.
+    base = (records[0][0] if len(records) > 0 else 0)
+    events = []
+    for thread, begin, sweep, end, freed in pauses:
+        for name, start, stop in [ ('gc:recycle', begin, end),
+                                   ('gc:mark', begin, sweep),
+                                   ('gc:sweep', sweep, end) ]:
+            events.append({ 'name': name, 'cat': 'gc', 'ph': 'X',
+                            'ts': (start - base) / 1000.0,
+                            'dur': (stop - start) / 1000.0,
+                            'pid': 1, 'tid': thread,
+                            'args': { 'freed': freed } })
+    return { 'traceEvents': events, 'displayTimeUnit': 'ns' }
+
+if __name__ == '__main__':
+    args = sys.argv[1:]
+    chrome = None
+    if len(args) > 1 and args[0] == '--chrome':
+        chrome = args[1]
+        args = args[2:]
+    if len(args) != 1:
+        print(USAGE)
+        sys.exit(1)
+    records, names = read_records(args[0])
+    pauses = find_pauses(records)
+    print_summary(count_types(records, names), pauses)
+    if chrome is not None:
+        fd = open(chrome, 'w')
+        json.dump(chrome_trace(records, pauses), fd, indent=1)
+        fd.close()
@@ -2,77 +2,283 @@
 import sys
 import re
 import os
-import glob
 
-def parse_file(filename):
+# Same order as enum esch_unicode_category in esch.h. ID 0 is reserved
+# for code points not in any category.
+CATEGORIES = [ 'lu', 'll', 'lt', 'lm', 'lo', 'mn', 'mc', 'nd', 'nl', 'no',
+               'pd', 'pc', 'po', 'sc', 'sm', 'sk', 'so', 'co' ]
+MAX_CODE_POINT = 0x10FFFF
+# Each block of second stage covers 2^BLOCK_SHIFT code points. 7 gives
+# the smallest tables for current data (about 32KB).
+BLOCK_SHIFT = 7
+# Identifier bitsets use blocks of 2^IDENTIFIER_SHIFT code points, and
+# store 2 bits for each code point (about 11KB).
+IDENTIFIER_SHIFT = 8
+# Same rules as esch_unicode_string_is_valid_identifier(): for ASCII,
+# first character can't be a digit, and others must be letters, digits
+# or extended alphabetic characters. Other code points are allowed if
+# they belong to any category, but first one can't be a number.
+ASCII_END = 127
+ASCII_EXTENDED = '!$%&*+-./:<=>?@^_~'
+NUMBER_CATEGORIES = [ 'nd', 'nl', 'no' ]
+USAGE = 'Usage: gencode.py [--bsearch] <directory of category files>'
+
+def parse_file(filename, category_id, table):
     fd = open(filename)
     pat = re.compile('U\\+([0-9A-Fa-f]*)[\t ][\t ]*')
 
-    line = fd.readline()
-    m = pat.match(line)
-    valuestr = m.group(1)
-    sequence_list = []
-    sequence = []
-    previous_val = 0
-    current_val = int(valuestr, 16)
-    sequence = [ current_val ]
     line = fd.readline()
     while line:
-        previous_val = current_val
         m = pat.match(line)
-        valuestr = m.group(1)
-        current_val = int(valuestr, 16)
-        if current_val == previous_val + 1:
-            sequence.append(current_val)
-        else:
-            sequence_list.append(sequence)
-            sequence = [ current_val ]
+        table[int(m.group(1), 16)] = category_id
         line = fd.readline()
-    sequence_list.append(sequence)
-
-    category = os.path.basename(filename).split('.')[0]
-    up_bounds = []
-    low_bounds = []
-    for each_sequence in sequence_list:
-        low_bounds.append(each_sequence[0])
-        up_bounds.append(each_sequence[-1])
-
-    print("#include \"esch.h\"")
-    print('static int\nesch_unicode_range_%s_low_bound[] = ' % \
-            category)
+    fd.close()
+
+def build_stages(table):
+    block_size = 1 << BLOCK_SHIFT
+    stage1 = []
+    stage2 = []
+    blocks = {}
+    for base in range(0, MAX_CODE_POINT + 1, block_size):
+        block = tuple(table[base:base + block_size])
+        if block not in blocks:
+            blocks[block] = len(blocks)
+            stage2.extend(block)
+        stage1.append(blocks[block])
+    return stage1, stage2
+
+def print_array(name, ctype, values):
+    print('static const %s\n%s[] =' % (ctype, name))
+    print('{')
+    for n in range(0, len(values), 16):
+        print('    ' + ' '.join(['%d,' % v for v in values[n:n + 16]]))
+    print('};')
+
+def print_tables(table):
+    stage1, stage2 = build_stages(table)
+    if max(stage1) < 256:
+        stage1_type = 'unsigned char'
+    else:
+        stage1_type = 'unsigned short'
+
+    print('#include "esch_string.h"')
+    print('')
+    print('/*')
+    print(' * Two-stage lookup table: first stage maps high bits of code point')
+    print(' * to a block, second stage maps low bits in block to category ID.')
+    print(' * Blocks with same content are shared.')
+    print(' */')
+    print('#define ESCH_UNICODE_BLOCK_SHIFT %d' % BLOCK_SHIFT)
+    print('#define ESCH_UNICODE_BLOCK_MASK ((1 << ESCH_UNICODE_BLOCK_SHIFT) - 1)')
+    print('')
+    print_array('esch_unicode_category_stage1', stage1_type, stage1)
+    print_array('esch_unicode_category_stage2', 'unsigned char', stage2)
+    print('')
+    print('int\nesch_unicode_get_category(esch_unicode ch)')
+    print('{')
+    print('    if (ch < 0 || ch > 0x%X)' % MAX_CODE_POINT)
+    print('        return ESCH_UNICODE_CATEGORY_NONE;')
+    print('    return esch_unicode_category_stage2[')
+    print('        (esch_unicode_category_stage1[ch >> ESCH_UNICODE_BLOCK_SHIFT]')
+    print('         << ESCH_UNICODE_BLOCK_SHIFT) | (ch & ESCH_UNICODE_BLOCK_MASK)];')
+    print('}')
+    print_predicates()
+    print_identifier_ascii(table)
+    print_identifier_bits(table)
+
+def is_identifier_initial(table, ch):
+    if ch < ASCII_END:
+        return not chr(ch).isdigit()
+    return table[ch] not in \
+        [ CATEGORIES.index(c) + 1 for c in NUMBER_CATEGORIES ]
+
+def is_identifier_subsequent(table, ch):
+    if ch < ASCII_END:
+        c = chr(ch)
+        return (c.isalnum() or c in ASCII_EXTENDED)
+    return table[ch] != 0
+
+def build_identifier_bits(table):
+    block_size = 1 << IDENTIFIER_SHIFT
+    stage1 = []
+    stage2 = []
+    blocks = {}
+    for base in range(0, MAX_CODE_POINT + 1, block_size):
+        block = []
+        for rule in [ is_identifier_initial, is_identifier_subsequent ]:
+            for word_base in range(base, base + block_size, 32):
+                word = 0
+                for bit in range(32):
+                    if rule(table, word_base + bit):
+                        word |= (1 << bit)
+                block.append(word)
+        block = tuple(block)
+        if block not in blocks:
+            blocks[block] = len(blocks)
+            stage2.extend(block)
+        stage1.append(blocks[block])
+    return stage1, stage2
+
+def print_identifier_ascii(table):
+    classes = []
+    for ch in range(128):
+        value = 0
+        if is_identifier_initial(table, ch):
+            value |= 1
+        if is_identifier_subsequent(table, ch):
+            value |= 2
+        classes.append(value)
+    print('')
+    print('/*')
+    print(' * Identifier classes of ASCII characters, for inline checks:')
+    print(' * ESCH_IDENTIFIER_INITIAL | ESCH_IDENTIFIER_SUBSEQUENT.')
+    print(' */')
+    print('const unsigned char\nesch_unicode_identifier_ascii[] =')
     print('{')
-    for each_low_bound in low_bounds:
-        print('    0x%x, ' % each_low_bound)
+    for n in range(0, len(classes), 16):
+        print('    ' + ' '.join(['%d,' % v for v in classes[n:n + 16]]))
     print('};')
-    print('static int\nesch_unicode_range_%s_up_bound[] = ' % \
-            category)
+
+def print_identifier_bits(table):
+    stage1, stage2 = build_identifier_bits(table)
+    words = 1 << (IDENTIFIER_SHIFT - 5)
+    assert max(stage1) < 256
+
+    print('')
+    print('/*')
+    print(' * Identifier bitsets, in blocks of %d code points. Each block' %
+          (1 << IDENTIFIER_SHIFT))
+    print(' * has %d words for first character, then %d words for other' %
+          (words, words))
+    print(' * characters. Blocks with same content are shared.')
+    print(' */')
+    print('#define ESCH_IDENTIFIER_SHIFT %d' % IDENTIFIER_SHIFT)
+    print('#define ESCH_IDENTIFIER_WORDS %d' % words)
+    print('#define ESCH_IDENTIFIER_BLOCK(ch) \\')
+    print('    (esch_unicode_identifier_bits + \\')
+    print('     esch_unicode_identifier_stage1[(ch) >> ESCH_IDENTIFIER_SHIFT] * \\')
+    print('     ESCH_IDENTIFIER_WORDS * 2)')
+    print('')
+    print_array('esch_unicode_identifier_stage1', 'unsigned char', stage1)
+    print('static const uint32_t\nesch_unicode_identifier_bits[] =')
     print('{')
-    for each_up_bound in up_bounds:
-        print('    0x%x, ' % each_up_bound)
+    for n in range(0, len(stage2), 4):
+        print('    ' + ' '.join(['0x%08x,' % v for v in stage2[n:n + 4]]))
     print('};')
+    print('')
+    for name, offset in [ ('initial', ''),
+                          ('subsequent', ' + ESCH_IDENTIFIER_WORDS') ]:
+        print('int\nesch_unicode_is_identifier_%s(esch_unicode ch)' % name)
+        print('{')
+        print('    const uint32_t* block = NULL;')
+        print('    if (ch < 0 || ch > 0x%X)' % MAX_CODE_POINT)
+        print('        return 0;')
+        print('    block = ESCH_IDENTIFIER_BLOCK(ch)%s;' % offset)
+        print('    return (block[(ch >> 5) & (ESCH_IDENTIFIER_WORDS - 1)] >> '
+              '(ch & 31)) & 1;')
+        print('}')
 
-    print('int\nesch_unicode_is_range_%s(esch_unicode ch)' % category)
+def print_identifier_predicates():
+    # Low-memory builds derive identifier rules from categories.
+    numbers = ' ||\n             '.join(
+        [ 'category == ESCH_UNICODE_CATEGORY_%s' % c.upper()
+          for c in NUMBER_CATEGORIES ])
+    print('int\nesch_unicode_is_identifier_initial(esch_unicode ch)')
+    print('{')
+    print('    int category = ESCH_UNICODE_CATEGORY_NONE;')
+    print('    if (ch < 0 || ch > 0x%X)' % MAX_CODE_POINT)
+    print('        return 0;')
+    print('    if (ch < %d)' % ASCII_END)
+    print('        return !esch_unicode_is_digit(ch);')
+    print('    category = esch_unicode_get_category(ch);')
+    print('    return !(%s);' % numbers)
+    print('}')
+    print('int\nesch_unicode_is_identifier_subsequent(esch_unicode ch)')
     print('{')
-    print('    size_t n = 0;')
-    print('    for (; n < sizeof(esch_unicode_range_%s_up_bound) / sizeof(esch_unicode); ++n)' %\
-                        category)
+    print('    if (ch < 0)')
+    print('        return 0;')
+    print('    if (ch < %d)' % ASCII_END)
+    print('        return (esch_unicode_is_digit(ch) ||')
+    print('                esch_unicode_is_alpha(ch) ||')
+    print('                esch_unicode_is_extended_alphabetic(ch));')
+    print('    return esch_unicode_get_category(ch) != '
+          'ESCH_UNICODE_CATEGORY_NONE;')
+    print('}')
+
+def build_segments(table):
+    # Segment i covers [starts[i], starts[i + 1]). Gaps between
+    # categories become segments of category 0.
+    starts = [ 0 ]
+    categories = [ table[0] ]
+    for ch in range(1, MAX_CODE_POINT + 1):
+        if table[ch] != table[ch - 1]:
+            starts.append(ch)
+            categories.append(table[ch])
+    return starts, categories
+
+def print_segments(table):
+    starts, categories = build_segments(table)
+
+    print('#include "esch_string.h"')
+    print('')
+    print('/*')
+    print(' * Sorted, merged ranges for low-memory builds: each entry of')
+    print(' * starts begins a range of code points that runs to the next')
+    print(' * entry, and all code points in it have the same category.')
+    print(' */')
+    print('#define ESCH_UNICODE_SEGMENTS %d' % len(starts))
+    print('')
+    print('static const esch_unicode\nesch_unicode_category_starts[] =')
+    print('{')
+    for n in range(0, len(starts), 8):
+        print('    ' + ' '.join(['0x%x,' % v for v in starts[n:n + 8]]))
+    print('};')
+    print_array('esch_unicode_category_ids', 'unsigned char', categories)
+    print('')
+    print('int\nesch_unicode_get_category(esch_unicode ch)')
+    print('{')
+    print('    const esch_unicode* base = esch_unicode_category_starts;')
+    print('    size_t n = ESCH_UNICODE_SEGMENTS;')
+    print('    size_t half = 0;')
+    print('    if (ch < 0 || ch > 0x%X)' % MAX_CODE_POINT)
+    print('        return ESCH_UNICODE_CATEGORY_NONE;')
+    print('    /* Branchless: compiler turns the select into cmov. */')
+    print('    while (n > 1)')
     print('    {')
-    print('        if (ch >= esch_unicode_range_%s_low_bound[n] && ch <= esch_unicode_range_%s_up_bound[n])' % \
-            (category, category))
-    print('            return 1;')
+    print('        half = n / 2;')
+    print('        base = (base[half] <= ch? base + half: base);')
+    print('        n -= half;')
     print('    }')
-    print('    return 0;')
+    print('    return esch_unicode_category_ids[base - '
+          'esch_unicode_category_starts];')
     print('}')
-    fd.close()
+    print_predicates()
+    print_identifier_ascii(table)
+    print_identifier_predicates()
+
+def print_predicates():
+    for category in CATEGORIES:
+        print('int\nesch_unicode_is_range_%s(esch_unicode ch)' % category)
+        print('{')
+        print('    return esch_unicode_get_category(ch) == '
+              'ESCH_UNICODE_CATEGORY_%s;' % category.upper())
+        print('}')
 
 if __name__ == '__main__':
+    args = sys.argv[1:]
+    bsearch = False
+    if len(args) > 0 and args[0] == '--bsearch':
+        bsearch = True
+        args = args[1:]
+    if len(args) != 1 or not os.path.isdir(args[0]):
+        print(USAGE)
+        sys.exit(1)
     print('/* DON\'T MODIFY: The code below is automatically generated. */')
     print('/* Data source: http://www.fileformat.info/info/unicode/category/index.htm */')
-    if (os.path.isdir(sys.argv[1])):
-        filelist = glob.glob(os.path.join(sys.argv[1], '*.txt'))
-        filelist.sort()
-        for eachfile in filelist:
-            parse_file(eachfile)
+    table = [ 0 ] * (MAX_CODE_POINT + 1)
+    for n, category in enumerate(CATEGORIES):
+        parse_file(os.path.join(args[0], category + '.txt'), n + 1, table)
+    if bsearch:
+        print_segments(table)
     else:
-        parse_file(sys.argv[1])
-
+        print_tables(table)